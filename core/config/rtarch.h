@@ -220,6 +220,8 @@
  * conversion to lower fp-precision narrows onto lower-half of selected vec-size
  * conversion to higher fp-precision widens from lower-half of selected vec-size
  * cux*s_**, cuy*s_** are reserved for fp-precision conversion of the upper-half
+ * cvyms_rr, cuyms_rr, cvxos_rr, cuxos_rr (fp16<->fp32) are only defined where
+ * conversion is native (check with #if defined), narrowing zeroes other half
  *
  * cu**s_rr, cu**s_ld are reserved for fp-to-unsigned-int conversion, keeps size
  * cv**n_rr, cv**n_ld already in use for signed-int-to-fp conversion, keeps size
@@ -727,6 +729,12 @@
 #define RT_SIMD_COMPAT_FMS      RT_SIMD_COMPAT_FMS_MASTER
 #endif /* RT_SIMD_COMPAT_FMS */
 
+/* RT_BASE_COMPAT_FAR when enabled changes the default behavior
+ * of label-targeted jumps to inverted short branch over long jump */
+#ifndef RT_BASE_COMPAT_FAR
+#define RT_BASE_COMPAT_FAR      0 /* extends 21-bit b.cond to 28-bit */
+#endif /* RT_BASE_COMPAT_FAR */
+
 #if   (RT_2K8X1 >= 1) && (RT_SIMD == 2048) && (RT_REGS <= 32)
 #include "rtarch_a64_SVEx1v1.h"
 #elif (RT_1K4X2 != 0) && (RT_SIMD == 2048) && (RT_REGS <= 16)
@@ -1027,6 +1035,12 @@
 #undef  RT_BASE_COMPAT_REV
 #define RT_BASE_COMPAT_REV (RT_M32 | RT_M64) /* enable MIPS Revision 6 */
 
+/* RT_BASE_COMPAT_FAR when enabled changes the default behavior
+ * of label-targeted jumps to inverted short branch over long jump */
+#ifndef RT_BASE_COMPAT_FAR
+#define RT_BASE_COMPAT_FAR      0 /* extends 16/18-bit jumps to 28-bit */
+#endif /* RT_BASE_COMPAT_FAR */
+
 #if   (RT_2K8X1 != 0) && (RT_SIMD == 2048)
 #error "mipsMSA doesn't support SIMD wider than 128-bit, check build flags"
 #elif (RT_1K4X2 != 0) && (RT_SIMD == 2048)
@@ -1338,6 +1352,12 @@
 #define RT_BASE_COMPAT_ZFL      1 /* only necessary on POWER */
 #endif /* RT_BASE_COMPAT_ZFL */
 
+/* RT_BASE_COMPAT_FAR when enabled changes the default behavior
+ * of label-targeted jumps to inverted short branch over long jump */
+#ifndef RT_BASE_COMPAT_FAR
+#define RT_BASE_COMPAT_FAR      0 /* extends 16-bit bc to 26-bit */
+#endif /* RT_BASE_COMPAT_FAR */
+
 /* RT_BASE_COMPAT_REM when enabled changes the default behavior
  * of remainder instructions to their ISA 3.0 implementation */
 #ifdef  RT_SIMD_CODE
@@ -1447,6 +1447,30 @@
 #define mulwp_xm(MS, DS) /* Reax is in/out, prepares Redx for divwn_x* */   \
         mulwx_ld(Reax, W(MS), W(DS))  /* must not exceed operands size */
 
+/* mhi (G = G * S >> 32), high half of full 32x32-bit product
+ * set-flags: undefined
+ * low half is given by mulwx_**, both halves at once by mulw*_x* */
+
+#define mhiwx_rr(RG, RS)                                                    \
+        EMITW(0x9BA07C00 | MRM(REG(RG), REG(RG), REG(RS)))                  \
+        EMITW(0xD360FC00 | MRM(REG(RG), REG(RG), 0x00))
+
+#define mhiwx_ld(RG, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C1(DS), EMPTY2)   \
+        EMITW(0xB8400000 | MDM(TMxx,    MOD(MS), VAL(DS), B1(DS), P1(DS)))  \
+        EMITW(0x9BA07C00 | MRM(REG(RG), REG(RG), TMxx))                     \
+        EMITW(0xD360FC00 | MRM(REG(RG), REG(RG), 0x00))
+
+#define mhiwn_rr(RG, RS)                                                    \
+        EMITW(0x9B207C00 | MRM(REG(RG), REG(RG), REG(RS)))                  \
+        EMITW(0xD360FC00 | MRM(REG(RG), REG(RG), 0x00))
+
+#define mhiwn_ld(RG, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C1(DS), EMPTY2)   \
+        EMITW(0xB8400000 | MDM(TMxx,    MOD(MS), VAL(DS), B1(DS), P1(DS)))  \
+        EMITW(0x9B207C00 | MRM(REG(RG), REG(RG), TMxx))                     \
+        EMITW(0xD360FC00 | MRM(REG(RG), REG(RG), 0x00))
+
 /* div (G = G / S)
  * set-flags: undefined */
 
@@ -1762,6 +1786,108 @@
         EMITW(0x38400000 | MDM(TMxx,    MOD(MS), VBL(DS), B1(DS), P1(DS)))  \
         EMITW(0x6B000000 | MRM(TZxx,    TMxx,    REG(RT)))
 
+/* xad (G = M, M = M + G), atomic fetch-add
+ * set-flags: undefined
+ * xad, xch, cas need natural alignment of memory args
+ * and are sequentially consistent (act as full memory barriers) */
+
+#define xadwx_st(RG, MG, DG)                                                \
+        AUW(SIB(MG),  EMPTY,  EMPTY,    MOD(MG), VAL(DG), C3(DG), EMPTY2)   \
+        EMITW(0x0B000000 | MRM(TDxx,    MOD(MG), TDxx) | ADR)               \
+        EMITW(0x885FFC00 | MRM(TMxx,    TDxx,    0x00))                     \
+        EMITW(0x0B000000 | MRM(TIxx,    TMxx,    REG(RG)))                  \
+        EMITW(0x8800FC00 | MRM(TIxx,    TDxx,    TPxx))                     \
+        EMITW(0x35FFFFA0 | TPxx)      /* <- cbnz ldaxr */                   \
+        EMITW(0xD5033BBF)                  /* <- dmb ish */                 \
+        EMITW(0x2A000000 | MRM(REG(RG), TZxx,    TMxx))
+
+/* xch (G = M, M = G), atomic exchange
+ * set-flags: undefined */
+
+#define xchwx_st(RG, MG, DG)                                                \
+        AUW(SIB(MG),  EMPTY,  EMPTY,    MOD(MG), VAL(DG), C3(DG), EMPTY2)   \
+        EMITW(0x0B000000 | MRM(TDxx,    MOD(MG), TDxx) | ADR)               \
+        EMITW(0x885FFC00 | MRM(TMxx,    TDxx,    0x00))                     \
+        EMITW(0x8800FC00 | MRM(REG(RG), TDxx,    TPxx))                     \
+        EMITW(0x35FFFFC0 | TPxx)      /* <- cbnz ldaxr */                   \
+        EMITW(0xD5033BBF)                  /* <- dmb ish */                 \
+        EMITW(0x2A000000 | MRM(REG(RG), TZxx,    TMxx))
+
+/* cas (if M == Reax then M = S, Reax = M), atomic compare-and-swap
+ * set-flags: undefined
+ * success is checked by comparing Reax to its value before cas */
+
+#define caswx_st(RS, MG, DG)     /* Reax is in/out, RS, MG != Reax */       \
+        AUW(SIB(MG),  EMPTY,  EMPTY,    MOD(MG), VAL(DG), C3(DG), EMPTY2)   \
+        EMITW(0x0B000000 | MRM(TDxx,    MOD(MG), TDxx) | ADR)               \
+        EMITW(0x885FFC00 | MRM(TMxx,    TDxx,    0x00))                     \
+        EMITW(0x6B000000 | MRM(TZxx,    TMxx,    Teax))                     \
+        EMITW(0x54000061)             /* <- b.ne dmb */                     \
+        EMITW(0x8800FC00 | MRM(REG(RS), TDxx,    TPxx))                     \
+        EMITW(0x35FFFF80 | TPxx)      /* <- cbnz ldaxr */                   \
+        EMITW(0xD5033BBF)                  /* <- dmb ish */                 \
+        EMITW(0x2A000000 | MRM(Teax,    TZxx,    TMxx))
+
+/* fen (memory-ordering fence)
+ * set-flags: no
+ * fenxx_aq - acquire: prior loads are ordered before subsequent loads/stores
+ * fenxx_rl - release: prior loads/stores are ordered before subsequent stores
+ * fenxx_sc - full: prior loads/stores are ordered before subsequent ones */
+
+#define fenxx_aq()                                                          \
+        EMITW(0xD50339BF)                  /* <- dmb ishld */
+
+#define fenxx_rl()                                                          \
+        EMITW(0xD5033BBF)                  /* <- dmb ish */
+
+#define fenxx_sc()                                                          \
+        EMITW(0xD5033BBF)                  /* <- dmb ish */
+
+/* cnt (D = number of set bits in S), population count
+ * set-flags: undefined */
+
+#define cntwx_rr(RD, RS)                                                    \
+        EMITW(0x53007C00 | MRM(TMxx,    REG(RS), 0x00) | 1 << 16)           \
+        EMITW(0x1200F000 | MRM(TMxx,    TMxx,    0x00))  /* <- 0x55.. */    \
+        EMITW(0x4B000000 | MRM(REG(RD), REG(RS), TMxx))                     \
+        EMITW(0x53007C00 | MRM(TMxx,    REG(RD), 0x00) | 2 << 16)           \
+        EMITW(0x1200E400 | MRM(TMxx,    TMxx,    0x00))  /* <- 0x33.. */    \
+        EMITW(0x1200E400 | MRM(REG(RD), REG(RD), 0x00))  /* <- 0x33.. */    \
+        EMITW(0x0B000000 | MRM(REG(RD), REG(RD), TMxx))                     \
+        EMITW(0x0B400000 | MRM(REG(RD), REG(RD), REG(RD)) | 4 << 10)        \
+        EMITW(0x1200CC00 | MRM(REG(RD), REG(RD), 0x00))  /* <- 0x0F.. */    \
+        EMITW(0x0B000000 | MRM(REG(RD), REG(RD), REG(RD)) | 8 << 10)        \
+        EMITW(0x0B000000 | MRM(REG(RD), REG(RD), REG(RD)) | 16 << 10)       \
+        EMITW(0x53007C00 | MRM(REG(RD), REG(RD), 0x00) | 24 << 16)
+
+/* clz (D = number of leading zeros in S)
+ * set-flags: undefined
+ * clz, ctz return operand size in bits for zero source */
+
+#define clzwx_rr(RD, RS)                                                    \
+        EMITW(0x5AC01000 | MRM(REG(RD), REG(RS), 0x00))
+
+/* ctz (D = number of trailing zeros in S)
+ * set-flags: undefined */
+
+#define ctzwx_rr(RD, RS)                                                    \
+        EMITW(0x5AC00000 | MRM(REG(RD), REG(RS), 0x00))                     \
+        EMITW(0x5AC01000 | MRM(REG(RD), REG(RD), 0x00))
+
+/* bsw (D = S with bytes in reversed order), byte swap
+ * set-flags: undefined */
+
+#define bswwx_rr(RD, RS)                                                    \
+        EMITW(0x5AC00800 | MRM(REG(RD), REG(RS), 0x00))
+
+/* bfx (G = G >> IS & ((1 << IT) - 1)), unsigned bit-field extract
+ * set-flags: undefined
+ * IT > 0, IS + IT <= 32 */
+
+#define bfxwx_ri(RG, IS, IT)                                                \
+        EMITW(0x53000000 | MRM(REG(RG), REG(RG), 0x00) |                    \
+             (VAL(IS) & 0x1F) << 16 | ((VAL(IS)+VAL(IT)-1) & 0x1F) << 10)
+
 /* ver (Mebp/inf_VER = SIMD-version)
  * set-flags: no
  * For interpretation of SIMD build flags check compatibility layer in rtzero.h
@@ -1831,7 +1957,9 @@
  * maximum byte-address-range for un/conditional jumps is signed 18/16-bit
  * based on minimum natively-encoded offset across supported targets (u/c)
  * MIPS:18-bit, POWER:26-bit, AArch32:26-bit, AArch64:28-bit, x86:32-bit /
- * MIPS:18-bit, POWER:16-bit, AArch32:26-bit, AArch64:21-bit, x86:32-bit */
+ * MIPS:18-bit, POWER:16-bit, AArch32:26-bit, AArch64:21-bit, x86:32-bit
+ * RT_BASE_COMPAT_FAR (rtarch.h) extends AArch64 conditional jumps to 28-bit
+ * via inverted b.cond over unconditional b (label 0 reserved) */
 
 #define jmpxx_xr(RS)           /* register-targeted unconditional jump */   \
         EMITW(0xD61F0000 | MRM(0x00,    REG(RS), 0x00))
@@ -1856,40 +1984,40 @@
         ASM_BEG ASM_OP1(b,    lb) ASM_END
 
 #define jezxx_lb(lb)               /* setting-flags-arithmetic -> jump */   \
-        ASM_BEG ASM_OP1(b.eq, lb) ASM_END
+        JCC1(b.eq, b.ne, lb)
 
 #define jnzxx_lb(lb)               /* setting-flags-arithmetic -> jump */   \
-        ASM_BEG ASM_OP1(b.ne, lb) ASM_END
+        JCC1(b.ne, b.eq, lb)
 
 #define jeqxx_lb(lb)                                /* compare -> jump */   \
-        ASM_BEG ASM_OP1(b.eq, lb) ASM_END
+        JCC1(b.eq, b.ne, lb)
 
 #define jnexx_lb(lb)                                /* compare -> jump */   \
-        ASM_BEG ASM_OP1(b.ne, lb) ASM_END
+        JCC1(b.ne, b.eq, lb)
 
 #define jltxx_lb(lb)                                /* compare -> jump */   \
-        ASM_BEG ASM_OP1(b.lo, lb) ASM_END
+        JCC1(b.lo, b.hs, lb)
 
 #define jlexx_lb(lb)                                /* compare -> jump */   \
-        ASM_BEG ASM_OP1(b.ls, lb) ASM_END
+        JCC1(b.ls, b.hi, lb)
 
 #define jgtxx_lb(lb)                                /* compare -> jump */   \
-        ASM_BEG ASM_OP1(b.hi, lb) ASM_END
+        JCC1(b.hi, b.ls, lb)
 
 #define jgexx_lb(lb)                                /* compare -> jump */   \
-        ASM_BEG ASM_OP1(b.hs, lb) ASM_END
+        JCC1(b.hs, b.lo, lb)
 
 #define jltxn_lb(lb)                                /* compare -> jump */   \
-        ASM_BEG ASM_OP1(b.lt, lb) ASM_END
+        JCC1(b.lt, b.ge, lb)
 
 #define jlexn_lb(lb)                                /* compare -> jump */   \
-        ASM_BEG ASM_OP1(b.le, lb) ASM_END
+        JCC1(b.le, b.gt, lb)
 
 #define jgtxn_lb(lb)                                /* compare -> jump */   \
-        ASM_BEG ASM_OP1(b.gt, lb) ASM_END
+        JCC1(b.gt, b.le, lb)
 
 #define jgexn_lb(lb)                                /* compare -> jump */   \
-        ASM_BEG ASM_OP1(b.ge, lb) ASM_END
+        JCC1(b.ge, b.lt, lb)
 
 #define LBL(lb)                                          /* code label */   \
         ASM_BEG ASM_OP0(lb:) ASM_END
@@ -1898,7 +2026,9 @@
 
 /* stack (push stack = S, D = pop stack)
  * set-flags: no (sequence cmp/stack_la/jmp is not allowed on MIPS & POWER)
- * adjust stack pointer with 8-byte (64-bit) steps on all current targets */
+ * adjust stack pointer with 8-byte (64-bit) steps on all current targets
+ * stack_sa/stack_la skip 128-byte red zone below sp (Apple arm64 ABI)
+ * which leaf functions may use for locals, as ASM sections can be inlined */
 
 #define stack_st(RS)                                                        \
         EMITW(0xA9BF0000 | MRM(REG(RS), SPxx,    0x00) | TZxx << 10)
@@ -1907,6 +2037,7 @@
         EMITW(0xA8C10000 | MRM(REG(RD), SPxx,    0x00) | TZxx << 10)
 
 #define stack_sa()   /* save all, [Reax - RegE] + 8 temps, 22 regs total */ \
+        EMITW(0xD10203FF)                                                   \
         EMITW(0xA9BF0000 | MRM(Teax,    SPxx,    0x00) | Tecx << 10)        \
         EMITW(0xA9BF0000 | MRM(Tedx,    SPxx,    0x00) | Tebx << 10)        \
         EMITW(0xA9BF0000 | MRM(Tebp,    SPxx,    0x00) | Tesi << 10)        \
@@ -1930,7 +2061,8 @@
         EMITW(0xA8C10000 | MRM(Tedi,    SPxx,    0x00) | Teg8 << 10)        \
         EMITW(0xA8C10000 | MRM(Tebp,    SPxx,    0x00) | Tesi << 10)        \
         EMITW(0xA8C10000 | MRM(Tedx,    SPxx,    0x00) | Tebx << 10)        \
-        EMITW(0xA8C10000 | MRM(Teax,    SPxx,    0x00) | Tecx << 10)
+        EMITW(0xA8C10000 | MRM(Teax,    SPxx,    0x00) | Tecx << 10)        \
+        EMITW(0x910203FF)
 
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
@@ -1967,6 +2099,24 @@
 #define CMJ(cc, lb)                                                         \
         cc(lb)
 
+/* internal definitions for label-targeted conditional jumps, with
+ * RT_BASE_COMPAT_FAR enabled 21-bit b.cond is replaced by inverted b.cond
+ * over 28-bit unconditional b, local label 0 is reserved for internal use */
+
+#if (RT_BASE_COMPAT_FAR == 0) /* native */
+
+#define JCC1(cc, nc, lb)                                                    \
+        ASM_BEG ASM_OP1(cc, lb) ASM_END
+
+#else /* RT_BASE_COMPAT_FAR != 0 : far */
+
+#define JCC1(cc, nc, lb)                                                    \
+        ASM_BEG ASM_OP1(nc, 0f) ASM_END                                     \
+        ASM_BEG ASM_OP1(b, lb) ASM_END                                      \
+        ASM_BEG ASM_OP0(0:) ASM_END
+
+#endif /* RT_BASE_COMPAT_FAR != 0 : far */
+
 #endif /* RT_RTARCH_A32_H */
 
 /******************************************************************************/
@@ -243,6 +243,15 @@
         AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C2(DD), EMPTY2)   \
         EMITW(0x3C800000 | MPM(REG(XS), MOD(MD), VAL(DD), B2(DD), P2(DD)))
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment
+ * native SIMD load/store doesn't require alignment on this target */
+
+#define muvix_ld(XD, MS, DS)                                                \
+        movix_ld(W(XD), W(MS), W(DS))
+
+#define muvix_st(XS, MD, DD)                                                \
+        movix_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -260,6 +269,40 @@
         EMITW(0x6EA01C00 | MXM(TmmM,    REG(XS), Tmm0))                     \
         EMITW(0x3C800000 | MPM(TmmM,    MOD(MG), VAL(DG), B2(DG), P2(DG)))
 
+/* unl (G = G unpack-low S), (D = S unpack-low T) if (#D != #T)
+ * interleaves lower halves of each 128-bit lane, S-elements go first */
+
+#define unlix_rr(XG, XS)                                                    \
+        unlix3rr(W(XG), W(XG), W(XS))
+
+#define unlix_ld(XG, MS, DS)                                                \
+        unlix3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define unlix3rr(XD, XS, XT)                                                \
+        EMITW(0x4E803800 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define unlix3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x4E803800 | MXM(REG(XD), REG(XS), TmmM))
+
+/* unh (G = G unpack-high S), (D = S unpack-high T) if (#D != #T)
+ * interleaves upper halves of each 128-bit lane, S-elements go first */
+
+#define unhix_rr(XG, XS)                                                    \
+        unhix3rr(W(XG), W(XG), W(XS))
+
+#define unhix_ld(XG, MS, DS)                                                \
+        unhix3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define unhix3rr(XD, XS, XT)                                                \
+        EMITW(0x4E807800 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define unhix3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x4E807800 | MXM(REG(XD), REG(XS), TmmM))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andix_rr(XG, XS)                                                    \
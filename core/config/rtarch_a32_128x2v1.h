@@ -163,6 +163,15 @@
         EMITW(0x3D800000 | MPM(REG(XS), MOD(MD), VAL(DD), B4(DD), L2(DD)))  \
         EMITW(0x3D800000 | MPM(RYG(XS), MOD(MD), VYL(DD), B4(DD), L2(DD)))
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment
+ * native SIMD load/store doesn't require alignment on this target */
+
+#define muvcx_ld(XD, MS, DS)                                                \
+        movcx_ld(W(XD), W(MS), W(DS))
+
+#define muvcx_st(XS, MD, DD)                                                \
+        movcx_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -172,6 +172,15 @@
         AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), A1(DD), EMPTY2)   \
         EMITW(0xE5804000 | MPM(REG(XS), MOD(MD), VAL(DD), B3(DD), F1(DD)))
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment
+ * native SIMD load/store doesn't require alignment on this target */
+
+#define muvox_ld(XD, MS, DS)                                                \
+        movox_ld(W(XD), W(MS), W(DS))
+
+#define muvox_st(XS, MD, DD)                                                \
+        movox_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
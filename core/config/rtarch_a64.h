@@ -1088,6 +1088,26 @@
 #define mulzp_xm(MS, DS) /* Reax is in/out, prepares Redx for divzn_x* */   \
         mulzx_ld(Reax, W(MS), W(DS))  /* must not exceed operands size */
 
+/* mhi (G = G * S >> 64), high half of full 64x64-bit product
+ * set-flags: undefined
+ * low half is given by mulzx_**, both halves at once by mulz*_x* */
+
+#define mhizx_rr(RG, RS)                                                    \
+        EMITW(0x9BC07C00 | MRM(REG(RG), REG(RG), REG(RS)))
+
+#define mhizx_ld(RG, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C1(DS), EMPTY2)   \
+        EMITW(0xF8400000 | MDM(TMxx,    MOD(MS), VXL(DS), B1(DS), P1(DS)))  \
+        EMITW(0x9BC07C00 | MRM(REG(RG), REG(RG), TMxx))
+
+#define mhizn_rr(RG, RS)                                                    \
+        EMITW(0x9B407C00 | MRM(REG(RG), REG(RG), REG(RS)))
+
+#define mhizn_ld(RG, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C1(DS), EMPTY2)   \
+        EMITW(0xF8400000 | MDM(TMxx,    MOD(MS), VXL(DS), B1(DS), P1(DS)))  \
+        EMITW(0x9B407C00 | MRM(REG(RG), REG(RG), TMxx))
+
 /* div (G = G / S)
  * set-flags: undefined */
 
@@ -1340,6 +1360,94 @@
         EMITW(0xB8400000 | MDM(TMxx,    MOD(MS), VAL(DS), B1(DS), P1(DS)))  \
         EMITW(0xEB000000 | MRM(TZxx,    TMxx,    REG(RT)))
 
+/* xad (G = M, M = M + G), atomic fetch-add
+ * set-flags: undefined
+ * xad, xch, cas need natural alignment of memory args
+ * and are sequentially consistent (act as full memory barriers) */
+
+#define xadzx_st(RG, MG, DG)                                                \
+        AUW(SIB(MG),  EMPTY,  EMPTY,    MOD(MG), VAL(DG), C3(DG), EMPTY2)   \
+        EMITW(0x0B000000 | MRM(TDxx,    MOD(MG), TDxx) | ADR)               \
+        EMITW(0xC85FFC00 | MRM(TMxx,    TDxx,    0x00))                     \
+        EMITW(0x8B000000 | MRM(TIxx,    TMxx,    REG(RG)))                  \
+        EMITW(0xC800FC00 | MRM(TIxx,    TDxx,    TPxx))                     \
+        EMITW(0x35FFFFA0 | TPxx)      /* <- cbnz ldaxr */                   \
+        EMITW(0xD5033BBF)                  /* <- dmb ish */                 \
+        EMITW(0xAA000000 | MRM(REG(RG), TZxx,    TMxx))
+
+/* xch (G = M, M = G), atomic exchange
+ * set-flags: undefined */
+
+#define xchzx_st(RG, MG, DG)                                                \
+        AUW(SIB(MG),  EMPTY,  EMPTY,    MOD(MG), VAL(DG), C3(DG), EMPTY2)   \
+        EMITW(0x0B000000 | MRM(TDxx,    MOD(MG), TDxx) | ADR)               \
+        EMITW(0xC85FFC00 | MRM(TMxx,    TDxx,    0x00))                     \
+        EMITW(0xC800FC00 | MRM(REG(RG), TDxx,    TPxx))                     \
+        EMITW(0x35FFFFC0 | TPxx)      /* <- cbnz ldaxr */                   \
+        EMITW(0xD5033BBF)                  /* <- dmb ish */                 \
+        EMITW(0xAA000000 | MRM(REG(RG), TZxx,    TMxx))
+
+/* cas (if M == Reax then M = S, Reax = M), atomic compare-and-swap
+ * set-flags: undefined
+ * success is checked by comparing Reax to its value before cas */
+
+#define caszx_st(RS, MG, DG)     /* Reax is in/out, RS, MG != Reax */       \
+        AUW(SIB(MG),  EMPTY,  EMPTY,    MOD(MG), VAL(DG), C3(DG), EMPTY2)   \
+        EMITW(0x0B000000 | MRM(TDxx,    MOD(MG), TDxx) | ADR)               \
+        EMITW(0xC85FFC00 | MRM(TMxx,    TDxx,    0x00))                     \
+        EMITW(0xEB000000 | MRM(TZxx,    TMxx,    Teax))                     \
+        EMITW(0x54000061)             /* <- b.ne dmb */                     \
+        EMITW(0xC800FC00 | MRM(REG(RS), TDxx,    TPxx))                     \
+        EMITW(0x35FFFF80 | TPxx)      /* <- cbnz ldaxr */                   \
+        EMITW(0xD5033BBF)                  /* <- dmb ish */                 \
+        EMITW(0xAA000000 | MRM(Teax,    TZxx,    TMxx))
+
+/* cnt (D = number of set bits in S), population count
+ * set-flags: undefined */
+
+#define cntzx_rr(RD, RS)                                                    \
+        EMITW(0xD340FC00 | MRM(TMxx,    REG(RS), 0x00) | 1 << 16)           \
+        EMITW(0x9200F000 | MRM(TMxx,    TMxx,    0x00))  /* <- 0x55.. */    \
+        EMITW(0xCB000000 | MRM(REG(RD), REG(RS), TMxx))                     \
+        EMITW(0xD340FC00 | MRM(TMxx,    REG(RD), 0x00) | 2 << 16)           \
+        EMITW(0x9200E400 | MRM(TMxx,    TMxx,    0x00))  /* <- 0x33.. */    \
+        EMITW(0x9200E400 | MRM(REG(RD), REG(RD), 0x00))  /* <- 0x33.. */    \
+        EMITW(0x8B000000 | MRM(REG(RD), REG(RD), TMxx))                     \
+        EMITW(0x8B400000 | MRM(REG(RD), REG(RD), REG(RD)) | 4 << 10)        \
+        EMITW(0x9200CC00 | MRM(REG(RD), REG(RD), 0x00))  /* <- 0x0F.. */    \
+        EMITW(0x8B000000 | MRM(REG(RD), REG(RD), REG(RD)) | 8 << 10)        \
+        EMITW(0x8B000000 | MRM(REG(RD), REG(RD), REG(RD)) | 16 << 10)       \
+        EMITW(0x8B000000 | MRM(REG(RD), REG(RD), REG(RD)) | 32 << 10)       \
+        EMITW(0xD340FC00 | MRM(REG(RD), REG(RD), 0x00) | 56 << 16)
+
+/* clz (D = number of leading zeros in S)
+ * set-flags: undefined
+ * clz, ctz return operand size in bits for zero source */
+
+#define clzzx_rr(RD, RS)                                                    \
+        EMITW(0xDAC01000 | MRM(REG(RD), REG(RS), 0x00))
+
+/* ctz (D = number of trailing zeros in S)
+ * set-flags: undefined */
+
+#define ctzzx_rr(RD, RS)                                                    \
+        EMITW(0xDAC00000 | MRM(REG(RD), REG(RS), 0x00))                     \
+        EMITW(0xDAC01000 | MRM(REG(RD), REG(RD), 0x00))
+
+/* bsw (D = S with bytes in reversed order), byte swap
+ * set-flags: undefined */
+
+#define bswzx_rr(RD, RS)                                                    \
+        EMITW(0xDAC00C00 | MRM(REG(RD), REG(RS), 0x00))
+
+/* bfx (G = G >> IS & ((1 << IT) - 1)), unsigned bit-field extract
+ * set-flags: undefined
+ * IT > 0, IS + IT <= 64 */
+
+#define bfxzx_ri(RG, IS, IT)                                                \
+        EMITW(0xD3400000 | MRM(REG(RG), REG(RG), 0x00) |                    \
+             (VAL(IS) & 0x3F) << 16 | ((VAL(IS)+VAL(IT)-1) & 0x3F) << 10)
+
 /* ver (Mebp/inf_VER = SIMD-version)
  * set-flags: no
  * For interpretation of SIMD build flags check compatibility layer in rtzero.h
@@ -1369,7 +1477,9 @@
  * maximum byte-address-range for un/conditional jumps is signed 18/16-bit
  * based on minimum natively-encoded offset across supported targets (u/c)
  * MIPS:18-bit, POWER:26-bit, AArch32:26-bit, AArch64:28-bit, x86:32-bit /
- * MIPS:18-bit, POWER:16-bit, AArch32:26-bit, AArch64:21-bit, x86:32-bit */
+ * MIPS:18-bit, POWER:16-bit, AArch32:26-bit, AArch64:21-bit, x86:32-bit
+ * RT_BASE_COMPAT_FAR (rtarch.h) extends AArch64 conditional jumps to 28-bit
+ * via inverted b.cond over unconditional b (label 0 reserved) */
 
      /* jccxx_** is defined in 32-bit rtarch_***.h files */
 
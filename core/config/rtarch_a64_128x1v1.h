@@ -154,6 +154,15 @@
         AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C2(DD), EMPTY2)   \
         EMITW(0x3C800000 | MPM(REG(XS), MOD(MD), VAL(DD), B2(DD), P2(DD)))
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment
+ * native SIMD load/store doesn't require alignment on this target */
+
+#define muvjx_ld(XD, MS, DS)                                                \
+        movjx_ld(W(XD), W(MS), W(DS))
+
+#define muvjx_st(XS, MD, DD)                                                \
+        movjx_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -171,6 +180,40 @@
         EMITW(0x6EA01C00 | MXM(TmmM,    REG(XS), Tmm0))                     \
         EMITW(0x3C800000 | MPM(TmmM,    MOD(MG), VAL(DG), B2(DG), P2(DG)))
 
+/* unl (G = G unpack-low S), (D = S unpack-low T) if (#D != #T)
+ * interleaves lower halves of each 128-bit lane, S-elements go first */
+
+#define unljx_rr(XG, XS)                                                    \
+        unljx3rr(W(XG), W(XG), W(XS))
+
+#define unljx_ld(XG, MS, DS)                                                \
+        unljx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define unljx3rr(XD, XS, XT)                                                \
+        EMITW(0x4EC03800 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define unljx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x4EC03800 | MXM(REG(XD), REG(XS), TmmM))
+
+/* unh (G = G unpack-high S), (D = S unpack-high T) if (#D != #T)
+ * interleaves upper halves of each 128-bit lane, S-elements go first */
+
+#define unhjx_rr(XG, XS)                                                    \
+        unhjx3rr(W(XG), W(XG), W(XS))
+
+#define unhjx_ld(XG, MS, DS)                                                \
+        unhjx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define unhjx3rr(XD, XS, XT)                                                \
+        EMITW(0x4EC07800 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define unhjx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x4EC07800 | MXM(REG(XD), REG(XS), TmmM))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andjx_rr(XG, XS)                                                    \
@@ -742,6 +785,27 @@
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0x4EE08400 | MXM(REG(XD), REG(XS), TmmM))
 
+/* mlw (G = G[31:0] * S[31:0]), (D = S[31:0] * T[31:0]) if (#D != #T)
+ * unsigned 32x32 to 64-bit product of lower halves of 64-bit elements */
+
+#define mlwjx_rr(XG, XS)                                                    \
+        mlwjx3rr(W(XG), W(XG), W(XS))
+
+#define mlwjx_ld(XG, MS, DS)                                                \
+        mlwjx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define mlwjx3rr(XD, XS, XT)                                                \
+        EMITW(0x0EA12800 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(0x0EA12800 | MXM(REG(XD), REG(XT), 0x00))                     \
+        EMITW(0x2EA0C000 | MXM(REG(XD), TmmM,    REG(XD)))
+
+#define mlwjx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x0EA12800 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x0EA12800 | MXM(REG(XD), REG(XS), 0x00))                     \
+        EMITW(0x2EA0C000 | MXM(REG(XD), REG(XD), TmmM))
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subjx_rr(XG, XS)                                                    \
@@ -157,6 +157,15 @@
         EMITW(0x3D800000 | MPM(REG(XS), MOD(MD), VAL(DD), B4(DD), L2(DD)))  \
         EMITW(0x3D800000 | MPM(RYG(XS), MOD(MD), VYL(DD), B4(DD), L2(DD)))
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment
+ * native SIMD load/store doesn't require alignment on this target */
+
+#define muvdx_ld(XD, MS, DS)                                                \
+        movdx_ld(W(XD), W(MS), W(DS))
+
+#define muvdx_st(XS, MD, DD)                                                \
+        movdx_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -864,6 +873,38 @@
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
         EMITW(0x4EE08400 | MXM(RYG(XD), RYG(XS), TmmM))
 
+/* mlw (G = G[31:0] * S[31:0]), (D = S[31:0] * T[31:0]) if (#D != #T)
+ * unsigned 32x32 to 64-bit product of lower halves of 64-bit elements */
+
+#undef  mlwdx_rr
+#define mlwdx_rr(XG, XS)                                                    \
+        mlwdx3rr(W(XG), W(XG), W(XS))
+
+#undef  mlwdx_ld
+#define mlwdx_ld(XG, MS, DS)                                                \
+        mlwdx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#undef  mlwdx3rr
+#define mlwdx3rr(XD, XS, XT)                                                \
+        EMITW(0x0EA12800 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(0x0EA12800 | MXM(REG(XD), REG(XT), 0x00))                     \
+        EMITW(0x2EA0C000 | MXM(REG(XD), TmmM,    REG(XD)))                  \
+        EMITW(0x0EA12800 | MXM(TmmM,    RYG(XS), 0x00))                     \
+        EMITW(0x0EA12800 | MXM(RYG(XD), RYG(XT), 0x00))                     \
+        EMITW(0x2EA0C000 | MXM(RYG(XD), TmmM,    RYG(XD)))
+
+#undef  mlwdx3ld
+#define mlwdx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x0EA12800 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x0EA12800 | MXM(REG(XD), REG(XS), 0x00))                     \
+        EMITW(0x2EA0C000 | MXM(REG(XD), REG(XD), TmmM))                     \
+        EMITW(0x3DC00000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x0EA12800 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x0EA12800 | MXM(RYG(XD), RYG(XS), 0x00))                     \
+        EMITW(0x2EA0C000 | MXM(RYG(XD), RYG(XD), TmmM))
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subdx_rr(XG, XS)                                                    \
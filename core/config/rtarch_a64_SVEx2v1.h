@@ -157,6 +157,15 @@
         EMITW(0xE5804000 | MPM(REG(XS), MOD(MD), VAL(DD), B3(DD), K1(DD)))  \
         EMITW(0xE5804000 | MPM(RYG(XS), MOD(MD), VZL(DD), B3(DD), K1(DD)))
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment
+ * native SIMD load/store doesn't require alignment on this target */
+
+#define muvqx_ld(XD, MS, DS)                                                \
+        movqx_ld(W(XD), W(MS), W(DS))
+
+#define muvqx_st(XS, MD, DD)                                                \
+        movqx_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -896,6 +905,38 @@
         EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VZL(DT), B3(DT), K1(DT)))  \
         EMITW(0x04E00000 | MXM(RYG(XD), RYG(XS), TmmM))
 
+/* mlw (G = G[31:0] * S[31:0]), (D = S[31:0] * T[31:0]) if (#D != #T)
+ * unsigned 32x32 to 64-bit product of lower halves of 64-bit elements */
+
+#undef  mlwqx_rr
+#define mlwqx_rr(XG, XS)                                                    \
+        mlwqx3rr(W(XG), W(XG), W(XS))
+
+#undef  mlwqx_ld
+#define mlwqx_ld(XG, MS, DS)                                                \
+        mlwqx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#undef  mlwqx3rr
+#define mlwqx3rr(XD, XS, XT)                                                \
+        EMITW(0x04D5A000 | MXM(TmmM,    REG(XT), 0x00))                     \
+        EMITW(0x04D5A000 | MXM(REG(XD), REG(XS), 0x00))                     \
+        EMITW(0x04D00000 | MXM(REG(XD), TmmM,    0x00))                     \
+        EMITW(0x04D5A000 | MXM(TmmM,    RYG(XT), 0x00))                     \
+        EMITW(0x04D5A000 | MXM(RYG(XD), RYG(XS), 0x00))                     \
+        EMITW(0x04D00000 | MXM(RYG(XD), TmmM,    0x00))
+
+#undef  mlwqx3ld
+#define mlwqx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VAL(DT), B3(DT), K1(DT)))  \
+        EMITW(0x04D5A000 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x04D5A000 | MXM(REG(XD), REG(XS), 0x00))                     \
+        EMITW(0x04D00000 | MXM(REG(XD), TmmM,    0x00))                     \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VZL(DT), B3(DT), K1(DT)))  \
+        EMITW(0x04D5A000 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x04D5A000 | MXM(RYG(XD), RYG(XS), 0x00))                     \
+        EMITW(0x04D00000 | MXM(RYG(XD), TmmM,    0x00))
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subqx_rr(XG, XS)                                                    \
@@ -620,6 +620,44 @@
 
 #endif /* RT_128X2 */
 
+#if (RT_128X2 != 0) && (RT_SIMD == 256) && !(defined RT_SVEX1)
+
+/******************************************************************************/
+/**********************************   SIMD   **********************************/
+/******************************************************************************/
+
+/***********   packed half-precision floating-point widen/narrow   ************/
+
+/* cvy (D = fp16-to-fp32 S)
+ * widens lower/upper half of fp16 elements to full fp32 vector,
+ * used by fp16 horizontal ops in rtconf.h and kernels in rthalf.h,
+ * registers are written in order which allows D to be the same as S */
+
+#define cvyms_rr(XD, XS)     /* lower half */                               \
+        EMITW(0x4E217800 | MXM(RYG(XD), REG(XS), 0x00))                     \
+        EMITW(0x0E217800 | MXM(REG(XD), REG(XS), 0x00))
+
+#define cuyms_rr(XD, XS)     /* upper half */                               \
+        EMITW(0x0E217800 | MXM(REG(XD), RYG(XS), 0x00))                     \
+        EMITW(0x4E217800 | MXM(RYG(XD), RYG(XS), 0x00))
+
+/* cvx (D = fp32-to-fp16 S)
+ * narrows full fp32 vector onto lower/upper half of fp16 elements,
+ * the other half is zeroed, rounding mode comes from control register */
+
+#define cvxos_rr(XD, XS)     /* lower half */                               \
+        EMITW(0x0E216800 | MXM(REG(XD), REG(XS), 0x00))                     \
+        EMITW(0x4E216800 | MXM(REG(XD), RYG(XS), 0x00))                     \
+        EMITW(0x6E201C00 | MXM(RYG(XD), RYG(XD), RYG(XD)))
+
+#define cuxos_rr(XD, XS)     /* upper half */                               \
+        EMITW(0x0E216800 | MXM(REG(XD), REG(XS), 0x00))                     \
+        EMITW(0x4E216800 | MXM(REG(XD), RYG(XS), 0x00))                     \
+        EMITW(0x4EA01C00 | MXM(RYG(XD), REG(XD), REG(XD)))                  \
+        EMITW(0x6E201C00 | MXM(REG(XD), REG(XD), REG(XD)))
+
+#endif /* RT_128X2 */
+
 #endif /* RT_SIMD_CODE */
 
 #endif /* RT_RTARCH_AHF_128X2V2_H */
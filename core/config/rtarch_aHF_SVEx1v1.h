@@ -555,6 +555,38 @@
 
 #endif /* RT_SVEX1 */
 
+#if (RT_SVEX1 != 0)
+
+/******************************************************************************/
+/**********************************   SIMD   **********************************/
+/******************************************************************************/
+
+/***********   packed half-precision floating-point widen/narrow   ************/
+
+/* cvy (D = fp16-to-fp32 S)
+ * widens lower/upper fp16 element of each 32-bit lane to fp32,
+ * used by fp16 horizontal ops in rtconf.h and kernels in rthalf.h */
+
+#define cvyms_rr(XD, XS)     /* lower half */                               \
+        EMITW(0x6589A000 | MXM(REG(XD), REG(XS), 0x00))
+
+#define cuyms_rr(XD, XS)     /* upper half */                               \
+        EMITW(0x04709400 | MXM(REG(XD), REG(XS), 0x00))                     \
+        EMITW(0x6589A000 | MXM(REG(XD), REG(XD), 0x00))
+
+/* cvx (D = fp32-to-fp16 S)
+ * narrows fp32 onto lower/upper fp16 element of each 32-bit lane,
+ * the other element is zeroed, rounding mode comes from control register */
+
+#define cvxos_rr(XD, XS)     /* lower half */                               \
+        EMITW(0x6588A000 | MXM(REG(XD), REG(XS), 0x00))
+
+#define cuxos_rr(XD, XS)     /* upper half */                               \
+        EMITW(0x6588A000 | MXM(REG(XD), REG(XS), 0x00))                     \
+        EMITW(0x04709C00 | MXM(REG(XD), REG(XD), 0x00))
+
+#endif /* RT_SVEX1 */
+
 #endif /* RT_SIMD_CODE */
 
 #endif /* RT_RTARCH_AHF_SVEX1V1_H */
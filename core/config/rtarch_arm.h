@@ -1339,6 +1339,26 @@
 #define mulwp_xm(MS, DS) /* Reax is in/out, prepares Redx for divwn_x* */   \
         mulwx_ld(Reax, W(MS), W(DS))  /* must not exceed operands size */
 
+/* mhi (G = G * S >> 32), high half of full 32x32-bit product
+ * set-flags: undefined
+ * low half is given by mulwx_**, both halves at once by mulw*_x* */
+
+#define mhiwx_rr(RG, RS)                                                    \
+        EMITW(0xE0800090 | MRM(TMxx,    REG(RG), REG(RS)) | REG(RG) << 8)
+
+#define mhiwx_ld(RG, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0xE5900000 | MDM(TMxx,    MOD(MS), VAL(DS), B3(DS), P1(DS)))  \
+        EMITW(0xE0800090 | MRM(TMxx,    REG(RG), TMxx) | REG(RG) << 8)
+
+#define mhiwn_rr(RG, RS)                                                    \
+        EMITW(0xE0C00090 | MRM(TMxx,    REG(RG), REG(RS)) | REG(RG) << 8)
+
+#define mhiwn_ld(RG, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0xE5900000 | MDM(TMxx,    MOD(MS), VAL(DS), B3(DS), P1(DS)))  \
+        EMITW(0xE0C00090 | MRM(TMxx,    REG(RG), TMxx) | REG(RG) << 8)
+
 /* div (G = G / S)
  * set-flags: undefined */
 
@@ -1797,6 +1817,118 @@
         EMITW(0xE5D00000 | MDM(TMxx,    MOD(MS), VAL(DS), B3(DS), P1(DS)))  \
         EMITW(0xE1500000 | MRM(0x00,    TMxx,    REG(RT)))
 
+/* xad (G = M, M = M + G), atomic fetch-add
+ * set-flags: undefined
+ * xad, xch, cas need natural alignment of memory args
+ * and are sequentially consistent (act as full memory barriers) */
+
+#define xadwx_st(RG, MG, DG)                                                \
+        AUW(SIB(MG),  EMPTY,  EMPTY,    MOD(MG), VAL(DG), C3(DG), EMPTY2)   \
+        EMITW(0xE0800000 | MRM(TDxx,    MOD(MG), TDxx))                     \
+        EMITW(0xF57FF05B)                  /* <- dmb ish */                 \
+        EMITW(0xE1900F9F | MRM(TMxx,    TDxx,    0x00))                     \
+        EMITW(0xE0800000 | MRM(TPxx,    TMxx,    REG(RG)))                  \
+        EMITW(0xE1800F90 | MRM(TMxx,    TDxx,    TPxx))                     \
+        EMITW(0xE3500000 | MRM(0x00,    TMxx,    0x00))                     \
+        EMITW(0x1AFFFFFA)                  /* <- bne ldrex */               \
+        EMITW(0xF57FF05B)                  /* <- dmb ish */                 \
+        EMITW(0xE0400000 | MRM(REG(RG), TPxx,    REG(RG)))
+
+/* xch (G = M, M = G), atomic exchange
+ * set-flags: undefined */
+
+#define xchwx_st(RG, MG, DG)                                                \
+        AUW(SIB(MG),  EMPTY,  EMPTY,    MOD(MG), VAL(DG), C3(DG), EMPTY2)   \
+        EMITW(0xE0800000 | MRM(TDxx,    MOD(MG), TDxx))                     \
+        EMITW(0xF57FF05B)                  /* <- dmb ish */                 \
+        EMITW(0xE1900F9F | MRM(TMxx,    TDxx,    0x00))                     \
+        EMITW(0xE1800F90 | MRM(TPxx,    TDxx,    REG(RG)))                  \
+        EMITW(0xE3500000 | MRM(0x00,    TPxx,    0x00))                     \
+        EMITW(0x1AFFFFFB)                  /* <- bne ldrex */               \
+        EMITW(0xF57FF05B)                  /* <- dmb ish */                 \
+        EMITW(0xE1A00000 | MRM(REG(RG), 0x00,    TMxx))
+
+/* cas (if M == Reax then M = S, Reax = M), atomic compare-and-swap
+ * set-flags: undefined
+ * success is checked by comparing Reax to its value before cas */
+
+#define caswx_st(RS, MG, DG)     /* Reax is in/out, RS, MG != Reax */       \
+        AUW(SIB(MG),  EMPTY,  EMPTY,    MOD(MG), VAL(DG), C3(DG), EMPTY2)   \
+        EMITW(0xE0800000 | MRM(TDxx,    MOD(MG), TDxx))                     \
+        EMITW(0xF57FF05B)                  /* <- dmb ish */                 \
+        EMITW(0xE1900F9F | MRM(TMxx,    TDxx,    0x00))                     \
+        EMITW(0xE1500000 | MRM(0x00,    TMxx,    Teax))                     \
+        EMITW(0x1A000002)                  /* <- bne dmb */                 \
+        EMITW(0xE1800F90 | MRM(TPxx,    TDxx,    REG(RS)))                  \
+        EMITW(0xE3500000 | MRM(0x00,    TPxx,    0x00))                     \
+        EMITW(0x1AFFFFF9)                  /* <- bne ldrex */               \
+        EMITW(0xF57FF05B)                  /* <- dmb ish */                 \
+        EMITW(0xE1A00000 | MRM(Teax,    0x00,    TMxx))
+
+/* fen (memory-ordering fence)
+ * set-flags: no
+ * fenxx_aq - acquire: prior loads are ordered before subsequent loads/stores
+ * fenxx_rl - release: prior loads/stores are ordered before subsequent stores
+ * fenxx_sc - full: prior loads/stores are ordered before subsequent ones */
+
+#define fenxx_aq()                                                          \
+        EMITW(0xF57FF05B)                  /* <- dmb ish */
+
+#define fenxx_rl()                                                          \
+        EMITW(0xF57FF05B)                  /* <- dmb ish */
+
+#define fenxx_sc()                                                          \
+        EMITW(0xF57FF05B)                  /* <- dmb ish */
+
+/* cnt (D = number of set bits in S), population count
+ * set-flags: undefined */
+
+#define cntwx_rr(RD, RS)                                                    \
+        EMITW(0xE3050555 | MRM(TIxx,    0x00,    0x00))                     \
+        EMITW(0xE3450555 | MRM(TIxx,    0x00,    0x00))                     \
+        EMITW(0xE0000020 | MRM(TMxx,    TIxx,    REG(RS)) | 1 << 7)         \
+        EMITW(0xE0400000 | MRM(REG(RD), REG(RS), TMxx))                     \
+        EMITW(0xE3030333 | MRM(TIxx,    0x00,    0x00))                     \
+        EMITW(0xE3430333 | MRM(TIxx,    0x00,    0x00))                     \
+        EMITW(0xE0000020 | MRM(TMxx,    TIxx,    REG(RD)) | 2 << 7)         \
+        EMITW(0xE0000000 | MRM(REG(RD), REG(RD), TIxx))                     \
+        EMITW(0xE0800000 | MRM(REG(RD), REG(RD), TMxx))                     \
+        EMITW(0xE0800020 | MRM(REG(RD), REG(RD), REG(RD)) | 4 << 7)         \
+        EMITW(0xE3000F0F | MRM(TIxx,    0x00,    0x00))                     \
+        EMITW(0xE3400F0F | MRM(TIxx,    0x00,    0x00))                     \
+        EMITW(0xE0000000 | MRM(REG(RD), REG(RD), TIxx))                     \
+        EMITW(0xE0800000 | MRM(REG(RD), REG(RD), REG(RD)) | 8 << 7)         \
+        EMITW(0xE0800000 | MRM(REG(RD), REG(RD), REG(RD)) | 16 << 7)        \
+        EMITW(0xE1A00020 | MRM(REG(RD), 0x00,    REG(RD)) | 24 << 7)
+
+/* clz (D = number of leading zeros in S)
+ * set-flags: undefined
+ * clz, ctz return operand size in bits for zero source */
+
+#define clzwx_rr(RD, RS)                                                    \
+        EMITW(0xE16F0F10 | MRM(REG(RD), 0x00,    REG(RS)))
+
+/* ctz (D = number of trailing zeros in S)
+ * set-flags: undefined */
+
+#define ctzwx_rr(RD, RS)                                                    \
+        EMITW(0xE6FF0F30 | MRM(REG(RD), 0x00,    REG(RS)))                  \
+        EMITW(0xE16F0F10 | MRM(REG(RD), 0x00,    REG(RD)))
+
+/* bsw (D = S with bytes in reversed order), byte swap
+ * set-flags: undefined */
+
+#define bswwx_rr(RD, RS)                                                    \
+        EMITW(0xE6BF0F30 | MRM(REG(RD), 0x00,    REG(RS)))
+
+/* bfx (G = G >> IS & ((1 << IT) - 1)), unsigned bit-field extract
+ * set-flags: undefined
+ * IT > 0, IS + IT <= 32 */
+
+#define bfxwx_ri(RG, IS, IT)                                                \
+        EMITW(0xE7E00050 | MRM(REG(RG), 0x00,    REG(RG)) |                 \
+             (VAL(IS) & 0x1F) << 7 | ((VAL(IT)-1) & 0x1F) << 16)
+
 /* ver (Mebp/inf_VER = SIMD-version)
  * set-flags: no
  * For interpretation of SIMD build flags check compatibility layer in rtzero.h
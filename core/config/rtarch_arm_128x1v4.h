@@ -233,6 +233,18 @@
         EMITW(0xE0800000 | MPM(TPxx,    MOD(MD), VAL(DD), B2(DD), P2(DD)))  \
         EMITW(0xF4000AAF | MXM(REG(XS), TPxx,    0x00))
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment */
+
+#define muvix_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0xE0800000 | MPM(TPxx,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0xF4200A8F | MXM(REG(XD), TPxx,    0x00))
+
+#define muvix_st(XS, MD, DD)                                                \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C2(DD), EMPTY2)   \
+        EMITW(0xE0800000 | MPM(TPxx,    MOD(MD), VAL(DD), B2(DD), P2(DD)))  \
+        EMITW(0xF4000A8F | MXM(REG(XS), TPxx,    0x00))
+
 
 #define movjx_rr(XD, XS)                                                    \
         movix_rr(W(XD), W(XS))
@@ -243,6 +255,14 @@
 #define movjx_st(XS, MD, DD)                                                \
         movix_st(W(XS), W(MD), W(DD))
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment */
+
+#define muvjx_ld(XD, MS, DS)                                                \
+        muvix_ld(W(XD), W(MS), W(DS))
+
+#define muvjx_st(XS, MD, DD)                                                \
+        muvix_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -272,6 +292,86 @@
 #define mmvjx_st(XS, MG, DG)                                                \
         mmvix_st(W(XS), W(MG), W(DG))
 
+/* unl (G = G unpack-low S), (D = S unpack-low T) if (#D != #T)
+ * interleaves lower halves of each 128-bit lane, S-elements go first */
+
+#define unlix_rr(XG, XS)                                                    \
+        unlix3rr(W(XG), W(XG), W(XS))
+
+#define unlix_ld(XG, MS, DS)                                                \
+        unlix3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define unlix3rr(XD, XS, XT)                                                \
+        EMITW(0xF2200150 | MXM(TmmM,    REG(XT), REG(XT)))                  \
+        EMITW(0xF2200150 | MXM(REG(XD), REG(XS), REG(XS)))                  \
+        EMITW(0xF3BA01C0 | MXM(REG(XD), 0x00,    TmmM))
+
+#define unlix3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0xE0800000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0xF4200AAF | MXM(TmmM,    TPxx,    0x00))                     \
+        EMITW(0xF2200150 | MXM(REG(XD), REG(XS), REG(XS)))                  \
+        EMITW(0xF3BA01C0 | MXM(REG(XD), 0x00,    TmmM))
+
+
+#define unljx_rr(XG, XS)                                                    \
+        unljx3rr(W(XG), W(XG), W(XS))
+
+#define unljx_ld(XG, MS, DS)                                                \
+        unljx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define unljx3rr(XD, XS, XT)                                                \
+        EMITW(0xF2200110 | MXM(REH(XD), REG(XT), REG(XT)))                \
+        EMITW(0xF2200110 | MXM(REG(XD), REG(XS), REG(XS)))
+
+#define unljx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0xE0800000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0xF4200AAF | MXM(TmmM,    TPxx,    0x00))                     \
+        EMITW(0xF2200110 | MXM(REH(XD), TmmM,    TmmM))                   \
+        EMITW(0xF2200110 | MXM(REG(XD), REG(XS), REG(XS)))
+
+/* unh (G = G unpack-high S), (D = S unpack-high T) if (#D != #T)
+ * interleaves upper halves of each 128-bit lane, S-elements go first */
+
+#define unhix_rr(XG, XS)                                                    \
+        unhix3rr(W(XG), W(XG), W(XS))
+
+#define unhix_ld(XG, MS, DS)                                                \
+        unhix3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define unhix3rr(XD, XS, XT)                                                \
+        EMITW(0xF2200150 | MXM(TmmM,    REG(XT), REG(XT)))                  \
+        EMITW(0xF2200150 | MXM(REG(XD), REG(XS), REG(XS)))                  \
+        EMITW(0xF3BA01C0 | MXM(REG(XD), 0x00,    TmmM))                     \
+        EMITW(0xF2200150 | MXM(REG(XD), TmmM,    TmmM))
+
+#define unhix3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0xE0800000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0xF4200AAF | MXM(TmmM,    TPxx,    0x00))                     \
+        EMITW(0xF2200150 | MXM(REG(XD), REG(XS), REG(XS)))                  \
+        EMITW(0xF3BA01C0 | MXM(REG(XD), 0x00,    TmmM))                     \
+        EMITW(0xF2200150 | MXM(REG(XD), TmmM,    TmmM))
+
+
+#define unhjx_rr(XG, XS)                                                    \
+        unhjx3rr(W(XG), W(XG), W(XS))
+
+#define unhjx_ld(XG, MS, DS)                                                \
+        unhjx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define unhjx3rr(XD, XS, XT)                                                \
+        EMITW(0xF2200110 | MXM(REG(XD), REH(XS), REH(XS)))              \
+        EMITW(0xF2200110 | MXM(REH(XD), REH(XT), REH(XT)))
+
+#define unhjx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0xE0800000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0xF4200AAF | MXM(TmmM,    TPxx,    0x00))                     \
+        EMITW(0xF2200110 | MXM(REG(XD), REH(XS), REH(XS)))              \
+        EMITW(0xF2200110 | MXM(REH(XD), TmmM+1,  TmmM+1))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andix_rr(XG, XS)                                                    \
@@ -481,30 +581,30 @@
 
 #define addjs3rr(XD, XS, XT)                                                \
         EMITW(0xEE300B00 | MXM(REG(XD)+0, REG(XS)+0, REG(XT)+0))            \
-        EMITW(0xEE300B00 | MXM(REG(XD)+1, REG(XS)+1, REG(XT)+1))
+        EMITW(0xEE300B00 | MXM(REH(XD), REH(XS), REH(XT)))
 
 #define addjs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
         EMITW(0xE0800000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0xF4200AAF | MXM(TmmM,    TPxx,    0x00))                     \
         EMITW(0xEE300B00 | MXM(REG(XD)+0, REG(XS)+0, TmmM+0))               \
-        EMITW(0xEE300B00 | MXM(REG(XD)+1, REG(XS)+1, TmmM+1))
+        EMITW(0xEE300B00 | MXM(REH(XD), REH(XS), TmmM+1))
 
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
 #undef  adpis3rr
 #define adpis3rr(XD, XS, XT)                                                \
-        EMITW(0xF3000D00 | MXM(REG(XD)+0, REG(XS)+0, REG(XS)+1))            \
-        EMITW(0xF3000D00 | MXM(REG(XD)+1, REG(XT)+0, REG(XT)+1))
+        EMITW(0xF3000D00 | MXM(REG(XD)+0, REG(XS)+0, REH(XS)))            \
+        EMITW(0xF3000D00 | MXM(REH(XD), REG(XT)+0, REH(XT)))
 
 #undef  adpis3ld
 #define adpis3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
         EMITW(0xE0800000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0xF4200AAF | MXM(TmmM,    TPxx,    0x00))                     \
-        EMITW(0xF3000D00 | MXM(REG(XD)+0, REG(XS)+0, REG(XS)+1))            \
-        EMITW(0xF3000D00 | MXM(REG(XD)+1,    TmmM+0,    TmmM+1))
+        EMITW(0xF3000D00 | MXM(REG(XD)+0, REG(XS)+0, REH(XS)))            \
+        EMITW(0xF3000D00 | MXM(REH(XD),    TmmM+0,    TmmM+1))
 
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
@@ -532,14 +632,14 @@
 
 #define subjs3rr(XD, XS, XT)                                                \
         EMITW(0xEE300B40 | MXM(REG(XD)+0, REG(XS)+0, REG(XT)+0))            \
-        EMITW(0xEE300B40 | MXM(REG(XD)+1, REG(XS)+1, REG(XT)+1))
+        EMITW(0xEE300B40 | MXM(REH(XD), REH(XS), REH(XT)))
 
 #define subjs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
         EMITW(0xE0800000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0xF4200AAF | MXM(TmmM,    TPxx,    0x00))                     \
         EMITW(0xEE300B40 | MXM(REG(XD)+0, REG(XS)+0, TmmM+0))               \
-        EMITW(0xEE300B40 | MXM(REG(XD)+1, REG(XS)+1, TmmM+1))
+        EMITW(0xEE300B40 | MXM(REH(XD), REH(XS), TmmM+1))
 
 /* mul (G = G * S), (D = S * T) if (#D != #T) */
 
@@ -567,14 +667,14 @@
 
 #define muljs3rr(XD, XS, XT)                                                \
         EMITW(0xEE200B00 | MXM(REG(XD)+0, REG(XS)+0, REG(XT)+0))            \
-        EMITW(0xEE200B00 | MXM(REG(XD)+1, REG(XS)+1, REG(XT)+1))
+        EMITW(0xEE200B00 | MXM(REH(XD), REH(XS), REH(XT)))
 
 #define muljs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
         EMITW(0xE0800000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0xF4200AAF | MXM(TmmM,    TPxx,    0x00))                     \
         EMITW(0xEE200B00 | MXM(REG(XD)+0, REG(XS)+0, TmmM+0))               \
-        EMITW(0xEE200B00 | MXM(REG(XD)+1, REG(XS)+1, TmmM+1))
+        EMITW(0xEE200B00 | MXM(REH(XD), REH(XS), TmmM+1))
 
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
@@ -601,8 +701,8 @@
 #define divis3rr(XD, XS, XT)                                                \
         EMITW(0xEE800A00 | MXM(REG(XD)+0, REG(XS)+0, REG(XT)+0))            \
         EMITW(0xEEC00AA0 | MXM(REG(XD)+0, REG(XS)+0, REG(XT)+0))            \
-        EMITW(0xEE800A00 | MXM(REG(XD)+1, REG(XS)+1, REG(XT)+1))            \
-        EMITW(0xEEC00AA0 | MXM(REG(XD)+1, REG(XS)+1, REG(XT)+1))
+        EMITW(0xEE800A00 | MXM(REH(XD), REH(XS), REH(XT)))            \
+        EMITW(0xEEC00AA0 | MXM(REH(XD), REH(XS), REH(XT)))
 
 #define divis3ld(XD, XS, MT, DT)                                            \
         movix_ld(W(XD), W(MT), W(DT))                                       \
@@ -680,14 +780,14 @@
 
 #define divjs3rr(XD, XS, XT)                                                \
         EMITW(0xEE800B00 | MXM(REG(XD)+0, REG(XS)+0, REG(XT)+0))            \
-        EMITW(0xEE800B00 | MXM(REG(XD)+1, REG(XS)+1, REG(XT)+1))
+        EMITW(0xEE800B00 | MXM(REH(XD), REH(XS), REH(XT)))
 
 #define divjs3ld(XD, XS, MT, DT)                                            \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
         EMITW(0xE0800000 | MPM(TPxx,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
         EMITW(0xF4200AAF | MXM(TmmM,    TPxx,    0x00))                     \
         EMITW(0xEE800B00 | MXM(REG(XD)+0, REG(XS)+0, TmmM+0))               \
-        EMITW(0xEE800B00 | MXM(REG(XD)+1, REG(XS)+1, TmmM+1))
+        EMITW(0xEE800B00 | MXM(REH(XD), REH(XS), TmmM+1))
 
 /* sqr (D = sqrt S) */
 
@@ -696,8 +796,8 @@
 #define sqris_rr(XD, XS)                                                    \
         EMITW(0xEEB10AC0 | MXM(REG(XD)+0, 0x00, REG(XS)+0))                 \
         EMITW(0xEEF10AE0 | MXM(REG(XD)+0, 0x00, REG(XS)+0))                 \
-        EMITW(0xEEB10AC0 | MXM(REG(XD)+1, 0x00, REG(XS)+1))                 \
-        EMITW(0xEEF10AE0 | MXM(REG(XD)+1, 0x00, REG(XS)+1))
+        EMITW(0xEEB10AC0 | MXM(REH(XD), 0x00, REH(XS)))                 \
+        EMITW(0xEEF10AE0 | MXM(REH(XD), 0x00, REH(XS)))
 
 #define sqris_ld(XD, MS, DS)                                                \
         movix_ld(W(XD), W(MS), W(DS))                                       \
@@ -733,14 +833,14 @@
 
 #define sqrjs_rr(XD, XS)                                                    \
         EMITW(0xEEB10BC0 | MXM(REG(XD)+0, 0x00, REG(XS)+0))                 \
-        EMITW(0xEEB10BC0 | MXM(REG(XD)+1, 0x00, REG(XS)+1))
+        EMITW(0xEEB10BC0 | MXM(REH(XD), 0x00, REH(XS)))
 
 #define sqrjs_ld(XD, MS, DS)                                                \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
         EMITW(0xE0800000 | MPM(TPxx,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
         EMITW(0xF4200AAF | MXM(TmmM,    TPxx,    0x00))                     \
         EMITW(0xEEB10BC0 | MXM(REG(XD)+0, 0x00, TmmM+0))                    \
-        EMITW(0xEEB10BC0 | MXM(REG(XD)+1, 0x00, TmmM+1))
+        EMITW(0xEEB10BC0 | MXM(REH(XD), 0x00, TmmM+1))
 
 /* cbr (D = cbrt S) */
 
@@ -808,12 +908,12 @@
 #define fmais_rr(XG, XS, XT)                                                \
         EMITW(0xEEB70AC0 | MXM(TmmC+0,  0x00,    REG(XS)+0))                \
         EMITW(0xEEB70AE0 | MXM(TmmD+0,  0x00,    REG(XS)+0))                \
-        EMITW(0xEEB70AC0 | MXM(TmmE+0,  0x00,    REG(XS)+1))                \
-        EMITW(0xEEB70AE0 | MXM(TmmF+0,  0x00,    REG(XS)+1))                \
+        EMITW(0xEEB70AC0 | MXM(TmmE+0,  0x00,    REH(XS)))                \
+        EMITW(0xEEB70AE0 | MXM(TmmF+0,  0x00,    REH(XS)))                \
         EMITW(0xEEB70AC0 | MXM(TmmC+1,  0x00,    REG(XT)+0))                \
         EMITW(0xEEB70AE0 | MXM(TmmD+1,  0x00,    REG(XT)+0))                \
-        EMITW(0xEEB70AC0 | MXM(TmmE+1,  0x00,    REG(XT)+1))                \
-        EMITW(0xEEB70AE0 | MXM(TmmF+1,  0x00,    REG(XT)+1))                \
+        EMITW(0xEEB70AC0 | MXM(TmmE+1,  0x00,    REH(XT)))                \
+        EMITW(0xEEB70AE0 | MXM(TmmF+1,  0x00,    REH(XT)))                \
         EMITW(0xEE200B00 | MXM(TmmC+0,  TmmC+0,  TmmC+1))                   \
         EMITW(0xEE200B00 | MXM(TmmD+0,  TmmD+0,  TmmD+1))                   \
         EMITW(0xEE200B00 | MXM(TmmE+0,  TmmE+0,  TmmE+1))                   \
@@ -834,14 +934,14 @@
 #define fmais_ld(XG, XS, MT, DT)                                            \
         EMITW(0xEEB70AC0 | MXM(TmmC+0,  0x00,    REG(XS)+0))                \
         EMITW(0xEEB70AE0 | MXM(TmmD+0,  0x00,    REG(XS)+0))                \
-        EMITW(0xEEB70AC0 | MXM(TmmE+0,  0x00,    REG(XS)+1))                \
-        EMITW(0xEEB70AE0 | MXM(TmmF+0,  0x00,    REG(XS)+1))                \
+        EMITW(0xEEB70AC0 | MXM(TmmE+0,  0x00,    REH(XS)))                \
+        EMITW(0xEEB70AE0 | MXM(TmmF+0,  0x00,    REH(XS)))                \
         movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
         movix_ld(W(XS), W(MT), W(DT))                                       \
         EMITW(0xEEB70AC0 | MXM(TmmC+1,  0x00,    REG(XS)+0))                \
         EMITW(0xEEB70AE0 | MXM(TmmD+1,  0x00,    REG(XS)+0))                \
-        EMITW(0xEEB70AC0 | MXM(TmmE+1,  0x00,    REG(XS)+1))                \
-        EMITW(0xEEB70AE0 | MXM(TmmF+1,  0x00,    REG(XS)+1))                \
+        EMITW(0xEEB70AC0 | MXM(TmmE+1,  0x00,    REH(XS)))                \
+        EMITW(0xEEB70AE0 | MXM(TmmF+1,  0x00,    REH(XS)))                \
         EMITW(0xEE200B00 | MXM(TmmC+0,  TmmC+0,  TmmC+1))                   \
         EMITW(0xEE200B00 | MXM(TmmD+0,  TmmD+0,  TmmD+1))                   \
         EMITW(0xEE200B00 | MXM(TmmE+0,  TmmE+0,  TmmE+1))                   \
@@ -886,12 +986,12 @@
 #define fmsis_rr(XG, XS, XT)                                                \
         EMITW(0xEEB70AC0 | MXM(TmmC+0,  0x00,    REG(XS)+0))                \
         EMITW(0xEEB70AE0 | MXM(TmmD+0,  0x00,    REG(XS)+0))                \
-        EMITW(0xEEB70AC0 | MXM(TmmE+0,  0x00,    REG(XS)+1))                \
-        EMITW(0xEEB70AE0 | MXM(TmmF+0,  0x00,    REG(XS)+1))                \
+        EMITW(0xEEB70AC0 | MXM(TmmE+0,  0x00,    REH(XS)))                \
+        EMITW(0xEEB70AE0 | MXM(TmmF+0,  0x00,    REH(XS)))                \
         EMITW(0xEEB70AC0 | MXM(TmmC+1,  0x00,    REG(XT)+0))                \
         EMITW(0xEEB70AE0 | MXM(TmmD+1,  0x00,    REG(XT)+0))                \
-        EMITW(0xEEB70AC0 | MXM(TmmE+1,  0x00,    REG(XT)+1))                \
-        EMITW(0xEEB70AE0 | MXM(TmmF+1,  0x00,    REG(XT)+1))                \
+        EMITW(0xEEB70AC0 | MXM(TmmE+1,  0x00,    REH(XT)))                \
+        EMITW(0xEEB70AE0 | MXM(TmmF+1,  0x00,    REH(XT)))                \
         EMITW(0xEE200B00 | MXM(TmmC+0,  TmmC+0,  TmmC+1))                   \
         EMITW(0xEE200B00 | MXM(TmmD+0,  TmmD+0,  TmmD+1))                   \
         EMITW(0xEE200B00 | MXM(TmmE+0,  TmmE+0,  TmmE+1))                   \
@@ -912,14 +1012,14 @@
 #define fmsis_ld(XG, XS, MT, DT)                                            \
         EMITW(0xEEB70AC0 | MXM(TmmC+0,  0x00,    REG(XS)+0))                \
         EMITW(0xEEB70AE0 | MXM(TmmD+0,  0x00,    REG(XS)+0))                \
-        EMITW(0xEEB70AC0 | MXM(TmmE+0,  0x00,    REG(XS)+1))                \
-        EMITW(0xEEB70AE0 | MXM(TmmF+0,  0x00,    REG(XS)+1))                \
+        EMITW(0xEEB70AC0 | MXM(TmmE+0,  0x00,    REH(XS)))                \
+        EMITW(0xEEB70AE0 | MXM(TmmF+0,  0x00,    REH(XS)))                \
         movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
         movix_ld(W(XS), W(MT), W(DT))                                       \
         EMITW(0xEEB70AC0 | MXM(TmmC+1,  0x00,    REG(XS)+0))                \
         EMITW(0xEEB70AE0 | MXM(TmmD+1,  0x00,    REG(XS)+0))                \
-        EMITW(0xEEB70AC0 | MXM(TmmE+1,  0x00,    REG(XS)+1))                \
-        EMITW(0xEEB70AE0 | MXM(TmmF+1,  0x00,    REG(XS)+1))                \
+        EMITW(0xEEB70AC0 | MXM(TmmE+1,  0x00,    REH(XS)))                \
+        EMITW(0xEEB70AE0 | MXM(TmmF+1,  0x00,    REH(XS)))                \
         EMITW(0xEE200B00 | MXM(TmmC+0,  TmmC+0,  TmmC+1))                   \
         EMITW(0xEE200B00 | MXM(TmmD+0,  TmmD+0,  TmmD+1))                   \
         EMITW(0xEE200B00 | MXM(TmmE+0,  TmmE+0,  TmmE+1))                   \
@@ -1356,8 +1456,8 @@
 #define rndis_rr(XD, XS)     /* fallback to VFP for float-to-integer rnd */ \
         EMITW(0xEEB60A40 | MXM(REG(XD)+0, 0x00,  REG(XS)+0)) /* due to */   \
         EMITW(0xEEF60A60 | MXM(REG(XD)+0, 0x00,  REG(XS)+0)) /* lack of */  \
-        EMITW(0xEEB60A40 | MXM(REG(XD)+1, 0x00,  REG(XS)+1)) /* rounding */ \
-        EMITW(0xEEF60A60 | MXM(REG(XD)+1, 0x00,  REG(XS)+1)) /* modes */
+        EMITW(0xEEB60A40 | MXM(REH(XD), 0x00,  REH(XS))) /* rounding */ \
+        EMITW(0xEEF60A60 | MXM(REH(XD), 0x00,  REH(XS))) /* modes */
 
 #define rndis_ld(XD, MS, DS) /* fallback to VFP for float-to-integer rnd */ \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
@@ -1365,16 +1465,16 @@
         EMITW(0xF4200AAF | MXM(REG(XD), TPxx,    0x00))                     \
         EMITW(0xEEB60A40 | MXM(REG(XD)+0, 0x00,  REG(XD)+0)) /* due to */   \
         EMITW(0xEEF60A60 | MXM(REG(XD)+0, 0x00,  REG(XD)+0)) /* lack of */  \
-        EMITW(0xEEB60A40 | MXM(REG(XD)+1, 0x00,  REG(XD)+1)) /* rounding */ \
-        EMITW(0xEEF60A60 | MXM(REG(XD)+1, 0x00,  REG(XD)+1)) /* modes */
+        EMITW(0xEEB60A40 | MXM(REH(XD), 0x00,  REH(XD))) /* rounding */ \
+        EMITW(0xEEF60A60 | MXM(REH(XD), 0x00,  REH(XD))) /* modes */
 
 #endif /* RT_128X1 >= 4 */
 
 #define cvtis_rr(XD, XS)     /* fallback to VFP for float-to-integer cvt */ \
         EMITW(0xEEBD0A40 | MXM(REG(XD)+0, 0x00,  REG(XS)+0)) /* due to */   \
         EMITW(0xEEFD0A60 | MXM(REG(XD)+0, 0x00,  REG(XS)+0)) /* lack of */  \
-        EMITW(0xEEBD0A40 | MXM(REG(XD)+1, 0x00,  REG(XS)+1)) /* rounding */ \
-        EMITW(0xEEFD0A60 | MXM(REG(XD)+1, 0x00,  REG(XS)+1)) /* modes */
+        EMITW(0xEEBD0A40 | MXM(REH(XD), 0x00,  REH(XS))) /* rounding */ \
+        EMITW(0xEEFD0A60 | MXM(REH(XD), 0x00,  REH(XS))) /* modes */
 
 #define cvtis_ld(XD, MS, DS) /* fallback to VFP for float-to-integer cvt */ \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
@@ -1382,8 +1482,8 @@
         EMITW(0xF4200AAF | MXM(REG(XD), TPxx,    0x00))                     \
         EMITW(0xEEBD0A40 | MXM(REG(XD)+0, 0x00,  REG(XD)+0)) /* due to */   \
         EMITW(0xEEFD0A60 | MXM(REG(XD)+0, 0x00,  REG(XD)+0)) /* lack of */  \
-        EMITW(0xEEBD0A40 | MXM(REG(XD)+1, 0x00,  REG(XD)+1)) /* rounding */ \
-        EMITW(0xEEFD0A60 | MXM(REG(XD)+1, 0x00,  REG(XD)+1)) /* modes */
+        EMITW(0xEEBD0A40 | MXM(REH(XD), 0x00,  REH(XD))) /* rounding */ \
+        EMITW(0xEEFD0A60 | MXM(REH(XD), 0x00,  REH(XD))) /* modes */
 
 /* cvt (D = signed-int-to-fp S)
  * rounding mode comes from fp control register (set in FCTRL blocks)
@@ -1392,8 +1492,8 @@
 #define cvtin_rr(XD, XS)     /* fallback to VFP for integer-to-float cvt */ \
         EMITW(0xEEB80AC0 | MXM(REG(XD)+0, 0x00,  REG(XS)+0)) /* due to */   \
         EMITW(0xEEF80AE0 | MXM(REG(XD)+0, 0x00,  REG(XS)+0)) /* lack of */  \
-        EMITW(0xEEB80AC0 | MXM(REG(XD)+1, 0x00,  REG(XS)+1)) /* rounding */ \
-        EMITW(0xEEF80AE0 | MXM(REG(XD)+1, 0x00,  REG(XS)+1)) /* modes */
+        EMITW(0xEEB80AC0 | MXM(REH(XD), 0x00,  REH(XS))) /* rounding */ \
+        EMITW(0xEEF80AE0 | MXM(REH(XD), 0x00,  REH(XS))) /* modes */
 
 #define cvtin_ld(XD, MS, DS) /* fallback to VFP for integer-to-float cvt */ \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
@@ -1401,8 +1501,8 @@
         EMITW(0xF4200AAF | MXM(REG(XD), TPxx,    0x00))                     \
         EMITW(0xEEB80AC0 | MXM(REG(XD)+0, 0x00,  REG(XD)+0)) /* due to */   \
         EMITW(0xEEF80AE0 | MXM(REG(XD)+0, 0x00,  REG(XD)+0)) /* lack of */  \
-        EMITW(0xEEB80AC0 | MXM(REG(XD)+1, 0x00,  REG(XD)+1)) /* rounding */ \
-        EMITW(0xEEF80AE0 | MXM(REG(XD)+1, 0x00,  REG(XD)+1)) /* modes */
+        EMITW(0xEEB80AC0 | MXM(REH(XD), 0x00,  REH(XD))) /* rounding */ \
+        EMITW(0xEEF80AE0 | MXM(REH(XD), 0x00,  REH(XD))) /* modes */
 
 /* cvr (D = fp-to-signed-int S)
  * rounding mode is encoded directly (cannot be used in FCTRL blocks)
@@ -1866,6 +1966,18 @@
         EMITW(0xE0800000 | MPM(TPxx,    MOD(MD), VAL(DD), B2(DD), P2(DD)))  \
         EMITW(0xF4000AAF | MXM(REG(XS), TPxx,    0x00))
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment */
+
+#define muvgx_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0xE0800000 | MPM(TPxx,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0xF4200A8F | MXM(REG(XD), TPxx,    0x00))
+
+#define muvgx_st(XS, MD, DD)                                                \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C2(DD), EMPTY2)   \
+        EMITW(0xE0800000 | MPM(TPxx,    MOD(MD), VAL(DD), B2(DD), P2(DD)))  \
+        EMITW(0xF4000A8F | MXM(REG(XS), TPxx,    0x00))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -2467,7 +2579,7 @@
 #define RT_SIMD_MASK_FULL16_128  0xFFFCFFFC /*  all satisfy the condition */
 
 #define mkjgx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
-        EMITW(0xF2100B10 | MXM(TmmM+0,  REG(XS)+0, REG(XS)+1))              \
+        EMITW(0xF2100B10 | MXM(TmmM+0,  REG(XS)+0, REH(XS)))              \
         EMITW(0xF2100B10 | MXM(TmmM+0,  TmmM+0,    TmmM+1))                 \
         EMITW(0xEE100B10 | MXM(Teax,    TmmM+0,    0x00))                   \
         cmpwx_ri(Reax, IW(RT_SIMD_MASK_##mask##16_128))                     \
@@ -2985,7 +3097,7 @@
 #define RT_SIMD_MASK_FULL08_128  0xFCFCFCFC /*  all satisfy the condition */
 
 #define mkjgb_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
-        EMITW(0xF2000B10 | MXM(TmmM+0,  REG(XS)+0, REG(XS)+1))              \
+        EMITW(0xF2000B10 | MXM(TmmM+0,  REG(XS)+0, REH(XS)))              \
         EMITW(0xF2000B10 | MXM(TmmM+0,  TmmM+0,    TmmM+1))                 \
         EMITW(0xEE100B10 | MXM(Teax,    TmmM+0,    0x00))                   \
         cmpwx_ri(Reax, IW(RT_SIMD_MASK_##mask##08_128))                     \
@@ -1541,6 +1541,30 @@
 #define mulwp_xm(MS, DS) /* Reax is in/out, prepares Redx for divwn_x* */   \
         mulwx_ld(Reax, W(MS), W(DS))  /* must not exceed operands size */
 
+/* mhi (G = G * S >> 32), high half of full 32x32-bit product
+ * set-flags: undefined
+ * low half is given by mulwx_**, both halves at once by mulw*_x* */
+
+#define mhiwx_rr(RG, RS)                                                    \
+        EMITW(0x00000019 | MRM(0x00,    REG(RG), REG(RS)))                  \
+        EMITW(0x00000010 | MRM(REG(RG), 0x00,    0x00))
+
+#define mhiwx_ld(RG, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0x8C000000 | MDM(TMxx,    MOD(MS), VAL(DS), B3(DS), P1(DS)))  \
+        EMITW(0x00000019 | MRM(0x00,    REG(RG), TMxx))                     \
+        EMITW(0x00000010 | MRM(REG(RG), 0x00,    0x00))
+
+#define mhiwn_rr(RG, RS)                                                    \
+        EMITW(0x00000018 | MRM(0x00,    REG(RG), REG(RS)))                  \
+        EMITW(0x00000010 | MRM(REG(RG), 0x00,    0x00))
+
+#define mhiwn_ld(RG, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0x8C000000 | MDM(TMxx,    MOD(MS), VAL(DS), B3(DS), P1(DS)))  \
+        EMITW(0x00000018 | MRM(0x00,    REG(RG), TMxx))                     \
+        EMITW(0x00000010 | MRM(REG(RG), 0x00,    0x00))
+
 /* div (G = G / S)
  * set-flags: undefined */
 
@@ -1733,6 +1757,26 @@
 #define mulwp_xm(MS, DS) /* Reax is in/out, prepares Redx for divwn_x* */   \
         mulwx_ld(Reax, W(MS), W(DS))  /* must not exceed operands size */
 
+/* mhi (G = G * S >> 32), high half of full 32x32-bit product
+ * set-flags: undefined
+ * low half is given by mulwx_**, both halves at once by mulw*_x* */
+
+#define mhiwx_rr(RG, RS)                                                    \
+        EMITW(0x000000D9 | MRM(REG(RG), REG(RG), REG(RS)))
+
+#define mhiwx_ld(RG, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0x8C000000 | MDM(TMxx,    MOD(MS), VAL(DS), B3(DS), P1(DS)))  \
+        EMITW(0x000000D9 | MRM(REG(RG), REG(RG), TMxx))
+
+#define mhiwn_rr(RG, RS)                                                    \
+        EMITW(0x000000D8 | MRM(REG(RG), REG(RG), REG(RS)))
+
+#define mhiwn_ld(RG, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0x8C000000 | MDM(TMxx,    MOD(MS), VAL(DS), B3(DS), P1(DS)))  \
+        EMITW(0x000000D8 | MRM(REG(RG), REG(RG), TMxx))
+
 /* div (G = G / S)
  * set-flags: undefined */
 
@@ -2051,6 +2095,170 @@
         EMITW(0x90000000 | MDM(TLxx,    MOD(MS), VAL(DS), B3(DS), P1(DS)))  \
         EMITW(0x00000025 | MRM(TRxx,    REG(RT), TZxx))
 
+/* internal opcodes for ll/sc (32-bit) and lld/scd (64-bit) used below */
+
+#if (RT_BASE_COMPAT_REV < 6) /* pre-r6 */
+
+#define LLW     0xC0000000
+#define SCW     0xE0000000
+#define LLZ     0xD0000000
+#define SCZ     0xF0000000
+
+#else /* RT_BASE_COMPAT_REV >= 6 : r6 */
+
+#define LLW     0x7C000036
+#define SCW     0x7C000026
+#define LLZ     0x7C000037
+#define SCZ     0x7C000027
+
+#endif /* RT_BASE_COMPAT_REV >= 6 : r6 */
+
+/* xad (G = M, M = M + G), atomic fetch-add
+ * set-flags: undefined
+ * xad, xch, cas need natural alignment of memory args
+ * and are sequentially consistent (act as full memory barriers) */
+
+#define xadwx_st(RG, MG, DG)                                                \
+        AUW(SIB(MG),  EMPTY,  EMPTY,    MOD(MG), VAL(DG), C3(DG), EMPTY2)   \
+        EMITW(0x00000021 | MRM(TDxx,    MOD(MG), TDxx) | ADR)               \
+        EMITW(0x0000000F)                  /* <- sync */                    \
+        EMITW(LLW | MTM(TMxx,    TDxx,    0x00))                            \
+        EMITW(0x00000021 | MRM(TIxx,    TMxx,    REG(RG)))                  \
+        EMITW(SCW | MTM(TIxx,    TDxx,    0x00))                            \
+        EMITW(0x1000FFFC | MRM(0x00,    TIxx,    TZxx))                     \
+        EMITW(0x00000000)                  /* <- nop (delay slot) */        \
+        EMITW(0x0000000F)                  /* <- sync */                    \
+        EMITW(0x00000025 | MRM(REG(RG), TMxx,    TZxx))
+
+/* xch (G = M, M = G), atomic exchange
+ * set-flags: undefined */
+
+#define xchwx_st(RG, MG, DG)                                                \
+        AUW(SIB(MG),  EMPTY,  EMPTY,    MOD(MG), VAL(DG), C3(DG), EMPTY2)   \
+        EMITW(0x00000021 | MRM(TDxx,    MOD(MG), TDxx) | ADR)               \
+        EMITW(0x0000000F)                  /* <- sync */                    \
+        EMITW(LLW | MTM(TMxx,    TDxx,    0x00))                            \
+        EMITW(0x00000025 | MRM(TIxx,    REG(RG), TZxx))                     \
+        EMITW(SCW | MTM(TIxx,    TDxx,    0x00))                            \
+        EMITW(0x1000FFFC | MRM(0x00,    TIxx,    TZxx))                     \
+        EMITW(0x00000000)                  /* <- nop (delay slot) */        \
+        EMITW(0x0000000F)                  /* <- sync */                    \
+        EMITW(0x00000025 | MRM(REG(RG), TMxx,    TZxx))
+
+/* cas (if M == Reax then M = S, Reax = M), atomic compare-and-swap
+ * set-flags: undefined
+ * success is checked by comparing Reax to its value before cas */
+
+#define caswx_st(RS, MG, DG)     /* Reax is in/out, RS, MG != Reax */       \
+        AUW(SIB(MG),  EMPTY,  EMPTY,    MOD(MG), VAL(DG), C3(DG), EMPTY2)   \
+        EMITW(0x00000021 | MRM(TDxx,    MOD(MG), TDxx) | ADR)               \
+        EMITW(0x0000000F)                  /* <- sync */                    \
+        EMITW(LLW | MTM(TMxx,    TDxx,    0x00))                            \
+        EMITW(0x14000004 | MRM(0x00,    TMxx,    Teax))                     \
+        EMITW(0x00000025 | MRM(TIxx,    REG(RS), TZxx))                     \
+        EMITW(SCW | MTM(TIxx,    TDxx,    0x00))                            \
+        EMITW(0x1000FFFB | MRM(0x00,    TIxx,    TZxx))                     \
+        EMITW(0x00000000)                  /* <- nop (delay slot) */        \
+        EMITW(0x0000000F)                  /* <- sync */                    \
+        EMITW(0x00000025 | MRM(Teax,    TMxx,    TZxx))
+
+/* fen (memory-ordering fence)
+ * set-flags: no
+ * fenxx_aq - acquire: prior loads are ordered before subsequent loads/stores
+ * fenxx_rl - release: prior loads/stores are ordered before subsequent stores
+ * fenxx_sc - full: prior loads/stores are ordered before subsequent ones */
+
+#define fenxx_aq()                                                          \
+        EMITW(0x0000000F)                  /* <- sync */
+
+#define fenxx_rl()                                                          \
+        EMITW(0x0000000F)                  /* <- sync */
+
+#define fenxx_sc()                                                          \
+        EMITW(0x0000000F)                  /* <- sync */
+
+/* cnt (D = number of set bits in S), population count
+ * set-flags: undefined */
+
+#define cntwx_rr(RD, RS)                                                    \
+        EMITW(0x00000002 | MSM(TMxx,    REG(RS), 0x00) | 1 << 6)            \
+        EMITW(0x3C005555 | MTM(TIxx,    0x00,    0x00))                     \
+        EMITW(0x34005555 | MTM(TIxx,    TIxx,    0x00))                     \
+        EMITW(0x00000024 | MRM(TMxx,    TMxx,    TIxx))                     \
+        EMITW(0x00000023 | MRM(REG(RD), REG(RS), TMxx))                     \
+        EMITW(0x00000002 | MSM(TMxx,    REG(RD), 0x00) | 2 << 6)            \
+        EMITW(0x3C003333 | MTM(TIxx,    0x00,    0x00))                     \
+        EMITW(0x34003333 | MTM(TIxx,    TIxx,    0x00))                     \
+        EMITW(0x00000024 | MRM(TMxx,    TMxx,    TIxx))                     \
+        EMITW(0x00000024 | MRM(REG(RD), REG(RD), TIxx))                     \
+        EMITW(0x00000021 | MRM(REG(RD), REG(RD), TMxx))                     \
+        EMITW(0x00000002 | MSM(TMxx,    REG(RD), 0x00) | 4 << 6)            \
+        EMITW(0x00000021 | MRM(REG(RD), REG(RD), TMxx))                     \
+        EMITW(0x3C000F0F | MTM(TIxx,    0x00,    0x00))                     \
+        EMITW(0x34000F0F | MTM(TIxx,    TIxx,    0x00))                     \
+        EMITW(0x00000024 | MRM(REG(RD), REG(RD), TIxx))                     \
+        EMITW(0x00000000 | MSM(TMxx,    REG(RD), 0x00) | 8 << 6)            \
+        EMITW(0x00000021 | MRM(REG(RD), REG(RD), TMxx))                     \
+        EMITW(0x00000000 | MSM(TMxx,    REG(RD), 0x00) | 16 << 6)           \
+        EMITW(0x00000021 | MRM(REG(RD), REG(RD), TMxx))                     \
+        EMITW(0x00000002 | MSM(REG(RD), REG(RD), 0x00) | 24 << 6)
+
+/* clz (D = number of leading zeros in S)
+ * set-flags: undefined
+ * clz, ctz return operand size in bits for zero source */
+
+#if (RT_BASE_COMPAT_REV < 6) /* pre-r6 */
+
+#define clzwx_rr(RD, RS)                                                    \
+        EMITW(0x70000020 | MRM(REG(RD), REG(RS), REG(RD)))
+
+#else /* RT_BASE_COMPAT_REV >= 6 : r6 */
+
+#define clzwx_rr(RD, RS)                                                    \
+        EMITW(0x00000050 | MRM(REG(RD), REG(RS), 0x00))
+
+#endif /* RT_BASE_COMPAT_REV >= 6 : r6 */
+
+/* ctz (D = number of trailing zeros in S)
+ * set-flags: undefined */
+
+#if (RT_BASE_COMPAT_REV < 6) /* pre-r6 */
+
+#define ctzwx_rr(RD, RS)                                                    \
+        EMITW(0x2400FFFF | MTM(TMxx,    REG(RS), 0x00))  /* <- S - 1 */     \
+        EMITW(0x00000027 | MRM(TIxx,    REG(RS), 0x00))                     \
+        EMITW(0x00000024 | MRM(TMxx,    TMxx,    TIxx))                     \
+        EMITW(0x70000020 | MRM(REG(RD), TMxx,    REG(RD)))                  \
+        EMITW(0x24000020 | MTM(TIxx,    0x00,    0x00))                     \
+        EMITW(0x00000023 | MRM(REG(RD), TIxx,    REG(RD)))
+
+#else /* RT_BASE_COMPAT_REV >= 6 : r6 */
+
+#define ctzwx_rr(RD, RS)                                                    \
+        EMITW(0x2400FFFF | MTM(TMxx,    REG(RS), 0x00))  /* <- S - 1 */     \
+        EMITW(0x00000027 | MRM(TIxx,    REG(RS), 0x00))                     \
+        EMITW(0x00000024 | MRM(TMxx,    TMxx,    TIxx))                     \
+        EMITW(0x00000050 | MRM(REG(RD), TMxx,    0x00))                     \
+        EMITW(0x24000020 | MTM(TIxx,    0x00,    0x00))                     \
+        EMITW(0x00000023 | MRM(REG(RD), TIxx,    REG(RD)))
+
+#endif /* RT_BASE_COMPAT_REV >= 6 : r6 */
+
+/* bsw (D = S with bytes in reversed order), byte swap
+ * set-flags: undefined */
+
+#define bswwx_rr(RD, RS)                                                    \
+        EMITW(0x7C0000A0 | MSM(REG(RD), REG(RS), 0x00))                     \
+        EMITW(0x00200002 | MSM(REG(RD), REG(RD), 0x00) | 16 << 6)
+
+/* bfx (G = G >> IS & ((1 << IT) - 1)), unsigned bit-field extract
+ * set-flags: undefined
+ * IT > 0, IS + IT <= 32 */
+
+#define bfxwx_ri(RG, IS, IT)                                                \
+        EMITW(0x7C000000 | MTM(REG(RG), REG(RG), 0x00) |                    \
+             (VAL(IS) & 0x1F) << 6 | ((VAL(IT)-1) & 0x1F) << 11)
+
 /* ver (Mebp/inf_VER = SIMD-version)
  * set-flags: no
  * For interpretation of SIMD build flags check compatibility layer in rtzero.h
@@ -2085,7 +2293,9 @@
  * maximum byte-address-range for un/conditional jumps is signed 18/16-bit
  * based on minimum natively-encoded offset across supported targets (u/c)
  * MIPS:18-bit, POWER:26-bit, AArch32:26-bit, AArch64:28-bit, x86:32-bit /
- * MIPS:18-bit, POWER:16-bit, AArch32:26-bit, AArch64:21-bit, x86:32-bit */
+ * MIPS:18-bit, POWER:16-bit, AArch32:26-bit, AArch64:21-bit, x86:32-bit
+ * RT_BASE_COMPAT_FAR (rtarch.h) replaces MIPS b with j (within 256MB region),
+ * conditional jumps via inverted branch over j (label 0 reserved) */
 
 #define jmpxx_xr(RS)           /* register-targeted unconditional jump */   \
         EMITW(0x00000008 | MRM(0x00,    REG(RS), 0x00))                     \
@@ -2110,51 +2320,51 @@
 #endif /* defined (RT_M32, RT_M64) */
 
 #define jmpxx_lb(lb)              /* label-targeted unconditional jump */   \
-        ASM_BEG ASM_OP1(b, lb) ASM_END
+        JMP1(lb)
 
 #define jezxx_lb(lb)               /* setting-flags-arithmetic -> jump */   \
-        ASM_BEG ASM_OP2(beqz, $t8, lb) ASM_END
+        JCC2(beqz, bnez, $t8, lb)
 
 #define jnzxx_lb(lb)               /* setting-flags-arithmetic -> jump */   \
-        ASM_BEG ASM_OP2(bnez, $t8, lb) ASM_END
+        JCC2(bnez, beqz, $t8, lb)
 
 #define jeqxx_lb(lb)                                /* compare -> jump */   \
-        ASM_BEG ASM_OP3(beq,  $t8, $t9, lb) ASM_END
+        JCC3(beq, bne, $t8, $t9, lb)
 
 #define jnexx_lb(lb)                                /* compare -> jump */   \
-        ASM_BEG ASM_OP3(bne,  $t8, $t9, lb) ASM_END
+        JCC3(bne, beq, $t8, $t9, lb)
 
 #define jltxx_lb(lb)                                /* compare -> jump */   \
         ASM_BEG ASM_OP3(sltu, $t8, $t8, $t9) ASM_END                        \
-        ASM_BEG ASM_OP2(bnez, $t8, lb) ASM_END
+        JCC2(bnez, beqz, $t8, lb)
 
 #define jlexx_lb(lb)                                /* compare -> jump */   \
         ASM_BEG ASM_OP3(sltu, $t8, $t9, $t8) ASM_END                        \
-        ASM_BEG ASM_OP2(beqz, $t8, lb) ASM_END
+        JCC2(beqz, bnez, $t8, lb)
 
 #define jgtxx_lb(lb)                                /* compare -> jump */   \
         ASM_BEG ASM_OP3(sltu, $t8, $t9, $t8) ASM_END                        \
-        ASM_BEG ASM_OP2(bnez, $t8, lb) ASM_END
+        JCC2(bnez, beqz, $t8, lb)
 
 #define jgexx_lb(lb)                                /* compare -> jump */   \
         ASM_BEG ASM_OP3(sltu, $t8, $t8, $t9) ASM_END                        \
-        ASM_BEG ASM_OP2(beqz, $t8, lb) ASM_END
+        JCC2(beqz, bnez, $t8, lb)
 
 #define jltxn_lb(lb)                                /* compare -> jump */   \
         ASM_BEG ASM_OP3(slt,  $t8, $t8, $t9) ASM_END                        \
-        ASM_BEG ASM_OP2(bnez, $t8, lb) ASM_END
+        JCC2(bnez, beqz, $t8, lb)
 
 #define jlexn_lb(lb)                                /* compare -> jump */   \
         ASM_BEG ASM_OP3(slt,  $t8, $t9, $t8) ASM_END                        \
-        ASM_BEG ASM_OP2(beqz, $t8, lb) ASM_END
+        JCC2(beqz, bnez, $t8, lb)
 
 #define jgtxn_lb(lb)                                /* compare -> jump */   \
         ASM_BEG ASM_OP3(slt,  $t8, $t9, $t8) ASM_END                        \
-        ASM_BEG ASM_OP2(bnez, $t8, lb) ASM_END
+        JCC2(bnez, beqz, $t8, lb)
 
 #define jgexn_lb(lb)                                /* compare -> jump */   \
         ASM_BEG ASM_OP3(slt,  $t8, $t8, $t9) ASM_END                        \
-        ASM_BEG ASM_OP2(beqz, $t8, lb) ASM_END
+        JCC2(beqz, bnez, $t8, lb)
 
 #define LBL(lb)                                          /* code label */   \
         ASM_BEG ASM_OP0(lb:) ASM_END
@@ -2166,7 +2376,9 @@
  * maximum byte-address-range for un/conditional jumps is signed 18/16-bit
  * based on minimum natively-encoded offset across supported targets (u/c)
  * MIPS:18-bit, POWER:26-bit, AArch32:26-bit, AArch64:28-bit, x86:32-bit /
- * MIPS:18-bit, POWER:16-bit, AArch32:26-bit, AArch64:21-bit, x86:32-bit */
+ * MIPS:18-bit, POWER:16-bit, AArch32:26-bit, AArch64:21-bit, x86:32-bit
+ * RT_BASE_COMPAT_FAR (rtarch.h) extends MIPS r6 u/c jumps to 28-bit bc,
+ * conditional jumps via inverted branch over bc (label 0 reserved) */
 
 #define jmpxx_xr(RS)           /* register-targeted unconditional jump */   \
         EMITW(0x00000009 | MRM(0x00,    REG(RS), 0x00))                     \
@@ -2191,43 +2403,43 @@
 #endif /* defined (RT_M32, RT_M64) */
 
 #define jmpxx_lb(lb)              /* label-targeted unconditional jump */   \
-        ASM_BEG ASM_OP1(b, lb) ASM_END
+        JMP1(lb)
 
 #define jezxx_lb(lb)               /* setting-flags-arithmetic -> jump */   \
-        ASM_BEG ASM_OP2(beqzc, $t8, lb) ASM_END
+        JCC2(beqzc, bnezc, $t8, lb)
 
 #define jnzxx_lb(lb)               /* setting-flags-arithmetic -> jump */   \
-        ASM_BEG ASM_OP2(bnezc, $t8, lb) ASM_END
+        JCC2(bnezc, beqzc, $t8, lb)
 
 #define jeqxx_lb(lb)                                /* compare -> jump */   \
-        ASM_BEG ASM_OP3(beqc,  $t8, $t9, lb) ASM_END
+        JCC3(beqc, bnec, $t8, $t9, lb)
 
 #define jnexx_lb(lb)                                /* compare -> jump */   \
-        ASM_BEG ASM_OP3(bnec,  $t8, $t9, lb) ASM_END
+        JCC3(bnec, beqc, $t8, $t9, lb)
 
 #define jltxx_lb(lb)                                /* compare -> jump */   \
-        ASM_BEG ASM_OP3(bltuc, $t8, $t9, lb) ASM_END
+        JCC3(bltuc, bgeuc, $t8, $t9, lb)
 
 #define jlexx_lb(lb)                                /* compare -> jump */   \
-        ASM_BEG ASM_OP3(bgeuc, $t9, $t8, lb) ASM_END
+        JCC3(bgeuc, bltuc, $t9, $t8, lb)
 
 #define jgtxx_lb(lb)                                /* compare -> jump */   \
-        ASM_BEG ASM_OP3(bltuc, $t9, $t8, lb) ASM_END
+        JCC3(bltuc, bgeuc, $t9, $t8, lb)
 
 #define jgexx_lb(lb)                                /* compare -> jump */   \
-        ASM_BEG ASM_OP3(bgeuc, $t8, $t9, lb) ASM_END
+        JCC3(bgeuc, bltuc, $t8, $t9, lb)
 
 #define jltxn_lb(lb)                                /* compare -> jump */   \
-        ASM_BEG ASM_OP3(bltc,  $t8, $t9, lb) ASM_END
+        JCC3(bltc, bgec, $t8, $t9, lb)
 
 #define jlexn_lb(lb)                                /* compare -> jump */   \
-        ASM_BEG ASM_OP3(bgec,  $t9, $t8, lb) ASM_END
+        JCC3(bgec, bltc, $t9, $t8, lb)
 
 #define jgtxn_lb(lb)                                /* compare -> jump */   \
-        ASM_BEG ASM_OP3(bltc,  $t9, $t8, lb) ASM_END
+        JCC3(bltc, bgec, $t9, $t8, lb)
 
 #define jgexn_lb(lb)                                /* compare -> jump */   \
-        ASM_BEG ASM_OP3(bgec,  $t8, $t9, lb) ASM_END
+        JCC3(bgec, bltc, $t8, $t9, lb)
 
 #define LBL(lb)                                          /* code label */   \
         ASM_BEG ASM_OP0(lb:) ASM_END
@@ -2336,37 +2548,69 @@
 
 #if (RT_BASE_COMPAT_REV < 6) /* pre-r6 */
 
+/* internal definitions for label-targeted jumps, with RT_BASE_COMPAT_FAR
+ * enabled 18-bit b is replaced by j (within 256MB region) and 16-bit branch
+ * by inverted branch over j, local label 0 is reserved for internal use */
+
+#if (RT_BASE_COMPAT_FAR == 0) /* native */
+
+#define JMP1(lb)                                                            \
+        ASM_BEG ASM_OP1(b, lb) ASM_END
+
+#define JCC2(cc, nc, p1, lb)                                                \
+        ASM_BEG ASM_OP2(cc, p1, lb) ASM_END
+
+#define JCC3(cc, nc, p1, p2, lb)                                            \
+        ASM_BEG ASM_OP3(cc, p1, p2, lb) ASM_END
+
+#else /* RT_BASE_COMPAT_FAR != 0 : far */
+
+#define JMP1(lb)                                                            \
+        ASM_BEG ASM_OP1(j, lb) ASM_END
+
+#define JCC2(cc, nc, p1, lb)                                                \
+        ASM_BEG ASM_OP2(nc, p1, 0f) ASM_END                                 \
+        JMP1(lb)                                                            \
+        ASM_BEG ASM_OP0(0:) ASM_END
+
+#define JCC3(cc, nc, p1, p2, lb)                                            \
+        ASM_BEG ASM_OP3(nc, p1, p2, 0f) ASM_END                             \
+        JMP1(lb)                                                            \
+        ASM_BEG ASM_OP0(0:) ASM_END
+
+#endif /* RT_BASE_COMPAT_FAR != 0 : far */
+
 /* internal definitions for combined-compare-jump (cmj) */
 
 #define ZJ0(r1, lb)                                                         \
-        ASM_BEG ASM_OP3(beq,  r1, $zero, lb) ASM_END
+        JCC3(beq, bne, r1, $zero, lb)
 
 #define ZJ1(r1, lb)                                                         \
-        ASM_BEG ASM_OP3(bne,  r1, $zero, lb) ASM_END
+        JCC3(bne, beq, r1, $zero, lb)
 
 #define ZJ2(r1, lb) /* "never" branch as unsigned is always >= 0 */         \
         EMPTY
 
 #define ZJ3(r1, lb)                                                         \
-        ASM_BEG ASM_OP3(beq,  r1, $zero, lb) ASM_END
+        JCC3(beq, bne, r1, $zero, lb)
 
 #define ZJ4(r1, lb)                                                         \
-        ASM_BEG ASM_OP3(bne,  r1, $zero, lb) ASM_END
+        JCC3(bne, beq, r1, $zero, lb)
 
 #define ZJ5(r1, lb) /* "always" branch as unsigned is never < 0 */          \
-        ASM_BEG ASM_OP1(b, lb) ASM_END
+        JMP1(lb)
 
 #define ZJ6(r1, lb)                                                         \
-        ASM_BEG ASM_OP2(bltz, r1, lb) ASM_END
+        JCC2(bltz, bgez, r1, lb)
 
 #define ZJ7(r1, lb)                                                         \
-        ASM_BEG ASM_OP2(blez, r1, lb) ASM_END
+        JCC2(blez, bgtz, r1, lb)
 
 #define ZJ8(r1, lb)                                                         \
-        ASM_BEG ASM_OP2(bgtz, r1, lb) ASM_END
+        JCC2(bgtz, blez, r1, lb)
 
 #define ZJ9(r1, lb)                                                         \
-        ASM_BEG ASM_OP2(bgez, r1, lb) ASM_END
+        JCC2(bgez, bltz, r1, lb)
 
 #define CMZ(cc, r1, lb)                                                     \
         Z##cc(r1, lb)
@@ -2374,134 +2618,168 @@
 
 #define IJ0(r1, p1, IS, lb)                                                 \
         AUW(EMPTY,    VAL(IS), TRxx,    EMPTY,   EMPTY,   EMPTY2, G3(IS))   \
-        ASM_BEG ASM_OP3(beq, r1, $t9, lb) ASM_END
+        JCC3(beq, bne, r1, $t9, lb)
 
 #define IJ1(r1, p1, IS, lb)                                                 \
         AUW(EMPTY,    VAL(IS), TRxx,    EMPTY,   EMPTY,   EMPTY2, G3(IS))   \
-        ASM_BEG ASM_OP3(bne, r1, $t9, lb) ASM_END
+        JCC3(bne, beq, r1, $t9, lb)
 
 #define IJ2(r1, p1, IS, lb)                                                 \
         AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G1(IS))   \
         EMITW(0x00000000 | MIM(TLxx,    p1,      VAL(IS), T1(IS), M1(IS)) | \
         (M(TP1(IS) == 0) & 0x2C000000) | (M(TP1(IS) != 0) & 0x0000002B))    \
-        ASM_BEG ASM_OP2(bnez, $t8, lb) ASM_END
+        JCC2(bnez, beqz, $t8, lb)
 
 #define IJ3(r1, p1, IS, lb)                                                 \
         AUW(EMPTY,    VAL(IS), TRxx,    EMPTY,   EMPTY,   EMPTY2, G3(IS))   \
         ASM_BEG ASM_OP3(sltu, $t8, $t9, r1) ASM_END                         \
-        ASM_BEG ASM_OP2(beqz, $t8, lb) ASM_END
+        JCC2(beqz, bnez, $t8, lb)
 
 #define IJ4(r1, p1, IS, lb)                                                 \
         AUW(EMPTY,    VAL(IS), TRxx,    EMPTY,   EMPTY,   EMPTY2, G3(IS))   \
         ASM_BEG ASM_OP3(sltu, $t8, $t9, r1) ASM_END                         \
-        ASM_BEG ASM_OP2(bnez, $t8, lb) ASM_END
+        JCC2(bnez, beqz, $t8, lb)
 
 #define IJ5(r1, p1, IS, lb)                                                 \
         AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G1(IS))   \
         EMITW(0x00000000 | MIM(TLxx,    p1,      VAL(IS), T1(IS), M1(IS)) | \
         (M(TP1(IS) == 0) & 0x2C000000) | (M(TP1(IS) != 0) & 0x0000002B))    \
-        ASM_BEG ASM_OP2(beqz, $t8, lb) ASM_END
+        JCC2(beqz, bnez, $t8, lb)
 
 #define IJ6(r1, p1, IS, lb)                                                 \
         AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G1(IS))   \
         EMITW(0x00000000 | MIM(TLxx,    p1,      VAL(IS), T1(IS), M1(IS)) | \
         (M(TP1(IS) == 0) & 0x28000000) | (M(TP1(IS) != 0) & 0x0000002A))    \
-        ASM_BEG ASM_OP2(bnez, $t8, lb) ASM_END
+        JCC2(bnez, beqz, $t8, lb)
 
 #define IJ7(r1, p1, IS, lb)                                                 \
         AUW(EMPTY,    VAL(IS), TRxx,    EMPTY,   EMPTY,   EMPTY2, G3(IS))   \
         ASM_BEG ASM_OP3(slt,  $t8, $t9, r1) ASM_END                         \
-        ASM_BEG ASM_OP2(beqz, $t8, lb) ASM_END
+        JCC2(beqz, bnez, $t8, lb)
 
 #define IJ8(r1, p1, IS, lb)                                                 \
         AUW(EMPTY,    VAL(IS), TRxx,    EMPTY,   EMPTY,   EMPTY2, G3(IS))   \
         ASM_BEG ASM_OP3(slt,  $t8, $t9, r1) ASM_END                         \
-        ASM_BEG ASM_OP2(bnez, $t8, lb) ASM_END
+        JCC2(bnez, beqz, $t8, lb)
 
 #define IJ9(r1, p1, IS, lb)                                                 \
         AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G1(IS))   \
         EMITW(0x00000000 | MIM(TLxx,    p1,      VAL(IS), T1(IS), M1(IS)) | \
         (M(TP1(IS) == 0) & 0x28000000) | (M(TP1(IS) != 0) & 0x0000002A))    \
-        ASM_BEG ASM_OP2(beqz, $t8, lb) ASM_END
+        JCC2(beqz, bnez, $t8, lb)
 
 #define CMI(cc, r1, p1, IS, lb)                                             \
         I##cc(r1, p1, W(IS), lb)
 
 
 #define RJ0(r1, r2, lb)                                                     \
-        ASM_BEG ASM_OP3(beq,  r1,  r2, lb) ASM_END
+        JCC3(beq, bne, r1, r2, lb)
 
 #define RJ1(r1, r2, lb)                                                     \
-        ASM_BEG ASM_OP3(bne,  r1,  r2, lb) ASM_END
+        JCC3(bne, beq, r1, r2, lb)
 
 #define RJ2(r1, r2, lb)                                                     \
         ASM_BEG ASM_OP3(sltu, $t8, r1, r2) ASM_END                          \
-        ASM_BEG ASM_OP2(bnez, $t8, lb) ASM_END
+        JCC2(bnez, beqz, $t8, lb)
 
 #define RJ3(r1, r2, lb)                                                     \
         ASM_BEG ASM_OP3(sltu, $t8, r2, r1) ASM_END                          \
-        ASM_BEG ASM_OP2(beqz, $t8, lb) ASM_END
+        JCC2(beqz, bnez, $t8, lb)
 
 #define RJ4(r1, r2, lb)                                                     \
         ASM_BEG ASM_OP3(sltu, $t8, r2, r1) ASM_END                          \
-        ASM_BEG ASM_OP2(bnez, $t8, lb) ASM_END
+        JCC2(bnez, beqz, $t8, lb)
 
 #define RJ5(r1, r2, lb)                                                     \
         ASM_BEG ASM_OP3(sltu, $t8, r1, r2) ASM_END                          \
-        ASM_BEG ASM_OP2(beqz, $t8, lb) ASM_END
+        JCC2(beqz, bnez, $t8, lb)
 
 #define RJ6(r1, r2, lb)                                                     \
         ASM_BEG ASM_OP3(slt,  $t8, r1, r2) ASM_END                          \
-        ASM_BEG ASM_OP2(bnez, $t8, lb) ASM_END
+        JCC2(bnez, beqz, $t8, lb)
 
 #define RJ7(r1, r2, lb)                                                     \
         ASM_BEG ASM_OP3(slt,  $t8, r2, r1) ASM_END                          \
-        ASM_BEG ASM_OP2(beqz, $t8, lb) ASM_END
+        JCC2(beqz, bnez, $t8, lb)
 
 #define RJ8(r1, r2, lb)                                                     \
         ASM_BEG ASM_OP3(slt,  $t8, r2, r1) ASM_END                          \
-        ASM_BEG ASM_OP2(bnez, $t8, lb) ASM_END
+        JCC2(bnez, beqz, $t8, lb)
 
 #define RJ9(r1, r2, lb)                                                     \
         ASM_BEG ASM_OP3(slt,  $t8, r1, r2) ASM_END                          \
-        ASM_BEG ASM_OP2(beqz, $t8, lb) ASM_END
+        JCC2(beqz, bnez, $t8, lb)
 
 #define CMR(cc, r1, r2, lb)                                                 \
         R##cc(r1, r2, lb)
 
 #else /* RT_BASE_COMPAT_REV >= 6 : r6 */
 
+/* internal definitions for label-targeted jumps, with RT_BASE_COMPAT_FAR
+ * enabled 18-bit b is replaced by 28-bit bc and 16/21-bit compact branch
+ * by inverted branch over bc, local label 0 is reserved for internal use */
+
+#if (RT_BASE_COMPAT_FAR == 0) /* native */
+
+#define JMP1(lb)                                                            \
+        ASM_BEG ASM_OP1(b, lb) ASM_END
+
+#define JCC2(cc, nc, p1, lb)                                                \
+        ASM_BEG ASM_OP2(cc, p1, lb) ASM_END
+
+#define JCC3(cc, nc, p1, p2, lb)                                            \
+        ASM_BEG ASM_OP3(cc, p1, p2, lb) ASM_END
+
+#else /* RT_BASE_COMPAT_FAR != 0 : far */
+
+#define JMP1(lb)                                                            \
+        ASM_BEG ASM_OP1(bc, lb) ASM_END
+
+#define JCC2(cc, nc, p1, lb)                                                \
+        ASM_BEG ASM_OP2(nc, p1, 0f) ASM_END                                 \
+        ASM_BEG ASM_OP0(nop) ASM_END /* <- forbidden slot */                \
+        JMP1(lb)                                                            \
+        ASM_BEG ASM_OP0(0:) ASM_END
+
+#define JCC3(cc, nc, p1, p2, lb)                                            \
+        ASM_BEG ASM_OP3(nc, p1, p2, 0f) ASM_END                             \
+        ASM_BEG ASM_OP0(nop) ASM_END /* <- forbidden slot */                \
+        JMP1(lb)                                                            \
+        ASM_BEG ASM_OP0(0:) ASM_END
+
+#endif /* RT_BASE_COMPAT_FAR != 0 : far */
+
 /* internal definitions for combined-compare-jump (cmj) */
 
 #define ZJ0(r1, lb)                                                         \
-        ASM_BEG ASM_OP2(beqzc, r1, lb) ASM_END
+        JCC2(beqzc, bnezc, r1, lb)
 
 #define ZJ1(r1, lb)                                                         \
-        ASM_BEG ASM_OP2(bnezc, r1, lb) ASM_END
+        JCC2(bnezc, beqzc, r1, lb)
 
 #define ZJ2(r1, lb) /* "never" branch as unsigned is always >= 0 */         \
         EMPTY
 
 #define ZJ3(r1, lb)                                                         \
-        ASM_BEG ASM_OP2(beqzc, r1, lb) ASM_END
+        JCC2(beqzc, bnezc, r1, lb)
 
 #define ZJ4(r1, lb)                                                         \
-        ASM_BEG ASM_OP2(bnezc, r1, lb) ASM_END
+        JCC2(bnezc, beqzc, r1, lb)
 
 #define ZJ5(r1, lb) /* "always" branch as unsigned is never < 0 */          \
-        ASM_BEG ASM_OP1(b, lb) ASM_END
+        JMP1(lb)
 
 #define ZJ6(r1, lb)                                                         \
-        ASM_BEG ASM_OP2(bltzc, r1, lb) ASM_END
+        JCC2(bltzc, bgezc, r1, lb)
 
 #define ZJ7(r1, lb)                                                         \
-        ASM_BEG ASM_OP2(blezc, r1, lb) ASM_END
+        JCC2(blezc, bgtzc, r1, lb)
 
 #define ZJ8(r1, lb)                                                         \
-        ASM_BEG ASM_OP2(bgtzc, r1, lb) ASM_END
+        JCC2(bgtzc, blezc, r1, lb)
 
 #define ZJ9(r1, lb)                                                         \
-        ASM_BEG ASM_OP2(bgezc, r1, lb) ASM_END
+        JCC2(bgezc, bltzc, r1, lb)
 
 #define CMZ(cc, r1, lb)                                                     \
         Z##cc(r1, lb)
@@ -2552,34 +2830,34 @@
 
 
 #define RJ0(r1, r2, lb)                                                     \
-        ASM_BEG ASM_OP3(beqc,  r1, r2, lb) ASM_END
+        JCC3(beqc, bnec, r1, r2, lb)
 
 #define RJ1(r1, r2, lb)                                                     \
-        ASM_BEG ASM_OP3(bnec,  r1, r2, lb) ASM_END
+        JCC3(bnec, beqc, r1, r2, lb)
 
 #define RJ2(r1, r2, lb)                                                     \
-        ASM_BEG ASM_OP3(bltuc, r1, r2, lb) ASM_END
+        JCC3(bltuc, bgeuc, r1, r2, lb)
 
 #define RJ3(r1, r2, lb)                                                     \
-        ASM_BEG ASM_OP3(bgeuc, r2, r1, lb) ASM_END
+        JCC3(bgeuc, bltuc, r2, r1, lb)
 
 #define RJ4(r1, r2, lb)                                                     \
-        ASM_BEG ASM_OP3(bltuc, r2, r1, lb) ASM_END
+        JCC3(bltuc, bgeuc, r2, r1, lb)
 
 #define RJ5(r1, r2, lb)                                                     \
-        ASM_BEG ASM_OP3(bgeuc, r1, r2, lb) ASM_END
+        JCC3(bgeuc, bltuc, r1, r2, lb)
 
 #define RJ6(r1, r2, lb)                                                     \
-        ASM_BEG ASM_OP3(bltc,  r1, r2, lb) ASM_END
+        JCC3(bltc, bgec, r1, r2, lb)
 
 #define RJ7(r1, r2, lb)                                                     \
-        ASM_BEG ASM_OP3(bgec,  r2, r1, lb) ASM_END
+        JCC3(bgec, bltc, r2, r1, lb)
 
 #define RJ8(r1, r2, lb)                                                     \
-        ASM_BEG ASM_OP3(bltc,  r2, r1, lb) ASM_END
+        JCC3(bltc, bgec, r2, r1, lb)
 
 #define RJ9(r1, r2, lb)                                                     \
-        ASM_BEG ASM_OP3(bgec,  r1, r2, lb) ASM_END
+        JCC3(bgec, bltc, r1, r2, lb)
 
 #define CMR(cc, r1, r2, lb)                                                 \
         R##cc(r1, r2, lb)
@@ -284,6 +284,15 @@
     SHF(EMITW(0x78000026 | MFM(TmmM,    MOD(MD), VAL(DD), B4(DD), F2(DD)))) \
     SHX(EMITW(0x78000026 | MFM(REG(XS), MOD(MD), VAL(DD), B4(DD), F2(DD))))
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment
+ * native SIMD load/store doesn't require alignment on this target */
+
+#define muvix_ld(XD, MS, DS)                                                \
+        movix_ld(W(XD), W(MS), W(DS))
+
+#define muvix_st(XS, MD, DD)                                                \
+        movix_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -304,6 +313,58 @@
     SHF(EMITW(0x7AB10002 | MXM(TmmM,    TmmM,    0x00)))                    \
         EMITW(0x78000026 | MFM(TmmM,    MOD(MG), VAL(DG), B4(DG), F2(DG)))
 
+/* unl (G = G unpack-low S), (D = S unpack-low T) if (#D != #T)
+ * interleaves lower halves of each 128-bit lane, S-elements go first */
+
+#define unlix_rr(XG, XS)                                                    \
+        unlix3rr(W(XG), W(XG), W(XS))
+
+#define unlix_ld(XG, MS, DS)                                                \
+        unlix3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define unlix3rr(XD, XS, XT)                                                \
+    SBF(EMITW(0x7AB10002 | MXM(TmmM,    REG(XT), 0x00)))                    \
+    SBF(EMITW(0x7AB10002 | MXM(REG(XD), REG(XS), 0x00)))                    \
+    SBF(EMITW(0x7AC00014 | MXM(REG(XD), TmmM,    REG(XD))))                 \
+    SBF(EMITW(0x7AB10002 | MXM(REG(XD), REG(XD), 0x00)))                    \
+    SBX(EMITW(0x7AC00014 | MXM(REG(XD), REG(XT), REG(XS))))
+
+#define unlix3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        EMITW(0x78000022 | MFM(TmmM,    MOD(MT), VAL(DT), B4(DT), F2(DT)))  \
+    SHF(EMITW(0x7AB10002 | MXM(TmmM,    TmmM,    0x00)))                    \
+    SBF(EMITW(0x7AB10002 | MXM(TmmM,    TmmM,    0x00)))                    \
+    SBF(EMITW(0x7AB10002 | MXM(REG(XD), REG(XS), 0x00)))                    \
+    SBF(EMITW(0x7AC00014 | MXM(REG(XD), TmmM,    REG(XD))))                 \
+    SBF(EMITW(0x7AB10002 | MXM(REG(XD), REG(XD), 0x00)))                    \
+    SBX(EMITW(0x7AC00014 | MXM(REG(XD), TmmM,    REG(XS))))
+
+/* unh (G = G unpack-high S), (D = S unpack-high T) if (#D != #T)
+ * interleaves upper halves of each 128-bit lane, S-elements go first */
+
+#define unhix_rr(XG, XS)                                                    \
+        unhix3rr(W(XG), W(XG), W(XS))
+
+#define unhix_ld(XG, MS, DS)                                                \
+        unhix3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define unhix3rr(XD, XS, XT)                                                \
+    SBF(EMITW(0x7AB10002 | MXM(TmmM,    REG(XT), 0x00)))                    \
+    SBF(EMITW(0x7AB10002 | MXM(REG(XD), REG(XS), 0x00)))                    \
+    SBF(EMITW(0x7A400014 | MXM(REG(XD), TmmM,    REG(XD))))                 \
+    SBF(EMITW(0x7AB10002 | MXM(REG(XD), REG(XD), 0x00)))                    \
+    SBX(EMITW(0x7A400014 | MXM(REG(XD), REG(XT), REG(XS))))
+
+#define unhix3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        EMITW(0x78000022 | MFM(TmmM,    MOD(MT), VAL(DT), B4(DT), F2(DT)))  \
+    SHF(EMITW(0x7AB10002 | MXM(TmmM,    TmmM,    0x00)))                    \
+    SBF(EMITW(0x7AB10002 | MXM(TmmM,    TmmM,    0x00)))                    \
+    SBF(EMITW(0x7AB10002 | MXM(REG(XD), REG(XS), 0x00)))                    \
+    SBF(EMITW(0x7A400014 | MXM(REG(XD), TmmM,    REG(XD))))                 \
+    SBF(EMITW(0x7AB10002 | MXM(REG(XD), REG(XD), 0x00)))                    \
+    SBX(EMITW(0x7A400014 | MXM(REG(XD), TmmM,    REG(XS))))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andix_rr(XG, XS)                                                    \
@@ -723,10 +784,10 @@
 #define S1(mask)    S##mask
 
 #define SMN32_128(xs, lb) /* not portable, do not use outside */            \
-        ASM_BEG ASM_OP2( bz.v, xs, lb) ASM_END
+        JCC2(bz.v, bnz.v, xs, lb)
 
 #define SMF32_128(xs, lb) /* not portable, do not use outside */            \
-        ASM_BEG ASM_OP2(bnz.w, xs, lb) ASM_END
+        JCC2(bnz.w, bz.w, xs, lb)
 
 #define mkjix_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
         AUW(EMPTY, EMPTY, EMPTY, MOD(XS), lb,                               \
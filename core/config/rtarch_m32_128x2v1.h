@@ -169,6 +169,15 @@
     SJF(EMITW(0x78000026 | MFM(TmmM,    MOD(MD), VYL(DD), B4(DD), K2(DD)))) \
     SJX(EMITW(0x78000026 | MFM(RYG(XS), MOD(MD), VYL(DD), B4(DD), K2(DD))))
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment
+ * native SIMD load/store doesn't require alignment on this target */
+
+#define muvcx_ld(XD, MS, DS)                                                \
+        movcx_ld(W(XD), W(MS), W(DS))
+
+#define muvcx_st(XS, MD, DD)                                                \
+        movcx_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -695,11 +704,11 @@
 
 #define SMN32_256(xs, lb) /* not portable, do not use outside */            \
         EMITW(0x7820001E | MXM(TmmM, xs, xs+16))                            \
-        ASM_BEG ASM_OP2( bz.v, $w31, lb) ASM_END
+        JCC2(bz.v, bnz.v, $w31, lb)
 
 #define SMF32_256(xs, lb) /* not portable, do not use outside */            \
         EMITW(0x7800001E | MXM(TmmM, xs, xs+16))                            \
-        ASM_BEG ASM_OP2(bnz.w, $w31, lb) ASM_END
+        JCC2(bnz.w, bz.w, $w31, lb)
 
 #define mkjcx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
         AUW(EMPTY, EMPTY, EMPTY, REG(XS), lb,                               \
@@ -1162,6 +1162,30 @@
 #define mulzp_xm(MS, DS) /* Reax is in/out, prepares Redx for divzn_x* */   \
         mulzx_ld(Reax, W(MS), W(DS))  /* must not exceed operands size */
 
+/* mhi (G = G * S >> 64), high half of full 64x64-bit product
+ * set-flags: undefined
+ * low half is given by mulzx_**, both halves at once by mulz*_x* */
+
+#define mhizx_rr(RG, RS)                                                    \
+        EMITW(0x0000001D | MRM(0x00,    REG(RG), REG(RS)))                  \
+        EMITW(0x00000010 | MRM(REG(RG), 0x00,    0x00))
+
+#define mhizx_ld(RG, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0xDC000000 | MDM(TMxx,    MOD(MS), VAL(DS), B3(DS), P1(DS)))  \
+        EMITW(0x0000001D | MRM(0x00,    REG(RG), TMxx))                     \
+        EMITW(0x00000010 | MRM(REG(RG), 0x00,    0x00))
+
+#define mhizn_rr(RG, RS)                                                    \
+        EMITW(0x0000001C | MRM(0x00,    REG(RG), REG(RS)))                  \
+        EMITW(0x00000010 | MRM(REG(RG), 0x00,    0x00))
+
+#define mhizn_ld(RG, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0xDC000000 | MDM(TMxx,    MOD(MS), VAL(DS), B3(DS), P1(DS)))  \
+        EMITW(0x0000001C | MRM(0x00,    REG(RG), TMxx))                     \
+        EMITW(0x00000010 | MRM(REG(RG), 0x00,    0x00))
+
 /* div (G = G / S)
  * set-flags: undefined */
 
@@ -1344,6 +1368,26 @@
 #define mulzp_xm(MS, DS) /* Reax is in/out, prepares Redx for divzn_x* */   \
         mulzx_ld(Reax, W(MS), W(DS))  /* must not exceed operands size */
 
+/* mhi (G = G * S >> 64), high half of full 64x64-bit product
+ * set-flags: undefined
+ * low half is given by mulzx_**, both halves at once by mulz*_x* */
+
+#define mhizx_rr(RG, RS)                                                    \
+        EMITW(0x000000DD | MRM(REG(RG), REG(RG), REG(RS)))
+
+#define mhizx_ld(RG, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0xDC000000 | MDM(TMxx,    MOD(MS), VAL(DS), B3(DS), P1(DS)))  \
+        EMITW(0x000000DD | MRM(REG(RG), REG(RG), TMxx))
+
+#define mhizn_rr(RG, RS)                                                    \
+        EMITW(0x000000DC | MRM(REG(RG), REG(RG), REG(RS)))
+
+#define mhizn_ld(RG, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0xDC000000 | MDM(TMxx,    MOD(MS), VAL(DS), B3(DS), P1(DS)))  \
+        EMITW(0x000000DC | MRM(REG(RG), REG(RG), TMxx))
+
 /* div (G = G / S)
  * set-flags: undefined */
 
@@ -1595,6 +1639,151 @@
         EMITW(0x9C000000 | MDM(TLxx,    MOD(MS), VAL(DS), B3(DS), P1(DS)))  \
         EMITW(0x00000025 | MRM(TRxx,    REG(RT), TZxx))
 
+/* xad (G = M, M = M + G), atomic fetch-add
+ * set-flags: undefined
+ * xad, xch, cas need natural alignment of memory args
+ * and are sequentially consistent (act as full memory barriers) */
+
+#define xadzx_st(RG, MG, DG)                                                \
+        AUW(SIB(MG),  EMPTY,  EMPTY,    MOD(MG), VAL(DG), C3(DG), EMPTY2)   \
+        EMITW(0x00000021 | MRM(TDxx,    MOD(MG), TDxx) | ADR)               \
+        EMITW(0x0000000F)                  /* <- sync */                    \
+        EMITW(LLZ | MTM(TMxx,    TDxx,    0x00))                            \
+        EMITW(0x0000002D | MRM(TIxx,    TMxx,    REG(RG)))                  \
+        EMITW(SCZ | MTM(TIxx,    TDxx,    0x00))                            \
+        EMITW(0x1000FFFC | MRM(0x00,    TIxx,    TZxx))                     \
+        EMITW(0x00000000)                  /* <- nop (delay slot) */        \
+        EMITW(0x0000000F)                  /* <- sync */                    \
+        EMITW(0x00000025 | MRM(REG(RG), TMxx,    TZxx))
+
+/* xch (G = M, M = G), atomic exchange
+ * set-flags: undefined */
+
+#define xchzx_st(RG, MG, DG)                                                \
+        AUW(SIB(MG),  EMPTY,  EMPTY,    MOD(MG), VAL(DG), C3(DG), EMPTY2)   \
+        EMITW(0x00000021 | MRM(TDxx,    MOD(MG), TDxx) | ADR)               \
+        EMITW(0x0000000F)                  /* <- sync */                    \
+        EMITW(LLZ | MTM(TMxx,    TDxx,    0x00))                            \
+        EMITW(0x00000025 | MRM(TIxx,    REG(RG), TZxx))                     \
+        EMITW(SCZ | MTM(TIxx,    TDxx,    0x00))                            \
+        EMITW(0x1000FFFC | MRM(0x00,    TIxx,    TZxx))                     \
+        EMITW(0x00000000)                  /* <- nop (delay slot) */        \
+        EMITW(0x0000000F)                  /* <- sync */                    \
+        EMITW(0x00000025 | MRM(REG(RG), TMxx,    TZxx))
+
+/* cas (if M == Reax then M = S, Reax = M), atomic compare-and-swap
+ * set-flags: undefined
+ * success is checked by comparing Reax to its value before cas */
+
+#define caszx_st(RS, MG, DG)     /* Reax is in/out, RS, MG != Reax */       \
+        AUW(SIB(MG),  EMPTY,  EMPTY,    MOD(MG), VAL(DG), C3(DG), EMPTY2)   \
+        EMITW(0x00000021 | MRM(TDxx,    MOD(MG), TDxx) | ADR)               \
+        EMITW(0x0000000F)                  /* <- sync */                    \
+        EMITW(LLZ | MTM(TMxx,    TDxx,    0x00))                            \
+        EMITW(0x14000004 | MRM(0x00,    TMxx,    Teax))                     \
+        EMITW(0x00000025 | MRM(TIxx,    REG(RS), TZxx))                     \
+        EMITW(SCZ | MTM(TIxx,    TDxx,    0x00))                            \
+        EMITW(0x1000FFFB | MRM(0x00,    TIxx,    TZxx))                     \
+        EMITW(0x00000000)                  /* <- nop (delay slot) */        \
+        EMITW(0x0000000F)                  /* <- sync */                    \
+        EMITW(0x00000025 | MRM(Teax,    TMxx,    TZxx))
+
+/* cnt (D = number of set bits in S), population count
+ * set-flags: undefined */
+
+#define cntzx_rr(RD, RS)                                                    \
+        EMITW(0x0000003A | MSM(TMxx,    REG(RS), 0x00) | 1 << 6)            \
+        EMITW(0x3C005555 | MTM(TIxx,    0x00,    0x00))                     \
+        EMITW(0x34005555 | MTM(TIxx,    TIxx,    0x00))                     \
+        EMITW(0x0000003C | MSM(TDxx,    TIxx,    0x00))                     \
+        EMITW(0x00000025 | MRM(TIxx,    TIxx,    TDxx))                     \
+        EMITW(0x00000024 | MRM(TMxx,    TMxx,    TIxx))                     \
+        EMITW(0x0000002F | MRM(REG(RD), REG(RS), TMxx))                     \
+        EMITW(0x0000003A | MSM(TMxx,    REG(RD), 0x00) | 2 << 6)            \
+        EMITW(0x3C003333 | MTM(TIxx,    0x00,    0x00))                     \
+        EMITW(0x34003333 | MTM(TIxx,    TIxx,    0x00))                     \
+        EMITW(0x0000003C | MSM(TDxx,    TIxx,    0x00))                     \
+        EMITW(0x00000025 | MRM(TIxx,    TIxx,    TDxx))                     \
+        EMITW(0x00000024 | MRM(TMxx,    TMxx,    TIxx))                     \
+        EMITW(0x00000024 | MRM(REG(RD), REG(RD), TIxx))                     \
+        EMITW(0x0000002D | MRM(REG(RD), REG(RD), TMxx))                     \
+        EMITW(0x0000003A | MSM(TMxx,    REG(RD), 0x00) | 4 << 6)            \
+        EMITW(0x0000002D | MRM(REG(RD), REG(RD), TMxx))                     \
+        EMITW(0x3C000F0F | MTM(TIxx,    0x00,    0x00))                     \
+        EMITW(0x34000F0F | MTM(TIxx,    TIxx,    0x00))                     \
+        EMITW(0x0000003C | MSM(TDxx,    TIxx,    0x00))                     \
+        EMITW(0x00000025 | MRM(TIxx,    TIxx,    TDxx))                     \
+        EMITW(0x00000024 | MRM(REG(RD), REG(RD), TIxx))                     \
+        EMITW(0x00000038 | MSM(TMxx,    REG(RD), 0x00) | 8 << 6)            \
+        EMITW(0x0000002D | MRM(REG(RD), REG(RD), TMxx))                     \
+        EMITW(0x00000038 | MSM(TMxx,    REG(RD), 0x00) | 16 << 6)           \
+        EMITW(0x0000002D | MRM(REG(RD), REG(RD), TMxx))                     \
+        EMITW(0x0000003C | MSM(TMxx,    REG(RD), 0x00))                     \
+        EMITW(0x0000002D | MRM(REG(RD), REG(RD), TMxx))                     \
+        EMITW(0x0000003E | MSM(REG(RD), REG(RD), 0x00) | 24 << 6)
+
+/* clz (D = number of leading zeros in S)
+ * set-flags: undefined
+ * clz, ctz return operand size in bits for zero source */
+
+#if (RT_BASE_COMPAT_REV < 6) /* pre-r6 */
+
+#define clzzx_rr(RD, RS)                                                    \
+        EMITW(0x70000024 | MRM(REG(RD), REG(RS), REG(RD)))
+
+#else /* RT_BASE_COMPAT_REV >= 6 : r6 */
+
+#define clzzx_rr(RD, RS)                                                    \
+        EMITW(0x00000052 | MRM(REG(RD), REG(RS), 0x00))
+
+#endif /* RT_BASE_COMPAT_REV >= 6 : r6 */
+
+/* ctz (D = number of trailing zeros in S)
+ * set-flags: undefined */
+
+#if (RT_BASE_COMPAT_REV < 6) /* pre-r6 */
+
+#define ctzzx_rr(RD, RS)                                                    \
+        EMITW(0x6400FFFF | MTM(TMxx,    REG(RS), 0x00))  /* <- S - 1 */     \
+        EMITW(0x00000027 | MRM(TIxx,    REG(RS), 0x00))                     \
+        EMITW(0x00000024 | MRM(TMxx,    TMxx,    TIxx))                     \
+        EMITW(0x70000024 | MRM(REG(RD), TMxx,    REG(RD)))                  \
+        EMITW(0x64000040 | MTM(TIxx,    0x00,    0x00))                     \
+        EMITW(0x0000002F | MRM(REG(RD), TIxx,    REG(RD)))
+
+#else /* RT_BASE_COMPAT_REV >= 6 : r6 */
+
+#define ctzzx_rr(RD, RS)                                                    \
+        EMITW(0x6400FFFF | MTM(TMxx,    REG(RS), 0x00))  /* <- S - 1 */     \
+        EMITW(0x00000027 | MRM(TIxx,    REG(RS), 0x00))                     \
+        EMITW(0x00000024 | MRM(TMxx,    TMxx,    TIxx))                     \
+        EMITW(0x00000052 | MRM(REG(RD), TMxx,    0x00))                     \
+        EMITW(0x64000040 | MTM(TIxx,    0x00,    0x00))                     \
+        EMITW(0x0000002F | MRM(REG(RD), TIxx,    REG(RD)))
+
+#endif /* RT_BASE_COMPAT_REV >= 6 : r6 */
+
+/* bsw (D = S with bytes in reversed order), byte swap
+ * set-flags: undefined */
+
+#define bswzx_rr(RD, RS)                                                    \
+        EMITW(0x7C0000A4 | MSM(REG(RD), REG(RS), 0x00))                     \
+        EMITW(0x7C000164 | MSM(REG(RD), REG(RD), 0x00))
+
+/* bfx (G = G >> IS & ((1 << IT) - 1)), unsigned bit-field extract
+ * set-flags: undefined
+ * IT > 0, IS + IT <= 64 */
+
+#define bfxzx_ri(RG, IS, IT)                                                \
+        EMITW(0x00000000 | MSM(REG(RG), REG(RG), 0x00) |                    \
+        (M((64-VAL(IS)-VAL(IT)) < 32) & (0x00000038 |                       \
+                                  (0x1F & (64-VAL(IS)-VAL(IT))) << 6)) |    \
+        (M((64-VAL(IS)-VAL(IT)) > 31) & (0x0000003C |                       \
+                                  (0x1F & (64-VAL(IS)-VAL(IT))) << 6)))     \
+        EMITW(0x00000000 | MSM(REG(RG), REG(RG), 0x00) |                    \
+        (M((64-VAL(IT)) < 32) & (0x0000003A | (0x1F & (64-VAL(IT))) << 6))| \
+        (M((64-VAL(IT)) > 31) & (0x0000003E | (0x1F & (64-VAL(IT))) << 6)))
+
 /* ver (Mebp/inf_VER = SIMD-version)
  * set-flags: no
  * For interpretation of SIMD build flags check compatibility layer in rtzero.h
@@ -1624,7 +1813,10 @@
  * maximum byte-address-range for un/conditional jumps is signed 18/16-bit
  * based on minimum natively-encoded offset across supported targets (u/c)
  * MIPS:18-bit, POWER:26-bit, AArch32:26-bit, AArch64:28-bit, x86:32-bit /
- * MIPS:18-bit, POWER:16-bit, AArch32:26-bit, AArch64:21-bit, x86:32-bit */
+ * MIPS:18-bit, POWER:16-bit, AArch32:26-bit, AArch64:21-bit, x86:32-bit
+ * RT_BASE_COMPAT_FAR (rtarch.h) extends MIPS u/c jumps to 28-bit bc (r6)
+ * or j within 256MB region (pre-r6), conditional jumps via inverted branch
+ * over unconditional jump (label 0 reserved) */
 
      /* jccxx_** is defined in 32-bit rtarch_***.h files */
 
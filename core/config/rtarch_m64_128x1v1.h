@@ -153,6 +153,15 @@
         AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), A2(DD), EMPTY2)   \
         EMITW(0x78000027 | MPM(REG(XS), MOD(MD), VAL(DD), B4(DD), P2(DD)))
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment
+ * native SIMD load/store doesn't require alignment on this target */
+
+#define muvjx_ld(XD, MS, DS)                                                \
+        movjx_ld(W(XD), W(MS), W(DS))
+
+#define muvjx_st(XS, MD, DD)                                                \
+        movjx_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -170,6 +179,40 @@
         EMITW(0x7880001E | MXM(TmmM,    REG(XS), Tmm0))                     \
         EMITW(0x78000027 | MPM(TmmM,    MOD(MG), VAL(DG), B4(DG), P2(DG)))
 
+/* unl (G = G unpack-low S), (D = S unpack-low T) if (#D != #T)
+ * interleaves lower halves of each 128-bit lane, S-elements go first */
+
+#define unljx_rr(XG, XS)                                                    \
+        unljx3rr(W(XG), W(XG), W(XS))
+
+#define unljx_ld(XG, MS, DS)                                                \
+        unljx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define unljx3rr(XD, XS, XT)                                                \
+        EMITW(0x7AE00014 | MXM(REG(XD), REG(XT), REG(XS)))
+
+#define unljx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), P2(DT)))  \
+        EMITW(0x7AE00014 | MXM(REG(XD), TmmM,    REG(XS)))
+
+/* unh (G = G unpack-high S), (D = S unpack-high T) if (#D != #T)
+ * interleaves upper halves of each 128-bit lane, S-elements go first */
+
+#define unhjx_rr(XG, XS)                                                    \
+        unhjx3rr(W(XG), W(XG), W(XS))
+
+#define unhjx_ld(XG, MS, DS)                                                \
+        unhjx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define unhjx3rr(XD, XS, XT)                                                \
+        EMITW(0x7A600014 | MXM(REG(XD), REG(XT), REG(XS)))
+
+#define unhjx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), P2(DT)))  \
+        EMITW(0x7A600014 | MXM(REG(XD), TmmM,    REG(XS)))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andjx_rr(XG, XS)                                                    \
@@ -569,10 +612,10 @@
 /* #define S1(mask)    S##mask             (defined in 32_128-bit header) */
 
 #define SMN64_128(xs, lb) /* not portable, do not use outside */            \
-        ASM_BEG ASM_OP2( bz.v, xs, lb) ASM_END
+        JCC2(bz.v, bnz.v, xs, lb)
 
 #define SMF64_128(xs, lb) /* not portable, do not use outside */            \
-        ASM_BEG ASM_OP2(bnz.w, xs, lb) ASM_END
+        JCC2(bnz.w, bz.w, xs, lb)
 
 #define mkjjx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
         AUW(EMPTY, EMPTY, EMPTY, MOD(XS), lb,                               \
@@ -746,6 +789,31 @@
         EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), P2(DT)))  \
         EMITW(0x7860000E | MXM(REG(XD), REG(XS), TmmM))
 
+/* mlw (G = G[31:0] * S[31:0]), (D = S[31:0] * T[31:0]) if (#D != #T)
+ * unsigned 32x32 to 64-bit product of lower halves of 64-bit elements */
+
+#define mlwjx_rr(XG, XS)                                                    \
+        mlwjx3rr(W(XG), W(XG), W(XS))
+
+#define mlwjx_ld(XG, MS, DS)                                                \
+        mlwjx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define mlwjx3rr(XD, XS, XT)                                                \
+        EMITW(0x78200009 | MXM(TmmM,    REG(XT), 0x00))                     \
+        EMITW(0x79200009 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x78200009 | MXM(REG(XD), REG(XS), 0x00))                     \
+        EMITW(0x79200009 | MXM(REG(XD), REG(XD), 0x00))                     \
+        EMITW(0x78600012 | MXM(REG(XD), REG(XD), TmmM))
+
+#define mlwjx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), P2(DT)))  \
+        EMITW(0x78200009 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x79200009 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x78200009 | MXM(REG(XD), REG(XS), 0x00))                     \
+        EMITW(0x79200009 | MXM(REG(XD), REG(XD), 0x00))                     \
+        EMITW(0x78600012 | MXM(REG(XD), REG(XD), TmmM))
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subjx_rr(XG, XS)                                                    \
@@ -156,6 +156,15 @@
         EMITW(0x78000027 | MPM(REG(XS), MOD(MD), VAL(DD), B4(DD), L2(DD)))  \
         EMITW(0x78000027 | MPM(RYG(XS), MOD(MD), VYL(DD), B4(DD), L2(DD)))
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment
+ * native SIMD load/store doesn't require alignment on this target */
+
+#define muvdx_ld(XD, MS, DS)                                                \
+        movdx_ld(W(XD), W(MS), W(DS))
+
+#define muvdx_st(XS, MD, DD)                                                \
+        movdx_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -638,11 +647,11 @@
 
 #define SMN64_256(xs, lb) /* not portable, do not use outside */            \
         EMITW(0x7820001E | MXM(TmmM, xs, xs+16))                            \
-        ASM_BEG ASM_OP2( bz.v, $w31, lb) ASM_END
+        JCC2(bz.v, bnz.v, $w31, lb)
 
 #define SMF64_256(xs, lb) /* not portable, do not use outside */            \
         EMITW(0x7800001E | MXM(TmmM, xs, xs+16))                            \
-        ASM_BEG ASM_OP2(bnz.w, $w31, lb) ASM_END
+        JCC2(bnz.w, bz.w, $w31, lb)
 
 #define mkjdx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
         AUW(EMPTY, EMPTY, EMPTY, REG(XS), lb,                               \
@@ -831,6 +840,46 @@
         EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
         EMITW(0x7860000E | MXM(RYG(XD), RYG(XS), TmmM))
 
+/* mlw (G = G[31:0] * S[31:0]), (D = S[31:0] * T[31:0]) if (#D != #T)
+ * unsigned 32x32 to 64-bit product of lower halves of 64-bit elements */
+
+#undef  mlwdx_rr
+#define mlwdx_rr(XG, XS)                                                    \
+        mlwdx3rr(W(XG), W(XG), W(XS))
+
+#undef  mlwdx_ld
+#define mlwdx_ld(XG, MS, DS)                                                \
+        mlwdx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#undef  mlwdx3rr
+#define mlwdx3rr(XD, XS, XT)                                                \
+        EMITW(0x78200009 | MXM(TmmM,    REG(XT), 0x00))                     \
+        EMITW(0x79200009 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x78200009 | MXM(REG(XD), REG(XS), 0x00))                     \
+        EMITW(0x79200009 | MXM(REG(XD), REG(XD), 0x00))                     \
+        EMITW(0x78600012 | MXM(REG(XD), REG(XD), TmmM))                     \
+        EMITW(0x78200009 | MXM(TmmM,    RYG(XT), 0x00))                     \
+        EMITW(0x79200009 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x78200009 | MXM(RYG(XD), RYG(XS), 0x00))                     \
+        EMITW(0x79200009 | MXM(RYG(XD), RYG(XD), 0x00))                     \
+        EMITW(0x78600012 | MXM(RYG(XD), RYG(XD), TmmM))
+
+#undef  mlwdx3ld
+#define mlwdx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x78200009 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x79200009 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x78200009 | MXM(REG(XD), REG(XS), 0x00))                     \
+        EMITW(0x79200009 | MXM(REG(XD), REG(XD), 0x00))                     \
+        EMITW(0x78600012 | MXM(REG(XD), REG(XD), TmmM))                     \
+        EMITW(0x78000023 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+        EMITW(0x78200009 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x79200009 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x78200009 | MXM(RYG(XD), RYG(XS), 0x00))                     \
+        EMITW(0x79200009 | MXM(RYG(XD), RYG(XD), 0x00))                     \
+        EMITW(0x78600012 | MXM(RYG(XD), RYG(XD), TmmM))
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subdx_rr(XG, XS)                                                    \
@@ -140,6 +140,15 @@
         AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), A2(DD), EMPTY2)   \
         EMITW(0x78000027 | MPM(REG(XS), MOD(MD), VAL(DD), B4(DD), P2(DD)))
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment
+ * native SIMD load/store doesn't require alignment on this target */
+
+#define muvgx_ld(XD, MS, DS)                                                \
+        movgx_ld(W(XD), W(MS), W(DS))
+
+#define muvgx_st(XS, MD, DD)                                                \
+        movgx_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -706,10 +715,10 @@
 /* #define S1(mask)    S##mask             (defined in 32_128-bit header) */
 
 #define SMN16_128(xs, lb) /* not portable, do not use outside */            \
-        ASM_BEG ASM_OP2( bz.v, xs, lb) ASM_END
+        JCC2(bz.v, bnz.v, xs, lb)
 
 #define SMF16_128(xs, lb) /* not portable, do not use outside */            \
-        ASM_BEG ASM_OP2(bnz.h, xs, lb) ASM_END
+        JCC2(bnz.h, bz.h, xs, lb)
 
 #define mkjgx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
         AUW(EMPTY, EMPTY, EMPTY, MOD(XS), lb,                               \
@@ -1193,10 +1202,10 @@
 /* #define S1(mask)    S##mask             (defined in 32_128-bit header) */
 
 #define SMN08_128(xs, lb) /* not portable, do not use outside */            \
-        ASM_BEG ASM_OP2( bz.v, xs, lb) ASM_END
+        JCC2(bz.v, bnz.v, xs, lb)
 
 #define SMF08_128(xs, lb) /* not portable, do not use outside */            \
-        ASM_BEG ASM_OP2(bnz.b, xs, lb) ASM_END
+        JCC2(bnz.b, bz.b, xs, lb)
 
 #define mkjgb_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
         AUW(EMPTY, EMPTY, EMPTY, MOD(XS), lb,                               \
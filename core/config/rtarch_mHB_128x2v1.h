@@ -143,6 +143,15 @@
         EMITW(0x78000027 | MPM(REG(XS), MOD(MD), VAL(DD), B4(DD), L2(DD)))  \
         EMITW(0x78000027 | MPM(RYG(XS), MOD(MD), VYL(DD), B4(DD), L2(DD)))
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment
+ * native SIMD load/store doesn't require alignment on this target */
+
+#define muvax_ld(XD, MS, DS)                                                \
+        movax_ld(W(XD), W(MS), W(DS))
+
+#define muvax_st(XS, MD, DD)                                                \
+        movax_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -807,11 +816,11 @@
 
 #define SMN16_256(xs, lb) /* not portable, do not use outside */            \
         EMITW(0x7820001E | MXM(TmmM, xs, xs+16))                            \
-        ASM_BEG ASM_OP2( bz.v, $w31, lb) ASM_END
+        JCC2(bz.v, bnz.v, $w31, lb)
 
 #define SMF16_256(xs, lb) /* not portable, do not use outside */            \
         EMITW(0x7800001E | MXM(TmmM, xs, xs+16))                            \
-        ASM_BEG ASM_OP2(bnz.h, $w31, lb) ASM_END
+        JCC2(bnz.h, bz.h, $w31, lb)
 
 #define mkjax_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
         AUW(EMPTY, EMPTY, EMPTY, REG(XS), lb,                               \
@@ -1380,11 +1389,11 @@
 
 #define SMN08_256(xs, lb) /* not portable, do not use outside */            \
         EMITW(0x7820001E | MXM(TmmM, xs, xs+16))                            \
-        ASM_BEG ASM_OP2( bz.v, $w31, lb) ASM_END
+        JCC2(bz.v, bnz.v, $w31, lb)
 
 #define SMF08_256(xs, lb) /* not portable, do not use outside */            \
         EMITW(0x7800001E | MXM(TmmM, xs, xs+16))                            \
-        ASM_BEG ASM_OP2(bnz.b, $w31, lb) ASM_END
+        JCC2(bnz.b, bz.b, $w31, lb)
 
 #define mkjab_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
         AUW(EMPTY, EMPTY, EMPTY, REG(XS), lb,                               \
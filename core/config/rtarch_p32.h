@@ -1891,6 +1891,26 @@
 #define mulwp_xm(MS, DS) /* Reax is in/out, prepares Redx for divwn_x* */   \
         mulwx_ld(Reax, W(MS), W(DS))  /* must not exceed operands size */
 
+/* mhi (G = G * S >> 32), high half of full 32x32-bit product
+ * set-flags: undefined
+ * low half is given by mulwx_**, both halves at once by mulw*_x* */
+
+#define mhiwx_rr(RG, RS)                                                    \
+        EMITW(0x7C000016 | MRM(REG(RG), REG(RG), REG(RS)))
+
+#define mhiwx_ld(RG, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C1(DS), EMPTY2)   \
+        EMITW(0x00000000 | MDM(TMxx,    MOD(MS), VAL(DS), B1(DS), P1(DS)))  \
+        EMITW(0x7C000016 | MRM(REG(RG), REG(RG), TMxx))
+
+#define mhiwn_rr(RG, RS)                                                    \
+        EMITW(0x7C000096 | MRM(REG(RG), REG(RG), REG(RS)))
+
+#define mhiwn_ld(RG, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C1(DS), EMPTY2)   \
+        EMITW(0x00000000 | MDM(TMxx,    MOD(MS), VAL(DS), B1(DS), P1(DS)))  \
+        EMITW(0x7C000096 | MRM(REG(RG), REG(RG), TMxx))
+
 /* div (G = G / S)
  * set-flags: undefined */
 
@@ -2280,6 +2300,110 @@
 
 #endif /* (defined RT_P32) */
 
+/* xad (G = M, M = M + G), atomic fetch-add
+ * set-flags: undefined
+ * xad, xch, cas need natural alignment of memory args
+ * and are sequentially consistent (act as full memory barriers) */
+
+#define xadwx_st(RG, MG, DG)                                                \
+        AUW(SIB(MG),  EMPTY,  EMPTY,    MOD(MG), VAL(DG), C3(DG), EMPTY2)   \
+        EMITW(0x7C0004AC)                  /* <- sync */                    \
+        EMITW(0x7C000028 | MTM(TMxx,    MOD(MG), TDxx))                     \
+        EMITW(0x7C000214 | MRM(TIxx,    TMxx,    REG(RG)))                  \
+        EMITW(0x7C00012D | MTM(TIxx,    MOD(MG), TDxx))                     \
+        EMITW(0x4082FFF4)                  /* <- bne- larx */               \
+        EMITW(0x4C00012C)                  /* <- isync */                   \
+        EMITW(0x7C000378 | MSM(REG(RG), TMxx,    TMxx))
+
+/* xch (G = M, M = G), atomic exchange
+ * set-flags: undefined */
+
+#define xchwx_st(RG, MG, DG)                                                \
+        AUW(SIB(MG),  EMPTY,  EMPTY,    MOD(MG), VAL(DG), C3(DG), EMPTY2)   \
+        EMITW(0x7C0004AC)                  /* <- sync */                    \
+        EMITW(0x7C000028 | MTM(TMxx,    MOD(MG), TDxx))                     \
+        EMITW(0x7C00012D | MTM(REG(RG), MOD(MG), TDxx))                     \
+        EMITW(0x4082FFF8)                  /* <- bne- larx */               \
+        EMITW(0x4C00012C)                  /* <- isync */                   \
+        EMITW(0x7C000378 | MSM(REG(RG), TMxx,    TMxx))
+
+/* cas (if M == Reax then M = S, Reax = M), atomic compare-and-swap
+ * set-flags: undefined
+ * success is checked by comparing Reax to its value before cas */
+
+#define caswx_st(RS, MG, DG)     /* Reax is in/out, RS, MG != Reax */       \
+        AUW(SIB(MG),  EMPTY,  EMPTY,    MOD(MG), VAL(DG), C3(DG), EMPTY2)   \
+        EMITW(0x7C0004AC)                  /* <- sync */                    \
+        EMITW(0x7C000028 | MTM(TMxx,    MOD(MG), TDxx))                     \
+        EMITW(0x7C000000 | MTM(0x00,    TMxx,    Teax))                     \
+        EMITW(0x4082000C)                  /* <- bne- isync */              \
+        EMITW(0x7C00012D | MTM(REG(RS), MOD(MG), TDxx))                     \
+        EMITW(0x4082FFF0)                  /* <- bne- larx */               \
+        EMITW(0x4C00012C)                  /* <- isync */                   \
+        EMITW(0x7C000378 | MSM(Teax,    TMxx,    TMxx))
+
+/* fen (memory-ordering fence)
+ * set-flags: no
+ * fenxx_aq - acquire: prior loads are ordered before subsequent loads/stores
+ * fenxx_rl - release: prior loads/stores are ordered before subsequent stores
+ * fenxx_sc - full: prior loads/stores are ordered before subsequent ones */
+
+#define fenxx_aq()                                                          \
+        EMITW(0x7C2004AC)                  /* <- lwsync */
+
+#define fenxx_rl()                                                          \
+        EMITW(0x7C2004AC)                  /* <- lwsync */
+
+#define fenxx_sc()                                                          \
+        EMITW(0x7C0004AC)                  /* <- sync */
+
+/* cnt (D = number of set bits in S), population count
+ * set-flags: undefined */
+
+#define cntwx_rr(RD, RS)                                                    \
+        EMITW(0x7C0002F4 | MSM(REG(RD), REG(RS), 0x00))
+
+/* clz (D = number of leading zeros in S)
+ * set-flags: undefined
+ * clz, ctz return operand size in bits for zero source */
+
+#define clzwx_rr(RD, RS)                                                    \
+        EMITW(0x7C000034 | MSM(REG(RD), REG(RS), 0x00))
+
+/* ctz (D = number of trailing zeros in S)
+ * set-flags: undefined */
+
+#if RT_BASE_COMPAT_REM == 0
+
+#define ctzwx_rr(RD, RS)                                                    \
+        EMITW(0x3800FFFF | MTM(TMxx,    REG(RS), 0x00))  /* <- S - 1 */     \
+        EMITW(0x7C000078 | MSM(TMxx,    TMxx,    REG(RS)))                  \
+        EMITW(0x7C0002F4 | MSM(REG(RD), TMxx,    0x00))
+
+#else /* RT_BASE_COMPAT_REM != 0 */
+
+#define ctzwx_rr(RD, RS)                                                    \
+        EMITW(0x7C000434 | MSM(REG(RD), REG(RS), 0x00))
+
+#endif /* RT_BASE_COMPAT_REM != 0 */
+
+/* bsw (D = S with bytes in reversed order), byte swap
+ * set-flags: undefined */
+
+#define bswwx_rr(RD, RS)                                                    \
+        EMITW(0x5400403E | MSM(TMxx,    REG(RS), 0x00))                     \
+        EMITW(0x5000C00E | MSM(TMxx,    REG(RS), 0x00))                     \
+        EMITW(0x5000C42E | MSM(TMxx,    REG(RS), 0x00))                     \
+        EMITW(0x7C000378 | MSM(REG(RD), TMxx,    TMxx))
+
+/* bfx (G = G >> IS & ((1 << IT) - 1)), unsigned bit-field extract
+ * set-flags: undefined
+ * IT > 0, IS + IT <= 32 */
+
+#define bfxwx_ri(RG, IS, IT)                                                \
+        EMITW(0x5400003E | MSM(REG(RG), REG(RG), 0x00) |                    \
+             ((32-VAL(IS)) & 0x1F) << 11 | ((32-VAL(IT)) & 0x1F) << 6)
+
 /* ver (Mebp/inf_VER = SIMD-version)
  * set-flags: no
  * For interpretation of SIMD build flags check compatibility layer in rtzero.h
@@ -2314,7 +2438,9 @@
  * maximum byte-address-range for un/conditional jumps is signed 18/16-bit
  * based on minimum natively-encoded offset across supported targets (u/c)
  * MIPS:18-bit, POWER:26-bit, AArch32:26-bit, AArch64:28-bit, x86:32-bit /
- * MIPS:18-bit, POWER:16-bit, AArch32:26-bit, AArch64:21-bit, x86:32-bit */
+ * MIPS:18-bit, POWER:16-bit, AArch32:26-bit, AArch64:21-bit, x86:32-bit
+ * RT_BASE_COMPAT_FAR (rtarch.h) extends POWER conditional jumps to 26-bit
+ * via inverted bc over unconditional b (label 0 reserved) */
 
 #define jmpxx_xr(RS)           /* register-targeted unconditional jump */   \
         EMITW(0x7C0003A6 | MRM(REG(RS), 0x00,    0x09)) /* ctr <- reg */    \
@@ -2330,50 +2456,50 @@
         ASM_BEG ASM_OP1(b, lb) ASM_END
 
 #define jezxx_lb(lb)               /* setting-flags-arithmetic -> jump */   \
-        ASM_BEG ASM_OP1(beq,   lb) ASM_END
+        JCC1(beq, bne, lb)
 
 #define jnzxx_lb(lb)               /* setting-flags-arithmetic -> jump */   \
-        ASM_BEG ASM_OP1(bne,   lb) ASM_END
+        JCC1(bne, beq, lb)
 
 #define jeqxx_lb(lb)                                /* compare -> jump */   \
         ASM_BEG ASM_OP2(cmplw, %%r24, %%r25) ASM_END                        \
-        ASM_BEG ASM_OP1(beq,   lb) ASM_END
+        JCC1(beq, bne, lb)
 
 #define jnexx_lb(lb)                                /* compare -> jump */   \
         ASM_BEG ASM_OP2(cmplw, %%r24, %%r25) ASM_END                        \
-        ASM_BEG ASM_OP1(bne,   lb) ASM_END
+        JCC1(bne, beq, lb)
 
 #define jltxx_lb(lb)                                /* compare -> jump */   \
         ASM_BEG ASM_OP2(cmplw, %%r24, %%r25) ASM_END                        \
-        ASM_BEG ASM_OP1(blt,   lb) ASM_END
+        JCC1(blt, bge, lb)
 
 #define jlexx_lb(lb)                                /* compare -> jump */   \
         ASM_BEG ASM_OP2(cmplw, %%r24, %%r25) ASM_END                        \
-        ASM_BEG ASM_OP1(ble,   lb) ASM_END
+        JCC1(ble, bgt, lb)
 
 #define jgtxx_lb(lb)                                /* compare -> jump */   \
         ASM_BEG ASM_OP2(cmplw, %%r24, %%r25) ASM_END                        \
-        ASM_BEG ASM_OP1(bgt,   lb) ASM_END
+        JCC1(bgt, ble, lb)
 
 #define jgexx_lb(lb)                                /* compare -> jump */   \
         ASM_BEG ASM_OP2(cmplw, %%r24, %%r25) ASM_END                        \
-        ASM_BEG ASM_OP1(bge,   lb) ASM_END
+        JCC1(bge, blt, lb)
 
 #define jltxn_lb(lb)                                /* compare -> jump */   \
         ASM_BEG ASM_OP2(cmpw,  %%r24, %%r25) ASM_END                        \
-        ASM_BEG ASM_OP1(blt,   lb) ASM_END
+        JCC1(blt, bge, lb)
 
 #define jlexn_lb(lb)                                /* compare -> jump */   \
         ASM_BEG ASM_OP2(cmpw,  %%r24, %%r25) ASM_END                        \
-        ASM_BEG ASM_OP1(ble,   lb) ASM_END
+        JCC1(ble, bgt, lb)
 
 #define jgtxn_lb(lb)                                /* compare -> jump */   \
         ASM_BEG ASM_OP2(cmpw,  %%r24, %%r25) ASM_END                        \
-        ASM_BEG ASM_OP1(bgt,   lb) ASM_END
+        JCC1(bgt, ble, lb)
 
 #define jgexn_lb(lb)                                /* compare -> jump */   \
         ASM_BEG ASM_OP2(cmpw,  %%r24, %%r25) ASM_END                        \
-        ASM_BEG ASM_OP1(bge,   lb) ASM_END
+        JCC1(bge, blt, lb)
 
 #define LBL(lb)                                          /* code label */   \
         ASM_BEG ASM_OP0(lb:) ASM_END
@@ -2487,67 +2613,93 @@
 #define CMJ(cc, lb)                                                         \
         cc(lb)
 
+/* internal definitions for label-targeted conditional jumps, with
+ * RT_BASE_COMPAT_FAR enabled 16-bit bc is replaced by inverted bc
+ * over 26-bit unconditional b, local label 0 is reserved for internal use */
+
+#if (RT_BASE_COMPAT_FAR == 0) /* native */
+
+#define JCC1(cc, nc, lb)                                                    \
+        ASM_BEG ASM_OP1(cc, lb) ASM_END
+
+#define JCC2(cc, nc, p1, lb)                                                \
+        ASM_BEG ASM_OP2(cc, p1, lb) ASM_END
+
+#else /* RT_BASE_COMPAT_FAR != 0 : far */
+
+#define JCC1(cc, nc, lb)                                                    \
+        ASM_BEG ASM_OP1(nc, 0f) ASM_END                                     \
+        ASM_BEG ASM_OP1(b, lb) ASM_END                                      \
+        ASM_BEG ASM_OP0(0:) ASM_END
+
+#define JCC2(cc, nc, p1, lb)                                                \
+        ASM_BEG ASM_OP2(nc, p1, 0f) ASM_END                                 \
+        ASM_BEG ASM_OP1(b, lb) ASM_END                                      \
+        ASM_BEG ASM_OP0(0:) ASM_END
+
+#endif /* RT_BASE_COMPAT_FAR != 0 : far */
+
 /* internal definitions for combined-compare-jump (cmj) */
 
 #define IWJ0(r1, p1, IS, lb)                                                \
         AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G2(IS))   \
         EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T2(IS), M2(IS)) | \
         (M(TP2(IS) == 0) & 0x28000000) | (M(TP2(IS) != 0) & 0x7C000040))    \
-        ASM_BEG ASM_OP1(beq,   lb) ASM_END
+        JCC1(beq, bne, lb)
 
 #define IWJ1(r1, p1, IS, lb)                                                \
         AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G2(IS))   \
         EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T2(IS), M2(IS)) | \
         (M(TP2(IS) == 0) & 0x28000000) | (M(TP2(IS) != 0) & 0x7C000040))    \
-        ASM_BEG ASM_OP1(bne,   lb) ASM_END
+        JCC1(bne, beq, lb)
 
 #define IWJ2(r1, p1, IS, lb)                                                \
         AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G2(IS))   \
         EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T2(IS), M2(IS)) | \
         (M(TP2(IS) == 0) & 0x28000000) | (M(TP2(IS) != 0) & 0x7C000040))    \
-        ASM_BEG ASM_OP1(blt,   lb) ASM_END
+        JCC1(blt, bge, lb)
 
 #define IWJ3(r1, p1, IS, lb)                                                \
         AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G2(IS))   \
         EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T2(IS), M2(IS)) | \
         (M(TP2(IS) == 0) & 0x28000000) | (M(TP2(IS) != 0) & 0x7C000040))    \
-        ASM_BEG ASM_OP1(ble,   lb) ASM_END
+        JCC1(ble, bgt, lb)
 
 #define IWJ4(r1, p1, IS, lb)                                                \
         AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G2(IS))   \
         EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T2(IS), M2(IS)) | \
         (M(TP2(IS) == 0) & 0x28000000) | (M(TP2(IS) != 0) & 0x7C000040))    \
-        ASM_BEG ASM_OP1(bgt,   lb) ASM_END
+        JCC1(bgt, ble, lb)
 
 #define IWJ5(r1, p1, IS, lb)                                                \
         AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G2(IS))   \
         EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T2(IS), M2(IS)) | \
         (M(TP2(IS) == 0) & 0x28000000) | (M(TP2(IS) != 0) & 0x7C000040))    \
-        ASM_BEG ASM_OP1(bge,   lb) ASM_END
+        JCC1(bge, blt, lb)
 
 #define IWJ6(r1, p1, IS, lb)                                                \
         AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G1(IS))   \
         EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T3(IS), M3(IS)) | \
         (M(TP1(IS) == 0) & 0x2C000000) | (M(TP1(IS) != 0) & 0x7C000000))    \
-        ASM_BEG ASM_OP1(blt,   lb) ASM_END
+        JCC1(blt, bge, lb)
 
 #define IWJ7(r1, p1, IS, lb)                                                \
         AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G1(IS))   \
         EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T3(IS), M3(IS)) | \
         (M(TP1(IS) == 0) & 0x2C000000) | (M(TP1(IS) != 0) & 0x7C000000))    \
-        ASM_BEG ASM_OP1(ble,   lb) ASM_END
+        JCC1(ble, bgt, lb)
 
 #define IWJ8(r1, p1, IS, lb)                                                \
         AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G1(IS))   \
         EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T3(IS), M3(IS)) | \
         (M(TP1(IS) == 0) & 0x2C000000) | (M(TP1(IS) != 0) & 0x7C000000))    \
-        ASM_BEG ASM_OP1(bgt,   lb) ASM_END
+        JCC1(bgt, ble, lb)
 
 #define IWJ9(r1, p1, IS, lb)                                                \
         AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G1(IS))   \
         EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T3(IS), M3(IS)) | \
         (M(TP1(IS) == 0) & 0x2C000000) | (M(TP1(IS) != 0) & 0x7C000000))    \
-        ASM_BEG ASM_OP1(bge,   lb) ASM_END
+        JCC1(bge, blt, lb)
 
 #define CWI(cc, r1, p1, IS, lb)                                             \
         IW##cc(r1, p1, W(IS), lb)
@@ -2555,43 +2707,43 @@
 
 #define RWJ0(r1, r2, lb)                                                    \
         ASM_BEG ASM_OP2(cmplw, r1, r2) ASM_END                              \
-        ASM_BEG ASM_OP1(beq,   lb) ASM_END
+        JCC1(beq, bne, lb)
 
 #define RWJ1(r1, r2, lb)                                                    \
         ASM_BEG ASM_OP2(cmplw, r1, r2) ASM_END                              \
-        ASM_BEG ASM_OP1(bne,   lb) ASM_END
+        JCC1(bne, beq, lb)
 
 #define RWJ2(r1, r2, lb)                                                    \
         ASM_BEG ASM_OP2(cmplw, r1, r2) ASM_END                              \
-        ASM_BEG ASM_OP1(blt,   lb) ASM_END
+        JCC1(blt, bge, lb)
 
 #define RWJ3(r1, r2, lb)                                                    \
         ASM_BEG ASM_OP2(cmplw, r1, r2) ASM_END                              \
-        ASM_BEG ASM_OP1(ble,   lb) ASM_END
+        JCC1(ble, bgt, lb)
 
 #define RWJ4(r1, r2, lb)                                                    \
         ASM_BEG ASM_OP2(cmplw, r1, r2) ASM_END                              \
-        ASM_BEG ASM_OP1(bgt,   lb) ASM_END
+        JCC1(bgt, ble, lb)
 
 #define RWJ5(r1, r2, lb)                                                    \
         ASM_BEG ASM_OP2(cmplw, r1, r2) ASM_END                              \
-        ASM_BEG ASM_OP1(bge,   lb) ASM_END
+        JCC1(bge, blt, lb)
 
 #define RWJ6(r1, r2, lb)                                                    \
         ASM_BEG ASM_OP2(cmpw,  r1, r2) ASM_END                              \
-        ASM_BEG ASM_OP1(blt,   lb) ASM_END
+        JCC1(blt, bge, lb)
 
 #define RWJ7(r1, r2, lb)                                                    \
         ASM_BEG ASM_OP2(cmpw,  r1, r2) ASM_END                              \
-        ASM_BEG ASM_OP1(ble,   lb) ASM_END
+        JCC1(ble, bgt, lb)
 
 #define RWJ8(r1, r2, lb)                                                    \
         ASM_BEG ASM_OP2(cmpw,  r1, r2) ASM_END                              \
-        ASM_BEG ASM_OP1(bgt,   lb) ASM_END
+        JCC1(bgt, ble, lb)
 
 #define RWJ9(r1, r2, lb)                                                    \
         ASM_BEG ASM_OP2(cmpw,  r1, r2) ASM_END                              \
-        ASM_BEG ASM_OP1(bge,   lb) ASM_END
+        JCC1(bge, blt, lb)
 
 #define CWR(cc, r1, r2, lb)                                                 \
         RW##cc(r1, r2, lb)
@@ -329,6 +329,15 @@
         AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C2(DD), EMPTY2)   \
         EMITW(0x00000000 | MPM(REG(XS), MOD(MD), VAL(DD), B2(DD), O2(DD)))
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment
+ * native SIMD load/store doesn't require alignment on this target */
+
+#define muvix_ld(XD, MS, DS)                                                \
+        movix_ld(W(XD), W(MS), W(DS))
+
+#define muvix_st(XS, MD, DD)                                                \
+        movix_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -346,6 +355,68 @@
         EMITW(0xF000003F | MXM(TmmM,    TmmM,    REG(XS)))                  \
         EMITW(0x00000000 | MPM(TmmM,    MOD(MG), VAL(DG), B2(DG), O2(DG)))
 
+/* unl (G = G unpack-low S), (D = S unpack-low T) if (#D != #T)
+ * interleaves lower halves of each 128-bit lane, S-elements go first */
+
+#define unlix_rr(XG, XS)                                                    \
+        unlix3rr(W(XG), W(XG), W(XS))
+
+#define unlix_ld(XG, MS, DS)                                                \
+        unlix3ld(W(XG), W(XG), W(MS), W(DS))
+
+#if RT_ENDIAN == 1
+
+#define unlix3rr(XD, XS, XT)                                                \
+        EMITW(0xF0000097 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define unlix3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x00000000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0xF0000097 | MXM(REG(XD), REG(XS), TmmM))
+
+#else /* RT_ENDIAN == 0 */
+
+#define unlix3rr(XD, XS, XT)                                                \
+        EMITW(0xF0000197 | MXM(REG(XD), REG(XT), REG(XS)))
+
+#define unlix3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x00000000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0xF0000197 | MXM(REG(XD), TmmM,    REG(XS)))
+
+#endif /* RT_ENDIAN */
+
+/* unh (G = G unpack-high S), (D = S unpack-high T) if (#D != #T)
+ * interleaves upper halves of each 128-bit lane, S-elements go first */
+
+#define unhix_rr(XG, XS)                                                    \
+        unhix3rr(W(XG), W(XG), W(XS))
+
+#define unhix_ld(XG, MS, DS)                                                \
+        unhix3ld(W(XG), W(XG), W(MS), W(DS))
+
+#if RT_ENDIAN == 1
+
+#define unhix3rr(XD, XS, XT)                                                \
+        EMITW(0xF0000197 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define unhix3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x00000000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0xF0000197 | MXM(REG(XD), REG(XS), TmmM))
+
+#else /* RT_ENDIAN == 0 */
+
+#define unhix3rr(XD, XS, XT)                                                \
+        EMITW(0xF0000097 | MXM(REG(XD), REG(XT), REG(XS)))
+
+#define unhix3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x00000000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0xF0000097 | MXM(REG(XD), TmmM,    REG(XS)))
+
+#endif /* RT_ENDIAN */
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andix_rr(XG, XS)                                                    \
@@ -744,10 +815,10 @@
 #define S1(mask)    S##mask
 
 #define SMN32_128(xs, lb) /* not portable, do not use outside */            \
-        ASM_BEG ASM_OP2(beq, cr6, lb) ASM_END
+        JCC2(beq, bne, cr6, lb)
 
 #define SMF32_128(xs, lb) /* not portable, do not use outside */            \
-        ASM_BEG ASM_OP2(blt, cr6, lb) ASM_END
+        JCC2(blt, bge, cr6, lb)
 
 #define mkjix_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
         EMITW(0x1000038C | MXM(TmmQ,    0x1F,    0x00))                     \
@@ -252,6 +252,48 @@
         EMITW(0x38000000 | MPM(TPxx,    REG(MD), VAL(DD), B2(DD), P2(DD)))  \
         EMITW(0x7C0001CE | MXM(REG(XS), Teax & M(MOD(MD) == TPxx), TPxx))
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment
+ * emulated with lvx/vperm (load) and byte stores on VMX
+ * (stores are done byte by byte, any alignment) */
+
+#if RT_ENDIAN == 1
+
+#define muvix_ld(XD, MS, DS)                                                \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x7C00000C | MXM(TmmQ,    Teax & M(MOD(MS) == TPxx), TPxx))   \
+        EMITW(0x7C0000CE | MXM(REG(XD), Teax & M(MOD(MS) == TPxx), TPxx))   \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | (+0x0F & 0xFFFF))  \
+        EMITW(0x7C0000CE | MXM(TmmM,    Teax & M(MOD(MS) == TPxx), TPxx))   \
+        EMITW(0x1000002B | MXM(REG(XD), REG(XD), TmmM) | TmmQ << 6)
+
+#define muvix_st(XS, MD, DD)                                                \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MD), VAL(DD), C2(DD), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MD), VAL(DD), B2(DD), P2(DD)))  \
+        EMITW(0x7C00004C | MXM(TmmQ,    Teax & M(MOD(MD) == TPxx), TPxx))   \
+        EMITW(0x1000002B | MXM(TmmM,    REG(XS), REG(XS)) | TmmQ << 6)      \
+        MUB(Teax & M(MOD(MD) == TPxx))
+
+#else /* RT_ENDIAN == 0 */
+
+#define muvix_ld(XD, MS, DS)                                                \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x7C00004C | MXM(TmmQ,    Teax & M(MOD(MS) == TPxx), TPxx))   \
+        EMITW(0x7C0000CE | MXM(TmmM,    Teax & M(MOD(MS) == TPxx), TPxx))   \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | (+0x0F & 0xFFFF))  \
+        EMITW(0x7C0000CE | MXM(REG(XD), Teax & M(MOD(MS) == TPxx), TPxx))   \
+        EMITW(0x1000002B | MXM(REG(XD), REG(XD), TmmM) | TmmQ << 6)
+
+#define muvix_st(XS, MD, DD)                                                \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MD), VAL(DD), C2(DD), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MD), VAL(DD), B2(DD), P2(DD)))  \
+        EMITW(0x7C00000C | MXM(TmmQ,    Teax & M(MOD(MD) == TPxx), TPxx))   \
+        EMITW(0x1000002B | MXM(TmmM,    REG(XS), REG(XS)) | TmmQ << 6)      \
+        MUB(Teax & M(MOD(MD) == TPxx))
+
+#endif /* RT_ENDIAN */
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -271,6 +313,72 @@
         EMITW(0x1000002A | MXM(TmmM,    TmmM,    REG(XS)))                  \
         EMITW(0x7C0001CE | MXM(TmmM,    Teax & M(MOD(MG) == TPxx), TPxx))
 
+/* unl (G = G unpack-low S), (D = S unpack-low T) if (#D != #T)
+ * interleaves lower halves of each 128-bit lane, S-elements go first */
+
+#define unlix_rr(XG, XS)                                                    \
+        unlix3rr(W(XG), W(XG), W(XS))
+
+#define unlix_ld(XG, MS, DS)                                                \
+        unlix3ld(W(XG), W(XG), W(MS), W(DS))
+
+#if RT_ENDIAN == 1
+
+#define unlix3rr(XD, XS, XT)                                                \
+        EMITW(0x1000008C | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define unlix3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C0000CE | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x1000008C | MXM(REG(XD), REG(XS), TmmM))
+
+#else /* RT_ENDIAN == 0 */
+
+#define unlix3rr(XD, XS, XT)                                                \
+        EMITW(0x1000018C | MXM(REG(XD), REG(XT), REG(XS)))
+
+#define unlix3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C0000CE | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x1000018C | MXM(REG(XD), TmmM,    REG(XS)))
+
+#endif /* RT_ENDIAN */
+
+/* unh (G = G unpack-high S), (D = S unpack-high T) if (#D != #T)
+ * interleaves upper halves of each 128-bit lane, S-elements go first */
+
+#define unhix_rr(XG, XS)                                                    \
+        unhix3rr(W(XG), W(XG), W(XS))
+
+#define unhix_ld(XG, MS, DS)                                                \
+        unhix3ld(W(XG), W(XG), W(MS), W(DS))
+
+#if RT_ENDIAN == 1
+
+#define unhix3rr(XD, XS, XT)                                                \
+        EMITW(0x1000018C | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define unhix3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C0000CE | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x1000018C | MXM(REG(XD), REG(XS), TmmM))
+
+#else /* RT_ENDIAN == 0 */
+
+#define unhix3rr(XD, XS, XT)                                                \
+        EMITW(0x1000008C | MXM(REG(XD), REG(XT), REG(XS)))
+
+#define unhix3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C0000CE | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x1000008C | MXM(REG(XD), TmmM,    REG(XS)))
+
+#endif /* RT_ENDIAN */
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andix_rr(XG, XS)                                                    \
@@ -878,10 +986,10 @@
 #define S1(mask)    S##mask
 
 #define SMN32_128(xs, lb) /* not portable, do not use outside */            \
-        ASM_BEG ASM_OP2(beq, cr6, lb) ASM_END
+        JCC2(beq, bne, cr6, lb)
 
 #define SMF32_128(xs, lb) /* not portable, do not use outside */            \
-        ASM_BEG ASM_OP2(blt, cr6, lb) ASM_END
+        JCC2(blt, bge, cr6, lb)
 
 #define mkjix_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
         EMITW(0x1000038C | MXM(TmmQ,    0x1F,    0x00))                     \
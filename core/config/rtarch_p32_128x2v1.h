@@ -165,6 +165,15 @@
         EMITW(0x7C000719 | MXM(REG(XS), T0xx,    TPxx))                     \
         EMITW(0x7C000719 | MXM(RYG(XS), T1xx,    TPxx))
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment
+ * native SIMD load/store doesn't require alignment on this target */
+
+#define muvcx_ld(XD, MS, DS)                                                \
+        movcx_ld(W(XD), W(MS), W(DS))
+
+#define muvcx_st(XS, MD, DD)                                                \
+        movcx_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -704,12 +713,12 @@
 #define SMN32_256(xs, lb) /* not portable, do not use outside */            \
         EMITW(0xF0000497 | MXM(TmmM,    xs,      xs+16))                    \
         EMITW(0x10000486 | MXM(TmmM,    TmmM,    TmmQ))                     \
-        ASM_BEG ASM_OP2(beq, cr6, lb) ASM_END
+        JCC2(beq, bne, cr6, lb)
 
 #define SMF32_256(xs, lb) /* not portable, do not use outside */            \
         EMITW(0xF0000417 | MXM(TmmM,    xs,      xs+16))                    \
         EMITW(0x10000486 | MXM(TmmM,    TmmM,    TmmQ))                     \
-        ASM_BEG ASM_OP2(blt, cr6, lb) ASM_END
+        JCC2(blt, bge, cr6, lb)
 
 #define mkjcx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
         EMITW(0x1000038C | MXM(TmmQ,    0x1F,    0x00))                     \
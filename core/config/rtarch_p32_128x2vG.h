@@ -166,6 +166,58 @@
         EMITW(0x7C0001CE | MXM(REG(XS), T0xx,    TPxx))                     \
         EMITW(0x7C0001CE | MXM(RYG(XS), T1xx,    TPxx))
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment
+ * emulated with lvx/vperm (load) and byte stores on VMX
+ * (stores are done byte by byte, any alignment) */
+
+#if RT_ENDIAN == 1
+
+#define muvcx_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x7C00000C | MXM(TmmQ,    T0xx,    TPxx))                     \
+        EMITW(0x7C0000CE | MXM(REG(XD), T0xx,    TPxx))                     \
+        EMITW(0x7C0000CE | MXM(RYG(XD), T1xx,    TPxx))                     \
+        EMITW(0x1000002B | MXM(REG(XD), REG(XD), RYG(XD)) | TmmQ << 6)      \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | (+0x1F & 0xFFFF))  \
+        EMITW(0x7C0000CE | MXM(TmmM,    T0xx,    TPxx))                     \
+        EMITW(0x1000002B | MXM(RYG(XD), RYG(XD), TmmM) | TmmQ << 6)
+
+#define muvcx_st(XS, MD, DD)                                                \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C2(DD), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    MOD(MD), VAL(DD), B2(DD), P2(DD)))  \
+        EMITW(0x7C00004C | MXM(TmmQ,    T0xx,    TPxx))                     \
+        EMITW(0x1000002B | MXM(TmmM,    REG(XS), REG(XS)) | TmmQ << 6)      \
+        MUB(T0xx)                                                           \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | (+0x01 & 0xFFFF))  \
+        EMITW(0x1000002B | MXM(TmmM,    RYG(XS), RYG(XS)) | TmmQ << 6)      \
+        MUB(T0xx)
+
+#else /* RT_ENDIAN == 0 */
+
+#define muvcx_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x7C00004C | MXM(TmmQ,    T0xx,    TPxx))                     \
+        EMITW(0x7C0000CE | MXM(TmmM,    T0xx,    TPxx))                     \
+        EMITW(0x7C0000CE | MXM(REG(XD), T1xx,    TPxx))                     \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | (+0x1F & 0xFFFF))  \
+        EMITW(0x7C0000CE | MXM(RYG(XD), T0xx,    TPxx))                     \
+        EMITW(0x1000002B | MXM(RYG(XD), RYG(XD), REG(XD)) | TmmQ << 6)      \
+        EMITW(0x1000002B | MXM(REG(XD), REG(XD), TmmM) | TmmQ << 6)
+
+#define muvcx_st(XS, MD, DD)                                                \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C2(DD), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    MOD(MD), VAL(DD), B2(DD), P2(DD)))  \
+        EMITW(0x7C00000C | MXM(TmmQ,    T0xx,    TPxx))                     \
+        EMITW(0x1000002B | MXM(TmmM,    REG(XS), REG(XS)) | TmmQ << 6)      \
+        MUB(T0xx)                                                           \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | (+0x01 & 0xFFFF))  \
+        EMITW(0x1000002B | MXM(TmmM,    RYG(XS), RYG(XS)) | TmmQ << 6)      \
+        MUB(T0xx)
+
+#endif /* RT_ENDIAN */
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -935,12 +987,12 @@
 #define SMN32_256(xs, lb) /* not portable, do not use outside */            \
         EMITW(0x10000484 | MXM(TmmM,    xs,      xs+16))                    \
         EMITW(0x10000486 | MXM(TmmM,    TmmM,    TmmQ))                     \
-        ASM_BEG ASM_OP2(beq, cr6, lb) ASM_END
+        JCC2(beq, bne, cr6, lb)
 
 #define SMF32_256(xs, lb) /* not portable, do not use outside */            \
         EMITW(0x10000404 | MXM(TmmM,    xs,      xs+16))                    \
         EMITW(0x10000486 | MXM(TmmM,    TmmM,    TmmQ))                     \
-        ASM_BEG ASM_OP2(blt, cr6, lb) ASM_END
+        JCC2(blt, bge, cr6, lb)
 
 #define mkjcx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
         EMITW(0x1000038C | MXM(TmmQ,    0x1F,    0x00))                     \
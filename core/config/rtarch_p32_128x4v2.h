@@ -169,6 +169,15 @@
         EMITW(0x00000000 | MPM(REG(XS), MOD(MD), VXL(DD), B4(DD), V4(DD)))  \
         EMITW(0x00000000 | MPM(RYG(XS), MOD(MD), VZL(DD), B4(DD), V4(DD)))
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment
+ * native SIMD load/store doesn't require alignment on this target */
+
+#define muvox_ld(XD, MS, DS)                                                \
+        movox_ld(W(XD), W(MS), W(DS))
+
+#define muvox_st(XS, MD, DD)                                                \
+        movox_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -824,7 +833,7 @@
         EMITW(0xF0000497 | MXM(TmmM,    TmmM,    TmmQ))                     \
         EMITW(0x1000038C | MXM(TmmQ,    0x1F,    0x00))                     \
         EMITW(0x10000486 | MXM(TmmM,    TmmM,    TmmQ))                     \
-        ASM_BEG ASM_OP2(beq, cr6, lb) ASM_END
+        JCC2(beq, bne, cr6, lb)
 
 #define SMF32_512(xs, lb) /* not portable, do not use outside */            \
         EMITW(0xF0000417 | MXM(TmmM,    xs,      xs+16))                    \
@@ -832,7 +841,7 @@
         EMITW(0xF0000417 | MXM(TmmM,    TmmM,    TmmQ))                     \
         EMITW(0x1000038C | MXM(TmmQ,    0x1F,    0x00))                     \
         EMITW(0x10000486 | MXM(TmmM,    TmmM,    TmmQ))                     \
-        ASM_BEG ASM_OP2(blt, cr6, lb) ASM_END
+        JCC2(blt, bge, cr6, lb)
 
 #define mkjox_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
         AUW(EMPTY, EMPTY, EMPTY, REG(XS), lb,                               \
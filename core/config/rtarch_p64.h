@@ -1103,6 +1103,26 @@
 #define mulzp_xm(MS, DS) /* Reax is in/out, prepares Redx for divzn_x* */   \
         mulzx_ld(Reax, W(MS), W(DS))  /* must not exceed operands size */
 
+/* mhi (G = G * S >> 64), high half of full 64x64-bit product
+ * set-flags: undefined
+ * low half is given by mulzx_**, both halves at once by mulz*_x* */
+
+#define mhizx_rr(RG, RS)                                                    \
+        EMITW(0x7C000012 | MRM(REG(RG), REG(RG), REG(RS)))
+
+#define mhizx_ld(RG, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C1(DS), EMPTY2)   \
+        EMITW(0x00000000 | MDM(TMxx,    MOD(MS), VAL(DS), B1(DS), F1(DS)))  \
+        EMITW(0x7C000012 | MRM(REG(RG), REG(RG), TMxx))
+
+#define mhizn_rr(RG, RS)                                                    \
+        EMITW(0x7C000092 | MRM(REG(RG), REG(RG), REG(RS)))
+
+#define mhizn_ld(RG, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C1(DS), EMPTY2)   \
+        EMITW(0x00000000 | MDM(TMxx,    MOD(MS), VAL(DS), B1(DS), F1(DS)))  \
+        EMITW(0x7C000092 | MRM(REG(RG), REG(RG), TMxx))
+
 /* div (G = G / S)
  * set-flags: undefined */
 
@@ -1484,6 +1504,101 @@
         EMITW(0x00000000 | MDM(TLxx,    MOD(MS), VAL(DS), B1(DS), P1(DS)))  \
         EMITW(0x7C000378 | MSM(TRxx,    REG(RT), REG(RT)))
 
+/* xad (G = M, M = M + G), atomic fetch-add
+ * set-flags: undefined
+ * xad, xch, cas need natural alignment of memory args
+ * and are sequentially consistent (act as full memory barriers) */
+
+#define xadzx_st(RG, MG, DG)                                                \
+        AUW(SIB(MG),  EMPTY,  EMPTY,    MOD(MG), VAL(DG), C3(DG), EMPTY2)   \
+        EMITW(0x7C0004AC)                  /* <- sync */                    \
+        EMITW(0x7C0000A8 | MTM(TMxx,    MOD(MG), TDxx))                     \
+        EMITW(0x7C000214 | MRM(TIxx,    TMxx,    REG(RG)))                  \
+        EMITW(0x7C0001AD | MTM(TIxx,    MOD(MG), TDxx))                     \
+        EMITW(0x4082FFF4)                  /* <- bne- larx */               \
+        EMITW(0x4C00012C)                  /* <- isync */                   \
+        EMITW(0x7C000378 | MSM(REG(RG), TMxx,    TMxx))
+
+/* xch (G = M, M = G), atomic exchange
+ * set-flags: undefined */
+
+#define xchzx_st(RG, MG, DG)                                                \
+        AUW(SIB(MG),  EMPTY,  EMPTY,    MOD(MG), VAL(DG), C3(DG), EMPTY2)   \
+        EMITW(0x7C0004AC)                  /* <- sync */                    \
+        EMITW(0x7C0000A8 | MTM(TMxx,    MOD(MG), TDxx))                     \
+        EMITW(0x7C0001AD | MTM(REG(RG), MOD(MG), TDxx))                     \
+        EMITW(0x4082FFF8)                  /* <- bne- larx */               \
+        EMITW(0x4C00012C)                  /* <- isync */                   \
+        EMITW(0x7C000378 | MSM(REG(RG), TMxx,    TMxx))
+
+/* cas (if M == Reax then M = S, Reax = M), atomic compare-and-swap
+ * set-flags: undefined
+ * success is checked by comparing Reax to its value before cas */
+
+#define caszx_st(RS, MG, DG)     /* Reax is in/out, RS, MG != Reax */       \
+        AUW(SIB(MG),  EMPTY,  EMPTY,    MOD(MG), VAL(DG), C3(DG), EMPTY2)   \
+        EMITW(0x7C0004AC)                  /* <- sync */                    \
+        EMITW(0x7C0000A8 | MTM(TMxx,    MOD(MG), TDxx))                     \
+        EMITW(0x7C200000 | MTM(0x00,    TMxx,    Teax))                     \
+        EMITW(0x4082000C)                  /* <- bne- isync */              \
+        EMITW(0x7C0001AD | MTM(REG(RS), MOD(MG), TDxx))                     \
+        EMITW(0x4082FFF0)                  /* <- bne- larx */               \
+        EMITW(0x4C00012C)                  /* <- isync */                   \
+        EMITW(0x7C000378 | MSM(Teax,    TMxx,    TMxx))
+
+/* cnt (D = number of set bits in S), population count
+ * set-flags: undefined */
+
+#define cntzx_rr(RD, RS)                                                    \
+        EMITW(0x7C0003F4 | MSM(REG(RD), REG(RS), 0x00))
+
+/* clz (D = number of leading zeros in S)
+ * set-flags: undefined
+ * clz, ctz return operand size in bits for zero source */
+
+#define clzzx_rr(RD, RS)                                                    \
+        EMITW(0x7C000074 | MSM(REG(RD), REG(RS), 0x00))
+
+/* ctz (D = number of trailing zeros in S)
+ * set-flags: undefined */
+
+#if RT_BASE_COMPAT_REM == 0
+
+#define ctzzx_rr(RD, RS)                                                    \
+        EMITW(0x3800FFFF | MTM(TMxx,    REG(RS), 0x00))  /* <- S - 1 */     \
+        EMITW(0x7C000078 | MSM(TMxx,    TMxx,    REG(RS)))                  \
+        EMITW(0x7C0003F4 | MSM(REG(RD), TMxx,    0x00))
+
+#else /* RT_BASE_COMPAT_REM != 0 */
+
+#define ctzzx_rr(RD, RS)                                                    \
+        EMITW(0x7C000474 | MSM(REG(RD), REG(RS), 0x00))
+
+#endif /* RT_BASE_COMPAT_REM != 0 */
+
+/* bsw (D = S with bytes in reversed order), byte swap
+ * set-flags: undefined */
+
+#define bswzx_rr(RD, RS)                                                    \
+        EMITW(0x5400403E | MSM(TMxx,    REG(RS), 0x00))                     \
+        EMITW(0x5000C00E | MSM(TMxx,    REG(RS), 0x00))                     \
+        EMITW(0x5000C42E | MSM(TMxx,    REG(RS), 0x00))                     \
+        EMITW(0x78000022 | MSM(TIxx,    REG(RS), 0x00))  /* <- S >> 32 */   \
+        EMITW(0x5400403E | MSM(TDxx,    TIxx,    0x00))                     \
+        EMITW(0x5000C00E | MSM(TDxx,    TIxx,    0x00))                     \
+        EMITW(0x5000C42E | MSM(TDxx,    TIxx,    0x00))                     \
+        EMITW(0x780007C6 | MSM(TMxx,    TMxx,    0x00))  /* <- M << 32 */   \
+        EMITW(0x7C000378 | MSM(REG(RD), TMxx,    TDxx))
+
+/* bfx (G = G >> IS & ((1 << IT) - 1)), unsigned bit-field extract
+ * set-flags: undefined
+ * IT > 0, IS + IT <= 64 */
+
+#define bfxzx_ri(RG, IS, IT)                                                \
+        EMITW(0x78000000 | MSM(REG(RG), REG(RG), (64-VAL(IS)) & 0x1F) |     \
+                      ((64-VAL(IT)) & 0x1F) << 6 | ((64-VAL(IT)) & 0x20) |  \
+                                          ((64-VAL(IS)) & 0x20) >> 4)
+
 /* ver (Mebp/inf_VER = SIMD-version)
  * set-flags: no
  * For interpretation of SIMD build flags check compatibility layer in rtzero.h
@@ -1513,7 +1628,9 @@
  * maximum byte-address-range for un/conditional jumps is signed 18/16-bit
  * based on minimum natively-encoded offset across supported targets (u/c)
  * MIPS:18-bit, POWER:26-bit, AArch32:26-bit, AArch64:28-bit, x86:32-bit /
- * MIPS:18-bit, POWER:16-bit, AArch32:26-bit, AArch64:21-bit, x86:32-bit */
+ * MIPS:18-bit, POWER:16-bit, AArch32:26-bit, AArch64:21-bit, x86:32-bit
+ * RT_BASE_COMPAT_FAR (rtarch.h) extends POWER conditional jumps to 26-bit
+ * via inverted bc over unconditional b (label 0 reserved) */
 
 #define jmpxx_xr(RS)           /* register-targeted unconditional jump */   \
         EMITW(0x7C0003A6 | MRM(REG(RS), 0x00,    0x09)) /* ctr <- reg */    \
@@ -1529,50 +1646,50 @@
         ASM_BEG ASM_OP1(b, lb) ASM_END
 
 #define jezxx_lb(lb)               /* setting-flags-arithmetic -> jump */   \
-        ASM_BEG ASM_OP1(beq,   lb) ASM_END
+        JCC1(beq, bne, lb)
 
 #define jnzxx_lb(lb)               /* setting-flags-arithmetic -> jump */   \
-        ASM_BEG ASM_OP1(bne,   lb) ASM_END
+        JCC1(bne, beq, lb)
 
 #define jeqxx_lb(lb)                                /* compare -> jump */   \
         ASM_BEG ASM_OP2(cmpld, %%r24, %%r25) ASM_END                        \
-        ASM_BEG ASM_OP1(beq,   lb) ASM_END
+        JCC1(beq, bne, lb)
 
 #define jnexx_lb(lb)                                /* compare -> jump */   \
         ASM_BEG ASM_OP2(cmpld, %%r24, %%r25) ASM_END                        \
-        ASM_BEG ASM_OP1(bne,   lb) ASM_END
+        JCC1(bne, beq, lb)
 
 #define jltxx_lb(lb)                                /* compare -> jump */   \
         ASM_BEG ASM_OP2(cmpld, %%r24, %%r25) ASM_END                        \
-        ASM_BEG ASM_OP1(blt,   lb) ASM_END
+        JCC1(blt, bge, lb)
 
 #define jlexx_lb(lb)                                /* compare -> jump */   \
         ASM_BEG ASM_OP2(cmpld, %%r24, %%r25) ASM_END                        \
-        ASM_BEG ASM_OP1(ble,   lb) ASM_END
+        JCC1(ble, bgt, lb)
 
 #define jgtxx_lb(lb)                                /* compare -> jump */   \
         ASM_BEG ASM_OP2(cmpld, %%r24, %%r25) ASM_END                        \
-        ASM_BEG ASM_OP1(bgt,   lb) ASM_END
+        JCC1(bgt, ble, lb)
 
 #define jgexx_lb(lb)                                /* compare -> jump */   \
         ASM_BEG ASM_OP2(cmpld, %%r24, %%r25) ASM_END                        \
-        ASM_BEG ASM_OP1(bge,   lb) ASM_END
+        JCC1(bge, blt, lb)
 
 #define jltxn_lb(lb)                                /* compare -> jump */   \
         ASM_BEG ASM_OP2(cmpd,  %%r24, %%r25) ASM_END                        \
-        ASM_BEG ASM_OP1(blt,   lb) ASM_END
+        JCC1(blt, bge, lb)
 
 #define jlexn_lb(lb)                                /* compare -> jump */   \
         ASM_BEG ASM_OP2(cmpd,  %%r24, %%r25) ASM_END                        \
-        ASM_BEG ASM_OP1(ble,   lb) ASM_END
+        JCC1(ble, bgt, lb)
 
 #define jgtxn_lb(lb)                                /* compare -> jump */   \
         ASM_BEG ASM_OP2(cmpd,  %%r24, %%r25) ASM_END                        \
-        ASM_BEG ASM_OP1(bgt,   lb) ASM_END
+        JCC1(bgt, ble, lb)
 
 #define jgexn_lb(lb)                                /* compare -> jump */   \
         ASM_BEG ASM_OP2(cmpd,  %%r24, %%r25) ASM_END                        \
-        ASM_BEG ASM_OP1(bge,   lb) ASM_END
+        JCC1(bge, blt, lb)
 
 #define LBL(lb)                                          /* code label */   \
         ASM_BEG ASM_OP0(lb:) ASM_END
@@ -1581,7 +1698,9 @@
 
 /* stack (push stack = S, D = pop stack)
  * set-flags: no (sequence cmp/stack_la/jmp is not allowed on MIPS & POWER)
- * adjust stack pointer with 8-byte (64-bit) steps on all current targets */
+ * adjust stack pointer with 8-byte (64-bit) steps on all current targets
+ * stack_sa/stack_la skip 288-byte protected zone below sp (64-bit ELF ABI)
+ * which leaf functions may use for locals, as ASM sections can be inlined */
 
 #define stack_st(RS)                                                        \
         EMITW(0x38000000 | MTM(SPxx,    SPxx,    0x00) | (-0x08 & 0xFFFF))  \
@@ -1592,7 +1711,7 @@
         EMITW(0x38000000 | MTM(SPxx,    SPxx,    0x00) | (+0x08 & 0xFFFF))
 
 #define stack_sa()  /* save all, [Reax - RegE] + 12 temps, 26 regs total */ \
-        EMITW(0x38000000 | MTM(SPxx,    SPxx,    0x00) | (-0xD0 & 0xFFFF))  \
+        EMITW(0x38000000 | MTM(SPxx,    SPxx,    0x00) | (-0x1F0 & 0xFFFF)) \
         EMITW(0xF8000000 | MTM(Teax,    SPxx,    0x00) | (+0x00 & 0xFFFF))  \
         EMITW(0xF8000000 | MTM(Tecx,    SPxx,    0x00) | (+0x08 & 0xFFFF))  \
         EMITW(0xF8000000 | MTM(Tedx,    SPxx,    0x00) | (+0x10 & 0xFFFF))  \
@@ -1647,7 +1766,7 @@
         EMITW(0xE8000000 | MTM(Tedx,    SPxx,    0x00) | (+0x10 & 0xFFFF))  \
         EMITW(0xE8000000 | MTM(Tecx,    SPxx,    0x00) | (+0x08 & 0xFFFF))  \
         EMITW(0xE8000000 | MTM(Teax,    SPxx,    0x00) | (+0x00 & 0xFFFF))  \
-        EMITW(0x38000000 | MTM(SPxx,    SPxx,    0x00) | (+0xD0 & 0xFFFF))
+        EMITW(0x38000000 | MTM(SPxx,    SPxx,    0x00) | (+0x1F0 & 0xFFFF))
 
 /******************************************************************************/
 /********************************   INTERNAL   ********************************/
@@ -1659,61 +1778,61 @@
         AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G2(IS))   \
         EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T2(IS), M2(IS)) | \
         (M(TP2(IS) == 0) & 0x28200000) | (M(TP2(IS) != 0) & 0x7C200040))    \
-        ASM_BEG ASM_OP1(beq,   lb) ASM_END
+        JCC1(beq, bne, lb)
 
 #define IXJ1(r1, p1, IS, lb)                                                \
         AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G2(IS))   \
         EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T2(IS), M2(IS)) | \
         (M(TP2(IS) == 0) & 0x28200000) | (M(TP2(IS) != 0) & 0x7C200040))    \
-        ASM_BEG ASM_OP1(bne,   lb) ASM_END
+        JCC1(bne, beq, lb)
 
 #define IXJ2(r1, p1, IS, lb)                                                \
         AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G2(IS))   \
         EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T2(IS), M2(IS)) | \
         (M(TP2(IS) == 0) & 0x28200000) | (M(TP2(IS) != 0) & 0x7C200040))    \
-        ASM_BEG ASM_OP1(blt,   lb) ASM_END
+        JCC1(blt, bge, lb)
 
 #define IXJ3(r1, p1, IS, lb)                                                \
         AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G2(IS))   \
         EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T2(IS), M2(IS)) | \
         (M(TP2(IS) == 0) & 0x28200000) | (M(TP2(IS) != 0) & 0x7C200040))    \
-        ASM_BEG ASM_OP1(ble,   lb) ASM_END
+        JCC1(ble, bgt, lb)
 
 #define IXJ4(r1, p1, IS, lb)                                                \
         AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G2(IS))   \
         EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T2(IS), M2(IS)) | \
         (M(TP2(IS) == 0) & 0x28200000) | (M(TP2(IS) != 0) & 0x7C200040))    \
-        ASM_BEG ASM_OP1(bgt,   lb) ASM_END
+        JCC1(bgt, ble, lb)
 
 #define IXJ5(r1, p1, IS, lb)                                                \
         AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G2(IS))   \
         EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T2(IS), M2(IS)) | \
         (M(TP2(IS) == 0) & 0x28200000) | (M(TP2(IS) != 0) & 0x7C200040))    \
-        ASM_BEG ASM_OP1(bge,   lb) ASM_END
+        JCC1(bge, blt, lb)
 
 #define IXJ6(r1, p1, IS, lb)                                                \
         AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G1(IS))   \
         EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T3(IS), M3(IS)) | \
         (M(TP1(IS) == 0) & 0x2C200000) | (M(TP1(IS) != 0) & 0x7C200000))    \
-        ASM_BEG ASM_OP1(blt,   lb) ASM_END
+        JCC1(blt, bge, lb)
 
 #define IXJ7(r1, p1, IS, lb)                                                \
         AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G1(IS))   \
         EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T3(IS), M3(IS)) | \
         (M(TP1(IS) == 0) & 0x2C200000) | (M(TP1(IS) != 0) & 0x7C200000))    \
-        ASM_BEG ASM_OP1(ble,   lb) ASM_END
+        JCC1(ble, bgt, lb)
 
 #define IXJ8(r1, p1, IS, lb)                                                \
         AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G1(IS))   \
         EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T3(IS), M3(IS)) | \
         (M(TP1(IS) == 0) & 0x2C200000) | (M(TP1(IS) != 0) & 0x7C200000))    \
-        ASM_BEG ASM_OP1(bgt,   lb) ASM_END
+        JCC1(bgt, ble, lb)
 
 #define IXJ9(r1, p1, IS, lb)                                                \
         AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G1(IS))   \
         EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T3(IS), M3(IS)) | \
         (M(TP1(IS) == 0) & 0x2C200000) | (M(TP1(IS) != 0) & 0x7C200000))    \
-        ASM_BEG ASM_OP1(bge,   lb) ASM_END
+        JCC1(bge, blt, lb)
 
 #define CXI(cc, r1, p1, IS, lb)                                             \
         IX##cc(r1, p1, W(IS), lb)
@@ -1721,43 +1840,43 @@
 
 #define RXJ0(r1, r2, lb)                                                    \
         ASM_BEG ASM_OP2(cmpld, r1, r2) ASM_END                              \
-        ASM_BEG ASM_OP1(beq,   lb) ASM_END
+        JCC1(beq, bne, lb)
 
 #define RXJ1(r1, r2, lb)                                                    \
         ASM_BEG ASM_OP2(cmpld, r1, r2) ASM_END                              \
-        ASM_BEG ASM_OP1(bne,   lb) ASM_END
+        JCC1(bne, beq, lb)
 
 #define RXJ2(r1, r2, lb)                                                    \
         ASM_BEG ASM_OP2(cmpld, r1, r2) ASM_END                              \
-        ASM_BEG ASM_OP1(blt,   lb) ASM_END
+        JCC1(blt, bge, lb)
 
 #define RXJ3(r1, r2, lb)                                                    \
         ASM_BEG ASM_OP2(cmpld, r1, r2) ASM_END                              \
-        ASM_BEG ASM_OP1(ble,   lb) ASM_END
+        JCC1(ble, bgt, lb)
 
 #define RXJ4(r1, r2, lb)                                                    \
         ASM_BEG ASM_OP2(cmpld, r1, r2) ASM_END                              \
-        ASM_BEG ASM_OP1(bgt,   lb) ASM_END
+        JCC1(bgt, ble, lb)
 
 #define RXJ5(r1, r2, lb)                                                    \
         ASM_BEG ASM_OP2(cmpld, r1, r2) ASM_END                              \
-        ASM_BEG ASM_OP1(bge,   lb) ASM_END
+        JCC1(bge, blt, lb)
 
 #define RXJ6(r1, r2, lb)                                                    \
         ASM_BEG ASM_OP2(cmpd,  r1, r2) ASM_END                              \
-        ASM_BEG ASM_OP1(blt,   lb) ASM_END
+        JCC1(blt, bge, lb)
 
 #define RXJ7(r1, r2, lb)                                                    \
         ASM_BEG ASM_OP2(cmpd,  r1, r2) ASM_END                              \
-        ASM_BEG ASM_OP1(ble,   lb) ASM_END
+        JCC1(ble, bgt, lb)
 
 #define RXJ8(r1, r2, lb)                                                    \
         ASM_BEG ASM_OP2(cmpd,  r1, r2) ASM_END                              \
-        ASM_BEG ASM_OP1(bgt,   lb) ASM_END
+        JCC1(bgt, ble, lb)
 
 #define RXJ9(r1, r2, lb)                                                    \
         ASM_BEG ASM_OP2(cmpd,  r1, r2) ASM_END                              \
-        ASM_BEG ASM_OP1(bge,   lb) ASM_END
+        JCC1(bge, blt, lb)
 
 #define CXR(cc, r1, r2, lb)                                                 \
         RX##cc(r1, r2, lb)
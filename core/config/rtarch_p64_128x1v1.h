@@ -157,6 +157,15 @@
         EMITW(0x38000000 | MPM(TPxx,    REG(MD), VAL(DD), B2(DD), P2(DD)))  \
         EMITW(0x7C000799 | MXM(REG(XS), Teax & M(MOD(MD) == TPxx), TPxx))
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment
+ * native SIMD load/store doesn't require alignment on this target */
+
+#define muvjx_ld(XD, MS, DS)                                                \
+        movjx_ld(W(XD), W(MS), W(DS))
+
+#define muvjx_st(XS, MD, DD)                                                \
+        movjx_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -176,6 +185,42 @@
         EMITW(0xF000003F | MXM(TmmM,    TmmM,    REG(XS)))                  \
         EMITW(0x7C000799 | MXM(TmmM,    Teax & M(MOD(MG) == TPxx), TPxx))
 
+/* unl (G = G unpack-low S), (D = S unpack-low T) if (#D != #T)
+ * interleaves lower halves of each 128-bit lane, S-elements go first */
+
+#define unljx_rr(XG, XS)                                                    \
+        unljx3rr(W(XG), W(XG), W(XS))
+
+#define unljx_ld(XG, MS, DS)                                                \
+        unljx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define unljx3rr(XD, XS, XT)                                                \
+        EMITW(0xF0000057 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define unljx3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000699 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0xF0000057 | MXM(REG(XD), REG(XS), TmmM))
+
+/* unh (G = G unpack-high S), (D = S unpack-high T) if (#D != #T)
+ * interleaves upper halves of each 128-bit lane, S-elements go first */
+
+#define unhjx_rr(XG, XS)                                                    \
+        unhjx3rr(W(XG), W(XG), W(XS))
+
+#define unhjx_ld(XG, MS, DS)                                                \
+        unhjx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define unhjx3rr(XD, XS, XT)                                                \
+        EMITW(0xF0000357 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define unhjx3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000699 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0xF0000357 | MXM(REG(XD), REG(XS), TmmM))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andjx_rr(XG, XS)                                                    \
@@ -615,10 +660,10 @@
 /* #define S1(mask)    S##mask             (defined in 32_128-bit header) */
 
 #define SMN64_128(xs, lb) /* not portable, do not use outside */            \
-        ASM_BEG ASM_OP2(beq, cr6, lb) ASM_END
+        JCC2(beq, bne, cr6, lb)
 
 #define SMF64_128(xs, lb) /* not portable, do not use outside */            \
-        ASM_BEG ASM_OP2(blt, cr6, lb) ASM_END
+        JCC2(blt, bge, cr6, lb)
 
 #define mkjjx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
         EMITW(0x1000038C | MXM(TmmQ,    0x1F,    0x00))                     \
@@ -813,6 +858,49 @@
         stack_ld(Reax)                                                      \
         movjx_ld(W(XD), Mebp, inf_SCR01(0))
 
+/* mlw (G = G[31:0] * S[31:0]), (D = S[31:0] * T[31:0]) if (#D != #T)
+ * unsigned 32x32 to 64-bit product of lower halves of 64-bit elements */
+
+#define mlwjx_rr(XG, XS)                                                    \
+        mlwjx3rr(W(XG), W(XG), W(XS))
+
+#define mlwjx_ld(XG, MS, DS)                                                \
+        mlwjx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define mlwjx3rr(XD, XS, XT)                                                \
+        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movjx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        mlwjx_rx(W(XD))
+
+#define mlwjx3ld(XD, XS, MT, DT)                                            \
+        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movjx_ld(W(XD), W(MT), W(DT))                                       \
+        movjx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        mlwjx_rx(W(XD))
+
+#define mlwjx_rx(XD) /* not portable, do not use outside */                 \
+        stack_st(Recx)                                                      \
+        stack_st(Redx)                                                      \
+        movzx_ld(Recx,  Mebp, inf_SCR01(0x00))                              \
+        shlzx_ri(Recx,  IB(32))                                             \
+        shrzx_ri(Recx,  IB(32))                                             \
+        movzx_ld(Redx,  Mebp, inf_SCR02(0x00))                              \
+        shlzx_ri(Redx,  IB(32))                                             \
+        shrzx_ri(Redx,  IB(32))                                             \
+        mulzx_rr(Recx,  Redx)                                               \
+        movzx_st(Recx,  Mebp, inf_SCR01(0x00))                              \
+        movzx_ld(Recx,  Mebp, inf_SCR01(0x08))                              \
+        shlzx_ri(Recx,  IB(32))                                             \
+        shrzx_ri(Recx,  IB(32))                                             \
+        movzx_ld(Redx,  Mebp, inf_SCR02(0x08))                              \
+        shlzx_ri(Redx,  IB(32))                                             \
+        shrzx_ri(Redx,  IB(32))                                             \
+        mulzx_rr(Recx,  Redx)                                               \
+        movzx_st(Recx,  Mebp, inf_SCR01(0x08))                              \
+        stack_ld(Redx)                                                      \
+        stack_ld(Recx)                                                      \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0))
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subjx_rr(XG, XS)                                                    \
@@ -1066,6 +1154,24 @@
         EMITW(0x7C000699 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
         EMITW(0x100000C0 | MXM(REG(XD), REG(XS), TmmM))
 
+/* mlw (G = G[31:0] * S[31:0]), (D = S[31:0] * T[31:0]) if (#D != #T)
+ * unsigned 32x32 to 64-bit product of lower halves of 64-bit elements */
+
+#define mlwjx_rr(XG, XS)                                                    \
+        mlwjx3rr(W(XG), W(XG), W(XS))
+
+#define mlwjx_ld(XG, MS, DS)                                                \
+        mlwjx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define mlwjx3rr(XD, XS, XT)                                                \
+        EMITW(0x10000088 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define mlwjx3ld(XD, XS, MT, DT)                                            \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x7C000699 | MXM(TmmM,    Teax & M(MOD(MT) == TPxx), TPxx))   \
+        EMITW(0x10000088 | MXM(REG(XD), REG(XS), TmmM))
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subjx_rr(XG, XS)                                                    \
@@ -186,6 +186,15 @@
     SHF(EMITW(0x00000000 | MPM(TmmM,    MOD(MD), VAL(DD), B2(DD), O2(DD)))) \
     SHX(EMITW(0x00000000 | MPM(REG(XS), MOD(MD), VAL(DD), B2(DD), O2(DD))))
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment
+ * native SIMD load/store doesn't require alignment on this target */
+
+#define muvjx_ld(XD, MS, DS)                                                \
+        movjx_ld(W(XD), W(MS), W(DS))
+
+#define muvjx_st(XS, MD, DD)                                                \
+        movjx_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -206,6 +215,46 @@
     SHF(EMITW(0xF0000257 | MXM(TmmM,    TmmM,    TmmM)))                    \
         EMITW(0x00000000 | MPM(TmmM,    MOD(MG), VAL(DG), B2(DG), O2(DG)))
 
+/* unl (G = G unpack-low S), (D = S unpack-low T) if (#D != #T)
+ * interleaves lower halves of each 128-bit lane, S-elements go first */
+
+#define unljx_rr(XG, XS)                                                    \
+        unljx3rr(W(XG), W(XG), W(XS))
+
+#define unljx_ld(XG, MS, DS)                                                \
+        unljx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define unljx3rr(XD, XS, XT)                                                \
+    SBF(EMITW(0xF0000357 | MXM(REG(XD), REG(XT), REG(XS))))                 \
+    SBX(EMITW(0xF0000057 | MXM(REG(XD), REG(XS), REG(XT))))
+
+#define unljx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x00000000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+    SHF(EMITW(0xF0000257 | MXM(TmmM,    TmmM,    TmmM)))                    \
+    SBF(EMITW(0xF0000357 | MXM(REG(XD), TmmM,    REG(XS))))                 \
+    SBX(EMITW(0xF0000057 | MXM(REG(XD), REG(XS), TmmM)))
+
+/* unh (G = G unpack-high S), (D = S unpack-high T) if (#D != #T)
+ * interleaves upper halves of each 128-bit lane, S-elements go first */
+
+#define unhjx_rr(XG, XS)                                                    \
+        unhjx3rr(W(XG), W(XG), W(XS))
+
+#define unhjx_ld(XG, MS, DS)                                                \
+        unhjx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define unhjx3rr(XD, XS, XT)                                                \
+    SBF(EMITW(0xF0000057 | MXM(REG(XD), REG(XT), REG(XS))))                 \
+    SBX(EMITW(0xF0000357 | MXM(REG(XD), REG(XS), REG(XT))))
+
+#define unhjx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x00000000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+    SHF(EMITW(0xF0000257 | MXM(TmmM,    TmmM,    TmmM)))                    \
+    SBF(EMITW(0xF0000057 | MXM(REG(XD), TmmM,    REG(XS))))                 \
+    SBX(EMITW(0xF0000357 | MXM(REG(XD), REG(XS), TmmM)))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andjx_rr(XG, XS)                                                    \
@@ -623,10 +672,10 @@
 /* #define S1(mask)    S##mask             (defined in 32_128-bit header) */
 
 #define SMN64_128(xs, lb) /* not portable, do not use outside */            \
-        ASM_BEG ASM_OP2(beq, cr6, lb) ASM_END
+        JCC2(beq, bne, cr6, lb)
 
 #define SMF64_128(xs, lb) /* not portable, do not use outside */            \
-        ASM_BEG ASM_OP2(blt, cr6, lb) ASM_END
+        JCC2(blt, bge, cr6, lb)
 
 #define mkjjx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
         EMITW(0x1000038C | MXM(TmmQ,    0x1F,    0x00))                     \
@@ -805,6 +854,24 @@
     SHF(EMITW(0xF0000257 | MXM(TmmM,    TmmM,    TmmM)))                    \
         EMITW(0x100000C0 | MXM(REG(XD), REG(XS), TmmM))
 
+/* mlw (G = G[31:0] * S[31:0]), (D = S[31:0] * T[31:0]) if (#D != #T)
+ * unsigned 32x32 to 64-bit product of lower halves of 64-bit elements */
+
+#define mlwjx_rr(XG, XS)                                                    \
+        mlwjx3rr(W(XG), W(XG), W(XS))
+
+#define mlwjx_ld(XG, MS, DS)                                                \
+        mlwjx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define mlwjx3rr(XD, XS, XT)                                                \
+        EMITW(0x10000088 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#define mlwjx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x00000000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+    SHF(EMITW(0xF0000257 | MXM(TmmM,    TmmM,    TmmM)))                    \
+        EMITW(0x10000088 | MXM(REG(XD), REG(XS), TmmM))
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subjx_rr(XG, XS)                                                    \
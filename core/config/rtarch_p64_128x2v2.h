@@ -163,6 +163,15 @@
     SJF(EMITW(0x00000000 | MPM(TmmM,    MOD(MD), VYL(DD), B4(DD), U2(DD)))) \
     SJX(EMITW(0x00000000 | MPM(RYG(XS), MOD(MD), VYL(DD), B4(DD), U2(DD))))
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment
+ * native SIMD load/store doesn't require alignment on this target */
+
+#define muvdx_ld(XD, MS, DS)                                                \
+        movdx_ld(W(XD), W(MS), W(DS))
+
+#define muvdx_st(XS, MD, DD)                                                \
+        movdx_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -695,12 +704,12 @@
 #define SMN64_256(xs, lb) /* not portable, do not use outside */            \
         EMITW(0xF0000497 | MXM(TmmM,    xs,      xs+16))                    \
         EMITW(0x10000486 | MXM(TmmM,    TmmM,    TmmQ))                     \
-        ASM_BEG ASM_OP2(beq, cr6, lb) ASM_END
+        JCC2(beq, bne, cr6, lb)
 
 #define SMF64_256(xs, lb) /* not portable, do not use outside */            \
         EMITW(0xF0000417 | MXM(TmmM,    xs,      xs+16))                    \
         EMITW(0x10000486 | MXM(TmmM,    TmmM,    TmmQ))                     \
-        ASM_BEG ASM_OP2(blt, cr6, lb) ASM_END
+        JCC2(blt, bge, cr6, lb)
 
 #define mkjdx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
         EMITW(0x1000038C | MXM(TmmQ,    0x1F,    0x00))                     \
@@ -910,6 +919,32 @@
     SJF(EMITW(0xF0000257 | MXM(TmmM,    TmmM,    TmmM)))                    \
         EMITW(0x100000C0 | MXM(RYG(XD), RYG(XS), TmmM))
 
+/* mlw (G = G[31:0] * S[31:0]), (D = S[31:0] * T[31:0]) if (#D != #T)
+ * unsigned 32x32 to 64-bit product of lower halves of 64-bit elements */
+
+#undef  mlwdx_rr
+#define mlwdx_rr(XG, XS)                                                    \
+        mlwdx3rr(W(XG), W(XG), W(XS))
+
+#undef  mlwdx_ld
+#define mlwdx_ld(XG, MS, DS)                                                \
+        mlwdx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#undef  mlwdx3rr
+#define mlwdx3rr(XD, XS, XT)                                                \
+        EMITW(0x10000088 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x10000088 | MXM(RYG(XD), RYG(XS), RYG(XT)))
+
+#undef  mlwdx3ld
+#define mlwdx3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A2(DT), EMPTY2)   \
+        EMITW(0x00000000 | MPM(TmmM,    MOD(MT), VAL(DT), B4(DT), L2(DT)))  \
+    SHF(EMITW(0xF0000257 | MXM(TmmM,    TmmM,    TmmM)))                    \
+        EMITW(0x10000088 | MXM(REG(XD), REG(XS), TmmM))                     \
+        EMITW(0x00000000 | MPM(TmmM,    MOD(MT), VYL(DT), B4(DT), L2(DT)))  \
+    SJF(EMITW(0xF0000257 | MXM(TmmM,    TmmM,    TmmM)))                    \
+        EMITW(0x10000088 | MXM(RYG(XD), RYG(XS), TmmM))
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subdx_rr(XG, XS)                                                    \
@@ -161,6 +161,15 @@
     SJF(EMITW(0x00000000 | MPM(TmmM,    MOD(MD), VYL(DD), B4(DD), U2(DD)))) \
     SJX(EMITW(0x00000000 | MPM(REG(XS), MOD(MD), VYL(DD), B4(DD), V2(DD))))
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment
+ * native SIMD load/store doesn't require alignment on this target */
+
+#define muvdx_ld(XD, MS, DS)                                                \
+        movdx_ld(W(XD), W(MS), W(DS))
+
+#define muvdx_st(XS, MD, DD)                                                \
+        movdx_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -693,12 +702,12 @@
 #define SMN64_256(xs, lb) /* not portable, do not use outside */            \
         EMITW(0xF0000495 | MXM(TmmM,    xs,      xs))                       \
         EMITW(0x10000486 | MXM(TmmM,    TmmM,    TmmQ))                     \
-        ASM_BEG ASM_OP2(beq, cr6, lb) ASM_END
+        JCC2(beq, bne, cr6, lb)
 
 #define SMF64_256(xs, lb) /* not portable, do not use outside */            \
         EMITW(0xF0000415 | MXM(TmmM,    xs,      xs))                       \
         EMITW(0x10000486 | MXM(TmmM,    TmmM,    TmmQ))                     \
-        ASM_BEG ASM_OP2(blt, cr6, lb) ASM_END
+        JCC2(blt, bge, cr6, lb)
 
 #define mkjdx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
         EMITW(0x1000038C | MXM(TmmQ,    0x1F,    0x00))                     \
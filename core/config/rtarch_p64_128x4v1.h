@@ -163,6 +163,15 @@
         EMITW(0x7C000798 | MXM(REG(XS), T2xx,    TPxx))                     \
         EMITW(0x7C000798 | MXM(RYG(XS), T3xx,    TPxx))
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment
+ * native SIMD load/store doesn't require alignment on this target */
+
+#define muvqx_ld(XD, MS, DS)                                                \
+        movqx_ld(W(XD), W(MS), W(DS))
+
+#define muvqx_st(XS, MD, DD)                                                \
+        movqx_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -836,7 +845,7 @@
         EMITW(0xF0000497 | MXM(TmmM,    TmmM,    TmmQ))                     \
         EMITW(0x1000038C | MXM(TmmQ,    0x1F,    0x00))                     \
         EMITW(0x10000486 | MXM(TmmM,    TmmM,    TmmQ))                     \
-        ASM_BEG ASM_OP2(beq, cr6, lb) ASM_END
+        JCC2(beq, bne, cr6, lb)
 
 #define SMF64_512(xs, lb) /* not portable, do not use outside */            \
         EMITW(0xF0000417 | MXM(TmmM,    xs,      xs+16))                    \
@@ -844,7 +853,7 @@
         EMITW(0xF0000417 | MXM(TmmM,    TmmM,    TmmQ))                     \
         EMITW(0x1000038C | MXM(TmmQ,    0x1F,    0x00))                     \
         EMITW(0x10000486 | MXM(TmmM,    TmmM,    TmmQ))                     \
-        ASM_BEG ASM_OP2(blt, cr6, lb) ASM_END
+        JCC2(blt, bge, cr6, lb)
 
 #define mkjqx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
         AUW(EMPTY, EMPTY, EMPTY, REG(XS), lb,                               \
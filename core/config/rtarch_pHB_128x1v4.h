@@ -117,6 +117,41 @@
 
 #if (RT_128X1 >= 4)
 
+/* store TmmM to (ra + TPxx) byte by byte for muv*x_st, destroys TPxx */
+
+#define MUB(ra)                                                             \
+        EMITW(0x7C00010E | MXM(TmmM,    (ra),    TPxx))                     \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | (+0x01 & 0xFFFF))  \
+        EMITW(0x7C00010E | MXM(TmmM,    (ra),    TPxx))                     \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | (+0x01 & 0xFFFF))  \
+        EMITW(0x7C00010E | MXM(TmmM,    (ra),    TPxx))                     \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | (+0x01 & 0xFFFF))  \
+        EMITW(0x7C00010E | MXM(TmmM,    (ra),    TPxx))                     \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | (+0x01 & 0xFFFF))  \
+        EMITW(0x7C00010E | MXM(TmmM,    (ra),    TPxx))                     \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | (+0x01 & 0xFFFF))  \
+        EMITW(0x7C00010E | MXM(TmmM,    (ra),    TPxx))                     \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | (+0x01 & 0xFFFF))  \
+        EMITW(0x7C00010E | MXM(TmmM,    (ra),    TPxx))                     \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | (+0x01 & 0xFFFF))  \
+        EMITW(0x7C00010E | MXM(TmmM,    (ra),    TPxx))                     \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | (+0x01 & 0xFFFF))  \
+        EMITW(0x7C00010E | MXM(TmmM,    (ra),    TPxx))                     \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | (+0x01 & 0xFFFF))  \
+        EMITW(0x7C00010E | MXM(TmmM,    (ra),    TPxx))                     \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | (+0x01 & 0xFFFF))  \
+        EMITW(0x7C00010E | MXM(TmmM,    (ra),    TPxx))                     \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | (+0x01 & 0xFFFF))  \
+        EMITW(0x7C00010E | MXM(TmmM,    (ra),    TPxx))                     \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | (+0x01 & 0xFFFF))  \
+        EMITW(0x7C00010E | MXM(TmmM,    (ra),    TPxx))                     \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | (+0x01 & 0xFFFF))  \
+        EMITW(0x7C00010E | MXM(TmmM,    (ra),    TPxx))                     \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | (+0x01 & 0xFFFF))  \
+        EMITW(0x7C00010E | MXM(TmmM,    (ra),    TPxx))                     \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | (+0x01 & 0xFFFF))  \
+        EMITW(0x7C00010E | MXM(TmmM,    (ra),    TPxx))
+
 /******************************************************************************/
 /********************************   EXTERNAL   ********************************/
 /******************************************************************************/
@@ -142,6 +177,48 @@
         EMITW(0x38000000 | MPM(TPxx,    REG(MD), VAL(DD), B2(DD), P2(DD)))  \
         EMITW(0x7C0001CE | MXM(REG(XS), Teax & M(MOD(MD) == TPxx), TPxx))
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment
+ * emulated with lvx/vperm (load) and byte stores on VMX
+ * (stores are done byte by byte, any alignment) */
+
+#if RT_ENDIAN == 1
+
+#define muvgx_ld(XD, MS, DS)                                                \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x7C00000C | MXM(TmmQ,    Teax & M(MOD(MS) == TPxx), TPxx))   \
+        EMITW(0x7C0000CE | MXM(REG(XD), Teax & M(MOD(MS) == TPxx), TPxx))   \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | (+0x0F & 0xFFFF))  \
+        EMITW(0x7C0000CE | MXM(TmmM,    Teax & M(MOD(MS) == TPxx), TPxx))   \
+        EMITW(0x1000002B | MXM(REG(XD), REG(XD), TmmM) | TmmQ << 6)
+
+#define muvgx_st(XS, MD, DD)                                                \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MD), VAL(DD), C2(DD), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MD), VAL(DD), B2(DD), P2(DD)))  \
+        EMITW(0x7C00004C | MXM(TmmQ,    Teax & M(MOD(MD) == TPxx), TPxx))   \
+        EMITW(0x1000002B | MXM(TmmM,    REG(XS), REG(XS)) | TmmQ << 6)      \
+        MUB(Teax & M(MOD(MD) == TPxx))
+
+#else /* RT_ENDIAN == 0 */
+
+#define muvgx_ld(XD, MS, DS)                                                \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x7C00004C | MXM(TmmQ,    Teax & M(MOD(MS) == TPxx), TPxx))   \
+        EMITW(0x7C0000CE | MXM(TmmM,    Teax & M(MOD(MS) == TPxx), TPxx))   \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | (+0x0F & 0xFFFF))  \
+        EMITW(0x7C0000CE | MXM(REG(XD), Teax & M(MOD(MS) == TPxx), TPxx))   \
+        EMITW(0x1000002B | MXM(REG(XD), REG(XD), TmmM) | TmmQ << 6)
+
+#define muvgx_st(XS, MD, DD)                                                \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MD), VAL(DD), C2(DD), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MD), VAL(DD), B2(DD), P2(DD)))  \
+        EMITW(0x7C00000C | MXM(TmmQ,    Teax & M(MOD(MD) == TPxx), TPxx))   \
+        EMITW(0x1000002B | MXM(TmmM,    REG(XS), REG(XS)) | TmmQ << 6)      \
+        MUB(Teax & M(MOD(MD) == TPxx))
+
+#endif /* RT_ENDIAN */
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -751,10 +828,10 @@
 /* #define S1(mask)    S##mask             (defined in 32_128-bit header) */
 
 #define SMN16_128(xs, lb) /* not portable, do not use outside */            \
-        ASM_BEG ASM_OP2(beq, cr6, lb) ASM_END
+        JCC2(beq, bne, cr6, lb)
 
 #define SMF16_128(xs, lb) /* not portable, do not use outside */            \
-        ASM_BEG ASM_OP2(blt, cr6, lb) ASM_END
+        JCC2(blt, bge, cr6, lb)
 
 #define mkjgx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
         EMITW(0x1000038C | MXM(TmmQ,    0x1F,    0x00))                     \
@@ -1334,10 +1411,10 @@
 /* #define S1(mask)    S##mask             (defined in 32_128-bit header) */
 
 #define SMN08_128(xs, lb) /* not portable, do not use outside */            \
-        ASM_BEG ASM_OP2(beq, cr6, lb) ASM_END
+        JCC2(beq, bne, cr6, lb)
 
 #define SMF08_128(xs, lb) /* not portable, do not use outside */            \
-        ASM_BEG ASM_OP2(blt, cr6, lb) ASM_END
+        JCC2(blt, bge, cr6, lb)
 
 #define mkjgb_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
         EMITW(0x1000038C | MXM(TmmQ,    0x1F,    0x00))                     \
@@ -188,6 +188,18 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment */
+
+#define muvix_ld(XD, MS, DS)                                                \
+    ADR REX(RXB(XD), RXB(MS)) EMITB(0x0F) EMITB(0x10)                       \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define muvix_st(XS, MD, DD)                                                \
+    ADR REX(RXB(XS), RXB(MD)) EMITB(0x0F) EMITB(0x11)                       \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -224,6 +236,46 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0x14)           \
         orrix_rr(Xmm0, W(XS))                                               \
         movix_st(Xmm0, W(MG), W(DG))
 
+/* unl (G = G unpack-low S), (D = S unpack-low T) if (#D != #T)
+ * interleaves lower halves of each 128-bit lane, S-elements go first */
+
+#define unlix_rr(XG, XS)                                                    \
+        REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0x14)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define unlix_ld(XG, MS, DS)                                                \
+    ADR REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x14)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define unlix3rr(XD, XS, XT)                                                \
+        movix_rr(W(XD), W(XS))                                              \
+        unlix_rr(W(XD), W(XT))
+
+#define unlix3ld(XD, XS, MT, DT)                                            \
+        movix_rr(W(XD), W(XS))                                              \
+        unlix_ld(W(XD), W(MT), W(DT))
+
+/* unh (G = G unpack-high S), (D = S unpack-high T) if (#D != #T)
+ * interleaves upper halves of each 128-bit lane, S-elements go first */
+
+#define unhix_rr(XG, XS)                                                    \
+        REX(RXB(XG), RXB(XS)) EMITB(0x0F) EMITB(0x15)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define unhix_ld(XG, MS, DS)                                                \
+    ADR REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x15)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define unhix3rr(XD, XS, XT)                                                \
+        movix_rr(W(XD), W(XS))                                              \
+        unhix_rr(W(XD), W(XT))
+
+#define unhix3ld(XD, XS, MT, DT)                                            \
+        movix_rr(W(XD), W(XS))                                              \
+        unhix_ld(W(XD), W(MT), W(DT))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andix_rr(XG, XS)                                                    \
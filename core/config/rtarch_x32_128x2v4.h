@@ -171,6 +171,24 @@
         MRM(REG(XS),    0x02, REG(MD))                                      \
         AUX(SIB(MD), EMITW(VYL(DD)), EMPTY)
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment */
+
+#define muvcx_ld(XD, MS, DS)                                                \
+    ADR REX(0,       RXB(MS)) EMITB(0x0F) EMITB(0x10)                       \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VAL(DS)), EMPTY)                                 \
+    ADR REX(1,       RXB(MS)) EMITB(0x0F) EMITB(0x10)                       \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VYL(DS)), EMPTY)
+
+#define muvcx_st(XS, MD, DD)                                                \
+    ADR REX(0,       RXB(MD)) EMITB(0x0F) EMITB(0x11)                       \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)                                 \
+    ADR REX(1,       RXB(MD)) EMITB(0x0F) EMITB(0x11)                       \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VYL(DD)), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -192,6 +210,64 @@
         orrcx_rr(Xmm0, W(XS))                                               \
         movcx_st(Xmm0, W(MG), W(DG))
 
+/* unl (G = G unpack-low S), (D = S unpack-low T) if (#D != #T)
+ * interleaves lower halves of each 128-bit lane, S-elements go first */
+
+#undef  unlcx_rr
+#define unlcx_rr(XG, XS)                                                    \
+        REX(0,             0) EMITB(0x0F) EMITB(0x14)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))                                      \
+        REX(1,             1) EMITB(0x0F) EMITB(0x14)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#undef  unlcx_ld
+#define unlcx_ld(XG, MS, DS)                                                \
+    ADR REX(0,       RXB(MS)) EMITB(0x0F) EMITB(0x14)                       \
+        MRM(REG(XG),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VAL(DS)), EMPTY)                                 \
+    ADR REX(1,       RXB(MS)) EMITB(0x0F) EMITB(0x14)                       \
+        MRM(REG(XG),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VYL(DS)), EMPTY)
+
+#undef  unlcx3rr
+#define unlcx3rr(XD, XS, XT)                                                \
+        movcx_rr(W(XD), W(XS))                                              \
+        unlcx_rr(W(XD), W(XT))
+
+#undef  unlcx3ld
+#define unlcx3ld(XD, XS, MT, DT)                                            \
+        movcx_rr(W(XD), W(XS))                                              \
+        unlcx_ld(W(XD), W(MT), W(DT))
+
+/* unh (G = G unpack-high S), (D = S unpack-high T) if (#D != #T)
+ * interleaves upper halves of each 128-bit lane, S-elements go first */
+
+#undef  unhcx_rr
+#define unhcx_rr(XG, XS)                                                    \
+        REX(0,             0) EMITB(0x0F) EMITB(0x15)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))                                      \
+        REX(1,             1) EMITB(0x0F) EMITB(0x15)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#undef  unhcx_ld
+#define unhcx_ld(XG, MS, DS)                                                \
+    ADR REX(0,       RXB(MS)) EMITB(0x0F) EMITB(0x15)                       \
+        MRM(REG(XG),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VAL(DS)), EMPTY)                                 \
+    ADR REX(1,       RXB(MS)) EMITB(0x0F) EMITB(0x15)                       \
+        MRM(REG(XG),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VYL(DS)), EMPTY)
+
+#undef  unhcx3rr
+#define unhcx3rr(XD, XS, XT)                                                \
+        movcx_rr(W(XD), W(XS))                                              \
+        unhcx_rr(W(XD), W(XT))
+
+#undef  unhcx3ld
+#define unhcx3ld(XD, XS, MT, DT)                                            \
+        movcx_rr(W(XD), W(XS))                                              \
+        unhcx_ld(W(XD), W(MT), W(DT))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andcx_rr(XG, XS)                                                    \
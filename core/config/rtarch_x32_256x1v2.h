@@ -163,6 +163,18 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment */
+
+#define muvcx_ld(XD, MS, DS)                                                \
+    ADR VEX(RXB(XD), RXB(MS),    0x00, 1, 0, 1) EMITB(0x10)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define muvcx_st(XS, MD, DD)                                                \
+    ADR VEX(RXB(XS), RXB(MD),    0x00, 1, 0, 1) EMITB(0x11)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -181,6 +193,50 @@
         MRM(REG(XS), MOD(MG), REG(MG))                                      \
         AUX(SIB(MG), CMD(DG), EMPTY)
 
+/* unl (G = G unpack-low S), (D = S unpack-low T) if (#D != #T)
+ * interleaves lower halves of each 128-bit lane, S-elements go first */
+
+#undef  unlcx_rr
+#define unlcx_rr(XG, XS)                                                    \
+        unlcx3rr(W(XG), W(XG), W(XS))
+
+#undef  unlcx_ld
+#define unlcx_ld(XG, MS, DS)                                                \
+        unlcx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#undef  unlcx3rr
+#define unlcx3rr(XD, XS, XT)                                                \
+        VEX(RXB(XD), RXB(XT), REN(XS), 1, 0, 1) EMITB(0x14)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#undef  unlcx3ld
+#define unlcx3ld(XD, XS, MT, DT)                                            \
+    ADR VEX(RXB(XD), RXB(MT), REN(XS), 1, 0, 1) EMITB(0x14)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* unh (G = G unpack-high S), (D = S unpack-high T) if (#D != #T)
+ * interleaves upper halves of each 128-bit lane, S-elements go first */
+
+#undef  unhcx_rr
+#define unhcx_rr(XG, XS)                                                    \
+        unhcx3rr(W(XG), W(XG), W(XS))
+
+#undef  unhcx_ld
+#define unhcx_ld(XG, MS, DS)                                                \
+        unhcx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#undef  unhcx3rr
+#define unhcx3rr(XD, XS, XT)                                                \
+        VEX(RXB(XD), RXB(XT), REN(XS), 1, 0, 1) EMITB(0x15)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#undef  unhcx3ld
+#define unhcx3ld(XD, XS, MT, DT)                                            \
+    ADR VEX(RXB(XD), RXB(MT), REN(XS), 1, 0, 1) EMITB(0x15)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andcx_rr(XG, XS)                                                    \
@@ -1798,24 +1854,24 @@
 
 #if   (RT_SIMD == 256)
 
-#define muvcx_ld(XD, MS, DS) /* not portable, do not use outside */         \
+#define muvyx_ld(XD, MS, DS) /* not portable, do not use outside */         \
     ADR VEX(RXB(XD), RXB(MS),    0x00, 1, 0, 1) EMITB(0x28)                 \
         MRM(REG(XD), MOD(MS), REG(MS))                                      \
         AUX(SIB(MS), CMD(DS), EMPTY)
 
-#define muvcx_st(XS, MD, DD) /* not portable, do not use outside */         \
+#define muvyx_st(XS, MD, DD) /* not portable, do not use outside */         \
     ADR VEX(RXB(XS), RXB(MD),    0x00, 1, 0, 1) EMITB(0x29)                 \
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
 #elif (RT_SIMD == 128)
 
-#define muvcx_ld(XD, MS, DS) /* not portable, do not use outside */         \
+#define muvyx_ld(XD, MS, DS) /* not portable, do not use outside */         \
     ADR VEX(RXB(XD), RXB(MS),    0x00, 1, 0, 1) EMITB(0x10)                 \
         MRM(REG(XD), MOD(MS), REG(MS))                                      \
         AUX(SIB(MS), CMD(DS), EMPTY)
 
-#define muvcx_st(XS, MD, DD) /* not portable, do not use outside */         \
+#define muvyx_st(XS, MD, DD) /* not portable, do not use outside */         \
     ADR VEX(RXB(XS), RXB(MD),    0x00, 1, 0, 1) EMITB(0x11)                 \
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
@@ -1827,72 +1883,72 @@
 #undef  sregs_sa
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        muvcx_st(Xmm0, Oeax, PLAIN)                                         \
+        muvyx_st(Xmm0, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm1, Oeax, PLAIN)                                         \
+        muvyx_st(Xmm1, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm2, Oeax, PLAIN)                                         \
+        muvyx_st(Xmm2, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm3, Oeax, PLAIN)                                         \
+        muvyx_st(Xmm3, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm4, Oeax, PLAIN)                                         \
+        muvyx_st(Xmm4, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm5, Oeax, PLAIN)                                         \
+        muvyx_st(Xmm5, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm6, Oeax, PLAIN)                                         \
+        muvyx_st(Xmm6, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm7, Oeax, PLAIN)                                         \
+        muvyx_st(Xmm7, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm8, Oeax, PLAIN)                                         \
+        muvyx_st(Xmm8, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm9, Oeax, PLAIN)                                         \
+        muvyx_st(Xmm9, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(XmmA, Oeax, PLAIN)                                         \
+        muvyx_st(XmmA, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(XmmB, Oeax, PLAIN)                                         \
+        muvyx_st(XmmB, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(XmmC, Oeax, PLAIN)                                         \
+        muvyx_st(XmmC, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(XmmD, Oeax, PLAIN)                                         \
+        muvyx_st(XmmD, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(XmmE, Oeax, PLAIN)                                         \
+        muvyx_st(XmmE, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(XmmF, Oeax, PLAIN)
+        muvyx_st(XmmF, Oeax, PLAIN)
 
 #undef  sregs_la
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        muvcx_ld(Xmm0, Oeax, PLAIN)                                         \
+        muvyx_ld(Xmm0, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm1, Oeax, PLAIN)                                         \
+        muvyx_ld(Xmm1, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm2, Oeax, PLAIN)                                         \
+        muvyx_ld(Xmm2, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm3, Oeax, PLAIN)                                         \
+        muvyx_ld(Xmm3, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm4, Oeax, PLAIN)                                         \
+        muvyx_ld(Xmm4, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm5, Oeax, PLAIN)                                         \
+        muvyx_ld(Xmm5, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm6, Oeax, PLAIN)                                         \
+        muvyx_ld(Xmm6, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm7, Oeax, PLAIN)                                         \
+        muvyx_ld(Xmm7, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm8, Oeax, PLAIN)                                         \
+        muvyx_ld(Xmm8, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm9, Oeax, PLAIN)                                         \
+        muvyx_ld(Xmm9, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(XmmA, Oeax, PLAIN)                                         \
+        muvyx_ld(XmmA, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(XmmB, Oeax, PLAIN)                                         \
+        muvyx_ld(XmmB, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(XmmC, Oeax, PLAIN)                                         \
+        muvyx_ld(XmmC, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(XmmD, Oeax, PLAIN)                                         \
+        muvyx_ld(XmmD, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(XmmE, Oeax, PLAIN)                                         \
+        muvyx_ld(XmmE, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(XmmF, Oeax, PLAIN)
+        muvyx_ld(XmmF, Oeax, PLAIN)
 
 #endif /* RT_256X1 */
 
@@ -171,6 +171,18 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment */
+
+#define muvcx_ld(XD, MS, DS)                                                \
+    ADR EVX(RXB(XD), RXB(MS),    0x00, 1, 0, 1) EMITB(0x10)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define muvcx_st(XS, MD, DD)                                                \
+    ADR EVX(RXB(XS), RXB(MD),    0x00, 1, 0, 1) EMITB(0x11)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -191,6 +203,50 @@
         MRM(REG(XS), MOD(MG), REG(MG))                                      \
         AUX(SIB(MG), CMD(DG), EMPTY)
 
+/* unl (G = G unpack-low S), (D = S unpack-low T) if (#D != #T)
+ * interleaves lower halves of each 128-bit lane, S-elements go first */
+
+#undef  unlcx_rr
+#define unlcx_rr(XG, XS)                                                    \
+        unlcx3rr(W(XG), W(XG), W(XS))
+
+#undef  unlcx_ld
+#define unlcx_ld(XG, MS, DS)                                                \
+        unlcx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#undef  unlcx3rr
+#define unlcx3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), 1, 0, 1) EMITB(0x14)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#undef  unlcx3ld
+#define unlcx3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), 1, 0, 1) EMITB(0x14)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* unh (G = G unpack-high S), (D = S unpack-high T) if (#D != #T)
+ * interleaves upper halves of each 128-bit lane, S-elements go first */
+
+#undef  unhcx_rr
+#define unhcx_rr(XG, XS)                                                    \
+        unhcx3rr(W(XG), W(XG), W(XS))
+
+#undef  unhcx_ld
+#define unhcx_ld(XG, MS, DS)                                                \
+        unhcx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#undef  unhcx3rr
+#define unhcx3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), 1, 0, 1) EMITB(0x15)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#undef  unhcx3ld
+#define unhcx3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), 1, 0, 1) EMITB(0x15)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andcx_rr(XG, XS)                                                    \
@@ -1249,12 +1305,12 @@
 
 #define RT_SIMD_WIDTH32_512 16
 
-#define muvox_ld(XD, MS, DS)                                                \
+#define muvzx_ld(XD, MS, DS) /* not portable, do not use outside */         \
     ADR EVX(RXB(XD), RXB(MS),    0x00, 2, 0, 1) EMITB(0x10)                 \
         MRM(REG(XD), MOD(MS), REG(MS))                                      \
         AUX(SIB(MS), CMD(DS), EMPTY)
 
-#define muvox_st(XS, MD, DD)                                                \
+#define muvzx_st(XS, MD, DD) /* not portable, do not use outside */         \
     ADR EVX(RXB(XS), RXB(MD),    0x00, 2, 0, 1) EMITB(0x11)                 \
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
@@ -1264,65 +1320,65 @@
 #undef  sregs_sa
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        muvox_st(Xmm0, Oeax, PLAIN)                                         \
+        muvzx_st(Xmm0, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm1, Oeax, PLAIN)                                         \
+        muvzx_st(Xmm1, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm2, Oeax, PLAIN)                                         \
+        muvzx_st(Xmm2, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm3, Oeax, PLAIN)                                         \
+        muvzx_st(Xmm3, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm4, Oeax, PLAIN)                                         \
+        muvzx_st(Xmm4, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm5, Oeax, PLAIN)                                         \
+        muvzx_st(Xmm5, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm6, Oeax, PLAIN)                                         \
+        muvzx_st(Xmm6, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm7, Oeax, PLAIN)                                         \
+        muvzx_st(Xmm7, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm8, Oeax, PLAIN)                                         \
+        muvzx_st(Xmm8, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm9, Oeax, PLAIN)                                         \
+        muvzx_st(Xmm9, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmA, Oeax, PLAIN)                                         \
+        muvzx_st(XmmA, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmB, Oeax, PLAIN)                                         \
+        muvzx_st(XmmB, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmC, Oeax, PLAIN)                                         \
+        muvzx_st(XmmC, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmD, Oeax, PLAIN)                                         \
+        muvzx_st(XmmD, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmE, Oeax, PLAIN)                                         \
+        muvzx_st(XmmE, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmF, Oeax, PLAIN)                                         \
+        muvzx_st(XmmF, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmG, Oeax, PLAIN)                                         \
+        muvzx_st(XmmG, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmH, Oeax, PLAIN)                                         \
+        muvzx_st(XmmH, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmI, Oeax, PLAIN)                                         \
+        muvzx_st(XmmI, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmJ, Oeax, PLAIN)                                         \
+        muvzx_st(XmmJ, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmK, Oeax, PLAIN)                                         \
+        muvzx_st(XmmK, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmL, Oeax, PLAIN)                                         \
+        muvzx_st(XmmL, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmM, Oeax, PLAIN)                                         \
+        muvzx_st(XmmM, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmN, Oeax, PLAIN)                                         \
+        muvzx_st(XmmN, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmO, Oeax, PLAIN)                                         \
+        muvzx_st(XmmO, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmP, Oeax, PLAIN)                                         \
+        muvzx_st(XmmP, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmQ, Oeax, PLAIN)                                         \
+        muvzx_st(XmmQ, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmR, Oeax, PLAIN)                                         \
+        muvzx_st(XmmR, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmS, Oeax, PLAIN)                                         \
+        muvzx_st(XmmS, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmT, Oeax, PLAIN)                                         \
+        muvzx_st(XmmT, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
         VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
         MRM(0x01,       0x00,    0x00)                                      \
@@ -1345,65 +1401,65 @@
 #undef  sregs_la
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        muvox_ld(Xmm0, Oeax, PLAIN)                                         \
+        muvzx_ld(Xmm0, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm1, Oeax, PLAIN)                                         \
+        muvzx_ld(Xmm1, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm2, Oeax, PLAIN)                                         \
+        muvzx_ld(Xmm2, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm3, Oeax, PLAIN)                                         \
+        muvzx_ld(Xmm3, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm4, Oeax, PLAIN)                                         \
+        muvzx_ld(Xmm4, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm5, Oeax, PLAIN)                                         \
+        muvzx_ld(Xmm5, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm6, Oeax, PLAIN)                                         \
+        muvzx_ld(Xmm6, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm7, Oeax, PLAIN)                                         \
+        muvzx_ld(Xmm7, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm8, Oeax, PLAIN)                                         \
+        muvzx_ld(Xmm8, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm9, Oeax, PLAIN)                                         \
+        muvzx_ld(Xmm9, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmA, Oeax, PLAIN)                                         \
+        muvzx_ld(XmmA, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmB, Oeax, PLAIN)                                         \
+        muvzx_ld(XmmB, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmC, Oeax, PLAIN)                                         \
+        muvzx_ld(XmmC, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmD, Oeax, PLAIN)                                         \
+        muvzx_ld(XmmD, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmE, Oeax, PLAIN)                                         \
+        muvzx_ld(XmmE, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmF, Oeax, PLAIN)                                         \
+        muvzx_ld(XmmF, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmG, Oeax, PLAIN)                                         \
+        muvzx_ld(XmmG, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmH, Oeax, PLAIN)                                         \
+        muvzx_ld(XmmH, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmI, Oeax, PLAIN)                                         \
+        muvzx_ld(XmmI, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmJ, Oeax, PLAIN)                                         \
+        muvzx_ld(XmmJ, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmK, Oeax, PLAIN)                                         \
+        muvzx_ld(XmmK, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmL, Oeax, PLAIN)                                         \
+        muvzx_ld(XmmL, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmM, Oeax, PLAIN)                                         \
+        muvzx_ld(XmmM, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmN, Oeax, PLAIN)                                         \
+        muvzx_ld(XmmN, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmO, Oeax, PLAIN)                                         \
+        muvzx_ld(XmmO, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmP, Oeax, PLAIN)                                         \
+        muvzx_ld(XmmP, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmQ, Oeax, PLAIN)                                         \
+        muvzx_ld(XmmQ, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmR, Oeax, PLAIN)                                         \
+        muvzx_ld(XmmR, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmS, Oeax, PLAIN)                                         \
+        muvzx_ld(XmmS, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmT, Oeax, PLAIN)                                         \
+        muvzx_ld(XmmT, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
         VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
         MRM(0x01,       0x00,    0x00)                                      \
@@ -171,6 +171,24 @@
         MRM(REG(XS),    0x02, REG(MD))                                      \
         AUX(SIB(MD), EMITW(VXL(DD)), EMPTY)
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment */
+
+#define muvox_ld(XD, MS, DS)                                                \
+    ADR VEX(0,       RXB(MS),    0x00, 1, 0, 1) EMITB(0x10)                 \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VAL(DS)), EMPTY)                                 \
+    ADR VEX(1,       RXB(MS),    0x00, 1, 0, 1) EMITB(0x10)                 \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VXL(DS)), EMPTY)
+
+#define muvox_st(XS, MD, DD)                                                \
+    ADR VEX(0,       RXB(MD),    0x00, 1, 0, 1) EMITB(0x11)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)                                 \
+    ADR VEX(1,       RXB(MD),    0x00, 1, 0, 1) EMITB(0x11)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VXL(DD)), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -198,6 +216,60 @@
         MRM(REG(XS),    0x02, REG(MG))                                      \
         AUX(SIB(MG), EMITW(VXL(DG)), EMPTY)
 
+/* unl (G = G unpack-low S), (D = S unpack-low T) if (#D != #T)
+ * interleaves lower halves of each 128-bit lane, S-elements go first */
+
+#undef  unlox_rr
+#define unlox_rr(XG, XS)                                                    \
+        unlox3rr(W(XG), W(XG), W(XS))
+
+#undef  unlox_ld
+#define unlox_ld(XG, MS, DS)                                                \
+        unlox3ld(W(XG), W(XG), W(MS), W(DS))
+
+#undef  unlox3rr
+#define unlox3rr(XD, XS, XT)                                                \
+        VEX(0,             0, REG(XS), 1, 0, 1) EMITB(0x14)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        VEX(1,             1, REH(XS), 1, 0, 1) EMITB(0x14)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#undef  unlox3ld
+#define unlox3ld(XD, XS, MT, DT)                                            \
+    ADR VEX(0,       RXB(MT), REG(XS), 1, 0, 1) EMITB(0x14)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)                                 \
+    ADR VEX(1,       RXB(MT), REH(XS), 1, 0, 1) EMITB(0x14)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VXL(DT)), EMPTY)
+
+/* unh (G = G unpack-high S), (D = S unpack-high T) if (#D != #T)
+ * interleaves upper halves of each 128-bit lane, S-elements go first */
+
+#undef  unhox_rr
+#define unhox_rr(XG, XS)                                                    \
+        unhox3rr(W(XG), W(XG), W(XS))
+
+#undef  unhox_ld
+#define unhox_ld(XG, MS, DS)                                                \
+        unhox3ld(W(XG), W(XG), W(MS), W(DS))
+
+#undef  unhox3rr
+#define unhox3rr(XD, XS, XT)                                                \
+        VEX(0,             0, REG(XS), 1, 0, 1) EMITB(0x15)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        VEX(1,             1, REH(XS), 1, 0, 1) EMITB(0x15)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#undef  unhox3ld
+#define unhox3ld(XD, XS, MT, DT)                                            \
+    ADR VEX(0,       RXB(MT), REG(XS), 1, 0, 1) EMITB(0x15)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)                                 \
+    ADR VEX(1,       RXB(MT), REH(XS), 1, 0, 1) EMITB(0x15)                 \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VXL(DT)), EMPTY)
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andox_rr(XG, XS)                                                    \
@@ -196,6 +196,18 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment */
+
+#define muvox_ld(XD, MS, DS)                                                \
+    ADR EVX(RXB(XD), RXB(MS),    0x00, K, 0, 1) EMITB(0x10)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define muvox_st(XS, MD, DD)                                                \
+    ADR EVX(RXB(XS), RXB(MD),    0x00, K, 0, 1) EMITB(0x11)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -216,6 +228,50 @@
         MRM(REG(XS), MOD(MG), REG(MG))                                      \
         AUX(SIB(MG), CMD(DG), EMPTY)
 
+/* unl (G = G unpack-low S), (D = S unpack-low T) if (#D != #T)
+ * interleaves lower halves of each 128-bit lane, S-elements go first */
+
+#undef  unlox_rr
+#define unlox_rr(XG, XS)                                                    \
+        unlox3rr(W(XG), W(XG), W(XS))
+
+#undef  unlox_ld
+#define unlox_ld(XG, MS, DS)                                                \
+        unlox3ld(W(XG), W(XG), W(MS), W(DS))
+
+#undef  unlox3rr
+#define unlox3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 0, 1) EMITB(0x14)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#undef  unlox3ld
+#define unlox3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 0, 1) EMITB(0x14)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* unh (G = G unpack-high S), (D = S unpack-high T) if (#D != #T)
+ * interleaves upper halves of each 128-bit lane, S-elements go first */
+
+#undef  unhox_rr
+#define unhox_rr(XG, XS)                                                    \
+        unhox3rr(W(XG), W(XG), W(XS))
+
+#undef  unhox_ld
+#define unhox_ld(XG, MS, DS)                                                \
+        unhox3ld(W(XG), W(XG), W(MS), W(DS))
+
+#undef  unhox3rr
+#define unhox3rr(XD, XS, XT)                                                \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 0, 1) EMITB(0x15)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#undef  unhox3ld
+#define unhox3ld(XD, XS, MT, DT)                                            \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 0, 1) EMITB(0x15)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
 #if (RT_512X1 == 1 || RT_512X1 == 4)
 
 /* and (G = G & S), (D = S & T) if (#D != #T) */
@@ -1101,6 +1101,55 @@
 #define mulzp_xm(MS, DS) /* Reax is in/out, prepares Redx for divzn_x* */   \
         mulzn_xm(W(MS), W(DS))/* product must not exceed operands size */
 
+/* mhi (G = G * S >> 64), high half of full 64x64-bit product
+ * set-flags: undefined
+ * low half is given by mulzx_**, both halves at once by mulz*_x*
+ * x86 has no 3-operand form, goes through Reax/Redx and inf_SCR01 */
+
+#define mhizx_rr(RG, RS)                                                    \
+        movzx_st(W(RG), Mebp, inf_SCR01(0))                                 \
+        stack_st(Reax)                                                      \
+        stack_st(Redx)                                                      \
+        movzx_rr(Reax, W(RS))                                               \
+        mulzx_xm(Mebp, inf_SCR01(0))                                        \
+        movzx_st(Redx, Mebp, inf_SCR01(0))                                  \
+        stack_ld(Redx)                                                      \
+        stack_ld(Reax)                                                      \
+        movzx_ld(W(RG), Mebp, inf_SCR01(0))
+
+#define mhizx_ld(RG, MS, DS)                                                \
+        movzx_st(W(RG), Mebp, inf_SCR01(0))                                 \
+        stack_st(Reax)                                                      \
+        stack_st(Redx)                                                      \
+        movzx_ld(Reax, W(MS), W(DS))                                        \
+        mulzx_xm(Mebp, inf_SCR01(0))                                        \
+        movzx_st(Redx, Mebp, inf_SCR01(0))                                  \
+        stack_ld(Redx)                                                      \
+        stack_ld(Reax)                                                      \
+        movzx_ld(W(RG), Mebp, inf_SCR01(0))
+
+#define mhizn_rr(RG, RS)                                                    \
+        movzx_st(W(RG), Mebp, inf_SCR01(0))                                 \
+        stack_st(Reax)                                                      \
+        stack_st(Redx)                                                      \
+        movzx_rr(Reax, W(RS))                                               \
+        mulzn_xm(Mebp, inf_SCR01(0))                                        \
+        movzx_st(Redx, Mebp, inf_SCR01(0))                                  \
+        stack_ld(Redx)                                                      \
+        stack_ld(Reax)                                                      \
+        movzx_ld(W(RG), Mebp, inf_SCR01(0))
+
+#define mhizn_ld(RG, MS, DS)                                                \
+        movzx_st(W(RG), Mebp, inf_SCR01(0))                                 \
+        stack_st(Reax)                                                      \
+        stack_st(Redx)                                                      \
+        movzx_ld(Reax, W(MS), W(DS))                                        \
+        mulzn_xm(Mebp, inf_SCR01(0))                                        \
+        movzx_st(Redx, Mebp, inf_SCR01(0))                                  \
+        stack_ld(Redx)                                                      \
+        stack_ld(Reax)                                                      \
+        movzx_ld(W(RG), Mebp, inf_SCR01(0))
+
 /* div (G = G / S)
  * set-flags: undefined */
 
@@ -1434,6 +1483,126 @@
         REW(RXB(RT),       1) EMITB(0x39)                                   \
         MRM(REG(RT),    0x03,    0x07)
 
+/* xad (G = M, M = M + G), atomic fetch-add
+ * set-flags: undefined
+ * xad, xch, cas need natural alignment of memory args
+ * and are sequentially consistent (act as full memory barriers) */
+
+#define xadzx_st(RG, MG, DG)                                                \
+    ADR EMITB(0xF0) REW(RXB(RG), RXB(MG)) EMITB(0x0F) EMITB(0xC1)           \
+        MRM(REG(RG), MOD(MG), REG(MG))                                      \
+        AUX(SIB(MG), CMD(DG), EMPTY)
+
+/* xch (G = M, M = G), atomic exchange
+ * set-flags: undefined */
+
+#define xchzx_st(RG, MG, DG)                                                \
+    ADR REW(RXB(RG), RXB(MG)) EMITB(0x87)                                   \
+        MRM(REG(RG), MOD(MG), REG(MG))                                      \
+        AUX(SIB(MG), CMD(DG), EMPTY)
+
+/* cas (if M == Reax then M = S, Reax = M), atomic compare-and-swap
+ * set-flags: undefined
+ * success is checked by comparing Reax to its value before cas */
+
+#define caszx_st(RS, MG, DG)     /* Reax is in/out, RS, MG != Reax */       \
+    ADR EMITB(0xF0) REW(RXB(RS), RXB(MG)) EMITB(0x0F) EMITB(0xB1)           \
+        MRM(REG(RS), MOD(MG), REG(MG))                                      \
+        AUX(SIB(MG), CMD(DG), EMPTY)
+
+/* cnt (D = number of set bits in S), population count
+ * set-flags: undefined */
+
+#if RT_BASE_COMPAT_BMI < 2 /* 0 - generic, 1 - 3-op-VEX, 2 - BMI1+BMI2 */
+
+#define cntzx_rr(RD, RS)                                                    \
+        REW(1,       RXB(RS)) EMITB(0x8B)                                   \
+        MRM(0x07,    MOD(RS), REG(RS))                                      \
+        REW(RXB(RD), RXB(RD)) EMITB(0x33)                                   \
+        MRM(REG(RD), MOD(RD), REG(RD))                                      \
+        REW(0,             1) EMITB(0xD1) /* <- shr r15, 1 */               \
+        MRM(0x05,       0x03,    0x07)                                      \
+        REW(0,       RXB(RD)) EMITB(0x83) /* <- adc RD, 0 */                \
+        MRM(0x02,    MOD(RD), REG(RD))                                      \
+        EMITB(0x00)                                                         \
+        REW(1,             1) EMITB(0x85) /* <- test r15, r15 */            \
+        MRM(0x07,       0x03,    0x07)                                      \
+        EMITB(0x75) EMITB(0xF4)          /* <- jnz shr */
+
+#else /* RT_BASE_COMPAT_BMI >= 2 */
+
+#define cntzx_rr(RD, RS)                                                    \
+        EMITB(0xF3) REW(RXB(RD), RXB(RS)) EMITB(0x0F) EMITB(0xB8)           \
+        MRM(REG(RD), MOD(RS), REG(RS))
+
+#endif /* RT_BASE_COMPAT_BMI >= 2 */
+
+/* clz (D = number of leading zeros in S)
+ * set-flags: undefined
+ * clz, ctz return operand size in bits for zero source */
+
+#if RT_BASE_COMPAT_BMI < 2 /* 0 - generic, 1 - 3-op-VEX, 2 - BMI1+BMI2 */
+
+#define clzzx_rr(RD, RS)                                                    \
+        REW(RXB(RD), RXB(RS)) EMITB(0x0F) EMITB(0xBD)                       \
+        MRM(REG(RD), MOD(RS), REG(RS))   /* <- bsr RD, RS */                \
+        EMITB(0x75) EMITB(0x07)          /* <- jnz xor */                   \
+        REW(0,       RXB(RD)) EMITB(0xC7)                                   \
+        MRM(0x00,    MOD(RD), REG(RD))                                      \
+        EMITW(0x0000007F)                                                   \
+        REW(0,       RXB(RD)) EMITB(0x83)                                   \
+        MRM(0x06,    MOD(RD), REG(RD))   /* <- xor RD, 63 */                \
+        EMITB(0x3F)
+
+#else /* RT_BASE_COMPAT_BMI >= 2 */
+
+#define clzzx_rr(RD, RS)                                                    \
+        EMITB(0xF3) REW(RXB(RD), RXB(RS)) EMITB(0x0F) EMITB(0xBD)           \
+        MRM(REG(RD), MOD(RS), REG(RS))
+
+#endif /* RT_BASE_COMPAT_BMI >= 2 */
+
+/* ctz (D = number of trailing zeros in S)
+ * set-flags: undefined */
+
+#if RT_BASE_COMPAT_BMI < 2 /* 0 - generic, 1 - 3-op-VEX, 2 - BMI1+BMI2 */
+
+#define ctzzx_rr(RD, RS)                                                    \
+        REW(RXB(RD), RXB(RS)) EMITB(0x0F) EMITB(0xBC)                       \
+        MRM(REG(RD), MOD(RS), REG(RS))   /* <- bsf RD, RS */                \
+        EMITB(0x75) EMITB(0x07)          /* <- jnz end */                   \
+        REW(0,       RXB(RD)) EMITB(0xC7)                                   \
+        MRM(0x00,    MOD(RD), REG(RD))                                      \
+        EMITW(0x00000040)
+
+#else /* RT_BASE_COMPAT_BMI >= 2 */
+
+#define ctzzx_rr(RD, RS)                                                    \
+        EMITB(0xF3) REW(RXB(RD), RXB(RS)) EMITB(0x0F) EMITB(0xBC)           \
+        MRM(REG(RD), MOD(RS), REG(RS))
+
+#endif /* RT_BASE_COMPAT_BMI >= 2 */
+
+/* bsw (D = S with bytes in reversed order), byte swap
+ * set-flags: undefined */
+
+#define bswzx_rr(RD, RS)                                                    \
+        REW(RXB(RD), RXB(RS)) EMITB(0x8B)                                   \
+        MRM(REG(RD), MOD(RS), REG(RS))                                      \
+        REW(0,       RXB(RD)) EMITB(0x0F) EMITB(0xC8 | REG(RD))
+
+/* bfx (G = G >> IS & ((1 << IT) - 1)), unsigned bit-field extract
+ * set-flags: undefined
+ * IT > 0, IS + IT <= 64 */
+
+#define bfxzx_ri(RG, IS, IT)                                                \
+        REW(0,       RXB(RG)) EMITB(0xC1)                                   \
+        MRM(0x04,    MOD(RG), REG(RG))                                      \
+        EMITB((64-VAL(IS)-VAL(IT)) & 0x3F)                                  \
+        REW(0,       RXB(RG)) EMITB(0xC1)                                   \
+        MRM(0x05,    MOD(RG), REG(RG))                                      \
+        EMITB((64-VAL(IT)) & 0x3F)
+
 /* ver (Mebp/inf_VER = SIMD-version)
  * set-flags: no
  * For interpretation of SIMD build flags check compatibility layer in rtzero.h
@@ -1279,6 +1279,55 @@
 #define mulwp_xm(MS, DS) /* Reax is in/out, prepares Redx for divwn_x* */   \
         mulwn_xm(W(MS), W(DS))/* product must not exceed operands size */
 
+/* mhi (G = G * S >> 32), high half of full 32x32-bit product
+ * set-flags: undefined
+ * low half is given by mulwx_**, both halves at once by mulw*_x*
+ * x86 has no 3-operand form, goes through Reax/Redx and inf_SCR01 */
+
+#define mhiwx_rr(RG, RS)                                                    \
+        movwx_st(W(RG), Mebp, inf_SCR01(0))                                 \
+        stack_st(Reax)                                                      \
+        stack_st(Redx)                                                      \
+        movwx_rr(Reax, W(RS))                                               \
+        mulwx_xm(Mebp, inf_SCR01(0))                                        \
+        movwx_st(Redx, Mebp, inf_SCR01(0))                                  \
+        stack_ld(Redx)                                                      \
+        stack_ld(Reax)                                                      \
+        movwx_ld(W(RG), Mebp, inf_SCR01(0))
+
+#define mhiwx_ld(RG, MS, DS)                                                \
+        movwx_st(W(RG), Mebp, inf_SCR01(0))                                 \
+        stack_st(Reax)                                                      \
+        stack_st(Redx)                                                      \
+        movwx_ld(Reax, W(MS), W(DS))                                        \
+        mulwx_xm(Mebp, inf_SCR01(0))                                        \
+        movwx_st(Redx, Mebp, inf_SCR01(0))                                  \
+        stack_ld(Redx)                                                      \
+        stack_ld(Reax)                                                      \
+        movwx_ld(W(RG), Mebp, inf_SCR01(0))
+
+#define mhiwn_rr(RG, RS)                                                    \
+        movwx_st(W(RG), Mebp, inf_SCR01(0))                                 \
+        stack_st(Reax)                                                      \
+        stack_st(Redx)                                                      \
+        movwx_rr(Reax, W(RS))                                               \
+        mulwn_xm(Mebp, inf_SCR01(0))                                        \
+        movwx_st(Redx, Mebp, inf_SCR01(0))                                  \
+        stack_ld(Redx)                                                      \
+        stack_ld(Reax)                                                      \
+        movwx_ld(W(RG), Mebp, inf_SCR01(0))
+
+#define mhiwn_ld(RG, MS, DS)                                                \
+        movwx_st(W(RG), Mebp, inf_SCR01(0))                                 \
+        stack_st(Reax)                                                      \
+        stack_st(Redx)                                                      \
+        movwx_ld(Reax, W(MS), W(DS))                                        \
+        mulwn_xm(Mebp, inf_SCR01(0))                                        \
+        movwx_st(Redx, Mebp, inf_SCR01(0))                                  \
+        stack_ld(Redx)                                                      \
+        stack_ld(Reax)                                                      \
+        movwx_ld(W(RG), Mebp, inf_SCR01(0))
+
 /* div (G = G / S)
  * set-flags: undefined */
 
@@ -1699,6 +1748,142 @@
         MRM(REG(RT),    0x03,    0x05)                                      \
         stack_ld(Rebp)
 
+/* xad (G = M, M = M + G), atomic fetch-add
+ * set-flags: undefined
+ * xad, xch, cas need natural alignment of memory args
+ * and are sequentially consistent (act as full memory barriers) */
+
+#define xadwx_st(RG, MG, DG)                                                \
+        EMITB(0xF0) EMITB(0x0F) EMITB(0xC1)                                 \
+        MRM(REG(RG), MOD(MG), REG(MG))                                      \
+        AUX(SIB(MG), CMD(DG), EMPTY)
+
+/* xch (G = M, M = G), atomic exchange
+ * set-flags: undefined */
+
+#define xchwx_st(RG, MG, DG)                                                \
+        EMITB(0x87)                                                         \
+        MRM(REG(RG), MOD(MG), REG(MG))                                      \
+        AUX(SIB(MG), CMD(DG), EMPTY)
+
+/* cas (if M == Reax then M = S, Reax = M), atomic compare-and-swap
+ * set-flags: undefined
+ * success is checked by comparing Reax to its value before cas */
+
+#define caswx_st(RS, MG, DG)     /* Reax is in/out, RS, MG != Reax */       \
+        EMITB(0xF0) EMITB(0x0F) EMITB(0xB1)                                 \
+        MRM(REG(RS), MOD(MG), REG(MG))                                      \
+        AUX(SIB(MG), CMD(DG), EMPTY)
+
+/* fen (memory-ordering fence)
+ * set-flags: no
+ * fenxx_aq - acquire: prior loads are ordered before subsequent loads/stores
+ * fenxx_rl - release: prior loads/stores are ordered before subsequent stores
+ * fenxx_sc - full: prior loads/stores are ordered before subsequent ones */
+
+#define fenxx_aq()   /* no-op, ordered by x86 memory model */
+
+#define fenxx_rl()   /* no-op, ordered by x86 memory model */
+
+#define fenxx_sc()                                                          \
+        EMITB(0xF0) EMITB(0x83)   /* <- lock or [esp], 0 */                 \
+        EMITB(0x0C) EMITB(0x24) EMITB(0x00)
+
+/* cnt (D = number of set bits in S), population count
+ * set-flags: undefined */
+
+#if RT_BASE_COMPAT_BMI < 2 /* 0 - generic, 1 - 3-op-VEX, 2 - BMI1+BMI2 */
+
+#define cntwx_rr(RD, RS) /* RD, RS != Rebp */                               \
+        stack_st(Rebp)                                                      \
+        EMITB(0x8B)                                                         \
+        MRM(0x05,    MOD(RS), REG(RS))                                      \
+        EMITB(0x33)                                                         \
+        MRM(REG(RD), MOD(RD), REG(RD))                                      \
+        EMITB(0xD1)                      /* <- shr ebp, 1 */                \
+        MRM(0x05,       0x03,    0x05)                                      \
+        EMITB(0x83)                      /* <- adc RD, 0 */                 \
+        MRM(0x02,    MOD(RD), REG(RD))                                      \
+        EMITB(0x00)                                                         \
+        EMITB(0x85)                      /* <- test ebp, ebp */             \
+        MRM(0x05,       0x03,    0x05)                                      \
+        EMITB(0x75) EMITB(0xF7)          /* <- jnz shr */                   \
+        stack_ld(Rebp)
+
+#else /* RT_BASE_COMPAT_BMI >= 2 */
+
+#define cntwx_rr(RD, RS)                                                    \
+        EMITB(0xF3) EMITB(0x0F) EMITB(0xB8)                                 \
+        MRM(REG(RD), MOD(RS), REG(RS))
+
+#endif /* RT_BASE_COMPAT_BMI >= 2 */
+
+/* clz (D = number of leading zeros in S)
+ * set-flags: undefined
+ * clz, ctz return operand size in bits for zero source */
+
+#if RT_BASE_COMPAT_BMI < 2 /* 0 - generic, 1 - 3-op-VEX, 2 - BMI1+BMI2 */
+
+#define clzwx_rr(RD, RS)                                                    \
+        EMITB(0x0F) EMITB(0xBD)                                             \
+        MRM(REG(RD), MOD(RS), REG(RS))   /* <- bsr RD, RS */                \
+        EMITB(0x75) EMITB(0x06)          /* <- jnz xor */                   \
+        EMITB(0xC7)                                                         \
+        MRM(0x00,    MOD(RD), REG(RD))                                      \
+        EMITW(0x0000003F)                                                   \
+        EMITB(0x83)                                                         \
+        MRM(0x06,    MOD(RD), REG(RD))   /* <- xor RD, 31 */                \
+        EMITB(0x1F)
+
+#else /* RT_BASE_COMPAT_BMI >= 2 */
+
+#define clzwx_rr(RD, RS)                                                    \
+        EMITB(0xF3) EMITB(0x0F) EMITB(0xBD)                                 \
+        MRM(REG(RD), MOD(RS), REG(RS))
+
+#endif /* RT_BASE_COMPAT_BMI >= 2 */
+
+/* ctz (D = number of trailing zeros in S)
+ * set-flags: undefined */
+
+#if RT_BASE_COMPAT_BMI < 2 /* 0 - generic, 1 - 3-op-VEX, 2 - BMI1+BMI2 */
+
+#define ctzwx_rr(RD, RS)                                                    \
+        EMITB(0x0F) EMITB(0xBC)                                             \
+        MRM(REG(RD), MOD(RS), REG(RS))   /* <- bsf RD, RS */                \
+        EMITB(0x75) EMITB(0x06)          /* <- jnz end */                   \
+        EMITB(0xC7)                                                         \
+        MRM(0x00,    MOD(RD), REG(RD))                                      \
+        EMITW(0x00000020)
+
+#else /* RT_BASE_COMPAT_BMI >= 2 */
+
+#define ctzwx_rr(RD, RS)                                                    \
+        EMITB(0xF3) EMITB(0x0F) EMITB(0xBC)                                 \
+        MRM(REG(RD), MOD(RS), REG(RS))
+
+#endif /* RT_BASE_COMPAT_BMI >= 2 */
+
+/* bsw (D = S with bytes in reversed order), byte swap
+ * set-flags: undefined */
+
+#define bswwx_rr(RD, RS)                                                    \
+        EMITB(0x8B)                                                         \
+        MRM(REG(RD), MOD(RS), REG(RS))                                      \
+        EMITB(0x0F) EMITB(0xC8 | REG(RD))
+
+/* bfx (G = G >> IS & ((1 << IT) - 1)), unsigned bit-field extract
+ * set-flags: undefined
+ * IT > 0, IS + IT <= 32 */
+
+#define bfxwx_ri(RG, IS, IT)                                                \
+        EMITB(0xC1)                                                         \
+        MRM(0x04,    MOD(RG), REG(RG))                                      \
+        EMITB((32-VAL(IS)-VAL(IT)) & 0x1F)                                  \
+        EMITB(0xC1)                                                         \
+        MRM(0x05,    MOD(RG), REG(RG))                                      \
+        EMITB((32-VAL(IT)) & 0x1F)
+
 /* ver (Mebp/inf_VER = SIMD-version)
  * set-flags: no
  * For interpretation of SIMD build flags check compatibility layer in rtzero.h
@@ -1725,6 +1910,9 @@
         orrwx_rr(Resi, Redx)                                                \
         movwx_rr(Redx, Recx)                                                \
         shrwx_ri(Redx, IB(20))                                              \
+        movwx_rr(Redi, Recx)                                                \
+        shrwx_ri(Redi, IB(21))       /* always require F16C for AVX1 */     \
+        andwx_rr(Redx, Redi)                                                \
         andwx_ri(Redx, IV(0x00000100))  /* <- AVX1 to bit8 */               \
         orrwx_rr(Resi, Redx)                                                \
         movwx_rr(Redx, Recx)                                                \
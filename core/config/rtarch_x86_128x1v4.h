@@ -176,6 +176,18 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment */
+
+#define muvix_ld(XD, MS, DS)                                                \
+        EMITB(0x0F) EMITB(0x10)                                             \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define muvix_st(XS, MD, DD)                                                \
+        EMITB(0x0F) EMITB(0x11)                                             \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 
 #define movjx_rr(XD, XS)                                                    \
     ESC EMITB(0x0F) EMITB(0x28)                                             \
@@ -191,6 +203,18 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment */
+
+#define muvjx_ld(XD, MS, DS)                                                \
+    ESC EMITB(0x0F) EMITB(0x10)                                             \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define muvjx_st(XS, MD, DD)                                                \
+    ESC EMITB(0x0F) EMITB(0x11)                                             \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -257,6 +281,82 @@
         orrjx_rr(Xmm0, W(XS))                                               \
         movjx_st(Xmm0, W(MG), W(DG))
 
+/* unl (G = G unpack-low S), (D = S unpack-low T) if (#D != #T)
+ * interleaves lower halves of each 128-bit lane, S-elements go first */
+
+#define unlix_rr(XG, XS)                                                    \
+        EMITB(0x0F) EMITB(0x14)                                             \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define unlix_ld(XG, MS, DS)                                                \
+        EMITB(0x0F) EMITB(0x14)                                             \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define unlix3rr(XD, XS, XT)                                                \
+        movix_rr(W(XD), W(XS))                                              \
+        unlix_rr(W(XD), W(XT))
+
+#define unlix3ld(XD, XS, MT, DT)                                            \
+        movix_rr(W(XD), W(XS))                                              \
+        unlix_ld(W(XD), W(MT), W(DT))
+
+
+#define unljx_rr(XG, XS)                                                    \
+    ESC EMITB(0x0F) EMITB(0x14)                                             \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define unljx_ld(XG, MS, DS)                                                \
+    ESC EMITB(0x0F) EMITB(0x14)                                             \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define unljx3rr(XD, XS, XT)                                                \
+        movjx_rr(W(XD), W(XS))                                              \
+        unljx_rr(W(XD), W(XT))
+
+#define unljx3ld(XD, XS, MT, DT)                                            \
+        movjx_rr(W(XD), W(XS))                                              \
+        unljx_ld(W(XD), W(MT), W(DT))
+
+/* unh (G = G unpack-high S), (D = S unpack-high T) if (#D != #T)
+ * interleaves upper halves of each 128-bit lane, S-elements go first */
+
+#define unhix_rr(XG, XS)                                                    \
+        EMITB(0x0F) EMITB(0x15)                                             \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define unhix_ld(XG, MS, DS)                                                \
+        EMITB(0x0F) EMITB(0x15)                                             \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define unhix3rr(XD, XS, XT)                                                \
+        movix_rr(W(XD), W(XS))                                              \
+        unhix_rr(W(XD), W(XT))
+
+#define unhix3ld(XD, XS, MT, DT)                                            \
+        movix_rr(W(XD), W(XS))                                              \
+        unhix_ld(W(XD), W(MT), W(DT))
+
+
+#define unhjx_rr(XG, XS)                                                    \
+    ESC EMITB(0x0F) EMITB(0x15)                                             \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define unhjx_ld(XG, MS, DS)                                                \
+    ESC EMITB(0x0F) EMITB(0x15)                                             \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define unhjx3rr(XD, XS, XT)                                                \
+        movjx_rr(W(XD), W(XS))                                              \
+        unhjx_rr(W(XD), W(XT))
+
+#define unhjx3ld(XD, XS, MT, DT)                                            \
+        movjx_rr(W(XD), W(XS))                                              \
+        unhjx_ld(W(XD), W(MT), W(DT))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andix_rr(XG, XS)                                                    \
@@ -2526,6 +2626,18 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment */
+
+#define muvgx_ld(XD, MS, DS)                                                \
+        EMITB(0x0F) EMITB(0x10)                                             \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define muvgx_st(XS, MD, DD)                                                \
+        EMITB(0x0F) EMITB(0x11)                                             \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
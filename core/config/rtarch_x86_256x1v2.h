@@ -163,6 +163,18 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment */
+
+#define muvcx_ld(XD, MS, DS)                                                \
+        V2X(0x00,    1, 0) EMITB(0x10)                                      \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define muvcx_st(XS, MD, DD)                                                \
+        V2X(0x00,    1, 0) EMITB(0x11)                                      \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 
 #define movdx_rr(XD, XS)                                                    \
         V2X(0x00,    1, 1) EMITB(0x28)                                      \
@@ -178,6 +190,18 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment */
+
+#define muvdx_ld(XD, MS, DS)                                                \
+        V2X(0x00,    1, 1) EMITB(0x10)                                      \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define muvdx_st(XS, MD, DD)                                                \
+        V2X(0x00,    1, 1) EMITB(0x11)                                      \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -212,6 +236,90 @@
         MRM(REG(XS), MOD(MG), REG(MG))                                      \
         AUX(SIB(MG), CMD(DG), EMPTY)
 
+/* unl (G = G unpack-low S), (D = S unpack-low T) if (#D != #T)
+ * interleaves lower halves of each 128-bit lane, S-elements go first */
+
+#undef  unlcx_rr
+#define unlcx_rr(XG, XS)                                                    \
+        unlcx3rr(W(XG), W(XG), W(XS))
+
+#undef  unlcx_ld
+#define unlcx_ld(XG, MS, DS)                                                \
+        unlcx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#undef  unlcx3rr
+#define unlcx3rr(XD, XS, XT)                                                \
+        V2X(REG(XS), 1, 0) EMITB(0x14)                                      \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#undef  unlcx3ld
+#define unlcx3ld(XD, XS, MT, DT)                                            \
+        V2X(REG(XS), 1, 0) EMITB(0x14)                                      \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+
+#undef  unldx_rr
+#define unldx_rr(XG, XS)                                                    \
+        unldx3rr(W(XG), W(XG), W(XS))
+
+#undef  unldx_ld
+#define unldx_ld(XG, MS, DS)                                                \
+        unldx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#undef  unldx3rr
+#define unldx3rr(XD, XS, XT)                                                \
+        V2X(REG(XS), 1, 1) EMITB(0x14)                                      \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#undef  unldx3ld
+#define unldx3ld(XD, XS, MT, DT)                                            \
+        V2X(REG(XS), 1, 1) EMITB(0x14)                                      \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* unh (G = G unpack-high S), (D = S unpack-high T) if (#D != #T)
+ * interleaves upper halves of each 128-bit lane, S-elements go first */
+
+#undef  unhcx_rr
+#define unhcx_rr(XG, XS)                                                    \
+        unhcx3rr(W(XG), W(XG), W(XS))
+
+#undef  unhcx_ld
+#define unhcx_ld(XG, MS, DS)                                                \
+        unhcx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#undef  unhcx3rr
+#define unhcx3rr(XD, XS, XT)                                                \
+        V2X(REG(XS), 1, 0) EMITB(0x15)                                      \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#undef  unhcx3ld
+#define unhcx3ld(XD, XS, MT, DT)                                            \
+        V2X(REG(XS), 1, 0) EMITB(0x15)                                      \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+
+#undef  unhdx_rr
+#define unhdx_rr(XG, XS)                                                    \
+        unhdx3rr(W(XG), W(XG), W(XS))
+
+#undef  unhdx_ld
+#define unhdx_ld(XG, MS, DS)                                                \
+        unhdx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#undef  unhdx3rr
+#define unhdx3rr(XD, XS, XT)                                                \
+        V2X(REG(XS), 1, 1) EMITB(0x15)                                      \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#undef  unhdx3ld
+#define unhdx3ld(XD, XS, MT, DT)                                            \
+        V2X(REG(XS), 1, 1) EMITB(0x15)                                      \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andcx_rr(XG, XS)                                                    \
@@ -2031,6 +2139,18 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment */
+
+#define muvax_ld(XD, MS, DS)                                                \
+        V2X(0x00,    1, 0) EMITB(0x10)                                      \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define muvax_st(XS, MD, DD)                                                \
+        V2X(0x00,    1, 0) EMITB(0x11)                                      \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -4600,24 +4720,24 @@
 
 #if   (RT_SIMD == 256)
 
-#define muvcx_ld(XD, MS, DS) /* not portable, do not use outside */         \
+#define muvyx_ld(XD, MS, DS) /* not portable, do not use outside */         \
         V2X(0x00,    1, 0) EMITB(0x28)                                      \
         MRM(REG(XD), MOD(MS), REG(MS))                                      \
         AUX(SIB(MS), CMD(DS), EMPTY)
 
-#define muvcx_st(XS, MD, DD) /* not portable, do not use outside */         \
+#define muvyx_st(XS, MD, DD) /* not portable, do not use outside */         \
         V2X(0x00,    1, 0) EMITB(0x29)                                      \
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
 #elif (RT_SIMD == 128)
 
-#define muvcx_ld(XD, MS, DS) /* not portable, do not use outside */         \
+#define muvyx_ld(XD, MS, DS) /* not portable, do not use outside */         \
         V2X(0x00,    1, 0) EMITB(0x10)                                      \
         MRM(REG(XD), MOD(MS), REG(MS))                                      \
         AUX(SIB(MS), CMD(DS), EMPTY)
 
-#define muvcx_st(XS, MD, DD) /* not portable, do not use outside */         \
+#define muvyx_st(XS, MD, DD) /* not portable, do not use outside */         \
         V2X(0x00,    1, 0) EMITB(0x11)                                      \
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
@@ -4629,40 +4749,40 @@
 #undef  sregs_sa
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        muvcx_st(Xmm0, Oeax, PLAIN)                                         \
+        muvyx_st(Xmm0, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm1, Oeax, PLAIN)                                         \
+        muvyx_st(Xmm1, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm2, Oeax, PLAIN)                                         \
+        muvyx_st(Xmm2, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm3, Oeax, PLAIN)                                         \
+        muvyx_st(Xmm3, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm4, Oeax, PLAIN)                                         \
+        muvyx_st(Xmm4, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm5, Oeax, PLAIN)                                         \
+        muvyx_st(Xmm5, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm6, Oeax, PLAIN)                                         \
+        muvyx_st(Xmm6, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm7, Oeax, PLAIN)
+        muvyx_st(Xmm7, Oeax, PLAIN)
 
 #undef  sregs_la
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        muvcx_ld(Xmm0, Oeax, PLAIN)                                         \
+        muvyx_ld(Xmm0, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm1, Oeax, PLAIN)                                         \
+        muvyx_ld(Xmm1, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm2, Oeax, PLAIN)                                         \
+        muvyx_ld(Xmm2, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm3, Oeax, PLAIN)                                         \
+        muvyx_ld(Xmm3, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm4, Oeax, PLAIN)                                         \
+        muvyx_ld(Xmm4, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm5, Oeax, PLAIN)                                         \
+        muvyx_ld(Xmm5, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm6, Oeax, PLAIN)                                         \
+        muvyx_ld(Xmm6, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm7, Oeax, PLAIN)
+        muvyx_ld(Xmm7, Oeax, PLAIN)
 
 #endif /* RT_256X1 */
 
@@ -879,6 +879,45 @@
 
 #endif /* RT_128X1 */
 
+#if (RT_128X1 == 2) && (RT_SIMD == 128)
+
+/******************************************************************************/
+/**********************************   SIMD   **********************************/
+/******************************************************************************/
+
+/********   packed half-precision floating-point convert (AVX512VL)   *********/
+
+/* cvy (D = fp16-to-fp32 S)
+ * widens lower/upper half of fp16 elements to full fp32 vector,
+ * used by fp16 horizontal ops in rtconf.h and kernels in rthalf.h */
+
+#define cvyms_rr(XD, XS)     /* lower half */                               \
+        EVX(RXB(XD), RXB(XS),    0x00, 0, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cuyms_rr(XD, XS)     /* upper half */                               \
+        EVX(RXB(XD), RXB(XS),    0x00, 0, 1, 1) EMITB(0x70)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0xEE))                                  \
+        cvyms_rr(W(XD), W(XD))
+
+/* cvx (D = fp32-to-fp16 S)
+ * narrows full fp32 vector onto lower/upper half of fp16 elements,
+ * the other half is zeroed, rounding mode comes from control register */
+
+#define cvxos_rr(XD, XS)     /* lower half */                               \
+        EVX(RXB(XS), RXB(XD),    0x00, 0, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x04))
+
+#define cuxos_rr(XD, XS)     /* upper half */                               \
+        cvxos_rr(W(XD), W(XS))                                              \
+        EVX(0,       RXB(XD), REN(XD), 0, 1, 1) EMITB(0x73)                 \
+        MRM(0x07,    MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x08))
+
+#endif /* RT_128X1 */
+
 #endif /* RT_SIMD_CODE */
 
 #endif /* RT_RTARCH_XHF_128X1V2_H */
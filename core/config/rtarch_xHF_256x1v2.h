@@ -0,0 +1,171 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2023 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTARCH_XHF_256X1V2_H
+#define RT_RTARCH_XHF_256X1V2_H
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rtarch_xHF_256x1v2.h: Implementation of x86_64 F16C conversion instructions.
+ *
+ * This file is a part of the unified SIMD assembler framework (rtarch.h)
+ * and contains architecture-specific extensions
+ * outside of the common assembler core.
+ *
+ * Recommended naming scheme for instructions:
+ *
+ * cmdm*_rx - applies [cmd] to var-len packed SIMD: [r]egister (one operand)
+ * cmdm*_rr - applies [cmd] to var-len packed SIMD: [r]egister from [r]egister
+ *
+ * cmdm*_rm - applies [cmd] to var-len packed SIMD: [r]egister from [m]emory
+ * cmdm*_ld - applies [cmd] to var-len packed SIMD: as above (friendly alias)
+ *
+ * cmdg*_** - applies [cmd] to 16-bit elements SIMD args, packed-128-bit
+ * cmdgb_** - applies [cmd] to u-char elements SIMD args, packed-128-bit
+ * cmdgc_** - applies [cmd] to s-char elements SIMD args, packed-128-bit
+ *
+ * cmda*_** - applies [cmd] to 16-bit elements SIMD args, packed-256-bit
+ * cmdab_** - applies [cmd] to u-char elements SIMD args, packed-256-bit
+ * cmdac_** - applies [cmd] to s-char elements SIMD args, packed-256-bit
+ *
+ * cmdn*_** - applies [cmd] to 16-bit elements ELEM args, scalar-fp-only
+ * cmdh*_** - applies [cmd] to 16-bit elements BASE args, BASE-regs-only
+ * cmdb*_** - applies [cmd] to  8-bit elements BASE args, BASE-regs-only
+ *
+ * cmd*x_** - applies [cmd] to SIMD/BASE unsigned integer args, [x] - default
+ * cmd*n_** - applies [cmd] to SIMD/BASE   signed integer args, [n] - negatable
+ * cmd*s_** - applies [cmd] to SIMD/ELEM floating point   args, [s] - scalable
+ *
+ * The cmdm*_** (rtconf.h) instructions are intended for SPMD programming model
+ * and simultaneously support 16/8-bit data elements (int, fp16 on ARM and x86).
+ * In this model data paths are fixed-width, BASE and SIMD data elements are
+ * width-compatible, code path divergence is handled via mkj**_** pseudo-ops.
+ * Matching 16/8-bit BASE subsets cmdh* / cmdb* are defined in rtarch_*HB.h.
+ *
+ * Note, when using fixed-data-size 128/256-bit SIMD subsets simultaneously
+ * upper 128-bit halves of full 256-bit SIMD registers may end up undefined.
+ * On RISC targets they remain unchanged, while on x86-AVX they are zeroed.
+ * This happens when registers written in 128-bit subset are then used/read
+ * from within 256-bit subset. The same rule applies to mixing with 512-bit
+ * and wider vectors. Use of scalars may leave respective vector registers
+ * undefined, as seen from the perspective of any particular vector subset.
+ *
+ * 256-bit vectors used with wider subsets may not be compatible with regards
+ * to memory loads/stores when mixed in the code. It means that data loaded
+ * with wider vector and stored within 256-bit subset at the same address may
+ * result in changing the initial representation in memory. The same can be
+ * said about mixing vector and scalar subsets. Scalars can be completely
+ * detached on some architectures. Use elm*x_st to store 1st vector element.
+ * 128-bit vectors should be memory-compatible with any wider vector subset.
+ *
+ * Handling of NaNs in the floating point pipeline may not be consistent
+ * across different architectures. Avoid NaNs entering the data flow by using
+ * masking or control flow instructions. Apply special care when dealing with
+ * floating point compare and min/max input/output. The result of floating point
+ * compare instructions can be considered a -QNaN, though it is also interpreted
+ * as integer -1 and is often treated as a mask. Most arithmetic instructions
+ * should propagate QNaNs unchanged, however this behavior hasn't been tested.
+ *
+ * Note, that instruction subsets operating on vectors of different length
+ * may support different number of SIMD registers, therefore mixing them
+ * in the same code needs to be done with register awareness in mind.
+ * For example, AVX-512 supports 32 SIMD registers, while AVX2 only has 16,
+ * as does 256-bit paired subset on ARMv8, while 128-bit and SVE have 32.
+ * These numbers should be consistent across architectures if properly
+ * mapped to SIMD target mask presented in rtzero.h (compatibility layer).
+ *
+ * Interpretation of instruction parameters:
+ *
+ * upper-case params have triplet structure and require W to pass-forward
+ * lower-case params are singular and can be used/passed as such directly
+ *
+ * XD - SIMD register serving as destination only, if present
+ * XG - SIMD register serving as destination and first source
+ * XS - SIMD register serving as second source (first if any)
+ * XT - SIMD register serving as third source (second if any)
+ *
+ * RD - BASE register serving as destination only, if present
+ * RG - BASE register serving as destination and first source
+ * RS - BASE register serving as second source (first if any)
+ * RT - BASE register serving as third source (second if any)
+ *
+ * MD - BASE addressing mode (Oeax, M***, I***) (memory-dest)
+ * MG - BASE addressing mode (Oeax, M***, I***) (memory-dsrc)
+ * MS - BASE addressing mode (Oeax, M***, I***) (memory-src2)
+ * MT - BASE addressing mode (Oeax, M***, I***) (memory-src3)
+ *
+ * DD - displacement value (DP, DF, DG, DH, DV) (memory-dest)
+ * DG - displacement value (DP, DF, DG, DH, DV) (memory-dsrc)
+ * DS - displacement value (DP, DF, DG, DH, DV) (memory-src2)
+ * DT - displacement value (DP, DF, DG, DH, DV) (memory-src3)
+ *
+ * IS - immediate value (is used as a second or first source)
+ * IT - immediate value (is used as a third or second source)
+ */
+
+/******************************************************************************/
+/********************************   INTERNAL   ********************************/
+/******************************************************************************/
+
+#if (defined RT_SIMD_CODE)
+
+#if (RT_256X1 >= 1 && RT_256X1 <= 2) && (RT_SIMD == 256)
+
+/******************************************************************************/
+/********************************   EXTERNAL   ********************************/
+/******************************************************************************/
+
+/******************************************************************************/
+/**********************************   SIMD   **********************************/
+/******************************************************************************/
+
+/**********   packed half-precision floating-point convert (F16C)   ***********/
+
+/* cvy (D = fp16-to-fp32 S)
+ * widens lower/upper half of fp16 elements to full fp32 vector,
+ * used by the emulated cmdm* fp16 subset and horizontal ops in rtconf.h */
+
+#define cvyms_rr(XD, XS)     /* lower half */                               \
+        VEX(RXB(XD), RXB(XS),    0x00, 1, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cuyms_rr(XD, XS)     /* upper half */                               \
+        VEX(RXB(XS), RXB(XD),    0x00, 1, 1, 3) EMITB(0x19)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        cvyms_rr(W(XD), W(XD))
+
+/* cvx (D = fp32-to-fp16 S)
+ * narrows full fp32 vector onto lower/upper half of fp16 elements,
+ * the other half is zeroed, rounding mode comes from control register */
+
+#define cvxos_rr(XD, XS)     /* lower half */                               \
+        VEX(RXB(XS), RXB(XD),    0x00, 1, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x04))
+
+#define cuxos_rr(XD, XS)     /* upper half */                               \
+        cvxos_rr(W(XD), W(XS))                                              \
+        VEX(RXB(XD), RXB(XD), REN(XD), 1, 1, 3) EMITB(0x06)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x08))
+
+/******************************************************************************/
+/********************************   INTERNAL   ********************************/
+/******************************************************************************/
+
+#endif /* RT_256X1 */
+
+#endif /* RT_SIMD_CODE */
+
+#endif /* RT_RTARCH_XHF_256X1V2_H */
+
+/******************************************************************************/
+/******************************************************************************/
+/******************************************************************************/
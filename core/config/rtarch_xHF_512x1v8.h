@@ -576,6 +576,45 @@
 
 #endif /* RT_512X1 */
 
+#if (RT_512X1 >= 1 && RT_512X1 <= 8) && (RT_SIMD == 512)
+
+/******************************************************************************/
+/**********************************   SIMD   **********************************/
+/******************************************************************************/
+
+/*********   packed half-precision floating-point convert (AVX512F)   *********/
+
+/* cvy (D = fp16-to-fp32 S)
+ * widens lower/upper half of fp16 elements to full fp32 vector,
+ * used by fp16 horizontal ops in rtconf.h and kernels in rthalf.h */
+
+#define cvyms_rr(XD, XS)     /* lower half */                               \
+        EVX(RXB(XD), RXB(XS),    0x00, 2, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cuyms_rr(XD, XS)     /* upper half */                               \
+        EVW(RXB(XS), RXB(XD),    0x00, 2, 1, 3) EMITB(0x1B)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        cvyms_rr(W(XD), W(XD))
+
+/* cvx (D = fp32-to-fp16 S)
+ * narrows full fp32 vector onto lower/upper half of fp16 elements,
+ * the other half is zeroed, rounding mode comes from control register */
+
+#define cvxos_rr(XD, XS)     /* lower half */                               \
+        EVX(RXB(XS), RXB(XD),    0x00, 2, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x04))
+
+#define cuxos_rr(XD, XS)     /* upper half */                               \
+        cvxos_rr(W(XD), W(XS))                                              \
+        EVW(RXB(XD), RXB(XD), REN(XD), 2, 1, 3) EMITB(0x23)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x4E))
+
+#endif /* RT_512X1 */
+
 #endif /* RT_SIMD_CODE */
 
 #endif /* RT_RTARCH_XHF_512X1V8_H */
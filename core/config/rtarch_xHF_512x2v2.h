@@ -727,6 +727,69 @@
 
 #endif /* RT_512X2 */
 
+#if (RT_512X2 >= 1 && RT_512X2 <= 2) && (RT_SIMD == 1024)
+
+/******************************************************************************/
+/**********************************   SIMD   **********************************/
+/******************************************************************************/
+
+/*********   packed half-precision floating-point convert (AVX512F)   *********/
+
+/* cvy (D = fp16-to-fp32 S)
+ * widens lower/upper half of fp16 elements to full fp32 vector,
+ * used by fp16 horizontal ops in rtconf.h and kernels in rthalf.h,
+ * registers are written in order which allows D to be the same as S */
+
+#define cvyms_rr(XD, XS)     /* lower half */                               \
+        EVW(RXB(XS), RMB(XD),    0x00, 2, 1, 3) EMITB(0x1B)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        EVX(RMB(XD), RMB(XD),    0x00, 2, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        EVX(RXB(XD), RXB(XS),    0x00, 2, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cuyms_rr(XD, XS)     /* upper half */                               \
+        EVX(RXB(XD), RMB(XS),    0x00, 2, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        EVW(RMB(XS), RMB(XD),    0x00, 2, 1, 3) EMITB(0x1B)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        EVX(RMB(XD), RMB(XD),    0x00, 2, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))
+
+/* cvx (D = fp32-to-fp16 S)
+ * narrows full fp32 vector onto lower/upper half of fp16 elements,
+ * the other half is zeroed, rounding mode comes from control register */
+
+#define cvxos_rr(XD, XS)     /* lower half */                               \
+        EVX(RXB(XS), RXB(XD),    0x00, 2, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x04))                                  \
+        EVX(RMB(XS), RMB(XD),    0x00, 2, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x04))                                  \
+        EVW(RXB(XD), RMB(XD), REN(XD), 2, 1, 3) EMITB(0x1A)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        EVX(RMB(XD), RMB(XD), REM(XD), 2, 1, 1) EMITB(0xEF)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))
+
+#define cuxos_rr(XD, XS)     /* upper half */                               \
+        EVX(RMB(XS), RMB(XD),    0x00, 2, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x04))                                  \
+        EVX(RXB(XS), RXB(XD),    0x00, 2, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x04))                                  \
+        EVW(RMB(XD), RMB(XD), REN(XD), 2, 1, 3) EMITB(0x1A)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        EVX(RXB(XD), RXB(XD), REN(XD), 2, 1, 1) EMITB(0xEF)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))
+
+#endif /* RT_512X2 */
+
 #endif /* RT_SIMD_CODE */
 
 #endif /* RT_RTARCH_XHF_512X2V2_H */
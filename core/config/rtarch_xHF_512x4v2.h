@@ -1029,6 +1029,105 @@
 
 #endif /* RT_512X4 */
 
+#if (RT_512X4 >= 1 && RT_512X4 <= 2) && (RT_SIMD == 2048)
+
+/******************************************************************************/
+/**********************************   SIMD   **********************************/
+/******************************************************************************/
+
+/*********   packed half-precision floating-point convert (AVX512F)   *********/
+
+/* cvy (D = fp16-to-fp32 S)
+ * widens lower/upper half of fp16 elements to full fp32 vector,
+ * used by fp16 horizontal ops in rtconf.h and kernels in rthalf.h,
+ * registers are written in order which allows D to be the same as S */
+
+#define cvyms_rr(XD, XS)     /* lower half */                               \
+        EVW(1,             3,    0x00, 2, 1, 3) EMITB(0x1B)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        EVX(3,             3,    0x00, 2, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        EVX(2,             1,    0x00, 2, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        EVW(0,             1,    0x00, 2, 1, 3) EMITB(0x1B)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        EVX(1,             1,    0x00, 2, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        EVX(0,             0,    0x00, 2, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cuyms_rr(XD, XS)     /* upper half */                               \
+        EVX(0,             2,    0x00, 2, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        EVW(2,             1,    0x00, 2, 1, 3) EMITB(0x1B)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        EVX(1,             1,    0x00, 2, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        EVX(2,             3,    0x00, 2, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        EVW(3,             3,    0x00, 2, 1, 3) EMITB(0x1B)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        EVX(3,             3,    0x00, 2, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))
+
+/* cvx (D = fp32-to-fp16 S)
+ * narrows full fp32 vector onto lower/upper half of fp16 elements,
+ * the other half is zeroed, rounding mode comes from control register */
+
+#define cvxos_rr(XD, XS)     /* lower half */                               \
+        EVX(0,             0,    0x00, 2, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x04))                                  \
+        EVX(1,             1,    0x00, 2, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x04))                                  \
+        EVW(0,             1, REG(XD), 2, 1, 3) EMITB(0x1A)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        EVX(2,             1,    0x00, 2, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x04))                                  \
+        EVX(3,             3,    0x00, 2, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x04))                                  \
+        EVW(1,             3, REH(XD), 2, 1, 3) EMITB(0x1A)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        EVX(2,             2, REI(XD), 2, 1, 1) EMITB(0xEF)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        EVX(3,             3, REJ(XD), 2, 1, 1) EMITB(0xEF)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))
+
+#define cuxos_rr(XD, XS)     /* upper half */                               \
+        EVX(3,             3,    0x00, 2, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x04))                                  \
+        EVX(2,             2,    0x00, 2, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x04))                                  \
+        EVW(3,             3, REI(XD), 2, 1, 3) EMITB(0x1A)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        EVX(0,             0,    0x00, 2, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x04))                                  \
+        EVX(1,             1,    0x00, 2, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x04))                                  \
+        EVW(2,             1, REG(XD), 2, 1, 3) EMITB(0x1A)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        EVX(0,             0, REG(XD), 2, 1, 1) EMITB(0xEF)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        EVX(1,             1, REH(XD), 2, 1, 1) EMITB(0xEF)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))
+
+#endif /* RT_512X4 */
+
 #endif /* RT_SIMD_CODE */
 
 #endif /* RT_RTARCH_XHF_512X4V2_H */
@@ -70,6 +70,15 @@
 /**** 256-bit **** (horizontal SIMD) with fixed-64-bit element ****************/
 /**** 128-bit **** (horizontal SIMD) with fixed-64-bit element ****************/
 
+/**** var-len **** (lane unpacks) with fixed-32-bit element *******************/
+/**** 256-bit **** (lane unpacks) with fixed-32-bit element *******************/
+
+/**** var-len **** (lane unpacks) with fixed-64-bit element *******************/
+/**** 256-bit **** (lane unpacks) with fixed-64-bit element *******************/
+
+/**** var-len **** (widening mul) with fixed-64-bit element *******************/
+/**** 256-bit **** (widening mul) with fixed-64-bit element *******************/
+
 /************************   COMMON BASE INSTRUCTIONS   ************************/
 
 /***************** original forms of one-operand instructions *****************/
@@ -936,6 +945,95 @@ struct rt_SIMD_REGS
     rt_ui32 file[64*64];
 #define reg_FILE            DP(Q*0x000)
 
+    /* fp16 emulation area (cmdm*, cmdn* in rtconf.h), DP offsets below
+     * are relative to the end of register file (0x4000), addressed via Iebp
+     * with Reax = regs + 0x4000 - info */
+
+    /* internal constants (32-bit) */
+
+    rt_si32 hwmsk[R];       /* 0x0FFFE000, fp16 exp/mantissa after shift */
+#define reg_HWMSK           DP(Q*0x000)
+
+    rt_si32 hdnrm[R];       /* 0x38800000, 2^-14 in fp32 */
+#define reg_HDNRM           DP(Q*0x010)
+
+    rt_si32 hhalf[R];       /* 0x3F000000, 0.5 in fp32 */
+#define reg_HHALF           DP(Q*0x020)
+
+    rt_si32 hhmax[R];       /* 0x47800000, 2^16 in fp32 */
+#define reg_HHMAX           DP(Q*0x030)
+
+    rt_si32 heinf[R];       /* 0x7F800000, fp32 inf */
+#define reg_HEINF           DP(Q*0x040)
+
+    rt_si32 hqnan[R];       /* 0x00000200, fp16 quiet bit */
+#define reg_HQNAN           DP(Q*0x050)
+
+    rt_si32 hlsb1[R];       /* 0x00000001 */
+#define reg_HLSB1           DP(Q*0x060)
+
+    rt_si32 hnrmb[R];       /* 0xC7800FFF, rebias (-2^-14) with rounding */
+#define reg_HNRMB           DP(Q*0x070)
+
+    rt_si32 hnegm[R];       /* 0x80008000, fp16 sign bits */
+#define reg_HNEGM           DP(Q*0x080)
+
+    rt_si32 hbyte[R];       /* 0x00FF00FF, low bytes of 16-bit elements */
+#define reg_HBYTE           DP(Q*0x090)
+
+    rt_si32 hexph[R];       /* 0x64006400, 1024.0 in fp16 */
+#define reg_HEXPH           DP(Q*0x0A0)
+
+    rt_fp32 hc32k[R];       /* +32768.0f */
+#define reg_HC32K           DP(Q*0x0B0)
+
+    rt_fp32 hcinv[R];       /* +1.0f/256.0f */
+#define reg_HCINV           DP(Q*0x0C0)
+
+    rt_fp32 hc256[R];       /* +256.0f */
+#define reg_HC256           DP(Q*0x0D0)
+
+    rt_fp32 hc1k0[R];       /* +1024.0f */
+#define reg_HC1K0           DP(Q*0x0E0)
+
+    rt_fp32 hcmin[R];       /* -32768.0f */
+#define reg_HCMIN           DP(Q*0x0F0)
+
+    rt_fp32 hcmax[R];       /* +32767.0f */
+#define reg_HCMAX           DP(Q*0x100)
+
+    rt_fp32 hcbia[R];       /* +295936.0f, (1024 * 257 + 32768) */
+#define reg_HCBIA           DP(Q*0x110)
+
+    /* internal variables */
+
+    rt_si32 hscr1[R];       /* scratchpad for widen/narrow */
+#define reg_HSCR1           DP(Q*0x120)
+
+    rt_si32 hscr2[R];       /* scratchpad for widen/narrow */
+#define reg_HSCR2           DP(Q*0x130)
+
+    rt_si32 hscr3[R];       /* scratchpad for widen/narrow */
+#define reg_HSCR3           DP(Q*0x140)
+
+    rt_si32 hsrcg[R];       /* 1st operand */
+#define reg_HSRCG           DP(Q*0x150)
+
+    rt_si32 hsrcs[R];       /* 2nd operand */
+#define reg_HSRCS           DP(Q*0x160)
+
+    rt_si32 hsrct[R];       /* 3rd operand */
+#define reg_HSRCT           DP(Q*0x170)
+
+    rt_si32 hpart[R];       /* partial result */
+#define reg_HPART           DP(Q*0x180)
+
+    rt_si32 hrslt[R];       /* partial result, upper half or high bytes */
+#define reg_HRSLT           DP(Q*0x190)
+
+    rt_si32 hrslq[R];       /* partial result, low bytes */
+#define reg_HRSLQ           DP(Q*0x1A0)
+
 };
 
 #define ASM_INIT(__Info__, __Regs__)                                        \
@@ -952,7 +1050,25 @@ struct rt_SIMD_REGS
     RT_SIMD_SET64((__Info__)->gpc04_64, LL(0x7FFFFFFFFFFFFFFF));            \
     RT_SIMD_SET64((__Info__)->gpc05_64, LL(0x3FF0000000000000));            \
     RT_SIMD_SET64((__Info__)->gpc06_64, LL(0x8000000000000000));            \
-    __Info__->regs = (rt_ui64)(rt_uptr)(__Regs__);
+    __Info__->regs = (rt_ui64)(rt_uptr)(__Regs__);                          \
+    RT_SIMD_SET32((__Regs__)->hwmsk, (rt_si32)0x0FFFE000);                  \
+    RT_SIMD_SET32((__Regs__)->hdnrm, 0x38800000);                           \
+    RT_SIMD_SET32((__Regs__)->hhalf, 0x3F000000);                           \
+    RT_SIMD_SET32((__Regs__)->hhmax, 0x47800000);                           \
+    RT_SIMD_SET32((__Regs__)->heinf, 0x7F800000);                           \
+    RT_SIMD_SET32((__Regs__)->hqnan, 0x00000200);                           \
+    RT_SIMD_SET32((__Regs__)->hlsb1, 0x00000001);                           \
+    RT_SIMD_SET32((__Regs__)->hnrmb, (rt_si32)0xC7800FFF);                  \
+    RT_SIMD_SET32((__Regs__)->hnegm, (rt_si32)0x80008000);                  \
+    RT_SIMD_SET32((__Regs__)->hbyte, 0x00FF00FF);                           \
+    RT_SIMD_SET32((__Regs__)->hexph, 0x64006400);                           \
+    RT_SIMD_SET32((__Regs__)->hc32k, +32768.0f);                            \
+    RT_SIMD_SET32((__Regs__)->hcinv, +1.0f/256.0f);                         \
+    RT_SIMD_SET32((__Regs__)->hc256, +256.0f);                              \
+    RT_SIMD_SET32((__Regs__)->hc1k0, +1024.0f);                             \
+    RT_SIMD_SET32((__Regs__)->hcmin, -32768.0f);                            \
+    RT_SIMD_SET32((__Regs__)->hcmax, +32767.0f);                            \
+    RT_SIMD_SET32((__Regs__)->hcbia, +295936.0f);
 
 #define ASM_DONE(__Info__)
 
@@ -1307,6 +1423,15 @@ rt_si32 from_mask(rt_si32 mask)
  * detached on some architectures. Use elm*x_st to store 1st vector element.
  * 128-bit vectors should be memory-compatible with any wider vector subset.
  *
+ * Memory operands of packed instructions need to be aligned to SIMD width
+ * (RT_SIMD_ALIGN), except for muv*x_ld/muv*x_st (D = S) unaligned load/store
+ * defined for all packed subsets (i, j, l, c, d, f, o, p, q and g, a, m),
+ * which accept any address (VMX stores are done byte by byte),
+ * but may be slower than aligned mov*x_ld/mov*x_st. Kernels
+ * working on caller buffers in place can peel off scalar head elements
+ * until one array is SIMD-aligned, then use muv*x for the others
+ * (PEEL_HEAD below, as in two-array kernels of rtblas.h).
+ *
  * Handling of NaNs in the floating point pipeline may not be consistent
  * across different architectures. Avoid NaNs entering the data flow by using
  * masking or control flow instructions. Apply special care when dealing with
@@ -1372,6 +1497,34 @@ rt_si32 from_mask(rt_si32 mask)
 #define FCTRL_LEAVE(mode) /* resumes default mode (ROUNDN) upon leave */    \
         FCTRL_RESET()
 
+/****************** original PEEL_HEAD loop (two rt_real arrays) **************/
+
+/*
+ * Peel off scalar head elements of two arrays at RA and RB with step()
+ * (one element, pointers and count RC are advanced here) until RA becomes
+ * SIMD-aligned, then fall through if RB is SIMD-aligned as well, otherwise
+ * jump to lu (RB is read with muv*x_ld there), jump to lz once RC is 0.
+ * Labels lb, lc are defined inside, lu and lz are forward labels.
+ */
+#define PEEL_HEAD(lb, lc, lu, lz, step, RA, RB, RC) /* destroys Reax */     \
+    LBL(lb)                                                                 \
+        cmjwx_rz(W(RC),                                                     \
+        /* if */ EQ_x, lz##f)                                               \
+        movxx_rr(Reax, W(RA))                                               \
+        andxx_ri(Reax, IB(Q*16-1))                                          \
+        cmjxx_rz(Reax,                                                      \
+        /* if */ EQ_x, lc##f)                                               \
+        step()                                                              \
+        addxx_ri(W(RA), IB(L*4))                                            \
+        addxx_ri(W(RB), IB(L*4))                                            \
+        subwx_ri(W(RC), IB(1))                                              \
+        jmpxx_lb(lb##b)                                                     \
+    LBL(lc)                                                                 \
+        movxx_rr(Reax, W(RB))                                               \
+        andxx_ri(Reax, IB(Q*16-1))                                          \
+        cmjxx_rz(Reax,                                                      \
+        /* if */ NE_x, lu##f)
+
 /******************************************************************************/
 /**** var-len **** (cbr/cbe/cbs/...) with fixed-32-bit element ****************/
 /******************************************************************************/
@@ -5422,31 +5575,1090 @@ rt_si32 from_mask(rt_si32 mask)
         maxts_ld(W(XD), Mebp, inf_SCR02(0x08))                              \
         movts_st(W(XD), Mebp, inf_SCR01(0x08))
 
-#endif /* RT_SIMD_CODE */
+/******************************************************************************/
+/**** var-len **** (lane unpacks) with fixed-32-bit element *******************/
+/******************************************************************************/
+
+#if   (RT_SIMD == 2048)
+
+#define unlox_rr(XG, XS) /* unpack-low per 128-bit lane */                  \
+        unlox3rr(W(XG), W(XG), W(XS))
+
+#define unlox_ld(XG, MS, DS)                                                \
+        unlox3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define unlox3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        unlox_rx(W(XD))                                                     \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unlox3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        unlox_rx(W(XD))                                                     \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unlox_rx(XD) /* not portable, do not use outside */                 \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        unlix_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        unlix_ld(W(XD), Mebp, inf_SCR02(0x10))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x10))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        unlix_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x30))                              \
+        unlix_ld(W(XD), Mebp, inf_SCR02(0x30))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x30))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        unlix_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x50))                              \
+        unlix_ld(W(XD), Mebp, inf_SCR02(0x50))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x50))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        unlix_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x70))                              \
+        unlix_ld(W(XD), Mebp, inf_SCR02(0x70))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x70))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x80))                              \
+        unlix_ld(W(XD), Mebp, inf_SCR02(0x80))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x80))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x90))                              \
+        unlix_ld(W(XD), Mebp, inf_SCR02(0x90))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x90))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0xA0))                              \
+        unlix_ld(W(XD), Mebp, inf_SCR02(0xA0))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0xA0))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0xB0))                              \
+        unlix_ld(W(XD), Mebp, inf_SCR02(0xB0))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0xB0))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0xC0))                              \
+        unlix_ld(W(XD), Mebp, inf_SCR02(0xC0))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0xC0))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0xD0))                              \
+        unlix_ld(W(XD), Mebp, inf_SCR02(0xD0))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0xD0))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0xE0))                              \
+        unlix_ld(W(XD), Mebp, inf_SCR02(0xE0))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0xE0))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0xF0))                              \
+        unlix_ld(W(XD), Mebp, inf_SCR02(0xF0))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0xF0))
+
+#define unhox_rr(XG, XS) /* unpack-high per 128-bit lane */                 \
+        unhox3rr(W(XG), W(XG), W(XS))
+
+#define unhox_ld(XG, MS, DS)                                                \
+        unhox3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define unhox3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        unhox_rx(W(XD))                                                     \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unhox3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        unhox_rx(W(XD))                                                     \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unhox_rx(XD) /* not portable, do not use outside */                 \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        unhix_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        unhix_ld(W(XD), Mebp, inf_SCR02(0x10))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x10))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        unhix_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x30))                              \
+        unhix_ld(W(XD), Mebp, inf_SCR02(0x30))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x30))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        unhix_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x50))                              \
+        unhix_ld(W(XD), Mebp, inf_SCR02(0x50))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x50))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        unhix_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x70))                              \
+        unhix_ld(W(XD), Mebp, inf_SCR02(0x70))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x70))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x80))                              \
+        unhix_ld(W(XD), Mebp, inf_SCR02(0x80))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x80))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x90))                              \
+        unhix_ld(W(XD), Mebp, inf_SCR02(0x90))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x90))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0xA0))                              \
+        unhix_ld(W(XD), Mebp, inf_SCR02(0xA0))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0xA0))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0xB0))                              \
+        unhix_ld(W(XD), Mebp, inf_SCR02(0xB0))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0xB0))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0xC0))                              \
+        unhix_ld(W(XD), Mebp, inf_SCR02(0xC0))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0xC0))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0xD0))                              \
+        unhix_ld(W(XD), Mebp, inf_SCR02(0xD0))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0xD0))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0xE0))                              \
+        unhix_ld(W(XD), Mebp, inf_SCR02(0xE0))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0xE0))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0xF0))                              \
+        unhix_ld(W(XD), Mebp, inf_SCR02(0xF0))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0xF0))
+
+#elif (RT_SIMD == 1024)
+
+#define unlox_rr(XG, XS) /* unpack-low per 128-bit lane */                  \
+        unlox3rr(W(XG), W(XG), W(XS))
+
+#define unlox_ld(XG, MS, DS)                                                \
+        unlox3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define unlox3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        unlox_rx(W(XD))                                                     \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unlox3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        unlox_rx(W(XD))                                                     \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unlox_rx(XD) /* not portable, do not use outside */                 \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        unlix_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        unlix_ld(W(XD), Mebp, inf_SCR02(0x10))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x10))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        unlix_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x30))                              \
+        unlix_ld(W(XD), Mebp, inf_SCR02(0x30))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x30))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        unlix_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x50))                              \
+        unlix_ld(W(XD), Mebp, inf_SCR02(0x50))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x50))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        unlix_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x70))                              \
+        unlix_ld(W(XD), Mebp, inf_SCR02(0x70))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x70))
+
+#define unhox_rr(XG, XS) /* unpack-high per 128-bit lane */                 \
+        unhox3rr(W(XG), W(XG), W(XS))
+
+#define unhox_ld(XG, MS, DS)                                                \
+        unhox3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define unhox3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        unhox_rx(W(XD))                                                     \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unhox3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        unhox_rx(W(XD))                                                     \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unhox_rx(XD) /* not portable, do not use outside */                 \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        unhix_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        unhix_ld(W(XD), Mebp, inf_SCR02(0x10))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x10))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        unhix_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x30))                              \
+        unhix_ld(W(XD), Mebp, inf_SCR02(0x30))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x30))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        unhix_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x50))                              \
+        unhix_ld(W(XD), Mebp, inf_SCR02(0x50))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x50))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        unhix_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x70))                              \
+        unhix_ld(W(XD), Mebp, inf_SCR02(0x70))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x70))
+
+#elif (RT_SIMD == 512)
+
+#define unlox_rr(XG, XS) /* unpack-low per 128-bit lane */                  \
+        unlox3rr(W(XG), W(XG), W(XS))
+
+#define unlox_ld(XG, MS, DS)                                                \
+        unlox3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define unlox3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        unlox_rx(W(XD))                                                     \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unlox3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        unlox_rx(W(XD))                                                     \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unlox_rx(XD) /* not portable, do not use outside */                 \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        unlix_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        unlix_ld(W(XD), Mebp, inf_SCR02(0x10))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x10))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        unlix_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x30))                              \
+        unlix_ld(W(XD), Mebp, inf_SCR02(0x30))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x30))
+
+#define unhox_rr(XG, XS) /* unpack-high per 128-bit lane */                 \
+        unhox3rr(W(XG), W(XG), W(XS))
+
+#define unhox_ld(XG, MS, DS)                                                \
+        unhox3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define unhox3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        unhox_rx(W(XD))                                                     \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unhox3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        unhox_rx(W(XD))                                                     \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unhox_rx(XD) /* not portable, do not use outside */                 \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        unhix_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        unhix_ld(W(XD), Mebp, inf_SCR02(0x10))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x10))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        unhix_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x30))                              \
+        unhix_ld(W(XD), Mebp, inf_SCR02(0x30))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x30))
+
+#elif (RT_SIMD == 256) && (defined RT_SVEX1)
+
+#define unlox_rr(XG, XS) /* unpack-low per 128-bit lane */                  \
+        unlox3rr(W(XG), W(XG), W(XS))
+
+#define unlox_ld(XG, MS, DS)                                                \
+        unlox3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define unlox3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        unlox_rx(W(XD))                                                     \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unlox3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        unlox_rx(W(XD))                                                     \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unlox_rx(XD) /* not portable, do not use outside */                 \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        unlix_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        unlix_ld(W(XD), Mebp, inf_SCR02(0x10))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x10))
+
+#define unhox_rr(XG, XS) /* unpack-high per 128-bit lane */                 \
+        unhox3rr(W(XG), W(XG), W(XS))
+
+#define unhox_ld(XG, MS, DS)                                                \
+        unhox3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define unhox3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        unhox_rx(W(XD))                                                     \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unhox3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        unhox_rx(W(XD))                                                     \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unhox_rx(XD) /* not portable, do not use outside */                 \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        unhix_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        unhix_ld(W(XD), Mebp, inf_SCR02(0x10))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x10))
+
+#endif /* RT_SIMD: 2K8, 1K4, 512, 256 */
 
 /******************************************************************************/
-/************************   COMMON BASE INSTRUCTIONS   ************************/
+/**** 256-bit **** (lane unpacks) with fixed-32-bit element *******************/
 /******************************************************************************/
 
-/*
- * Recommended naming scheme for instructions:
- *
- * cmdxx_ri - applies [cmd] to [r]egister from [i]mmediate
- * cmdxx_mi - applies [cmd] to [m]emory   from [i]mmediate
- * cmdxx_rz - applies [cmd] to [r]egister from [z]ero-arg
- * cmdxx_mz - applies [cmd] to [m]emory   from [z]ero-arg
- *
- * cmdxx_rm - applies [cmd] to [r]egister from [m]emory
- * cmdxx_ld - applies [cmd] as above
- * cmdxx_mr - applies [cmd] to [m]emory   from [r]egister
- * cmdxx_st - applies [cmd] as above (arg list as cmdxx_ld)
- *
- * cmdxx_rr - applies [cmd] to [r]egister from [r]egister
- * cmdxx_mm - applies [cmd] to [m]emory   from [m]emory
- * cmdxx_rx - applies [cmd] to [r]egister (one-operand cmd)
- * cmdxx_mx - applies [cmd] to [m]emory   (one-operand cmd)
- *
- * cmdxx_rx - applies [cmd] to [r]egister from x-register
+#define unlcx_rr(XG, XS) /* unpack-low per 128-bit lane */                  \
+        unlcx3rr(W(XG), W(XG), W(XS))
+
+#define unlcx_ld(XG, MS, DS)                                                \
+        unlcx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define unlcx3rr(XD, XS, XT)                                                \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movcx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        unlcx_rx(W(XD))                                                     \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unlcx3ld(XD, XS, MT, DT)                                            \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movcx_ld(W(XD), W(MT), W(DT))                                       \
+        movcx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        unlcx_rx(W(XD))                                                     \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unlcx_rx(XD) /* not portable, do not use outside */                 \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        unlix_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        unlix_ld(W(XD), Mebp, inf_SCR02(0x10))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x10))
+
+#define unhcx_rr(XG, XS) /* unpack-high per 128-bit lane */                 \
+        unhcx3rr(W(XG), W(XG), W(XS))
+
+#define unhcx_ld(XG, MS, DS)                                                \
+        unhcx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define unhcx3rr(XD, XS, XT)                                                \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movcx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        unhcx_rx(W(XD))                                                     \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unhcx3ld(XD, XS, MT, DT)                                            \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movcx_ld(W(XD), W(MT), W(DT))                                       \
+        movcx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        unhcx_rx(W(XD))                                                     \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unhcx_rx(XD) /* not portable, do not use outside */                 \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        unhix_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movix_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        unhix_ld(W(XD), Mebp, inf_SCR02(0x10))                              \
+        movix_st(W(XD), Mebp, inf_SCR01(0x10))
+
+/******************************************************************************/
+/**** var-len **** (lane unpacks) with fixed-64-bit element *******************/
+/******************************************************************************/
+
+#if   (RT_SIMD == 2048)
+
+#define unlqx_rr(XG, XS) /* unpack-low per 128-bit lane */                  \
+        unlqx3rr(W(XG), W(XG), W(XS))
+
+#define unlqx_ld(XG, MS, DS)                                                \
+        unlqx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define unlqx3rr(XD, XS, XT)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        unlqx_rx(W(XD))                                                     \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unlqx3ld(XD, XS, MT, DT)                                            \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_ld(W(XD), W(MT), W(DT))                                       \
+        movqx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        unlqx_rx(W(XD))                                                     \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unlqx_rx(XD) /* not portable, do not use outside */                 \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        unljx_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        unljx_ld(W(XD), Mebp, inf_SCR02(0x10))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x10))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        unljx_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x30))                              \
+        unljx_ld(W(XD), Mebp, inf_SCR02(0x30))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x30))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        unljx_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x50))                              \
+        unljx_ld(W(XD), Mebp, inf_SCR02(0x50))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x50))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        unljx_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x70))                              \
+        unljx_ld(W(XD), Mebp, inf_SCR02(0x70))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x70))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x80))                              \
+        unljx_ld(W(XD), Mebp, inf_SCR02(0x80))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x80))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x90))                              \
+        unljx_ld(W(XD), Mebp, inf_SCR02(0x90))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x90))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0xA0))                              \
+        unljx_ld(W(XD), Mebp, inf_SCR02(0xA0))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0xA0))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0xB0))                              \
+        unljx_ld(W(XD), Mebp, inf_SCR02(0xB0))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0xB0))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0xC0))                              \
+        unljx_ld(W(XD), Mebp, inf_SCR02(0xC0))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0xC0))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0xD0))                              \
+        unljx_ld(W(XD), Mebp, inf_SCR02(0xD0))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0xD0))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0xE0))                              \
+        unljx_ld(W(XD), Mebp, inf_SCR02(0xE0))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0xE0))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0xF0))                              \
+        unljx_ld(W(XD), Mebp, inf_SCR02(0xF0))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0xF0))
+
+#define unhqx_rr(XG, XS) /* unpack-high per 128-bit lane */                 \
+        unhqx3rr(W(XG), W(XG), W(XS))
+
+#define unhqx_ld(XG, MS, DS)                                                \
+        unhqx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define unhqx3rr(XD, XS, XT)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        unhqx_rx(W(XD))                                                     \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unhqx3ld(XD, XS, MT, DT)                                            \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_ld(W(XD), W(MT), W(DT))                                       \
+        movqx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        unhqx_rx(W(XD))                                                     \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unhqx_rx(XD) /* not portable, do not use outside */                 \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        unhjx_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        unhjx_ld(W(XD), Mebp, inf_SCR02(0x10))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x10))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        unhjx_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x30))                              \
+        unhjx_ld(W(XD), Mebp, inf_SCR02(0x30))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x30))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        unhjx_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x50))                              \
+        unhjx_ld(W(XD), Mebp, inf_SCR02(0x50))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x50))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        unhjx_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x70))                              \
+        unhjx_ld(W(XD), Mebp, inf_SCR02(0x70))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x70))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x80))                              \
+        unhjx_ld(W(XD), Mebp, inf_SCR02(0x80))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x80))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x90))                              \
+        unhjx_ld(W(XD), Mebp, inf_SCR02(0x90))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x90))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0xA0))                              \
+        unhjx_ld(W(XD), Mebp, inf_SCR02(0xA0))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0xA0))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0xB0))                              \
+        unhjx_ld(W(XD), Mebp, inf_SCR02(0xB0))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0xB0))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0xC0))                              \
+        unhjx_ld(W(XD), Mebp, inf_SCR02(0xC0))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0xC0))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0xD0))                              \
+        unhjx_ld(W(XD), Mebp, inf_SCR02(0xD0))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0xD0))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0xE0))                              \
+        unhjx_ld(W(XD), Mebp, inf_SCR02(0xE0))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0xE0))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0xF0))                              \
+        unhjx_ld(W(XD), Mebp, inf_SCR02(0xF0))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0xF0))
+
+#elif (RT_SIMD == 1024)
+
+#define unlqx_rr(XG, XS) /* unpack-low per 128-bit lane */                  \
+        unlqx3rr(W(XG), W(XG), W(XS))
+
+#define unlqx_ld(XG, MS, DS)                                                \
+        unlqx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define unlqx3rr(XD, XS, XT)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        unlqx_rx(W(XD))                                                     \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unlqx3ld(XD, XS, MT, DT)                                            \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_ld(W(XD), W(MT), W(DT))                                       \
+        movqx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        unlqx_rx(W(XD))                                                     \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unlqx_rx(XD) /* not portable, do not use outside */                 \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        unljx_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        unljx_ld(W(XD), Mebp, inf_SCR02(0x10))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x10))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        unljx_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x30))                              \
+        unljx_ld(W(XD), Mebp, inf_SCR02(0x30))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x30))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        unljx_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x50))                              \
+        unljx_ld(W(XD), Mebp, inf_SCR02(0x50))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x50))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        unljx_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x70))                              \
+        unljx_ld(W(XD), Mebp, inf_SCR02(0x70))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x70))
+
+#define unhqx_rr(XG, XS) /* unpack-high per 128-bit lane */                 \
+        unhqx3rr(W(XG), W(XG), W(XS))
+
+#define unhqx_ld(XG, MS, DS)                                                \
+        unhqx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define unhqx3rr(XD, XS, XT)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        unhqx_rx(W(XD))                                                     \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unhqx3ld(XD, XS, MT, DT)                                            \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_ld(W(XD), W(MT), W(DT))                                       \
+        movqx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        unhqx_rx(W(XD))                                                     \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unhqx_rx(XD) /* not portable, do not use outside */                 \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        unhjx_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        unhjx_ld(W(XD), Mebp, inf_SCR02(0x10))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x10))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        unhjx_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x30))                              \
+        unhjx_ld(W(XD), Mebp, inf_SCR02(0x30))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x30))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        unhjx_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x50))                              \
+        unhjx_ld(W(XD), Mebp, inf_SCR02(0x50))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x50))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        unhjx_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x70))                              \
+        unhjx_ld(W(XD), Mebp, inf_SCR02(0x70))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x70))
+
+#elif (RT_SIMD == 512)
+
+#define unlqx_rr(XG, XS) /* unpack-low per 128-bit lane */                  \
+        unlqx3rr(W(XG), W(XG), W(XS))
+
+#define unlqx_ld(XG, MS, DS)                                                \
+        unlqx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define unlqx3rr(XD, XS, XT)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        unlqx_rx(W(XD))                                                     \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unlqx3ld(XD, XS, MT, DT)                                            \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_ld(W(XD), W(MT), W(DT))                                       \
+        movqx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        unlqx_rx(W(XD))                                                     \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unlqx_rx(XD) /* not portable, do not use outside */                 \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        unljx_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        unljx_ld(W(XD), Mebp, inf_SCR02(0x10))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x10))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        unljx_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x30))                              \
+        unljx_ld(W(XD), Mebp, inf_SCR02(0x30))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x30))
+
+#define unhqx_rr(XG, XS) /* unpack-high per 128-bit lane */                 \
+        unhqx3rr(W(XG), W(XG), W(XS))
+
+#define unhqx_ld(XG, MS, DS)                                                \
+        unhqx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define unhqx3rr(XD, XS, XT)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        unhqx_rx(W(XD))                                                     \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unhqx3ld(XD, XS, MT, DT)                                            \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_ld(W(XD), W(MT), W(DT))                                       \
+        movqx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        unhqx_rx(W(XD))                                                     \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unhqx_rx(XD) /* not portable, do not use outside */                 \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        unhjx_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        unhjx_ld(W(XD), Mebp, inf_SCR02(0x10))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x10))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        unhjx_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x30))                              \
+        unhjx_ld(W(XD), Mebp, inf_SCR02(0x30))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x30))
+
+#elif (RT_SIMD == 256) && (defined RT_SVEX1)
+
+#define unlqx_rr(XG, XS) /* unpack-low per 128-bit lane */                  \
+        unlqx3rr(W(XG), W(XG), W(XS))
+
+#define unlqx_ld(XG, MS, DS)                                                \
+        unlqx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define unlqx3rr(XD, XS, XT)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        unlqx_rx(W(XD))                                                     \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unlqx3ld(XD, XS, MT, DT)                                            \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_ld(W(XD), W(MT), W(DT))                                       \
+        movqx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        unlqx_rx(W(XD))                                                     \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unlqx_rx(XD) /* not portable, do not use outside */                 \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        unljx_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        unljx_ld(W(XD), Mebp, inf_SCR02(0x10))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x10))
+
+#define unhqx_rr(XG, XS) /* unpack-high per 128-bit lane */                 \
+        unhqx3rr(W(XG), W(XG), W(XS))
+
+#define unhqx_ld(XG, MS, DS)                                                \
+        unhqx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define unhqx3rr(XD, XS, XT)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        unhqx_rx(W(XD))                                                     \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unhqx3ld(XD, XS, MT, DT)                                            \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_ld(W(XD), W(MT), W(DT))                                       \
+        movqx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        unhqx_rx(W(XD))                                                     \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unhqx_rx(XD) /* not portable, do not use outside */                 \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        unhjx_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        unhjx_ld(W(XD), Mebp, inf_SCR02(0x10))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x10))
+
+#endif /* RT_SIMD: 2K8, 1K4, 512, 256 */
+
+/******************************************************************************/
+/**** 256-bit **** (lane unpacks) with fixed-64-bit element *******************/
+/******************************************************************************/
+
+#define unldx_rr(XG, XS) /* unpack-low per 128-bit lane */                  \
+        unldx3rr(W(XG), W(XG), W(XS))
+
+#define unldx_ld(XG, MS, DS)                                                \
+        unldx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define unldx3rr(XD, XS, XT)                                                \
+        movdx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movdx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        unldx_rx(W(XD))                                                     \
+        movdx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unldx3ld(XD, XS, MT, DT)                                            \
+        movdx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movdx_ld(W(XD), W(MT), W(DT))                                       \
+        movdx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        unldx_rx(W(XD))                                                     \
+        movdx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unldx_rx(XD) /* not portable, do not use outside */                 \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        unljx_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        unljx_ld(W(XD), Mebp, inf_SCR02(0x10))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x10))
+
+#define unhdx_rr(XG, XS) /* unpack-high per 128-bit lane */                 \
+        unhdx3rr(W(XG), W(XG), W(XS))
+
+#define unhdx_ld(XG, MS, DS)                                                \
+        unhdx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define unhdx3rr(XD, XS, XT)                                                \
+        movdx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movdx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        unhdx_rx(W(XD))                                                     \
+        movdx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unhdx3ld(XD, XS, MT, DT)                                            \
+        movdx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movdx_ld(W(XD), W(MT), W(DT))                                       \
+        movdx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        unhdx_rx(W(XD))                                                     \
+        movdx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define unhdx_rx(XD) /* not portable, do not use outside */                 \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        unhjx_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        unhjx_ld(W(XD), Mebp, inf_SCR02(0x10))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x10))
+
+/******************************************************************************/
+/**** var-len **** (widening mul) with fixed-64-bit element *******************/
+/******************************************************************************/
+
+#if   (RT_SIMD == 2048)
+
+#define mlwqx_rr(XG, XS) /* widening mul of lower halves */                 \
+        mlwqx3rr(W(XG), W(XG), W(XS))
+
+#define mlwqx_ld(XG, MS, DS)                                                \
+        mlwqx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define mlwqx3rr(XD, XS, XT)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        mlwqx_rx(W(XD))                                                     \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define mlwqx3ld(XD, XS, MT, DT)                                            \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_ld(W(XD), W(MT), W(DT))                                       \
+        movqx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        mlwqx_rx(W(XD))                                                     \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define mlwqx_rx(XD) /* not portable, do not use outside */                 \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        mlwjx_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        mlwjx_ld(W(XD), Mebp, inf_SCR02(0x10))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x10))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        mlwjx_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x30))                              \
+        mlwjx_ld(W(XD), Mebp, inf_SCR02(0x30))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x30))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        mlwjx_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x50))                              \
+        mlwjx_ld(W(XD), Mebp, inf_SCR02(0x50))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x50))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        mlwjx_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x70))                              \
+        mlwjx_ld(W(XD), Mebp, inf_SCR02(0x70))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x70))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x80))                              \
+        mlwjx_ld(W(XD), Mebp, inf_SCR02(0x80))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x80))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x90))                              \
+        mlwjx_ld(W(XD), Mebp, inf_SCR02(0x90))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x90))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0xA0))                              \
+        mlwjx_ld(W(XD), Mebp, inf_SCR02(0xA0))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0xA0))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0xB0))                              \
+        mlwjx_ld(W(XD), Mebp, inf_SCR02(0xB0))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0xB0))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0xC0))                              \
+        mlwjx_ld(W(XD), Mebp, inf_SCR02(0xC0))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0xC0))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0xD0))                              \
+        mlwjx_ld(W(XD), Mebp, inf_SCR02(0xD0))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0xD0))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0xE0))                              \
+        mlwjx_ld(W(XD), Mebp, inf_SCR02(0xE0))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0xE0))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0xF0))                              \
+        mlwjx_ld(W(XD), Mebp, inf_SCR02(0xF0))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0xF0))
+
+#elif (RT_SIMD == 1024)
+
+#define mlwqx_rr(XG, XS) /* widening mul of lower halves */                 \
+        mlwqx3rr(W(XG), W(XG), W(XS))
+
+#define mlwqx_ld(XG, MS, DS)                                                \
+        mlwqx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define mlwqx3rr(XD, XS, XT)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        mlwqx_rx(W(XD))                                                     \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define mlwqx3ld(XD, XS, MT, DT)                                            \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_ld(W(XD), W(MT), W(DT))                                       \
+        movqx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        mlwqx_rx(W(XD))                                                     \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define mlwqx_rx(XD) /* not portable, do not use outside */                 \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        mlwjx_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        mlwjx_ld(W(XD), Mebp, inf_SCR02(0x10))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x10))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        mlwjx_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x30))                              \
+        mlwjx_ld(W(XD), Mebp, inf_SCR02(0x30))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x30))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x40))                              \
+        mlwjx_ld(W(XD), Mebp, inf_SCR02(0x40))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x40))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x50))                              \
+        mlwjx_ld(W(XD), Mebp, inf_SCR02(0x50))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x50))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x60))                              \
+        mlwjx_ld(W(XD), Mebp, inf_SCR02(0x60))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x60))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x70))                              \
+        mlwjx_ld(W(XD), Mebp, inf_SCR02(0x70))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x70))
+
+#elif (RT_SIMD == 512)
+
+#define mlwqx_rr(XG, XS) /* widening mul of lower halves */                 \
+        mlwqx3rr(W(XG), W(XG), W(XS))
+
+#define mlwqx_ld(XG, MS, DS)                                                \
+        mlwqx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define mlwqx3rr(XD, XS, XT)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        mlwqx_rx(W(XD))                                                     \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define mlwqx3ld(XD, XS, MT, DT)                                            \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_ld(W(XD), W(MT), W(DT))                                       \
+        movqx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        mlwqx_rx(W(XD))                                                     \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define mlwqx_rx(XD) /* not portable, do not use outside */                 \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        mlwjx_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        mlwjx_ld(W(XD), Mebp, inf_SCR02(0x10))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x10))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x20))                              \
+        mlwjx_ld(W(XD), Mebp, inf_SCR02(0x20))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x20))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x30))                              \
+        mlwjx_ld(W(XD), Mebp, inf_SCR02(0x30))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x30))
+
+#elif (RT_SIMD == 256) && (defined RT_SVEX1)
+
+#define mlwqx_rr(XG, XS) /* widening mul of lower halves */                 \
+        mlwqx3rr(W(XG), W(XG), W(XS))
+
+#define mlwqx_ld(XG, MS, DS)                                                \
+        mlwqx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define mlwqx3rr(XD, XS, XT)                                                \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        mlwqx_rx(W(XD))                                                     \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define mlwqx3ld(XD, XS, MT, DT)                                            \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_ld(W(XD), W(MT), W(DT))                                       \
+        movqx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        mlwqx_rx(W(XD))                                                     \
+        movqx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define mlwqx_rx(XD) /* not portable, do not use outside */                 \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        mlwjx_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        mlwjx_ld(W(XD), Mebp, inf_SCR02(0x10))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x10))
+
+#endif /* RT_SIMD: 2K8, 1K4, 512, 256 */
+
+/******************************************************************************/
+/**** 256-bit **** (widening mul) with fixed-64-bit element *******************/
+/******************************************************************************/
+
+#define mlwdx_rr(XG, XS) /* widening mul of lower halves */                 \
+        mlwdx3rr(W(XG), W(XG), W(XS))
+
+#define mlwdx_ld(XG, MS, DS)                                                \
+        mlwdx3ld(W(XG), W(XG), W(MS), W(DS))
+
+#define mlwdx3rr(XD, XS, XT)                                                \
+        movdx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movdx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        mlwdx_rx(W(XD))                                                     \
+        movdx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define mlwdx3ld(XD, XS, MT, DT)                                            \
+        movdx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movdx_ld(W(XD), W(MT), W(DT))                                       \
+        movdx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        mlwdx_rx(W(XD))                                                     \
+        movdx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define mlwdx_rx(XD) /* not portable, do not use outside */                 \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x00))                              \
+        mlwjx_ld(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x00))                              \
+        movjx_ld(W(XD), Mebp, inf_SCR01(0x10))                              \
+        mlwjx_ld(W(XD), Mebp, inf_SCR02(0x10))                              \
+        movjx_st(W(XD), Mebp, inf_SCR01(0x10))
+
+#endif /* RT_SIMD_CODE */
+
+/******************************************************************************/
+/************************   COMMON BASE INSTRUCTIONS   ************************/
+/******************************************************************************/
+
+/*
+ * Recommended naming scheme for instructions:
+ *
+ * cmdxx_ri - applies [cmd] to [r]egister from [i]mmediate
+ * cmdxx_mi - applies [cmd] to [m]emory   from [i]mmediate
+ * cmdxx_rz - applies [cmd] to [r]egister from [z]ero-arg
+ * cmdxx_mz - applies [cmd] to [m]emory   from [z]ero-arg
+ *
+ * cmdxx_rm - applies [cmd] to [r]egister from [m]emory
+ * cmdxx_ld - applies [cmd] as above
+ * cmdxx_mr - applies [cmd] to [m]emory   from [r]egister
+ * cmdxx_st - applies [cmd] as above (arg list as cmdxx_ld)
+ *
+ * cmdxx_rr - applies [cmd] to [r]egister from [r]egister
+ * cmdxx_mm - applies [cmd] to [m]emory   from [m]emory
+ * cmdxx_rx - applies [cmd] to [r]egister (one-operand cmd)
+ * cmdxx_mx - applies [cmd] to [m]emory   (one-operand cmd)
+ *
+ * cmdxx_rx - applies [cmd] to [r]egister from x-register
  * cmdxx_mx - applies [cmd] to [m]emory   from x-register
  * cmdxx_xr - applies [cmd] to x-register from [r]egister
  * cmdxx_xm - applies [cmd] to x-register from [m]emory
@@ -5461,6 +6673,13 @@ rt_si32 from_mask(rt_si32 mask)
  * stack_sa - applies [mov] to stack from all full registers
  * stack_la - applies [mov] to all full registers from stack
  *
+ * ASM_ENTER/ASM_LEAVE save/load registers with stack_sa/stack_la, which keep
+ * clear of the area below the stack pointer that the ABI allows leaf
+ * functions to use for locals without adjusting it (128-byte red zone on
+ * x86-64 and Apple arm64, 288-byte protected zone on 64-bit POWER).
+ * Thus ASM sections stay correct when inlined by optimizing compilers into
+ * C/C++ functions of any complexity and ASM kernels can be called directly.
+ *
  * cmdw*_** - applies [cmd] to 32-bit BASE register/memory/immediate args
  * cmdx*_** - applies [cmd] to A-size BASE register/memory/immediate args
  * cmdy*_** - applies [cmd] to L-size BASE register/memory/immediate args
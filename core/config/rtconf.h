@@ -32,6 +32,7 @@
 
 /**** var-len **** SIMD instructions with fixed-16-bit element **** 256-bit ***/
 /**** var-len **** SIMD instructions with fixed-16-bit element **** 128-bit ***/
+/**** var-len **** SIMD instructions with fixed-16-bit element **** emulated **/
 /**** var-len **** SIMD instructions with fixed-32-bit element **** 256-bit ***/
 /**** var-len **** SIMD instructions with fixed-32-bit element **** 128-bit ***/
 /**** var-len **** SIMD instructions with fixed-64-bit element **** 256-bit ***/
@@ -1016,12 +1017,16 @@
 
 #if   (RT_SIMD == 256) && !(defined RT_SVEX1)
 
+#if (defined elmax_st)
+
 /* elm (D = S), store first SIMD element with natural alignment
  * allows to decouple scalar subset from SIMD where appropriate */
 
 #define elmmx_st(XS, MD, DD) /* 1st elem as in mem with SIMD load/store */  \
         elmax_st(W(XS), W(MD), W(DD))
 
+#endif /* (defined elmax_st) */
+
 /****************   packed half-precision generic move/logic   ****************/
 
 /* mov (D = S) */
@@ -1035,6 +1040,14 @@
 #define movmx_st(XS, MD, DD)                                                \
         movax_st(W(XS), W(MD), W(DD))
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment */
+
+#define muvmx_ld(XD, MS, DS)                                                \
+        muvax_ld(W(XD), W(MS), W(DS))
+
+#define muvmx_st(XS, MD, DD)                                                \
+        muvax_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -1135,6 +1148,8 @@
 #define notmx_rr(XD, XS)                                                    \
         notax_rr(W(XD), W(XS))
 
+#if (defined addas_rr)
+
 /*************   packed half-precision floating-point arithmetic   ************/
 
 /* neg (G = -G), (D = -S) */
@@ -1498,6 +1513,8 @@
 #define cvrms_rr(XD, XS, mode)                                              \
         cvras_rr(W(XD), W(XS), mode)
 
+#endif /* (defined addas_rr) */
+
 /*************   packed half-precision integer arithmetic/shifts   ************/
 
 /* add (G = G + S), (D = S + T) if (#D != #T) */
@@ -2251,12 +2268,16 @@
 
 #elif (RT_SIMD == 128)
 
+#if (defined elmgx_st)
+
 /* elm (D = S), store first SIMD element with natural alignment
  * allows to decouple scalar subset from SIMD where appropriate */
 
 #define elmmx_st(XS, MD, DD) /* 1st elem as in mem with SIMD load/store */  \
         elmgx_st(W(XS), W(MD), W(DD))
 
+#endif /* (defined elmgx_st) */
+
 /****************   packed half-precision generic move/logic   ****************/
 
 /* mov (D = S) */
@@ -2270,6 +2291,14 @@
 #define movmx_st(XS, MD, DD)                                                \
         movgx_st(W(XS), W(MD), W(DD))
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment */
+
+#define muvmx_ld(XD, MS, DS)                                                \
+        muvgx_ld(W(XD), W(MS), W(DS))
+
+#define muvmx_st(XS, MD, DD)                                                \
+        muvgx_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -2370,6 +2399,8 @@
 #define notmx_rr(XD, XS)                                                    \
         notgx_rr(W(XD), W(XS))
 
+#if (defined addgs_rr)
+
 /*************   packed half-precision floating-point arithmetic   ************/
 
 /* neg (G = -G), (D = -S) */
@@ -2733,6 +2764,8 @@
 #define cvrms_rr(XD, XS, mode)                                              \
         cvrgs_rr(W(XD), W(XS), mode)
 
+#endif /* (defined addgs_rr) */
+
 /*************   packed half-precision integer arithmetic/shifts   ************/
 
 /* add (G = G + S), (D = S + T) if (#D != #T) */
@@ -3482,6 +3515,1149 @@
 
 #endif /* RT_SIMD: 256, 128 */
 
+/******************************************************************************/
+/**** var-len **** SIMD instructions with fixed-16-bit element **** emulated **/
+/******************************************************************************/
+
+/*
+ * Half-precision (cmdm*) floating-point subset is native only on targets
+ * with AVX512-FP16 (xHF) and ARMv8.2 (aHF) and is mapped in sections above.
+ * Elsewhere the same names (including scalar cmdn* subset) are emulated
+ * below: fp16 elements are widened to full fp32 vectors one half at a time,
+ * computed with cmdo* subset and rounded back to fp16, so that the width
+ * doubling stays hidden behind the same interface. Native widen/narrow forms
+ * (cvyms_rr, cuyms_rr, cvxos_rr, cuxos_rr) from xHF/aHF headers are used
+ * if target defines them, otherwise lower and upper fp16 elements of each
+ * 32-bit lane form the halves and narrowing always rounds to nearest even.
+ *
+ * Horizontal fp16 ops (adhms, mnhms, mxhms, adwms) are defined here for all
+ * targets (native ones included) on top of the same widen/narrow forms.
+ *
+ * As fp32 has more than twice the fp16 precision, add, sub, mul, div, sqrt
+ * results are correctly rounded, fma/fms (exact fp32 product, rounded sum)
+ * may differ from fused native ops by rounding twice in rare cases, rcp/rsq
+ * are full-precision (rcs/rss are no-ops), fp16 subnormals are exact,
+ * inf and NaN are propagated (NaN as quiet NaN).
+ *
+ * Emulated ops only use destination register (sources are preserved),
+ * spill to fp16 area of rt_SIMD_REGS (rtbase.h) via Iebp, Reax (saved
+ * on stack) and use inf_SCR01, inf_SCR02 for memory operands.
+ */
+
+/* fp16 area of rt_SIMD_REGS is addressed via Iebp with offset from
+ * rt_SIMD_INFO in Reax (saved on stack) */
+
+#define hemul_sa() /* not portable, do not use outside */                   \
+        stack_st(Reax)                                                      \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        subxx_rr(Reax, Rebp)                                                \
+        addxx_ri(Reax, IH(0x4000))
+
+#define hemul_la() /* not portable, do not use outside */                   \
+        stack_ld(Reax)
+
+#if (defined cvyms_rr)
+
+/* widen lower/upper half of fp16 elements (D = (fp32)D),
+ * narrow fp32 onto lower/upper half of fp16 elements (D = (fp16)D),
+ * the other half is zeroed */
+
+#define wdlms_rx(XD) /* not portable, do not use outside */                 \
+        cvyms_rr(W(XD), W(XD))
+
+#define wdhms_rx(XD) /* not portable, do not use outside */                 \
+        cuyms_rr(W(XD), W(XD))
+
+#define nrlms_rx(XD) /* not portable, do not use outside */                 \
+        cvxos_rr(W(XD), W(XD))
+
+#define nrhms_rx(XD) /* not portable, do not use outside */                 \
+        cuxos_rr(W(XD), W(XD))
+
+#else  /* generic widen/narrow */
+
+/* widen lower/upper fp16 element of 32-bit lanes (D = (fp32)D),
+ * exponent and mantissa moved in place with one shift and rebiased
+ * with integer add to twice the value, then halved, fp16 subnormals
+ * taken from min(D/2, D - 2^-14), inf/NaN restored to max exponent */
+
+#define wdlms_rx(XD) /* not portable, do not use outside */                 \
+        shlox_ri(W(XD), IB(16))                                             \
+        wdhms_rx(W(XD))
+
+#define wdhms_rx(XD) /* not portable, do not use outside */                 \
+        movox_st(W(XD), Iebp, reg_HSCR1)                                    \
+        shrox_ri(W(XD), IB(3))                                              \
+        andox_ld(W(XD), Iebp, reg_HWMSK)                                    \
+        addox_ld(W(XD), Iebp, reg_HDNRM)                                    \
+        movox_st(W(XD), Iebp, reg_HSCR2)                                    \
+        mulos_ld(W(XD), Iebp, reg_HHALF)                                    \
+        movox_st(W(XD), Iebp, reg_HSCR3)                                    \
+        movox_ld(W(XD), Iebp, reg_HSCR2)                                    \
+        subos_ld(W(XD), Iebp, reg_HDNRM)                                    \
+        minos_ld(W(XD), Iebp, reg_HSCR3)                                    \
+        movox_st(W(XD), Iebp, reg_HSCR2)                                    \
+        cgeos_ld(W(XD), Iebp, reg_HHMAX)                                    \
+        andox_ld(W(XD), Iebp, reg_HEINF)                                    \
+        orrox_ld(W(XD), Iebp, reg_HSCR2)                                    \
+        movox_st(W(XD), Iebp, reg_HSCR2)                                    \
+        movox_ld(W(XD), Iebp, reg_HSCR1)                                    \
+        andox_ld(W(XD), Mebp, inf_GPC06_32)                                 \
+        orrox_ld(W(XD), Iebp, reg_HSCR2)
+
+/* narrow fp32 to fp16 in lower/upper element of 32-bit lanes (D = (fp16)D),
+ * the other element is zeroed, rounds to nearest even as sum of subnormal
+ * part from min(|D|, 2^-14) (rounded by fp32 add) and normal part from
+ * max(|D|, 2^-14) (rounded in integer), |D| is clamped to 2^16 (inf),
+ * NaN sets quiet bit, integer min/max are built from sign masks
+ * as 32-bit integer min/max aren't native on all targets */
+
+#define nrlms_rx(XD) /* not portable, do not use outside */                 \
+        movox_st(W(XD), Iebp, reg_HSCR1)                                    \
+        andox_ld(W(XD), Mebp, inf_GPC06_32)                                 \
+        shrox_ri(W(XD), IB(16))                                             \
+        movox_st(W(XD), Iebp, reg_HSCR2)                                    \
+        movox_ld(W(XD), Mebp, inf_GPC04_32)                                 \
+        andox_ld(W(XD), Iebp, reg_HSCR1)                                    \
+        movox_st(W(XD), Iebp, reg_HSCR1)                                    \
+        cgton_ld(W(XD), Iebp, reg_HEINF)                                    \
+        andox_ld(W(XD), Iebp, reg_HQNAN)                                    \
+        orrox_ld(W(XD), Iebp, reg_HSCR2)                                    \
+        movox_st(W(XD), Iebp, reg_HSCR2)                                    \
+        movox_ld(W(XD), Iebp, reg_HSCR1)                                    \
+        subox_ld(W(XD), Iebp, reg_HHMAX)                                    \
+        movox_st(W(XD), Iebp, reg_HSCR3)                                    \
+        shron_ri(W(XD), IB(31))                                             \
+        andox_ld(W(XD), Iebp, reg_HSCR3)                                    \
+        addox_ld(W(XD), Iebp, reg_HHMAX)                                    \
+        subox_ld(W(XD), Iebp, reg_HDNRM)                                    \
+        movox_st(W(XD), Iebp, reg_HSCR3)                                    \
+        shron_ri(W(XD), IB(31))                                             \
+        movox_st(W(XD), Iebp, reg_HSCR1)                                    \
+        andox_ld(W(XD), Iebp, reg_HSCR3)                                    \
+        addox_ld(W(XD), Iebp, reg_HDNRM)                                    \
+        addos_ld(W(XD), Iebp, reg_HHALF)                                    \
+        subox_ld(W(XD), Iebp, reg_HHALF)                                    \
+        orrox_ld(W(XD), Iebp, reg_HSCR2)                                    \
+        movox_st(W(XD), Iebp, reg_HSCR2)                                    \
+        movox_ld(W(XD), Iebp, reg_HSCR1)                                    \
+        annox_ld(W(XD), Iebp, reg_HSCR3)                                    \
+        addox_ld(W(XD), Iebp, reg_HDNRM)                                    \
+        movox_st(W(XD), Iebp, reg_HSCR1)                                    \
+        shrox_ri(W(XD), IB(13))                                             \
+        andox_ld(W(XD), Iebp, reg_HLSB1)                                    \
+        addox_ld(W(XD), Iebp, reg_HSCR1)                                    \
+        addox_ld(W(XD), Iebp, reg_HNRMB)                                    \
+        shrox_ri(W(XD), IB(13))                                             \
+        addox_ld(W(XD), Iebp, reg_HSCR2)
+
+#define nrhms_rx(XD) /* not portable, do not use outside */                 \
+        nrlms_rx(W(XD))                                                     \
+        shlox_ri(W(XD), IB(16))
+
+#endif /* generic widen/narrow */
+
+#if !(defined addms_rr)
+
+#define RT_SIMD_HALF_EMUL       1 /* cmdm* subset is emulated in fp32 */
+
+/* binary op on one half of fp16 elements (G = G op S),
+ * G, S are in hsrcg, hsrcs, hf is l (lower half) or h (upper half) */
+
+#define bnsms_rx(XG, op, hf) /* not portable, do not use outside */         \
+        movox_ld(W(XG), Iebp, reg_HSRCS)                                    \
+        wd##hf##ms_rx(W(XG))                                                \
+        movox_st(W(XG), Iebp, reg_HPART)                                    \
+        movox_ld(W(XG), Iebp, reg_HSRCG)                                    \
+        wd##hf##ms_rx(W(XG))                                                \
+        op##os_ld(W(XG), Iebp, reg_HPART)                                   \
+        nr##hf##ms_rx(W(XG))
+
+#define bnams_rx(XG, op) /* not portable, do not use outside */             \
+        bnsms_rx(W(XG), op, h)                                              \
+        movox_st(W(XG), Iebp, reg_HRSLT)                                    \
+        bnsms_rx(W(XG), op, l)                                              \
+        orrox_ld(W(XG), Iebp, reg_HRSLT)
+
+#define bnams_rr(XG, XS, op) /* not portable, do not use outside */         \
+        hemul_sa()                                                          \
+        movox_st(W(XS), Iebp, reg_HSRCS)                                    \
+        movox_st(W(XG), Iebp, reg_HSRCG)                                    \
+        bnams_rx(W(XG), op)                                                 \
+        hemul_la()
+
+#define bnams_ld(XG, MS, DS, op) /* not portable, do not use outside */     \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movmx_ld(W(XG), W(MS), W(DS))                                       \
+        hemul_sa()                                                          \
+        movox_st(W(XG), Iebp, reg_HSRCS)                                    \
+        movox_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        movox_st(W(XG), Iebp, reg_HSRCG)                                    \
+        bnams_rx(W(XG), op)                                                 \
+        hemul_la()
+
+/* compare on one half of fp16 elements (G = G op S ? 1.0 : 0.0),
+ * G, S are in hsrcg, hsrcs, 1.0 (0x3C00) is turned into mask afterwards */
+
+#define cmsms_rx(XG, op, hf) /* not portable, do not use outside */         \
+        movox_ld(W(XG), Iebp, reg_HSRCS)                                    \
+        wd##hf##ms_rx(W(XG))                                                \
+        movox_st(W(XG), Iebp, reg_HPART)                                    \
+        movox_ld(W(XG), Iebp, reg_HSRCG)                                    \
+        wd##hf##ms_rx(W(XG))                                                \
+        op##os_ld(W(XG), Iebp, reg_HPART)                                   \
+        andox_ld(W(XG), Mebp, inf_GPC01_32)                                 \
+        nr##hf##ms_rx(W(XG))
+
+#define cmams_rx(XG, op) /* not portable, do not use outside */             \
+        cmsms_rx(W(XG), op, h)                                              \
+        movox_st(W(XG), Iebp, reg_HRSLT)                                    \
+        cmsms_rx(W(XG), op, l)                                              \
+        orrox_ld(W(XG), Iebp, reg_HRSLT)                                    \
+        shlmx_ri(W(XG), IB(2))                                              \
+        shrmn_ri(W(XG), IB(15))
+
+#define cmams_rr(XG, XS, op) /* not portable, do not use outside */         \
+        hemul_sa()                                                          \
+        movox_st(W(XS), Iebp, reg_HSRCS)                                    \
+        movox_st(W(XG), Iebp, reg_HSRCG)                                    \
+        cmams_rx(W(XG), op)                                                 \
+        hemul_la()
+
+#define cmams_ld(XG, MS, DS, op) /* not portable, do not use outside */     \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movmx_ld(W(XG), W(MS), W(DS))                                       \
+        hemul_sa()                                                          \
+        movox_st(W(XG), Iebp, reg_HSRCS)                                    \
+        movox_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        movox_st(W(XG), Iebp, reg_HSRCG)                                    \
+        cmams_rx(W(XG), op)                                                 \
+        hemul_la()
+
+/* unary op on one half of fp16 elements (D = op S), S is in hsrcs,
+ * op is a cmdo* instruction or a helper below taking (XD, XS) */
+
+#define unsms_rx(XD, op, hf) /* not portable, do not use outside */         \
+        movox_ld(W(XD), Iebp, reg_HSRCS)                                    \
+        wd##hf##ms_rx(W(XD))                                                \
+        op(W(XD), W(XD))                                                    \
+        nr##hf##ms_rx(W(XD))
+
+#define unams_rr(XD, XS, op) /* not portable, do not use outside */         \
+        hemul_sa()                                                          \
+        movox_st(W(XS), Iebp, reg_HSRCS)                                    \
+        unsms_rx(W(XD), op, h)                                              \
+        movox_st(W(XD), Iebp, reg_HRSLT)                                    \
+        unsms_rx(W(XD), op, l)                                              \
+        orrox_ld(W(XD), Iebp, reg_HRSLT)                                    \
+        hemul_la()
+
+#define unrms_rx(XD, mode, hf) /* not portable, do not use outside */       \
+        movox_ld(W(XD), Iebp, reg_HSRCS)                                    \
+        wd##hf##ms_rx(W(XD))                                                \
+        rnros_rr(W(XD), W(XD), mode)                                        \
+        nr##hf##ms_rx(W(XD))
+
+#define rcfos_rr(XD, XS) /* not portable, do not use outside */             \
+        movox_st(W(XS), Iebp, reg_HPART)                                    \
+        movox_ld(W(XD), Mebp, inf_GPC01_32)                                 \
+        divos_ld(W(XD), Iebp, reg_HPART)
+
+#define rsfos_rr(XD, XS) /* not portable, do not use outside */             \
+        sqros_rr(W(XD), W(XS))                                              \
+        rcfos_rr(W(XD), W(XD))
+
+/* ternary op on one half of fp16 elements (G = G op S * T),
+ * G, S, T are in hsrcg, hsrcs, hsrct, fp32 product is exact */
+
+#define trsms_rx(XG, op, hf) /* not portable, do not use outside */         \
+        movox_ld(W(XG), Iebp, reg_HSRCS)                                    \
+        wd##hf##ms_rx(W(XG))                                                \
+        movox_st(W(XG), Iebp, reg_HPART)                                    \
+        movox_ld(W(XG), Iebp, reg_HSRCT)                                    \
+        wd##hf##ms_rx(W(XG))                                                \
+        mulos_ld(W(XG), Iebp, reg_HPART)                                    \
+        movox_st(W(XG), Iebp, reg_HPART)                                    \
+        movox_ld(W(XG), Iebp, reg_HSRCG)                                    \
+        wd##hf##ms_rx(W(XG))                                                \
+        op##os_ld(W(XG), Iebp, reg_HPART)                                   \
+        nr##hf##ms_rx(W(XG))
+
+#define trams_rx(XG, op) /* not portable, do not use outside */             \
+        trsms_rx(W(XG), op, h)                                              \
+        movox_st(W(XG), Iebp, reg_HRSLT)                                    \
+        trsms_rx(W(XG), op, l)                                              \
+        orrox_ld(W(XG), Iebp, reg_HRSLT)
+
+#define trams_rr(XG, XS, XT, op) /* not portable, do not use outside */     \
+        hemul_sa()                                                          \
+        movox_st(W(XS), Iebp, reg_HSRCS)                                    \
+        movox_st(W(XT), Iebp, reg_HSRCT)                                    \
+        movox_st(W(XG), Iebp, reg_HSRCG)                                    \
+        trams_rx(W(XG), op)                                                 \
+        hemul_la()
+
+#define trams_ld(XG, XS, MT, DT, op) /* not portable, do not use outside */ \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movmx_ld(W(XG), W(MT), W(DT))                                       \
+        hemul_sa()                                                          \
+        movox_st(W(XG), Iebp, reg_HSRCT)                                    \
+        movox_st(W(XS), Iebp, reg_HSRCS)                                    \
+        movox_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        movox_st(W(XG), Iebp, reg_HSRCG)                                    \
+        trams_rx(W(XG), op)                                                 \
+        hemul_la()
+
+/* fp16-to-int16 on one half of fp16 elements (D = (int)op S), S is in hsrcs,
+ * rounded value is clamped and biased to [0, 65535] in fp32, then split
+ * into high and low bytes (exact), which are narrowed as fp16 (1024 + byte)
+ * and accumulated in hrslt, hrslq respectively */
+
+#define cvhms_rx(XD, op, hf) /* not portable, do not use outside */         \
+        movox_ld(W(XD), Iebp, reg_HSRCS)                                    \
+        wd##hf##ms_rx(W(XD))                                                \
+        op(W(XD), W(XD))                                                    \
+        maxos_ld(W(XD), Iebp, reg_HCMIN)                                    \
+        minos_ld(W(XD), Iebp, reg_HCMAX)                                    \
+        addos_ld(W(XD), Iebp, reg_HC32K)                                    \
+        movox_st(W(XD), Iebp, reg_HPART)                                    \
+        mulos_ld(W(XD), Iebp, reg_HCINV)                                    \
+        rnmos_rr(W(XD), W(XD))                                              \
+        movox_st(W(XD), Iebp, reg_HSRCG)                                    \
+        mulos_ld(W(XD), Iebp, reg_HC256)                                    \
+        subos_ld(W(XD), Iebp, reg_HPART)                                    \
+        movox_st(W(XD), Iebp, reg_HSRCT)                                    \
+        movox_ld(W(XD), Iebp, reg_HC1K0)                                    \
+        subos_ld(W(XD), Iebp, reg_HSRCT)                                    \
+        nr##hf##ms_rx(W(XD))                                                \
+        orrox_ld(W(XD), Iebp, reg_HRSLQ)                                    \
+        movox_st(W(XD), Iebp, reg_HRSLQ)                                    \
+        movox_ld(W(XD), Iebp, reg_HSRCG)                                    \
+        addos_ld(W(XD), Iebp, reg_HC1K0)                                    \
+        nr##hf##ms_rx(W(XD))                                                \
+        orrox_ld(W(XD), Iebp, reg_HRSLT)                                    \
+        movox_st(W(XD), Iebp, reg_HRSLT)
+
+#define cvhms_rr(XD, XS, op) /* not portable, do not use outside */         \
+        hemul_sa()                                                          \
+        movox_st(W(XS), Iebp, reg_HSRCS)                                    \
+        xorox_rr(W(XD), W(XD))                                              \
+        movox_st(W(XD), Iebp, reg_HRSLT)                                    \
+        movox_st(W(XD), Iebp, reg_HRSLQ)                                    \
+        cvhms_rx(W(XD), op, h)                                              \
+        cvhms_rx(W(XD), op, l)                                              \
+        shlmx_ri(W(XD), IB(8))                                              \
+        movox_st(W(XD), Iebp, reg_HRSLT)                                    \
+        movox_ld(W(XD), Iebp, reg_HRSLQ)                                    \
+        andox_ld(W(XD), Iebp, reg_HBYTE)                                    \
+        orrox_ld(W(XD), Iebp, reg_HRSLT)                                    \
+        xorox_ld(W(XD), Iebp, reg_HNEGM)                                    \
+        hemul_la()
+
+/* int16-to-fp16 on one half of int16 elements (D = (fp)S), biased value
+ * is split into high and low bytes in hsrcg, hsrct as fp16 (1024 + byte),
+ * which are widened and combined in fp32 (exact), then narrowed */
+
+#define cvims_rx(XD, hf) /* not portable, do not use outside */             \
+        movox_ld(W(XD), Iebp, reg_HSRCT)                                    \
+        wd##hf##ms_rx(W(XD))                                                \
+        movox_st(W(XD), Iebp, reg_HPART)                                    \
+        movox_ld(W(XD), Iebp, reg_HSRCG)                                    \
+        wd##hf##ms_rx(W(XD))                                                \
+        mulos_ld(W(XD), Iebp, reg_HC256)                                    \
+        addos_ld(W(XD), Iebp, reg_HPART)                                    \
+        subos_ld(W(XD), Iebp, reg_HCBIA)                                    \
+        nr##hf##ms_rx(W(XD))
+
+#define cvims_rr(XD, XS) /* not portable, do not use outside */             \
+        hemul_sa()                                                          \
+        movox_st(W(XS), Iebp, reg_HSRCS)                                    \
+        movox_ld(W(XD), Iebp, reg_HNEGM)                                    \
+        xorox_ld(W(XD), Iebp, reg_HSRCS)                                    \
+        movox_st(W(XD), Iebp, reg_HSRCS)                                    \
+        shrmx_ri(W(XD), IB(8))                                              \
+        orrox_ld(W(XD), Iebp, reg_HEXPH)                                    \
+        movox_st(W(XD), Iebp, reg_HSRCG)                                    \
+        movox_ld(W(XD), Iebp, reg_HSRCS)                                    \
+        andox_ld(W(XD), Iebp, reg_HBYTE)                                    \
+        orrox_ld(W(XD), Iebp, reg_HEXPH)                                    \
+        movox_st(W(XD), Iebp, reg_HSRCT)                                    \
+        cvims_rx(W(XD), h)                                                  \
+        movox_st(W(XD), Iebp, reg_HRSLT)                                    \
+        cvims_rx(W(XD), l)                                                  \
+        orrox_ld(W(XD), Iebp, reg_HRSLT)                                    \
+        hemul_la()
+
+/*************   packed half-precision floating-point arithmetic   ************/
+
+/* neg (G = -G), (D = -S) */
+
+#define negms_rx(XG)                                                        \
+        hemul_sa()                                                          \
+        xorox_ld(W(XG), Iebp, reg_HNEGM)                                    \
+        hemul_la()
+
+#define negms_rr(XD, XS)                                                    \
+        movmx_rr(W(XD), W(XS))                                              \
+        negms_rx(W(XD))
+
+/* add (G = G + S), (D = S + T) if (#D != #T) */
+
+#define addms_rr(XG, XS)                                                    \
+        bnams_rr(W(XG), W(XS), add)
+
+#define addms_ld(XG, MS, DS)                                                \
+        bnams_ld(W(XG), W(MS), W(DS), add)
+
+#define addms3rr(XD, XS, XT)                                                \
+        movmx_rr(W(XD), W(XS))                                              \
+        addms_rr(W(XD), W(XT))
+
+#define addms3ld(XD, XS, MT, DT)                                            \
+        movmx_rr(W(XD), W(XS))                                              \
+        addms_ld(W(XD), W(MT), W(DT))
+
+/* sub (G = G - S), (D = S - T) if (#D != #T) */
+
+#define subms_rr(XG, XS)                                                    \
+        bnams_rr(W(XG), W(XS), sub)
+
+#define subms_ld(XG, MS, DS)                                                \
+        bnams_ld(W(XG), W(MS), W(DS), sub)
+
+#define subms3rr(XD, XS, XT)                                                \
+        movmx_rr(W(XD), W(XS))                                              \
+        subms_rr(W(XD), W(XT))
+
+#define subms3ld(XD, XS, MT, DT)                                            \
+        movmx_rr(W(XD), W(XS))                                              \
+        subms_ld(W(XD), W(MT), W(DT))
+
+/* mul (G = G * S), (D = S * T) if (#D != #T) */
+
+#define mulms_rr(XG, XS)                                                    \
+        bnams_rr(W(XG), W(XS), mul)
+
+#define mulms_ld(XG, MS, DS)                                                \
+        bnams_ld(W(XG), W(MS), W(DS), mul)
+
+#define mulms3rr(XD, XS, XT)                                                \
+        movmx_rr(W(XD), W(XS))                                              \
+        mulms_rr(W(XD), W(XT))
+
+#define mulms3ld(XD, XS, MT, DT)                                            \
+        movmx_rr(W(XD), W(XS))                                              \
+        mulms_ld(W(XD), W(MT), W(DT))
+
+/* div (G = G / S), (D = S / T) if (#D != #T) */
+
+#define divms_rr(XG, XS)                                                    \
+        bnams_rr(W(XG), W(XS), div)
+
+#define divms_ld(XG, MS, DS)                                                \
+        bnams_ld(W(XG), W(MS), W(DS), div)
+
+#define divms3rr(XD, XS, XT)                                                \
+        movmx_rr(W(XD), W(XS))                                              \
+        divms_rr(W(XD), W(XT))
+
+#define divms3ld(XD, XS, MT, DT)                                            \
+        movmx_rr(W(XD), W(XS))                                              \
+        divms_ld(W(XD), W(MT), W(DT))
+
+/* sqr (D = sqrt S) */
+
+#define sqrms_rr(XD, XS)                                                    \
+        unams_rr(W(XD), W(XS), sqros_rr)
+
+#define sqrms_ld(XD, MS, DS)                                                \
+        movmx_ld(W(XD), W(MS), W(DS))                                       \
+        sqrms_rr(W(XD), W(XD))
+
+/* rcp (D = 1.0 / S)
+ * full-precision in fp32, refinement step is a no-op */
+
+#define rcems_rr(XD, XS)                                                    \
+        unams_rr(W(XD), W(XS), rcfos_rr)
+
+#define rcsms_rr(XG, XS) /* destroys XS */
+
+/* rsq (D = 1.0 / sqrt S)
+ * full-precision in fp32, refinement step is a no-op */
+
+#define rsems_rr(XD, XS)                                                    \
+        unams_rr(W(XD), W(XS), rsfos_rr)
+
+#define rssms_rr(XG, XS) /* destroys XS */
+
+/* fma (G = G + S * T) if (#G != #S && #G != #T)
+ * product is exact in fp32, only the sum is rounded before narrowing */
+
+#define fmams_rr(XG, XS, XT)                                                \
+        trams_rr(W(XG), W(XS), W(XT), add)
+
+#define fmams_ld(XG, XS, MT, DT)                                            \
+        trams_ld(W(XG), W(XS), W(MT), W(DT), add)
+
+#define fmams3rr(XG, XS, XT)                                                \
+        fmams_rr(W(XG), W(XS), W(XT))
+
+#define fmams3ld(XG, XS, MT, DT)                                            \
+        fmams_ld(W(XG), W(XS), W(MT), W(DT))
+
+/* fms (G = G - S * T) if (#G != #S && #G != #T)
+ * product is exact in fp32, only the sum is rounded before narrowing */
+
+#define fmsms_rr(XG, XS, XT)                                                \
+        trams_rr(W(XG), W(XS), W(XT), sub)
+
+#define fmsms_ld(XG, XS, MT, DT)                                            \
+        trams_ld(W(XG), W(XS), W(MT), W(DT), sub)
+
+#define fmsms3rr(XG, XS, XT)                                                \
+        fmsms_rr(W(XG), W(XS), W(XT))
+
+#define fmsms3ld(XG, XS, MT, DT)                                            \
+        fmsms_ld(W(XG), W(XS), W(MT), W(DT))
+
+/**************   packed half-precision floating-point compare   **************/
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T) */
+
+#define minms_rr(XG, XS)                                                    \
+        bnams_rr(W(XG), W(XS), min)
+
+#define minms_ld(XG, MS, DS)                                                \
+        bnams_ld(W(XG), W(MS), W(DS), min)
+
+#define minms3rr(XD, XS, XT)                                                \
+        movmx_rr(W(XD), W(XS))                                              \
+        minms_rr(W(XD), W(XT))
+
+#define minms3ld(XD, XS, MT, DT)                                            \
+        movmx_rr(W(XD), W(XS))                                              \
+        minms_ld(W(XD), W(MT), W(DT))
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
+
+#define maxms_rr(XG, XS)                                                    \
+        bnams_rr(W(XG), W(XS), max)
+
+#define maxms_ld(XG, MS, DS)                                                \
+        bnams_ld(W(XG), W(MS), W(DS), max)
+
+#define maxms3rr(XD, XS, XT)                                                \
+        movmx_rr(W(XD), W(XS))                                              \
+        maxms_rr(W(XD), W(XT))
+
+#define maxms3ld(XD, XS, MT, DT)                                            \
+        movmx_rr(W(XD), W(XS))                                              \
+        maxms_ld(W(XD), W(MT), W(DT))
+
+/* eq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
+
+#define ceqms_rr(XG, XS)                                                    \
+        cmams_rr(W(XG), W(XS), ceq)
+
+#define ceqms_ld(XG, MS, DS)                                                \
+        cmams_ld(W(XG), W(MS), W(DS), ceq)
+
+#define ceqms3rr(XD, XS, XT)                                                \
+        movmx_rr(W(XD), W(XS))                                              \
+        ceqms_rr(W(XD), W(XT))
+
+#define ceqms3ld(XD, XS, MT, DT)                                            \
+        movmx_rr(W(XD), W(XS))                                              \
+        ceqms_ld(W(XD), W(MT), W(DT))
+
+/* ne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #T) */
+
+#define cnems_rr(XG, XS)                                                    \
+        cmams_rr(W(XG), W(XS), cne)
+
+#define cnems_ld(XG, MS, DS)                                                \
+        cmams_ld(W(XG), W(MS), W(DS), cne)
+
+#define cnems3rr(XD, XS, XT)                                                \
+        movmx_rr(W(XD), W(XS))                                              \
+        cnems_rr(W(XD), W(XT))
+
+#define cnems3ld(XD, XS, MT, DT)                                            \
+        movmx_rr(W(XD), W(XS))                                              \
+        cnems_ld(W(XD), W(MT), W(DT))
+
+/* lt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #T) */
+
+#define cltms_rr(XG, XS)                                                    \
+        cmams_rr(W(XG), W(XS), clt)
+
+#define cltms_ld(XG, MS, DS)                                                \
+        cmams_ld(W(XG), W(MS), W(DS), clt)
+
+#define cltms3rr(XD, XS, XT)                                                \
+        movmx_rr(W(XD), W(XS))                                              \
+        cltms_rr(W(XD), W(XT))
+
+#define cltms3ld(XD, XS, MT, DT)                                            \
+        movmx_rr(W(XD), W(XS))                                              \
+        cltms_ld(W(XD), W(MT), W(DT))
+
+/* le (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #T) */
+
+#define clems_rr(XG, XS)                                                    \
+        cmams_rr(W(XG), W(XS), cle)
+
+#define clems_ld(XG, MS, DS)                                                \
+        cmams_ld(W(XG), W(MS), W(DS), cle)
+
+#define clems3rr(XD, XS, XT)                                                \
+        movmx_rr(W(XD), W(XS))                                              \
+        clems_rr(W(XD), W(XT))
+
+#define clems3ld(XD, XS, MT, DT)                                            \
+        movmx_rr(W(XD), W(XS))                                              \
+        clems_ld(W(XD), W(MT), W(DT))
+
+/* gt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #T) */
+
+#define cgtms_rr(XG, XS)                                                    \
+        cmams_rr(W(XG), W(XS), cgt)
+
+#define cgtms_ld(XG, MS, DS)                                                \
+        cmams_ld(W(XG), W(MS), W(DS), cgt)
+
+#define cgtms3rr(XD, XS, XT)                                                \
+        movmx_rr(W(XD), W(XS))                                              \
+        cgtms_rr(W(XD), W(XT))
+
+#define cgtms3ld(XD, XS, MT, DT)                                            \
+        movmx_rr(W(XD), W(XS))                                              \
+        cgtms_ld(W(XD), W(MT), W(DT))
+
+/* ge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #T) */
+
+#define cgems_rr(XG, XS)                                                    \
+        cmams_rr(W(XG), W(XS), cge)
+
+#define cgems_ld(XG, MS, DS)                                                \
+        cmams_ld(W(XG), W(MS), W(DS), cge)
+
+#define cgems3rr(XD, XS, XT)                                                \
+        movmx_rr(W(XD), W(XS))                                              \
+        cgems_rr(W(XD), W(XT))
+
+#define cgems3ld(XD, XS, MT, DT)                                            \
+        movmx_rr(W(XD), W(XS))                                              \
+        cgems_ld(W(XD), W(MT), W(DT))
+
+/**************   packed half-precision floating-point convert   **************/
+
+/* cvz (D = fp-to-signed-int S)
+ * rounding mode is encoded directly (can be used in FCTRL blocks) */
+
+#define rnzms_rr(XD, XS)                                                    \
+        unams_rr(W(XD), W(XS), rnzos_rr)
+
+#define rnzms_ld(XD, MS, DS)                                                \
+        movmx_ld(W(XD), W(MS), W(DS))                                       \
+        rnzms_rr(W(XD), W(XD))
+
+#define cvzms_rr(XD, XS)                                                    \
+        cvhms_rr(W(XD), W(XS), rnzos_rr)
+
+#define cvzms_ld(XD, MS, DS)                                                \
+        movmx_ld(W(XD), W(MS), W(DS))                                       \
+        cvzms_rr(W(XD), W(XD))
+
+/* cvp (D = fp-to-signed-int S)
+ * rounding mode is encoded directly (can be used in FCTRL blocks) */
+
+#define rnpms_rr(XD, XS)                                                    \
+        unams_rr(W(XD), W(XS), rnpos_rr)
+
+#define rnpms_ld(XD, MS, DS)                                                \
+        movmx_ld(W(XD), W(MS), W(DS))                                       \
+        rnpms_rr(W(XD), W(XD))
+
+#define cvpms_rr(XD, XS)                                                    \
+        cvhms_rr(W(XD), W(XS), rnpos_rr)
+
+#define cvpms_ld(XD, MS, DS)                                                \
+        movmx_ld(W(XD), W(MS), W(DS))                                       \
+        cvpms_rr(W(XD), W(XD))
+
+/* cvm (D = fp-to-signed-int S)
+ * rounding mode is encoded directly (can be used in FCTRL blocks) */
+
+#define rnmms_rr(XD, XS)                                                    \
+        unams_rr(W(XD), W(XS), rnmos_rr)
+
+#define rnmms_ld(XD, MS, DS)                                                \
+        movmx_ld(W(XD), W(MS), W(DS))                                       \
+        rnmms_rr(W(XD), W(XD))
+
+#define cvmms_rr(XD, XS)                                                    \
+        cvhms_rr(W(XD), W(XS), rnmos_rr)
+
+#define cvmms_ld(XD, MS, DS)                                                \
+        movmx_ld(W(XD), W(MS), W(DS))                                       \
+        cvmms_rr(W(XD), W(XD))
+
+/* cvn (D = fp-to-signed-int S)
+ * rounding mode is encoded directly (can be used in FCTRL blocks) */
+
+#define rnnms_rr(XD, XS)                                                    \
+        unams_rr(W(XD), W(XS), rnnos_rr)
+
+#define rnnms_ld(XD, MS, DS)                                                \
+        movmx_ld(W(XD), W(MS), W(DS))                                       \
+        rnnms_rr(W(XD), W(XD))
+
+#define cvnms_rr(XD, XS)                                                    \
+        cvhms_rr(W(XD), W(XS), rnnos_rr)
+
+#define cvnms_ld(XD, MS, DS)                                                \
+        movmx_ld(W(XD), W(MS), W(DS))                                       \
+        cvnms_rr(W(XD), W(XD))
+
+/* cvn (D = signed-int-to-fp S)
+ * rounding mode encoded directly (cannot be used in FCTRL blocks) */
+
+#define cvnmn_rr(XD, XS)                                                    \
+        cvims_rr(W(XD), W(XS))
+
+#define cvnmn_ld(XD, MS, DS)                                                \
+        movmx_ld(W(XD), W(MS), W(DS))                                       \
+        cvnmn_rr(W(XD), W(XD))
+
+/* cvt (D = fp-to-signed-int S)
+ * rounding mode comes from control register (set in FCTRL blocks) */
+
+#define rndms_rr(XD, XS)                                                    \
+        unams_rr(W(XD), W(XS), rndos_rr)
+
+#define rndms_ld(XD, MS, DS)                                                \
+        movmx_ld(W(XD), W(MS), W(DS))                                       \
+        rndms_rr(W(XD), W(XD))
+
+#define cvtms_rr(XD, XS)                                                    \
+        cvhms_rr(W(XD), W(XS), rndos_rr)
+
+#define cvtms_ld(XD, MS, DS)                                                \
+        movmx_ld(W(XD), W(MS), W(DS))                                       \
+        cvtms_rr(W(XD), W(XD))
+
+/* cvt (D = signed-int-to-fp S)
+ * rounding mode comes from control register (set in FCTRL blocks)
+ * generic narrowing always rounds to nearest, exact for |S| <= 2048 */
+
+#define cvtmn_rr(XD, XS)                                                    \
+        cvims_rr(W(XD), W(XS))
+
+#define cvtmn_ld(XD, MS, DS)                                                \
+        movmx_ld(W(XD), W(MS), W(DS))                                       \
+        cvtmn_rr(W(XD), W(XD))
+
+/* cvr (D = fp-to-signed-int S)
+ * rounding mode is encoded directly (can be used in FCTRL blocks) */
+
+#define rnrms_rr(XD, XS, mode)                                              \
+        hemul_sa()                                                          \
+        movox_st(W(XS), Iebp, reg_HSRCS)                                    \
+        unrms_rx(W(XD), mode, h)                                            \
+        movox_st(W(XD), Iebp, reg_HRSLT)                                    \
+        unrms_rx(W(XD), mode, l)                                            \
+        orrox_ld(W(XD), Iebp, reg_HRSLT)                                    \
+        hemul_la()
+
+#define cvrms_rr(XD, XS, mode)                                              \
+        rnrms_rr(W(XD), W(XS), mode)                                        \
+        cvzms_rr(W(XD), W(XD))
+
+#endif /* !(defined addms_rr) */
+
+#if !(defined addns_rr)
+
+/* scalar cmdn* subset operates on the whole vector (elements other than
+ * the 1st one are don't care), memory operands are 16-bit elements */
+
+/**********   scalar half-precision floating-point move/arithmetic   **********/
+
+/* mov (D = S) */
+
+#define movns_rr(XD, XS)                                                    \
+        movmx_rr(W(XD), W(XS))
+
+#define movns_ld(XD, MS, DS)                                                \
+        xorox_rr(W(XD), W(XD))                                              \
+        movox_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        stack_st(Reax)                                                      \
+        movhx_ld(Reax, W(MS), W(DS))                                        \
+        movhx_st(Reax, Mebp, inf_SCR01(0))                                  \
+        stack_ld(Reax)                                                      \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define movns_st(XS, MD, DD)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        stack_st(Reax)                                                      \
+        stack_st(Recx)                                                      \
+        adrxx_ld(Reax, W(MD), W(DD))                                        \
+        movhx_ld(Recx, Mebp, inf_SCR01(0))                                  \
+        movhx_st(Recx, Oeax, PLAIN)                                         \
+        stack_ld(Recx)                                                      \
+        stack_ld(Reax)
+
+/* scalar op with 16-bit memory operand loaded via inf_SCR01 */
+
+#define scans_ld(XG, MS, DS, op) /* not portable, do not use outside */     \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movns_ld(W(XG), W(MS), W(DS))                                       \
+        movox_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        op##ms_ld(W(XG), Mebp, inf_SCR01(0))
+
+/* add (G = G + S), (D = S + T) if (#D != #T) */
+
+#define addns_rr(XG, XS)                                                    \
+        addms_rr(W(XG), W(XS))
+
+#define addns_ld(XG, MS, DS)                                                \
+        scans_ld(W(XG), W(MS), W(DS), add)
+
+#define addns3rr(XD, XS, XT)                                                \
+        movmx_rr(W(XD), W(XS))                                              \
+        addns_rr(W(XD), W(XT))
+
+#define addns3ld(XD, XS, MT, DT)                                            \
+        movmx_rr(W(XD), W(XS))                                              \
+        addns_ld(W(XD), W(MT), W(DT))
+
+/* sub (G = G - S), (D = S - T) if (#D != #T) */
+
+#define subns_rr(XG, XS)                                                    \
+        subms_rr(W(XG), W(XS))
+
+#define subns_ld(XG, MS, DS)                                                \
+        scans_ld(W(XG), W(MS), W(DS), sub)
+
+#define subns3rr(XD, XS, XT)                                                \
+        movmx_rr(W(XD), W(XS))                                              \
+        subns_rr(W(XD), W(XT))
+
+#define subns3ld(XD, XS, MT, DT)                                            \
+        movmx_rr(W(XD), W(XS))                                              \
+        subns_ld(W(XD), W(MT), W(DT))
+
+/* mul (G = G * S), (D = S * T) if (#D != #T) */
+
+#define mulns_rr(XG, XS)                                                    \
+        mulms_rr(W(XG), W(XS))
+
+#define mulns_ld(XG, MS, DS)                                                \
+        scans_ld(W(XG), W(MS), W(DS), mul)
+
+#define mulns3rr(XD, XS, XT)                                                \
+        movmx_rr(W(XD), W(XS))                                              \
+        mulns_rr(W(XD), W(XT))
+
+#define mulns3ld(XD, XS, MT, DT)                                            \
+        movmx_rr(W(XD), W(XS))                                              \
+        mulns_ld(W(XD), W(MT), W(DT))
+
+/* div (G = G / S), (D = S / T) if (#D != #T) */
+
+#define divns_rr(XG, XS)                                                    \
+        divms_rr(W(XG), W(XS))
+
+#define divns_ld(XG, MS, DS)                                                \
+        scans_ld(W(XG), W(MS), W(DS), div)
+
+#define divns3rr(XD, XS, XT)                                                \
+        movmx_rr(W(XD), W(XS))                                              \
+        divns_rr(W(XD), W(XT))
+
+#define divns3ld(XD, XS, MT, DT)                                            \
+        movmx_rr(W(XD), W(XS))                                              \
+        divns_ld(W(XD), W(MT), W(DT))
+
+/* sqr (D = sqrt S) */
+
+#define sqrns_rr(XD, XS)                                                    \
+        sqrms_rr(W(XD), W(XS))
+
+#define sqrns_ld(XD, MS, DS)                                                \
+        movns_ld(W(XD), W(MS), W(DS))                                       \
+        sqrms_rr(W(XD), W(XD))
+
+/* rcp (D = 1.0 / S) */
+
+#define rcens_rr(XD, XS)                                                    \
+        rcems_rr(W(XD), W(XS))
+
+#define rcsns_rr(XG, XS) /* destroys XS */                                  \
+        rcsms_rr(W(XG), W(XS))
+
+/* rsq (D = 1.0 / sqrt S) */
+
+#define rsens_rr(XD, XS)                                                    \
+        rsems_rr(W(XD), W(XS))
+
+#define rssns_rr(XG, XS) /* destroys XS */                                  \
+        rssms_rr(W(XG), W(XS))
+
+/* fma (G = G + S * T) if (#G != #S && #G != #T) */
+
+#define fmans_rr(XG, XS, XT)                                                \
+        fmams_rr(W(XG), W(XS), W(XT))
+
+#define fmans_ld(XG, XS, MT, DT)                                            \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movns_ld(W(XG), W(MT), W(DT))                                       \
+        movox_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        fmams_ld(W(XG), W(XS), Mebp, inf_SCR01(0))
+
+/* fms (G = G - S * T) if (#G != #S && #G != #T) */
+
+#define fmsns_rr(XG, XS, XT)                                                \
+        fmsms_rr(W(XG), W(XS), W(XT))
+
+#define fmsns_ld(XG, XS, MT, DT)                                            \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movns_ld(W(XG), W(MT), W(DT))                                       \
+        movox_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        fmsms_ld(W(XG), W(XS), Mebp, inf_SCR01(0))
+
+/**************   scalar half-precision floating-point compare   **************/
+
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T) */
+
+#define minns_rr(XG, XS)                                                    \
+        minms_rr(W(XG), W(XS))
+
+#define minns_ld(XG, MS, DS)                                                \
+        scans_ld(W(XG), W(MS), W(DS), min)
+
+#define minns3rr(XD, XS, XT)                                                \
+        movmx_rr(W(XD), W(XS))                                              \
+        minns_rr(W(XD), W(XT))
+
+#define minns3ld(XD, XS, MT, DT)                                            \
+        movmx_rr(W(XD), W(XS))                                              \
+        minns_ld(W(XD), W(MT), W(DT))
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
+
+#define maxns_rr(XG, XS)                                                    \
+        maxms_rr(W(XG), W(XS))
+
+#define maxns_ld(XG, MS, DS)                                                \
+        scans_ld(W(XG), W(MS), W(DS), max)
+
+#define maxns3rr(XD, XS, XT)                                                \
+        movmx_rr(W(XD), W(XS))                                              \
+        maxns_rr(W(XD), W(XT))
+
+#define maxns3ld(XD, XS, MT, DT)                                            \
+        movmx_rr(W(XD), W(XS))                                              \
+        maxns_ld(W(XD), W(MT), W(DT))
+
+/* eq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
+
+#define ceqns_rr(XG, XS)                                                    \
+        ceqms_rr(W(XG), W(XS))
+
+#define ceqns_ld(XG, MS, DS)                                                \
+        scans_ld(W(XG), W(MS), W(DS), ceq)
+
+#define ceqns3rr(XD, XS, XT)                                                \
+        movmx_rr(W(XD), W(XS))                                              \
+        ceqns_rr(W(XD), W(XT))
+
+#define ceqns3ld(XD, XS, MT, DT)                                            \
+        movmx_rr(W(XD), W(XS))                                              \
+        ceqns_ld(W(XD), W(MT), W(DT))
+
+/* ne (G = G != S ? -1 : 0), (D = S != T ? -1 : 0) if (#D != #T) */
+
+#define cnens_rr(XG, XS)                                                    \
+        cnems_rr(W(XG), W(XS))
+
+#define cnens_ld(XG, MS, DS)                                                \
+        scans_ld(W(XG), W(MS), W(DS), cne)
+
+#define cnens3rr(XD, XS, XT)                                                \
+        movmx_rr(W(XD), W(XS))                                              \
+        cnens_rr(W(XD), W(XT))
+
+#define cnens3ld(XD, XS, MT, DT)                                            \
+        movmx_rr(W(XD), W(XS))                                              \
+        cnens_ld(W(XD), W(MT), W(DT))
+
+/* lt (G = G < S ? -1 : 0), (D = S < T ? -1 : 0) if (#D != #T) */
+
+#define cltns_rr(XG, XS)                                                    \
+        cltms_rr(W(XG), W(XS))
+
+#define cltns_ld(XG, MS, DS)                                                \
+        scans_ld(W(XG), W(MS), W(DS), clt)
+
+#define cltns3rr(XD, XS, XT)                                                \
+        movmx_rr(W(XD), W(XS))                                              \
+        cltns_rr(W(XD), W(XT))
+
+#define cltns3ld(XD, XS, MT, DT)                                            \
+        movmx_rr(W(XD), W(XS))                                              \
+        cltns_ld(W(XD), W(MT), W(DT))
+
+/* le (G = G <= S ? -1 : 0), (D = S <= T ? -1 : 0) if (#D != #T) */
+
+#define clens_rr(XG, XS)                                                    \
+        clems_rr(W(XG), W(XS))
+
+#define clens_ld(XG, MS, DS)                                                \
+        scans_ld(W(XG), W(MS), W(DS), cle)
+
+#define clens3rr(XD, XS, XT)                                                \
+        movmx_rr(W(XD), W(XS))                                              \
+        clens_rr(W(XD), W(XT))
+
+#define clens3ld(XD, XS, MT, DT)                                            \
+        movmx_rr(W(XD), W(XS))                                              \
+        clens_ld(W(XD), W(MT), W(DT))
+
+/* gt (G = G > S ? -1 : 0), (D = S > T ? -1 : 0) if (#D != #T) */
+
+#define cgtns_rr(XG, XS)                                                    \
+        cgtms_rr(W(XG), W(XS))
+
+#define cgtns_ld(XG, MS, DS)                                                \
+        scans_ld(W(XG), W(MS), W(DS), cgt)
+
+#define cgtns3rr(XD, XS, XT)                                                \
+        movmx_rr(W(XD), W(XS))                                              \
+        cgtns_rr(W(XD), W(XT))
+
+#define cgtns3ld(XD, XS, MT, DT)                                            \
+        movmx_rr(W(XD), W(XS))                                              \
+        cgtns_ld(W(XD), W(MT), W(DT))
+
+/* ge (G = G >= S ? -1 : 0), (D = S >= T ? -1 : 0) if (#D != #T) */
+
+#define cgens_rr(XG, XS)                                                    \
+        cgems_rr(W(XG), W(XS))
+
+#define cgens_ld(XG, MS, DS)                                                \
+        scans_ld(W(XG), W(MS), W(DS), cge)
+
+#define cgens3rr(XD, XS, XT)                                                \
+        movmx_rr(W(XD), W(XS))                                              \
+        cgens_rr(W(XD), W(XT))
+
+#define cgens3ld(XD, XS, MT, DT)                                            \
+        movmx_rr(W(XD), W(XS))                                              \
+        cgens_ld(W(XD), W(MT), W(DT))
+
+#endif /* !(defined addns_rr) */
+
+#if !(defined elmmx_st)
+
+/* elm (D = S), store first SIMD element with natural alignment
+ * allows to decouple scalar subset from SIMD where appropriate */
+
+#define elmmx_st(XS, MD, DD) /* 1st elem as in mem with SIMD load/store */  \
+        movns_st(W(XS), W(MD), W(DD))
+
+#endif /* !(defined elmmx_st) */
+
+#if !(defined adhms_rr)
+
+/**************   packed half-precision horizontal reductions   ***************/
+
+/* Reductions across all fp16 elements widen both halves to fp32 (exact),
+ * combine them vertically and reduce with cmdo* horizontal ops, so that
+ * sums are accumulated in fp32 and rounded to fp16 only once, while min/max
+ * results are exact. Results are broadcast to all fp16 elements.
+ * As with adhos, only the first 15 SIMD registers can be used as arguments. */
+
+/* adw (G = G + S), fp32 accumulator G, fp16 source S,
+ * partial sums of both halves are added to G in unspecified lanes,
+ * for long fp32-accumulated sums, reduce G with adhos at the end */
+
+#define adwms_rr(XG, XS)                                                    \
+        hemul_sa()                                                          \
+        movox_st(W(XS), Iebp, reg_HSRCS)                                    \
+        movox_st(W(XG), Iebp, reg_HSRCG)                                    \
+        adwms_rx(W(XG))                                                     \
+        hemul_la()
+
+#define adwms_ld(XG, MS, DS)                                                \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movmx_ld(W(XG), W(MS), W(DS))                                       \
+        hemul_sa()                                                          \
+        movox_st(W(XG), Iebp, reg_HSRCS)                                    \
+        movox_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        movox_st(W(XG), Iebp, reg_HSRCG)                                    \
+        adwms_rx(W(XG))                                                     \
+        hemul_la()
+
+#define adwms_rx(XG) /* not portable, do not use outside */                 \
+        movox_ld(W(XG), Iebp, reg_HSRCS)                                    \
+        wdhms_rx(W(XG))                                                     \
+        addos_ld(W(XG), Iebp, reg_HSRCG)                                    \
+        movox_st(W(XG), Iebp, reg_HSRCG)                                    \
+        movox_ld(W(XG), Iebp, reg_HSRCS)                                    \
+        wdlms_rx(W(XG))                                                     \
+        addos_ld(W(XG), Iebp, reg_HSRCG)
+
+/* adh (D = S[0] + ... + S[N-1]), fp32 accumulation */
+
+#define adhms_rr(XD, XS)                                                    \
+        hrdms_rr(W(XD), W(XS), add, adh)
+
+#define adhms_ld(XD, MS, DS)                                                \
+        movmx_ld(W(XD), W(MS), W(DS))                                       \
+        adhms_rr(W(XD), W(XD))
+
+/* mnh (D = min(S[0], ..., S[N-1])) */
+
+#define mnhms_rr(XD, XS)                                                    \
+        hrdms_rr(W(XD), W(XS), min, mnh)
+
+#define mnhms_ld(XD, MS, DS)                                                \
+        movmx_ld(W(XD), W(MS), W(DS))                                       \
+        mnhms_rr(W(XD), W(XD))
+
+/* mxh (D = max(S[0], ..., S[N-1])) */
+
+#define mxhms_rr(XD, XS)                                                    \
+        hrdms_rr(W(XD), W(XS), max, mxh)
+
+#define mxhms_ld(XD, MS, DS)                                                \
+        movmx_ld(W(XD), W(MS), W(DS))                                       \
+        mxhms_rr(W(XD), W(XD))
+
+/* horizontal reduction (D = hop(S.hi op S.lo)), rounded once,
+ * narrowed onto both halves from the same fp32 broadcast */
+
+#define hrdms_rr(XD, XS, op, hop) /* not portable, do not use outside */    \
+        hemul_sa()                                                          \
+        movox_st(W(XS), Iebp, reg_HSRCS)                                    \
+        movox_ld(W(XD), Iebp, reg_HSRCS)                                    \
+        wdhms_rx(W(XD))                                                     \
+        movox_st(W(XD), Iebp, reg_HPART)                                    \
+        movox_ld(W(XD), Iebp, reg_HSRCS)                                    \
+        wdlms_rx(W(XD))                                                     \
+        op##os_ld(W(XD), Iebp, reg_HPART)                                   \
+        hop##os_rr(W(XD), W(XD))                                            \
+        movox_st(W(XD), Iebp, reg_HPART)                                    \
+        nrhms_rx(W(XD))                                                     \
+        movox_st(W(XD), Iebp, reg_HRSLT)                                    \
+        movox_ld(W(XD), Iebp, reg_HPART)                                    \
+        nrlms_rx(W(XD))                                                     \
+        orrox_ld(W(XD), Iebp, reg_HRSLT)                                    \
+        hemul_la()
+
+#endif /* !(defined adhms_rr) */
+
 /******************************************************************************/
 /**** var-len **** SIMD instructions with fixed-32-bit element **** 256-bit ***/
 /******************************************************************************/
@@ -3507,6 +4683,14 @@
 #define movox_st(XS, MD, DD)                                                \
         movcx_st(W(XS), W(MD), W(DD))
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment */
+
+#define muvox_ld(XD, MS, DS)                                                \
+        muvcx_ld(W(XD), W(MS), W(DS))
+
+#define muvox_st(XS, MD, DD)                                                \
+        muvcx_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -3519,6 +4703,36 @@
 #define mmvox_st(XS, MG, DG)                                                \
         mmvcx_st(W(XS), W(MG), W(DG))
 
+/* unl (G = G unpack-low S), (D = S unpack-low T) if (#D != #T)
+ * interleaves lower halves of each 128-bit lane, S-elements go first */
+
+#define unlox_rr(XG, XS)                                                    \
+        unlcx_rr(W(XG), W(XS))
+
+#define unlox_ld(XG, MS, DS)                                                \
+        unlcx_ld(W(XG), W(MS), W(DS))
+
+#define unlox3rr(XD, XS, XT)                                                \
+        unlcx3rr(W(XD), W(XS), W(XT))
+
+#define unlox3ld(XD, XS, MT, DT)                                            \
+        unlcx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* unh (G = G unpack-high S), (D = S unpack-high T) if (#D != #T)
+ * interleaves upper halves of each 128-bit lane, S-elements go first */
+
+#define unhox_rr(XG, XS)                                                    \
+        unhcx_rr(W(XG), W(XS))
+
+#define unhox_ld(XG, MS, DS)                                                \
+        unhcx_ld(W(XG), W(MS), W(DS))
+
+#define unhox3rr(XD, XS, XT)                                                \
+        unhcx3rr(W(XD), W(XS), W(XT))
+
+#define unhox3ld(XD, XS, MT, DT)                                            \
+        unhcx3ld(W(XD), W(XS), W(MT), W(DT))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andox_rr(XG, XS)                                                    \
@@ -4403,8 +5617,16 @@
 #define movox_ld(XD, MS, DS)                                                \
         movix_ld(W(XD), W(MS), W(DS))
 
-#define movox_st(XS, MD, DD)                                                \
-        movix_st(W(XS), W(MD), W(DD))
+#define movox_st(XS, MD, DD)                                                \
+        movix_st(W(XS), W(MD), W(DD))
+
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment */
+
+#define muvox_ld(XD, MS, DS)                                                \
+        muvix_ld(W(XD), W(MS), W(DS))
+
+#define muvox_st(XS, MD, DD)                                                \
+        muvix_st(W(XS), W(MD), W(DD))
 
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
@@ -4418,6 +5640,36 @@
 #define mmvox_st(XS, MG, DG)                                                \
         mmvix_st(W(XS), W(MG), W(DG))
 
+/* unl (G = G unpack-low S), (D = S unpack-low T) if (#D != #T)
+ * interleaves lower halves of each 128-bit lane, S-elements go first */
+
+#define unlox_rr(XG, XS)                                                    \
+        unlix_rr(W(XG), W(XS))
+
+#define unlox_ld(XG, MS, DS)                                                \
+        unlix_ld(W(XG), W(MS), W(DS))
+
+#define unlox3rr(XD, XS, XT)                                                \
+        unlix3rr(W(XD), W(XS), W(XT))
+
+#define unlox3ld(XD, XS, MT, DT)                                            \
+        unlix3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* unh (G = G unpack-high S), (D = S unpack-high T) if (#D != #T)
+ * interleaves upper halves of each 128-bit lane, S-elements go first */
+
+#define unhox_rr(XG, XS)                                                    \
+        unhix_rr(W(XG), W(XS))
+
+#define unhox_ld(XG, MS, DS)                                                \
+        unhix_ld(W(XG), W(MS), W(DS))
+
+#define unhox3rr(XD, XS, XT)                                                \
+        unhix3rr(W(XD), W(XS), W(XT))
+
+#define unhox3ld(XD, XS, MT, DT)                                            \
+        unhix3ld(W(XD), W(XS), W(MT), W(DT))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andox_rr(XG, XS)                                                    \
@@ -5307,6 +6559,14 @@
 #define movqx_st(XS, MD, DD)                                                \
         movdx_st(W(XS), W(MD), W(DD))
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment */
+
+#define muvqx_ld(XD, MS, DS)                                                \
+        muvdx_ld(W(XD), W(MS), W(DS))
+
+#define muvqx_st(XS, MD, DD)                                                \
+        muvdx_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -5319,6 +6579,36 @@
 #define mmvqx_st(XS, MG, DG)                                                \
         mmvdx_st(W(XS), W(MG), W(DG))
 
+/* unl (G = G unpack-low S), (D = S unpack-low T) if (#D != #T)
+ * interleaves lower halves of each 128-bit lane, S-elements go first */
+
+#define unlqx_rr(XG, XS)                                                    \
+        unldx_rr(W(XG), W(XS))
+
+#define unlqx_ld(XG, MS, DS)                                                \
+        unldx_ld(W(XG), W(MS), W(DS))
+
+#define unlqx3rr(XD, XS, XT)                                                \
+        unldx3rr(W(XD), W(XS), W(XT))
+
+#define unlqx3ld(XD, XS, MT, DT)                                            \
+        unldx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* unh (G = G unpack-high S), (D = S unpack-high T) if (#D != #T)
+ * interleaves upper halves of each 128-bit lane, S-elements go first */
+
+#define unhqx_rr(XG, XS)                                                    \
+        unhdx_rr(W(XG), W(XS))
+
+#define unhqx_ld(XG, MS, DS)                                                \
+        unhdx_ld(W(XG), W(MS), W(DS))
+
+#define unhqx3rr(XD, XS, XT)                                                \
+        unhdx3rr(W(XD), W(XS), W(XT))
+
+#define unhqx3ld(XD, XS, MT, DT)                                            \
+        unhdx3ld(W(XD), W(XS), W(MT), W(DT))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andqx_rr(XG, XS)                                                    \
@@ -5865,6 +7155,21 @@
 #define addqx3ld(XD, XS, MT, DT)                                            \
         adddx3ld(W(XD), W(XS), W(MT), W(DT))
 
+/* mlw (G = G[31:0] * S[31:0]), (D = S[31:0] * T[31:0]) if (#D != #T)
+ * unsigned 32x32 to 64-bit product of lower halves of 64-bit elements */
+
+#define mlwqx_rr(XG, XS)                                                    \
+        mlwdx_rr(W(XG), W(XS))
+
+#define mlwqx_ld(XG, MS, DS)                                                \
+        mlwdx_ld(W(XG), W(MS), W(DS))
+
+#define mlwqx3rr(XD, XS, XT)                                                \
+        mlwdx3rr(W(XD), W(XS), W(XT))
+
+#define mlwqx3ld(XD, XS, MT, DT)                                            \
+        mlwdx3ld(W(XD), W(XS), W(MT), W(DT))
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subqx_rr(XG, XS)                                                    \
@@ -6206,6 +7511,14 @@
 #define movqx_st(XS, MD, DD)                                                \
         movjx_st(W(XS), W(MD), W(DD))
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment */
+
+#define muvqx_ld(XD, MS, DS)                                                \
+        muvjx_ld(W(XD), W(MS), W(DS))
+
+#define muvqx_st(XS, MD, DD)                                                \
+        muvjx_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -6218,6 +7531,36 @@
 #define mmvqx_st(XS, MG, DG)                                                \
         mmvjx_st(W(XS), W(MG), W(DG))
 
+/* unl (G = G unpack-low S), (D = S unpack-low T) if (#D != #T)
+ * interleaves lower halves of each 128-bit lane, S-elements go first */
+
+#define unlqx_rr(XG, XS)                                                    \
+        unljx_rr(W(XG), W(XS))
+
+#define unlqx_ld(XG, MS, DS)                                                \
+        unljx_ld(W(XG), W(MS), W(DS))
+
+#define unlqx3rr(XD, XS, XT)                                                \
+        unljx3rr(W(XD), W(XS), W(XT))
+
+#define unlqx3ld(XD, XS, MT, DT)                                            \
+        unljx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* unh (G = G unpack-high S), (D = S unpack-high T) if (#D != #T)
+ * interleaves upper halves of each 128-bit lane, S-elements go first */
+
+#define unhqx_rr(XG, XS)                                                    \
+        unhjx_rr(W(XG), W(XS))
+
+#define unhqx_ld(XG, MS, DS)                                                \
+        unhjx_ld(W(XG), W(MS), W(DS))
+
+#define unhqx3rr(XD, XS, XT)                                                \
+        unhjx3rr(W(XD), W(XS), W(XT))
+
+#define unhqx3ld(XD, XS, MT, DT)                                            \
+        unhjx3ld(W(XD), W(XS), W(MT), W(DT))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andqx_rr(XG, XS)                                                    \
@@ -6764,6 +8107,21 @@
 #define addqx3ld(XD, XS, MT, DT)                                            \
         addjx3ld(W(XD), W(XS), W(MT), W(DT))
 
+/* mlw (G = G[31:0] * S[31:0]), (D = S[31:0] * T[31:0]) if (#D != #T)
+ * unsigned 32x32 to 64-bit product of lower halves of 64-bit elements */
+
+#define mlwqx_rr(XG, XS)                                                    \
+        mlwjx_rr(W(XG), W(XS))
+
+#define mlwqx_ld(XG, MS, DS)                                                \
+        mlwjx_ld(W(XG), W(MS), W(DS))
+
+#define mlwqx3rr(XD, XS, XT)                                                \
+        mlwjx3rr(W(XD), W(XS), W(XT))
+
+#define mlwqx3ld(XD, XS, MT, DT)                                            \
+        mlwjx3ld(W(XD), W(XS), W(MT), W(DT))
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subqx_rr(XG, XS)                                                    \
@@ -7107,6 +8465,14 @@
 #define movpx_st(XS, MD, DD)                                                \
         movox_st(W(XS), W(MD), W(DD))
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment */
+
+#define muvpx_ld(XD, MS, DS)                                                \
+        muvox_ld(W(XD), W(MS), W(DS))
+
+#define muvpx_st(XS, MD, DD)                                                \
+        muvox_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -7119,6 +8485,36 @@
 #define mmvpx_st(XS, MG, DG)                                                \
         mmvox_st(W(XS), W(MG), W(DG))
 
+/* unl (G = G unpack-low S), (D = S unpack-low T) if (#D != #T)
+ * interleaves lower halves of each 128-bit lane, S-elements go first */
+
+#define unlpx_rr(XG, XS)                                                    \
+        unlox_rr(W(XG), W(XS))
+
+#define unlpx_ld(XG, MS, DS)                                                \
+        unlox_ld(W(XG), W(MS), W(DS))
+
+#define unlpx3rr(XD, XS, XT)                                                \
+        unlox3rr(W(XD), W(XS), W(XT))
+
+#define unlpx3ld(XD, XS, MT, DT)                                            \
+        unlox3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* unh (G = G unpack-high S), (D = S unpack-high T) if (#D != #T)
+ * interleaves upper halves of each 128-bit lane, S-elements go first */
+
+#define unhpx_rr(XG, XS)                                                    \
+        unhox_rr(W(XG), W(XS))
+
+#define unhpx_ld(XG, MS, DS)                                                \
+        unhox_ld(W(XG), W(MS), W(DS))
+
+#define unhpx3rr(XD, XS, XT)                                                \
+        unhox3rr(W(XD), W(XS), W(XT))
+
+#define unhpx3ld(XD, XS, MT, DT)                                            \
+        unhox3ld(W(XD), W(XS), W(MT), W(DT))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andpx_rr(XG, XS)                                                    \
@@ -8004,6 +9400,14 @@
 #define movfx_st(XS, MD, DD)                                                \
         movcx_st(W(XS), W(MD), W(DD))
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment */
+
+#define muvfx_ld(XD, MS, DS)                                                \
+        muvcx_ld(W(XD), W(MS), W(DS))
+
+#define muvfx_st(XS, MD, DD)                                                \
+        muvcx_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -8016,6 +9420,36 @@
 #define mmvfx_st(XS, MG, DG)                                                \
         mmvcx_st(W(XS), W(MG), W(DG))
 
+/* unl (G = G unpack-low S), (D = S unpack-low T) if (#D != #T)
+ * interleaves lower halves of each 128-bit lane, S-elements go first */
+
+#define unlfx_rr(XG, XS)                                                    \
+        unlcx_rr(W(XG), W(XS))
+
+#define unlfx_ld(XG, MS, DS)                                                \
+        unlcx_ld(W(XG), W(MS), W(DS))
+
+#define unlfx3rr(XD, XS, XT)                                                \
+        unlcx3rr(W(XD), W(XS), W(XT))
+
+#define unlfx3ld(XD, XS, MT, DT)                                            \
+        unlcx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* unh (G = G unpack-high S), (D = S unpack-high T) if (#D != #T)
+ * interleaves upper halves of each 128-bit lane, S-elements go first */
+
+#define unhfx_rr(XG, XS)                                                    \
+        unhcx_rr(W(XG), W(XS))
+
+#define unhfx_ld(XG, MS, DS)                                                \
+        unhcx_ld(W(XG), W(MS), W(DS))
+
+#define unhfx3rr(XD, XS, XT)                                                \
+        unhcx3rr(W(XD), W(XS), W(XT))
+
+#define unhfx3ld(XD, XS, MT, DT)                                            \
+        unhcx3ld(W(XD), W(XS), W(MT), W(DT))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andfx_rr(XG, XS)                                                    \
@@ -8901,6 +10335,14 @@
 #define movlx_st(XS, MD, DD)                                                \
         movix_st(W(XS), W(MD), W(DD))
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment */
+
+#define muvlx_ld(XD, MS, DS)                                                \
+        muvix_ld(W(XD), W(MS), W(DS))
+
+#define muvlx_st(XS, MD, DD)                                                \
+        muvix_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -8913,6 +10355,36 @@
 #define mmvlx_st(XS, MG, DG)                                                \
         mmvix_st(W(XS), W(MG), W(DG))
 
+/* unl (G = G unpack-low S), (D = S unpack-low T) if (#D != #T)
+ * interleaves lower halves of each 128-bit lane, S-elements go first */
+
+#define unllx_rr(XG, XS)                                                    \
+        unlix_rr(W(XG), W(XS))
+
+#define unllx_ld(XG, MS, DS)                                                \
+        unlix_ld(W(XG), W(MS), W(DS))
+
+#define unllx3rr(XD, XS, XT)                                                \
+        unlix3rr(W(XD), W(XS), W(XT))
+
+#define unllx3ld(XD, XS, MT, DT)                                            \
+        unlix3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* unh (G = G unpack-high S), (D = S unpack-high T) if (#D != #T)
+ * interleaves upper halves of each 128-bit lane, S-elements go first */
+
+#define unhlx_rr(XG, XS)                                                    \
+        unhix_rr(W(XG), W(XS))
+
+#define unhlx_ld(XG, MS, DS)                                                \
+        unhix_ld(W(XG), W(MS), W(DS))
+
+#define unhlx3rr(XD, XS, XT)                                                \
+        unhix3rr(W(XD), W(XS), W(XT))
+
+#define unhlx3ld(XD, XS, MT, DT)                                            \
+        unhix3ld(W(XD), W(XS), W(MT), W(DT))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andlx_rr(XG, XS)                                                    \
@@ -10051,6 +11523,14 @@
 #define movpx_st(XS, MD, DD)                                                \
         movqx_st(W(XS), W(MD), W(DD))
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment */
+
+#define muvpx_ld(XD, MS, DS)                                                \
+        muvqx_ld(W(XD), W(MS), W(DS))
+
+#define muvpx_st(XS, MD, DD)                                                \
+        muvqx_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -10063,6 +11543,36 @@
 #define mmvpx_st(XS, MG, DG)                                                \
         mmvqx_st(W(XS), W(MG), W(DG))
 
+/* unl (G = G unpack-low S), (D = S unpack-low T) if (#D != #T)
+ * interleaves lower halves of each 128-bit lane, S-elements go first */
+
+#define unlpx_rr(XG, XS)                                                    \
+        unlqx_rr(W(XG), W(XS))
+
+#define unlpx_ld(XG, MS, DS)                                                \
+        unlqx_ld(W(XG), W(MS), W(DS))
+
+#define unlpx3rr(XD, XS, XT)                                                \
+        unlqx3rr(W(XD), W(XS), W(XT))
+
+#define unlpx3ld(XD, XS, MT, DT)                                            \
+        unlqx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* unh (G = G unpack-high S), (D = S unpack-high T) if (#D != #T)
+ * interleaves upper halves of each 128-bit lane, S-elements go first */
+
+#define unhpx_rr(XG, XS)                                                    \
+        unhqx_rr(W(XG), W(XS))
+
+#define unhpx_ld(XG, MS, DS)                                                \
+        unhqx_ld(W(XG), W(MS), W(DS))
+
+#define unhpx3rr(XD, XS, XT)                                                \
+        unhqx3rr(W(XD), W(XS), W(XT))
+
+#define unhpx3ld(XD, XS, MT, DT)                                            \
+        unhqx3ld(W(XD), W(XS), W(MT), W(DT))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andpx_rr(XG, XS)                                                    \
@@ -10948,6 +12458,14 @@
 #define movfx_st(XS, MD, DD)                                                \
         movdx_st(W(XS), W(MD), W(DD))
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment */
+
+#define muvfx_ld(XD, MS, DS)                                                \
+        muvdx_ld(W(XD), W(MS), W(DS))
+
+#define muvfx_st(XS, MD, DD)                                                \
+        muvdx_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -10960,6 +12478,36 @@
 #define mmvfx_st(XS, MG, DG)                                                \
         mmvdx_st(W(XS), W(MG), W(DG))
 
+/* unl (G = G unpack-low S), (D = S unpack-low T) if (#D != #T)
+ * interleaves lower halves of each 128-bit lane, S-elements go first */
+
+#define unlfx_rr(XG, XS)                                                    \
+        unldx_rr(W(XG), W(XS))
+
+#define unlfx_ld(XG, MS, DS)                                                \
+        unldx_ld(W(XG), W(MS), W(DS))
+
+#define unlfx3rr(XD, XS, XT)                                                \
+        unldx3rr(W(XD), W(XS), W(XT))
+
+#define unlfx3ld(XD, XS, MT, DT)                                            \
+        unldx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* unh (G = G unpack-high S), (D = S unpack-high T) if (#D != #T)
+ * interleaves upper halves of each 128-bit lane, S-elements go first */
+
+#define unhfx_rr(XG, XS)                                                    \
+        unhdx_rr(W(XG), W(XS))
+
+#define unhfx_ld(XG, MS, DS)                                                \
+        unhdx_ld(W(XG), W(MS), W(DS))
+
+#define unhfx3rr(XD, XS, XT)                                                \
+        unhdx3rr(W(XD), W(XS), W(XT))
+
+#define unhfx3ld(XD, XS, MT, DT)                                            \
+        unhdx3ld(W(XD), W(XS), W(MT), W(DT))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andfx_rr(XG, XS)                                                    \
@@ -11845,6 +13393,14 @@
 #define movlx_st(XS, MD, DD)                                                \
         movjx_st(W(XS), W(MD), W(DD))
 
+/* muv (D = S), same as mov, memory address doesn't need SIMD-alignment */
+
+#define muvlx_ld(XD, MS, DS)                                                \
+        muvjx_ld(W(XD), W(MS), W(DS))
+
+#define muvlx_st(XS, MD, DD)                                                \
+        muvjx_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -11857,6 +13413,36 @@
 #define mmvlx_st(XS, MG, DG)                                                \
         mmvjx_st(W(XS), W(MG), W(DG))
 
+/* unl (G = G unpack-low S), (D = S unpack-low T) if (#D != #T)
+ * interleaves lower halves of each 128-bit lane, S-elements go first */
+
+#define unllx_rr(XG, XS)                                                    \
+        unljx_rr(W(XG), W(XS))
+
+#define unllx_ld(XG, MS, DS)                                                \
+        unljx_ld(W(XG), W(MS), W(DS))
+
+#define unllx3rr(XD, XS, XT)                                                \
+        unljx3rr(W(XD), W(XS), W(XT))
+
+#define unllx3ld(XD, XS, MT, DT)                                            \
+        unljx3ld(W(XD), W(XS), W(MT), W(DT))
+
+/* unh (G = G unpack-high S), (D = S unpack-high T) if (#D != #T)
+ * interleaves upper halves of each 128-bit lane, S-elements go first */
+
+#define unhlx_rr(XG, XS)                                                    \
+        unhjx_rr(W(XG), W(XS))
+
+#define unhlx_ld(XG, MS, DS)                                                \
+        unhjx_ld(W(XG), W(MS), W(DS))
+
+#define unhlx3rr(XD, XS, XT)                                                \
+        unhjx3rr(W(XD), W(XS), W(XT))
+
+#define unhlx3ld(XD, XS, MT, DT)                                            \
+        unhjx3ld(W(XD), W(XS), W(MT), W(DT))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andlx_rr(XG, XS)                                                    \
@@ -12972,6 +14558,48 @@
 
 #endif /* RT_ELEMENT */
 
+/******************************************************************************/
+/***************   packed element-sized integer argmin/argmax   ***************/
+/******************************************************************************/
+
+/* amn (Redx = min(Redx, S), Rebx = index from T of the first such key)
+ * per-register argmin of signed int keys in S with signed int indices in T,
+ * merged with running key Redx and index Rebx, ties resolve to lower index,
+ * so that a running argmin can be kept across registers and scalar steps,
+ * fp values can be mapped to ordered int keys first (flip magnitude bits
+ * of negative values), lb, ln, lt are labels used within the expansion,
+ * destroys Reax, uses SCR01, SCR02 */
+
+#define amnpn_rx(XS, XT, lb, ln, lt)                                        \
+        amgpn_rx(W(XS), W(XT), GT_n, lb, ln, lt)
+
+/* amx (Redx = max(Redx, S), Rebx = index from T of the first such key)
+ * per-register argmax, same rules as for amn above */
+
+#define amxpn_rx(XS, XT, lb, ln, lt)                                        \
+        amgpn_rx(W(XS), W(XT), LT_n, lb, ln, lt)
+
+/* not portable, do not use outside */
+
+#define amgpn_rx(XS, XT, jr, lb, ln, lt)                                    \
+        movpx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movpx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        movxx_ri(Reax, IC(0))                                               \
+    LBL(lb)                                                                 \
+        cmjyx_rm(Redx, Iebp, inf_SCR01(0),                                  \
+        /* if */ jr, lt##f)                                                 \
+        cmjyx_rm(Redx, Iebp, inf_SCR01(0),                                  \
+        /* if */ NE_x, ln##f)                                               \
+        cmjyx_rm(Rebx, Iebp, inf_SCR02(0),                                  \
+        /* if */ LE_n, ln##f)                                               \
+    LBL(lt)                                                                 \
+        movyx_ld(Redx, Iebp, inf_SCR01(0))                                  \
+        movyx_ld(Rebx, Iebp, inf_SCR02(0))                                  \
+    LBL(ln)                                                                 \
+        addxx_ri(Reax, IB(L*4))                                             \
+        cmjxx_ri(Reax, IM(S*L*4),                                           \
+        /* if */ LT_x, lb##b)
+
 #endif /* RT_SIMD_CODE */
 
 /******************************************************************************/
@@ -13684,6 +15312,22 @@
 #define mulxp_xm(MS, DS) /* Reax is in/out, prepares Redx for divxn_x* */   \
         mulwp_xm(W(MS), W(DS))/* product must not exceed operands size */
 
+/* mhi (G = G * S >> 32), high half of full 32x32-bit product
+ * set-flags: undefined
+ * low half is given by mulxx_**, both halves at once by mulx*_x* */
+
+#define mhixx_rr(RG, RS)                                                    \
+        mhiwx_rr(W(RG), W(RS))
+
+#define mhixx_ld(RG, MS, DS)                                                \
+        mhiwx_ld(W(RG), W(MS), W(DS))
+
+#define mhixn_rr(RG, RS)                                                    \
+        mhiwn_rr(W(RG), W(RS))
+
+#define mhixn_ld(RG, MS, DS)                                                \
+        mhiwn_ld(W(RG), W(MS), W(DS))
+
 /* div (G = G / S)
  * set-flags: undefined */
 
@@ -13855,6 +15499,64 @@
 #define cmpxx_mr(MS, DS, RT)                                                \
         cmpwx_mr(W(MS), W(DS), W(RT))
 
+/* xad (G = M, M = M + G), atomic fetch-add
+ * set-flags: undefined
+ * xad, xch, cas need natural alignment of memory args
+ * and are sequentially consistent (act as full memory barriers) */
+
+#define xadxx_st(RG, MG, DG)                                                \
+        xadwx_st(W(RG), W(MG), W(DG))
+
+/* xch (G = M, M = G), atomic exchange
+ * set-flags: undefined */
+
+#define xchxx_st(RG, MG, DG)                                                \
+        xchwx_st(W(RG), W(MG), W(DG))
+
+/* cas (if M == Reax then M = S, Reax = M), atomic compare-and-swap
+ * set-flags: undefined
+ * success is checked by comparing Reax to its value before cas */
+
+#define casxx_st(RS, MG, DG)     /* Reax is in/out, RS, MG != Reax */       \
+        caswx_st(W(RS), W(MG), W(DG))
+
+/* fen (memory-ordering fence)
+ * set-flags: no */
+
+     /* fenxx_** is defined in 32-bit rtarch_***.h files */
+
+/* cnt (D = number of set bits in S), population count
+ * set-flags: undefined */
+
+#define cntxx_rr(RD, RS)                                                    \
+        cntwx_rr(W(RD), W(RS))
+
+/* clz (D = number of leading zeros in S)
+ * set-flags: undefined
+ * clz, ctz return operand size in bits for zero source */
+
+#define clzxx_rr(RD, RS)                                                    \
+        clzwx_rr(W(RD), W(RS))
+
+/* ctz (D = number of trailing zeros in S)
+ * set-flags: undefined */
+
+#define ctzxx_rr(RD, RS)                                                    \
+        ctzwx_rr(W(RD), W(RS))
+
+/* bsw (D = S with bytes in reversed order), byte swap
+ * set-flags: undefined */
+
+#define bswxx_rr(RD, RS)                                                    \
+        bswwx_rr(W(RD), W(RS))
+
+/* bfx (G = G >> IS & ((1 << IT) - 1)), unsigned bit-field extract
+ * set-flags: undefined
+ * IT > 0, IS + IT <= 32 */
+
+#define bfxxx_ri(RG, IS, IT)                                                \
+        bfxwx_ri(W(RG), W(IS), W(IT))
+
 /* ver (Mebp/inf_VER = SIMD-version)
  * set-flags: no
  * For interpretation of SIMD build flags check compatibility layer in rtzero.h
@@ -14477,6 +16179,22 @@
 #define mulxp_xm(MS, DS) /* Reax is in/out, prepares Redx for divxn_x* */   \
         mulzp_xm(W(MS), W(DS))/* product must not exceed operands size */
 
+/* mhi (G = G * S >> 64), high half of full 64x64-bit product
+ * set-flags: undefined
+ * low half is given by mulxx_**, both halves at once by mulx*_x* */
+
+#define mhixx_rr(RG, RS)                                                    \
+        mhizx_rr(W(RG), W(RS))
+
+#define mhixx_ld(RG, MS, DS)                                                \
+        mhizx_ld(W(RG), W(MS), W(DS))
+
+#define mhixn_rr(RG, RS)                                                    \
+        mhizn_rr(W(RG), W(RS))
+
+#define mhixn_ld(RG, MS, DS)                                                \
+        mhizn_ld(W(RG), W(MS), W(DS))
+
 /* div (G = G / S)
  * set-flags: undefined */
 
@@ -14648,6 +16366,64 @@
 #define cmpxx_mr(MS, DS, RT)                                                \
         cmpzx_mr(W(MS), W(DS), W(RT))
 
+/* xad (G = M, M = M + G), atomic fetch-add
+ * set-flags: undefined
+ * xad, xch, cas need natural alignment of memory args
+ * and are sequentially consistent (act as full memory barriers) */
+
+#define xadxx_st(RG, MG, DG)                                                \
+        xadzx_st(W(RG), W(MG), W(DG))
+
+/* xch (G = M, M = G), atomic exchange
+ * set-flags: undefined */
+
+#define xchxx_st(RG, MG, DG)                                                \
+        xchzx_st(W(RG), W(MG), W(DG))
+
+/* cas (if M == Reax then M = S, Reax = M), atomic compare-and-swap
+ * set-flags: undefined
+ * success is checked by comparing Reax to its value before cas */
+
+#define casxx_st(RS, MG, DG)     /* Reax is in/out, RS, MG != Reax */       \
+        caszx_st(W(RS), W(MG), W(DG))
+
+/* fen (memory-ordering fence)
+ * set-flags: no */
+
+     /* fenxx_** is defined in 32-bit rtarch_***.h files */
+
+/* cnt (D = number of set bits in S), population count
+ * set-flags: undefined */
+
+#define cntxx_rr(RD, RS)                                                    \
+        cntzx_rr(W(RD), W(RS))
+
+/* clz (D = number of leading zeros in S)
+ * set-flags: undefined
+ * clz, ctz return operand size in bits for zero source */
+
+#define clzxx_rr(RD, RS)                                                    \
+        clzzx_rr(W(RD), W(RS))
+
+/* ctz (D = number of trailing zeros in S)
+ * set-flags: undefined */
+
+#define ctzxx_rr(RD, RS)                                                    \
+        ctzzx_rr(W(RD), W(RS))
+
+/* bsw (D = S with bytes in reversed order), byte swap
+ * set-flags: undefined */
+
+#define bswxx_rr(RD, RS)                                                    \
+        bswzx_rr(W(RD), W(RS))
+
+/* bfx (G = G >> IS & ((1 << IT) - 1)), unsigned bit-field extract
+ * set-flags: undefined
+ * IT > 0, IS + IT <= 64 */
+
+#define bfxxx_ri(RG, IS, IT)                                                \
+        bfxzx_ri(W(RG), W(IS), W(IT))
+
 /* ver (Mebp/inf_VER = SIMD-version)
  * set-flags: no
  * For interpretation of SIMD build flags check compatibility layer in rtzero.h
@@ -15272,6 +17048,22 @@
 #define mulyp_xm(MS, DS) /* Reax is in/out, prepares Redx for divyn_x* */   \
         mulwp_xm(W(MS), W(DS))/* product must not exceed operands size */
 
+/* mhi (G = G * S >> 32), high half of full 32x32-bit product
+ * set-flags: undefined
+ * low half is given by mulyx_**, both halves at once by muly*_x* */
+
+#define mhiyx_rr(RG, RS)                                                    \
+        mhiwx_rr(W(RG), W(RS))
+
+#define mhiyx_ld(RG, MS, DS)                                                \
+        mhiwx_ld(W(RG), W(MS), W(DS))
+
+#define mhiyn_rr(RG, RS)                                                    \
+        mhiwn_rr(W(RG), W(RS))
+
+#define mhiyn_ld(RG, MS, DS)                                                \
+        mhiwn_ld(W(RG), W(MS), W(DS))
+
 /* div (G = G / S)
  * set-flags: undefined */
 
@@ -15443,6 +17235,59 @@
 #define cmpyx_mr(MS, DS, RT)                                                \
         cmpwx_mr(W(MS), W(DS), W(RT))
 
+/* xad (G = M, M = M + G), atomic fetch-add
+ * set-flags: undefined
+ * xad, xch, cas need natural alignment of memory args
+ * and are sequentially consistent (act as full memory barriers) */
+
+#define xadyx_st(RG, MG, DG)                                                \
+        xadwx_st(W(RG), W(MG), W(DG))
+
+/* xch (G = M, M = G), atomic exchange
+ * set-flags: undefined */
+
+#define xchyx_st(RG, MG, DG)                                                \
+        xchwx_st(W(RG), W(MG), W(DG))
+
+/* cas (if M == Reax then M = S, Reax = M), atomic compare-and-swap
+ * set-flags: undefined
+ * success is checked by comparing Reax to its value before cas */
+
+#define casyx_st(RS, MG, DG)     /* Reax is in/out, RS, MG != Reax */       \
+        caswx_st(W(RS), W(MG), W(DG))
+
+/* cnt (D = number of set bits in S), population count
+ * set-flags: undefined */
+
+#define cntyx_rr(RD, RS)                                                    \
+        cntwx_rr(W(RD), W(RS))
+
+/* clz (D = number of leading zeros in S)
+ * set-flags: undefined
+ * clz, ctz return operand size in bits for zero source */
+
+#define clzyx_rr(RD, RS)                                                    \
+        clzwx_rr(W(RD), W(RS))
+
+/* ctz (D = number of trailing zeros in S)
+ * set-flags: undefined */
+
+#define ctzyx_rr(RD, RS)                                                    \
+        ctzwx_rr(W(RD), W(RS))
+
+/* bsw (D = S with bytes in reversed order), byte swap
+ * set-flags: undefined */
+
+#define bswyx_rr(RD, RS)                                                    \
+        bswwx_rr(W(RD), W(RS))
+
+/* bfx (G = G >> IS & ((1 << IT) - 1)), unsigned bit-field extract
+ * set-flags: undefined
+ * IT > 0, IS + IT <= 32 */
+
+#define bfxyx_ri(RG, IS, IT)                                                \
+        bfxwx_ri(W(RG), W(IS), W(IT))
+
 /******************************************************************************/
 /***************** element-sized instructions for 64-bit mode *****************/
 /******************************************************************************/
@@ -16024,6 +17869,22 @@
 #define mulyp_xm(MS, DS) /* Reax is in/out, prepares Redx for divyn_x* */   \
         mulzp_xm(W(MS), W(DS))/* product must not exceed operands size */
 
+/* mhi (G = G * S >> 64), high half of full 64x64-bit product
+ * set-flags: undefined
+ * low half is given by mulyx_**, both halves at once by muly*_x* */
+
+#define mhiyx_rr(RG, RS)                                                    \
+        mhizx_rr(W(RG), W(RS))
+
+#define mhiyx_ld(RG, MS, DS)                                                \
+        mhizx_ld(W(RG), W(MS), W(DS))
+
+#define mhiyn_rr(RG, RS)                                                    \
+        mhizn_rr(W(RG), W(RS))
+
+#define mhiyn_ld(RG, MS, DS)                                                \
+        mhizn_ld(W(RG), W(MS), W(DS))
+
 /* div (G = G / S)
  * set-flags: undefined */
 
@@ -16195,6 +18056,59 @@
 #define cmpyx_mr(MS, DS, RT)                                                \
         cmpzx_mr(W(MS), W(DS), W(RT))
 
+/* xad (G = M, M = M + G), atomic fetch-add
+ * set-flags: undefined
+ * xad, xch, cas need natural alignment of memory args
+ * and are sequentially consistent (act as full memory barriers) */
+
+#define xadyx_st(RG, MG, DG)                                                \
+        xadzx_st(W(RG), W(MG), W(DG))
+
+/* xch (G = M, M = G), atomic exchange
+ * set-flags: undefined */
+
+#define xchyx_st(RG, MG, DG)                                                \
+        xchzx_st(W(RG), W(MG), W(DG))
+
+/* cas (if M == Reax then M = S, Reax = M), atomic compare-and-swap
+ * set-flags: undefined
+ * success is checked by comparing Reax to its value before cas */
+
+#define casyx_st(RS, MG, DG)     /* Reax is in/out, RS, MG != Reax */       \
+        caszx_st(W(RS), W(MG), W(DG))
+
+/* cnt (D = number of set bits in S), population count
+ * set-flags: undefined */
+
+#define cntyx_rr(RD, RS)                                                    \
+        cntzx_rr(W(RD), W(RS))
+
+/* clz (D = number of leading zeros in S)
+ * set-flags: undefined
+ * clz, ctz return operand size in bits for zero source */
+
+#define clzyx_rr(RD, RS)                                                    \
+        clzzx_rr(W(RD), W(RS))
+
+/* ctz (D = number of trailing zeros in S)
+ * set-flags: undefined */
+
+#define ctzyx_rr(RD, RS)                                                    \
+        ctzzx_rr(W(RD), W(RS))
+
+/* bsw (D = S with bytes in reversed order), byte swap
+ * set-flags: undefined */
+
+#define bswyx_rr(RD, RS)                                                    \
+        bswzx_rr(W(RD), W(RS))
+
+/* bfx (G = G >> IS & ((1 << IT) - 1)), unsigned bit-field extract
+ * set-flags: undefined
+ * IT > 0, IS + IT <= 64 */
+
+#define bfxyx_ri(RG, IS, IT)                                                \
+        bfxzx_ri(W(RG), W(IS), W(IT))
+
 #endif /* RT_ELEMENT */
 
 #endif /* RT_RTCONF_H */
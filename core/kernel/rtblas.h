@@ -0,0 +1,1414 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2023 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTBLAS_H
+#define RT_RTBLAS_H
+
+#include "rtbase.h"
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rtblas.h: BLAS level-1 kernels written in configurable cmdp*, cmdy* subsets.
+ * Table of contents is provided below.
+ *
+ * Kernels are implemented once for all targets and work with rt_real elements
+ * (fp32 or fp64 as chosen by RT_ELEMENT) with unit strides. Each kernel takes
+ * its parameters from rt_SIMD_BLAS backend structure filled in C/C++ code
+ * and is kept in a separate function as recommended for ASM sections.
+ *
+ * Arrays don't need to be SIMD-aligned, scalar head elements are peeled off
+ * until the first array reaches SIMD alignment, then main loop runs with four
+ * independent accumulators (or four registers in flight) to hide latencies,
+ * followed by single SIMD-register loop and scalar tail elements.
+ * Two-array kernels (axpy, dot, kdot) peel off the array which is stored to
+ * (y in axpy) or x with PEEL_HEAD from rtbase.h and read the other one with
+ * muvpx_ld (unaligned load) if it is still not SIMD-aligned at that point,
+ * so that caller buffers are used in place without copies.
+ * Array pointers are expected to be aligned at least to element size.
+ *
+ * Index kernels (iamax, imin, imax and iminn, imaxn for rt_elem arrays)
+ * track best value and its index per lane with running index vectors,
+ * lanes are merged with scalar elements so that ties resolve to the lowest
+ * index regardless of SIMD width.
+ *
+ * Compensated kernels (ksum, kdot) carry a compensation vector next to each
+ * accumulator and add every element with error-free TwoSum (cadps_rr),
+ * products are split with error-free TwoProduct via fmsps (cmaps_ld),
+ * lanes and scalar head/tail elements are folded with scalar counterparts,
+ * compensation is added to the sum only once at the end. The result is
+ * about as accurate as if computed in twice the working precision
+ * and then rounded, unless the sum is ill-conditioned beyond 1/eps^2.
+ * TwoProduct uses fms on targets with native fma, otherwise Dekker's split
+ * (RT_BLAS_SPLIT) with plain mul/sub/add, as fms fallbacks are either slow
+ * (full-precision x87) or not error-free (RT_SIMD_COMPAT_FMS disabled).
+ * Split path spills to kernel structure via Mebp and expects products
+ * well within rt_real range.
+ */
+
+/*----------------------------------------------------------------------------*/
+
+/*************************   SIMD BACKEND STRUCTURE   *************************/
+
+/*************************   BLAS LEVEL-1 KERNELS   ***************************/
+
+/*************************   COMPENSATED KERNELS   ****************************/
+
+/*----------------------------------------------------------------------------*/
+
+/* RT_BLAS_SPLIT selects Dekker's split for error of product in kdot,
+ * default is split on x86 targets without native fma (SSE, AVX1),
+ * where fmsps_** fallback is slow or isn't error-free, and fmsps_** elsewhere */
+#ifndef RT_BLAS_SPLIT
+#if (defined RT_X32 || defined RT_X64) && !(RT_256X1 >= 2 || RT_128X1 == 16)
+#define RT_BLAS_SPLIT       1
+#else /* native fma */
+#define RT_BLAS_SPLIT       0
+#endif /* native fma */
+#endif /* RT_BLAS_SPLIT */
+
+#if   RT_ELEMENT == 32
+#define RT_BLAS_SPLT        4097.0f /* 2^12 + 1, Dekker's split factor */
+#elif RT_ELEMENT == 64
+#define RT_BLAS_SPLT        134217729.0 /* 2^27 + 1, Dekker's split factor */
+#endif /* RT_ELEMENT */
+
+/******************************************************************************/
+/*************************   SIMD BACKEND STRUCTURE   *************************/
+/******************************************************************************/
+
+/*
+ * SIMD BLAS structure for ASM_ENTER/ASM_LEAVE contains kernel parameters
+ * and results, must be initialized with ASM_INIT, then with blas_init.
+ * Note that DP offsets below start where rt_SIMD_INFO ends (at Q*0x100).
+ * SIMD width is taken into account via S and Q from rtbase.h
+ * Structure is read-write in backend.
+ */
+struct rt_SIMD_BLAS : public rt_SIMD_INFO
+{
+    /* kernel parameters (SIMD-fields) */
+
+    rt_real alpha[S];       /* scalar multiplier, set with RT_SIMD_SET */
+#define bls_ALPHA           DP(Q*0x100)
+
+    /* kernel results (1st element) */
+
+    rt_real rval[S];        /* result value (dot, nrm2, asum) */
+#define bls_RVAL            DP(Q*0x110)
+
+    rt_elem ridx[S];        /* result index (iamax, imin, imax), -1 if empty */
+#define bls_RIDX            DP(Q*0x120)
+
+    /* internal constants */
+
+    rt_elem lidx[S];        /* lane indices 0, 1, ..., S-1 */
+#define bls_LIDX            DP(Q*0x130)
+
+    rt_elem lstp[S];        /* lane index step S */
+#define bls_LSTP            DP(Q*0x140)
+
+    rt_real splt[S];        /* Dekker's split factor RT_BLAS_SPLT (kdot) */
+#define bls_SPLT            DP(Q*0x150)
+
+    /* internal variables */
+
+    rt_real rcmp[S];        /* scalar compensation (ksum, kdot) */
+#define bls_RCMP            DP(Q*0x160)
+
+    rt_real lsum[S];        /* lane sums to fold (ksum, kdot) */
+#define bls_LSUM            DP(Q*0x170)
+
+    rt_real lcmp[S];        /* lane compensations to fold (ksum, kdot) */
+#define bls_LCMP            DP(Q*0x180)
+
+    rt_real scr0[S];        /* scratchpad for split path (kdot) */
+#define bls_SCR0            DP(Q*0x190)
+
+    rt_real scr1[S];        /* scratchpad for split path (kdot) */
+#define bls_SCR1            DP(Q*0x1A0)
+
+    rt_real scr2[S];        /* scratchpad for split path (kdot) */
+#define bls_SCR2            DP(Q*0x1B0)
+
+    /* kernel parameters (scalar) */
+
+    rt_real*x;              /* 1st array */
+#define bls_XPTR            DP(Q*0x1C0+0x000*P+E)
+
+    rt_real*y;              /* 2nd array */
+#define bls_YPTR            DP(Q*0x1C0+0x004*P+E)
+
+    rt_elem ibas;           /* internal, index base for iamax */
+#define bls_IBAS            DP(Q*0x1C0+0x008*P)
+
+    rt_si32 size;           /* number of elements in arrays */
+#define bls_SIZE            DP(Q*0x1C0+0x008*P+0x004*L)
+
+    rt_elem ikey;           /* internal, scalar key for imin/imax */
+#define bls_IKEY            DP(Q*0x1C0+0x008*P+0x008*L)
+
+};
+
+/*
+ * Initialize internal constants of the BLAS structure,
+ * call once after ASM_INIT for the same structure.
+ */
+static
+rt_void blas_init(rt_SIMD_BLAS *info)
+{
+    rt_si32 i;
+
+    for (i = 0; i < S; i++)
+    {
+        info->lidx[i] = i;
+        info->lstp[i] = S;
+    }
+
+    RT_SIMD_SET(info->splt, RT_BLAS_SPLT);
+}
+
+/******************************************************************************/
+/*************************   BLAS LEVEL-1 KERNELS   ***************************/
+/******************************************************************************/
+
+/*
+ * Scalar steps of two-array kernels over elements at Mesi (x) and Medi (y)
+ * for PEEL_HEAD (rtbase.h) and tail loops, pointers are advanced outside.
+ */
+
+/* y = alpha * x + y, alpha in Xmm6, destroys Xmm5 */
+#define bls_SAXP()                                                          \
+        movss_ld(Xmm5, Medi, DP(0x00))                                      \
+        fmass_ld(Xmm5, Xmm6, Mesi, DP(0x00))                                \
+        movss_st(Xmm5, Medi, DP(0x00))
+
+/* Xmm7 += x * y, destroys Xmm5 */
+#define bls_SDOT()                                                          \
+        movss_ld(Xmm5, Mesi, DP(0x00))                                      \
+        fmass_ld(Xmm7, Xmm5, Medi, DP(0x00))
+
+/* (Xmm1, Xmm3) += x * y compensated, destroys Xmm5, Xmm6, Xmm7 */
+#define bls_SKDT()                                                          \
+        movss_ld(Xmm5, Mesi, DP(0x00))                                      \
+        cmass_ld(Xmm1, Xmm3, Xmm5, Medi, DP(0x00), Xmm6, Xmm7)
+
+/* axpy (y = alpha * x + y)
+ * reads: alpha, x, y, size */
+
+static
+rt_void blas_axpy(rt_SIMD_BLAS *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, bls_XPTR)
+        movxx_ld(Redi, Mebp, bls_YPTR)
+        movwx_ld(Recx, Mebp, bls_SIZE)
+        movpx_ld(Xmm7, Mebp, bls_ALPHA)
+        movss_ld(Xmm6, Mebp, bls_ALPHA)
+
+        PEEL_HEAD(100500, 100505, 100506, 100504, bls_SAXP, Redi, Resi, Recx)
+        /* axp_head, axp_algn, axp_uqad, axp_done, peel off y (stored) */
+
+    LBL(100501) /* axp_quad */
+
+        cmjwx_ri(Recx, IM(S*4),
+        /* if */ LT_x, 100502f) /* axp_simd */
+
+        movpx_ld(Xmm1, Medi, DP(Q*0x000))
+        movpx_ld(Xmm2, Medi, DP(Q*0x010))
+        movpx_ld(Xmm3, Medi, DP(Q*0x020))
+        movpx_ld(Xmm4, Medi, DP(Q*0x030))
+        fmaps_ld(Xmm1, Xmm7, Mesi, DP(Q*0x000))
+        fmaps_ld(Xmm2, Xmm7, Mesi, DP(Q*0x010))
+        fmaps_ld(Xmm3, Xmm7, Mesi, DP(Q*0x020))
+        fmaps_ld(Xmm4, Xmm7, Mesi, DP(Q*0x030))
+        movpx_st(Xmm1, Medi, DP(Q*0x000))
+        movpx_st(Xmm2, Medi, DP(Q*0x010))
+        movpx_st(Xmm3, Medi, DP(Q*0x020))
+        movpx_st(Xmm4, Medi, DP(Q*0x030))
+
+        addxx_ri(Resi, IM(Q*0x040))
+        addxx_ri(Redi, IM(Q*0x040))
+        subwx_ri(Recx, IM(S*4))
+        jmpxx_lb(100501b) /* axp_quad */
+
+    LBL(100502) /* axp_simd */
+
+        cmjwx_ri(Recx, IB(S),
+        /* if */ LT_x, 100503f) /* axp_tail */
+
+        movpx_ld(Xmm1, Medi, DP(Q*0x000))
+        fmaps_ld(Xmm1, Xmm7, Mesi, DP(Q*0x000))
+        movpx_st(Xmm1, Medi, DP(Q*0x000))
+
+        addxx_ri(Resi, IM(Q*0x010))
+        addxx_ri(Redi, IM(Q*0x010))
+        subwx_ri(Recx, IB(S))
+        jmpxx_lb(100502b) /* axp_simd */
+
+    LBL(100506) /* axp_uqad */
+
+        cmjwx_ri(Recx, IM(S*4),
+        /* if */ LT_x, 100507f) /* axp_usmd */
+
+        muvpx_ld(Xmm5, Mesi, DP(Q*0x000))
+        muvpx_ld(Xmm0, Mesi, DP(Q*0x010))
+        movpx_ld(Xmm1, Medi, DP(Q*0x000))
+        movpx_ld(Xmm2, Medi, DP(Q*0x010))
+        fmaps_rr(Xmm1, Xmm7, Xmm5)
+        fmaps_rr(Xmm2, Xmm7, Xmm0)
+        movpx_st(Xmm1, Medi, DP(Q*0x000))
+        movpx_st(Xmm2, Medi, DP(Q*0x010))
+        muvpx_ld(Xmm5, Mesi, DP(Q*0x020))
+        muvpx_ld(Xmm0, Mesi, DP(Q*0x030))
+        movpx_ld(Xmm3, Medi, DP(Q*0x020))
+        movpx_ld(Xmm4, Medi, DP(Q*0x030))
+        fmaps_rr(Xmm3, Xmm7, Xmm5)
+        fmaps_rr(Xmm4, Xmm7, Xmm0)
+        movpx_st(Xmm3, Medi, DP(Q*0x020))
+        movpx_st(Xmm4, Medi, DP(Q*0x030))
+
+        addxx_ri(Resi, IM(Q*0x040))
+        addxx_ri(Redi, IM(Q*0x040))
+        subwx_ri(Recx, IM(S*4))
+        jmpxx_lb(100506b) /* axp_uqad */
+
+    LBL(100507) /* axp_usmd */
+
+        cmjwx_ri(Recx, IB(S),
+        /* if */ LT_x, 100503f) /* axp_tail */
+
+        muvpx_ld(Xmm5, Mesi, DP(Q*0x000))
+        movpx_ld(Xmm1, Medi, DP(Q*0x000))
+        fmaps_rr(Xmm1, Xmm7, Xmm5)
+        movpx_st(Xmm1, Medi, DP(Q*0x000))
+
+        addxx_ri(Resi, IM(Q*0x010))
+        addxx_ri(Redi, IM(Q*0x010))
+        subwx_ri(Recx, IB(S))
+        jmpxx_lb(100507b) /* axp_usmd */
+
+    LBL(100503) /* axp_tail */
+
+        cmjwx_rz(Recx,
+        /* if */ EQ_x, 100504f) /* axp_done */
+
+        bls_SAXP()
+
+        addxx_ri(Resi, IB(L*4))
+        addxx_ri(Redi, IB(L*4))
+        subwx_ri(Recx, IB(1))
+        jmpxx_lb(100503b) /* axp_tail */
+
+    LBL(100504) /* axp_done */
+
+    ASM_LEAVE(info)
+}
+
+/* dot (rval = x * y)
+ * reads: x, y, size, writes: rval */
+
+static
+rt_void blas_dot(rt_SIMD_BLAS *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, bls_XPTR)
+        movxx_ld(Redi, Mebp, bls_YPTR)
+        movwx_ld(Recx, Mebp, bls_SIZE)
+        movyx_mi(Mebp, bls_RVAL, IC(0))
+        movss_ld(Xmm7, Mebp, bls_RVAL)
+        xorpx_rr(Xmm1, Xmm1)
+        xorpx_rr(Xmm2, Xmm2)
+        xorpx_rr(Xmm3, Xmm3)
+        xorpx_rr(Xmm4, Xmm4)
+
+        PEEL_HEAD(100500, 100505, 100506, 100504, bls_SDOT, Resi, Redi, Recx)
+        /* dot_head, dot_algn, dot_uqad, dot_done, peel off x */
+
+    LBL(100501) /* dot_quad */
+
+        cmjwx_ri(Recx, IM(S*4),
+        /* if */ LT_x, 100502f) /* dot_simd */
+
+        movpx_ld(Xmm5, Mesi, DP(Q*0x000))
+        movpx_ld(Xmm6, Mesi, DP(Q*0x010))
+        fmaps_ld(Xmm1, Xmm5, Medi, DP(Q*0x000))
+        fmaps_ld(Xmm2, Xmm6, Medi, DP(Q*0x010))
+        movpx_ld(Xmm5, Mesi, DP(Q*0x020))
+        movpx_ld(Xmm6, Mesi, DP(Q*0x030))
+        fmaps_ld(Xmm3, Xmm5, Medi, DP(Q*0x020))
+        fmaps_ld(Xmm4, Xmm6, Medi, DP(Q*0x030))
+
+        addxx_ri(Resi, IM(Q*0x040))
+        addxx_ri(Redi, IM(Q*0x040))
+        subwx_ri(Recx, IM(S*4))
+        jmpxx_lb(100501b) /* dot_quad */
+
+    LBL(100502) /* dot_simd */
+
+        cmjwx_ri(Recx, IB(S),
+        /* if */ LT_x, 100503f) /* dot_tail */
+
+        movpx_ld(Xmm5, Mesi, DP(Q*0x000))
+        fmaps_ld(Xmm1, Xmm5, Medi, DP(Q*0x000))
+
+        addxx_ri(Resi, IM(Q*0x010))
+        addxx_ri(Redi, IM(Q*0x010))
+        subwx_ri(Recx, IB(S))
+        jmpxx_lb(100502b) /* dot_simd */
+
+    LBL(100506) /* dot_uqad */
+
+        cmjwx_ri(Recx, IM(S*4),
+        /* if */ LT_x, 100507f) /* dot_usmd */
+
+        movpx_ld(Xmm5, Mesi, DP(Q*0x000))
+        muvpx_ld(Xmm6, Medi, DP(Q*0x000))
+        fmaps_rr(Xmm1, Xmm5, Xmm6)
+        movpx_ld(Xmm5, Mesi, DP(Q*0x010))
+        muvpx_ld(Xmm6, Medi, DP(Q*0x010))
+        fmaps_rr(Xmm2, Xmm5, Xmm6)
+        movpx_ld(Xmm5, Mesi, DP(Q*0x020))
+        muvpx_ld(Xmm6, Medi, DP(Q*0x020))
+        fmaps_rr(Xmm3, Xmm5, Xmm6)
+        movpx_ld(Xmm5, Mesi, DP(Q*0x030))
+        muvpx_ld(Xmm6, Medi, DP(Q*0x030))
+        fmaps_rr(Xmm4, Xmm5, Xmm6)
+
+        addxx_ri(Resi, IM(Q*0x040))
+        addxx_ri(Redi, IM(Q*0x040))
+        subwx_ri(Recx, IM(S*4))
+        jmpxx_lb(100506b) /* dot_uqad */
+
+    LBL(100507) /* dot_usmd */
+
+        cmjwx_ri(Recx, IB(S),
+        /* if */ LT_x, 100503f) /* dot_tail */
+
+        movpx_ld(Xmm5, Mesi, DP(Q*0x000))
+        muvpx_ld(Xmm6, Medi, DP(Q*0x000))
+        fmaps_rr(Xmm1, Xmm5, Xmm6)
+
+        addxx_ri(Resi, IM(Q*0x010))
+        addxx_ri(Redi, IM(Q*0x010))
+        subwx_ri(Recx, IB(S))
+        jmpxx_lb(100507b) /* dot_usmd */
+
+    LBL(100503) /* dot_tail */
+
+        cmjwx_rz(Recx,
+        /* if */ EQ_x, 100504f) /* dot_done */
+
+        bls_SDOT()
+
+        addxx_ri(Resi, IB(L*4))
+        addxx_ri(Redi, IB(L*4))
+        subwx_ri(Recx, IB(1))
+        jmpxx_lb(100503b) /* dot_tail */
+
+    LBL(100504) /* dot_done */
+
+        addps_rr(Xmm1, Xmm2)
+        addps_rr(Xmm3, Xmm4)
+        addps_rr(Xmm1, Xmm3)
+        adhps_rr(Xmm1, Xmm1)
+        elmpx_st(Xmm1, Mebp, bls_RVAL)
+        movss_ld(Xmm1, Mebp, bls_RVAL)
+        addss_rr(Xmm1, Xmm7)
+        movss_st(Xmm1, Mebp, bls_RVAL)
+
+    ASM_LEAVE(info)
+}
+
+/* scal (x = alpha * x)
+ * reads: alpha, x, size */
+
+static
+rt_void blas_scal(rt_SIMD_BLAS *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, bls_XPTR)
+        movwx_ld(Recx, Mebp, bls_SIZE)
+        movpx_ld(Xmm7, Mebp, bls_ALPHA)
+        movss_ld(Xmm6, Mebp, bls_ALPHA)
+
+    LBL(100500) /* scl_head */
+
+        cmjwx_rz(Recx,
+        /* if */ EQ_x, 100504f) /* scl_done */
+        movxx_rr(Reax, Resi)
+        andxx_ri(Reax, IB(Q*16-1))
+        cmjxx_rz(Reax,
+        /* if */ EQ_x, 100501f) /* scl_quad */
+
+        movss_ld(Xmm5, Mesi, DP(0x00))
+        mulss_rr(Xmm5, Xmm6)
+        movss_st(Xmm5, Mesi, DP(0x00))
+
+        addxx_ri(Resi, IB(L*4))
+        subwx_ri(Recx, IB(1))
+        jmpxx_lb(100500b) /* scl_head */
+
+    LBL(100501) /* scl_quad */
+
+        cmjwx_ri(Recx, IM(S*4),
+        /* if */ LT_x, 100502f) /* scl_simd */
+
+        movpx_ld(Xmm1, Mesi, DP(Q*0x000))
+        movpx_ld(Xmm2, Mesi, DP(Q*0x010))
+        movpx_ld(Xmm3, Mesi, DP(Q*0x020))
+        movpx_ld(Xmm4, Mesi, DP(Q*0x030))
+        mulps_rr(Xmm1, Xmm7)
+        mulps_rr(Xmm2, Xmm7)
+        mulps_rr(Xmm3, Xmm7)
+        mulps_rr(Xmm4, Xmm7)
+        movpx_st(Xmm1, Mesi, DP(Q*0x000))
+        movpx_st(Xmm2, Mesi, DP(Q*0x010))
+        movpx_st(Xmm3, Mesi, DP(Q*0x020))
+        movpx_st(Xmm4, Mesi, DP(Q*0x030))
+
+        addxx_ri(Resi, IM(Q*0x040))
+        subwx_ri(Recx, IM(S*4))
+        jmpxx_lb(100501b) /* scl_quad */
+
+    LBL(100502) /* scl_simd */
+
+        cmjwx_ri(Recx, IB(S),
+        /* if */ LT_x, 100503f) /* scl_tail */
+
+        movpx_ld(Xmm1, Mesi, DP(Q*0x000))
+        mulps_rr(Xmm1, Xmm7)
+        movpx_st(Xmm1, Mesi, DP(Q*0x000))
+
+        addxx_ri(Resi, IM(Q*0x010))
+        subwx_ri(Recx, IB(S))
+        jmpxx_lb(100502b) /* scl_simd */
+
+    LBL(100503) /* scl_tail */
+
+        cmjwx_rz(Recx,
+        /* if */ EQ_x, 100504f) /* scl_done */
+
+        movss_ld(Xmm5, Mesi, DP(0x00))
+        mulss_rr(Xmm5, Xmm6)
+        movss_st(Xmm5, Mesi, DP(0x00))
+
+        addxx_ri(Resi, IB(L*4))
+        subwx_ri(Recx, IB(1))
+        jmpxx_lb(100503b) /* scl_tail */
+
+    LBL(100504) /* scl_done */
+
+    ASM_LEAVE(info)
+}
+
+/* nrm2 (rval = sqrt(x * x)), no scaling, may overflow for huge |x|
+ * reads: x, size, writes: rval */
+
+static
+rt_void blas_nrm2(rt_SIMD_BLAS *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, bls_XPTR)
+        movwx_ld(Recx, Mebp, bls_SIZE)
+        movyx_mi(Mebp, bls_RVAL, IC(0))
+        movss_ld(Xmm7, Mebp, bls_RVAL)
+        xorpx_rr(Xmm1, Xmm1)
+        xorpx_rr(Xmm2, Xmm2)
+        xorpx_rr(Xmm3, Xmm3)
+        xorpx_rr(Xmm4, Xmm4)
+
+    LBL(100500) /* nrm_head */
+
+        cmjwx_rz(Recx,
+        /* if */ EQ_x, 100504f) /* nrm_done */
+        movxx_rr(Reax, Resi)
+        andxx_ri(Reax, IB(Q*16-1))
+        cmjxx_rz(Reax,
+        /* if */ EQ_x, 100501f) /* nrm_quad */
+
+        movss_ld(Xmm5, Mesi, DP(0x00))
+        fmass_rr(Xmm7, Xmm5, Xmm5)
+
+        addxx_ri(Resi, IB(L*4))
+        subwx_ri(Recx, IB(1))
+        jmpxx_lb(100500b) /* nrm_head */
+
+    LBL(100501) /* nrm_quad */
+
+        cmjwx_ri(Recx, IM(S*4),
+        /* if */ LT_x, 100502f) /* nrm_simd */
+
+        movpx_ld(Xmm5, Mesi, DP(Q*0x000))
+        movpx_ld(Xmm6, Mesi, DP(Q*0x010))
+        fmaps_rr(Xmm1, Xmm5, Xmm5)
+        fmaps_rr(Xmm2, Xmm6, Xmm6)
+        movpx_ld(Xmm5, Mesi, DP(Q*0x020))
+        movpx_ld(Xmm6, Mesi, DP(Q*0x030))
+        fmaps_rr(Xmm3, Xmm5, Xmm5)
+        fmaps_rr(Xmm4, Xmm6, Xmm6)
+
+        addxx_ri(Resi, IM(Q*0x040))
+        subwx_ri(Recx, IM(S*4))
+        jmpxx_lb(100501b) /* nrm_quad */
+
+    LBL(100502) /* nrm_simd */
+
+        cmjwx_ri(Recx, IB(S),
+        /* if */ LT_x, 100503f) /* nrm_tail */
+
+        movpx_ld(Xmm5, Mesi, DP(Q*0x000))
+        fmaps_rr(Xmm1, Xmm5, Xmm5)
+
+        addxx_ri(Resi, IM(Q*0x010))
+        subwx_ri(Recx, IB(S))
+        jmpxx_lb(100502b) /* nrm_simd */
+
+    LBL(100503) /* nrm_tail */
+
+        cmjwx_rz(Recx,
+        /* if */ EQ_x, 100504f) /* nrm_done */
+
+        movss_ld(Xmm5, Mesi, DP(0x00))
+        fmass_rr(Xmm7, Xmm5, Xmm5)
+
+        addxx_ri(Resi, IB(L*4))
+        subwx_ri(Recx, IB(1))
+        jmpxx_lb(100503b) /* nrm_tail */
+
+    LBL(100504) /* nrm_done */
+
+        addps_rr(Xmm1, Xmm2)
+        addps_rr(Xmm3, Xmm4)
+        addps_rr(Xmm1, Xmm3)
+        adhps_rr(Xmm1, Xmm1)
+        elmpx_st(Xmm1, Mebp, bls_RVAL)
+        movss_ld(Xmm1, Mebp, bls_RVAL)
+        addss_rr(Xmm1, Xmm7)
+        sqrss_rr(Xmm1, Xmm1)
+        movss_st(Xmm1, Mebp, bls_RVAL)
+
+    ASM_LEAVE(info)
+}
+
+/* asum (rval = sum |x|)
+ * reads: x, size, writes: rval */
+
+static
+rt_void blas_asum(rt_SIMD_BLAS *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, bls_XPTR)
+        movwx_ld(Recx, Mebp, bls_SIZE)
+        movyx_mi(Mebp, bls_RVAL, IC(0))
+        movss_ld(Xmm7, Mebp, bls_RVAL)
+        movpx_ld(Xmm6, Mebp, inf_GPC04)
+        xorpx_rr(Xmm1, Xmm1)
+        xorpx_rr(Xmm2, Xmm2)
+        xorpx_rr(Xmm3, Xmm3)
+        xorpx_rr(Xmm4, Xmm4)
+
+    LBL(100500) /* asm_head */
+
+        cmjwx_rz(Recx,
+        /* if */ EQ_x, 100504f) /* asm_done */
+        movxx_rr(Reax, Resi)
+        andxx_ri(Reax, IB(Q*16-1))
+        cmjxx_rz(Reax,
+        /* if */ EQ_x, 100501f) /* asm_quad */
+
+        movyx_ld(Reax, Mesi, DP(0x00))
+        andyx_ld(Reax, Mebp, inf_GPC04)
+        movyx_st(Reax, Mebp, inf_SCR01(0))
+        addss_ld(Xmm7, Mebp, inf_SCR01(0))
+
+        addxx_ri(Resi, IB(L*4))
+        subwx_ri(Recx, IB(1))
+        jmpxx_lb(100500b) /* asm_head */
+
+    LBL(100501) /* asm_quad */
+
+        cmjwx_ri(Recx, IM(S*4),
+        /* if */ LT_x, 100502f) /* asm_simd */
+
+        movpx_ld(Xmm5, Mesi, DP(Q*0x000))
+        andpx_rr(Xmm5, Xmm6)
+        addps_rr(Xmm1, Xmm5)
+        movpx_ld(Xmm5, Mesi, DP(Q*0x010))
+        andpx_rr(Xmm5, Xmm6)
+        addps_rr(Xmm2, Xmm5)
+        movpx_ld(Xmm5, Mesi, DP(Q*0x020))
+        andpx_rr(Xmm5, Xmm6)
+        addps_rr(Xmm3, Xmm5)
+        movpx_ld(Xmm5, Mesi, DP(Q*0x030))
+        andpx_rr(Xmm5, Xmm6)
+        addps_rr(Xmm4, Xmm5)
+
+        addxx_ri(Resi, IM(Q*0x040))
+        subwx_ri(Recx, IM(S*4))
+        jmpxx_lb(100501b) /* asm_quad */
+
+    LBL(100502) /* asm_simd */
+
+        cmjwx_ri(Recx, IB(S),
+        /* if */ LT_x, 100503f) /* asm_tail */
+
+        movpx_ld(Xmm5, Mesi, DP(Q*0x000))
+        andpx_rr(Xmm5, Xmm6)
+        addps_rr(Xmm1, Xmm5)
+
+        addxx_ri(Resi, IM(Q*0x010))
+        subwx_ri(Recx, IB(S))
+        jmpxx_lb(100502b) /* asm_simd */
+
+    LBL(100503) /* asm_tail */
+
+        cmjwx_rz(Recx,
+        /* if */ EQ_x, 100504f) /* asm_done */
+
+        movyx_ld(Reax, Mesi, DP(0x00))
+        andyx_ld(Reax, Mebp, inf_GPC04)
+        movyx_st(Reax, Mebp, inf_SCR01(0))
+        addss_ld(Xmm7, Mebp, inf_SCR01(0))
+
+        addxx_ri(Resi, IB(L*4))
+        subwx_ri(Recx, IB(1))
+        jmpxx_lb(100503b) /* asm_tail */
+
+    LBL(100504) /* asm_done */
+
+        addps_rr(Xmm1, Xmm2)
+        addps_rr(Xmm3, Xmm4)
+        addps_rr(Xmm1, Xmm3)
+        adhps_rr(Xmm1, Xmm1)
+        elmpx_st(Xmm1, Mebp, bls_RVAL)
+        movss_ld(Xmm1, Mebp, bls_RVAL)
+        addss_rr(Xmm1, Xmm7)
+        movss_st(Xmm1, Mebp, bls_RVAL)
+
+    ASM_LEAVE(info)
+}
+
+/* iamax (ridx = index of the first max |x|), 0-based, -1 if size is 0
+ * magnitudes are compared as integers with sign-bit cleared (NaNs are max)
+ * reads: x, size, writes: ridx */
+
+static
+rt_void blas_iamax(rt_SIMD_BLAS *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, bls_XPTR)
+        movwx_ld(Recx, Mebp, bls_SIZE)
+        movyx_ri(Redx, IC(0))
+        notyx_rx(Redx)
+        movyx_ri(Rebx, IC(0))
+        notyx_rx(Rebx)
+        movyx_ri(Redi, IC(0))
+
+    LBL(100500) /* iam_head */
+
+        cmjwx_rz(Recx,
+        /* if */ EQ_x, 100507f) /* iam_done */
+        movxx_rr(Reax, Resi)
+        andxx_ri(Reax, IB(Q*16-1))
+        cmjxx_rz(Reax,
+        /* if */ EQ_x, 100502f) /* iam_simd */
+
+        movyx_ld(Reax, Mesi, DP(0x00))
+        andyx_ld(Reax, Mebp, inf_GPC04)
+        cmjyx_rr(Reax, Redx,
+        /* if */ LE_n, 100501f) /* iam_hnxt */
+        movyx_rr(Redx, Reax)
+        movyx_rr(Rebx, Redi)
+
+    LBL(100501) /* iam_hnxt */
+
+        addxx_ri(Resi, IB(L*4))
+        addyx_ri(Redi, IB(1))
+        subwx_ri(Recx, IB(1))
+        jmpxx_lb(100500b) /* iam_head */
+
+    LBL(100502) /* iam_simd */
+
+        cmjwx_ri(Recx, IB(S),
+        /* if */ LT_x, 100505f) /* iam_tail */
+
+        movyx_st(Redi, Mebp, bls_IBAS)
+        ceqpx_rr(Xmm1, Xmm1)
+        xorpx_rr(Xmm2, Xmm2)
+        movpx_ld(Xmm3, Mebp, bls_LIDX)
+        movpx_ld(Xmm4, Mebp, bls_LSTP)
+
+    LBL(100503) /* iam_loop */
+
+        movpx_ld(Xmm5, Mesi, DP(Q*0x000))
+        andpx_ld(Xmm5, Mebp, inf_GPC04)
+        movpx_rr(Xmm0, Xmm5)
+        cgtpn_rr(Xmm0, Xmm1)
+        movpx_rr(Xmm6, Xmm0)
+        mmvpx_rr(Xmm1, Xmm5)
+        movpx_rr(Xmm0, Xmm6)
+        movpx_rr(Xmm5, Xmm3)
+        mmvpx_rr(Xmm2, Xmm5)
+        addpx_rr(Xmm3, Xmm4)
+
+        addxx_ri(Resi, IM(Q*0x010))
+        addyx_ri(Redi, IB(S))
+        subwx_ri(Recx, IB(S))
+        cmjwx_ri(Recx, IB(S),
+        /* if */ GE_x, 100503b) /* iam_loop */
+
+        /* merge lanes with head, ties resolve to lower index */
+        movpx_st(Xmm1, Mebp, bls_RVAL)
+        movpx_st(Xmm2, Mebp, bls_RIDX)
+        subyx_ld(Rebx, Mebp, bls_IBAS)
+        movxx_ri(Reax, IC(0))
+
+    LBL(100504) /* iam_lane */
+
+        cmjyx_rm(Redx, Iebp, bls_RVAL,
+        /* if */ GT_n, 100514f) /* iam_lnxt */
+        cmjyx_rm(Redx, Iebp, bls_RVAL,
+        /* if */ LT_n, 100524f) /* iam_take */
+        cmjyx_rm(Rebx, Iebp, bls_RIDX,
+        /* if */ LE_n, 100514f) /* iam_lnxt */
+
+    LBL(100524) /* iam_take */
+
+        movyx_ld(Redx, Iebp, bls_RVAL)
+        movyx_ld(Rebx, Iebp, bls_RIDX)
+
+    LBL(100514) /* iam_lnxt */
+
+        addxx_ri(Reax, IB(L*4))
+        cmjxx_ri(Reax, IM(S*L*4),
+        /* if */ LT_x, 100504b) /* iam_lane */
+
+        addyx_ld(Rebx, Mebp, bls_IBAS)
+
+    LBL(100505) /* iam_tail */
+
+        cmjwx_rz(Recx,
+        /* if */ EQ_x, 100507f) /* iam_done */
+
+        movyx_ld(Reax, Mesi, DP(0x00))
+        andyx_ld(Reax, Mebp, inf_GPC04)
+        cmjyx_rr(Reax, Redx,
+        /* if */ LE_n, 100506f) /* iam_tnxt */
+        movyx_rr(Redx, Reax)
+        movyx_rr(Rebx, Redi)
+
+    LBL(100506) /* iam_tnxt */
+
+        addxx_ri(Resi, IB(L*4))
+        addyx_ri(Redi, IB(1))
+        subwx_ri(Recx, IB(1))
+        jmpxx_lb(100505b) /* iam_tail */
+
+    LBL(100507) /* iam_done */
+
+        movyx_st(Rebx, Mebp, bls_RIDX)
+
+    ASM_LEAVE(info)
+}
+
+/*
+ * Argmin/argmax kernels compare elements as signed integers, rt_real values
+ * are first mapped to ordered integer keys (magnitude bits are flipped for
+ * negative values), then negative keys are incremented, so that key order
+ * follows fp order with -0.0 and +0.0 as equal keys (both map to 0),
+ * NaNs order above +inf (or below -inf if negative).
+ * Each SIMD lane keeps its best key and index (running index vector), lanes
+ * are merged at the end with scalar head, then scalar tail follows.
+ * Ties resolve to the lowest index, result is -1 only if size is 0.
+ */
+
+/* map rt_real values in XV to ordered integer keys, destroys XT */
+#define bls_KEYP(XV, XT)                                                    \
+        movpx_rr(W(XT), W(XV))                                              \
+        shrpn_ri(W(XT), IB(L*32-1))                                         \
+        shrpx_ri(W(XT), IB(1))                                              \
+        xorpx_rr(W(XV), W(XT))                                              \
+        shrpx_ri(W(XT), IB(L*32-2))                                         \
+        addpx_rr(W(XV), W(XT))
+
+/* map rt_real value in RV to ordered integer key, uses IKEY */
+#define bls_KEYY(RV)                                                        \
+        movyx_st(W(RV), Mebp, bls_IKEY)                                     \
+        shryn_ri(W(RV), IB(L*32-1))                                         \
+        shryx_ri(W(RV), IB(1))                                              \
+        xoryx_ld(W(RV), Mebp, bls_IKEY)                                     \
+        movyx_st(W(RV), Mebp, bls_IKEY)                                     \
+        shryx_ri(W(RV), IB(L*32-1))                                         \
+        addyx_ld(W(RV), Mebp, bls_IKEY)
+
+/* keep signed integer elements as keys */
+#define bls_KEYN(XV, XT)
+
+#define bls_KEYM(RV)
+
+/*
+ * Scalar step of argmin/argmax over element at Mesi with index Redi,
+ * jt is the condition under which its key wins over Redx (LT_n for argmin).
+ */
+#define bls_SARG(keyy, jt, ln, lt)                                          \
+        movyx_ld(Reax, Mesi, DP(0x00))                                      \
+        keyy(Reax)                                                          \
+        cmjyx_rr(Reax, Redx,                                                \
+        /* if */ jt, lt##f)                                                 \
+        cmjyx_rr(Reax, Redx,                                                \
+        /* if */ NE_x, ln##f)                                               \
+        cmjyx_rr(Redi, Rebx,                                                \
+        /* if */ GE_n, ln##f)                                               \
+    LBL(lt)                                                                 \
+        movyx_rr(Redx, Reax)                                                \
+        movyx_rr(Rebx, Redi)                                                \
+    LBL(ln)                                                                 \
+        addxx_ri(Resi, IB(L*4))                                             \
+        addyx_ri(Redi, IB(1))                                               \
+        subwx_ri(Recx, IB(1))
+
+/*
+ * Argmin/argmax kernel body, keyp/keyy map elements to keys,
+ * cmp is the SIMD compare for a new lane key to win (cltpn for argmin),
+ * arg merges lanes with head result (amnpn for argmin, in rtconf.h),
+ * key0 selects initial scalar key inf_GPC##key0 (no element can be worse),
+ * index of no element (GPC04, max positive) is replaced with -1 at the end.
+ */
+#define bls_IARG(keyp, keyy, cmp, jt, arg, key0)                            \
+        movxx_ld(Resi, Mebp, bls_XPTR)                                      \
+        movwx_ld(Recx, Mebp, bls_SIZE)                                      \
+        movyx_ld(Redx, Mebp, inf_GPC##key0)                                 \
+        movyx_ld(Rebx, Mebp, inf_GPC04)                                     \
+        movyx_ri(Redi, IC(0))                                               \
+    LBL(100500) /* arg_head */                                              \
+        cmjwx_rz(Recx,                                                      \
+        /* if */ EQ_x, 100507f) /* arg_done */                              \
+        movxx_rr(Reax, Resi)                                                \
+        andxx_ri(Reax, IB(Q*16-1))                                          \
+        cmjxx_rz(Reax,                                                      \
+        /* if */ EQ_x, 100502f) /* arg_simd */                              \
+        bls_SARG(keyy, jt, 100501, 100511) /* arg_hnxt, arg_htak */         \
+        jmpxx_lb(100500b) /* arg_head */                                    \
+    LBL(100502) /* arg_simd */                                              \
+        cmjwx_ri(Recx, IB(S),                                               \
+        /* if */ LT_x, 100505f) /* arg_tail */                              \
+        movyx_st(Redi, Mebp, bls_IBAS)                                      \
+        movpx_ld(Xmm1, Mesi, DP(Q*0x000))                                   \
+        keyp(Xmm1, Xmm7)                                                    \
+        movpx_ld(Xmm2, Mebp, bls_LIDX)                                      \
+        movpx_ld(Xmm4, Mebp, bls_LSTP)                                      \
+        movpx_rr(Xmm3, Xmm2)                                                \
+        addpx_rr(Xmm3, Xmm4)                                                \
+        addxx_ri(Resi, IM(Q*0x010))                                         \
+        addyx_ri(Redi, IB(S))                                               \
+        subwx_ri(Recx, IB(S))                                               \
+    LBL(100503) /* arg_loop */                                              \
+        cmjwx_ri(Recx, IB(S),                                               \
+        /* if */ LT_x, 100504f) /* arg_lane */                              \
+        movpx_ld(Xmm5, Mesi, DP(Q*0x000))                                   \
+        keyp(Xmm5, Xmm7)                                                    \
+        movpx_rr(Xmm0, Xmm5)                                                \
+        cmp##_rr(Xmm0, Xmm1)                                                \
+        movpx_rr(Xmm6, Xmm0)                                                \
+        mmvpx_rr(Xmm1, Xmm5)                                                \
+        movpx_rr(Xmm0, Xmm6)                                                \
+        movpx_rr(Xmm5, Xmm3)                                                \
+        mmvpx_rr(Xmm2, Xmm5)                                                \
+        addpx_rr(Xmm3, Xmm4)                                                \
+        addxx_ri(Resi, IM(Q*0x010))                                         \
+        addyx_ri(Redi, IB(S))                                               \
+        subwx_ri(Recx, IB(S))                                               \
+        jmpxx_lb(100503b) /* arg_loop */                                    \
+    LBL(100504) /* arg_lane */                                              \
+        subyx_ld(Rebx, Mebp, bls_IBAS)                                      \
+        arg##_rx(Xmm1, Xmm2, 100514, 100524, 100534)                        \
+        addyx_ld(Rebx, Mebp, bls_IBAS)                                      \
+    LBL(100505) /* arg_tail */                                              \
+        cmjwx_rz(Recx,                                                      \
+        /* if */ EQ_x, 100507f) /* arg_done */                              \
+        bls_SARG(keyy, jt, 100506, 100516) /* arg_tnxt, arg_ttak */         \
+        jmpxx_lb(100505b) /* arg_tail */                                    \
+    LBL(100507) /* arg_done */                                              \
+        cmjyx_rm(Rebx, Mebp, inf_GPC04,                                     \
+        /* if */ NE_x, 100508f) /* arg_save */                              \
+        movyx_ri(Rebx, IC(0))                                               \
+        notyx_rx(Rebx)                                                      \
+    LBL(100508) /* arg_save */                                              \
+        movyx_st(Rebx, Mebp, bls_RIDX)
+
+/* imin (ridx = index of the first min x), 0-based, -1 if size is 0
+ * reads: x, size, writes: ridx */
+
+static
+rt_void blas_imin(rt_SIMD_BLAS *info)
+{
+    ASM_ENTER(info)
+
+        bls_IARG(bls_KEYP, bls_KEYY, cltpn, LT_n, amnpn, 04)
+
+    ASM_LEAVE(info)
+}
+
+/* imax (ridx = index of the first max x), 0-based, -1 if size is 0
+ * reads: x, size, writes: ridx */
+
+static
+rt_void blas_imax(rt_SIMD_BLAS *info)
+{
+    ASM_ENTER(info)
+
+        bls_IARG(bls_KEYP, bls_KEYY, cgtpn, GT_n, amxpn, 06)
+
+    ASM_LEAVE(info)
+}
+
+/* iminn (ridx = index of the first min x), x is rt_elem (signed) array,
+ * 0-based, -1 if size is 0
+ * reads: x, size, writes: ridx */
+
+static
+rt_void blas_iminn(rt_SIMD_BLAS *info)
+{
+    ASM_ENTER(info)
+
+        bls_IARG(bls_KEYN, bls_KEYM, cltpn, LT_n, amnpn, 04)
+
+    ASM_LEAVE(info)
+}
+
+/* imaxn (ridx = index of the first max x), x is rt_elem (signed) array,
+ * 0-based, -1 if size is 0
+ * reads: x, size, writes: ridx */
+
+static
+rt_void blas_imaxn(rt_SIMD_BLAS *info)
+{
+    ASM_ENTER(info)
+
+        bls_IARG(bls_KEYN, bls_KEYM, cgtpn, GT_n, amxpn, 06)
+
+    ASM_LEAVE(info)
+}
+
+#undef bls_KEYP
+#undef bls_KEYY
+#undef bls_KEYN
+#undef bls_KEYM
+#undef bls_SARG
+#undef bls_IARG
+
+/******************************************************************************/
+/*************************   COMPENSATED KERNELS   ****************************/
+/******************************************************************************/
+
+/*
+ * Compensated add (TwoSum): XS + XV is split into new sum XS and its exact
+ * rounding error accumulated into XC, bp - s' is the negated s' - bp
+ * (exact under round-to-nearest), which saves a temporary register.
+ * Destroys XV, X1, X2 (temp regs), all registers must be distinct.
+ */
+#define cadps_rr(XS, XC, XV, X1, X2) /* destroys XV, X1, X2 */              \
+        movpx_rr(W(X1), W(XS))                                              \
+        addps_rr(W(XS), W(XV))                                              \
+        subps3rr(W(X2), W(XS), W(X1))                                       \
+        subps_rr(W(XV), W(X2))                                              \
+        subps_rr(W(X2), W(XS))                                              \
+        addps_rr(W(X1), W(X2))                                              \
+        addps_rr(W(XV), W(X1))                                              \
+        addps_rr(W(XC), W(XV))
+
+#define cadss_rr(XS, XC, XV, X1, X2) /* destroys XV, X1, X2 */              \
+        movss_rr(W(X1), W(XS))                                              \
+        addss_rr(W(XS), W(XV))                                              \
+        subss3rr(W(X2), W(XS), W(X1))                                       \
+        subss_rr(W(XV), W(X2))                                              \
+        subss_rr(W(X2), W(XS))                                              \
+        addss_rr(W(X1), W(X2))                                              \
+        addss_rr(W(XV), W(X1))                                              \
+        addss_rr(W(XC), W(XV))
+
+/*
+ * Compensated multiply-add (TwoProduct + TwoSum): XV * [MT + DT] is split
+ * into product and its rounding error, product is then added
+ * to XS with cadps_rr, both errors are accumulated into XC.
+ * Destroys XV, X1, X2 (temp regs), all registers must be distinct,
+ * cmaps_rr takes the 2nd factor in XT (destroyed) instead of memory.
+ */
+
+#if RT_BLAS_SPLIT == 0
+
+/* product error via fms */
+
+#define cmaps_ld(XS, XC, XV, MT, DT, X1, X2) /* destroys XV, X1, X2 */      \
+        movpx_rr(W(X1), W(XV))                                              \
+        mulps_ld(W(XV), W(MT), W(DT))                                       \
+        movpx_rr(W(X2), W(XV))                                              \
+        fmsps_ld(W(X2), W(X1), W(MT), W(DT))                                \
+        subps_rr(W(XC), W(X2))                                              \
+        cadps_rr(W(XS), W(XC), W(XV), W(X1), W(X2))
+
+#define cmaps_rr(XS, XC, XV, XT, X1, X2) /* destroys XV, XT, X1, X2 */      \
+        movpx_rr(W(X1), W(XV))                                              \
+        mulps_rr(W(XV), W(XT))                                              \
+        movpx_rr(W(X2), W(XV))                                              \
+        fmsps_rr(W(X2), W(X1), W(XT))                                       \
+        subps_rr(W(XC), W(X2))                                              \
+        cadps_rr(W(XS), W(XC), W(XV), W(X1), W(X2))
+
+#define cmass_ld(XS, XC, XV, MT, DT, X1, X2) /* destroys XV, X1, X2 */      \
+        movss_rr(W(X1), W(XV))                                              \
+        mulss_ld(W(XV), W(MT), W(DT))                                       \
+        movss_rr(W(X2), W(XV))                                              \
+        fmsss_ld(W(X2), W(X1), W(MT), W(DT))                                \
+        subss_rr(W(XC), W(X2))                                              \
+        cadss_rr(W(XS), W(XC), W(XV), W(X1), W(X2))
+
+#else  /* RT_BLAS_SPLIT == 1 */
+
+/* product error via Dekker's split of XV = ah + al and [MT + DT] = bh + bl
+ * into half-width parts with exact products, the error is accumulated as
+ * ((ah * bh - p) + ah * bl + al * bh) + al * bl, where p = XV * [MT + DT]
+ * rounded, uses bls_SPLT, bls_SCR0, bls_SCR1, bls_SCR2 */
+
+#define cmaps_ld(XS, XC, XV, MT, DT, X1, X2) /* destroys XV, X1, X2 */      \
+        movpx_rr(W(X1), W(XV))                                              \
+        mulps_ld(W(X1), W(MT), W(DT))                                       \
+        movpx_st(W(X1), Mebp, bls_SCR0)                                     \
+        movpx_ld(W(X1), Mebp, bls_SPLT)                                     \
+        mulps_rr(W(X1), W(XV))                                              \
+        movpx_rr(W(X2), W(X1))                                              \
+        subps_rr(W(X2), W(XV))                                              \
+        subps_rr(W(X1), W(X2))                                              \
+        subps_rr(W(XV), W(X1))                                              \
+        movpx_st(W(XV), Mebp, bls_SCR1)                                     \
+        movpx_ld(W(XV), Mebp, bls_SPLT)                                     \
+        mulps_ld(W(XV), W(MT), W(DT))                                       \
+        movpx_rr(W(X2), W(XV))                                              \
+        subps_ld(W(X2), W(MT), W(DT))                                       \
+        subps_rr(W(XV), W(X2))                                              \
+        movpx_ld(W(X2), W(MT), W(DT))                                       \
+        subps_rr(W(X2), W(XV))                                              \
+        movpx_st(W(X2), Mebp, bls_SCR2)                                     \
+        movpx_rr(W(X2), W(X1))                                              \
+        mulps_rr(W(X2), W(XV))                                              \
+        subps_ld(W(X2), Mebp, bls_SCR0)                                     \
+        mulps_ld(W(X1), Mebp, bls_SCR2)                                     \
+        addps_rr(W(X2), W(X1))                                              \
+        mulps_ld(W(XV), Mebp, bls_SCR1)                                     \
+        addps_rr(W(X2), W(XV))                                              \
+        movpx_ld(W(X1), Mebp, bls_SCR1)                                     \
+        mulps_ld(W(X1), Mebp, bls_SCR2)                                     \
+        addps_rr(W(X2), W(X1))                                              \
+        addps_rr(W(XC), W(X2))                                              \
+        movpx_ld(W(XV), Mebp, bls_SCR0)                                     \
+        cadps_rr(W(XS), W(XC), W(XV), W(X1), W(X2))
+
+#define cmaps_rr(XS, XC, XV, XT, X1, X2) /* destroys XV, XT, X1, X2 */      \
+        movpx_rr(W(X1), W(XV))                                              \
+        mulps_rr(W(X1), W(XT))                                              \
+        movpx_st(W(X1), Mebp, bls_SCR0)                                     \
+        movpx_ld(W(X1), Mebp, bls_SPLT)                                     \
+        mulps_rr(W(X1), W(XV))                                              \
+        movpx_rr(W(X2), W(X1))                                              \
+        subps_rr(W(X2), W(XV))                                              \
+        subps_rr(W(X1), W(X2))                                              \
+        subps_rr(W(XV), W(X1))                                              \
+        movpx_st(W(XV), Mebp, bls_SCR1)                                     \
+        movpx_ld(W(XV), Mebp, bls_SPLT)                                     \
+        mulps_rr(W(XV), W(XT))                                              \
+        movpx_rr(W(X2), W(XV))                                              \
+        subps_rr(W(X2), W(XT))                                              \
+        subps_rr(W(XV), W(X2))                                              \
+        subps_rr(W(XT), W(XV))                                              \
+        movpx_rr(W(X2), W(X1))                                              \
+        mulps_rr(W(X2), W(XV))                                              \
+        subps_ld(W(X2), Mebp, bls_SCR0)                                     \
+        mulps_rr(W(X1), W(XT))                                              \
+        addps_rr(W(X2), W(X1))                                              \
+        mulps_ld(W(XV), Mebp, bls_SCR1)                                     \
+        addps_rr(W(X2), W(XV))                                              \
+        mulps_ld(W(XT), Mebp, bls_SCR1)                                     \
+        addps_rr(W(X2), W(XT))                                              \
+        addps_rr(W(XC), W(X2))                                              \
+        movpx_ld(W(XV), Mebp, bls_SCR0)                                     \
+        cadps_rr(W(XS), W(XC), W(XV), W(X1), W(X2))
+
+#define cmass_ld(XS, XC, XV, MT, DT, X1, X2) /* destroys XV, X1, X2 */      \
+        movss_rr(W(X1), W(XV))                                              \
+        mulss_ld(W(X1), W(MT), W(DT))                                       \
+        movss_st(W(X1), Mebp, bls_SCR0)                                     \
+        movss_ld(W(X1), Mebp, bls_SPLT)                                     \
+        mulss_rr(W(X1), W(XV))                                              \
+        movss_rr(W(X2), W(X1))                                              \
+        subss_rr(W(X2), W(XV))                                              \
+        subss_rr(W(X1), W(X2))                                              \
+        subss_rr(W(XV), W(X1))                                              \
+        movss_st(W(XV), Mebp, bls_SCR1)                                     \
+        movss_ld(W(XV), Mebp, bls_SPLT)                                     \
+        mulss_ld(W(XV), W(MT), W(DT))                                       \
+        movss_rr(W(X2), W(XV))                                              \
+        subss_ld(W(X2), W(MT), W(DT))                                       \
+        subss_rr(W(XV), W(X2))                                              \
+        movss_ld(W(X2), W(MT), W(DT))                                       \
+        subss_rr(W(X2), W(XV))                                              \
+        movss_st(W(X2), Mebp, bls_SCR2)                                     \
+        movss_rr(W(X2), W(X1))                                              \
+        mulss_rr(W(X2), W(XV))                                              \
+        subss_ld(W(X2), Mebp, bls_SCR0)                                     \
+        mulss_ld(W(X1), Mebp, bls_SCR2)                                     \
+        addss_rr(W(X2), W(X1))                                              \
+        mulss_ld(W(XV), Mebp, bls_SCR1)                                     \
+        addss_rr(W(X2), W(XV))                                              \
+        movss_ld(W(X1), Mebp, bls_SCR1)                                     \
+        mulss_ld(W(X1), Mebp, bls_SCR2)                                     \
+        addss_rr(W(X2), W(X1))                                              \
+        addss_rr(W(XC), W(X2))                                              \
+        movss_ld(W(XV), Mebp, bls_SCR0)                                     \
+        cadss_rr(W(XS), W(XC), W(XV), W(X1), W(X2))
+
+#endif /* RT_BLAS_SPLIT */
+
+/*
+ * Fold two SIMD accumulator pairs (Xmm1, Xmm3), (Xmm2, Xmm4) and their lanes
+ * into scalar sum Xmm1 and compensation Xmm3 continuing from RVAL, RCMP,
+ * uses Xmm5-Xmm7, Rebx, Redx as temporaries.
+ */
+#define bls_FOLD(lb)                                                        \
+        cadps_rr(Xmm1, Xmm3, Xmm2, Xmm6, Xmm7)                              \
+        addps_rr(Xmm3, Xmm4)                                                \
+        movpx_st(Xmm1, Mebp, bls_LSUM)                                      \
+        movpx_st(Xmm3, Mebp, bls_LCMP)                                      \
+        movss_ld(Xmm1, Mebp, bls_RVAL)                                      \
+        movss_ld(Xmm3, Mebp, bls_RCMP)                                      \
+        adrxx_ld(Rebx, Mebp, bls_LSUM)                                      \
+        movwx_ri(Redx, IB(S))                                               \
+    LBL(lb)                                                                 \
+        movss_ld(Xmm5, Mebx, DP(0x00))                                      \
+        cadss_rr(Xmm1, Xmm3, Xmm5, Xmm6, Xmm7)                              \
+        addss_ld(Xmm3, Mebx, DP(Q*0x010))                                   \
+        addxx_ri(Rebx, IB(L*4))                                             \
+        arjwx_ri(Redx, IB(1),                                               \
+        sub_x, NZ_x, lb##b)
+
+/* ksum (rval = sum x, compensated)
+ * reads: x, size, writes: rval */
+
+static
+rt_void blas_ksum(rt_SIMD_BLAS *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, bls_XPTR)
+        movwx_ld(Recx, Mebp, bls_SIZE)
+        movyx_mi(Mebp, bls_RVAL, IC(0))
+        movss_ld(Xmm1, Mebp, bls_RVAL)
+        movss_ld(Xmm3, Mebp, bls_RVAL)
+
+    LBL(100500) /* ksm_head */
+
+        cmjwx_rz(Recx,
+        /* if */ EQ_x, 100505f) /* ksm_done */
+        movxx_rr(Reax, Resi)
+        andxx_ri(Reax, IB(Q*16-1))
+        cmjxx_rz(Reax,
+        /* if */ EQ_x, 100501f) /* ksm_body */
+
+        movss_ld(Xmm5, Mesi, DP(0x00))
+        cadss_rr(Xmm1, Xmm3, Xmm5, Xmm6, Xmm7)
+
+        addxx_ri(Resi, IB(L*4))
+        subwx_ri(Recx, IB(1))
+        jmpxx_lb(100500b) /* ksm_head */
+
+    LBL(100501) /* ksm_body */
+
+        movss_st(Xmm1, Mebp, bls_RVAL)
+        movss_st(Xmm3, Mebp, bls_RCMP)
+        xorpx_rr(Xmm1, Xmm1)
+        xorpx_rr(Xmm2, Xmm2)
+        xorpx_rr(Xmm3, Xmm3)
+        xorpx_rr(Xmm4, Xmm4)
+
+    LBL(100502) /* ksm_pair */
+
+        cmjwx_ri(Recx, IM(S*2),
+        /* if */ LT_x, 100503f) /* ksm_simd */
+
+        movpx_ld(Xmm5, Mesi, DP(Q*0x000))
+        movpx_ld(Xmm0, Mesi, DP(Q*0x010))
+        cadps_rr(Xmm1, Xmm3, Xmm5, Xmm6, Xmm7)
+        cadps_rr(Xmm2, Xmm4, Xmm0, Xmm6, Xmm7)
+
+        addxx_ri(Resi, IM(Q*0x020))
+        subwx_ri(Recx, IM(S*2))
+        jmpxx_lb(100502b) /* ksm_pair */
+
+    LBL(100503) /* ksm_simd */
+
+        cmjwx_ri(Recx, IB(S),
+        /* if */ LT_x, 100513f) /* ksm_fold */
+
+        movpx_ld(Xmm5, Mesi, DP(Q*0x000))
+        cadps_rr(Xmm1, Xmm3, Xmm5, Xmm6, Xmm7)
+
+        addxx_ri(Resi, IM(Q*0x010))
+        subwx_ri(Recx, IB(S))
+
+    LBL(100513) /* ksm_fold */
+
+        bls_FOLD(100523) /* ksm_lane */
+
+    LBL(100504) /* ksm_tail */
+
+        cmjwx_rz(Recx,
+        /* if */ EQ_x, 100505f) /* ksm_done */
+
+        movss_ld(Xmm5, Mesi, DP(0x00))
+        cadss_rr(Xmm1, Xmm3, Xmm5, Xmm6, Xmm7)
+
+        addxx_ri(Resi, IB(L*4))
+        subwx_ri(Recx, IB(1))
+        jmpxx_lb(100504b) /* ksm_tail */
+
+    LBL(100505) /* ksm_done */
+
+        addss_rr(Xmm1, Xmm3)
+        movss_st(Xmm1, Mebp, bls_RVAL)
+
+    ASM_LEAVE(info)
+}
+
+/* kdot (rval = x * y, compensated)
+ * reads: x, y, size, writes: rval */
+
+static
+rt_void blas_kdot(rt_SIMD_BLAS *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, bls_XPTR)
+        movxx_ld(Redi, Mebp, bls_YPTR)
+        movwx_ld(Recx, Mebp, bls_SIZE)
+        movyx_mi(Mebp, bls_RVAL, IC(0))
+        movss_ld(Xmm1, Mebp, bls_RVAL)
+        movss_ld(Xmm3, Mebp, bls_RVAL)
+
+        PEEL_HEAD(100500, 100510, 100506, 100505, bls_SKDT, Resi, Redi, Recx)
+        /* kdt_head, kdt_algn, kdt_ubdy, kdt_done, peel off x */
+
+    LBL(100501) /* kdt_body */
+
+        movss_st(Xmm1, Mebp, bls_RVAL)
+        movss_st(Xmm3, Mebp, bls_RCMP)
+        xorpx_rr(Xmm1, Xmm1)
+        xorpx_rr(Xmm2, Xmm2)
+        xorpx_rr(Xmm3, Xmm3)
+        xorpx_rr(Xmm4, Xmm4)
+
+    LBL(100502) /* kdt_pair */
+
+        cmjwx_ri(Recx, IM(S*2),
+        /* if */ LT_x, 100503f) /* kdt_simd */
+
+        movpx_ld(Xmm5, Mesi, DP(Q*0x000))
+        movpx_ld(Xmm0, Mesi, DP(Q*0x010))
+        cmaps_ld(Xmm1, Xmm3, Xmm5, Medi, DP(Q*0x000), Xmm6, Xmm7)
+        cmaps_ld(Xmm2, Xmm4, Xmm0, Medi, DP(Q*0x010), Xmm6, Xmm7)
+
+        addxx_ri(Resi, IM(Q*0x020))
+        addxx_ri(Redi, IM(Q*0x020))
+        subwx_ri(Recx, IM(S*2))
+        jmpxx_lb(100502b) /* kdt_pair */
+
+    LBL(100503) /* kdt_simd */
+
+        cmjwx_ri(Recx, IB(S),
+        /* if */ LT_x, 100513f) /* kdt_fold */
+
+        movpx_ld(Xmm5, Mesi, DP(Q*0x000))
+        cmaps_ld(Xmm1, Xmm3, Xmm5, Medi, DP(Q*0x000), Xmm6, Xmm7)
+
+        addxx_ri(Resi, IM(Q*0x010))
+        addxx_ri(Redi, IM(Q*0x010))
+        subwx_ri(Recx, IB(S))
+        jmpxx_lb(100513f) /* kdt_fold */
+
+    LBL(100506) /* kdt_ubdy */
+
+        movss_st(Xmm1, Mebp, bls_RVAL)
+        movss_st(Xmm3, Mebp, bls_RCMP)
+        xorpx_rr(Xmm1, Xmm1)
+        xorpx_rr(Xmm2, Xmm2)
+        xorpx_rr(Xmm3, Xmm3)
+        xorpx_rr(Xmm4, Xmm4)
+
+    LBL(100508) /* kdt_upar */
+
+        cmjwx_ri(Recx, IM(S*2),
+        /* if */ LT_x, 100509f) /* kdt_usmd */
+
+        movpx_ld(Xmm5, Mesi, DP(Q*0x000))
+        muvpx_ld(Xmm0, Medi, DP(Q*0x000))
+        cmaps_rr(Xmm1, Xmm3, Xmm5, Xmm0, Xmm6, Xmm7)
+        movpx_ld(Xmm5, Mesi, DP(Q*0x010))
+        muvpx_ld(Xmm0, Medi, DP(Q*0x010))
+        cmaps_rr(Xmm2, Xmm4, Xmm5, Xmm0, Xmm6, Xmm7)
+
+        addxx_ri(Resi, IM(Q*0x020))
+        addxx_ri(Redi, IM(Q*0x020))
+        subwx_ri(Recx, IM(S*2))
+        jmpxx_lb(100508b) /* kdt_upar */
+
+    LBL(100509) /* kdt_usmd */
+
+        cmjwx_ri(Recx, IB(S),
+        /* if */ LT_x, 100513f) /* kdt_fold */
+
+        movpx_ld(Xmm5, Mesi, DP(Q*0x000))
+        muvpx_ld(Xmm0, Medi, DP(Q*0x000))
+        cmaps_rr(Xmm1, Xmm3, Xmm5, Xmm0, Xmm6, Xmm7)
+
+        addxx_ri(Resi, IM(Q*0x010))
+        addxx_ri(Redi, IM(Q*0x010))
+        subwx_ri(Recx, IB(S))
+
+    LBL(100513) /* kdt_fold */
+
+        bls_FOLD(100523) /* kdt_lane */
+
+    LBL(100504) /* kdt_tail */
+
+        cmjwx_rz(Recx,
+        /* if */ EQ_x, 100505f) /* kdt_done */
+
+        bls_SKDT()
+
+        addxx_ri(Resi, IB(L*4))
+        addxx_ri(Redi, IB(L*4))
+        subwx_ri(Recx, IB(1))
+        jmpxx_lb(100504b) /* kdt_tail */
+
+    LBL(100505) /* kdt_done */
+
+        addss_rr(Xmm1, Xmm3)
+        movss_st(Xmm1, Mebp, bls_RVAL)
+
+    ASM_LEAVE(info)
+}
+
+#endif /* RT_RTBLAS_H */
+
+/******************************************************************************/
+/******************************************************************************/
+/******************************************************************************/
@@ -0,0 +1,903 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2023 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTBVHS_H
+#define RT_RTBVHS_H
+
+#include "rtbase.h"
+#include "rtrays.h"
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rtbvhs.h: binned SAH builder of wide BVH over axis-aligned boxes
+ * in fixed 128-bit cmdi* subset, output in configurable cmdp* width.
+ * Table of contents is provided below.
+ *
+ * Binary tree is built top-down with RT_BVHS_BINS centroid bins per axis,
+ * nodes of at least RT_BVHS_SIMD primitives are binned by bvh_bins kernel:
+ * bin indices of all 3 axes are computed at once (xyz in 128-bit lanes),
+ * bin bounds grow with 128-bit min/max (Wald's layout, one record per bin),
+ * then bins are transposed into axis-lanes and SAH cost of all splits is
+ * evaluated for the 3 axes at once by left/right sweeps (min/max/mul/add).
+ * Smaller nodes (lower levels) are binned by equivalent code in C/C++,
+ * as kernel call overhead outweighs the gain there.
+ * Primitive boxes are partitioned in place along with their indices,
+ * so that binning of each node reads its boxes sequentially.
+ * The binary tree is then collapsed into wide nodes of S children,
+ * where child boxes are stored in lanes of rt_SIMD_RBOX (rtrays.h),
+ * so that nodes can be tested directly with ray_node from rtrays.h,
+ * child links are stored in lanes of rt_SIMD_BVHL.
+ *
+ * Builder uses rt_fp32 internally, rt_fp64 input boxes are rounded outwards.
+ * All state is kept in the structure and its work area, so independent
+ * builds can run concurrently with separate structures.
+ */
+
+/*----------------------------------------------------------------------------*/
+
+/*************************   SIMD BACKEND STRUCTURE   *************************/
+
+/*************************   BVH STRUCTURES   *********************************/
+
+/*************************   BVH KERNELS   ************************************/
+
+/*************************   BVH DRIVERS   ************************************/
+
+/*----------------------------------------------------------------------------*/
+
+/* number of centroid bins per axis, bvh_bins offsets depend on it */
+#define RT_BVHS_BINS        16
+
+/* max number of primitives in a leaf */
+#define RT_BVHS_LEAF        4
+
+/* min number of primitives in a node for SIMD binning */
+#define RT_BVHS_SIMD        256
+
+/* magnitude of initial bounds of empty bins */
+#define RT_BVHS_HUGE        1.0e30f
+
+/******************************************************************************/
+/*************************   SIMD BACKEND STRUCTURE   *************************/
+/******************************************************************************/
+
+/*
+ * SIMD bvh structure for ASM_ENTER/ASM_LEAVE contains binning constants
+ * and kernel parameters set by drivers,
+ * must be initialized with ASM_INIT before use.
+ * Note that DP offsets below start where rt_SIMD_INFO ends (at Q*0x100).
+ * Only the 1st 128-bit of SIMD-fields are used (lanes x, y, z, w).
+ * SIMD width is taken into account via S and Q from rtbase.h
+ * Structure is read-write in backend.
+ */
+struct rt_SIMD_BVHS : public rt_SIMD_INFO
+{
+    /* kernel constants (SIMD-fields) */
+
+    rt_fp32 huge[R];        /* +RT_BVHS_HUGE */
+#define bvh_HUGE            DP(Q*0x100)
+
+    rt_fp32 nhug[R];        /* -RT_BVHS_HUGE */
+#define bvh_NHUG            DP(Q*0x110)
+
+    rt_fp32 cini[R];        /* +RT_BVHS_HUGE in xyz, 0.0 in w (count) */
+#define bvh_CINI            DP(Q*0x120)
+
+    rt_fp32 cnt1[R];        /* 0.0 in xyz, 1.0 in w (count) */
+#define bvh_CNT1            DP(Q*0x130)
+
+    rt_si32 aoff[R];        /* offsets of bin records of each axis */
+#define bvh_AOFF            DP(Q*0x140)
+
+    /* kernel parameters (SIMD-fields) */
+
+    rt_fp32 clo[R];         /* doubled centroid lower bound */
+#define bvh_CLO             DP(Q*0x150)
+
+    rt_fp32 csc[R];         /* number of bins per doubled centroid unit */
+#define bvh_CSC             DP(Q*0x160)
+
+    rt_fp32 cmx[R];         /* index of the last bin */
+#define bvh_CMX             DP(Q*0x170)
+
+    /* kernel scratchpads (SIMD-fields) */
+
+    rt_si32 bidx[R];        /* bin record offsets of a primitive */
+#define bvh_BID0            DP(Q*0x180+0x000)
+#define bvh_BID1            DP(Q*0x180+0x004)
+#define bvh_BID2            DP(Q*0x180+0x008)
+
+    rt_fp32 nacc[R];        /* accumulated counts in a sweep */
+#define bvh_NACC            DP(Q*0x190)
+
+    rt_fp32 tmp1[R];        /* temporary of area computation */
+#define bvh_TMP1            DP(Q*0x1A0)
+
+    /* kernel parameters (scalar) */
+
+    rt_fp32*pbox;           /* primitive boxes of the node, 32 bytes each */
+#define bvh_PBOX            DP(Q*0x1B0+0x000*P+E)
+
+    rt_fp32*bins;           /* bin records, 3 axes of RT_BVHS_BINS each */
+#define bvh_BINS            DP(Q*0x1B0+0x004*P+E)
+
+    rt_fp32*soab;           /* bins transposed into axis-lanes */
+#define bvh_SOAB            DP(Q*0x1B0+0x008*P+E)
+
+    rt_fp32*cost;           /* SAH cost and left count of each split */
+#define bvh_COST            DP(Q*0x1B0+0x00C*P+E)
+
+    rt_si32 pcnt;           /* number of primitives in the node */
+#define bvh_PCNT            DP(Q*0x1B0+0x010*P+0x000)
+
+    /* bvh parameters (C/C++ only) */
+
+    rt_ui08*work;           /* SIMD-aligned work area of bvh_work bytes */
+
+    rt_fp32*prim;           /* primitive boxes (min, max), in pidx order */
+
+    struct rt_BVHS_NODE *bnod; /* binary nodes */
+
+    rt_si32*stck;           /* stack of binary build and collapse */
+
+    rt_si32*pidx;           /* primitive indices, leaves refer into it */
+
+    rt_SIMD_RBOX *boxs;     /* child boxes of wide nodes (output) */
+
+    struct rt_SIMD_BVHL *link; /* child links of wide nodes (output) */
+
+    rt_si32 ncnt;           /* number of wide nodes, root is the 1st */
+
+    rt_si32 size;           /* max number of primitives */
+
+    rt_si32 smin;           /* min node size for SIMD binning */
+
+};
+
+/******************************************************************************/
+/*************************   BVH STRUCTURES   *********************************/
+/******************************************************************************/
+
+/*
+ * Links of S children of a wide node, child boxes are in rt_SIMD_RBOX.
+ * Inner child: ref is index of wide node, cnt is 0.
+ * Leaf child: ref is ~first (negative), primitives are pidx[first..+cnt).
+ * Empty lane: ref is -1, cnt is 0 (box is placed at RT_INF).
+ */
+struct rt_SIMD_BVHL
+{
+    rt_elem ref[S];         /* child reference */
+
+    rt_elem cnt[S];         /* number of primitives in leaf child */
+
+};
+
+/*
+ * Node of the binary tree (C/C++ only), bounds in (x, y, z, w) order,
+ * centroid bounds are doubled (min + max of primitive boxes).
+ */
+struct rt_BVHS_NODE
+{
+    rt_fp32 bmn[4], bmx[4]; /* node bounds */
+
+    rt_fp32 cmn[4], cmx[4]; /* doubled centroid bounds */
+
+    rt_si32 lft, rgt;       /* children, -1 for leaf */
+
+    rt_si32 fst, cnt;       /* primitive range in pidx */
+
+};
+
+/******************************************************************************/
+/*************************   BVH KERNELS   ************************************/
+/******************************************************************************/
+
+/*
+ * Grow bin record (bounds, doubled centroid bounds, count in w)
+ * at offset from scratchpad BD by primitive box Xmm0, Xmm1,
+ * doubled centroid Xmm3, uses Xmm4 as temporary.
+ */
+#define bvh_GROW(BD)                                                        \
+        movwx_ld(Reax, Mebp, W(BD))                                         \
+        movix_ld(Xmm4, Iedi, DP(0x000))                                     \
+        minis_rr(Xmm4, Xmm0)                                                \
+        movix_st(Xmm4, Iedi, DP(0x000))                                     \
+        movix_ld(Xmm4, Iedi, DP(0x010))                                     \
+        maxis_rr(Xmm4, Xmm1)                                                \
+        movix_st(Xmm4, Iedi, DP(0x010))                                     \
+        movix_ld(Xmm4, Iedi, DP(0x020))                                     \
+        minis_rr(Xmm4, Xmm3)                                                \
+        addis_ld(Xmm4, Mebp, bvh_CNT1)                                      \
+        movix_st(Xmm4, Iedi, DP(0x020))                                     \
+        movix_ld(Xmm4, Iedi, DP(0x030))                                     \
+        maxis_rr(Xmm4, Xmm3)                                                \
+        movix_st(Xmm4, Iedi, DP(0x030))
+
+/*
+ * Move bounds and count of bin record of axis at DA
+ * into lane at DL of transposed row (7 vectors).
+ */
+#define bvh_TRNS(DA, DL)                                                    \
+        movwx_ld(Reax, Medi, DP(DA+0x000))                                  \
+        movwx_st(Reax, Medx, DP(DL+0x000))                                  \
+        movwx_ld(Reax, Medi, DP(DA+0x004))                                  \
+        movwx_st(Reax, Medx, DP(DL+0x010))                                  \
+        movwx_ld(Reax, Medi, DP(DA+0x008))                                  \
+        movwx_st(Reax, Medx, DP(DL+0x020))                                  \
+        movwx_ld(Reax, Medi, DP(DA+0x010))                                  \
+        movwx_st(Reax, Medx, DP(DL+0x030))                                  \
+        movwx_ld(Reax, Medi, DP(DA+0x014))                                  \
+        movwx_st(Reax, Medx, DP(DL+0x040))                                  \
+        movwx_ld(Reax, Medi, DP(DA+0x018))                                  \
+        movwx_st(Reax, Medx, DP(DL+0x050))                                  \
+        movwx_ld(Reax, Medi, DP(DA+0x02C))                                  \
+        movwx_st(Reax, Medx, DP(DL+0x060))
+
+/*
+ * Accumulate transposed row at Medx into bounds Xmm0-Xmm5 and counts,
+ * put count-weighted surface area of bounds (lanes are axes) into Xmm6,
+ * area / 2 = ex * ey + ez * (ex + ey), uses Xmm7 as temporary.
+ */
+#define bvh_SWEEP()                                                         \
+        minis_ld(Xmm0, Medx, DP(0x000))                                     \
+        minis_ld(Xmm1, Medx, DP(0x010))                                     \
+        minis_ld(Xmm2, Medx, DP(0x020))                                     \
+        maxis_ld(Xmm3, Medx, DP(0x030))                                     \
+        maxis_ld(Xmm4, Medx, DP(0x040))                                     \
+        maxis_ld(Xmm5, Medx, DP(0x050))                                     \
+        movix_ld(Xmm6, Mebp, bvh_NACC)                                      \
+        addis_ld(Xmm6, Medx, DP(0x060))                                     \
+        movix_st(Xmm6, Mebp, bvh_NACC)                                      \
+        movix_rr(Xmm6, Xmm3)                                                \
+        subis_rr(Xmm6, Xmm0)                                                \
+        movix_rr(Xmm7, Xmm4)                                                \
+        subis_rr(Xmm7, Xmm1)                                                \
+        movix_st(Xmm6, Mebp, bvh_TMP1)                                      \
+        mulis_rr(Xmm6, Xmm7)                                                \
+        addis_ld(Xmm7, Mebp, bvh_TMP1)                                      \
+        movix_st(Xmm6, Mebp, bvh_TMP1)                                      \
+        movix_rr(Xmm6, Xmm5)                                                \
+        subis_rr(Xmm6, Xmm2)                                                \
+        mulis_rr(Xmm6, Xmm7)                                                \
+        addis_ld(Xmm6, Mebp, bvh_TMP1)                                      \
+        mulis_ld(Xmm6, Mebp, bvh_NACC)
+
+/*
+ * Reset sweep bounds Xmm0-Xmm5 and counts.
+ */
+#define bvh_RESET()                                                         \
+        movix_ld(Xmm0, Mebp, bvh_HUGE)                                      \
+        movix_rr(Xmm1, Xmm0)                                                \
+        movix_rr(Xmm2, Xmm0)                                                \
+        movix_ld(Xmm3, Mebp, bvh_NHUG)                                      \
+        movix_rr(Xmm4, Xmm3)                                                \
+        movix_rr(Xmm5, Xmm3)                                                \
+        xorix_rr(Xmm6, Xmm6)                                                \
+        movix_st(Xmm6, Mebp, bvh_NACC)
+
+/* bvh_bins (binning of pcnt primitives, SAH cost of all splits)
+ * reads: consts, clo, csc, cmx, pbox, pcnt, writes: bins, soab, cost */
+
+static
+rt_void bvh_bins(rt_SIMD_BVHS *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Redi, Mebp, bvh_BINS)
+        movxx_ri(Recx, IB(3*RT_BVHS_BINS))
+
+        movix_ld(Xmm0, Mebp, bvh_HUGE)
+        movix_ld(Xmm1, Mebp, bvh_NHUG)
+        movix_ld(Xmm2, Mebp, bvh_CINI)
+
+    LBL(101600) /* ini_loop */
+
+        movix_st(Xmm0, Medi, DP(0x000))
+        movix_st(Xmm1, Medi, DP(0x010))
+        movix_st(Xmm2, Medi, DP(0x020))
+        movix_st(Xmm1, Medi, DP(0x030))
+
+        addxx_ri(Redi, IM(0x040))
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 101600b) /* ini_loop */
+
+        movxx_ld(Resi, Mebp, bvh_PBOX)
+        movxx_ld(Redi, Mebp, bvh_BINS)
+        movwx_ld(Recx, Mebp, bvh_PCNT)
+
+        xorix_rr(Xmm7, Xmm7)
+
+    LBL(101601) /* bin_loop */
+
+        movix_ld(Xmm0, Mesi, DP(0x000))
+        movix_ld(Xmm1, Mesi, DP(0x010))
+        movix_rr(Xmm3, Xmm0)
+        addis_rr(Xmm3, Xmm1)
+        movix_rr(Xmm2, Xmm3)
+        subis_ld(Xmm2, Mebp, bvh_CLO)
+        mulis_ld(Xmm2, Mebp, bvh_CSC)
+        maxis_rr(Xmm2, Xmm7)
+        minis_ld(Xmm2, Mebp, bvh_CMX)
+        cvzis_rr(Xmm2, Xmm2)
+        shlix_ri(Xmm2, IB(6))
+        addix_ld(Xmm2, Mebp, bvh_AOFF)
+        movix_st(Xmm2, Mebp, bvh_BID0)
+
+        bvh_GROW(bvh_BID0)
+        bvh_GROW(bvh_BID1)
+        bvh_GROW(bvh_BID2)
+
+        addxx_ri(Resi, IM(0x020))
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 101601b) /* bin_loop */
+
+        movxx_ld(Redi, Mebp, bvh_BINS)
+        movxx_ld(Redx, Mebp, bvh_SOAB)
+        movxx_ri(Recx, IB(RT_BVHS_BINS))
+
+    LBL(101602) /* trn_loop */
+
+        bvh_TRNS(0x000, 0x000)
+        bvh_TRNS(0x400, 0x004)
+        bvh_TRNS(0x800, 0x008)
+
+        addxx_ri(Redi, IM(0x040))
+        addxx_ri(Redx, IM(0x070))
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 101602b) /* trn_loop */
+
+        movxx_ld(Redx, Mebp, bvh_SOAB)
+        movxx_ld(Rebx, Mebp, bvh_COST)
+        movxx_ri(Recx, IB(RT_BVHS_BINS-1))
+        bvh_RESET()
+
+    LBL(101603) /* lft_loop */
+
+        bvh_SWEEP()
+        movix_st(Xmm6, Mebx, DP(0x000))
+        movix_ld(Xmm6, Mebp, bvh_NACC)
+        movix_st(Xmm6, Mebx, DP(0x010))
+
+        addxx_ri(Redx, IM(0x070))
+        addxx_ri(Rebx, IM(0x020))
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 101603b) /* lft_loop */
+
+        subxx_ri(Rebx, IM(0x020))
+        movxx_ri(Recx, IB(RT_BVHS_BINS-1))
+        bvh_RESET()
+
+    LBL(101604) /* rgt_loop */
+
+        bvh_SWEEP()
+        addis_ld(Xmm6, Mebx, DP(0x000))
+        movix_st(Xmm6, Mebx, DP(0x000))
+
+        subxx_ri(Redx, IM(0x070))
+        subxx_ri(Rebx, IM(0x020))
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 101604b) /* rgt_loop */
+
+    ASM_LEAVE(info)
+}
+
+/******************************************************************************/
+/*************************   BVH DRIVERS   ************************************/
+/******************************************************************************/
+
+/*
+ * Assign work area of n primitives starting at w (if not RT_NULL),
+ * return its size in bytes (parts are SIMD-aligned).
+ */
+static
+rt_size bvh_part(rt_SIMD_BVHS *info, rt_ui08 *w, rt_si32 n)
+{
+    rt_size k = 0, m = RT_MAX(n, 1);
+
+#define bvh_ALLOC(p, t, c)                                                  \
+    if (w != RT_NULL) p = (t *)(w + k);                                     \
+    k += ((c) * sizeof(t) + RT_SIMD_ALIGN - 1) & ~(rt_size)(RT_SIMD_ALIGN - 1)
+
+    bvh_ALLOC(info->boxs, rt_SIMD_RBOX, m);
+    bvh_ALLOC(info->link, rt_SIMD_BVHL, m);
+    bvh_ALLOC(info->prim, rt_fp32, 8 * m);
+    bvh_ALLOC(info->bins, rt_fp32, 3 * RT_BVHS_BINS * 16);
+    bvh_ALLOC(info->soab, rt_fp32, RT_BVHS_BINS * 28);
+    bvh_ALLOC(info->cost, rt_fp32, (RT_BVHS_BINS - 1) * 8);
+    bvh_ALLOC(info->bnod, rt_BVHS_NODE, 2 * m);
+    bvh_ALLOC(info->stck, rt_si32, 3 * m + 64);
+    bvh_ALLOC(info->pidx, rt_si32, m);
+
+#undef bvh_ALLOC
+
+    return k;
+}
+
+/*
+ * Return size (in bytes) of work area for up to n primitives,
+ * caller allocates the area with extra space for SIMD-alignment
+ * and sets it to info->work.
+ */
+static
+rt_size bvh_work(rt_si32 n)
+{
+    rt_SIMD_BVHS tmp;
+
+    return bvh_part(&tmp, RT_NULL, n);
+}
+
+/*
+ * Prepare builds of up to n primitives,
+ * info->work must point to SIMD-aligned area of bvh_work(n) bytes.
+ * Structure must be initialized with ASM_INIT before the first use.
+ */
+static
+rt_void bvh_init(rt_SIMD_BVHS *info, rt_si32 n)
+{
+    rt_si32 a;
+
+    bvh_part(info, info->work, n);
+
+    info->size = n;
+    info->smin = RT_BVHS_SIMD;
+    info->ncnt = 0;
+
+    for (a = 0; a < 4; a++)
+    {
+        info->huge[a] = +RT_BVHS_HUGE;
+        info->nhug[a] = -RT_BVHS_HUGE;
+        info->cini[a] = a < 3 ? RT_BVHS_HUGE : 0.0f;
+        info->cnt1[a] = a < 3 ? 0.0f : 1.0f;
+        info->aoff[a] = a < 3 ? a * RT_BVHS_BINS * 64 : 0;
+        info->cmx[a] = (rt_fp32)(RT_BVHS_BINS - 1);
+    }
+
+    /* w-lanes of transposed rows are never written */
+    memset(info->soab, 0, RT_BVHS_BINS * 28 * sizeof(rt_fp32));
+}
+
+/*
+ * Round v to rt_fp32 towards -inf (d < 0) or +inf (d > 0).
+ */
+static
+rt_fp32 bvh_rnd(rt_real v, rt_si32 d)
+{
+    rt_fp32 f = (rt_fp32)v;
+
+    if (d < 0 && (rt_real)f > v)
+    {
+        f = nextafterf(f, -RT_BVHS_HUGE);
+    }
+    if (d > 0 && (rt_real)f < v)
+    {
+        f = nextafterf(f, +RT_BVHS_HUGE);
+    }
+    return f;
+}
+
+/*
+ * Return bin of doubled centroid c on axis a, scalar counterpart
+ * of index computation in bvh_bins (same operations in rt_fp32).
+ */
+static
+rt_si32 bvh_slot(rt_SIMD_BVHS *info, rt_fp32 c, rt_si32 a)
+{
+    rt_fp32 t = (c - info->clo[a]) * info->csc[a];
+
+    t = RT_MAX(t, 0.0f);
+    t = RT_MIN(t, info->cmx[a]);
+    return (rt_si32)t;
+}
+
+/*
+ * Scalar counterpart of bvh_bins (same operations in rt_fp32).
+ */
+static
+rt_void bvh_binc(rt_SIMD_BVHS *info)
+{
+    rt_fp32 *b, *p, *q, c[4], mn[3][3], mx[3][3], n[3], t, ex, ey;
+    rt_si32 a, i, j, k;
+
+    for (j = 0; j < 3 * RT_BVHS_BINS; j++)
+    {
+        b = info->bins + 16 * j;
+        for (a = 0; a < 4; a++)
+        {
+            b[a + 0] = info->huge[a];
+            b[a + 4] = info->nhug[a];
+            b[a + 8] = info->cini[a];
+            b[a + 12] = info->nhug[a];
+        }
+    }
+
+    for (i = 0; i < info->pcnt; i++)
+    {
+        p = info->pbox + 8 * i;
+        c[0] = p[0] + p[4];
+        c[1] = p[1] + p[5];
+        c[2] = p[2] + p[6];
+
+        for (k = 0; k < 3; k++)
+        {
+            b = info->bins + 16 * (RT_BVHS_BINS * k + bvh_slot(info, c[k], k));
+            for (a = 0; a < 3; a++)
+            {
+                b[a + 0] = RT_MIN(b[a + 0], p[a + 0]);
+                b[a + 4] = RT_MAX(b[a + 4], p[a + 4]);
+                b[a + 8] = RT_MIN(b[a + 8], c[a]);
+                b[a + 12] = RT_MAX(b[a + 12], c[a]);
+            }
+            b[11] += 1.0f;
+        }
+    }
+
+    /* left sweep writes cost and count, right sweep adds its cost */
+    for (k = 0; k < 2; k++)
+    {
+        for (a = 0; a < 3; a++)
+        {
+            mn[a][0] = mn[a][1] = mn[a][2] = info->huge[a];
+            mx[a][0] = mx[a][1] = mx[a][2] = info->nhug[a];
+            n[a] = 0.0f;
+        }
+        for (j = 0; j < RT_BVHS_BINS - 1; j++)
+        {
+            i = k == 0 ? j : RT_BVHS_BINS - 1 - j;
+            q = info->cost + 8 * (k == 0 ? i : i - 1);
+
+            for (a = 0; a < 3; a++)
+            {
+                b = info->bins + 16 * (RT_BVHS_BINS * a + i);
+                mn[a][0] = RT_MIN(mn[a][0], b[0]);
+                mn[a][1] = RT_MIN(mn[a][1], b[1]);
+                mn[a][2] = RT_MIN(mn[a][2], b[2]);
+                mx[a][0] = RT_MAX(mx[a][0], b[4]);
+                mx[a][1] = RT_MAX(mx[a][1], b[5]);
+                mx[a][2] = RT_MAX(mx[a][2], b[6]);
+                n[a] += b[11];
+
+                ex = mx[a][0] - mn[a][0];
+                ey = mx[a][1] - mn[a][1];
+                t = ex * ey;
+                t = (mx[a][2] - mn[a][2]) * (ex + ey) + t;
+                t = t * n[a];
+
+                if (k == 0)
+                {
+                    q[a + 0] = t;
+                    q[a + 4] = n[a];
+                }
+                else
+                {
+                    q[a + 0] = t + q[a + 0];
+                }
+            }
+        }
+    }
+}
+
+/*
+ * Return half surface area of box with bounds mn, mx.
+ */
+static
+rt_fp32 bvh_area(const rt_fp32 *mn, const rt_fp32 *mx)
+{
+    rt_fp32 ex = mx[0] - mn[0], ey = mx[1] - mn[1], ez = mx[2] - mn[2];
+
+    return ex * ey + ez * (ex + ey);
+}
+
+/*
+ * Set bounds of binary node k by scanning its primitives.
+ */
+static
+rt_void bvh_scan(rt_SIMD_BVHS *info, rt_si32 k)
+{
+    rt_BVHS_NODE *d = info->bnod + k;
+    rt_fp32 *p;
+    rt_si32 a, i;
+
+    for (a = 0; a < 4; a++)
+    {
+        d->bmn[a] = d->cmn[a] = info->huge[a];
+        d->bmx[a] = d->cmx[a] = info->nhug[a];
+    }
+    for (i = d->fst; i < d->fst + d->cnt; i++)
+    {
+        p = info->prim + 8 * i;
+        for (a = 0; a < 3; a++)
+        {
+            d->bmn[a] = RT_MIN(d->bmn[a], p[a + 0]);
+            d->bmx[a] = RT_MAX(d->bmx[a], p[a + 4]);
+            d->cmn[a] = RT_MIN(d->cmn[a], p[a + 0] + p[a + 4]);
+            d->cmx[a] = RT_MAX(d->cmx[a], p[a + 0] + p[a + 4]);
+        }
+    }
+}
+
+/*
+ * Set bounds of binary node k as union of bins [j0, j1] on axis a.
+ */
+static
+rt_void bvh_join(rt_SIMD_BVHS *info, rt_si32 k, rt_si32 a,
+                 rt_si32 j0, rt_si32 j1)
+{
+    rt_BVHS_NODE *d = info->bnod + k;
+    rt_fp32 *b;
+    rt_si32 c, j;
+
+    for (c = 0; c < 4; c++)
+    {
+        d->bmn[c] = d->cmn[c] = info->huge[c];
+        d->bmx[c] = d->cmx[c] = info->nhug[c];
+    }
+    for (j = j0; j <= j1; j++)
+    {
+        b = info->bins + 16 * (RT_BVHS_BINS * a + j);
+        for (c = 0; c < 3; c++)
+        {
+            d->bmn[c] = RT_MIN(d->bmn[c], b[c + 0]);
+            d->bmx[c] = RT_MAX(d->bmx[c], b[c + 4]);
+            d->cmn[c] = RT_MIN(d->cmn[c], b[c + 8]);
+            d->cmx[c] = RT_MAX(d->cmx[c], b[c + 12]);
+        }
+    }
+}
+
+/*
+ * Split binary node k into children m and m + 1 if it has more than
+ * RT_BVHS_LEAF primitives, return 1 if split, 0 if leaf.
+ */
+static
+rt_si32 bvh_node(rt_SIMD_BVHS *info, rt_si32 k, rt_si32 m)
+{
+    rt_BVHS_NODE *d = info->bnod + k, *l, *r;
+    rt_fp32 e, f, best = +RT_BVHS_HUGE, *p, *q;
+    rt_si32 a, b = -1, c, i, j, s = 0, t, *x = info->pidx;
+
+    d->lft = d->rgt = -1;
+
+    if (d->cnt <= RT_BVHS_LEAF)
+    {
+        return 0;
+    }
+
+    for (a = 0; a < 3; a++)
+    {
+        e = d->cmx[a] - d->cmn[a];
+        info->clo[a] = d->cmn[a];
+        info->csc[a] = e > 0.0f ? (rt_fp32)RT_BVHS_BINS / e : 0.0f;
+    }
+    info->clo[3] = info->csc[3] = 0.0f;
+
+    info->pbox = info->prim + 8 * d->fst;
+    info->pcnt = d->cnt;
+
+    if (d->cnt >= info->smin)
+    {
+        bvh_bins(info);
+    }
+    else
+    {
+        bvh_binc(info);
+    }
+
+    /* the cheapest split with primitives on both sides,
+     * NaN costs of empty sides are never chosen */
+    for (a = 0; a < 3; a++)
+    {
+        for (j = 0; j < RT_BVHS_BINS - 1; j++)
+        {
+            p = info->cost + 8 * j;
+            if (p[a + 4] > 0.0f && p[a + 4] < (rt_fp32)d->cnt
+            &&  p[a + 0] < best)
+            {
+                best = p[a + 0];
+                b = a;
+                s = j;
+            }
+        }
+    }
+
+    /* partition boxes along with indices by bin of the split axis,
+     * so that binning reads them in order at lower levels,
+     * equal centroids are split in half (in index order) */
+    if (b >= 0)
+    {
+        i = d->fst;
+        j = d->fst + d->cnt - 1;
+        while (i <= j)
+        {
+            p = info->prim + 8 * i;
+            if (bvh_slot(info, p[b] + p[b + 4], b) <= s)
+            {
+                i++;
+                continue;
+            }
+            q = info->prim + 8 * j;
+            for (c = 0; c < 8; c++)
+            {
+                f = p[c];
+                p[c] = q[c];
+                q[c] = f;
+            }
+            t = x[i];
+            x[i] = x[j];
+            x[j] = t;
+            j--;
+        }
+        t = i - d->fst;
+    }
+    else
+    {
+        t = d->cnt / 2;
+    }
+
+    d->lft = m;
+    d->rgt = m + 1;
+    l = info->bnod + m;
+    r = info->bnod + m + 1;
+    l->fst = d->fst;
+    l->cnt = t;
+    r->fst = d->fst + t;
+    r->cnt = d->cnt - t;
+
+    /* bins are valid until the next binning */
+    if (b >= 0 && (rt_fp32)t == info->cost[8 * s + b + 4])
+    {
+        bvh_join(info, m + 0, b, 0, s);
+        bvh_join(info, m + 1, b, s + 1, RT_BVHS_BINS - 1);
+    }
+    else
+    {
+        bvh_scan(info, m + 0);
+        bvh_scan(info, m + 1);
+    }
+
+    return 1;
+}
+
+/*
+ * Collapse binary tree into wide nodes of up to S children
+ * by opening the inner child of the largest area,
+ * nodes are numbered in breadth-first order.
+ */
+static
+rt_void bvh_wide(rt_SIMD_BVHS *info)
+{
+    rt_BVHS_NODE *d, *n = info->bnod;
+    rt_SIMD_RBOX *b;
+    rt_SIMD_BVHL *l;
+    rt_fp32 e, f;
+    rt_si32 c[S], h, i, j, m, t = 0, *x = info->stck;
+
+    x[t++] = 0;
+
+    for (h = 0; h < t; h++)
+    {
+        d = n + x[h];
+        m = 0;
+
+        if (d->lft < 0)
+        {
+            c[m++] = x[h];
+        }
+        else
+        {
+            c[m++] = d->lft;
+            c[m++] = d->rgt;
+        }
+
+        while (m < S)
+        {
+            for (i = 0, j = -1, f = -1.0f; i < m; i++)
+            {
+                d = n + c[i];
+                e = bvh_area(d->bmn, d->bmx);
+                if (d->lft >= 0 && e > f)
+                {
+                    f = e;
+                    j = i;
+                }
+            }
+            if (j < 0)
+            {
+                break;
+            }
+            d = n + c[j];
+            c[j] = d->lft;
+            c[m++] = d->rgt;
+        }
+
+        b = info->boxs + h;
+        l = info->link + h;
+
+        for (i = 0; i < S; i++)
+        {
+            if (i < m)
+            {
+                d = n + c[i];
+                b->mnx[i] = (rt_real)d->bmn[0];
+                b->mny[i] = (rt_real)d->bmn[1];
+                b->mnz[i] = (rt_real)d->bmn[2];
+                b->mxx[i] = (rt_real)d->bmx[0];
+                b->mxy[i] = (rt_real)d->bmx[1];
+                b->mxz[i] = (rt_real)d->bmx[2];
+                if (d->lft < 0)
+                {
+                    l->ref[i] = ~(rt_elem)d->fst;
+                    l->cnt[i] = (rt_elem)d->cnt;
+                }
+                else
+                {
+                    l->ref[i] = (rt_elem)t;
+                    l->cnt[i] = 0;
+                    x[t++] = c[i];
+                }
+            }
+            else
+            {
+                b->mnx[i] = b->mny[i] = b->mnz[i] = RT_INF;
+                b->mxx[i] = b->mxy[i] = b->mxz[i] = RT_INF;
+                l->ref[i] = -1;
+                l->cnt[i] = 0;
+            }
+        }
+    }
+
+    info->ncnt = t;
+}
+
+/*
+ * Build wide BVH over n (up to size) boxes given by min and max corners
+ * (6 values each) from v, results are in boxs, link (ncnt nodes) and pidx.
+ */
+static
+rt_void bvh_build(rt_SIMD_BVHS *info, const rt_real *v, rt_si32 n)
+{
+    rt_fp32 *p;
+    rt_si32 a, i, k, m = 1, t = 0;
+
+    n = RT_MIN(n, info->size);
+    n = RT_MAX(n, 0);
+
+    for (i = 0; i < n; i++)
+    {
+        p = info->prim + 8 * i;
+        for (a = 0; a < 3; a++)
+        {
+            p[a + 0] = bvh_rnd(v[6*i+a+0], -1);
+            p[a + 4] = bvh_rnd(v[6*i+a+3], +1);
+        }
+        p[3] = p[7] = RT_BVHS_HUGE;
+        info->pidx[i] = i;
+    }
+
+    info->bnod[0].fst = 0;
+    info->bnod[0].cnt = n;
+    bvh_scan(info, 0);
+
+    /* depth-first, as binning needs no more than one node at a time */
+    info->stck[t++] = 0;
+
+    while (t > 0)
+    {
+        k = info->stck[--t];
+        if (bvh_node(info, k, m))
+        {
+            info->stck[t++] = m + 1;
+            info->stck[t++] = m + 0;
+            m += 2;
+        }
+    }
+
+    bvh_wide(info);
+}
+
+#endif /* RT_RTBVHS_H */
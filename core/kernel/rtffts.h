@@ -0,0 +1,632 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2023 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTFFTS_H
+#define RT_RTFFTS_H
+
+#include "rtbase.h"
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rtffts.h: fast Fourier transforms (FFT) in configurable cmdp* subset.
+ * Table of contents is provided below.
+ *
+ * Complex transforms of n = 2^k points (n >= S) take and return separate
+ * arrays of real and imaginary parts (SoA) of rt_real elements, thus single
+ * or double precision is chosen by RT_ELEMENT (cmdp* maps to cmdo* or cmdq*).
+ * Real transforms of 2 * n samples run a complex transform of n points
+ * and produce (or take) n + 1 bins, inverse transforms aren't scaled.
+ *
+ * SIMD ISA has no shuffles by design, therefore the transform is split
+ * as n = M * S (four-step): S lanes of a register hold S interleaved
+ * sequences of M points, which are transformed lane-parallel with
+ * broadcast twiddles (radix-4 Stockham stages with radix-2 for odd k),
+ * then multiplied by elementwise twiddles and transposed in C/C++,
+ * after that M-wide rows are transformed by S-point Stockham stages
+ * producing the result in natural order (no bit-reversal).
+ * Internally real and imaginary registers are interleaved per block
+ * of S points (split complex within SIMD-aligned blocks).
+ *
+ * Twiddle tables are computed in double precision by fft_init and kept
+ * in caller-provided SIMD-aligned work area along with transform buffers.
+ * Inverse complex transform swaps real and imaginary parts on input
+ * and output of the forward one, which spares separate kernels and tables.
+ */
+
+/*----------------------------------------------------------------------------*/
+
+/*************************   SIMD BACKEND STRUCTURE   *************************/
+
+/*************************   FFT KERNELS   ************************************/
+
+/*************************   FFT DRIVERS   ************************************/
+
+/*----------------------------------------------------------------------------*/
+
+/******************************************************************************/
+/*************************   SIMD BACKEND STRUCTURE   *************************/
+/******************************************************************************/
+
+/*
+ * SIMD FFT structure for ASM_ENTER/ASM_LEAVE contains kernel parameters
+ * set by drivers and transform parameters set by fft_init,
+ * must be initialized with ASM_INIT before use.
+ * Note that DP offsets below start where rt_SIMD_INFO ends (at Q*0x100).
+ * SIMD width is taken into account via S and Q from rtbase.h
+ * Structure is read-write in backend.
+ */
+struct rt_SIMD_FFTS : public rt_SIMD_INFO
+{
+    /* kernel parameters (set by drivers) */
+
+    rt_real*srcx;           /* source blocks of the stage */
+#define fft_SRCX            DP(Q*0x100+0x000*P+E)
+
+    rt_real*dstx;           /* destination blocks of the stage */
+#define fft_DSTX            DP(Q*0x100+0x004*P+E)
+
+    rt_real*twdl;           /* twiddles of the stage */
+#define fft_TWDL            DP(Q*0x100+0x008*P+E)
+
+    rt_cell ostr;           /* offset of source quarters (halves) in bytes */
+#define fft_OSTR            DP(Q*0x100+0x00C*P+E)
+
+    rt_cell qstr;           /* stride of destination quarters in bytes */
+#define fft_QSTR            DP(Q*0x100+0x010*P+E)
+
+    rt_cell qbak;           /* 3 * qstr - block size in bytes */
+#define fft_QBAK            DP(Q*0x100+0x014*P+E)
+
+    rt_si32 pcnt;           /* number of twiddle groups */
+#define fft_PCNT            DP(Q*0x100+0x018*P+0x000)
+
+    rt_si32 qcnt;           /* number of blocks per group */
+#define fft_QCNT            DP(Q*0x100+0x018*P+0x004)
+
+    rt_si32 jcnt;           /* internal, group counter */
+#define fft_JCNT            DP(Q*0x100+0x018*P+0x008)
+
+    /* transform parameters (C/C++ only) */
+
+    rt_real*work;           /* SIMD-aligned work area of fft_work bytes */
+
+    rt_real*buf0;           /* 1st transform buffer */
+    rt_real*buf1;           /* 2nd transform buffer */
+    rt_real*tw1;            /* broadcast twiddles of M-point stages */
+    rt_real*tw2;            /* elementwise twiddles between the steps */
+    rt_real*tw3;            /* broadcast twiddles of S-point stages */
+    rt_real*twr;            /* twiddles of real transforms (n + 1 pairs) */
+
+    rt_si32 size;           /* number of complex points n */
+    rt_si32 mcnt;           /* number of points per lane M = n / S */
+    rt_si32 vcnt;           /* number of blocks per row max(M, S) / S */
+
+};
+
+/******************************************************************************/
+/*************************   FFT KERNELS   ************************************/
+/******************************************************************************/
+
+/* fft_rad4 (dstx = radix-4 Stockham stage of srcx)
+ * reads: srcx, dstx, twdl, ostr, qstr, qbak, pcnt, qcnt, destroys jcnt
+ * for each twiddle group p (w^p, w^2p, w^3p) transforms qcnt blocks
+ * of four source quarters (a, b, c, d) into four destination quarters:
+ * a + c + b + d, (a - c - j(b - d)) w^p, (a + c - b - d) w^2p,
+ * (a - c + j(b - d)) w^3p */
+
+static
+rt_void fft_rad4(rt_SIMD_FFTS *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Reax, Mebp, fft_OSTR)
+        movxx_ld(Resi, Mebp, fft_SRCX)
+        movxx_rr(Rebx, Resi)
+        addxx_rr(Rebx, Reax)
+        addxx_rr(Rebx, Reax)
+        movxx_ld(Redi, Mebp, fft_DSTX)
+        movxx_ld(Recx, Mebp, fft_TWDL)
+        movwx_ld(Redx, Mebp, fft_PCNT)
+        movwx_st(Redx, Mebp, fft_JCNT)
+
+    LBL(101000) /* rad4_grps */
+
+        movwx_ld(Redx, Mebp, fft_QCNT)
+
+    LBL(101001) /* rad4_blks */
+
+        movpx_ld(Xmm0, Mesi, DP(Q*0x000))
+        addps_ld(Xmm0, Mebx, DP(Q*0x000))
+        movpx_ld(Xmm1, Mesi, DP(Q*0x010))
+        addps_ld(Xmm1, Mebx, DP(Q*0x010))
+        movpx_ld(Xmm2, Iesi, DP(Q*0x000))
+        addps_ld(Xmm2, Iebx, DP(Q*0x000))
+        movpx_ld(Xmm3, Iesi, DP(Q*0x010))
+        addps_ld(Xmm3, Iebx, DP(Q*0x010))
+
+        movpx_rr(Xmm4, Xmm0)
+        addps_rr(Xmm4, Xmm2)
+        movpx_rr(Xmm5, Xmm1)
+        addps_rr(Xmm5, Xmm3)
+        movpx_st(Xmm4, Medi, DP(Q*0x000))
+        movpx_st(Xmm5, Medi, DP(Q*0x010))
+
+        subps_rr(Xmm0, Xmm2)
+        subps_rr(Xmm1, Xmm3)
+        movpx_rr(Xmm2, Xmm0)
+        mulps_ld(Xmm2, Mecx, DP(Q*0x020))
+        movpx_rr(Xmm3, Xmm1)
+        mulps_ld(Xmm3, Mecx, DP(Q*0x030))
+        subps_rr(Xmm2, Xmm3)
+        mulps_ld(Xmm0, Mecx, DP(Q*0x030))
+        mulps_ld(Xmm1, Mecx, DP(Q*0x020))
+        addps_rr(Xmm1, Xmm0)
+        addxx_ld(Redi, Mebp, fft_QSTR)
+        addxx_ld(Redi, Mebp, fft_QSTR)
+        movpx_st(Xmm2, Medi, DP(Q*0x000))
+        movpx_st(Xmm1, Medi, DP(Q*0x010))
+        subxx_ld(Redi, Mebp, fft_QSTR)
+
+        movpx_ld(Xmm4, Mesi, DP(Q*0x000))
+        subps_ld(Xmm4, Mebx, DP(Q*0x000))
+        movpx_ld(Xmm5, Mesi, DP(Q*0x010))
+        subps_ld(Xmm5, Mebx, DP(Q*0x010))
+        movpx_ld(Xmm6, Iesi, DP(Q*0x000))
+        subps_ld(Xmm6, Iebx, DP(Q*0x000))
+        movpx_ld(Xmm7, Iesi, DP(Q*0x010))
+        subps_ld(Xmm7, Iebx, DP(Q*0x010))
+
+        movpx_rr(Xmm0, Xmm4)
+        addps_rr(Xmm0, Xmm7)
+        movpx_rr(Xmm1, Xmm5)
+        subps_rr(Xmm1, Xmm6)
+        subps_rr(Xmm4, Xmm7)
+        addps_rr(Xmm5, Xmm6)
+
+        movpx_rr(Xmm2, Xmm0)
+        mulps_ld(Xmm2, Mecx, DP(Q*0x000))
+        movpx_rr(Xmm3, Xmm1)
+        mulps_ld(Xmm3, Mecx, DP(Q*0x010))
+        subps_rr(Xmm2, Xmm3)
+        mulps_ld(Xmm0, Mecx, DP(Q*0x010))
+        mulps_ld(Xmm1, Mecx, DP(Q*0x000))
+        addps_rr(Xmm1, Xmm0)
+        movpx_st(Xmm2, Medi, DP(Q*0x000))
+        movpx_st(Xmm1, Medi, DP(Q*0x010))
+
+        movpx_rr(Xmm6, Xmm4)
+        mulps_ld(Xmm6, Mecx, DP(Q*0x040))
+        movpx_rr(Xmm7, Xmm5)
+        mulps_ld(Xmm7, Mecx, DP(Q*0x050))
+        subps_rr(Xmm6, Xmm7)
+        mulps_ld(Xmm4, Mecx, DP(Q*0x050))
+        mulps_ld(Xmm5, Mecx, DP(Q*0x040))
+        addps_rr(Xmm5, Xmm4)
+        addxx_ld(Redi, Mebp, fft_QSTR)
+        addxx_ld(Redi, Mebp, fft_QSTR)
+        movpx_st(Xmm6, Medi, DP(Q*0x000))
+        movpx_st(Xmm5, Medi, DP(Q*0x010))
+        subxx_ld(Redi, Mebp, fft_QBAK)
+
+        addxx_ri(Resi, IM(Q*0x020))
+        addxx_ri(Rebx, IM(Q*0x020))
+        arjwx_ri(Redx, IB(1),
+        sub_x, NZ_x, 101001b) /* rad4_blks */
+
+        addxx_ld(Redi, Mebp, fft_QSTR)
+        addxx_ld(Redi, Mebp, fft_QSTR)
+        addxx_ld(Redi, Mebp, fft_QSTR)
+        addxx_ri(Recx, IM(Q*0x060))
+        arjwx_mi(Mebp, fft_JCNT, IB(1),
+        sub_x, NZ_x, 101000b) /* rad4_grps */
+
+    ASM_LEAVE(info)
+}
+
+/* fft_rad2 (dstx = radix-2 Stockham stage of srcx, last one)
+ * reads: srcx, dstx, ostr, qstr, qcnt
+ * transforms qcnt blocks of two source halves (a, b) into a + b, a - b,
+ * twiddles of the last stage are all equal to 1 */
+
+static
+rt_void fft_rad2(rt_SIMD_FFTS *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, fft_SRCX)
+        movxx_rr(Rebx, Resi)
+        addxx_ld(Rebx, Mebp, fft_OSTR)
+        movxx_ld(Redi, Mebp, fft_DSTX)
+        movxx_rr(Redx, Redi)
+        addxx_ld(Redx, Mebp, fft_QSTR)
+        movwx_ld(Reax, Mebp, fft_QCNT)
+
+    LBL(101002) /* rad2_blks */
+
+        movpx_ld(Xmm0, Mesi, DP(Q*0x000))
+        movpx_rr(Xmm2, Xmm0)
+        addps_ld(Xmm0, Mebx, DP(Q*0x000))
+        subps_ld(Xmm2, Mebx, DP(Q*0x000))
+        movpx_ld(Xmm1, Mesi, DP(Q*0x010))
+        movpx_rr(Xmm3, Xmm1)
+        addps_ld(Xmm1, Mebx, DP(Q*0x010))
+        subps_ld(Xmm3, Mebx, DP(Q*0x010))
+        movpx_st(Xmm0, Medi, DP(Q*0x000))
+        movpx_st(Xmm1, Medi, DP(Q*0x010))
+        movpx_st(Xmm2, Medx, DP(Q*0x000))
+        movpx_st(Xmm3, Medx, DP(Q*0x010))
+
+        addxx_ri(Resi, IM(Q*0x020))
+        addxx_ri(Rebx, IM(Q*0x020))
+        addxx_ri(Redi, IM(Q*0x020))
+        addxx_ri(Redx, IM(Q*0x020))
+        arjwx_ri(Reax, IB(1),
+        sub_x, NZ_x, 101002b) /* rad2_blks */
+
+    ASM_LEAVE(info)
+}
+
+/* fft_cmul (srcx = srcx * twdl, elementwise complex)
+ * reads: srcx, twdl, qcnt, writes: srcx */
+
+static
+rt_void fft_cmul(rt_SIMD_FFTS *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, fft_SRCX)
+        movxx_ld(Redi, Mebp, fft_TWDL)
+        movwx_ld(Reax, Mebp, fft_QCNT)
+
+    LBL(101003) /* cmul_blks */
+
+        movpx_ld(Xmm0, Mesi, DP(Q*0x000))
+        movpx_ld(Xmm1, Mesi, DP(Q*0x010))
+        movpx_rr(Xmm2, Xmm0)
+        mulps_ld(Xmm2, Medi, DP(Q*0x000))
+        movpx_rr(Xmm3, Xmm1)
+        mulps_ld(Xmm3, Medi, DP(Q*0x010))
+        subps_rr(Xmm2, Xmm3)
+        mulps_ld(Xmm0, Medi, DP(Q*0x010))
+        mulps_ld(Xmm1, Medi, DP(Q*0x000))
+        addps_rr(Xmm1, Xmm0)
+        movpx_st(Xmm2, Mesi, DP(Q*0x000))
+        movpx_st(Xmm1, Mesi, DP(Q*0x010))
+
+        addxx_ri(Resi, IM(Q*0x020))
+        addxx_ri(Redi, IM(Q*0x020))
+        arjwx_ri(Reax, IB(1),
+        sub_x, NZ_x, 101003b) /* cmul_blks */
+
+    ASM_LEAVE(info)
+}
+
+/******************************************************************************/
+/*************************   FFT DRIVERS   ************************************/
+/******************************************************************************/
+
+/*
+ * Return number of rt_real elements in broadcast twiddle tables
+ * of Stockham stages for n points.
+ */
+static
+rt_size fft_tlen(rt_si32 n)
+{
+    rt_size k = 0;
+
+    for (; n >= 4; n /= 4)
+    {
+        k += (rt_size)(n / 4) * 6 * S;
+    }
+
+    return k;
+}
+
+/*
+ * Return size of the work area in bytes required by fft_init and drivers
+ * for complex transforms of n points (real transforms of 2 * n samples),
+ * the work area itself must be SIMD-aligned (to RT_SIMD_ALIGN)
+ * and set to info->work.
+ */
+static
+rt_size fft_work(rt_si32 n)
+{
+    rt_size b = (rt_size)RT_MAX(n, S * S) * 2;
+
+    return (b * 2 + fft_tlen(n / S) + (rt_size)n * 2 + fft_tlen(S)
+          + (rt_size)(n + 1) * 2) * sizeof(rt_real);
+}
+
+/*
+ * Fill broadcast twiddle table t of Stockham stages for n points.
+ */
+static
+rt_void fft_tset(rt_real *t, rt_si32 n)
+{
+    rt_si32 i, k, p;
+    rt_fp64 a;
+
+    for (; n >= 4; n /= 4)
+    {
+        for (p = 0; p < n / 4; p++)
+        {
+            for (k = 1; k <= 3; k++, t += 2 * S)
+            {
+                a = -RT_2_PI * k * p / n;
+
+                for (i = 0; i < S; i++)
+                {
+                    t[i + 0] = (rt_real)RT_COS64(a);
+                    t[i + S] = (rt_real)RT_SIN64(a);
+                }
+            }
+        }
+    }
+}
+
+/*
+ * Prepare transforms of n complex points (n = 2^k, n >= S),
+ * which also serve real transforms of 2 * n samples,
+ * info->work must point to SIMD-aligned area of fft_work(n) bytes.
+ * Structure must be initialized with ASM_INIT before the first use.
+ */
+static
+rt_void fft_init(rt_SIMD_FFTS *info, rt_si32 n)
+{
+    rt_si32 i, k, m = n / S;
+    rt_size b = (rt_size)RT_MAX(n, S * S) * 2;
+    rt_real *t;
+    rt_fp64 a;
+
+    info->size = n;
+    info->mcnt = m;
+    info->vcnt = RT_MAX(m, S) / S;
+
+    info->buf0 = info->work;
+    info->buf1 = info->buf0 + b;
+    info->tw1  = info->buf1 + b;
+    info->tw2  = info->tw1 + fft_tlen(m);
+    info->tw3  = info->tw2 + (rt_size)n * 2;
+    info->twr  = info->tw3 + fft_tlen(S);
+
+    fft_tset(info->tw1, m);
+    fft_tset(info->tw3, S);
+
+    /* lane i of block k is multiplied by w^(i*k) of n points */
+    for (k = 0, t = info->tw2; k < m; k++, t += 2 * S)
+    {
+        for (i = 0; i < S; i++)
+        {
+            a = -RT_2_PI * i * k / n;
+            t[i + 0] = (rt_real)RT_COS64(a);
+            t[i + S] = (rt_real)RT_SIN64(a);
+        }
+    }
+
+    for (k = 0, t = info->twr; k <= n; k++, t += 2)
+    {
+        a = -RT_PI * k / n;
+        t[0] = (rt_real)RT_COS64(a);
+        t[1] = (rt_real)RT_SIN64(a);
+    }
+}
+
+/*
+ * Run Stockham stages for n points with initial stride s (in blocks)
+ * starting from buffer x, return buffer with the result (x or y).
+ */
+static
+rt_real *fft_stgs(rt_SIMD_FFTS *info, rt_real *x, rt_real *y,
+                  rt_si32 n, rt_si32 s, rt_real *t)
+{
+    rt_si32 c = n * s;
+    rt_real *z;
+
+    for (; n >= 4; n /= 4, s *= 4)
+    {
+        info->srcx = x;
+        info->dstx = y;
+        info->twdl = t;
+        info->ostr = (rt_cell)c / 4 * Q * 0x20;
+        info->qstr = (rt_cell)s * Q * 0x20;
+        info->qbak = (rt_cell)(3 * s - 1) * Q * 0x20;
+        info->pcnt = n / 4;
+        info->qcnt = s;
+        fft_rad4(info);
+
+        t += (rt_size)(n / 4) * 6 * S;
+        z = x; x = y; y = z;
+    }
+
+    if (n == 2)
+    {
+        info->srcx = x;
+        info->dstx = y;
+        info->ostr = (rt_cell)s * Q * 0x20;
+        info->qstr = (rt_cell)s * Q * 0x20;
+        info->qcnt = s;
+        fft_rad2(info);
+
+        z = x; x = y; y = z;
+    }
+
+    return x;
+}
+
+/*
+ * Transform points prepared in buf0 (natural order in blocks),
+ * return buffer with the result as S rows of vcnt blocks,
+ * where point k is at column k % M of row k / M.
+ */
+static
+rt_real *fft_core(rt_SIMD_FFTS *info)
+{
+    rt_si32 i, k, m = info->mcnt, v = info->vcnt;
+    rt_real *x, *y, *s, *d;
+
+    x = fft_stgs(info, info->buf0, info->buf1, m, 1, info->tw1);
+    y = x == info->buf0 ? info->buf1 : info->buf0;
+
+    info->srcx = x;
+    info->twdl = info->tw2;
+    info->qcnt = m;
+    fft_cmul(info);
+
+    /* transpose lanes into rows, pad rows shorter than S with zeroes */
+    for (i = 0; i < S; i++)
+    {
+        for (k = 0; k < v * S; k++)
+        {
+            d = y + ((rt_size)i * v + k / S) * 2 * S + k % S;
+
+            if (k < m)
+            {
+                s = x + (rt_size)k * 2 * S + i;
+                d[0] = s[0];
+                d[S] = s[S];
+            }
+            else
+            {
+                d[0] = 0;
+                d[S] = 0;
+            }
+        }
+    }
+
+    return fft_stgs(info, y, x, S, v, info->tw3);
+}
+
+/*
+ * Return pointer to real part of point k in the result of fft_core,
+ * imaginary part follows at offset S.
+ */
+static
+rt_real *fft_rpos(rt_SIMD_FFTS *info, rt_real *r, rt_si32 k)
+{
+    rt_si32 m = info->mcnt, c = k % m;
+
+    return r + ((rt_size)(k / m) * info->vcnt + c / S) * 2 * S + c % S;
+}
+
+/*
+ * Forward complex transform of n points from (xre, xim) into (yre, yim),
+ * arrays don't need to be SIMD-aligned and input can be overwritten.
+ */
+static
+rt_void fft_fwd(rt_SIMD_FFTS *info,
+                rt_real *xre, rt_real *xim, rt_real *yre, rt_real *yim)
+{
+    rt_si32 k, n = info->size;
+    rt_real *d, *r;
+
+    for (k = 0; k < n; k++)
+    {
+        d = info->buf0 + (rt_size)(k / S) * 2 * S + k % S;
+        d[0] = xre[k];
+        d[S] = xim[k];
+    }
+
+    r = fft_core(info);
+
+    for (k = 0; k < n; k++)
+    {
+        d = fft_rpos(info, r, k);
+        yre[k] = d[0];
+        yim[k] = d[S];
+    }
+}
+
+/*
+ * Inverse complex transform (not scaled by 1 / n), which is the forward
+ * transform with real and imaginary parts swapped on input and output.
+ */
+static
+rt_void fft_inv(rt_SIMD_FFTS *info,
+                rt_real *xre, rt_real *xim, rt_real *yre, rt_real *yim)
+{
+    fft_fwd(info, xim, xre, yim, yre);
+}
+
+/*
+ * Forward real transform of 2 * n samples x into n + 1 bins (yre, yim),
+ * even and odd samples are transformed as one complex sequence z,
+ * then separated: X[k] = E[k] + w^k O[k], where w = exp(-j pi / n).
+ */
+static
+rt_void fft_rfwd(rt_SIMD_FFTS *info, rt_real *x, rt_real *yre, rt_real *yim)
+{
+    rt_si32 k, n = info->size;
+    rt_real *d, *e, *r, *w;
+    rt_real er, ei, orr, ori;
+
+    for (k = 0; k < n; k++)
+    {
+        d = info->buf0 + (rt_size)(k / S) * 2 * S + k % S;
+        d[0] = x[2 * k + 0];
+        d[S] = x[2 * k + 1];
+    }
+
+    r = fft_core(info);
+
+    for (k = 0, w = info->twr; k <= n; k++, w += 2)
+    {
+        d = fft_rpos(info, r, k % n);
+        e = fft_rpos(info, r, (n - k) % n);
+
+        er  = (d[0] + e[0]) * (rt_real)0.5;
+        ei  = (d[S] - e[S]) * (rt_real)0.5;
+        orr = (d[S] + e[S]) * (rt_real)0.5;
+        ori = (e[0] - d[0]) * (rt_real)0.5;
+
+        yre[k] = er + w[0] * orr - w[1] * ori;
+        yim[k] = ei + w[0] * ori + w[1] * orr;
+    }
+}
+
+/*
+ * Inverse real transform of n + 1 bins (xre, xim) into 2 * n samples y
+ * (not scaled by 1 / (2 * n)), imaginary parts of bins 0 and n
+ * must be zero, bins are combined into n points of complex sequence z,
+ * which is transformed inversely, then split into even and odd samples.
+ */
+static
+rt_void fft_rinv(rt_SIMD_FFTS *info, rt_real *xre, rt_real *xim, rt_real *y)
+{
+    rt_si32 k, n = info->size;
+    rt_real *d, *r, *w;
+    rt_real er, ei, dr, di, orr, ori;
+
+    /* combined points are stored with real and imaginary parts swapped,
+     * so that forward transform computes the inverse one */
+    for (k = 0, w = info->twr; k < n; k++, w += 2)
+    {
+        er = xre[k] + xre[n - k];
+        ei = xim[k] - xim[n - k];
+        dr = xre[k] - xre[n - k];
+        di = xim[k] + xim[n - k];
+
+        orr = dr * w[0] + di * w[1];
+        ori = di * w[0] - dr * w[1];
+
+        d = info->buf0 + (rt_size)(k / S) * 2 * S + k % S;
+        d[0] = ei + orr;
+        d[S] = er - ori;
+    }
+
+    r = fft_core(info);
+
+    for (k = 0; k < n; k++)
+    {
+        d = fft_rpos(info, r, k);
+        y[2 * k + 0] = d[S];
+        y[2 * k + 1] = d[0];
+    }
+}
+
+#endif /* RT_RTFFTS_H */
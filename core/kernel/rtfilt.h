@@ -0,0 +1,528 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2023 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTFILT_H
+#define RT_RTFILT_H
+
+#include "rtbase.h"
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rtfilt.h: streaming FIR and biquad cascade filters in cmdo* subset.
+ * Table of contents is provided below.
+ *
+ * Both filters work with rt_fp32 samples regardless of RT_ELEMENT and keep
+ * their state (delay lines) in caller-provided work area between calls,
+ * thus streams can be processed in chunks of any size without reallocation.
+ * Chunks are split internally into blocks of at most RT_FILT_BLOCK samples
+ * (frames), input and output pointers don't need to be SIMD-aligned
+ * and may point to the same buffer (in-place processing).
+ *
+ * FIR (fir_run) computes R consecutive outputs per SIMD register
+ * with coefficients broadcast to R lanes at fir_init, the inner loop keeps
+ * four output registers in flight per broadcast coefficient.
+ * SIMD ISA has no unaligned loads or lane shifts by design, therefore
+ * the delay line is kept as R copies shifted by one sample each, so that
+ * every input window lands on SIMD-aligned address in one of the copies.
+ * Taps are padded with zeroes to multiple of R and reordered accordingly.
+ *
+ * Biquad cascade (bqd_run) runs SPMD across channels: each lane processes
+ * its own channel through the same sequence of stages (transposed direct
+ * form II), while coefficients can differ per channel and stage.
+ * Interleaved frames are packed into groups of R channels per block,
+ * then each stage sweeps the whole block keeping its state in registers.
+ */
+
+/*----------------------------------------------------------------------------*/
+
+/*************************   SIMD BACKEND STRUCTURES   ************************/
+
+/*************************   FIR FILTER   *************************************/
+
+/*************************   BIQUAD CASCADE   *********************************/
+
+/*----------------------------------------------------------------------------*/
+
+/* max number of samples (frames) per kernel call, multiple of R */
+#ifndef RT_FILT_BLOCK
+#define RT_FILT_BLOCK       1024
+#endif /* RT_FILT_BLOCK */
+
+/******************************************************************************/
+/*************************   SIMD BACKEND STRUCTURES   ************************/
+/******************************************************************************/
+
+/*
+ * SIMD FIR structure for ASM_ENTER/ASM_LEAVE contains kernel parameters
+ * set by fir_run and filter parameters set by fir_init,
+ * must be initialized with ASM_INIT before use.
+ * Note that DP offsets below start where rt_SIMD_INFO ends (at Q*0x100).
+ * SIMD width is taken into account via R and Q from rtbase.h
+ * Structure is read-write in backend.
+ */
+struct rt_SIMD_FIRF : public rt_SIMD_INFO
+{
+    /* kernel parameters (set by fir_run) */
+
+    rt_fp32*coef;           /* broadcast coefficients, grouped by shift */
+#define fir_COEF            DP(Q*0x100+0x000*P+E)
+
+    rt_fp32*dlin;           /* 1st delay-line copy at block start */
+#define fir_DLIN            DP(Q*0x100+0x004*P+E)
+
+    rt_fp32*yblk;           /* SIMD-aligned output block */
+#define fir_YBLK            DP(Q*0x100+0x008*P+E)
+
+    rt_cell cstr;           /* stride of delay-line copies in bytes */
+#define fir_CSTR            DP(Q*0x100+0x00C*P+E)
+
+    rt_si32 ncnt;           /* number of output registers in block */
+#define fir_NCNT            DP(Q*0x100+0x010*P+0x000)
+
+    rt_si32 tcnt;           /* number of padded taps divided by R */
+#define fir_TCNT            DP(Q*0x100+0x010*P+0x004)
+
+    rt_si32 icnt;           /* internal, output register counter */
+#define fir_ICNT            DP(Q*0x100+0x010*P+0x008)
+
+    rt_si32 jcnt;           /* internal, delay-line copy counter */
+#define fir_JCNT            DP(Q*0x100+0x010*P+0x00C)
+
+    /* filter parameters (C/C++ only) */
+
+    rt_fp32*work;           /* SIMD-aligned work area of fir_work bytes */
+
+    rt_si32 taps;           /* number of taps (padded to multiple of R) */
+    rt_si32 dlen;           /* length of each delay-line copy */
+
+};
+
+/*
+ * SIMD biquad structure for ASM_ENTER/ASM_LEAVE contains kernel parameters
+ * set by bqd_run and cascade parameters set by bqd_init,
+ * must be initialized with ASM_INIT before use.
+ * Note that DP offsets below start where rt_SIMD_INFO ends (at Q*0x100).
+ * SIMD width is taken into account via R and Q from rtbase.h
+ * Structure is read-write in backend.
+ */
+struct rt_SIMD_BIQD : public rt_SIMD_INFO
+{
+    /* kernel parameters (set by bqd_run) */
+
+    rt_fp32*coef;           /* coefficients of channel group (5 per stage) */
+#define bqd_COEF            DP(Q*0x100+0x000*P+E)
+
+    rt_fp32*stat;           /* state of channel group (2 per stage) */
+#define bqd_STAT            DP(Q*0x100+0x004*P+E)
+
+    rt_fp32*fblk;           /* channel group in packed frame block */
+#define bqd_FBLK            DP(Q*0x100+0x008*P+E)
+
+    rt_cell fstr;           /* stride of packed frames in bytes */
+#define bqd_FSTR            DP(Q*0x100+0x00C*P+E)
+
+    rt_si32 ncnt;           /* number of frames in block */
+#define bqd_NCNT            DP(Q*0x100+0x010*P+0x000)
+
+    rt_si32 scnt;           /* number of stages */
+#define bqd_SCNT            DP(Q*0x100+0x010*P+0x004)
+
+    rt_si32 jcnt;           /* internal, stage counter */
+#define bqd_JCNT            DP(Q*0x100+0x010*P+0x008)
+
+    /* cascade parameters (C/C++ only) */
+
+    rt_fp32*work;           /* SIMD-aligned work area of bqd_work bytes */
+
+    rt_si32 chns;           /* number of interleaved channels */
+    rt_si32 grps;           /* number of channel groups of R */
+    rt_si32 stgs;           /* number of stages */
+
+};
+
+/******************************************************************************/
+/*************************   FIR FILTER   *************************************/
+/******************************************************************************/
+
+/* fir_kern (yblk = coef * dlin)
+ * reads: coef, dlin, yblk, cstr, ncnt, tcnt, destroys icnt, jcnt
+ * for each R-shifted delay-line copy accumulates its taps into four
+ * (then one) output registers, coefficients are loaded once per tap */
+
+static
+rt_void fir_kern(rt_SIMD_FIRF *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Rebx, Mebp, fir_DLIN)
+        movxx_ld(Redx, Mebp, fir_YBLK)
+        movwx_ld(Reax, Mebp, fir_NCNT)
+        movwx_st(Reax, Mebp, fir_ICNT)
+
+    LBL(100800) /* fir_quad */
+
+        cmjwx_mi(Mebp, fir_ICNT, IB(4),
+        /* if */ LT_x, 100803f) /* fir_simd */
+
+        xorox_rr(Xmm1, Xmm1)
+        xorox_rr(Xmm2, Xmm2)
+        xorox_rr(Xmm3, Xmm3)
+        xorox_rr(Xmm4, Xmm4)
+        movxx_ld(Redi, Mebp, fir_COEF)
+        movxx_rr(Resi, Rebx)
+        movwx_mi(Mebp, fir_JCNT, IM(R))
+
+    LBL(100801) /* fir_qcpy */
+
+        movxx_rr(Recx, Resi)
+        movwx_ld(Reax, Mebp, fir_TCNT)
+
+    LBL(100802) /* fir_qtap */
+
+        movox_ld(Xmm0, Medi, DP(Q*0x000))
+        fmaos_ld(Xmm1, Xmm0, Mecx, DP(Q*0x000))
+        fmaos_ld(Xmm2, Xmm0, Mecx, DP(Q*0x010))
+        fmaos_ld(Xmm3, Xmm0, Mecx, DP(Q*0x020))
+        fmaos_ld(Xmm4, Xmm0, Mecx, DP(Q*0x030))
+
+        addxx_ri(Redi, IM(Q*0x010))
+        addxx_ri(Recx, IM(Q*0x010))
+        arjwx_ri(Reax, IB(1),
+        sub_x, NZ_x, 100802b) /* fir_qtap */
+
+        addxx_ld(Resi, Mebp, fir_CSTR)
+        arjwx_mi(Mebp, fir_JCNT, IB(1),
+        sub_x, NZ_x, 100801b) /* fir_qcpy */
+
+        movox_st(Xmm1, Medx, DP(Q*0x000))
+        movox_st(Xmm2, Medx, DP(Q*0x010))
+        movox_st(Xmm3, Medx, DP(Q*0x020))
+        movox_st(Xmm4, Medx, DP(Q*0x030))
+
+        addxx_ri(Rebx, IM(Q*0x040))
+        addxx_ri(Redx, IM(Q*0x040))
+        subwx_mi(Mebp, fir_ICNT, IB(4))
+        jmpxx_lb(100800b) /* fir_quad */
+
+    LBL(100803) /* fir_simd */
+
+        cmjwx_mz(Mebp, fir_ICNT,
+        /* if */ EQ_x, 100806f) /* fir_done */
+
+        xorox_rr(Xmm1, Xmm1)
+        movxx_ld(Redi, Mebp, fir_COEF)
+        movxx_rr(Resi, Rebx)
+        movwx_mi(Mebp, fir_JCNT, IM(R))
+
+    LBL(100804) /* fir_scpy */
+
+        movxx_rr(Recx, Resi)
+        movwx_ld(Reax, Mebp, fir_TCNT)
+
+    LBL(100805) /* fir_stap */
+
+        movox_ld(Xmm0, Medi, DP(Q*0x000))
+        fmaos_ld(Xmm1, Xmm0, Mecx, DP(Q*0x000))
+
+        addxx_ri(Redi, IM(Q*0x010))
+        addxx_ri(Recx, IM(Q*0x010))
+        arjwx_ri(Reax, IB(1),
+        sub_x, NZ_x, 100805b) /* fir_stap */
+
+        addxx_ld(Resi, Mebp, fir_CSTR)
+        arjwx_mi(Mebp, fir_JCNT, IB(1),
+        sub_x, NZ_x, 100804b) /* fir_scpy */
+
+        movox_st(Xmm1, Medx, DP(Q*0x000))
+
+        addxx_ri(Rebx, IM(Q*0x010))
+        addxx_ri(Redx, IM(Q*0x010))
+        subwx_mi(Mebp, fir_ICNT, IB(1))
+        jmpxx_lb(100803b) /* fir_simd */
+
+    LBL(100806) /* fir_done */
+
+    ASM_LEAVE(info)
+}
+
+/*
+ * Return size of the work area in bytes required by fir_init/fir_run
+ * for given number of taps, the work area itself
+ * must be SIMD-aligned (to RT_SIMD_ALIGN) and set to info->work.
+ */
+static
+rt_size fir_work(rt_si32 taps)
+{
+    rt_si32 tp = (RT_MAX(taps, 1) + R - 1) / R * R;
+
+    return ((rt_size)tp * R
+          + (rt_size)(tp + RT_FILT_BLOCK) * R
+          + (rt_size)RT_FILT_BLOCK) * sizeof(rt_fp32);
+}
+
+/*
+ * Set coefficients h[0..taps-1] (h[0] applies to the newest sample)
+ * and clear the delay line, info->work must point to SIMD-aligned area
+ * of fir_work(taps) bytes. Can be called again to restart the stream.
+ * Structure must be initialized with ASM_INIT before the first use.
+ */
+static
+rt_void fir_init(rt_SIMD_FIRF *info, rt_si32 taps, rt_fp32 *h)
+{
+    rt_si32 i, k, q, r, tp = (RT_MAX(taps, 1) + R - 1) / R * R;
+
+    info->taps = tp;
+    info->dlen = tp + RT_FILT_BLOCK;
+
+    info->coef = info->work;
+    info->dlin = info->coef + (rt_cell)tp * R;
+    info->yblk = info->dlin + (rt_cell)info->dlen * R;
+    info->cstr = (rt_cell)info->dlen * sizeof(rt_fp32);
+    info->tcnt = tp / R;
+
+    /* window at offset d = q * R + r is aligned in r-th copy,
+     * where it meets tap k = tp - 1 - d */
+    for (r = 0; r < R; r++)
+    {
+        for (q = 0; q < tp / R; q++)
+        {
+            rt_fp32 *c = info->coef + ((rt_cell)r * (tp / R) + q) * R;
+
+            k = tp - 1 - (q * R + r);
+
+            for (i = 0; i < R; i++)
+            {
+                c[i] = k < taps ? h[k] : 0.0f;
+            }
+        }
+    }
+
+    for (i = 0; i < info->dlen * R; i++)
+    {
+        info->dlin[i] = 0.0f;
+    }
+}
+
+/*
+ * Filter n samples from x into y continuing the stream from previous calls,
+ * x and y can be the same buffer, neither needs to be SIMD-aligned.
+ */
+static
+rt_void fir_run(rt_SIMD_FIRF *info, rt_fp32 *x, rt_fp32 *y, rt_si32 n)
+{
+    rt_si32 i, m, r, tp = info->taps;
+    rt_fp32 *dlin = info->dlin, *d;
+
+    for (; n > 0; n -= m, x += m, y += m)
+    {
+        m = RT_MIN(n, RT_FILT_BLOCK);
+
+        /* r-th copy holds the delay line shifted by r samples */
+        for (r = 0, d = dlin; r < R; r++, d += info->dlen)
+        {
+            for (i = 0; i < m; i++)
+            {
+                d[tp - 1 - r + i] = x[i];
+            }
+        }
+
+        info->dlin = dlin;
+        info->ncnt = (m + R - 1) / R;
+        fir_kern(info);
+
+        for (i = 0; i < m; i++)
+        {
+            y[i] = info->yblk[i];
+        }
+
+        for (r = 0, d = dlin; r < R; r++, d += info->dlen)
+        {
+            for (i = 0; i < tp - 1 - r; i++)
+            {
+                d[i] = d[i + m];
+            }
+        }
+    }
+
+    info->dlin = dlin;
+}
+
+/******************************************************************************/
+/*************************   BIQUAD CASCADE   *********************************/
+/******************************************************************************/
+
+/* bqd_kern (fblk = cascade(fblk))
+ * reads: coef, stat, fblk, fstr, ncnt, scnt, writes: stat, destroys jcnt
+ * coefficients per stage are b0, b1, b2, a1, a2 (a0 = 1), each stage
+ * sweeps the block in place with its state z1, z2 kept in registers:
+ * y = b0 * x + z1, z1 = b1 * x - a1 * y + z2, z2 = b2 * x - a2 * y */
+
+static
+rt_void bqd_kern(rt_SIMD_BIQD *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Redi, Mebp, bqd_COEF)
+        movxx_ld(Rebx, Mebp, bqd_STAT)
+        movwx_ld(Reax, Mebp, bqd_SCNT)
+        movwx_st(Reax, Mebp, bqd_JCNT)
+
+    LBL(100810) /* bqd_stge */
+
+        movox_ld(Xmm1, Mebx, DP(Q*0x000))
+        movox_ld(Xmm2, Mebx, DP(Q*0x010))
+        movxx_ld(Resi, Mebp, bqd_FBLK)
+        movwx_ld(Recx, Mebp, bqd_NCNT)
+
+    LBL(100811) /* bqd_frme */
+
+        movox_ld(Xmm3, Mesi, DP(Q*0x000))
+        movox_rr(Xmm4, Xmm1)
+        fmaos_ld(Xmm4, Xmm3, Medi, DP(Q*0x000))
+        movox_rr(Xmm1, Xmm2)
+        fmaos_ld(Xmm1, Xmm3, Medi, DP(Q*0x010))
+        fmsos_ld(Xmm1, Xmm4, Medi, DP(Q*0x030))
+        movox_rr(Xmm2, Xmm3)
+        mulos_ld(Xmm2, Medi, DP(Q*0x020))
+        fmsos_ld(Xmm2, Xmm4, Medi, DP(Q*0x040))
+        movox_st(Xmm4, Mesi, DP(Q*0x000))
+
+        addxx_ld(Resi, Mebp, bqd_FSTR)
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 100811b) /* bqd_frme */
+
+        movox_st(Xmm1, Mebx, DP(Q*0x000))
+        movox_st(Xmm2, Mebx, DP(Q*0x010))
+
+        addxx_ri(Redi, IM(Q*0x050))
+        addxx_ri(Rebx, IM(Q*0x020))
+        arjwx_mi(Mebp, bqd_JCNT, IB(1),
+        sub_x, NZ_x, 100810b) /* bqd_stge */
+
+    ASM_LEAVE(info)
+}
+
+/*
+ * Return size of the work area in bytes required by bqd_init/bqd_run
+ * for given number of channels and stages, the work area itself
+ * must be SIMD-aligned (to RT_SIMD_ALIGN) and set to info->work.
+ */
+static
+rt_size bqd_work(rt_si32 chns, rt_si32 stgs)
+{
+    rt_si32 gp = (RT_MAX(chns, 1) + R - 1) / R;
+
+    return ((rt_size)gp * RT_MAX(stgs, 1) * 7 * R
+          + (rt_size)gp * RT_FILT_BLOCK * R) * sizeof(rt_fp32);
+}
+
+/*
+ * Set coefficients of given stage for given channel (or all channels
+ * if chn is negative), c[] holds b0, b1, b2, a1, a2 normalized to a0 = 1.
+ */
+static
+rt_void bqd_set(rt_SIMD_BIQD *info, rt_si32 chn, rt_si32 stg, rt_fp32 *c)
+{
+    rt_si32 i, k;
+
+    for (i = 0; i < info->chns; i++)
+    {
+        if (chn >= 0 && chn != i)
+        {
+            continue;
+        }
+
+        rt_fp32 *p = info->work + ((rt_cell)(i / R) * info->stgs + stg) * 5 * R;
+
+        for (k = 0; k < 5; k++)
+        {
+            p[k * R + i % R] = c[k];
+        }
+    }
+}
+
+/*
+ * Prepare cascade of stgs stages for chns interleaved channels,
+ * all stages are set to pass-through and state is cleared,
+ * info->work must point to SIMD-aligned area of bqd_work(chns, stgs) bytes.
+ * Can be called again to restart the stream (coefficients are reset).
+ * Structure must be initialized with ASM_INIT before the first use.
+ */
+static
+rt_void bqd_init(rt_SIMD_BIQD *info, rt_si32 chns, rt_si32 stgs)
+{
+    rt_si32 i, n;
+    rt_fp32 c[5] = {1.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+
+    info->chns = chns;
+    info->grps = (RT_MAX(chns, 1) + R - 1) / R;
+    info->stgs = RT_MAX(stgs, 1);
+
+    n = info->grps * info->stgs * 7 * R + info->grps * RT_FILT_BLOCK * R;
+
+    for (i = 0; i < n; i++)
+    {
+        info->work[i] = 0.0f;
+    }
+    for (i = 0; i < info->stgs; i++)
+    {
+        bqd_set(info, -1, i, c);
+    }
+
+    info->scnt = info->stgs;
+    info->fstr = (rt_cell)info->grps * R * sizeof(rt_fp32);
+}
+
+/*
+ * Filter n frames of interleaved channels from x into y continuing
+ * the stream from previous calls, x and y can be the same buffer,
+ * neither needs to be SIMD-aligned.
+ */
+static
+rt_void bqd_run(rt_SIMD_BIQD *info, rt_fp32 *x, rt_fp32 *y, rt_si32 n)
+{
+    rt_si32 c, g, i, m, w = info->grps * R, nc = info->chns;
+
+    rt_fp32 *coef = info->work;
+    rt_fp32 *stat = coef + (rt_cell)info->grps * info->stgs * 5 * R;
+    rt_fp32 *fbuf = stat + (rt_cell)info->grps * info->stgs * 2 * R;
+
+    for (; n > 0; n -= m, x += (rt_cell)m * nc, y += (rt_cell)m * nc)
+    {
+        m = RT_MIN(n, RT_FILT_BLOCK);
+
+        for (i = 0; i < m; i++)
+        {
+            for (c = 0; c < nc; c++)
+            {
+                fbuf[(rt_cell)i * w + c] = x[(rt_cell)i * nc + c];
+            }
+        }
+
+        info->ncnt = m;
+
+        for (g = 0; g < info->grps; g++)
+        {
+            info->coef = coef + (rt_cell)g * info->stgs * 5 * R;
+            info->stat = stat + (rt_cell)g * info->stgs * 2 * R;
+            info->fblk = fbuf + (rt_cell)g * R;
+            bqd_kern(info);
+        }
+
+        for (i = 0; i < m; i++)
+        {
+            for (c = 0; c < nc; c++)
+            {
+                y[(rt_cell)i * nc + c] = fbuf[(rt_cell)i * w + c];
+            }
+        }
+    }
+}
+
+#endif /* RT_RTFILT_H */
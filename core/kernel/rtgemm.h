@@ -0,0 +1,622 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2023 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTGEMM_H
+#define RT_RTGEMM_H
+
+#include "rtbase.h"
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rtgemm.h: general matrix multiply (GEMM) in configurable cmdp* subset.
+ * Table of contents is provided below.
+ *
+ * C = alpha * A * B + beta * C is computed for row-major matrices of rt_real
+ * elements, thus SGEMM or DGEMM is chosen by RT_ELEMENT (fmaps maps to fmaos
+ * or fmaqs respectively), leading dimensions are given in elements.
+ *
+ * The driver (gemm_run) follows the usual three-level cache blocking:
+ * NC columns of B are packed per KC-deep slice (L3), then MC rows of A
+ * are packed per slice (L2), then the ASM macro-kernel (gemm_kern) sweeps
+ * MR x (NR*S) register tiles over packed panels, keeping NR*S-wide B-panel
+ * in L1 while MR rows of A are broadcast from packed buffer as SIMD-fields,
+ * as SIMD ISA has no broadcast/shuffle instructions by design.
+ *
+ * Register tile MR x NR (in SIMD registers) is chosen from RT_SIMD_REGS,
+ * which is what pair/quad targets (128x2, 256x2, 512x2, 512x4) expose,
+ * cache blocking is derived from SIMD width Q and overridable below.
+ * Packing pads panels with zeroes, while C is accumulated in a padded
+ * SIMD-aligned copy, so that any sizes and leading dimensions are accepted.
+ * On x86 targets without native FMA (SSE, AVX1) register tile is updated
+ * with mulps_** and addps_** by default (RT_GEMM_FMA), as full-precision
+ * fmaps_** fallback would make it slower than scalar code there.
+ */
+
+/*----------------------------------------------------------------------------*/
+
+/*************************   BLOCKING PARAMETERS   ****************************/
+
+/*************************   SIMD BACKEND STRUCTURE   *************************/
+
+/*************************   GEMM MACRO-KERNEL   ******************************/
+
+/*************************   GEMM DRIVER   ************************************/
+
+/*----------------------------------------------------------------------------*/
+
+/******************************************************************************/
+/*************************   BLOCKING PARAMETERS   ****************************/
+/******************************************************************************/
+
+/* register tile: MR rows (broadcast A), NR SIMD registers (B),
+ * uses MR*NR accumulators plus one register for A-broadcast
+ * and one temporary for mul + add (RT_GEMM_FMA == 0) */
+#if   RT_SIMD_REGS >= 32
+#define RT_GEMM_MR          4
+#define RT_GEMM_NR          6
+#elif RT_SIMD_REGS >= 16
+#define RT_GEMM_MR          3
+#define RT_GEMM_NR          4
+#else  /* RT_SIMD_REGS == 8 */
+#define RT_GEMM_MR          2
+#define RT_GEMM_NR          3
+#endif /* RT_SIMD_REGS */
+
+/* RT_GEMM_FMA selects fmaps_** for register tile update,
+ * default is mulps_** + addps_** on x86 targets without native fma (SSE, AVX1),
+ * where fmaps_** fallback is slow, and fmaps_** elsewhere */
+#ifndef RT_GEMM_FMA
+#if (defined RT_X32 || defined RT_X64) && !(RT_256X1 >= 2 || RT_128X1 == 16)
+#define RT_GEMM_FMA         0
+#else /* native fma */
+#define RT_GEMM_FMA         1
+#endif /* native fma */
+#endif /* RT_GEMM_FMA */
+
+/* cache budgets in bytes for packed B-panel (L1), A-block (L2), B-block (L3)
+ * can be overridden from makefiles to match particular hardware */
+#ifndef RT_GEMM_L1
+#define RT_GEMM_L1          (24*1024)
+#endif /* RT_GEMM_L1 */
+
+#ifndef RT_GEMM_L2
+#define RT_GEMM_L2          (256*1024)
+#endif /* RT_GEMM_L2 */
+
+#ifndef RT_GEMM_L3
+#define RT_GEMM_L3          (2*1024*1024)
+#endif /* RT_GEMM_L3 */
+
+/* KC: depth of packed slices, B-panel (KC x NR*S) fits RT_GEMM_L1 */
+#define RT_GEMM_KC          RT_MAX(RT_GEMM_L1/(RT_GEMM_NR*Q*16), 16)
+
+/* MC: rows of A-block (MC x KC broadcast to S), fits RT_GEMM_L2 */
+#define RT_GEMM_MC          (RT_MAX(RT_GEMM_L2/(RT_GEMM_KC*Q*16),           \
+                             RT_GEMM_MR) / RT_GEMM_MR * RT_GEMM_MR)
+
+/* NC: columns of B-block (KC x NC), fits RT_GEMM_L3 */
+#define RT_GEMM_NC          (RT_MAX(RT_GEMM_L3/(RT_GEMM_KC*L*4),            \
+                             RT_GEMM_NR*S) / (RT_GEMM_NR*S) * (RT_GEMM_NR*S))
+
+/******************************************************************************/
+/*************************   SIMD BACKEND STRUCTURE   *************************/
+/******************************************************************************/
+
+/*
+ * SIMD GEMM structure for ASM_ENTER/ASM_LEAVE contains GEMM parameters
+ * set in C/C++ code and macro-kernel parameters set by gemm_run,
+ * must be initialized with ASM_INIT before use.
+ * Note that DP offsets below start where rt_SIMD_INFO ends (at Q*0x100).
+ * SIMD width is taken into account via S and Q from rtbase.h
+ * Structure is read-write in backend.
+ */
+struct rt_SIMD_GEMM : public rt_SIMD_INFO
+{
+    /* macro-kernel parameters (set by gemm_run) */
+
+    rt_real*apck;           /* packed A-block, MR rows broadcast to S */
+#define gmm_APCK            DP(Q*0x100+0x000*P+E)
+
+    rt_real*bpck;           /* packed B-block, NR*S columns per panel */
+#define gmm_BPCK            DP(Q*0x100+0x004*P+E)
+
+    rt_real*cblk;           /* top-left of C-block in padded C-copy */
+#define gmm_CBLK            DP(Q*0x100+0x008*P+E)
+
+    rt_cell ldwc;           /* row stride of padded C-copy in bytes */
+#define gmm_LDWC            DP(Q*0x100+0x00C*P+E)
+
+    rt_cell bstp;           /* stride of packed B-panels in bytes */
+#define gmm_BSTP            DP(Q*0x100+0x010*P+E)
+
+    rt_si32 kcnt;           /* depth of packed slice */
+#define gmm_KCNT            DP(Q*0x100+0x014*P+0x000)
+
+    rt_si32 mcnt;           /* number of MR-row panels in A-block */
+#define gmm_MCNT            DP(Q*0x100+0x014*P+0x004)
+
+    rt_si32 ncnt;           /* number of NR*S-col panels in B-block */
+#define gmm_NCNT            DP(Q*0x100+0x014*P+0x008)
+
+    rt_si32 icnt;           /* internal, A-panel counter */
+#define gmm_ICNT            DP(Q*0x100+0x014*P+0x00C)
+
+    rt_si32 jcnt;           /* internal, B-panel counter */
+#define gmm_JCNT            DP(Q*0x100+0x014*P+0x010)
+
+    /* GEMM parameters (C/C++ only) */
+
+    rt_real*a;              /* matrix A (m x k) */
+    rt_real*b;              /* matrix B (k x n) */
+    rt_real*c;              /* matrix C (m x n) */
+    rt_real*work;           /* SIMD-aligned work area of gemm_work bytes */
+
+    rt_si32 m, n, k;        /* matrix dimensions */
+    rt_si32 lda, ldb, ldc;  /* leading dimensions (in elements) */
+
+    rt_real alpha;          /* scalar multiplier for A * B */
+    rt_real beta;           /* scalar multiplier for C */
+
+};
+
+/******************************************************************************/
+/*************************   GEMM MACRO-KERNEL   ******************************/
+/******************************************************************************/
+
+/* register tile update (XD += XS * [MS + DS]), XT is temporary */
+
+#if RT_GEMM_FMA != 0
+
+#define gmm_FMA(XD, XS, XT, MS, DS)                                         \
+        fmaps_ld(W(XD), W(XS), W(MS), W(DS))
+
+#else  /* RT_GEMM_FMA */
+
+#define gmm_FMA(XD, XS, XT, MS, DS)                                         \
+        movpx_ld(W(XT), W(MS), W(DS))                                       \
+        mulps_rr(W(XT), W(XS))                                              \
+        addps_rr(W(XD), W(XT))
+
+#endif /* RT_GEMM_FMA */
+
+/* gemm_kern (cblk += apck * bpck)
+ * reads: apck, bpck, cblk, ldwc, bstp, kcnt, mcnt, ncnt
+ * for each NR*S-wide B-panel and each MR-row A-panel runs register tile
+ * over kcnt depth, then adds the tile to the padded C-copy */
+
+static
+rt_void gemm_kern(rt_SIMD_GEMM *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, gmm_BPCK)
+        movxx_ld(Redx, Mebp, gmm_CBLK)
+        movwx_ld(Reax, Mebp, gmm_NCNT)
+        movwx_st(Reax, Mebp, gmm_JCNT)
+
+    LBL(100600) /* gmm_jpan */
+
+        movxx_ld(Rebx, Mebp, gmm_APCK)
+        movxx_rr(Redi, Redx)
+        movwx_ld(Reax, Mebp, gmm_MCNT)
+        movwx_st(Reax, Mebp, gmm_ICNT)
+
+    LBL(100601) /* gmm_ipan */
+
+        movxx_rr(Recx, Resi)
+        movwx_ld(Reax, Mebp, gmm_KCNT)
+
+#if   RT_GEMM_MR == 4 && RT_GEMM_NR == 6
+
+        xorpx_rr(Xmm0, Xmm0)
+        xorpx_rr(Xmm1, Xmm1)
+        xorpx_rr(Xmm2, Xmm2)
+        xorpx_rr(Xmm3, Xmm3)
+        xorpx_rr(Xmm4, Xmm4)
+        xorpx_rr(Xmm5, Xmm5)
+        xorpx_rr(Xmm6, Xmm6)
+        xorpx_rr(Xmm7, Xmm7)
+        xorpx_rr(Xmm8, Xmm8)
+        xorpx_rr(Xmm9, Xmm9)
+        xorpx_rr(XmmA, XmmA)
+        xorpx_rr(XmmB, XmmB)
+        xorpx_rr(XmmC, XmmC)
+        xorpx_rr(XmmD, XmmD)
+        xorpx_rr(XmmE, XmmE)
+        xorpx_rr(XmmF, XmmF)
+        xorpx_rr(XmmG, XmmG)
+        xorpx_rr(XmmH, XmmH)
+        xorpx_rr(XmmI, XmmI)
+        xorpx_rr(XmmJ, XmmJ)
+        xorpx_rr(XmmK, XmmK)
+        xorpx_rr(XmmL, XmmL)
+        xorpx_rr(XmmM, XmmM)
+        xorpx_rr(XmmN, XmmN)
+
+    LBL(100602) /* gmm_kdep */
+
+        movpx_ld(XmmO, Mebx, DP(Q*0x000))
+        gmm_FMA(Xmm0, XmmO, XmmP, Mecx, DP(Q*0x000))
+        gmm_FMA(Xmm1, XmmO, XmmP, Mecx, DP(Q*0x010))
+        gmm_FMA(Xmm2, XmmO, XmmP, Mecx, DP(Q*0x020))
+        gmm_FMA(Xmm3, XmmO, XmmP, Mecx, DP(Q*0x030))
+        gmm_FMA(Xmm4, XmmO, XmmP, Mecx, DP(Q*0x040))
+        gmm_FMA(Xmm5, XmmO, XmmP, Mecx, DP(Q*0x050))
+        movpx_ld(XmmO, Mebx, DP(Q*0x010))
+        gmm_FMA(Xmm6, XmmO, XmmP, Mecx, DP(Q*0x000))
+        gmm_FMA(Xmm7, XmmO, XmmP, Mecx, DP(Q*0x010))
+        gmm_FMA(Xmm8, XmmO, XmmP, Mecx, DP(Q*0x020))
+        gmm_FMA(Xmm9, XmmO, XmmP, Mecx, DP(Q*0x030))
+        gmm_FMA(XmmA, XmmO, XmmP, Mecx, DP(Q*0x040))
+        gmm_FMA(XmmB, XmmO, XmmP, Mecx, DP(Q*0x050))
+        movpx_ld(XmmO, Mebx, DP(Q*0x020))
+        gmm_FMA(XmmC, XmmO, XmmP, Mecx, DP(Q*0x000))
+        gmm_FMA(XmmD, XmmO, XmmP, Mecx, DP(Q*0x010))
+        gmm_FMA(XmmE, XmmO, XmmP, Mecx, DP(Q*0x020))
+        gmm_FMA(XmmF, XmmO, XmmP, Mecx, DP(Q*0x030))
+        gmm_FMA(XmmG, XmmO, XmmP, Mecx, DP(Q*0x040))
+        gmm_FMA(XmmH, XmmO, XmmP, Mecx, DP(Q*0x050))
+        movpx_ld(XmmO, Mebx, DP(Q*0x030))
+        gmm_FMA(XmmI, XmmO, XmmP, Mecx, DP(Q*0x000))
+        gmm_FMA(XmmJ, XmmO, XmmP, Mecx, DP(Q*0x010))
+        gmm_FMA(XmmK, XmmO, XmmP, Mecx, DP(Q*0x020))
+        gmm_FMA(XmmL, XmmO, XmmP, Mecx, DP(Q*0x030))
+        gmm_FMA(XmmM, XmmO, XmmP, Mecx, DP(Q*0x040))
+        gmm_FMA(XmmN, XmmO, XmmP, Mecx, DP(Q*0x050))
+
+        addxx_ri(Recx, IM(Q*0x060))
+        addxx_ri(Rebx, IM(Q*0x040))
+        arjwx_ri(Reax, IB(1),
+        sub_x, NZ_x, 100602b) /* gmm_kdep */
+
+        movxx_rr(Recx, Redi)
+        addps_ld(Xmm0, Mecx, DP(Q*0x000))
+        addps_ld(Xmm1, Mecx, DP(Q*0x010))
+        addps_ld(Xmm2, Mecx, DP(Q*0x020))
+        addps_ld(Xmm3, Mecx, DP(Q*0x030))
+        addps_ld(Xmm4, Mecx, DP(Q*0x040))
+        addps_ld(Xmm5, Mecx, DP(Q*0x050))
+        movpx_st(Xmm0, Mecx, DP(Q*0x000))
+        movpx_st(Xmm1, Mecx, DP(Q*0x010))
+        movpx_st(Xmm2, Mecx, DP(Q*0x020))
+        movpx_st(Xmm3, Mecx, DP(Q*0x030))
+        movpx_st(Xmm4, Mecx, DP(Q*0x040))
+        movpx_st(Xmm5, Mecx, DP(Q*0x050))
+        addxx_ld(Recx, Mebp, gmm_LDWC)
+        addps_ld(Xmm6, Mecx, DP(Q*0x000))
+        addps_ld(Xmm7, Mecx, DP(Q*0x010))
+        addps_ld(Xmm8, Mecx, DP(Q*0x020))
+        addps_ld(Xmm9, Mecx, DP(Q*0x030))
+        addps_ld(XmmA, Mecx, DP(Q*0x040))
+        addps_ld(XmmB, Mecx, DP(Q*0x050))
+        movpx_st(Xmm6, Mecx, DP(Q*0x000))
+        movpx_st(Xmm7, Mecx, DP(Q*0x010))
+        movpx_st(Xmm8, Mecx, DP(Q*0x020))
+        movpx_st(Xmm9, Mecx, DP(Q*0x030))
+        movpx_st(XmmA, Mecx, DP(Q*0x040))
+        movpx_st(XmmB, Mecx, DP(Q*0x050))
+        addxx_ld(Recx, Mebp, gmm_LDWC)
+        addps_ld(XmmC, Mecx, DP(Q*0x000))
+        addps_ld(XmmD, Mecx, DP(Q*0x010))
+        addps_ld(XmmE, Mecx, DP(Q*0x020))
+        addps_ld(XmmF, Mecx, DP(Q*0x030))
+        addps_ld(XmmG, Mecx, DP(Q*0x040))
+        addps_ld(XmmH, Mecx, DP(Q*0x050))
+        movpx_st(XmmC, Mecx, DP(Q*0x000))
+        movpx_st(XmmD, Mecx, DP(Q*0x010))
+        movpx_st(XmmE, Mecx, DP(Q*0x020))
+        movpx_st(XmmF, Mecx, DP(Q*0x030))
+        movpx_st(XmmG, Mecx, DP(Q*0x040))
+        movpx_st(XmmH, Mecx, DP(Q*0x050))
+        addxx_ld(Recx, Mebp, gmm_LDWC)
+        addps_ld(XmmI, Mecx, DP(Q*0x000))
+        addps_ld(XmmJ, Mecx, DP(Q*0x010))
+        addps_ld(XmmK, Mecx, DP(Q*0x020))
+        addps_ld(XmmL, Mecx, DP(Q*0x030))
+        addps_ld(XmmM, Mecx, DP(Q*0x040))
+        addps_ld(XmmN, Mecx, DP(Q*0x050))
+        movpx_st(XmmI, Mecx, DP(Q*0x000))
+        movpx_st(XmmJ, Mecx, DP(Q*0x010))
+        movpx_st(XmmK, Mecx, DP(Q*0x020))
+        movpx_st(XmmL, Mecx, DP(Q*0x030))
+        movpx_st(XmmM, Mecx, DP(Q*0x040))
+        movpx_st(XmmN, Mecx, DP(Q*0x050))
+        addxx_ld(Recx, Mebp, gmm_LDWC)
+
+#elif RT_GEMM_MR == 3 && RT_GEMM_NR == 4
+
+        xorpx_rr(Xmm0, Xmm0)
+        xorpx_rr(Xmm1, Xmm1)
+        xorpx_rr(Xmm2, Xmm2)
+        xorpx_rr(Xmm3, Xmm3)
+        xorpx_rr(Xmm4, Xmm4)
+        xorpx_rr(Xmm5, Xmm5)
+        xorpx_rr(Xmm6, Xmm6)
+        xorpx_rr(Xmm7, Xmm7)
+        xorpx_rr(Xmm8, Xmm8)
+        xorpx_rr(Xmm9, Xmm9)
+        xorpx_rr(XmmA, XmmA)
+        xorpx_rr(XmmB, XmmB)
+
+    LBL(100602) /* gmm_kdep */
+
+        movpx_ld(XmmC, Mebx, DP(Q*0x000))
+        gmm_FMA(Xmm0, XmmC, XmmD, Mecx, DP(Q*0x000))
+        gmm_FMA(Xmm1, XmmC, XmmD, Mecx, DP(Q*0x010))
+        gmm_FMA(Xmm2, XmmC, XmmD, Mecx, DP(Q*0x020))
+        gmm_FMA(Xmm3, XmmC, XmmD, Mecx, DP(Q*0x030))
+        movpx_ld(XmmC, Mebx, DP(Q*0x010))
+        gmm_FMA(Xmm4, XmmC, XmmD, Mecx, DP(Q*0x000))
+        gmm_FMA(Xmm5, XmmC, XmmD, Mecx, DP(Q*0x010))
+        gmm_FMA(Xmm6, XmmC, XmmD, Mecx, DP(Q*0x020))
+        gmm_FMA(Xmm7, XmmC, XmmD, Mecx, DP(Q*0x030))
+        movpx_ld(XmmC, Mebx, DP(Q*0x020))
+        gmm_FMA(Xmm8, XmmC, XmmD, Mecx, DP(Q*0x000))
+        gmm_FMA(Xmm9, XmmC, XmmD, Mecx, DP(Q*0x010))
+        gmm_FMA(XmmA, XmmC, XmmD, Mecx, DP(Q*0x020))
+        gmm_FMA(XmmB, XmmC, XmmD, Mecx, DP(Q*0x030))
+
+        addxx_ri(Recx, IM(Q*0x040))
+        addxx_ri(Rebx, IM(Q*0x030))
+        arjwx_ri(Reax, IB(1),
+        sub_x, NZ_x, 100602b) /* gmm_kdep */
+
+        movxx_rr(Recx, Redi)
+        addps_ld(Xmm0, Mecx, DP(Q*0x000))
+        addps_ld(Xmm1, Mecx, DP(Q*0x010))
+        addps_ld(Xmm2, Mecx, DP(Q*0x020))
+        addps_ld(Xmm3, Mecx, DP(Q*0x030))
+        movpx_st(Xmm0, Mecx, DP(Q*0x000))
+        movpx_st(Xmm1, Mecx, DP(Q*0x010))
+        movpx_st(Xmm2, Mecx, DP(Q*0x020))
+        movpx_st(Xmm3, Mecx, DP(Q*0x030))
+        addxx_ld(Recx, Mebp, gmm_LDWC)
+        addps_ld(Xmm4, Mecx, DP(Q*0x000))
+        addps_ld(Xmm5, Mecx, DP(Q*0x010))
+        addps_ld(Xmm6, Mecx, DP(Q*0x020))
+        addps_ld(Xmm7, Mecx, DP(Q*0x030))
+        movpx_st(Xmm4, Mecx, DP(Q*0x000))
+        movpx_st(Xmm5, Mecx, DP(Q*0x010))
+        movpx_st(Xmm6, Mecx, DP(Q*0x020))
+        movpx_st(Xmm7, Mecx, DP(Q*0x030))
+        addxx_ld(Recx, Mebp, gmm_LDWC)
+        addps_ld(Xmm8, Mecx, DP(Q*0x000))
+        addps_ld(Xmm9, Mecx, DP(Q*0x010))
+        addps_ld(XmmA, Mecx, DP(Q*0x020))
+        addps_ld(XmmB, Mecx, DP(Q*0x030))
+        movpx_st(Xmm8, Mecx, DP(Q*0x000))
+        movpx_st(Xmm9, Mecx, DP(Q*0x010))
+        movpx_st(XmmA, Mecx, DP(Q*0x020))
+        movpx_st(XmmB, Mecx, DP(Q*0x030))
+        addxx_ld(Recx, Mebp, gmm_LDWC)
+
+#elif RT_GEMM_MR == 2 && RT_GEMM_NR == 3
+
+        xorpx_rr(Xmm0, Xmm0)
+        xorpx_rr(Xmm1, Xmm1)
+        xorpx_rr(Xmm2, Xmm2)
+        xorpx_rr(Xmm3, Xmm3)
+        xorpx_rr(Xmm4, Xmm4)
+        xorpx_rr(Xmm5, Xmm5)
+
+    LBL(100602) /* gmm_kdep */
+
+        movpx_ld(Xmm6, Mebx, DP(Q*0x000))
+        gmm_FMA(Xmm0, Xmm6, Xmm7, Mecx, DP(Q*0x000))
+        gmm_FMA(Xmm1, Xmm6, Xmm7, Mecx, DP(Q*0x010))
+        gmm_FMA(Xmm2, Xmm6, Xmm7, Mecx, DP(Q*0x020))
+        movpx_ld(Xmm6, Mebx, DP(Q*0x010))
+        gmm_FMA(Xmm3, Xmm6, Xmm7, Mecx, DP(Q*0x000))
+        gmm_FMA(Xmm4, Xmm6, Xmm7, Mecx, DP(Q*0x010))
+        gmm_FMA(Xmm5, Xmm6, Xmm7, Mecx, DP(Q*0x020))
+
+        addxx_ri(Recx, IM(Q*0x030))
+        addxx_ri(Rebx, IM(Q*0x020))
+        arjwx_ri(Reax, IB(1),
+        sub_x, NZ_x, 100602b) /* gmm_kdep */
+
+        movxx_rr(Recx, Redi)
+        addps_ld(Xmm0, Mecx, DP(Q*0x000))
+        addps_ld(Xmm1, Mecx, DP(Q*0x010))
+        addps_ld(Xmm2, Mecx, DP(Q*0x020))
+        movpx_st(Xmm0, Mecx, DP(Q*0x000))
+        movpx_st(Xmm1, Mecx, DP(Q*0x010))
+        movpx_st(Xmm2, Mecx, DP(Q*0x020))
+        addxx_ld(Recx, Mebp, gmm_LDWC)
+        addps_ld(Xmm3, Mecx, DP(Q*0x000))
+        addps_ld(Xmm4, Mecx, DP(Q*0x010))
+        addps_ld(Xmm5, Mecx, DP(Q*0x020))
+        movpx_st(Xmm3, Mecx, DP(Q*0x000))
+        movpx_st(Xmm4, Mecx, DP(Q*0x010))
+        movpx_st(Xmm5, Mecx, DP(Q*0x020))
+        addxx_ld(Recx, Mebp, gmm_LDWC)
+
+#endif /* RT_GEMM_MR, RT_GEMM_NR */
+
+        movxx_rr(Redi, Recx)
+        arjwx_mi(Mebp, gmm_ICNT, IB(1),
+        sub_x, NZ_x, 100601b) /* gmm_ipan */
+
+        addxx_ld(Resi, Mebp, gmm_BSTP)
+        addxx_ri(Redx, IM(RT_GEMM_NR*Q*0x010))
+        arjwx_mi(Mebp, gmm_JCNT, IB(1),
+        sub_x, NZ_x, 100600b) /* gmm_jpan */
+
+    ASM_LEAVE(info)
+}
+
+#undef gmm_FMA
+
+/******************************************************************************/
+/*************************   GEMM DRIVER   ************************************/
+/******************************************************************************/
+
+/*
+ * Return size of the work area in bytes required by gemm_run
+ * for C-matrix of given dimensions, the work area itself
+ * must be SIMD-aligned (to RT_SIMD_ALIGN) and set to info->work.
+ */
+static
+rt_size gemm_work(rt_si32 m, rt_si32 n)
+{
+    rt_si32 mp = (m + RT_GEMM_MR - 1) / RT_GEMM_MR * RT_GEMM_MR;
+    rt_si32 np = (n + RT_GEMM_NR*S - 1) / (RT_GEMM_NR*S) * (RT_GEMM_NR*S);
+
+    return ((rt_size)mp * np
+          + (rt_size)RT_GEMM_MC * RT_GEMM_KC * S
+          + (rt_size)RT_GEMM_KC * RT_MIN(np, RT_GEMM_NC)) * sizeof(rt_real);
+}
+
+/*
+ * Pack B-block (kc x nc) from B + p0 * ldb + j0 into NR*S-wide panels,
+ * columns past n are padded with zeroes.
+ */
+static
+rt_void gemm_pckb(rt_SIMD_GEMM *info, rt_si32 p0, rt_si32 kc,
+                                      rt_si32 j0, rt_si32 nc)
+{
+    rt_si32 i, j, p, w = RT_GEMM_NR*S;
+    rt_real *bpck = info->bpck;
+
+    for (j = 0; j < nc; j += w)
+    {
+        rt_si32 nj = RT_MAX(RT_MIN(w, info->n - j0 - j), 0);
+
+        for (p = 0; p < kc; p++)
+        {
+            rt_real *b = info->b + (rt_cell)(p0 + p) * info->ldb + j0 + j;
+
+            for (i = 0; i < nj; i++)
+            {
+                bpck[i] = b[i];
+            }
+            for (; i < w; i++)
+            {
+                bpck[i] = 0.0;
+            }
+            bpck += w;
+        }
+    }
+}
+
+/*
+ * Pack A-block (mc x kc) from A + i0 * lda + p0 into MR-row panels,
+ * each element is scaled by alpha and broadcast to S elements,
+ * rows past m are padded with zeroes.
+ */
+static
+rt_void gemm_pcka(rt_SIMD_GEMM *info, rt_si32 i0, rt_si32 mc,
+                                      rt_si32 p0, rt_si32 kc)
+{
+    rt_si32 i, k, p, r;
+    rt_real *apck = info->apck;
+
+    for (i = 0; i < mc; i += RT_GEMM_MR)
+    {
+        for (p = 0; p < kc; p++)
+        {
+            for (r = 0; r < RT_GEMM_MR; r++)
+            {
+                rt_real v = 0.0;
+
+                if (i0 + i + r < info->m)
+                {
+                    v = info->alpha *
+                        info->a[(rt_cell)(i0 + i + r) * info->lda + p0 + p];
+                }
+                for (k = 0; k < S; k++)
+                {
+                    apck[k] = v;
+                }
+                apck += S;
+            }
+        }
+    }
+}
+
+/*
+ * Compute C = alpha * A * B + beta * C with parameters from info,
+ * info->work must point to SIMD-aligned area of gemm_work(m, n) bytes.
+ * Structure must be initialized with ASM_INIT before the first use.
+ */
+static
+rt_void gemm_run(rt_SIMD_GEMM *info)
+{
+    rt_si32 i, j, ic, jc, pc, mc, nc, kc;
+
+    rt_si32 m = info->m, n = info->n, k = info->k;
+
+    if (m <= 0 || n <= 0)
+    {
+        return;
+    }
+
+    rt_si32 mp = (m + RT_GEMM_MR - 1) / RT_GEMM_MR * RT_GEMM_MR;
+    rt_si32 np = (n + RT_GEMM_NR*S - 1) / (RT_GEMM_NR*S) * (RT_GEMM_NR*S);
+
+    rt_real *cwrk = info->work;
+    info->apck = cwrk + (rt_cell)mp * np;
+    info->bpck = info->apck + (rt_cell)RT_GEMM_MC * RT_GEMM_KC * S;
+
+    /* padded SIMD-aligned C-copy, scaled by beta */
+    for (i = 0; i < mp; i++)
+    {
+        rt_real *c = info->c + (rt_cell)i * info->ldc;
+        rt_real *w = cwrk + (rt_cell)i * np;
+
+        for (j = 0; j < np; j++)
+        {
+            w[j] = i < m && j < n ?
+                  (info->beta == 0.0 ? 0.0 : info->beta * c[j]) : 0.0;
+        }
+    }
+
+    info->ldwc = (rt_cell)np * sizeof(rt_real);
+
+    for (jc = 0; jc < np; jc += nc)
+    {
+        nc = RT_MIN(np - jc, RT_GEMM_NC);
+
+        for (pc = 0; pc < k; pc += kc)
+        {
+            kc = RT_MIN(k - pc, RT_GEMM_KC);
+
+            gemm_pckb(info, pc, kc, jc, nc);
+
+            info->kcnt = kc;
+            info->ncnt = nc / (RT_GEMM_NR*S);
+            info->bstp = (rt_cell)kc * RT_GEMM_NR*S * sizeof(rt_real);
+
+            for (ic = 0; ic < mp; ic += mc)
+            {
+                mc = RT_MIN(mp - ic, RT_GEMM_MC);
+
+                gemm_pcka(info, ic, mc, pc, kc);
+
+                info->mcnt = mc / RT_GEMM_MR;
+                info->cblk = cwrk + (rt_cell)ic * np + jc;
+
+                gemm_kern(info);
+            }
+        }
+    }
+
+    for (i = 0; i < m; i++)
+    {
+        rt_real *c = info->c + (rt_cell)i * info->ldc;
+        rt_real *w = cwrk + (rt_cell)i * np;
+
+        for (j = 0; j < n; j++)
+        {
+            c[j] = w[j];
+        }
+    }
+}
+
+#endif /* RT_RTGEMM_H */
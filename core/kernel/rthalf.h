@@ -0,0 +1,765 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2023 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTHALF_H
+#define RT_RTHALF_H
+
+#include "rtbase.h"
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rthalf.h: half-precision (cmdm*) kernels and horizontal reductions.
+ * Table of contents is provided below.
+ *
+ * Native fp16 arithmetic is only provided by AVX512-FP16 (xHF) and ARMv8.2
+ * (aHF) headers, on all other targets rtconf.h emulates the same cmdm*, cmdn*
+ * names in fp32 (RT_SIMD_HALF_EMUL), so that the same code runs everywhere
+ * and uses native speed where available.
+ *
+ * Kernels below don't go through the emulated subset, which spills after
+ * each op, but widen whole packets into registers instead (see HALF KERNELS).
+ * Reductions use horizontal fp16 ops adhms, mnhms, mxhms from rtconf.h.
+ *
+ * Kernels work on arrays of fp16 values (rt_half) of hlf_size(n) elements,
+ * hlf_h2f/hlf_f2h convert single values in C.
+ */
+
+/*----------------------------------------------------------------------------*/
+
+/*************************   SIMD BACKEND STRUCTURE   *************************/
+
+/*************************   HALF KERNELS   ***********************************/
+
+/*************************   HALF DRIVERS   ***********************************/
+
+/*----------------------------------------------------------------------------*/
+
+/******************************************************************************/
+/*************************   SIMD BACKEND STRUCTURE   *************************/
+/******************************************************************************/
+
+/*
+ * SIMD half structure for ASM_ENTER/ASM_LEAVE contains reduction result
+ * and kernel parameters set by drivers, must be initialized with ASM_INIT
+ * before use (fp16 constants live in rt_SIMD_REGS).
+ * Note that DP offsets below start where rt_SIMD_INFO ends (at Q*0x100).
+ * SIMD width is taken into account via R and Q from rtbase.h
+ * Structure is read-write in backend.
+ */
+struct rt_SIMD_HALF : public rt_SIMD_INFO
+{
+    /* internal variables */
+
+    rt_si32 res0[R];        /* reduction result, broadcast */
+#define hlf_RES0            DP(Q*0x100)
+
+    /* kernel parameters (scalar) */
+
+    rt_half*src0;           /* 1st input */
+#define hlf_SRC0            DP(Q*0x110+0x000*P+E)
+
+    rt_half*src1;           /* 2nd input */
+#define hlf_SRC1            DP(Q*0x110+0x004*P+E)
+
+    rt_half*src2;           /* 3rd input, fma only */
+#define hlf_SRC2            DP(Q*0x110+0x008*P+E)
+
+    rt_half*dst0;           /* output */
+#define hlf_DST0            DP(Q*0x110+0x00C*P+E)
+
+    rt_si32 pcnt;           /* number of packets */
+#define hlf_PCNT            DP(Q*0x110+0x010*P+0x000)
+
+};
+
+/******************************************************************************/
+/*************************   HALF KERNELS   ***********************************/
+/******************************************************************************/
+
+/*
+ * Kernels widen whole packets once per op and keep both fp32 halves
+ * in registers (Xmm0-Xmm7) until they are narrowed back, instead of going
+ * through spills after each step of the emulated cmdm* subset (rtconf.h).
+ * Targets with native fp16 conversion use it for widen/narrow (cvyms_rr),
+ * others read constants from fp16 area of rt_SIMD_REGS via Iebp (hlf_KREG),
+ * native fp16 targets use cmdm* ops directly.
+ */
+
+#define hlf_KREG                                                            \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        subxx_rr(Reax, Rebp)                                                \
+        addxx_ri(Reax, IH(0x4000))
+
+#if (defined cvyms_rr)
+
+/* widen lower/upper half of fp16 packet to fp32 (X = (fp32)X.lo/hi),
+ * narrow fp32 onto lower/upper half of fp16 packet, other half is zeroed,
+ * T, U are not used */
+
+#define hlf_WLK(X, T, U)                                                    \
+        cvyms_rr(W(X), W(X))
+
+#define hlf_WHK(X, T, U)                                                    \
+        cuyms_rr(W(X), W(X))
+
+#define hlf_NLK(X, T, U)                                                    \
+        cvxos_rr(W(X), W(X))
+
+#define hlf_NHK(X, T, U)                                                    \
+        cuxos_rr(W(X), W(X))
+
+#else  /* generic widen/narrow */
+
+/* widen upper fp16 half of 32-bit lanes to fp32 (X = (fp32)X.hi),
+ * rebiased with integer add to twice the value and halved, with
+ * fp16 subnormals taken from min(X/2, X - 2^-14), so that fp32 denormals
+ * never reach mul (slow microcode path on x86), T, U as temporaries */
+
+#define hlf_WHK(X, T, U)                                                    \
+        movox_rr(W(T), W(X))                                                \
+        andox_ld(W(T), Mebp, inf_GPC06_32)                                  \
+        shrox_ri(W(X), IB(3))                                               \
+        andox_ld(W(X), Iebp, reg_HWMSK)                                     \
+        addox_ld(W(X), Iebp, reg_HDNRM)                                     \
+        movox_rr(W(U), W(X))                                                \
+        subos_ld(W(U), Iebp, reg_HDNRM)                                     \
+        mulos_ld(W(X), Iebp, reg_HHALF)                                     \
+        minos_rr(W(X), W(U))                                                \
+        movox_rr(W(U), W(X))                                                \
+        cgeos_ld(W(U), Iebp, reg_HHMAX)                                     \
+        andox_ld(W(U), Iebp, reg_HEINF)                                     \
+        orrox_rr(W(X), W(U))                                                \
+        orrox_rr(W(X), W(T))
+
+#define hlf_WLK(X, T, U)                                                    \
+        shlox_ri(W(X), IB(16))                                              \
+        hlf_WHK(W(X), W(T), W(U))
+
+/* narrow fp32 to fp16 in lower half of 32-bit lanes, upper half is zeroed,
+ * rounds to nearest even as sum of subnormal part from min(|X|, 2^-14)
+ * (rounded by fp32 add) and normal part from max(|X|, 2^-14) (rounded
+ * in integer), |X| is clamped to 2^16 (inf), NaN sets quiet bit,
+ * integer min/max are built from sign masks (minon is a loop on SSE2),
+ * T, U as temporaries */
+
+#define hlf_NLK(X, T, U)                                                    \
+        movox_rr(W(T), W(X))                                                \
+        andox_ld(W(T), Mebp, inf_GPC06_32)                                  \
+        shrox_ri(W(T), IB(16))                                              \
+        andox_ld(W(X), Mebp, inf_GPC04_32)                                  \
+        movox_rr(W(U), W(X))                                                \
+        cgton_ld(W(U), Iebp, reg_HEINF)                                     \
+        andox_ld(W(U), Iebp, reg_HQNAN)                                     \
+        orrox_rr(W(T), W(U))                                                \
+        subox_ld(W(X), Iebp, reg_HHMAX)                                     \
+        movox_rr(W(U), W(X))                                                \
+        shron_ri(W(U), IB(31))                                              \
+        andox_rr(W(X), W(U))                                                \
+        addox_ld(W(X), Iebp, reg_HHMAX)                                     \
+        subox_ld(W(X), Iebp, reg_HDNRM)                                     \
+        movox_rr(W(U), W(X))                                                \
+        shron_ri(W(U), IB(31))                                              \
+        andox_rr(W(U), W(X))                                                \
+        addox_ld(W(U), Iebp, reg_HDNRM)                                     \
+        addos_ld(W(U), Iebp, reg_HHALF)                                     \
+        subox_ld(W(U), Iebp, reg_HHALF)                                     \
+        orrox_rr(W(T), W(U))                                                \
+        movox_rr(W(U), W(X))                                                \
+        shron_ri(W(U), IB(31))                                              \
+        annox_rr(W(U), W(X))                                                \
+        addox_ld(W(U), Iebp, reg_HDNRM)                                     \
+        movox_rr(W(X), W(U))                                                \
+        shrox_ri(W(U), IB(13))                                              \
+        andox_ld(W(U), Iebp, reg_HLSB1)                                     \
+        addox_rr(W(X), W(U))                                                \
+        addox_ld(W(X), Iebp, reg_HNRMB)                                     \
+        shrox_ri(W(X), IB(13))                                              \
+        addox_rr(W(X), W(T))
+
+#define hlf_NHK(X, T, U)                                                    \
+        hlf_NLK(W(X), W(T), W(U))                                           \
+        shlox_ri(W(X), IB(16))
+
+#endif /* generic widen/narrow */
+
+/* add widening (Xmm1 = Xmm1 + Xmm2.lo + Xmm2.hi), Xmm2 is clobbered,
+ * uses Xmm5, Xmm6, Xmm7 on all targets */
+
+#define hlf_KADW                                                            \
+        movox_rr(Xmm5, Xmm2)                                                \
+        hlf_WHK(Xmm5, Xmm6, Xmm7)                                           \
+        addos_rr(Xmm1, Xmm5)                                                \
+        hlf_WLK(Xmm2, Xmm6, Xmm7)                                           \
+        addos_rr(Xmm1, Xmm2)
+
+#if (defined RT_SIMD_HALF_EMUL)
+
+/* binary op (Xmm1 = Xmm1 op Xmm2), Xmm2 is clobbered,
+ * uses Xmm3, Xmm4, Xmm6, Xmm7 */
+
+#define hlf_KBIN(op)                                                        \
+        movox_rr(Xmm3, Xmm1)                                                \
+        hlf_WHK(Xmm3, Xmm6, Xmm7)                                           \
+        movox_rr(Xmm4, Xmm2)                                                \
+        hlf_WHK(Xmm4, Xmm6, Xmm7)                                           \
+        op##os_rr(Xmm3, Xmm4)                                               \
+        hlf_NHK(Xmm3, Xmm6, Xmm7)                                           \
+        hlf_WLK(Xmm1, Xmm6, Xmm7)                                           \
+        hlf_WLK(Xmm2, Xmm6, Xmm7)                                           \
+        op##os_rr(Xmm1, Xmm2)                                               \
+        hlf_NLK(Xmm1, Xmm6, Xmm7)                                           \
+        orrox_rr(Xmm1, Xmm3)
+
+/* sqrt (Xmm1 = sqrt(Xmm2)), uses Xmm3, Xmm6, Xmm7 */
+
+#define hlf_KSQR                                                            \
+        movox_rr(Xmm3, Xmm2)                                                \
+        hlf_WHK(Xmm3, Xmm6, Xmm7)                                           \
+        sqros_rr(Xmm3, Xmm3)                                                \
+        hlf_NHK(Xmm3, Xmm6, Xmm7)                                           \
+        movox_rr(Xmm1, Xmm2)                                                \
+        hlf_WLK(Xmm1, Xmm6, Xmm7)                                           \
+        sqros_rr(Xmm1, Xmm1)                                                \
+        hlf_NLK(Xmm1, Xmm6, Xmm7)                                           \
+        orrox_rr(Xmm1, Xmm3)
+
+/* fma (Xmm1 = Xmm1 + Xmm2 * Xmm3), fp32 product is exact,
+ * Xmm2, Xmm3 are clobbered, uses Xmm0, Xmm4, Xmm5, Xmm6, Xmm7 */
+
+#define hlf_KFMA                                                            \
+        movox_rr(Xmm0, Xmm1)                                                \
+        hlf_WHK(Xmm0, Xmm6, Xmm7)                                           \
+        movox_rr(Xmm4, Xmm2)                                                \
+        hlf_WHK(Xmm4, Xmm6, Xmm7)                                           \
+        movox_rr(Xmm5, Xmm3)                                                \
+        hlf_WHK(Xmm5, Xmm6, Xmm7)                                           \
+        mulos_rr(Xmm4, Xmm5)                                                \
+        addos_rr(Xmm0, Xmm4)                                                \
+        hlf_NHK(Xmm0, Xmm6, Xmm7)                                           \
+        hlf_WLK(Xmm1, Xmm6, Xmm7)                                           \
+        hlf_WLK(Xmm2, Xmm6, Xmm7)                                           \
+        hlf_WLK(Xmm3, Xmm6, Xmm7)                                           \
+        mulos_rr(Xmm2, Xmm3)                                                \
+        addos_rr(Xmm1, Xmm2)                                                \
+        hlf_NLK(Xmm1, Xmm6, Xmm7)                                           \
+        orrox_rr(Xmm1, Xmm0)
+
+#else  /* native fp16 */
+
+#define hlf_KBIN(op)                                                        \
+        op##ms_rr(Xmm1, Xmm2)
+
+#define hlf_KSQR                                                            \
+        sqrms_rr(Xmm1, Xmm2)
+
+#define hlf_KFMA                                                            \
+        fmams_rr(Xmm1, Xmm2, Xmm3)
+
+#endif /* native fp16 */
+
+/*
+ * Packet is N fp16 values (Q*0x010 bytes), 1st operand and result in Xmm1,
+ * 2nd operand in Xmm2.
+ */
+#define hlf_BINK(op, lb)                                                    \
+        hlf_KREG                                                            \
+        movxx_ld(Resi, Mebp, hlf_SRC0)                                      \
+        movxx_ld(Redi, Mebp, hlf_SRC1)                                      \
+        movxx_ld(Rebx, Mebp, hlf_DST0)                                      \
+        movwx_ld(Recx, Mebp, hlf_PCNT)                                      \
+    LBL(lb)                                                                 \
+        movmx_ld(Xmm1, Mesi, DP(Q*0x000))                                   \
+        movmx_ld(Xmm2, Medi, DP(Q*0x000))                                   \
+        hlf_KBIN(op)                                                        \
+        movmx_st(Xmm1, Mebx, DP(Q*0x000))                                   \
+        addxx_ri(Resi, IM(Q*0x010))                                         \
+        addxx_ri(Redi, IM(Q*0x010))                                         \
+        addxx_ri(Rebx, IM(Q*0x010))                                         \
+        arjwx_ri(Recx, IB(1),                                               \
+        sub_x, NZ_x, lb##b)
+
+/* hlf_addk (dst0 = src0 + src1)
+ * reads: src0, src1, pcnt, writes: dst0 */
+
+static
+rt_void hlf_addk(rt_SIMD_HALF *info)
+{
+    ASM_ENTER(info)
+
+        hlf_BINK(add, 102000) /* add_loop */
+
+    ASM_LEAVE(info)
+}
+
+/* hlf_subk (dst0 = src0 - src1)
+ * reads: src0, src1, pcnt, writes: dst0 */
+
+static
+rt_void hlf_subk(rt_SIMD_HALF *info)
+{
+    ASM_ENTER(info)
+
+        hlf_BINK(sub, 102001) /* sub_loop */
+
+    ASM_LEAVE(info)
+}
+
+/* hlf_mulk (dst0 = src0 * src1)
+ * reads: src0, src1, pcnt, writes: dst0 */
+
+static
+rt_void hlf_mulk(rt_SIMD_HALF *info)
+{
+    ASM_ENTER(info)
+
+        hlf_BINK(mul, 102002) /* mul_loop */
+
+    ASM_LEAVE(info)
+}
+
+/* hlf_divk (dst0 = src0 / src1)
+ * reads: src0, src1, pcnt, writes: dst0 */
+
+static
+rt_void hlf_divk(rt_SIMD_HALF *info)
+{
+    ASM_ENTER(info)
+
+        hlf_BINK(div, 102003) /* div_loop */
+
+    ASM_LEAVE(info)
+}
+
+/* hlf_mink (dst0 = min(src0, src1))
+ * reads: src0, src1, pcnt, writes: dst0 */
+
+static
+rt_void hlf_mink(rt_SIMD_HALF *info)
+{
+    ASM_ENTER(info)
+
+        hlf_BINK(min, 102004) /* min_loop */
+
+    ASM_LEAVE(info)
+}
+
+/* hlf_maxk (dst0 = max(src0, src1))
+ * reads: src0, src1, pcnt, writes: dst0 */
+
+static
+rt_void hlf_maxk(rt_SIMD_HALF *info)
+{
+    ASM_ENTER(info)
+
+        hlf_BINK(max, 102005) /* max_loop */
+
+    ASM_LEAVE(info)
+}
+
+/* hlf_sqrk (dst0 = sqrt(src0))
+ * reads: src0, pcnt, writes: dst0 */
+
+static
+rt_void hlf_sqrk(rt_SIMD_HALF *info)
+{
+    ASM_ENTER(info)
+
+        hlf_KREG
+        movxx_ld(Resi, Mebp, hlf_SRC0)
+        movxx_ld(Rebx, Mebp, hlf_DST0)
+        movwx_ld(Recx, Mebp, hlf_PCNT)
+
+    LBL(102006) /* sqr_loop */
+
+        movmx_ld(Xmm2, Mesi, DP(Q*0x000))
+        hlf_KSQR
+        movmx_st(Xmm1, Mebx, DP(Q*0x000))
+
+        addxx_ri(Resi, IM(Q*0x010))
+        addxx_ri(Rebx, IM(Q*0x010))
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 102006b) /* sqr_loop */
+
+    ASM_LEAVE(info)
+}
+
+/* hlf_fmak (dst0 = src2 + src0 * src1)
+ * reads: src0, src1, src2, pcnt, writes: dst0 */
+
+static
+rt_void hlf_fmak(rt_SIMD_HALF *info)
+{
+    ASM_ENTER(info)
+
+        hlf_KREG
+        movxx_ld(Resi, Mebp, hlf_SRC0)
+        movxx_ld(Redi, Mebp, hlf_SRC1)
+        movxx_ld(Redx, Mebp, hlf_SRC2)
+        movxx_ld(Rebx, Mebp, hlf_DST0)
+        movwx_ld(Recx, Mebp, hlf_PCNT)
+
+    LBL(102007) /* fma_loop */
+
+        movmx_ld(Xmm1, Medx, DP(Q*0x000))
+        movmx_ld(Xmm2, Mesi, DP(Q*0x000))
+        movmx_ld(Xmm3, Medi, DP(Q*0x000))
+        hlf_KFMA
+        movmx_st(Xmm1, Mebx, DP(Q*0x000))
+
+        addxx_ri(Resi, IM(Q*0x010))
+        addxx_ri(Redi, IM(Q*0x010))
+        addxx_ri(Redx, IM(Q*0x010))
+        addxx_ri(Rebx, IM(Q*0x010))
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 102007b) /* fma_loop */
+
+    ASM_LEAVE(info)
+}
+
+/*
+ * Reductions over pcnt packets, result broadcast to all lanes of res0.
+ */
+#define hlf_RDXK(op, hop, lb, le)                                           \
+        hlf_KREG                                                            \
+        movxx_ld(Resi, Mebp, hlf_SRC0)                                      \
+        movwx_ld(Recx, Mebp, hlf_PCNT)                                      \
+        movmx_ld(Xmm1, Mesi, DP(Q*0x000))                                   \
+        addxx_ri(Resi, IM(Q*0x010))                                         \
+        subwx_ri(Recx, IB(1))                                               \
+    LBL(lb)                                                                 \
+        cmjwx_rz(Recx,                                                      \
+        /* if */ EQ_x, le##f)                                               \
+        movmx_ld(Xmm2, Mesi, DP(Q*0x000))                                   \
+        hlf_KBIN(op)                                                        \
+        addxx_ri(Resi, IM(Q*0x010))                                         \
+        subwx_ri(Recx, IB(1))                                               \
+        jmpxx_lb(lb##b)                                                     \
+    LBL(le)                                                                 \
+        hop##_rr(Xmm1, Xmm1)                                                \
+        movox_st(Xmm1, Mebp, hlf_RES0)
+
+/* hlf_sumk (res0 = fp32 sum of src0), fp32 accumulation
+ * reads: src0, pcnt, writes: res0 */
+
+static
+rt_void hlf_sumk(rt_SIMD_HALF *info)
+{
+    ASM_ENTER(info)
+
+        hlf_KREG
+        movxx_ld(Resi, Mebp, hlf_SRC0)
+        movwx_ld(Recx, Mebp, hlf_PCNT)
+        xorox_rr(Xmm1, Xmm1)
+
+    LBL(102008) /* sum_loop */
+
+        movmx_ld(Xmm2, Mesi, DP(Q*0x000))
+        hlf_KADW
+
+        addxx_ri(Resi, IM(Q*0x010))
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 102008b) /* sum_loop */
+
+        adhos_rr(Xmm1, Xmm1)
+        movox_st(Xmm1, Mebp, hlf_RES0)
+
+    ASM_LEAVE(info)
+}
+
+/* hlf_smhk (res0 = fp16 sum of src0), fp16 accumulation per lane
+ * reads: src0, pcnt, writes: res0 */
+
+static
+rt_void hlf_smhk(rt_SIMD_HALF *info)
+{
+    ASM_ENTER(info)
+
+        hlf_RDXK(add, adhms, 102009, 102010) /* smh_loop, smh_done */
+
+    ASM_LEAVE(info)
+}
+
+/* hlf_mnhk (res0 = min of src0)
+ * reads: src0, pcnt, writes: res0 */
+
+static
+rt_void hlf_mnhk(rt_SIMD_HALF *info)
+{
+    ASM_ENTER(info)
+
+        hlf_RDXK(min, mnhms, 102011, 102012) /* mnh_loop, mnh_done */
+
+    ASM_LEAVE(info)
+}
+
+/* hlf_mxhk (res0 = max of src0)
+ * reads: src0, pcnt, writes: res0 */
+
+static
+rt_void hlf_mxhk(rt_SIMD_HALF *info)
+{
+    ASM_ENTER(info)
+
+        hlf_RDXK(max, mxhms, 102013, 102014) /* mxh_loop, mxh_done */
+
+    ASM_LEAVE(info)
+}
+
+#undef hlf_KREG
+#undef hlf_WLK
+#undef hlf_WHK
+#undef hlf_NLK
+#undef hlf_NHK
+#undef hlf_KADW
+#undef hlf_KBIN
+#undef hlf_KSQR
+#undef hlf_KFMA
+#undef hlf_BINK
+#undef hlf_RDXK
+
+/******************************************************************************/
+/*************************   HALF DRIVERS   ***********************************/
+/******************************************************************************/
+
+/*
+ * Number of fp16 values in array of n elements (whole packets).
+ */
+#define hlf_size(n)         (((n) + N - 1) / N * N)
+
+/*
+ * Convert fp16 value to fp32 (exact).
+ */
+static
+rt_fp32 hlf_h2f(rt_half h)
+{
+    union { rt_fp32 f; rt_ui32 u; } v;
+    rt_ui32 e = (h >> 10) & 0x1F, m = h & 0x3FF;
+
+    v.u = e == 0x1F ? 0x7F800000 | m << 13 :
+          e != 0x00 ? (e + 112) << 23 | m << 13 : 0;
+    if (e == 0 && m != 0)
+    {
+        v.f = (rt_fp32)m * (1.0f / 16777216.0f); /* m * 2^-24 */
+    }
+    v.u |= (rt_ui32)(h & 0x8000) << 16;
+    return v.f;
+}
+
+/*
+ * Convert fp32 value to fp16 (round to nearest even).
+ */
+static
+rt_half hlf_f2h(rt_fp32 f)
+{
+    union { rt_fp32 f; rt_ui32 u; } v;
+    rt_ui32 s, a;
+
+    v.f = f;
+    s = (v.u >> 16) & 0x8000;
+    a = v.u & 0x7FFFFFFF;
+    if (a > 0x7F800000)
+    {
+        return (rt_half)(s | 0x7E00);
+    }
+    if (a >= 0x477FF000) /* 65520.0f rounds to inf */
+    {
+        return (rt_half)(s | 0x7C00);
+    }
+    if (a < 0x38800000) /* 2^-14, subnormal */
+    {
+        v.u = a;
+        v.f += 0.5f;
+        return (rt_half)(s | (v.u - 0x3F000000));
+    }
+    return (rt_half)(s | (a - 0x38000000 + 0xFFF + ((a >> 13) & 1)) >> 13);
+}
+
+/*
+ * Run kernel k over n elements of fp16 arrays.
+ */
+#define hlf_CALL(info, k, d, a, b, c, n)                                    \
+    info->src0 = a;                                                         \
+    info->src1 = b;                                                         \
+    info->src2 = c;                                                         \
+    info->dst0 = d;                                                         \
+    info->pcnt = ((n) + N - 1) / N;                                         \
+    if (info->pcnt > 0)                                                     \
+    {                                                                       \
+        k(info);                                                            \
+    }
+
+/*
+ * fp16 add (d = a + b).
+ */
+static
+rt_void hlf_add(rt_SIMD_HALF *info, rt_half *d, rt_half *a, rt_half *b,
+                                                            rt_si32 n)
+{
+    hlf_CALL(info, hlf_addk, d, a, b, RT_NULL, n)
+}
+
+/*
+ * fp16 sub (d = a - b).
+ */
+static
+rt_void hlf_sub(rt_SIMD_HALF *info, rt_half *d, rt_half *a, rt_half *b,
+                                                            rt_si32 n)
+{
+    hlf_CALL(info, hlf_subk, d, a, b, RT_NULL, n)
+}
+
+/*
+ * fp16 mul (d = a * b).
+ */
+static
+rt_void hlf_mul(rt_SIMD_HALF *info, rt_half *d, rt_half *a, rt_half *b,
+                                                            rt_si32 n)
+{
+    hlf_CALL(info, hlf_mulk, d, a, b, RT_NULL, n)
+}
+
+/*
+ * fp16 div (d = a / b).
+ */
+static
+rt_void hlf_div(rt_SIMD_HALF *info, rt_half *d, rt_half *a, rt_half *b,
+                                                            rt_si32 n)
+{
+    hlf_CALL(info, hlf_divk, d, a, b, RT_NULL, n)
+}
+
+/*
+ * fp16 min (d = min(a, b)).
+ */
+static
+rt_void hlf_min(rt_SIMD_HALF *info, rt_half *d, rt_half *a, rt_half *b,
+                                                            rt_si32 n)
+{
+    hlf_CALL(info, hlf_mink, d, a, b, RT_NULL, n)
+}
+
+/*
+ * fp16 max (d = max(a, b)).
+ */
+static
+rt_void hlf_max(rt_SIMD_HALF *info, rt_half *d, rt_half *a, rt_half *b,
+                                                            rt_si32 n)
+{
+    hlf_CALL(info, hlf_maxk, d, a, b, RT_NULL, n)
+}
+
+/*
+ * fp16 sqrt (d = sqrt(a)), a >= 0.
+ */
+static
+rt_void hlf_sqr(rt_SIMD_HALF *info, rt_half *d, rt_half *a, rt_si32 n)
+{
+    hlf_CALL(info, hlf_sqrk, d, a, RT_NULL, RT_NULL, n)
+}
+
+/*
+ * fp16 fma (d = a * b + c).
+ */
+static
+rt_void hlf_fma(rt_SIMD_HALF *info, rt_half *d, rt_half *a, rt_half *b,
+                                                rt_half *c, rt_si32 n)
+{
+    hlf_CALL(info, hlf_fmak, d, a, b, c, n)
+}
+
+/*
+ * Run reduction kernel k over whole packets of n fp16 values,
+ * returns number of values processed (remainder is left to C).
+ */
+static
+rt_si32 hlf_rdx(rt_SIMD_HALF *info, rt_void (*k)(rt_SIMD_HALF *),
+                                               rt_half *a, rt_si32 n)
+{
+    info->src0 = a;
+    info->pcnt = n / N;
+    if (info->pcnt > 0)
+    {
+        k(info);
+    }
+    return info->pcnt * N;
+}
+
+/*
+ * fp16 sum with fp32 accumulation (returns a[0] + ... + a[n-1]),
+ * a is SIMD-aligned here and in reductions below, n is not rounded up.
+ */
+static
+rt_fp32 hlf_sum(rt_SIMD_HALF *info, rt_half *a, rt_si32 n)
+{
+    rt_si32 i = hlf_rdx(info, hlf_sumk, a, n);
+    rt_fp32 s = 0.0f;
+
+    if (i > 0)
+    {
+        memcpy(&s, info->res0, sizeof(s)); /* fp32 bits in rt_si32 */
+    }
+    for (; i < n; i++)
+    {
+        s += hlf_h2f(a[i]);
+    }
+    return s;
+}
+
+/*
+ * fp16 sum with fp16 accumulation in each lane (faster on native targets),
+ * lanes are reduced in fp32 and rounded once, remainder is added in fp16.
+ */
+static
+rt_half hlf_smh(rt_SIMD_HALF *info, rt_half *a, rt_si32 n)
+{
+    rt_si32 i = hlf_rdx(info, hlf_smhk, a, n);
+    rt_half h = i > 0 ? (rt_half)info->res0[0] : 0;
+
+    for (; i < n; i++)
+    {
+        h = hlf_f2h(hlf_h2f(h) + hlf_h2f(a[i]));
+    }
+    return h;
+}
+
+/*
+ * fp16 min (returns min(a[0], ..., a[n-1])), n > 0.
+ */
+static
+rt_half hlf_mnh(rt_SIMD_HALF *info, rt_half *a, rt_si32 n)
+{
+    rt_si32 i = hlf_rdx(info, hlf_mnhk, a, n);
+    rt_half h = i > 0 ? (rt_half)info->res0[0] : a[i++];
+
+    for (; i < n; i++)
+    {
+        h = hlf_h2f(a[i]) < hlf_h2f(h) ? a[i] : h;
+    }
+    return h;
+}
+
+/*
+ * fp16 max (returns max(a[0], ..., a[n-1])), n > 0.
+ */
+static
+rt_half hlf_mxh(rt_SIMD_HALF *info, rt_half *a, rt_si32 n)
+{
+    rt_si32 i = hlf_rdx(info, hlf_mxhk, a, n);
+    rt_half h = i > 0 ? (rt_half)info->res0[0] : a[i++];
+
+    for (; i < n; i++)
+    {
+        h = hlf_h2f(a[i]) > hlf_h2f(h) ? a[i] : h;
+    }
+    return h;
+}
+
+#undef hlf_CALL
+
+#endif /* RT_RTHALF_H */
@@ -0,0 +1,881 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2023 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTHASH_H
+#define RT_RTHASH_H
+
+#include "rtbase.h"
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rthash.h: non-cryptographic hashing in cmdo* (32-bit) and cmdq* (64-bit)
+ * integer subsets (multi-lane key hashing and striped buffer hashing).
+ * Table of contents is provided below.
+ *
+ * Key hashing (hsh_ui32, hsh_ui64) computes R or T independent hashes
+ * per SIMD register from arrays of keys, one hash per key: seed is mixed
+ * into the key with xor, then bits are avalanched with xorshift-multiply
+ * rounds (hsh_mix32, hsh_mix64), which are bijective for a given seed,
+ * thus distinct keys never collide in full-width hashes.
+ * 64-bit SIMD multiply (cmdq*) is native only on AVX512DQ, SVE and MSA
+ * targets (RT_HASH_MULQ), elsewhere it is emulated with BASE instructions
+ * through memory, thus hsh_MULQ composes it of three unsigned 32x32 to
+ * 64-bit products (mlwqx: pmuludq, umull, vmulouw) as lo * lo + ((hi * lo
+ * + lo * hi) << 32), with upper halves of multipliers kept in the structure.
+ * The same way hsh_MULO composes 32-bit multiply on SSE2 (no pmulld)
+ * of products of even and odd elements (RT_HASH_MULO). AVX1 has no 256-bit
+ * integer instructions (emulated per 128-bit half through memory), thus
+ * kernels use 128-bit subsets (cmdi*, cmdj*) on AVX1 (RT_HASH_SUBJ).
+ * With only 2 elements per composed 64-bit multiply (SSE, AVX1, NEON, VMX)
+ * hsh_kv64 is still slower than C/C++ loop over hsh_mix64 (about 1.2x),
+ * thus hsh_ui64 uses the latter there (RT_HASH_KV64).
+ *
+ * Striped hashing (hsh_strp) splits a byte buffer into stripes of
+ * RT_HASH_STRP bytes, lane i of every stripe (64-bit word) is accumulated
+ * into acc[i] as acc += d + lo32(x) * hi32(x) with x = d ^ k (full 64-bit
+ * product of 32-bit halves), where key k depends on the lane, seed and
+ * stripe index (order of stripes matters), and accumulators are scrambled
+ * (with 64-bit multiply) after every RT_HASH_BLCK stripes.
+ * Accumulator chains only contain adds, as the product of 32-bit halves
+ * doesn't depend on the previous stripe, which keeps SIMD pipelines full.
+ * Accumulators, the remainder (less than a stripe) and the length are then
+ * folded into the final 64-bit hash in C/C++ (hsh_last), which is also
+ * the only path for short strings (no kernel call below RT_HASH_STRP).
+ * The number of lanes is fixed for all targets (1 to 4 SIMD registers
+ * per stripe), thus hashes are the same across targets of the same
+ * endianness.
+ */
+
+/*----------------------------------------------------------------------------*/
+
+/*************************   SIMD BACKEND STRUCTURE   *************************/
+
+/*************************   HASHING KERNELS   ********************************/
+
+/*************************   HASHING DRIVERS   ********************************/
+
+/*----------------------------------------------------------------------------*/
+
+/* number of bytes per stripe (8 lanes of 64-bit words) */
+#define RT_HASH_STRP        64
+
+/* number of stripes per block, accumulators are scrambled after a block */
+#define RT_HASH_BLCK        16
+
+/* number of bytes copied for unaligned input per call, multiple of block */
+#define RT_HASH_CHNK        65536
+
+/* multipliers of the final mix and scrambling (odd) */
+#define RT_HASH_P64_1       ULL(0x9E3779B185EBCA87)
+#define RT_HASH_P64_2       ULL(0xC2B2AE3D27D4EB4F)
+#define RT_HASH_P64_3       ULL(0x165667B19E3779F9)
+#define RT_HASH_P64_4       ULL(0x85EBCA77C2B2AE63)
+#define RT_HASH_P64_5       ULL(0x27D4EB2F165667C5)
+
+/* native 64-bit SIMD multiply (cmdq*) on AVX512DQ, SVE and MSA targets,
+ * elsewhere it is composed of 32x32 to 64-bit products (LEGEND) */
+#ifndef RT_HASH_MULQ
+#if (defined RT_X32 || defined RT_X64) && (RT_SIMD == 128) && RT_128X1 == 2 \
+ || (defined RT_X32 || defined RT_X64) && (RT_SIMD == 256) && RT_256X1 >= 8 \
+ || (defined RT_X32 || defined RT_X64) && (RT_SIMD >= 512) &&               \
+    (RT_512X1 == 2 || RT_512X1 == 8 || RT_512X2 >= 2 || RT_512X4 >= 2)      \
+ || (defined RT_SVEX1 || defined RT_SVEX2 || defined RT_M32 || defined RT_M64)
+#define RT_HASH_MULQ        1
+#else /* composed of 32x32 to 64-bit products */
+#define RT_HASH_MULQ        0
+#endif /* composed of 32x32 to 64-bit products */
+#endif /* RT_HASH_MULQ */
+
+/* 32-bit SIMD multiply (cmdo*) composed of 32x32 to 64-bit products
+ * on SSE2 targets (no pmulld), where mulox_** is emulated through memory */
+#ifndef RT_HASH_MULO
+#if (defined RT_X32 || defined RT_X64) && RT_128X1 == 4 &&                  \
+    (RT_SIMD_COMPAT_SSE < 4)
+#define RT_HASH_MULO        1
+#else /* native 32-bit multiply */
+#define RT_HASH_MULO        0
+#endif /* native 32-bit multiply */
+#endif /* RT_HASH_MULO */
+
+/* 128-bit subsets (cmdi*, cmdj*) in all kernels on AVX1 targets,
+ * where 256-bit integer instructions are emulated through memory */
+#ifndef RT_HASH_SUBJ
+#if (defined RT_X32 || defined RT_X64) && (RT_SIMD >= 256) && RT_256X1 == 1
+#define RT_HASH_SUBJ        1
+#else /* full-width integer subsets */
+#define RT_HASH_SUBJ        0
+#endif /* full-width integer subsets */
+#endif /* RT_HASH_SUBJ */
+
+/* 64-bit key hashing in SIMD kernel (hsh_kv64) only where it is faster
+ * than C/C++ loop over hsh_mix64, that is with native 64-bit multiply
+ * or at least 4 elements per composed multiply (not on SSE, AVX1, NEON) */
+#ifndef RT_HASH_KV64
+#if RT_HASH_MULQ || (Q >= 2 && !RT_HASH_SUBJ)
+#define RT_HASH_KV64        1
+#else /* C/C++ loop is faster */
+#define RT_HASH_KV64        0
+#endif /* C/C++ loop is faster */
+#endif /* RT_HASH_KV64 */
+
+/* 32-bit multiply (cmdo*) of XG by XS (multiplier in all elements),
+ * uses Xmm7 as temporary on SSE2 targets */
+#if RT_HASH_MULO
+#define hsh_MULO(XG, XS)                                                    \
+        movox_rr(Xmm7,  W(XG))                                              \
+        shrqx_ri(Xmm7,  IB(32))                                             \
+        mlwqx_rr(Xmm7,  W(XS))                                              \
+        shlqx_ri(Xmm7,  IB(32))                                             \
+        mlwqx_rr(W(XG), W(XS))                                              \
+        shlqx_ri(W(XG), IB(32))                                             \
+        shrqx_ri(W(XG), IB(32))                                             \
+        orrox_rr(W(XG), Xmm7)
+#else /* native 32-bit multiply */
+#define hsh_MULO(XG, XS)                                                    \
+        mulox_rr(W(XG), W(XS))
+#endif /* native 32-bit multiply */
+
+/* 64-bit multiply (cmdq*) of XG by constant at DK (lower halves)
+ * and DH (upper halves), uses Xmm5, Xmm6 as temporaries if composed */
+#if RT_HASH_MULQ
+#define hsh_MULQ(XG, DK, DH)                                                \
+        mulqx_ld(W(XG), Mebp, W(DK))
+#else /* composed of 32x32 to 64-bit products */
+#define hsh_MULQ(XG, DK, DH)                                                \
+        movqx_rr(Xmm5,  W(XG))                                              \
+        shrqx_ri(Xmm5,  IB(32))                                             \
+        mlwqx_ld(Xmm5,  Mebp, W(DK))                                        \
+        movqx_rr(Xmm6,  W(XG))                                              \
+        mlwqx_ld(Xmm6,  Mebp, W(DH))                                        \
+        addqx_rr(Xmm5,  Xmm6)                                               \
+        shlqx_ri(Xmm5,  IB(32))                                             \
+        mlwqx_ld(W(XG), Mebp, W(DK))                                        \
+        addqx_rr(W(XG), Xmm5)
+#endif /* composed of 32x32 to 64-bit products */
+
+/* 64-bit multiply (cmdj*), 128-bit subset, always composed of 32x32
+ * to 64-bit products (native on all 128-bit targets) */
+#define hsh_MULJ(XG, DK, DH)                                                \
+        movjx_rr(Xmm5,  W(XG))                                              \
+        shrjx_ri(Xmm5,  IB(32))                                             \
+        mlwjx_ld(Xmm5,  Mebp, W(DK))                                        \
+        movjx_rr(Xmm6,  W(XG))                                              \
+        mlwjx_ld(Xmm6,  Mebp, W(DH))                                        \
+        addjx_rr(Xmm5,  Xmm6)                                               \
+        shljx_ri(Xmm5,  IB(32))                                             \
+        mlwjx_ld(W(XG), Mebp, W(DK))                                        \
+        addjx_rr(W(XG), Xmm5)
+
+/* accumulation step (cmdq*), updates accumulator XA with data at MS/DS
+ * and key at DK (plus stripe key in Xmm4), uses Xmm5, Xmm6 as temporaries */
+#define hsh_ACCQ(XA, MS, DS, DK)                                            \
+        movqx_ld(Xmm5,  W(MS), W(DS))                                       \
+        movqx_rr(Xmm6,  Xmm4)                                               \
+        addqx_ld(Xmm6,  Mebp, W(DK))                                        \
+        xorqx_rr(Xmm6,  Xmm5)                                               \
+        addqx_rr(W(XA), Xmm5)                                               \
+        movqx_rr(Xmm5,  Xmm6)                                               \
+        shrqx_ri(Xmm5,  IB(32))                                             \
+        mlwqx_rr(Xmm6,  Xmm5)                                               \
+        addqx_rr(W(XA), Xmm6)
+
+/* scrambling step (cmdq*), mixes accumulator XA with key at DK,
+ * uses Xmm5, Xmm6 as temporaries */
+#define hsh_SCRQ(XA, DK)                                                    \
+        movqx_rr(Xmm5,  W(XA))                                              \
+        shrqx_ri(Xmm5,  IB(47))                                             \
+        xorqx_rr(W(XA), Xmm5)                                               \
+        xorqx_ld(W(XA), Mebp, W(DK))                                        \
+        hsh_MULQ(W(XA), hsh_PRM1, hsh_PRH1)
+
+/* accumulation step (cmdj*), 128-bit subset for SIMD wider than stripe */
+#define hsh_ACCJ(XA, MS, DS, DK)                                            \
+        movjx_ld(Xmm5,  W(MS), W(DS))                                       \
+        movjx_rr(Xmm6,  Xmm4)                                               \
+        addjx_ld(Xmm6,  Mebp, W(DK))                                        \
+        xorjx_rr(Xmm6,  Xmm5)                                               \
+        addjx_rr(W(XA), Xmm5)                                               \
+        movjx_rr(Xmm5,  Xmm6)                                               \
+        shrjx_ri(Xmm5,  IB(32))                                             \
+        mlwjx_rr(Xmm6,  Xmm5)                                               \
+        addjx_rr(W(XA), Xmm6)
+
+/* scrambling step (cmdj*), 128-bit subset for SIMD wider than stripe */
+#define hsh_SCRJ(XA, DK)                                                    \
+        movjx_rr(Xmm5,  W(XA))                                              \
+        shrjx_ri(Xmm5,  IB(47))                                             \
+        xorjx_rr(W(XA), Xmm5)                                               \
+        xorjx_ld(W(XA), Mebp, W(DK))                                        \
+        hsh_MULJ(W(XA), hsh_PRM1, hsh_PRH1)
+
+/******************************************************************************/
+/*************************   SIMD BACKEND STRUCTURE   *************************/
+/******************************************************************************/
+
+/*
+ * SIMD hashing structure for ASM_ENTER/ASM_LEAVE contains mixing constants
+ * set by hsh_init, seed-dependent keys, accumulators and kernel parameters
+ * set by drivers, must be initialized with ASM_INIT before use.
+ * Note that DP offsets below start where rt_SIMD_INFO ends (at Q*0x100).
+ * SIMD width is taken into account via R, T and Q from rtbase.h
+ * Structure is read-write in backend.
+ */
+struct rt_SIMD_HASH : public rt_SIMD_INFO
+{
+    /* kernel constants (SIMD-fields) */
+
+    rt_ui32 mk1o[R];        /* 1st multiplier of hsh_mix32 */
+#define hsh_MK1O            DP(Q*0x100)
+
+    rt_ui32 mk2o[R];        /* 2nd multiplier of hsh_mix32 */
+#define hsh_MK2O            DP(Q*0x110)
+
+    rt_ui32 sd1o[R];        /* seed of hsh_ui32 */
+#define hsh_SD1O            DP(Q*0x120)
+
+    rt_ui64 mk1q[T];        /* 1st multiplier of hsh_mix64 */
+#define hsh_MK1Q            DP(Q*0x130)
+
+    rt_ui64 mk2q[T];        /* 2nd multiplier of hsh_mix64 */
+#define hsh_MK2Q            DP(Q*0x140)
+
+    rt_ui64 sd1q[T];        /* seed of hsh_ui64 */
+#define hsh_SD1Q            DP(Q*0x150)
+
+    rt_ui64 prm1[T];        /* multiplier of scrambling */
+#define hsh_PRM1            DP(Q*0x160)
+
+    rt_ui64 mk1h[T];        /* upper half of mk1q (in lower half) */
+#define hsh_MK1H            DP(Q*0x170)
+
+    rt_ui64 mk2h[T];        /* upper half of mk2q (in lower half) */
+#define hsh_MK2H            DP(Q*0x180)
+
+    rt_ui64 prh1[T];        /* upper half of prm1 (in lower half) */
+#define hsh_PRH1            DP(Q*0x190)
+
+    rt_ui64 kstp[T];        /* stripe key increment */
+#define hsh_KSTP            DP(Q*0x1A0)
+
+    rt_ui64 kcur[T];        /* stripe key of the next stripe */
+#define hsh_KCUR            DP(Q*0x1B0)
+
+    rt_ui64 keys[T*4];      /* lane keys (1st RT_HASH_STRP bytes) */
+#define hsh_KEYS(nn)        DP(Q*0x1C0+nn)
+
+    rt_ui64 accs[T*4];      /* lane accumulators (1st RT_HASH_STRP bytes) */
+#define hsh_ACCS(nn)        DP(Q*0x200+nn)
+
+    /* kernel parameters (scalar) */
+
+    rt_pntr srcx;           /* input keys or stripes, SIMD-aligned */
+#define hsh_SRCX            DP(Q*0x240+0x000*P+E)
+
+    rt_pntr dstx;           /* output hashes, SIMD-aligned */
+#define hsh_DSTX            DP(Q*0x240+0x004*P+E)
+
+    rt_si32 vcnt;           /* number of SIMD vectors (stripes) */
+#define hsh_VCNT            DP(Q*0x240+0x008*P+0x000)
+
+    /* hashing parameters (C/C++ only) */
+
+    rt_ui08*work;           /* SIMD-aligned work area of hsh_work bytes */
+
+};
+
+/******************************************************************************/
+/*************************   HASHING KERNELS   ********************************/
+/******************************************************************************/
+
+/* hsh_kv32 (hashes of vcnt vectors of 32-bit keys)
+ * reads: mk1o, mk2o, sd1o, srcx, vcnt, writes: dstx */
+
+static
+rt_void hsh_kv32(rt_SIMD_HASH *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, hsh_SRCX)
+        movxx_ld(Redi, Mebp, hsh_DSTX)
+        movwx_ld(Recx, Mebp, hsh_VCNT)
+
+#if RT_HASH_SUBJ
+
+        shlwx_ri(Recx, IB(Q/2))
+
+        movix_ld(Xmm4, Mebp, hsh_MK1O)
+        movix_ld(Xmm5, Mebp, hsh_MK2O)
+        movix_ld(Xmm6, Mebp, hsh_SD1O)
+
+    LBL(101400) /* k32_loop */
+
+        movix_ld(Xmm0, Mesi, DP(0x000))
+        xorix_rr(Xmm0, Xmm6)
+        movix_rr(Xmm1, Xmm0)
+        shrix_ri(Xmm1, IB(16))
+        xorix_rr(Xmm0, Xmm1)
+        mulix_rr(Xmm0, Xmm4)
+        movix_rr(Xmm1, Xmm0)
+        shrix_ri(Xmm1, IB(15))
+        xorix_rr(Xmm0, Xmm1)
+        mulix_rr(Xmm0, Xmm5)
+        movix_rr(Xmm1, Xmm0)
+        shrix_ri(Xmm1, IB(16))
+        xorix_rr(Xmm0, Xmm1)
+        movix_st(Xmm0, Medi, DP(0x000))
+
+        addxx_ri(Resi, IM(0x010))
+        addxx_ri(Redi, IM(0x010))
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 101400b) /* k32_loop */
+
+#else /* full-width integer subsets */
+
+        movox_ld(Xmm4, Mebp, hsh_MK1O)
+        movox_ld(Xmm5, Mebp, hsh_MK2O)
+        movox_ld(Xmm6, Mebp, hsh_SD1O)
+
+    LBL(101400) /* k32_loop */
+
+        movox_ld(Xmm0, Mesi, DP(Q*0x000))
+        xorox_rr(Xmm0, Xmm6)
+        movox_rr(Xmm1, Xmm0)
+        shrox_ri(Xmm1, IB(16))
+        xorox_rr(Xmm0, Xmm1)
+        hsh_MULO(Xmm0, Xmm4)
+        movox_rr(Xmm1, Xmm0)
+        shrox_ri(Xmm1, IB(15))
+        xorox_rr(Xmm0, Xmm1)
+        hsh_MULO(Xmm0, Xmm5)
+        movox_rr(Xmm1, Xmm0)
+        shrox_ri(Xmm1, IB(16))
+        xorox_rr(Xmm0, Xmm1)
+        movox_st(Xmm0, Medi, DP(Q*0x000))
+
+        addxx_ri(Resi, IM(Q*0x010))
+        addxx_ri(Redi, IM(Q*0x010))
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 101400b) /* k32_loop */
+
+#endif /* full-width integer subsets */
+
+    ASM_LEAVE(info)
+}
+
+/* hsh_kv64 (hashes of vcnt vectors of 64-bit keys)
+ * reads: mk1q, mk2q, mk1h, mk2h, sd1q, srcx, vcnt, writes: dstx */
+
+static
+rt_void hsh_kv64(rt_SIMD_HASH *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, hsh_SRCX)
+        movxx_ld(Redi, Mebp, hsh_DSTX)
+        movwx_ld(Recx, Mebp, hsh_VCNT)
+
+#if RT_HASH_SUBJ
+
+        shlwx_ri(Recx, IB(Q/2))
+
+        movjx_ld(Xmm7, Mebp, hsh_SD1Q)
+
+    LBL(101401) /* k64_loop */
+
+        movjx_ld(Xmm0, Mesi, DP(0x000))
+        xorjx_rr(Xmm0, Xmm7)
+        movjx_rr(Xmm1, Xmm0)
+        shrjx_ri(Xmm1, IB(30))
+        xorjx_rr(Xmm0, Xmm1)
+        hsh_MULJ(Xmm0, hsh_MK1Q, hsh_MK1H)
+        movjx_rr(Xmm1, Xmm0)
+        shrjx_ri(Xmm1, IB(27))
+        xorjx_rr(Xmm0, Xmm1)
+        hsh_MULJ(Xmm0, hsh_MK2Q, hsh_MK2H)
+        movjx_rr(Xmm1, Xmm0)
+        shrjx_ri(Xmm1, IB(31))
+        xorjx_rr(Xmm0, Xmm1)
+        movjx_st(Xmm0, Medi, DP(0x000))
+
+        addxx_ri(Resi, IM(0x010))
+        addxx_ri(Redi, IM(0x010))
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 101401b) /* k64_loop */
+
+#else /* full-width integer subsets */
+
+        movqx_ld(Xmm7, Mebp, hsh_SD1Q)
+
+    LBL(101401) /* k64_loop */
+
+        movqx_ld(Xmm0, Mesi, DP(Q*0x000))
+        xorqx_rr(Xmm0, Xmm7)
+        movqx_rr(Xmm1, Xmm0)
+        shrqx_ri(Xmm1, IB(30))
+        xorqx_rr(Xmm0, Xmm1)
+        hsh_MULQ(Xmm0, hsh_MK1Q, hsh_MK1H)
+        movqx_rr(Xmm1, Xmm0)
+        shrqx_ri(Xmm1, IB(27))
+        xorqx_rr(Xmm0, Xmm1)
+        hsh_MULQ(Xmm0, hsh_MK2Q, hsh_MK2H)
+        movqx_rr(Xmm1, Xmm0)
+        shrqx_ri(Xmm1, IB(31))
+        xorqx_rr(Xmm0, Xmm1)
+        movqx_st(Xmm0, Medi, DP(Q*0x000))
+
+        addxx_ri(Resi, IM(Q*0x010))
+        addxx_ri(Redi, IM(Q*0x010))
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 101401b) /* k64_loop */
+
+#endif /* full-width integer subsets */
+
+    ASM_LEAVE(info)
+}
+
+/* hsh_accm (accumulate vcnt stripes, starting at a block boundary)
+ * reads: prm1, prh1, kstp, keys, srcx, vcnt, writes: kcur, accs */
+
+static
+rt_void hsh_accm(rt_SIMD_HASH *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, hsh_SRCX)
+        movwx_ld(Recx, Mebp, hsh_VCNT)
+        movwx_ri(Redx, IB(RT_HASH_BLCK))
+
+#if   (Q == 1)
+
+        movqx_ld(Xmm4, Mebp, hsh_KCUR)
+
+        movqx_ld(Xmm0, Mebp, hsh_ACCS(0x000))
+        movqx_ld(Xmm1, Mebp, hsh_ACCS(0x010))
+        movqx_ld(Xmm2, Mebp, hsh_ACCS(0x020))
+        movqx_ld(Xmm3, Mebp, hsh_ACCS(0x030))
+
+    LBL(101402) /* acc_loop */
+
+        hsh_ACCQ(Xmm0, Mesi, DP(0x000), hsh_KEYS(0x000))
+        hsh_ACCQ(Xmm1, Mesi, DP(0x010), hsh_KEYS(0x010))
+        hsh_ACCQ(Xmm2, Mesi, DP(0x020), hsh_KEYS(0x020))
+        hsh_ACCQ(Xmm3, Mesi, DP(0x030), hsh_KEYS(0x030))
+
+        addqx_ld(Xmm4, Mebp, hsh_KSTP)
+        addxx_ri(Resi, IM(RT_HASH_STRP))
+        arjwx_ri(Redx, IB(1),
+        sub_x, NZ_x, 101403f) /* acc_next */
+
+        hsh_SCRQ(Xmm0, hsh_KEYS(0x000))
+        hsh_SCRQ(Xmm1, hsh_KEYS(0x010))
+        hsh_SCRQ(Xmm2, hsh_KEYS(0x020))
+        hsh_SCRQ(Xmm3, hsh_KEYS(0x030))
+        movwx_ri(Redx, IB(RT_HASH_BLCK))
+
+    LBL(101403) /* acc_next */
+
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 101402b) /* acc_loop */
+
+        movqx_st(Xmm0, Mebp, hsh_ACCS(0x000))
+        movqx_st(Xmm1, Mebp, hsh_ACCS(0x010))
+        movqx_st(Xmm2, Mebp, hsh_ACCS(0x020))
+        movqx_st(Xmm3, Mebp, hsh_ACCS(0x030))
+
+        movqx_st(Xmm4, Mebp, hsh_KCUR)
+
+#elif (Q == 2) && !RT_HASH_SUBJ
+
+        movqx_ld(Xmm4, Mebp, hsh_KCUR)
+        movqx_ld(Xmm0, Mebp, hsh_ACCS(0x000))
+        movqx_ld(Xmm1, Mebp, hsh_ACCS(0x020))
+
+    LBL(101402) /* acc_loop */
+
+        hsh_ACCQ(Xmm0, Mesi, DP(0x000), hsh_KEYS(0x000))
+        hsh_ACCQ(Xmm1, Mesi, DP(0x020), hsh_KEYS(0x020))
+
+        addqx_ld(Xmm4, Mebp, hsh_KSTP)
+        addxx_ri(Resi, IM(RT_HASH_STRP))
+        arjwx_ri(Redx, IB(1),
+        sub_x, NZ_x, 101403f) /* acc_next */
+
+        hsh_SCRQ(Xmm0, hsh_KEYS(0x000))
+        hsh_SCRQ(Xmm1, hsh_KEYS(0x020))
+        movwx_ri(Redx, IB(RT_HASH_BLCK))
+
+    LBL(101403) /* acc_next */
+
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 101402b) /* acc_loop */
+
+        movqx_st(Xmm0, Mebp, hsh_ACCS(0x000))
+        movqx_st(Xmm1, Mebp, hsh_ACCS(0x020))
+
+        movqx_st(Xmm4, Mebp, hsh_KCUR)
+
+#elif (Q == 4) && !RT_HASH_SUBJ
+
+        movqx_ld(Xmm4, Mebp, hsh_KCUR)
+        movqx_ld(Xmm0, Mebp, hsh_ACCS(0x000))
+
+    LBL(101402) /* acc_loop */
+
+        hsh_ACCQ(Xmm0, Mesi, DP(0x000), hsh_KEYS(0x000))
+
+        addqx_ld(Xmm4, Mebp, hsh_KSTP)
+        addxx_ri(Resi, IM(RT_HASH_STRP))
+        arjwx_ri(Redx, IB(1),
+        sub_x, NZ_x, 101403f) /* acc_next */
+
+        hsh_SCRQ(Xmm0, hsh_KEYS(0x000))
+        movwx_ri(Redx, IB(RT_HASH_BLCK))
+
+    LBL(101403) /* acc_next */
+
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 101402b) /* acc_loop */
+
+        movqx_st(Xmm0, Mebp, hsh_ACCS(0x000))
+
+        movqx_st(Xmm4, Mebp, hsh_KCUR)
+
+#else /* Q >= 8 (wider than stripe) or AVX1, use 128-bit subset */
+
+        movjx_ld(Xmm4, Mebp, hsh_KCUR)
+        movjx_ld(Xmm0, Mebp, hsh_ACCS(0x000))
+        movjx_ld(Xmm1, Mebp, hsh_ACCS(0x010))
+        movjx_ld(Xmm2, Mebp, hsh_ACCS(0x020))
+        movjx_ld(Xmm3, Mebp, hsh_ACCS(0x030))
+
+    LBL(101402) /* acc_loop */
+
+        hsh_ACCJ(Xmm0, Mesi, DP(0x000), hsh_KEYS(0x000))
+        hsh_ACCJ(Xmm1, Mesi, DP(0x010), hsh_KEYS(0x010))
+        hsh_ACCJ(Xmm2, Mesi, DP(0x020), hsh_KEYS(0x020))
+        hsh_ACCJ(Xmm3, Mesi, DP(0x030), hsh_KEYS(0x030))
+
+        addjx_ld(Xmm4, Mebp, hsh_KSTP)
+        addxx_ri(Resi, IM(RT_HASH_STRP))
+        arjwx_ri(Redx, IB(1),
+        sub_x, NZ_x, 101403f) /* acc_next */
+
+        hsh_SCRJ(Xmm0, hsh_KEYS(0x000))
+        hsh_SCRJ(Xmm1, hsh_KEYS(0x010))
+        hsh_SCRJ(Xmm2, hsh_KEYS(0x020))
+        hsh_SCRJ(Xmm3, hsh_KEYS(0x030))
+        movwx_ri(Redx, IB(RT_HASH_BLCK))
+
+    LBL(101403) /* acc_next */
+
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 101402b) /* acc_loop */
+
+        movjx_st(Xmm0, Mebp, hsh_ACCS(0x000))
+        movjx_st(Xmm1, Mebp, hsh_ACCS(0x010))
+        movjx_st(Xmm2, Mebp, hsh_ACCS(0x020))
+        movjx_st(Xmm3, Mebp, hsh_ACCS(0x030))
+
+        movjx_st(Xmm4, Mebp, hsh_KCUR)
+
+#endif /* Q */
+
+    ASM_LEAVE(info)
+}
+
+/******************************************************************************/
+/*************************   HASHING DRIVERS   ********************************/
+/******************************************************************************/
+
+/*
+ * Return hash of 32-bit key k with given seed (scalar).
+ */
+static
+rt_ui32 hsh_mix32(rt_ui32 k, rt_ui32 seed)
+{
+    rt_ui32 h = k ^ seed;
+
+    h ^= h >> 16;
+    h *= 0x7FEB352DU;
+    h ^= h >> 15;
+    h *= 0x846CA68BU;
+    h ^= h >> 16;
+
+    return h;
+}
+
+/*
+ * Return hash of 64-bit key k with given seed (scalar).
+ */
+static
+rt_ui64 hsh_mix64(rt_ui64 k, rt_ui64 seed)
+{
+    rt_ui64 h = k ^ seed;
+
+    h ^= h >> 30;
+    h *= ULL(0xBF58476D1CE4E5B9);
+    h ^= h >> 27;
+    h *= ULL(0x94D049BB133111EB);
+    h ^= h >> 31;
+
+    return h;
+}
+
+/*
+ * Return x rotated left by r bits, 0 < r < 64.
+ */
+static
+rt_ui64 hsh_rotl(rt_ui64 x, rt_si32 r)
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+/*
+ * Return 64-bit word read from p in native byte order (any alignment).
+ */
+static
+rt_ui64 hsh_ld64(const rt_ui08 *p)
+{
+    rt_ui64 w;
+
+    memcpy(&w, p, sizeof(w));
+
+    return w;
+}
+
+/*
+ * Return 32-bit word read from p in native byte order (any alignment).
+ */
+static
+rt_ui32 hsh_ld32(const rt_ui08 *p)
+{
+    rt_ui32 w;
+
+    memcpy(&w, p, sizeof(w));
+
+    return w;
+}
+
+/*
+ * Fill lane keys k and initial accumulators a (8 lanes each)
+ * of striped hashing for given seed.
+ */
+static
+rt_void hsh_lane(rt_ui64 *k, rt_ui64 *a, rt_ui64 seed)
+{
+    rt_si32 i;
+
+    for (i = 0; i < RT_HASH_STRP / 8; i++)
+    {
+        k[i] = hsh_mix64(RT_HASH_P64_5 * (rt_ui64)(i + 1), seed);
+        a[i] = RT_HASH_P64_2 * (rt_ui64)(i + 1);
+    }
+}
+
+/*
+ * Return final hash of n bytes from accumulators a, lane keys k
+ * and remainder p of r bytes (less than a stripe) for given seed.
+ */
+static
+rt_ui64 hsh_last(const rt_ui64 *a, const rt_ui64 *k,
+                 const rt_ui08 *p, rt_si32 r, rt_si32 n, rt_ui64 seed)
+{
+    rt_ui64 h = (rt_ui64)n * RT_HASH_P64_1 ^ seed;
+    rt_si32 i;
+
+    for (i = 0; i < RT_HASH_STRP / 8; i++)
+    {
+        h ^= hsh_mix64(a[i], k[i]);
+        h  = hsh_rotl(h, 27) * RT_HASH_P64_1 + RT_HASH_P64_4;
+    }
+    for (i = 0; i + 8 <= r; i += 8)
+    {
+        h ^= hsh_mix64(hsh_ld64(p + i), k[i / 8]);
+        h  = hsh_rotl(h, 27) * RT_HASH_P64_1 + RT_HASH_P64_4;
+    }
+    if (i + 4 <= r)
+    {
+        h ^= (rt_ui64)hsh_ld32(p + i) * RT_HASH_P64_1;
+        h  = hsh_rotl(h, 23) * RT_HASH_P64_2 + RT_HASH_P64_3;
+        i += 4;
+    }
+    for (; i < r; i++)
+    {
+        h ^= (rt_ui64)p[i] * RT_HASH_P64_5;
+        h  = hsh_rotl(h, 11) * RT_HASH_P64_1;
+    }
+
+    h ^= h >> 33;
+    h *= RT_HASH_P64_2;
+    h ^= h >> 29;
+    h *= RT_HASH_P64_3;
+    h ^= h >> 32;
+
+    return h;
+}
+
+/*
+ * Return size (in bytes) of work area for striped hashing of unaligned
+ * input, caller allocates the area with extra space for SIMD-alignment
+ * and sets it to info->work.
+ */
+static
+rt_size hsh_work()
+{
+    return RT_HASH_CHNK;
+}
+
+/*
+ * Set mixing constants of hashing kernels,
+ * info->work must point to SIMD-aligned area of hsh_work() bytes.
+ * Structure must be initialized with ASM_INIT before the first use.
+ */
+static
+rt_void hsh_init(rt_SIMD_HASH *info)
+{
+    rt_si32 i;
+
+    for (i = 0; i < R; i++)
+    {
+        info->mk1o[i] = 0x7FEB352DU;
+        info->mk2o[i] = 0x846CA68BU;
+    }
+    for (i = 0; i < T; i++)
+    {
+        info->mk1q[i] = ULL(0xBF58476D1CE4E5B9);
+        info->mk2q[i] = ULL(0x94D049BB133111EB);
+        info->prm1[i] = RT_HASH_P64_1;
+        info->mk1h[i] = info->mk1q[i] >> 32;
+        info->mk2h[i] = info->mk2q[i] >> 32;
+        info->prh1[i] = info->prm1[i] >> 32;
+        info->kstp[i] = RT_HASH_P64_3;
+    }
+}
+
+/*
+ * Compute hashes h[0..n) of 32-bit keys k[0..n) with given seed,
+ * SIMD is used when k and h have the same alignment modulo SIMD width.
+ */
+static
+rt_void hsh_ui32(rt_SIMD_HASH *info, const rt_ui32 *k, rt_si32 n,
+                 rt_ui32 seed, rt_ui32 *h)
+{
+    rt_si32 i, j = 0;
+
+    if ((((rt_full)k ^ (rt_full)h) & (Q*0x10 - 1)) == 0)
+    {
+        for (; j < n && ((rt_full)(k + j) & (Q*0x10 - 1)) != 0; j++)
+        {
+            h[j] = hsh_mix32(k[j], seed);
+        }
+        if (n - j >= R)
+        {
+            for (i = 0; i < R; i++)
+            {
+                info->sd1o[i] = seed;
+            }
+
+            info->srcx = (rt_ui32 *)k + j;
+            info->dstx = h + j;
+            info->vcnt = (n - j) / R;
+            hsh_kv32(info);
+
+            j += info->vcnt * R;
+        }
+    }
+
+    for (; j < n; j++)
+    {
+        h[j] = hsh_mix32(k[j], seed);
+    }
+}
+
+/*
+ * Compute hashes h[0..n) of 64-bit keys k[0..n) with given seed,
+ * SIMD is used when k and h have the same alignment modulo SIMD width
+ * and RT_HASH_KV64 is set (where SIMD is faster than C/C++ loop).
+ */
+static
+rt_void hsh_ui64(rt_SIMD_HASH *info, const rt_ui64 *k, rt_si32 n,
+                 rt_ui64 seed, rt_ui64 *h)
+{
+    rt_si32 i, j = 0;
+
+    if ((((rt_full)k ^ (rt_full)h) & (Q*0x10 - 1)) == 0 && RT_HASH_KV64)
+    {
+        for (; j < n && ((rt_full)(k + j) & (Q*0x10 - 1)) != 0; j++)
+        {
+            h[j] = hsh_mix64(k[j], seed);
+        }
+        if (n - j >= T)
+        {
+            for (i = 0; i < T; i++)
+            {
+                info->sd1q[i] = seed;
+            }
+
+            info->srcx = (rt_ui64 *)k + j;
+            info->dstx = h + j;
+            info->vcnt = (n - j) / T;
+            hsh_kv64(info);
+
+            j += info->vcnt * T;
+        }
+    }
+
+    for (; j < n; j++)
+    {
+        h[j] = hsh_mix64(k[j], seed);
+    }
+}
+
+/*
+ * Return striped hash of n bytes from p with given seed,
+ * input of any alignment, unaligned stripes are copied in chunks
+ * of RT_HASH_CHNK bytes into info->work.
+ */
+static
+rt_ui64 hsh_strp(rt_SIMD_HASH *info, const rt_ui08 *p, rt_si32 n,
+                 rt_ui64 seed)
+{
+    rt_si32 i, j, k, m = n / RT_HASH_STRP * RT_HASH_STRP;
+
+    hsh_lane(info->keys, info->accs, seed);
+
+    if (m > 0)
+    {
+        for (i = 0; i < T; i++)
+        {
+            info->kcur[i] = 0;
+        }
+
+        if (((rt_full)p & (Q*0x10 - 1)) == 0)
+        {
+            info->srcx = (rt_ui08 *)p;
+            info->vcnt = m / RT_HASH_STRP;
+            hsh_accm(info);
+        }
+        else
+        {
+            for (j = 0; j < m; j += k)
+            {
+                k = RT_MIN(m - j, RT_HASH_CHNK);
+                memcpy(info->work, p + j, k);
+
+                info->srcx = info->work;
+                info->vcnt = k / RT_HASH_STRP;
+                hsh_accm(info);
+            }
+        }
+    }
+
+    return hsh_last(info->accs, info->keys, p + m, n - m, n, seed);
+}
+
+#endif /* RT_RTHASH_H */
@@ -0,0 +1,359 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2023 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTHIST_H
+#define RT_RTHIST_H
+
+#include "rtbase.h"
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rthist.h: histograms of rt_ui08, rt_ui16 and quantized rt_real values
+ * in configurable cmdp* subset.
+ * Table of contents is provided below.
+ *
+ * SIMD ISA has no gather/scatter (nor conflict detection) by design,
+ * therefore bin increments are done in C/C++, where consecutive elements
+ * go to RT_HIST_SUBS private sub-histograms in turn, which breaks chains
+ * of load-increment-store on the same bin (store-to-load forwarding
+ * stalls) when data is skewed towards a few values.
+ * Sub-histograms of rt_elem counters are then merged by SIMD adds
+ * into the resulting histogram (hst_merg), while floating point inputs
+ * are quantized into bin indices by SIMD (hst_qntz) in chunks:
+ * bin = (rt_elem)min(max((x - lo) * nb / (hi - lo), 0), nb - 1),
+ * values out of [lo, hi) are clamped into the first and the last bins.
+ */
+
+/*----------------------------------------------------------------------------*/
+
+/*************************   SIMD BACKEND STRUCTURE   *************************/
+
+/*************************   HISTOGRAM KERNELS   ******************************/
+
+/*************************   HISTOGRAM DRIVERS   ******************************/
+
+/*----------------------------------------------------------------------------*/
+
+/* number of private sub-histograms, merged by hst_merg in one pass */
+#define RT_HIST_SUBS        4
+
+/* number of elements quantized per hst_qntz call, multiple of S */
+#define RT_HIST_CHNK        1024
+
+/******************************************************************************/
+/*************************   SIMD BACKEND STRUCTURE   *************************/
+/******************************************************************************/
+
+/*
+ * SIMD histogram structure for ASM_ENTER/ASM_LEAVE contains quantization
+ * constants and kernel parameters set by drivers,
+ * must be initialized with ASM_INIT before use.
+ * Note that DP offsets below start where rt_SIMD_INFO ends (at Q*0x100).
+ * SIMD width is taken into account via S and Q from rtbase.h
+ * Structure is read-write in backend.
+ */
+struct rt_SIMD_HIST : public rt_SIMD_INFO
+{
+    /* kernel constants (SIMD-fields) */
+
+    rt_real bmin[S];        /* lower bound of the 1st bin */
+#define hst_BMIN            DP(Q*0x100)
+
+    rt_real bscl[S];        /* number of bins per unit */
+#define hst_BSCL            DP(Q*0x110)
+
+    rt_real bmax[S];        /* index of the last bin */
+#define hst_BMAX            DP(Q*0x120)
+
+    /* kernel parameters (scalar) */
+
+    rt_real*srcx;           /* quantization input, SIMD-aligned */
+#define hst_SRCX            DP(Q*0x130+0x000*P+E)
+
+    rt_elem*dstx;           /* quantization output (bin indices) */
+#define hst_DSTX            DP(Q*0x130+0x004*P+E)
+
+    rt_elem*subs;           /* 1st sub-histogram, merge output */
+#define hst_SUBS            DP(Q*0x130+0x008*P+E)
+
+    rt_cell rstr;           /* stride of sub-histograms in bytes */
+#define hst_RSTR            DP(Q*0x130+0x00C*P+E)
+
+    rt_si32 vcnt;           /* number of SIMD vectors to process */
+#define hst_VCNT            DP(Q*0x130+0x010*P+0x000)
+
+    /* histogram parameters (C/C++ only) */
+
+    rt_elem*work;           /* SIMD-aligned work area of hst_work bytes */
+
+    rt_elem*idxs;           /* bin indices of a quantized chunk */
+
+    rt_si32 size;           /* max number of bins */
+
+};
+
+/******************************************************************************/
+/*************************   HISTOGRAM KERNELS   ******************************/
+/******************************************************************************/
+
+/* hst_qntz (bin indices of vcnt vectors)
+ * reads: bmin, bscl, bmax, srcx, vcnt, writes: dstx */
+
+static
+rt_void hst_qntz(rt_SIMD_HIST *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, hst_SRCX)
+        movxx_ld(Redi, Mebp, hst_DSTX)
+        movwx_ld(Recx, Mebp, hst_VCNT)
+
+        movpx_ld(Xmm4, Mebp, hst_BMIN)
+        movpx_ld(Xmm5, Mebp, hst_BSCL)
+        movpx_ld(Xmm6, Mebp, hst_BMAX)
+        xorpx_rr(Xmm7, Xmm7)
+
+    LBL(101300) /* qnt_loop */
+
+        movpx_ld(Xmm0, Mesi, DP(Q*0x000))
+        subps_rr(Xmm0, Xmm4)
+        mulps_rr(Xmm0, Xmm5)
+        maxps_rr(Xmm0, Xmm7)
+        minps_rr(Xmm0, Xmm6)
+        cvzps_rr(Xmm0, Xmm0)
+        movpx_st(Xmm0, Medi, DP(Q*0x000))
+
+        addxx_ri(Resi, IM(Q*0x010))
+        addxx_ri(Redi, IM(Q*0x010))
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 101300b) /* qnt_loop */
+
+    ASM_LEAVE(info)
+}
+
+/* hst_merg (add RT_HIST_SUBS sub-histograms into the 1st one)
+ * reads: subs, rstr, vcnt, writes: subs */
+
+static
+rt_void hst_merg(rt_SIMD_HIST *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, hst_SUBS)
+        movwx_ld(Recx, Mebp, hst_VCNT)
+
+        movxx_rr(Rebx, Resi)
+        addxx_ld(Rebx, Mebp, hst_RSTR)
+        movxx_rr(Redx, Rebx)
+        addxx_ld(Redx, Mebp, hst_RSTR)
+        movxx_rr(Redi, Redx)
+        addxx_ld(Redi, Mebp, hst_RSTR)
+
+    LBL(101301) /* mrg_loop */
+
+        movpx_ld(Xmm0, Mesi, DP(Q*0x000))
+        addpx_ld(Xmm0, Mebx, DP(Q*0x000))
+        movpx_ld(Xmm1, Medx, DP(Q*0x000))
+        addpx_ld(Xmm1, Medi, DP(Q*0x000))
+        addpx_rr(Xmm0, Xmm1)
+        movpx_st(Xmm0, Mesi, DP(Q*0x000))
+
+        addxx_ri(Resi, IM(Q*0x010))
+        addxx_ri(Rebx, IM(Q*0x010))
+        addxx_ri(Redx, IM(Q*0x010))
+        addxx_ri(Redi, IM(Q*0x010))
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 101301b) /* mrg_loop */
+
+    ASM_LEAVE(info)
+}
+
+/******************************************************************************/
+/*************************   HISTOGRAM DRIVERS   ******************************/
+/******************************************************************************/
+
+/*
+ * Return stride (in elements) of sub-histograms with nb bins.
+ */
+static
+rt_size hst_rlen(rt_si32 nb)
+{
+    return (rt_size)(RT_MAX(nb, 1) + S - 1) / S * S;
+}
+
+/*
+ * Return size (in bytes) of work area for histograms of up to nb bins,
+ * caller allocates the area with extra space for SIMD-alignment
+ * and sets it to info->work.
+ */
+static
+rt_size hst_work(rt_si32 nb)
+{
+    return (RT_HIST_SUBS * hst_rlen(nb) + RT_HIST_CHNK) * sizeof(rt_elem);
+}
+
+/*
+ * Prepare histograms of up to nb bins (65536 for hst_ui16),
+ * info->work must point to SIMD-aligned area of hst_work(nb) bytes.
+ * Structure must be initialized with ASM_INIT before the first use.
+ */
+static
+rt_void hst_init(rt_SIMD_HIST *info, rt_si32 nb)
+{
+    info->size = nb;
+
+    info->subs = info->work;
+    info->idxs = info->subs + RT_HIST_SUBS * hst_rlen(nb);
+    info->rstr = (rt_cell)(hst_rlen(nb) * sizeof(rt_elem));
+}
+
+/*
+ * Clear sub-histograms of nb bins.
+ */
+static
+rt_void hst_zero(rt_SIMD_HIST *info, rt_si32 nb)
+{
+    rt_si32 k;
+
+    for (k = 0; k < RT_HIST_SUBS; k++)
+    {
+        memset(info->subs + k * hst_rlen(info->size), 0, nb * sizeof(rt_elem));
+    }
+}
+
+/*
+ * Merge sub-histograms of nb bins into h[0..nb).
+ */
+static
+rt_void hst_fold(rt_SIMD_HIST *info, rt_si32 nb, rt_elem *h)
+{
+    info->vcnt = (rt_si32)(hst_rlen(nb) / S);
+
+    /* padding bins (up to S) are merged, but not copied */
+    hst_merg(info);
+
+    memcpy(h, info->subs, nb * sizeof(rt_elem));
+}
+
+/*
+ * Count n values from p into histogram h of 256 bins,
+ * requires hst_init with at least 256 bins.
+ */
+static
+rt_void hst_ui08(rt_SIMD_HIST *info, const rt_ui08 *p, rt_si32 n, rt_elem *h)
+{
+    rt_size r = hst_rlen(info->size);
+    rt_elem *h0 = info->subs, *h1 = h0 + r, *h2 = h1 + r, *h3 = h2 + r;
+    rt_si32 j;
+
+    hst_zero(info, 256);
+
+    for (j = 0; j + 4 <= n; j += 4)
+    {
+        h0[p[j + 0]]++;
+        h1[p[j + 1]]++;
+        h2[p[j + 2]]++;
+        h3[p[j + 3]]++;
+    }
+    for (; j < n; j++)
+    {
+        h0[p[j]]++;
+    }
+
+    hst_fold(info, 256, h);
+}
+
+/*
+ * Count n values from p into histogram h of 65536 bins,
+ * requires hst_init with at least 65536 bins.
+ */
+static
+rt_void hst_ui16(rt_SIMD_HIST *info, const rt_ui16 *p, rt_si32 n, rt_elem *h)
+{
+    rt_size r = hst_rlen(info->size);
+    rt_elem *h0 = info->subs, *h1 = h0 + r, *h2 = h1 + r, *h3 = h2 + r;
+    rt_si32 j;
+
+    hst_zero(info, 65536);
+
+    for (j = 0; j + 4 <= n; j += 4)
+    {
+        h0[p[j + 0]]++;
+        h1[p[j + 1]]++;
+        h2[p[j + 2]]++;
+        h3[p[j + 3]]++;
+    }
+    for (; j < n; j++)
+    {
+        h0[p[j]]++;
+    }
+
+    hst_fold(info, 65536, h);
+}
+
+/*
+ * Count n values from x quantized into nb bins of [lo, hi)
+ * into histogram h, requires hst_init with at least nb bins,
+ * x must be aligned at least to element size.
+ */
+static
+rt_void hst_real(rt_SIMD_HIST *info, const rt_real *x, rt_si32 n,
+                 rt_real lo, rt_real hi, rt_si32 nb, rt_elem *h)
+{
+    rt_size r = hst_rlen(info->size);
+    rt_elem *h0 = info->subs, *h1 = h0 + r, *h2 = h1 + r, *h3 = h2 + r;
+    rt_elem *d = info->idxs;
+    rt_real s = (rt_real)nb / (hi - lo), m = (rt_real)(nb - 1), t;
+    rt_si32 i, j, k;
+
+    RT_SIMD_SET(info->bmin, lo);
+    RT_SIMD_SET(info->bscl, s);
+    RT_SIMD_SET(info->bmax, m);
+
+    hst_zero(info, nb);
+
+    /* scalar head until x is SIMD-aligned, then chunks, then tail */
+    for (j = 0; j < n && ((rt_full)(x + j) & (Q*0x10 - 1)) != 0; j++)
+    {
+        t = (x[j] - lo) * s;
+        h0[(rt_elem)RT_MIN(RT_MAX(t, (rt_real)0), m)]++;
+    }
+
+    for (; j + S <= n; j += k)
+    {
+        k = RT_MIN(n - j, RT_HIST_CHNK) / S * S;
+
+        info->srcx = (rt_real *)x + j;
+        info->dstx = d;
+        info->vcnt = k / S;
+        hst_qntz(info);
+
+        for (i = 0; i + 4 <= k; i += 4)
+        {
+            h0[d[i + 0]]++;
+            h1[d[i + 1]]++;
+            h2[d[i + 2]]++;
+            h3[d[i + 3]]++;
+        }
+        for (; i < k; i++)
+        {
+            h0[d[i]]++;
+        }
+    }
+
+    for (; j < n; j++)
+    {
+        t = (x[j] - lo) * s;
+        h0[(rt_elem)RT_MIN(RT_MAX(t, (rt_real)0), m)]++;
+    }
+
+    hst_fold(info, nb, h);
+}
+
+#endif /* RT_RTHIST_H */
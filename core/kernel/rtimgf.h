@@ -0,0 +1,715 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2023 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTIMGF_H
+#define RT_RTIMGF_H
+
+#include "rtbase.h"
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rtimgf.h: u8 image filters in cmdm* subset (separable, Gaussian, box).
+ * Table of contents is provided below.
+ *
+ * All filters work with 8-bit planes of any width, height and row stride,
+ * borders are handled by replicating edge pixels (clamp-to-edge).
+ * Planes are processed in vertical strips (tiles) of at most RT_IMGF_TILE
+ * pixels, each strip is swept top-down with a ring of horizontally filtered
+ * rows, so that every input row is loaded and filtered only once
+ * and the working set of the vertical pass stays in L1/L2 cache.
+ *
+ * Separable convolution (img_conv_run) takes up to RT_IMGF_TAPS non-negative
+ * integer weights per direction, each pass is followed by rounding and
+ * right shift. Bytes are split into even and odd pixels within 16-bit lanes
+ * (mask and shift), thus intermediate sums are kept in 16 bits without
+ * widening instructions, which limits the sums of weights accordingly
+ * (see img_conv_init). SIMD ISA has no unaligned loads or lane shifts
+ * by design, therefore horizontal taps are taken from shifted copies
+ * of the source row, similarly to the delay line of the FIR filter.
+ * Gaussian 3x3 and 5x5 (img_gauss_init) are binomial instances of it.
+ *
+ * Box blur (img_box_run) keeps a running sum in both directions:
+ * horizontal pass is done in BASE registers (no lane shifts in SIMD) and
+ * divides by the box width via multiply and shift, vertical pass updates
+ * 16-bit column sums with the row entering and the row leaving the window
+ * and divides them by binary long division in SIMD (no integer divide).
+ * Cost per pixel doesn't depend on the radius, each pass rounds to nearest.
+ */
+
+/*----------------------------------------------------------------------------*/
+
+/*************************   SIMD BACKEND STRUCTURES   ************************/
+
+/*************************   SEPARABLE CONVOLUTION   **************************/
+
+/*************************   BOX BLUR   ***************************************/
+
+/*----------------------------------------------------------------------------*/
+
+/* max number of taps per direction for separable convolution */
+#ifndef RT_IMGF_TAPS
+#define RT_IMGF_TAPS        9
+#endif /* RT_IMGF_TAPS */
+
+/* max width of vertical strip in pixels, multiple of J */
+#ifndef RT_IMGF_TILE
+#define RT_IMGF_TILE        1024
+#endif /* RT_IMGF_TILE */
+
+/* max radius of box blur (exactness of division by multiply and shift) */
+#define RT_IMGF_RMAX        63
+
+/* append byte in RS (destroyed) to 32-bit word in RG in memory order,
+ * four consecutive appends fill the word for a single 32-bit store */
+#if RT_ENDIAN == 0
+
+#define img_APPB(RG, RS)                                                    \
+        shrwx_ri(W(RG), IB(8))                                              \
+        shlwx_ri(W(RS), IB(24))                                             \
+        orrwx_rr(W(RG), W(RS))
+
+#else  /* RT_ENDIAN == 1 */
+
+#define img_APPB(RG, RS)                                                    \
+        shlwx_ri(W(RG), IB(8))                                              \
+        orrwx_rr(W(RG), W(RS))
+
+#endif /* RT_ENDIAN */
+
+/******************************************************************************/
+/*************************   SIMD BACKEND STRUCTURES   ************************/
+/******************************************************************************/
+
+/*
+ * SIMD image filter structure for ASM_ENTER/ASM_LEAVE contains constants
+ * set by img_conv_init/img_box_init and kernel parameters set by drivers,
+ * must be initialized with ASM_INIT before use.
+ * Note that DP offsets below start where rt_SIMD_INFO ends (at Q*0x100).
+ * SIMD width is taken into account via N and Q from rtbase.h
+ * Structure is read-write in backend.
+ */
+struct rt_SIMD_IMGF : public rt_SIMD_INFO
+{
+    /* kernel constants (SIMD-fields) */
+
+    rt_ui16 mask[N];        /* even pixel mask 0x00FF */
+#define img_MASK            DP(Q*0x100)
+
+    rt_ui16 hrnd[N];        /* rounding of horizontal pass */
+#define img_HRND            DP(Q*0x110)
+
+    rt_ui16 hshf[N];        /* shift of horizontal pass (1st element) */
+#define img_HSHF            DP(Q*0x120)
+
+    rt_ui16 vrnd[N];        /* rounding of vertical pass */
+#define img_VRND            DP(Q*0x130)
+
+    rt_ui16 vshf[N];        /* shift of vertical pass (1st element) */
+#define img_VSHF            DP(Q*0x140)
+
+    rt_ui16 bhlf[N];        /* box width / 2 (rounding of division) */
+#define img_BHLF            DP(Q*0x150)
+
+    rt_ui16 bdiv[N];        /* box width << 7 (1st step of division) */
+#define img_BDIV            DP(Q*0x160)
+
+    /* kernel parameters (scalar) */
+
+    rt_ui16*wgts;           /* broadcast weights of the pass */
+#define img_WGTS            DP(Q*0x170+0x000*P+E)
+
+    rt_ui08*src0;           /* 1st source (copies, ring slot, padded row) */
+#define img_SRC0            DP(Q*0x170+0x004*P+E)
+
+    rt_ui08*src1;           /* 2nd source (ring slot leaving box window) */
+#define img_SRC1            DP(Q*0x170+0x008*P+E)
+
+    rt_ui08*dst0;           /* 1st destination (ring slot, output row) */
+#define img_DST0            DP(Q*0x170+0x00C*P+E)
+
+    rt_ui08*dst1;           /* 2nd destination (ring slot duplicate) */
+#define img_DST1            DP(Q*0x170+0x010*P+E)
+
+    rt_ui16*csum;           /* column sums of box window */
+#define img_CSUM            DP(Q*0x170+0x014*P+E)
+
+    rt_cell sstr;           /* stride of source copies or slots in bytes */
+#define img_SSTR            DP(Q*0x170+0x018*P+E)
+
+    rt_si32 ncnt;           /* number of byte registers (words for hbox) */
+#define img_NCNT            DP(Q*0x170+0x01C*P+0x000)
+
+    rt_si32 tcnt;           /* number of taps (box width for hbox) */
+#define img_TCNT            DP(Q*0x170+0x01C*P+0x004)
+
+    rt_si32 bmul;           /* box multiplier ceil(2^22 / width) */
+#define img_BMUL            DP(Q*0x170+0x01C*P+0x008)
+
+    rt_si32 boff;           /* box width / 2 (initial running sum) */
+#define img_BOFF            DP(Q*0x170+0x01C*P+0x00C)
+
+    rt_si32 icnt;           /* internal, register counter */
+#define img_ICNT            DP(Q*0x170+0x01C*P+0x010)
+
+    /* filter parameters (C/C++ only) */
+
+    rt_ui08*work;           /* SIMD-aligned work area of img_work bytes */
+
+    rt_si32 hcnt;           /* number of horizontal taps */
+    rt_si32 vcnt;           /* number of vertical taps */
+    rt_si32 rads;           /* box radius */
+
+};
+
+/*
+ * Return size of the work area in bytes required by img_conv_run
+ * and img_box_run with given radius, the work area itself
+ * must be SIMD-aligned (to RT_SIMD_ALIGN) and set to info->work.
+ */
+static
+rt_size img_work(rt_si32 rads)
+{
+    rt_size tw = (RT_IMGF_TILE + J - 1) / J * J;
+    rt_size cv, bx;
+
+    cv = (rt_size)2 * RT_IMGF_TAPS * N * sizeof(rt_ui16)
+       + (rt_size)RT_IMGF_TAPS * tw
+       + (rt_size)2 * RT_IMGF_TAPS * tw * 2 + tw;
+
+    bx = ((tw + 2 * RT_IMGF_RMAX + 1) + RT_SIMD_ALIGN - 1)
+                                      / RT_SIMD_ALIGN * RT_SIMD_ALIGN
+       + (rt_size)(2 * RT_MIN(RT_MAX(rads, 0), RT_IMGF_RMAX) + 2) * tw
+       + tw * 2 + tw + tw;
+
+    return RT_MAX(cv, bx);
+}
+
+/*
+ * Fill n pixels of d with row s of width w starting from column x0,
+ * replicating edge pixels outside of the row.
+ */
+static
+rt_void img_pads(rt_ui08 *d, rt_ui08 *s, rt_si32 w, rt_si32 x0, rt_si32 n)
+{
+    rt_si32 i = 0, k;
+
+    for (k = RT_MIN(n, -x0); i < k; i++)
+    {
+        d[i] = s[0];
+    }
+    for (k = RT_MIN(n, w - x0); i < k; i++)
+    {
+        d[i] = s[x0 + i];
+    }
+    for (; i < n; i++)
+    {
+        d[i] = s[w - 1];
+    }
+}
+
+/******************************************************************************/
+/*************************   SEPARABLE CONVOLUTION   **************************/
+/******************************************************************************/
+
+/* img_hcnv (dst0 = dst1 = (wgts * src0 + hrnd) >> hshf)
+ * reads: wgts, src0, dst0, dst1, sstr, ncnt, tcnt, destroys icnt
+ * each byte register of tcnt shifted copies is split into even and odd
+ * 16-bit pixels, weighted sums are stored as pairs of registers (even, odd)
+ * to both ring slots */
+
+static
+rt_void img_hcnv(rt_SIMD_IMGF *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, img_SRC0)
+        movxx_ld(Redx, Mebp, img_DST0)
+        movxx_ld(Rebx, Mebp, img_DST1)
+        movwx_ld(Reax, Mebp, img_NCNT)
+        movwx_st(Reax, Mebp, img_ICNT)
+
+    LBL(100900) /* hcnv_simd */
+
+        xormx_rr(Xmm1, Xmm1)
+        xormx_rr(Xmm2, Xmm2)
+        movxx_ld(Redi, Mebp, img_WGTS)
+        movxx_rr(Recx, Resi)
+        movwx_ld(Reax, Mebp, img_TCNT)
+
+    LBL(100901) /* hcnv_taps */
+
+        movmx_ld(Xmm3, Mecx, DP(Q*0x000))
+        movmx_rr(Xmm4, Xmm3)
+        andmx_ld(Xmm3, Mebp, img_MASK)
+        shrmx_ri(Xmm4, IB(8))
+        mulmx_ld(Xmm3, Medi, DP(Q*0x000))
+        mulmx_ld(Xmm4, Medi, DP(Q*0x000))
+        addmx_rr(Xmm1, Xmm3)
+        addmx_rr(Xmm2, Xmm4)
+
+        addxx_ld(Recx, Mebp, img_SSTR)
+        addxx_ri(Redi, IM(Q*0x010))
+        arjwx_ri(Reax, IB(1),
+        sub_x, NZ_x, 100901b) /* hcnv_taps */
+
+        addmx_ld(Xmm1, Mebp, img_HRND)
+        addmx_ld(Xmm2, Mebp, img_HRND)
+        shrmx_ld(Xmm1, Mebp, img_HSHF)
+        shrmx_ld(Xmm2, Mebp, img_HSHF)
+        movmx_st(Xmm1, Medx, DP(Q*0x000))
+        movmx_st(Xmm2, Medx, DP(Q*0x010))
+        movmx_st(Xmm1, Mebx, DP(Q*0x000))
+        movmx_st(Xmm2, Mebx, DP(Q*0x010))
+
+        addxx_ri(Resi, IM(Q*0x010))
+        addxx_ri(Redx, IM(Q*0x020))
+        addxx_ri(Rebx, IM(Q*0x020))
+        arjwx_mi(Mebp, img_ICNT, IB(1),
+        sub_x, NZ_x, 100900b) /* hcnv_simd */
+
+    ASM_LEAVE(info)
+}
+
+/* img_vcnv (dst0 = pack((wgts * src0 + vrnd) >> vshf))
+ * reads: wgts, src0, dst0, sstr, ncnt, tcnt, destroys icnt
+ * accumulates tcnt consecutive ring slots of (even, odd) pairs,
+ * then packs even and odd pixels back into byte registers */
+
+static
+rt_void img_vcnv(rt_SIMD_IMGF *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, img_SRC0)
+        movxx_ld(Redx, Mebp, img_DST0)
+        movwx_ld(Reax, Mebp, img_NCNT)
+        movwx_st(Reax, Mebp, img_ICNT)
+
+    LBL(100902) /* vcnv_simd */
+
+        xormx_rr(Xmm1, Xmm1)
+        xormx_rr(Xmm2, Xmm2)
+        movxx_ld(Redi, Mebp, img_WGTS)
+        movxx_rr(Recx, Resi)
+        movwx_ld(Reax, Mebp, img_TCNT)
+
+    LBL(100903) /* vcnv_taps */
+
+        movmx_ld(Xmm3, Medi, DP(Q*0x000))
+        movmx_rr(Xmm4, Xmm3)
+        mulmx_ld(Xmm3, Mecx, DP(Q*0x000))
+        mulmx_ld(Xmm4, Mecx, DP(Q*0x010))
+        addmx_rr(Xmm1, Xmm3)
+        addmx_rr(Xmm2, Xmm4)
+
+        addxx_ld(Recx, Mebp, img_SSTR)
+        addxx_ri(Redi, IM(Q*0x010))
+        arjwx_ri(Reax, IB(1),
+        sub_x, NZ_x, 100903b) /* vcnv_taps */
+
+        addmx_ld(Xmm1, Mebp, img_VRND)
+        addmx_ld(Xmm2, Mebp, img_VRND)
+        shrmx_ld(Xmm1, Mebp, img_VSHF)
+        shrmx_ld(Xmm2, Mebp, img_VSHF)
+        shlmx_ri(Xmm2, IB(8))
+        orrmx_rr(Xmm1, Xmm2)
+        movmx_st(Xmm1, Medx, DP(Q*0x000))
+
+        addxx_ri(Resi, IM(Q*0x020))
+        addxx_ri(Redx, IM(Q*0x010))
+        arjwx_mi(Mebp, img_ICNT, IB(1),
+        sub_x, NZ_x, 100902b) /* vcnv_simd */
+
+    ASM_LEAVE(info)
+}
+
+/*
+ * Set weights hw[0..hn-1] and vw[0..vn-1] with their shifts hs and vs
+ * (taps are centered at (n-1)/2, left and top sides take the extra tap),
+ * where 255 * sum(hw) and (255 * sum(hw) >> hs) * sum(vw)
+ * must not exceed 65535 - rounding of respective pass,
+ * sum(vw) must not exceed 2^vs * 2^hs / sum(hw) to keep results in 8 bits.
+ * Structure must be initialized with ASM_INIT before the first use,
+ * info->work must point to SIMD-aligned area of img_work bytes.
+ */
+static
+rt_void img_conv_init(rt_SIMD_IMGF *info,
+                      rt_si32 hn, rt_ui16 *hw, rt_si32 hs,
+                      rt_si32 vn, rt_ui16 *vw, rt_si32 vs)
+{
+    rt_si32 i, k;
+    rt_ui16 *wh = (rt_ui16 *)info->work;
+    rt_ui16 *wv = wh + RT_IMGF_TAPS * N;
+
+    info->hcnt = RT_MAX(RT_MIN(hn, RT_IMGF_TAPS), 1);
+    info->vcnt = RT_MAX(RT_MIN(vn, RT_IMGF_TAPS), 1);
+
+    for (k = 0; k < RT_IMGF_TAPS; k++)
+    {
+        for (i = 0; i < N; i++)
+        {
+            wh[k * N + i] = k < hn ? hw[k] : 0;
+            wv[k * N + i] = k < vn ? vw[k] : 0;
+        }
+    }
+
+    for (i = 0; i < N; i++)
+    {
+        info->mask[i] = 0x00FF;
+        info->hrnd[i] = (rt_ui16)(hs > 0 ? 1 << (hs - 1) : 0);
+        info->hshf[i] = (rt_ui16)(i == 0 ? hs : 0);
+        info->vrnd[i] = (rt_ui16)(vs > 0 ? 1 << (vs - 1) : 0);
+        info->vshf[i] = (rt_ui16)(i == 0 ? vs : 0);
+    }
+}
+
+/*
+ * Set binomial weights of Gaussian kernel n x n (n = 3 or 5),
+ * horizontal pass keeps full precision, single rounding at the end.
+ */
+static
+rt_void img_gauss_init(rt_SIMD_IMGF *info, rt_si32 n)
+{
+    rt_ui16 g3[3] = {1, 2, 1};
+    rt_ui16 g5[5] = {1, 4, 6, 4, 1};
+
+    if (n == 3)
+    {
+        img_conv_init(info, 3, g3, 0, 3, g3, 4);
+    }
+    else
+    {
+        img_conv_init(info, 5, g5, 0, 5, g5, 8);
+    }
+}
+
+/*
+ * Convolve plane src (w x h pixels, lds bytes per row) into plane dst
+ * (ldd bytes per row) with weights set by img_conv_init or img_gauss_init,
+ * neither plane needs to be SIMD-aligned, planes must not overlap.
+ */
+static
+rt_void img_conv_run(rt_SIMD_IMGF *info, rt_ui08 *src, rt_ui08 *dst,
+                     rt_si32 w, rt_si32 h, rt_si32 lds, rt_si32 ldd)
+{
+    rt_si32 hn = info->hcnt, vn = info->vcnt;
+    rt_si32 rh = (hn - 1) / 2, rv = (vn - 1) / 2;
+    rt_si32 tw = (RT_IMGF_TILE + J - 1) / J * J;
+    rt_si32 c0, d, i, m, nv, v, y;
+
+    rt_ui16 *wh = (rt_ui16 *)info->work;
+    rt_ui16 *wv = wh + RT_IMGF_TAPS * N;
+    rt_ui08 *copy = (rt_ui08 *)(wv + RT_IMGF_TAPS * N);
+    rt_ui08 *ring = copy + (rt_cell)RT_IMGF_TAPS * tw;
+    rt_ui08 *orow = ring + (rt_cell)2 * vn * tw * 2;
+
+    for (c0 = 0; c0 < w; c0 += m)
+    {
+        m = RT_MIN(w - c0, tw);
+        nv = (m + J - 1) / J;
+
+        /* ring slot k holds virtual row v with (v + rv) % vn == k,
+         * duplicated at k + vn to make vertical taps contiguous */
+        for (v = -rv; v < h + vn - 1 - rv; v++)
+        {
+            y = RT_MIN(RT_MAX(v, 0), h - 1);
+            i = (v + rv) % vn;
+
+            for (d = 0; d < hn; d++)
+            {
+                img_pads(copy + (rt_cell)d * tw, src + (rt_cell)y * lds,
+                         w, c0 + d - rh, nv * J);
+            }
+
+            info->wgts = wh;
+            info->src0 = copy;
+            info->dst0 = ring + (rt_cell)i * tw * 2;
+            info->dst1 = ring + (rt_cell)(i + vn) * tw * 2;
+            info->sstr = (rt_cell)tw;
+            info->ncnt = nv;
+            info->tcnt = hn;
+            img_hcnv(info);
+
+            if (v < vn - 1 - rv)
+            {
+                continue;
+            }
+
+            y = v - (vn - 1 - rv);
+            i = (v + rv + 1) % vn;
+
+            info->wgts = wv;
+            info->src0 = ring + (rt_cell)i * tw * 2;
+            info->dst0 = orow;
+            info->sstr = (rt_cell)tw * 2;
+            info->ncnt = nv;
+            info->tcnt = vn;
+            img_vcnv(info);
+
+            for (i = 0; i < m; i++)
+            {
+                dst[(rt_cell)y * ldd + c0 + i] = orow[i];
+            }
+        }
+    }
+}
+
+/******************************************************************************/
+/*************************   BOX BLUR   ***************************************/
+/******************************************************************************/
+
+/* img_hbox (dst0 = (running sum of tcnt pixels of src0 + boff) / tcnt)
+ * reads: src0, dst0, ncnt, tcnt, bmul, boff, destroys icnt
+ * division is done as (s * bmul) >> 22, which is exact for s < 2^15
+ * and widths up to 2 * RT_IMGF_RMAX + 1, four results per 32-bit store */
+
+static
+rt_void img_hbox(rt_SIMD_IMGF *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, img_SRC0)
+        movxx_ld(Redi, Mebp, img_DST0)
+        movxx_rr(Recx, Resi)
+        movwx_ld(Reax, Mebp, img_BOFF)
+        movwx_ld(Redx, Mebp, img_TCNT)
+
+    LBL(100904) /* hbox_init */
+
+        addbz_ld(Reax, Mecx, DP(0x000))
+        addxx_ri(Recx, IB(1))
+        arjwx_ri(Redx, IB(1),
+        sub_x, NZ_x, 100904b) /* hbox_init */
+
+        movwx_ld(Redx, Mebp, img_NCNT)
+        movwx_st(Redx, Mebp, img_ICNT)
+
+    LBL(100905) /* hbox_word */
+
+        movwx_rr(Redx, Reax)
+        mulwx_ld(Redx, Mebp, img_BMUL)
+        shrwx_ri(Redx, IB(22))
+        img_APPB(Rebx, Redx)
+        addbz_ld(Reax, Mecx, DP(0x000))
+        subbz_ld(Reax, Mesi, DP(0x000))
+
+        movwx_rr(Redx, Reax)
+        mulwx_ld(Redx, Mebp, img_BMUL)
+        shrwx_ri(Redx, IB(22))
+        img_APPB(Rebx, Redx)
+        addbz_ld(Reax, Mecx, DP(0x001))
+        subbz_ld(Reax, Mesi, DP(0x001))
+
+        movwx_rr(Redx, Reax)
+        mulwx_ld(Redx, Mebp, img_BMUL)
+        shrwx_ri(Redx, IB(22))
+        img_APPB(Rebx, Redx)
+        addbz_ld(Reax, Mecx, DP(0x002))
+        subbz_ld(Reax, Mesi, DP(0x002))
+
+        movwx_rr(Redx, Reax)
+        mulwx_ld(Redx, Mebp, img_BMUL)
+        shrwx_ri(Redx, IB(22))
+        img_APPB(Rebx, Redx)
+        addbz_ld(Reax, Mecx, DP(0x003))
+        subbz_ld(Reax, Mesi, DP(0x003))
+
+        movwx_st(Rebx, Medi, DP(0x000))
+
+        addxx_ri(Recx, IB(4))
+        addxx_ri(Resi, IB(4))
+        addxx_ri(Redi, IB(4))
+        arjwx_mi(Mebp, img_ICNT, IB(1),
+        sub_x, NZ_x, 100905b) /* hbox_word */
+
+    ASM_LEAVE(info)
+}
+
+/* img_vbox (dst0 = (csum += src0 - src1) / width)
+ * reads: src0, src1, dst0, csum, ncnt, writes: csum, destroys icnt
+ * updates (even, odd) pairs of column sums, then divides them
+ * (plus bhlf) by 8 steps of binary long division with bdiv shifted right,
+ * sums stay below 2^15, thus signed compare is used (native on all targets),
+ * inverted quotient bits are shifted in from its masks, then flipped back */
+
+static
+rt_void img_vbox(rt_SIMD_IMGF *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, img_SRC0)
+        movxx_ld(Rebx, Mebp, img_SRC1)
+        movxx_ld(Recx, Mebp, img_CSUM)
+        movxx_ld(Redx, Mebp, img_DST0)
+        movwx_ld(Reax, Mebp, img_NCNT)
+        movwx_st(Reax, Mebp, img_ICNT)
+
+    LBL(100906) /* vbox_simd */
+
+        movmx_ld(Xmm1, Mecx, DP(Q*0x000))
+        movmx_ld(Xmm2, Mecx, DP(Q*0x010))
+        movmx_ld(Xmm3, Mesi, DP(Q*0x000))
+        movmx_rr(Xmm4, Xmm3)
+        andmx_ld(Xmm3, Mebp, img_MASK)
+        shrmx_ri(Xmm4, IB(8))
+        addmx_rr(Xmm1, Xmm3)
+        addmx_rr(Xmm2, Xmm4)
+        movmx_ld(Xmm3, Mebx, DP(Q*0x000))
+        movmx_rr(Xmm4, Xmm3)
+        andmx_ld(Xmm3, Mebp, img_MASK)
+        shrmx_ri(Xmm4, IB(8))
+        submx_rr(Xmm1, Xmm3)
+        submx_rr(Xmm2, Xmm4)
+        movmx_st(Xmm1, Mecx, DP(Q*0x000))
+        movmx_st(Xmm2, Mecx, DP(Q*0x010))
+
+        addmx_ld(Xmm1, Mebp, img_BHLF)
+        addmx_ld(Xmm2, Mebp, img_BHLF)
+        xormx_rr(Xmm5, Xmm5)
+        xormx_rr(Xmm7, Xmm7)
+        movmx_ld(Xmm6, Mebp, img_BDIV)
+        movwx_ri(Reax, IB(8))
+
+    LBL(100907) /* vbox_divs */
+
+        movmx_rr(Xmm3, Xmm6)
+        cgtmn_rr(Xmm3, Xmm1)
+        movmx_rr(Xmm4, Xmm3)
+        annmx_rr(Xmm4, Xmm6)
+        submx_rr(Xmm1, Xmm4)
+        shlmx_ri(Xmm5, IB(1))
+        submx_rr(Xmm5, Xmm3)
+
+        movmx_rr(Xmm3, Xmm6)
+        cgtmn_rr(Xmm3, Xmm2)
+        movmx_rr(Xmm4, Xmm3)
+        annmx_rr(Xmm4, Xmm6)
+        submx_rr(Xmm2, Xmm4)
+        shlmx_ri(Xmm7, IB(1))
+        submx_rr(Xmm7, Xmm3)
+
+        shrmx_ri(Xmm6, IB(1))
+        arjwx_ri(Reax, IB(1),
+        sub_x, NZ_x, 100907b) /* vbox_divs */
+
+        xormx_ld(Xmm5, Mebp, img_MASK)
+        xormx_ld(Xmm7, Mebp, img_MASK)
+        shlmx_ri(Xmm7, IB(8))
+        orrmx_rr(Xmm5, Xmm7)
+        movmx_st(Xmm5, Medx, DP(Q*0x000))
+
+        addxx_ri(Resi, IM(Q*0x010))
+        addxx_ri(Rebx, IM(Q*0x010))
+        addxx_ri(Recx, IM(Q*0x020))
+        addxx_ri(Redx, IM(Q*0x010))
+        arjwx_mi(Mebp, img_ICNT, IB(1),
+        sub_x, NZ_x, 100906b) /* vbox_simd */
+
+    ASM_LEAVE(info)
+}
+
+/*
+ * Set radius r of box blur (2 * r + 1) x (2 * r + 1), r is clamped
+ * to [0, RT_IMGF_RMAX], info->work must point to SIMD-aligned area
+ * of img_work(r) bytes or more.
+ * Structure must be initialized with ASM_INIT before the first use.
+ */
+static
+rt_void img_box_init(rt_SIMD_IMGF *info, rt_si32 r)
+{
+    rt_si32 i, n;
+
+    info->rads = RT_MIN(RT_MAX(r, 0), RT_IMGF_RMAX);
+    n = 2 * info->rads + 1;
+
+    info->bmul = ((1 << 22) + n - 1) / n;
+    info->boff = n / 2;
+
+    for (i = 0; i < N; i++)
+    {
+        info->mask[i] = 0x00FF;
+        info->bhlf[i] = (rt_ui16)(n / 2);
+        info->bdiv[i] = (rt_ui16)(n << 7);
+    }
+}
+
+/*
+ * Blur plane src (w x h pixels, lds bytes per row) into plane dst
+ * (ldd bytes per row) with radius set by img_box_init,
+ * neither plane needs to be SIMD-aligned, planes must not overlap.
+ */
+static
+rt_void img_box_run(rt_SIMD_IMGF *info, rt_ui08 *src, rt_ui08 *dst,
+                    rt_si32 w, rt_si32 h, rt_si32 lds, rt_si32 ldd)
+{
+    rt_si32 r = info->rads, n = 2 * r + 1;
+    rt_si32 tw = (RT_IMGF_TILE + J - 1) / J * J;
+    rt_si32 pw = (tw + 2 * RT_IMGF_RMAX + 1 + RT_SIMD_ALIGN - 1)
+                                    / RT_SIMD_ALIGN * RT_SIMD_ALIGN;
+    rt_si32 c0, i, m, nv, v, y;
+
+    rt_ui08 *pads = info->work;
+    rt_ui08 *ring = pads + pw;
+    rt_ui16 *csum = (rt_ui16 *)(ring + (rt_cell)(n + 1) * tw);
+    rt_ui08 *zero = (rt_ui08 *)(csum + tw);
+    rt_ui08 *orow = zero + tw;
+
+    for (i = 0; i < tw; i++)
+    {
+        zero[i] = 0;
+    }
+
+    for (c0 = 0; c0 < w; c0 += m)
+    {
+        m = RT_MIN(w - c0, tw);
+        nv = (m + J - 1) / J;
+
+        for (i = 0; i < nv * J; i++)
+        {
+            csum[i] = 0;
+        }
+
+        /* ring slot (v + r) % (n + 1) holds virtual row v,
+         * so that the row leaving the window isn't overwritten yet */
+        for (v = -r; v < h + r; v++)
+        {
+            y = RT_MIN(RT_MAX(v, 0), h - 1);
+
+            img_pads(pads, src + (rt_cell)y * lds, w, c0 - r, nv * J + n);
+
+            info->src0 = pads;
+            info->dst0 = ring + (rt_cell)((v + r) % (n + 1)) * tw;
+            info->ncnt = nv * J / 4;
+            info->tcnt = n;
+            img_hbox(info);
+
+            info->src0 = info->dst0;
+            info->src1 = v > r ?
+                         ring + (rt_cell)((v - r - 1) % (n + 1)) * tw : zero;
+            info->csum = csum;
+            info->dst0 = orow;
+            info->ncnt = nv;
+            img_vbox(info);
+
+            if (v < r)
+            {
+                continue;
+            }
+
+            y = v - r;
+
+            for (i = 0; i < m; i++)
+            {
+                dst[(rt_cell)y * ldd + c0 + i] = orow[i];
+            }
+        }
+    }
+}
+
+#endif /* RT_RTIMGF_H */
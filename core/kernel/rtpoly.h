@@ -0,0 +1,449 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2023 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTPOLY_H
+#define RT_RTPOLY_H
+
+#include "rtbase.h"
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rtpoly.h: polynomial evaluation meta-instructions and kernels
+ * in configurable cmdp* subset.
+ * Table of contents is provided below.
+ *
+ * hrnps_ld: degree-N polynomial via Horner's scheme (N dependent fma),
+ * estps_ld: degree-N polynomial via Estrin's scheme (log2 N deep fma tree),
+ * plyps_ld: one of the above selected at compile time with RT_POLY_ESTRIN,
+ *
+ * ply_horn: evaluate polynomial over an array with Horner's scheme,
+ * ply_estn: evaluate polynomial over an array with Estrin's scheme,
+ * ply_eval: one of the above selected at compile time with RT_POLY_ESTRIN.
+ *
+ * Coefficients are read from a table of broadcast SIMD-fields laid out
+ * the same way as general purpose constants in rt_SIMD_INFO (Q*0x010 apart),
+ * which is addressed with function-like macro CT(k) returning DP of c[k],
+ * so that polynomials can be embedded into any kernel structure.
+ * Both schemes use fmaps_** and follow its RT_SIMD_COMPAT_FMA fallbacks,
+ * results may differ in the last bits as the order of roundings differs.
+ *
+ * Horner's scheme issues fewer instructions and needs a single temporary,
+ * while Estrin's scheme shortens the critical path from N to about
+ * 2 + log2 N fma/mul latencies at the cost of 3 extra registers and
+ * a few extra multiplies, which pays off on wide out-of-order cores.
+ */
+
+/*----------------------------------------------------------------------------*/
+
+/*************************   POLYNOMIAL META-INSTRUCTIONS   *******************/
+
+/*************************   SIMD BACKEND STRUCTURE   *************************/
+
+/*************************   POLYNOMIAL KERNELS   *****************************/
+
+/*************************   POLYNOMIAL DRIVERS   *****************************/
+
+/*----------------------------------------------------------------------------*/
+
+/* RT_POLY_ESTRIN selects Estrin's scheme for plyps_ld and ply_eval,
+ * default is Estrin on targets with 16+ SIMD registers (wide OoO cores)
+ * and Horner on legacy 8-register targets (narrow/in-order cores) */
+#ifndef RT_POLY_ESTRIN
+#if RT_REGS >= 16
+#define RT_POLY_ESTRIN      1
+#else /* RT_REGS < 16 */
+#define RT_POLY_ESTRIN      0
+#endif /* RT_REGS */
+#endif /* RT_POLY_ESTRIN */
+
+/* max number of coefficients in kernel structure (degree 8) */
+#define RT_POLY_SIZE        9
+
+/******************************************************************************/
+/*************************   POLYNOMIAL META-INSTRUCTIONS   *******************/
+/******************************************************************************/
+
+/*
+ * Evaluate XD = c[0] + c[1] * XS + ... + c[N] * XS^N for literal N in 1..8
+ * with coefficients at CT(0)..CT(N) of MT, XS is preserved, XD must differ
+ * from XS and temporaries X1, X2, X3, X4 (destroyed), Horner uses only X1.
+ */
+
+#define hrnps_ld(N, XD, XS, X1, X2, X3, X4, MT, CT) /* destroys X1-X4 */     \
+        ply_HRN##N(W(XD), W(XS), W(X1), W(X2), W(X3), W(X4), W(MT), CT)
+
+#define estps_ld(N, XD, XS, X1, X2, X3, X4, MT, CT) /* destroys X1-X4 */     \
+        ply_EST##N(W(XD), W(XS), W(X1), W(X2), W(X3), W(X4), W(MT), CT)
+
+#if RT_POLY_ESTRIN
+
+#define plyps_ld(N, XD, XS, X1, X2, X3, X4, MT, CT) /* destroys X1-X4 */     \
+        estps_ld(N, W(XD), W(XS), W(X1), W(X2), W(X3), W(X4), W(MT), CT)
+
+#else /* RT_POLY_ESTRIN */
+
+#define plyps_ld(N, XD, XS, X1, X2, X3, X4, MT, CT) /* destroys X1-X4 */     \
+        hrnps_ld(N, W(XD), W(XS), W(X1), W(X2), W(X3), W(X4), W(MT), CT)
+
+#endif /* RT_POLY_ESTRIN */
+
+/*
+ * Horner's scheme: r = c[N], r = r * x + c[k] for k = N-1..0,
+ * alternates between XD and X1 to keep the accumulator out of fma sources.
+ */
+
+#define ply_HRN1(XD, XS, X1, X2, X3, X4, MT, CT)                            \
+        movpx_ld(W(X1), W(MT), CT(1))                                       \
+        movpx_ld(W(XD), W(MT), CT(0))                                       \
+        fmaps_rr(W(XD), W(X1), W(XS))
+
+#define ply_HRN2(XD, XS, X1, X2, X3, X4, MT, CT)                            \
+        movpx_ld(W(XD), W(MT), CT(2))                                       \
+        movpx_ld(W(X1), W(MT), CT(1))                                       \
+        fmaps_rr(W(X1), W(XD), W(XS))                                       \
+        movpx_ld(W(XD), W(MT), CT(0))                                       \
+        fmaps_rr(W(XD), W(X1), W(XS))
+
+#define ply_HRN3(XD, XS, X1, X2, X3, X4, MT, CT)                            \
+        movpx_ld(W(X1), W(MT), CT(3))                                       \
+        movpx_ld(W(XD), W(MT), CT(2))                                       \
+        fmaps_rr(W(XD), W(X1), W(XS))                                       \
+        movpx_ld(W(X1), W(MT), CT(1))                                       \
+        fmaps_rr(W(X1), W(XD), W(XS))                                       \
+        movpx_ld(W(XD), W(MT), CT(0))                                       \
+        fmaps_rr(W(XD), W(X1), W(XS))
+
+#define ply_HRN4(XD, XS, X1, X2, X3, X4, MT, CT)                            \
+        movpx_ld(W(XD), W(MT), CT(4))                                       \
+        movpx_ld(W(X1), W(MT), CT(3))                                       \
+        fmaps_rr(W(X1), W(XD), W(XS))                                       \
+        movpx_ld(W(XD), W(MT), CT(2))                                       \
+        fmaps_rr(W(XD), W(X1), W(XS))                                       \
+        movpx_ld(W(X1), W(MT), CT(1))                                       \
+        fmaps_rr(W(X1), W(XD), W(XS))                                       \
+        movpx_ld(W(XD), W(MT), CT(0))                                       \
+        fmaps_rr(W(XD), W(X1), W(XS))
+
+#define ply_HRN5(XD, XS, X1, X2, X3, X4, MT, CT)                            \
+        movpx_ld(W(X1), W(MT), CT(5))                                       \
+        movpx_ld(W(XD), W(MT), CT(4))                                       \
+        fmaps_rr(W(XD), W(X1), W(XS))                                       \
+        movpx_ld(W(X1), W(MT), CT(3))                                       \
+        fmaps_rr(W(X1), W(XD), W(XS))                                       \
+        movpx_ld(W(XD), W(MT), CT(2))                                       \
+        fmaps_rr(W(XD), W(X1), W(XS))                                       \
+        movpx_ld(W(X1), W(MT), CT(1))                                       \
+        fmaps_rr(W(X1), W(XD), W(XS))                                       \
+        movpx_ld(W(XD), W(MT), CT(0))                                       \
+        fmaps_rr(W(XD), W(X1), W(XS))
+
+#define ply_HRN6(XD, XS, X1, X2, X3, X4, MT, CT)                            \
+        movpx_ld(W(XD), W(MT), CT(6))                                       \
+        movpx_ld(W(X1), W(MT), CT(5))                                       \
+        fmaps_rr(W(X1), W(XD), W(XS))                                       \
+        movpx_ld(W(XD), W(MT), CT(4))                                       \
+        fmaps_rr(W(XD), W(X1), W(XS))                                       \
+        movpx_ld(W(X1), W(MT), CT(3))                                       \
+        fmaps_rr(W(X1), W(XD), W(XS))                                       \
+        movpx_ld(W(XD), W(MT), CT(2))                                       \
+        fmaps_rr(W(XD), W(X1), W(XS))                                       \
+        movpx_ld(W(X1), W(MT), CT(1))                                       \
+        fmaps_rr(W(X1), W(XD), W(XS))                                       \
+        movpx_ld(W(XD), W(MT), CT(0))                                       \
+        fmaps_rr(W(XD), W(X1), W(XS))
+
+#define ply_HRN7(XD, XS, X1, X2, X3, X4, MT, CT)                            \
+        movpx_ld(W(X1), W(MT), CT(7))                                       \
+        movpx_ld(W(XD), W(MT), CT(6))                                       \
+        fmaps_rr(W(XD), W(X1), W(XS))                                       \
+        movpx_ld(W(X1), W(MT), CT(5))                                       \
+        fmaps_rr(W(X1), W(XD), W(XS))                                       \
+        movpx_ld(W(XD), W(MT), CT(4))                                       \
+        fmaps_rr(W(XD), W(X1), W(XS))                                       \
+        movpx_ld(W(X1), W(MT), CT(3))                                       \
+        fmaps_rr(W(X1), W(XD), W(XS))                                       \
+        movpx_ld(W(XD), W(MT), CT(2))                                       \
+        fmaps_rr(W(XD), W(X1), W(XS))                                       \
+        movpx_ld(W(X1), W(MT), CT(1))                                       \
+        fmaps_rr(W(X1), W(XD), W(XS))                                       \
+        movpx_ld(W(XD), W(MT), CT(0))                                       \
+        fmaps_rr(W(XD), W(X1), W(XS))
+
+#define ply_HRN8(XD, XS, X1, X2, X3, X4, MT, CT)                            \
+        movpx_ld(W(XD), W(MT), CT(8))                                       \
+        movpx_ld(W(X1), W(MT), CT(7))                                       \
+        fmaps_rr(W(X1), W(XD), W(XS))                                       \
+        movpx_ld(W(XD), W(MT), CT(6))                                       \
+        fmaps_rr(W(XD), W(X1), W(XS))                                       \
+        movpx_ld(W(X1), W(MT), CT(5))                                       \
+        fmaps_rr(W(X1), W(XD), W(XS))                                       \
+        movpx_ld(W(XD), W(MT), CT(4))                                       \
+        fmaps_rr(W(XD), W(X1), W(XS))                                       \
+        movpx_ld(W(X1), W(MT), CT(3))                                       \
+        fmaps_rr(W(X1), W(XD), W(XS))                                       \
+        movpx_ld(W(XD), W(MT), CT(2))                                       \
+        fmaps_rr(W(XD), W(X1), W(XS))                                       \
+        movpx_ld(W(X1), W(MT), CT(1))                                       \
+        fmaps_rr(W(X1), W(XD), W(XS))                                       \
+        movpx_ld(W(XD), W(MT), CT(0))                                       \
+        fmaps_rr(W(XD), W(X1), W(XS))
+
+/*
+ * Estrin's scheme: pairs p[k] = c[2k] + c[2k+1] * x are independent,
+ * then combined with x^2 into quads and with x^4 (x^8) into the result,
+ * X1 holds x^2, X2 holds x^4 (x^8), X3, X4 hold partial sums.
+ */
+
+#define ply_EST1(XD, XS, X1, X2, X3, X4, MT, CT)                            \
+        movpx_ld(W(XD), W(MT), CT(0))                                       \
+        fmaps_ld(W(XD), W(XS), W(MT), CT(1))
+
+#define ply_EST2(XD, XS, X1, X2, X3, X4, MT, CT)                            \
+        movpx_ld(W(XD), W(MT), CT(0))                                       \
+        fmaps_ld(W(XD), W(XS), W(MT), CT(1))                                \
+        mulps3rr(W(X1), W(XS), W(XS))                                       \
+        fmaps_ld(W(XD), W(X1), W(MT), CT(2))
+
+#define ply_EST3(XD, XS, X1, X2, X3, X4, MT, CT)                            \
+        movpx_ld(W(XD), W(MT), CT(0))                                       \
+        fmaps_ld(W(XD), W(XS), W(MT), CT(1))                                \
+        movpx_ld(W(X3), W(MT), CT(2))                                       \
+        fmaps_ld(W(X3), W(XS), W(MT), CT(3))                                \
+        mulps3rr(W(X1), W(XS), W(XS))                                       \
+        fmaps_rr(W(XD), W(X3), W(X1))
+
+#define ply_EST4(XD, XS, X1, X2, X3, X4, MT, CT)                            \
+        movpx_ld(W(XD), W(MT), CT(0))                                       \
+        fmaps_ld(W(XD), W(XS), W(MT), CT(1))                                \
+        movpx_ld(W(X3), W(MT), CT(2))                                       \
+        fmaps_ld(W(X3), W(XS), W(MT), CT(3))                                \
+        mulps3rr(W(X1), W(XS), W(XS))                                       \
+        fmaps_rr(W(XD), W(X3), W(X1))                                       \
+        mulps3rr(W(X2), W(X1), W(X1))                                       \
+        fmaps_ld(W(XD), W(X2), W(MT), CT(4))
+
+#define ply_EST5(XD, XS, X1, X2, X3, X4, MT, CT)                            \
+        movpx_ld(W(XD), W(MT), CT(0))                                       \
+        fmaps_ld(W(XD), W(XS), W(MT), CT(1))                                \
+        movpx_ld(W(X3), W(MT), CT(2))                                       \
+        fmaps_ld(W(X3), W(XS), W(MT), CT(3))                                \
+        mulps3rr(W(X1), W(XS), W(XS))                                       \
+        fmaps_rr(W(XD), W(X3), W(X1))                                       \
+        movpx_ld(W(X3), W(MT), CT(4))                                       \
+        fmaps_ld(W(X3), W(XS), W(MT), CT(5))                                \
+        mulps3rr(W(X2), W(X1), W(X1))                                       \
+        fmaps_rr(W(XD), W(X3), W(X2))
+
+#define ply_EST6(XD, XS, X1, X2, X3, X4, MT, CT)                            \
+        movpx_ld(W(XD), W(MT), CT(0))                                       \
+        fmaps_ld(W(XD), W(XS), W(MT), CT(1))                                \
+        movpx_ld(W(X3), W(MT), CT(2))                                       \
+        fmaps_ld(W(X3), W(XS), W(MT), CT(3))                                \
+        mulps3rr(W(X1), W(XS), W(XS))                                       \
+        fmaps_rr(W(XD), W(X3), W(X1))                                       \
+        movpx_ld(W(X3), W(MT), CT(4))                                       \
+        fmaps_ld(W(X3), W(XS), W(MT), CT(5))                                \
+        fmaps_ld(W(X3), W(X1), W(MT), CT(6))                                \
+        mulps3rr(W(X2), W(X1), W(X1))                                       \
+        fmaps_rr(W(XD), W(X3), W(X2))
+
+#define ply_EST7(XD, XS, X1, X2, X3, X4, MT, CT)                            \
+        movpx_ld(W(XD), W(MT), CT(0))                                       \
+        fmaps_ld(W(XD), W(XS), W(MT), CT(1))                                \
+        movpx_ld(W(X3), W(MT), CT(2))                                       \
+        fmaps_ld(W(X3), W(XS), W(MT), CT(3))                                \
+        movpx_ld(W(X4), W(MT), CT(6))                                       \
+        fmaps_ld(W(X4), W(XS), W(MT), CT(7))                                \
+        mulps3rr(W(X1), W(XS), W(XS))                                       \
+        fmaps_rr(W(XD), W(X3), W(X1))                                       \
+        movpx_ld(W(X3), W(MT), CT(4))                                       \
+        fmaps_ld(W(X3), W(XS), W(MT), CT(5))                                \
+        fmaps_rr(W(X3), W(X4), W(X1))                                       \
+        mulps3rr(W(X2), W(X1), W(X1))                                       \
+        fmaps_rr(W(XD), W(X3), W(X2))
+
+#define ply_EST8(XD, XS, X1, X2, X3, X4, MT, CT)                            \
+        movpx_ld(W(XD), W(MT), CT(0))                                       \
+        fmaps_ld(W(XD), W(XS), W(MT), CT(1))                                \
+        movpx_ld(W(X3), W(MT), CT(2))                                       \
+        fmaps_ld(W(X3), W(XS), W(MT), CT(3))                                \
+        movpx_ld(W(X4), W(MT), CT(6))                                       \
+        fmaps_ld(W(X4), W(XS), W(MT), CT(7))                                \
+        mulps3rr(W(X1), W(XS), W(XS))                                       \
+        fmaps_rr(W(XD), W(X3), W(X1))                                       \
+        movpx_ld(W(X3), W(MT), CT(4))                                       \
+        fmaps_ld(W(X3), W(XS), W(MT), CT(5))                                \
+        fmaps_rr(W(X3), W(X4), W(X1))                                       \
+        mulps3rr(W(X2), W(X1), W(X1))                                       \
+        fmaps_rr(W(XD), W(X3), W(X2))                                       \
+        mulps_rr(W(X2), W(X2))                                              \
+        fmaps_ld(W(XD), W(X2), W(MT), CT(8))
+
+/******************************************************************************/
+/*************************   SIMD BACKEND STRUCTURE   *************************/
+/******************************************************************************/
+
+/*
+ * SIMD poly structure for ASM_ENTER/ASM_LEAVE contains coefficient table
+ * and kernel parameters set by drivers,
+ * must be initialized with ASM_INIT before use.
+ * Note that DP offsets below start where rt_SIMD_INFO ends (at Q*0x100).
+ * SIMD width is taken into account via S and Q from rtbase.h
+ * Structure is read-write in backend.
+ */
+struct rt_SIMD_POLY : public rt_SIMD_INFO
+{
+    /* polynomial coefficients (SIMD-fields) */
+
+    rt_real coef[RT_POLY_SIZE][S];  /* c[0] .. c[8], unused set to 0 */
+#define ply_COEF(k)         DP(Q*0x100+Q*0x010*(k))
+
+    /* kernel parameters (scalar) */
+
+    rt_real*src0;           /* input array, SIMD-aligned */
+#define ply_SRC0            DP(Q*0x190+0x000*P+E)
+
+    rt_real*dst0;           /* output array, SIMD-aligned */
+#define ply_DST0            DP(Q*0x190+0x004*P+E)
+
+    rt_si32 vcnt;           /* number of SIMD-vectors */
+#define ply_VCNT            DP(Q*0x190+0x008*P+0x000)
+
+};
+
+/******************************************************************************/
+/*************************   POLYNOMIAL KERNELS   *****************************/
+/******************************************************************************/
+
+/* ply_hrnr (degree 8 polynomial with Horner's scheme)
+ * reads: coef, src0, vcnt, writes: dst0 */
+
+static
+rt_void ply_hrnr(rt_SIMD_POLY *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, ply_SRC0)
+        movxx_ld(Redi, Mebp, ply_DST0)
+        movwx_ld(Recx, Mebp, ply_VCNT)
+
+    LBL(101800) /* hrn_loop */
+
+        movpx_ld(Xmm0, Mesi, DP(Q*0x000))
+        hrnps_ld(8, Xmm1, Xmm0, Xmm2, Xmm3, Xmm4, Xmm5, Mebp, ply_COEF)
+        movpx_st(Xmm1, Medi, DP(Q*0x000))
+
+        addxx_ri(Resi, IM(Q*0x010))
+        addxx_ri(Redi, IM(Q*0x010))
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 101800b) /* hrn_loop */
+
+    ASM_LEAVE(info)
+}
+
+/* ply_estr (degree 8 polynomial with Estrin's scheme)
+ * reads: coef, src0, vcnt, writes: dst0 */
+
+static
+rt_void ply_estr(rt_SIMD_POLY *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, ply_SRC0)
+        movxx_ld(Redi, Mebp, ply_DST0)
+        movwx_ld(Recx, Mebp, ply_VCNT)
+
+    LBL(101801) /* est_loop */
+
+        movpx_ld(Xmm0, Mesi, DP(Q*0x000))
+        estps_ld(8, Xmm1, Xmm0, Xmm2, Xmm3, Xmm4, Xmm5, Mebp, ply_COEF)
+        movpx_st(Xmm1, Medi, DP(Q*0x000))
+
+        addxx_ri(Resi, IM(Q*0x010))
+        addxx_ri(Redi, IM(Q*0x010))
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 101801b) /* est_loop */
+
+    ASM_LEAVE(info)
+}
+
+/******************************************************************************/
+/*************************   POLYNOMIAL DRIVERS   *****************************/
+/******************************************************************************/
+
+/*
+ * Set n coefficients c[0] .. c[n-1] (n <= RT_POLY_SIZE), clear the rest.
+ * Structure must be initialized with ASM_INIT before the first use.
+ */
+static
+rt_void ply_init(rt_SIMD_POLY *info, const rt_real *c, rt_si32 n)
+{
+    rt_real *p;
+    rt_si32 k;
+
+    for (k = 0; k < RT_POLY_SIZE; k++)
+    {
+        p = info->coef[k];
+        RT_SIMD_SET(p, k < n ? c[k] : (rt_real)0.0);
+    }
+}
+
+/*
+ * Evaluate polynomial over n elements of SIMD-aligned arrays s into d
+ * with kernel k, the tail shorter than S is evaluated with Horner in C.
+ */
+#define ply_CALL(info, k, d, s, n)                                          \
+    rt_si32 i, j, m = (n) / S;                                              \
+    rt_real r;                                                              \
+                                                                            \
+    if (m > 0)                                                              \
+    {                                                                       \
+        info->src0 = s;                                                     \
+        info->dst0 = d;                                                     \
+        info->vcnt = m;                                                     \
+        k(info);                                                            \
+    }                                                                       \
+                                                                            \
+    for (i = m * S; i < (n); i++)                                           \
+    {                                                                       \
+        r = info->coef[RT_POLY_SIZE - 1][0];                                \
+        for (j = RT_POLY_SIZE - 2; j >= 0; j--)                             \
+        {                                                                   \
+            r = r * s[i] + info->coef[j][0];                                \
+        }                                                                   \
+        d[i] = r;                                                           \
+    }
+
+/*
+ * Evaluate polynomial with Horner's scheme.
+ */
+static
+rt_void ply_horn(rt_SIMD_POLY *info, rt_real *d, rt_real *s, rt_si32 n)
+{
+    ply_CALL(info, ply_hrnr, d, s, n)
+}
+
+/*
+ * Evaluate polynomial with Estrin's scheme.
+ */
+static
+rt_void ply_estn(rt_SIMD_POLY *info, rt_real *d, rt_real *s, rt_si32 n)
+{
+    ply_CALL(info, ply_estr, d, s, n)
+}
+
+#undef ply_CALL
+
+#if RT_POLY_ESTRIN
+#define ply_eval            ply_estn
+#else /* RT_POLY_ESTRIN */
+#define ply_eval            ply_horn
+#endif /* RT_POLY_ESTRIN */
+
+#endif /* RT_RTPOLY_H */
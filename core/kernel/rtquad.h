@@ -0,0 +1,533 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2023 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTQUAD_H
+#define RT_RTQUAD_H
+
+#include "rtbase.h"
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rtquad.h: quad-precision (cmdu*) meta-instructions and kernels emulated
+ * as double-double numbers in pairs of cmdq* registers.
+ * Table of contents is provided below.
+ *
+ * Packed f128 value is kept as unevaluated sum hi + lo of two fp64 values
+ * (|lo| <= ulp(hi) / 2) in a pair of cmdq* registers (XH, XL), which gives
+ * 106-bit significand with fp64 exponent range at the cost of 10-30 SIMD ops
+ * per arithmetic op, instead of a few hundred scalar ops per softfloat op.
+ *
+ * addus_rr: X = X + Y (accurate, error-free TwoSum on both hi and lo parts),
+ * subus_rr: X = X - Y,
+ * mulus_rr: X = X * Y (error-free TwoProduct on hi parts, lo * lo dropped),
+ * divus_rr: X = X / Y (one correction step of long division),
+ * sqrus_rr: X = sqrt(Y) (one Newton step from fp64 sqrt),
+ * fmaus_rr: X = X + Y * Z (fused, TwoProduct on hi parts enters TwoSum
+ *           with X unrounded, renormalized once, lo * lo dropped).
+ *
+ * Relative error is within a few units of 2^-106 for mul, div and sqrt,
+ * within a few units of 2^-106 relative to |X| + |Y| for add and sub.
+ * All instructions destroy 2nd operand (Y, Z) and temporaries (X1, X2),
+ * all registers passed must be distinct.
+ *
+ * Error of fp64 product is obtained with fmsqs_** on targets with native fma,
+ * otherwise with Dekker's split (RT_QUAD_SPLIT), as x87 fallback for fmsqs_**
+ * rounds to 64-bit significand and thus isn't error-free for fp64 product.
+ * Split path spills to kernel structure via Mebp, which needs to point
+ * to rt_SIMD_QUAD (or structure with the same fields) as set by ASM_ENTER.
+ * Inputs are expected to be finite and well within fp64 range (< 2^996).
+ *
+ * Kernels work on packed arrays of T-wide packets of hi and lo SIMD-fields,
+ * element i has hi at [i / T * 2 * T + i % T] and lo T values after it,
+ * padding of the last packet is processed too, its results are unspecified.
+ */
+
+/*----------------------------------------------------------------------------*/
+
+/*************************   QUAD META-INSTRUCTIONS   *************************/
+
+/*************************   SIMD BACKEND STRUCTURE   *************************/
+
+/*************************   QUAD KERNELS   ***********************************/
+
+/*************************   QUAD DRIVERS   ***********************************/
+
+/*----------------------------------------------------------------------------*/
+
+/* RT_QUAD_SPLIT selects Dekker's split for error of fp64 product,
+ * default is split on x86 targets without native fma (SSE, AVX1),
+ * where fmsqs_** fallback isn't error-free, and fmsqs_** elsewhere */
+#ifndef RT_QUAD_SPLIT
+#if (defined RT_X32 || defined RT_X64) && !(RT_256X1 >= 2 || RT_128X1 == 16)
+#define RT_QUAD_SPLIT       1
+#else /* native fma */
+#define RT_QUAD_SPLIT       0
+#endif /* native fma */
+#endif /* RT_QUAD_SPLIT */
+
+#define RT_QUAD_SPLT        134217729.0 /* 2^27 + 1, Dekker's split factor */
+
+/******************************************************************************/
+/*************************   QUAD META-INSTRUCTIONS   *************************/
+/******************************************************************************/
+
+/* add (X = X + Y), destroys YH, YL, X1, X2 */
+
+#define addus_rr(XH, XL, YH, YL, X1, X2)                                    \
+        qud_TSUM(W(XH), W(YH), W(X1), W(X2))                                \
+        qud_TSUM(W(XL), W(YL), W(X1), W(X2))                                \
+        addqs_rr(W(YH), W(XL))                                              \
+        qud_FSUM(W(XH), W(YH), W(X1))                                       \
+        addqs_rr(W(YH), W(YL))                                              \
+        qud_FSUM(W(XH), W(YH), W(X1))                                       \
+        movqx_rr(W(XL), W(YH))
+
+/* sub (X = X - Y), destroys YH, YL, X1, X2 */
+
+#define subus_rr(XH, XL, YH, YL, X1, X2)                                    \
+        xorqx_ld(W(YH), Mebp, inf_GPC06_64)                                 \
+        xorqx_ld(W(YL), Mebp, inf_GPC06_64)                                 \
+        addus_rr(W(XH), W(XL), W(YH), W(YL), W(X1), W(X2))
+
+/* mul (X = X * Y), destroys YH, YL, X1, X2 */
+
+#define mulus_rr(XH, XL, YH, YL, X1, X2)                                    \
+        qud_CRSS(W(XL), W(XH), W(YH), W(YL), W(X1))                         \
+        movqx_rr(W(X1), W(XH))                                              \
+        mulqs_rr(W(X1), W(YH))                                              \
+        qud_TERR(W(X1), W(XL), W(XH), W(YH), W(YL))                         \
+        movqx_rr(W(XH), W(X1))                                              \
+        qud_FSUM(W(XH), W(XL), W(X1))
+
+/* div (X = X / Y), destroys YH, YL, X1, X2 */
+
+#define divus_rr(XH, XL, YH, YL, X1, X2)                                    \
+        movqx_rr(W(X1), W(XH))                                              \
+        divqs_rr(W(X1), W(YH))                                              \
+        movqx_rr(W(X2), W(X1))                                              \
+        mulqs_rr(W(X2), W(YL))                                              \
+        subqs_rr(W(XL), W(X2))                                              \
+        movqx_rr(W(X2), W(X1))                                              \
+        xorqx_ld(W(X2), Mebp, inf_GPC06_64)                                 \
+        movqx_rr(W(YL), W(X2))                                              \
+        mulqs_rr(W(YL), W(YH))                                              \
+        addqs_rr(W(XH), W(YL))                                              \
+        addqs_rr(W(XH), W(XL))                                              \
+        qud_TERR(W(YL), W(XH), W(X2), W(YH), W(XL))                         \
+        divqs_rr(W(XH), W(YH))                                              \
+        movqx_rr(W(XL), W(XH))                                              \
+        movqx_rr(W(XH), W(X1))                                              \
+        qud_FSUM(W(XH), W(XL), W(X1))
+
+/* sqr (X = sqrt(Y)), destroys YH, YL, X1, X2 */
+
+#define sqrus_rr(XH, XL, YH, YL, X1, X2)                                    \
+        sqrqs_rr(W(XH), W(YH))                                              \
+        movqx_rr(W(XL), W(XH))                                              \
+        movqx_rr(W(X2), W(XH))                                              \
+        xorqx_ld(W(X2), Mebp, inf_GPC06_64)                                 \
+        movqx_rr(W(X1), W(XL))                                              \
+        mulqs_rr(W(X1), W(X2))                                              \
+        addqs_rr(W(YH), W(X1))                                              \
+        addqs_rr(W(YH), W(YL))                                              \
+        qud_TERR(W(X1), W(YH), W(XL), W(X2), W(YL))                         \
+        mulqs_ld(W(YH), Mebp, inf_GPC02_64)                                 \
+        divqs_rr(W(YH), W(XH))                                              \
+        movqx_rr(W(XL), W(XH))                                              \
+        subqs_rr(W(XH), W(YH))                                              \
+        subqs_rr(W(XL), W(XH))                                              \
+        subqs_rr(W(XL), W(YH))
+
+/* fma (X = X + Y * Z), destroys YH, YL, ZH, ZL, X1, X2 */
+
+#define fmaus_rr(XH, XL, YH, YL, ZH, ZL, X1, X2)                            \
+        qud_CRSS(W(YL), W(YH), W(ZH), W(ZL), W(X1))                         \
+        movqx_rr(W(X1), W(YH))                                              \
+        mulqs_rr(W(X1), W(ZH))                                              \
+        xorqx_rr(W(ZL), W(ZL))                                              \
+        qud_TERR(W(X1), W(ZL), W(YH), W(ZH), W(X2))                         \
+        qud_TSUM(W(XH), W(X1), W(YH), W(ZH))                                \
+        qud_TSUM(W(XL), W(ZL), W(YH), W(ZH))                                \
+        addqs_rr(W(ZL), W(YL))                                              \
+        addqs_rr(W(X1), W(XL))                                              \
+        qud_FSUM(W(XH), W(X1), W(YH))                                       \
+        addqs_rr(W(X1), W(ZL))                                              \
+        qud_FSUM(W(XH), W(X1), W(YH))                                       \
+        movqx_rr(W(XL), W(X1))
+
+/* TwoSum (XS, XV) = (XS + XV, exact rounding error), destroys X1, X2 */
+
+#define qud_TSUM(XS, XV, X1, X2)                                            \
+        movqx_rr(W(X1), W(XS))                                              \
+        addqs_rr(W(XS), W(XV))                                              \
+        movqx_rr(W(X2), W(XS))                                              \
+        subqs_rr(W(X2), W(X1))                                              \
+        subqs_rr(W(XV), W(X2))                                              \
+        subqs_rr(W(X2), W(XS))                                              \
+        addqs_rr(W(X1), W(X2))                                              \
+        addqs_rr(W(XV), W(X1))
+
+/* FastTwoSum (XS, XV) = (XS + XV, exact rounding error) if |XS| >= |XV|,
+ * destroys X1 */
+
+#define qud_FSUM(XS, XV, X1)                                                \
+        movqx_rr(W(X1), W(XS))                                              \
+        addqs_rr(W(XS), W(XV))                                              \
+        subqs_rr(W(X1), W(XS))                                              \
+        addqs_rr(W(XV), W(X1))
+
+#if RT_QUAD_SPLIT == 0
+
+/* cross products (XL = XL * YH + XH * YL), destroys X1 */
+
+#define qud_CRSS(XL, XH, YH, YL, X1)                                        \
+        mulqs_rr(W(XL), W(YH))                                              \
+        fmaqs_rr(W(XL), W(XH), W(YL))
+
+/* product error (XC += XA * XB - XP), where XP = XA * XB rounded,
+ * destroys X1 */
+
+#define qud_TERR(XP, XC, XA, XB, X1)                                        \
+        movqx_rr(W(X1), W(XP))                                              \
+        fmsqs_rr(W(X1), W(XA), W(XB))                                       \
+        subqs_rr(W(XC), W(X1))
+
+#else  /* RT_QUAD_SPLIT == 1 */
+
+/* cross products (XL = XL * YH + XH * YL), destroys X1 */
+
+#define qud_CRSS(XL, XH, YH, YL, X1)                                        \
+        mulqs_rr(W(XL), W(YH))                                              \
+        movqx_rr(W(X1), W(XH))                                              \
+        mulqs_rr(W(X1), W(YL))                                              \
+        addqs_rr(W(XL), W(X1))
+
+/* product error (XC += XA * XB - XP), where XP = XA * XB rounded,
+ * splits XA = ah + al, XB = bh + bl into 26-bit halves with exact products,
+ * destroys XA, X1, uses qud_SCR0, qud_SCR1, qud_SCR2 */
+
+#define qud_TERR(XP, XC, XA, XB, X1)                                        \
+        movqx_st(W(XB), Mebp, qud_SCR1)                                     \
+        movqx_ld(W(X1), Mebp, qud_SPLT)                                     \
+        mulqs_rr(W(X1), W(XA))                                              \
+        movqx_st(W(XA), Mebp, qud_SCR0)                                     \
+        subqs_rr(W(XA), W(X1))                                              \
+        addqs_rr(W(X1), W(XA))                                              \
+        movqx_ld(W(XA), Mebp, qud_SCR0)                                     \
+        subqs_rr(W(XA), W(X1))                                              \
+        movqx_st(W(X1), Mebp, qud_SCR0)                                     \
+        movqx_ld(W(X1), Mebp, qud_SPLT)                                     \
+        mulqs_rr(W(X1), W(XB))                                              \
+        subqs_rr(W(XB), W(X1))                                              \
+        addqs_rr(W(X1), W(XB))                                              \
+        movqx_ld(W(XB), Mebp, qud_SCR1)                                     \
+        subqs_rr(W(XB), W(X1))                                              \
+        movqx_st(W(XB), Mebp, qud_SCR2)                                     \
+        mulqs_rr(W(XB), W(XA))                                              \
+        mulqs_rr(W(XA), W(X1))                                              \
+        mulqs_ld(W(X1), Mebp, qud_SCR0)                                     \
+        subqs_rr(W(X1), W(XP))                                              \
+        addqs_rr(W(X1), W(XA))                                              \
+        movqx_ld(W(XA), Mebp, qud_SCR2)                                     \
+        mulqs_ld(W(XA), Mebp, qud_SCR0)                                     \
+        addqs_rr(W(X1), W(XA))                                              \
+        addqs_rr(W(X1), W(XB))                                              \
+        addqs_rr(W(XC), W(X1))                                              \
+        movqx_ld(W(XB), Mebp, qud_SCR1)
+
+#endif /* RT_QUAD_SPLIT */
+
+/******************************************************************************/
+/*************************   SIMD BACKEND STRUCTURE   *************************/
+/******************************************************************************/
+
+/*
+ * SIMD quad structure for ASM_ENTER/ASM_LEAVE contains split constant,
+ * scratch fields for split path and kernel parameters set by drivers,
+ * must be initialized with ASM_INIT and qud_init before use.
+ * Note that DP offsets below start where rt_SIMD_INFO ends (at Q*0x100).
+ * SIMD width is taken into account via T and Q from rtbase.h
+ * Structure is read-write in backend.
+ */
+struct rt_SIMD_QUAD : public rt_SIMD_INFO
+{
+    /* internal constants and variables */
+
+    rt_fp64 splt[T];        /* Dekker's split factor RT_QUAD_SPLT */
+#define qud_SPLT            DP(Q*0x100)
+
+    rt_fp64 scr0[T];        /* scratchpad for split path */
+#define qud_SCR0            DP(Q*0x110)
+
+    rt_fp64 scr1[T];        /* scratchpad for split path */
+#define qud_SCR1            DP(Q*0x120)
+
+    rt_fp64 scr2[T];        /* scratchpad for split path */
+#define qud_SCR2            DP(Q*0x130)
+
+    /* kernel parameters (scalar) */
+
+    rt_fp64*src0;           /* 1st packed input (X) */
+#define qud_SRC0            DP(Q*0x140+0x000*P+E)
+
+    rt_fp64*src1;           /* 2nd packed input (Y) */
+#define qud_SRC1            DP(Q*0x140+0x004*P+E)
+
+    rt_fp64*src2;           /* 3rd packed input (Z), fma only */
+#define qud_SRC2            DP(Q*0x140+0x008*P+E)
+
+    rt_fp64*dst0;           /* packed output */
+#define qud_DST0            DP(Q*0x140+0x00C*P+E)
+
+    rt_si32 pcnt;           /* number of packets */
+#define qud_PCNT            DP(Q*0x140+0x010*P+0x000)
+
+};
+
+/******************************************************************************/
+/*************************   QUAD KERNELS   ***********************************/
+/******************************************************************************/
+
+/*
+ * Packet is T hi values followed by T lo values (Q*0x020 bytes),
+ * hi in Xmm1, lo in Xmm2, 2nd operand in Xmm3, Xmm4, temps Xmm5, Xmm6.
+ */
+#define qud_BINK(op, lb)                                                    \
+        movxx_ld(Resi, Mebp, qud_SRC0)                                      \
+        movxx_ld(Redi, Mebp, qud_SRC1)                                      \
+        movxx_ld(Rebx, Mebp, qud_DST0)                                      \
+        movwx_ld(Recx, Mebp, qud_PCNT)                                      \
+    LBL(lb)                                                                 \
+        movqx_ld(Xmm1, Mesi, DP(Q*0x000))                                   \
+        movqx_ld(Xmm2, Mesi, DP(Q*0x010))                                   \
+        movqx_ld(Xmm3, Medi, DP(Q*0x000))                                   \
+        movqx_ld(Xmm4, Medi, DP(Q*0x010))                                   \
+        op(Xmm1, Xmm2, Xmm3, Xmm4, Xmm5, Xmm6)                              \
+        movqx_st(Xmm1, Mebx, DP(Q*0x000))                                   \
+        movqx_st(Xmm2, Mebx, DP(Q*0x010))                                   \
+        addxx_ri(Resi, IM(Q*0x020))                                         \
+        addxx_ri(Redi, IM(Q*0x020))                                         \
+        addxx_ri(Rebx, IM(Q*0x020))                                         \
+        arjwx_ri(Recx, IB(1),                                               \
+        sub_x, NZ_x, lb##b)
+
+/* qud_addk (dst0 = src0 + src1)
+ * reads: src0, src1, pcnt, writes: dst0 */
+
+static
+rt_void qud_addk(rt_SIMD_QUAD *info)
+{
+    ASM_ENTER(info)
+
+        qud_BINK(addus_rr, 101900) /* add_loop */
+
+    ASM_LEAVE(info)
+}
+
+/* qud_subk (dst0 = src0 - src1)
+ * reads: src0, src1, pcnt, writes: dst0 */
+
+static
+rt_void qud_subk(rt_SIMD_QUAD *info)
+{
+    ASM_ENTER(info)
+
+        qud_BINK(subus_rr, 101901) /* sub_loop */
+
+    ASM_LEAVE(info)
+}
+
+/* qud_mulk (dst0 = src0 * src1)
+ * reads: src0, src1, pcnt, writes: dst0 */
+
+static
+rt_void qud_mulk(rt_SIMD_QUAD *info)
+{
+    ASM_ENTER(info)
+
+        qud_BINK(mulus_rr, 101902) /* mul_loop */
+
+    ASM_LEAVE(info)
+}
+
+/* qud_divk (dst0 = src0 / src1)
+ * reads: src0, src1, pcnt, writes: dst0 */
+
+static
+rt_void qud_divk(rt_SIMD_QUAD *info)
+{
+    ASM_ENTER(info)
+
+        qud_BINK(divus_rr, 101903) /* div_loop */
+
+    ASM_LEAVE(info)
+}
+
+/* qud_sqrk (dst0 = sqrt(src0))
+ * reads: src0, pcnt, writes: dst0 */
+
+static
+rt_void qud_sqrk(rt_SIMD_QUAD *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, qud_SRC0)
+        movxx_ld(Rebx, Mebp, qud_DST0)
+        movwx_ld(Recx, Mebp, qud_PCNT)
+
+    LBL(101904) /* sqr_loop */
+
+        movqx_ld(Xmm3, Mesi, DP(Q*0x000))
+        movqx_ld(Xmm4, Mesi, DP(Q*0x010))
+        sqrus_rr(Xmm1, Xmm2, Xmm3, Xmm4, Xmm5, Xmm6)
+        movqx_st(Xmm1, Mebx, DP(Q*0x000))
+        movqx_st(Xmm2, Mebx, DP(Q*0x010))
+
+        addxx_ri(Resi, IM(Q*0x020))
+        addxx_ri(Rebx, IM(Q*0x020))
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 101904b) /* sqr_loop */
+
+    ASM_LEAVE(info)
+}
+
+/* qud_fmak (dst0 = src2 + src0 * src1)
+ * reads: src0, src1, src2, pcnt, writes: dst0 */
+
+static
+rt_void qud_fmak(rt_SIMD_QUAD *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, qud_SRC0)
+        movxx_ld(Redi, Mebp, qud_SRC1)
+        movxx_ld(Redx, Mebp, qud_SRC2)
+        movxx_ld(Rebx, Mebp, qud_DST0)
+        movwx_ld(Recx, Mebp, qud_PCNT)
+
+    LBL(101905) /* fma_loop */
+
+        movqx_ld(Xmm1, Medx, DP(Q*0x000))
+        movqx_ld(Xmm2, Medx, DP(Q*0x010))
+        movqx_ld(Xmm3, Mesi, DP(Q*0x000))
+        movqx_ld(Xmm4, Mesi, DP(Q*0x010))
+        movqx_ld(Xmm5, Medi, DP(Q*0x000))
+        movqx_ld(Xmm6, Medi, DP(Q*0x010))
+        fmaus_rr(Xmm1, Xmm2, Xmm3, Xmm4, Xmm5, Xmm6, Xmm7, Xmm0)
+        movqx_st(Xmm1, Mebx, DP(Q*0x000))
+        movqx_st(Xmm2, Mebx, DP(Q*0x010))
+
+        addxx_ri(Resi, IM(Q*0x020))
+        addxx_ri(Redi, IM(Q*0x020))
+        addxx_ri(Redx, IM(Q*0x020))
+        addxx_ri(Rebx, IM(Q*0x020))
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 101905b) /* fma_loop */
+
+    ASM_LEAVE(info)
+}
+
+#undef qud_BINK
+
+/******************************************************************************/
+/*************************   QUAD DRIVERS   ***********************************/
+/******************************************************************************/
+
+/*
+ * Number of fp64 values in packed array of n elements (whole packets).
+ */
+#define qud_size(n)         (((n) + T - 1) / T * 2 * T)
+
+/*
+ * Set split constant.
+ * Structure must be initialized with ASM_INIT before the first use.
+ */
+static
+rt_void qud_init(rt_SIMD_QUAD *info)
+{
+    RT_SIMD_SET64(info->splt, RT_QUAD_SPLT);
+}
+
+/*
+ * Run kernel k over n elements of packed arrays.
+ */
+#define qud_CALL(info, k, d, a, b, c, n)                                    \
+    info->src0 = a;                                                         \
+    info->src1 = b;                                                         \
+    info->src2 = c;                                                         \
+    info->dst0 = d;                                                         \
+    info->pcnt = ((n) + T - 1) / T;                                         \
+    if (info->pcnt > 0)                                                     \
+    {                                                                       \
+        k(info);                                                            \
+    }
+
+/*
+ * Packed double-double add (d = a + b).
+ */
+static
+rt_void qud_add(rt_SIMD_QUAD *info, rt_fp64 *d, rt_fp64 *a, rt_fp64 *b,
+                                                            rt_si32 n)
+{
+    qud_CALL(info, qud_addk, d, a, b, RT_NULL, n)
+}
+
+/*
+ * Packed double-double sub (d = a - b).
+ */
+static
+rt_void qud_sub(rt_SIMD_QUAD *info, rt_fp64 *d, rt_fp64 *a, rt_fp64 *b,
+                                                            rt_si32 n)
+{
+    qud_CALL(info, qud_subk, d, a, b, RT_NULL, n)
+}
+
+/*
+ * Packed double-double mul (d = a * b).
+ */
+static
+rt_void qud_mul(rt_SIMD_QUAD *info, rt_fp64 *d, rt_fp64 *a, rt_fp64 *b,
+                                                            rt_si32 n)
+{
+    qud_CALL(info, qud_mulk, d, a, b, RT_NULL, n)
+}
+
+/*
+ * Packed double-double div (d = a / b).
+ */
+static
+rt_void qud_div(rt_SIMD_QUAD *info, rt_fp64 *d, rt_fp64 *a, rt_fp64 *b,
+                                                            rt_si32 n)
+{
+    qud_CALL(info, qud_divk, d, a, b, RT_NULL, n)
+}
+
+/*
+ * Packed double-double sqrt (d = sqrt(a)), a >= 0.
+ */
+static
+rt_void qud_sqr(rt_SIMD_QUAD *info, rt_fp64 *d, rt_fp64 *a, rt_si32 n)
+{
+    qud_CALL(info, qud_sqrk, d, a, RT_NULL, RT_NULL, n)
+}
+
+/*
+ * Packed double-double fma (d = a * b + c), product isn't rounded to
+ * double-double before the sum.
+ */
+static
+rt_void qud_fma(rt_SIMD_QUAD *info, rt_fp64 *d, rt_fp64 *a, rt_fp64 *b,
+                                                rt_fp64 *c, rt_si32 n)
+{
+    qud_CALL(info, qud_fmak, d, a, b, c, n)
+}
+
+#undef qud_CALL
+
+#endif /* RT_RTQUAD_H */
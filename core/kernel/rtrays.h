@@ -0,0 +1,729 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2023 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTRAYS_H
+#define RT_RTRAYS_H
+
+#include "rtbase.h"
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rtrays.h: ray/triangle and ray/box intersection of ray packets
+ * in configurable cmdp* subset.
+ * Table of contents is provided below.
+ *
+ * Rays are processed in packets of S rays (rt_SIMD_RPKT) with each field
+ * stored as a SIMD-vector (SoA), one lane per ray. Packets are prepared
+ * with ray_prep, which computes inverse directions via reciprocal estimate
+ * and one refinement step (rce*, rcs*), resets hit ids and hit masks.
+ * SIMD ISA has no broadcast from memory by design, therefore primitives
+ * tested against packets are pre-broadcast into SIMD-vectors in C/C++
+ * (ray_tset for triangles, ray_bset for boxes), while wide BVH nodes
+ * (ray_nset) hold S boxes in SoA form, tested against one ray at a time.
+ *
+ * ray_tris: Moller-Trumbore closest-hit of packets against triangles,
+ *           updates tmax, hit id and hit mask of each ray,
+ * ray_boxs: slab test any-hit of packets against boxes within [0, tmax),
+ *           writes hit mask of each ray (early-out when all lanes hit),
+ * ray_node: slab test of one ray against S boxes of each node,
+ *           writes entry distances (RT_INF if missed) and hit masks.
+ *
+ * Hit masks are all-ones/all-zeros lanes, which can be loaded by
+ * other kernels for mkjpx_rx(XS, NONE|FULL, lb) or and/ann blending.
+ * Inverse directions are biased by RT_RAYS_DMIN (with the sign
+ * of direction) in order to avoid 0 * inf in slab tests, while tmax
+ * must be finite as empty lanes of BVH nodes are placed at RT_INF.
+ */
+
+/*----------------------------------------------------------------------------*/
+
+/*************************   SIMD BACKEND STRUCTURE   *************************/
+
+/*************************   RAY PACKET STRUCTURES   **************************/
+
+/*************************   INTERSECTION KERNELS   ***************************/
+
+/*************************   INTERSECTION DRIVERS   ***************************/
+
+/*----------------------------------------------------------------------------*/
+
+/* magnitude added to ray directions before computing inverse */
+#define RT_RAYS_DMIN        1.0e-30
+
+/******************************************************************************/
+/*************************   SIMD BACKEND STRUCTURE   *************************/
+/******************************************************************************/
+
+/*
+ * SIMD rays structure for ASM_ENTER/ASM_LEAVE contains broadcast ray
+ * for ray_node, kernel constants and parameters set by drivers,
+ * must be initialized with ASM_INIT before use.
+ * Note that DP offsets below start where rt_SIMD_INFO ends (at Q*0x100).
+ * SIMD width is taken into account via S and Q from rtbase.h
+ * Structure is read-write in backend.
+ */
+struct rt_SIMD_RAYS : public rt_SIMD_INFO
+{
+    /* broadcast ray for ray_node (SIMD-fields) */
+
+    rt_real rox[S];         /* ray origin x */
+#define ray_ROX             DP(Q*0x100)
+
+    rt_real roy[S];         /* ray origin y */
+#define ray_ROY             DP(Q*0x110)
+
+    rt_real roz[S];         /* ray origin z */
+#define ray_ROZ             DP(Q*0x120)
+
+    rt_real rix[S];         /* ray inverse direction x */
+#define ray_RIX             DP(Q*0x130)
+
+    rt_real riy[S];         /* ray inverse direction y */
+#define ray_RIY             DP(Q*0x140)
+
+    rt_real riz[S];         /* ray inverse direction z */
+#define ray_RIZ             DP(Q*0x150)
+
+    rt_real rtm[S];         /* ray tmax, finite */
+#define ray_RTM             DP(Q*0x160)
+
+    /* kernel constants (SIMD-fields) */
+
+    rt_real dmin[S];        /* RT_RAYS_DMIN */
+#define ray_DMIN            DP(Q*0x170)
+
+    rt_real tinf[S];        /* RT_INF, entry distance of missed boxes */
+#define ray_TINF            DP(Q*0x180)
+
+    /* kernel parameters (scalar) */
+
+    rt_void*pkts;           /* ray packets, SIMD-aligned */
+#define ray_PKTS            DP(Q*0x190+0x000*P+E)
+
+    rt_void*prim;           /* primitives (triangles, boxes or nodes) */
+#define ray_PRIM            DP(Q*0x190+0x004*P+E)
+
+    rt_void*hits;           /* node hits (ray_node output) */
+#define ray_HITS            DP(Q*0x190+0x008*P+E)
+
+    rt_si32 pcnt;           /* number of ray packets */
+#define ray_PCNT            DP(Q*0x190+0x00C*P+0x000)
+
+    rt_si32 mcnt;           /* number of primitives */
+#define ray_MCNT            DP(Q*0x190+0x00C*P+0x004)
+
+};
+
+/******************************************************************************/
+/*************************   RAY PACKET STRUCTURES   **************************/
+/******************************************************************************/
+
+/*
+ * Packet of S rays, all fields are SIMD-vectors (SoA), one lane per ray.
+ * Fields ox..dz and tm are set by the caller, ix..iz, id, hm by ray_prep.
+ * Packets are addressed by kernels via DP offsets below.
+ */
+struct rt_SIMD_RPKT
+{
+    rt_real ox[S];          /* origin x */
+#define ray_OX              DP(Q*0x000)
+
+    rt_real oy[S];          /* origin y */
+#define ray_OY              DP(Q*0x010)
+
+    rt_real oz[S];          /* origin z */
+#define ray_OZ              DP(Q*0x020)
+
+    rt_real dx[S];          /* direction x */
+#define ray_DX              DP(Q*0x030)
+
+    rt_real dy[S];          /* direction y */
+#define ray_DY              DP(Q*0x040)
+
+    rt_real dz[S];          /* direction z */
+#define ray_DZ              DP(Q*0x050)
+
+    rt_real ix[S];          /* inverse direction x */
+#define ray_IX              DP(Q*0x060)
+
+    rt_real iy[S];          /* inverse direction y */
+#define ray_IY              DP(Q*0x070)
+
+    rt_real iz[S];          /* inverse direction z */
+#define ray_IZ              DP(Q*0x080)
+
+    rt_real tm[S];          /* tmax, distance to the closest hit */
+#define ray_TM              DP(Q*0x090)
+
+    rt_elem id[S];          /* id of the closest hit triangle, -1 if none */
+#define ray_ID              DP(Q*0x0A0)
+
+    rt_elem hm[S];          /* hit mask, all-ones if hit */
+#define ray_HM              DP(Q*0x0B0)
+
+};
+
+/*
+ * Triangle pre-broadcast into SIMD-vectors (by ray_tset),
+ * stored as 1st vertex and two edges originating from it.
+ */
+struct rt_SIMD_RTRI
+{
+    rt_real v0x[S];
+#define ray_V0X             DP(Q*0x000)
+
+    rt_real v0y[S];
+#define ray_V0Y             DP(Q*0x010)
+
+    rt_real v0z[S];
+#define ray_V0Z             DP(Q*0x020)
+
+    rt_real e1x[S];
+#define ray_E1X             DP(Q*0x030)
+
+    rt_real e1y[S];
+#define ray_E1Y             DP(Q*0x040)
+
+    rt_real e1z[S];
+#define ray_E1Z             DP(Q*0x050)
+
+    rt_real e2x[S];
+#define ray_E2X             DP(Q*0x060)
+
+    rt_real e2y[S];
+#define ray_E2Y             DP(Q*0x070)
+
+    rt_real e2z[S];
+#define ray_E2Z             DP(Q*0x080)
+
+    rt_elem tid[S];         /* triangle id */
+#define ray_TID             DP(Q*0x090)
+
+};
+
+/*
+ * Axis-aligned boxes, either one box pre-broadcast into all lanes
+ * (by ray_bset for ray_boxs) or S different boxes of a wide BVH node
+ * (by ray_nset for ray_node).
+ */
+struct rt_SIMD_RBOX
+{
+    rt_real mnx[S];
+#define ray_MNX             DP(Q*0x000)
+
+    rt_real mny[S];
+#define ray_MNY             DP(Q*0x010)
+
+    rt_real mnz[S];
+#define ray_MNZ             DP(Q*0x020)
+
+    rt_real mxx[S];
+#define ray_MXX             DP(Q*0x030)
+
+    rt_real mxy[S];
+#define ray_MXY             DP(Q*0x040)
+
+    rt_real mxz[S];
+#define ray_MXZ             DP(Q*0x050)
+
+};
+
+/*
+ * Hits of one ray against S boxes of a node (ray_node output).
+ */
+struct rt_SIMD_RHIT
+{
+    rt_real tn[S];          /* entry distance, RT_INF if missed */
+#define ray_TN              DP(Q*0x000)
+
+    rt_elem hm[S];          /* hit mask, all-ones if hit */
+#define ray_HN              DP(Q*0x010)
+
+};
+
+/******************************************************************************/
+/*************************   INTERSECTION KERNELS   ***************************/
+/******************************************************************************/
+
+/*
+ * Clip [tn, tf] in Xmm0, Xmm1 by the slab of box at MB with bounds at
+ * DN, DX for ray at MR with origin at DO and inverse direction at DI,
+ * uses Xmm2, Xmm3, Xmm4 as temporaries.
+ */
+#define ray_SLAB(MB, DN, DX, MR, DO, DI)                                    \
+        movpx_ld(Xmm2, W(MB), W(DN))                                        \
+        subps_ld(Xmm2, W(MR), W(DO))                                        \
+        mulps_ld(Xmm2, W(MR), W(DI))                                        \
+        movpx_ld(Xmm3, W(MB), W(DX))                                        \
+        subps_ld(Xmm3, W(MR), W(DO))                                        \
+        mulps_ld(Xmm3, W(MR), W(DI))                                        \
+        movpx_rr(Xmm4, Xmm2)                                                \
+        minps_rr(Xmm2, Xmm3)                                                \
+        maxps_rr(Xmm3, Xmm4)                                                \
+        maxps_rr(Xmm0, Xmm2)                                                \
+        minps_rr(Xmm1, Xmm3)
+
+/* ray_pckt (inverse directions, reset hits of pcnt packets)
+ * reads: dmin, pkts, pcnt, writes: pkts */
+
+static
+rt_void ray_pckt(rt_SIMD_RAYS *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, ray_PKTS)
+        movwx_ld(Recx, Mebp, ray_PCNT)
+
+        movpx_ld(Xmm6, Mebp, inf_GPC07)
+        xorpx_rr(Xmm7, Xmm7)
+
+    LBL(101500) /* pkt_loop */
+
+        movpx_ld(Xmm0, Mesi, ray_DX)
+        movpx_rr(Xmm1, Xmm0)
+        andpx_ld(Xmm1, Mebp, inf_GPC06)
+        orrpx_ld(Xmm1, Mebp, ray_DMIN)
+        addps_rr(Xmm0, Xmm1)
+        rceps_rr(Xmm2, Xmm0)
+        rcsps_rr(Xmm2, Xmm0) /* destroys Xmm0 */
+        movpx_st(Xmm2, Mesi, ray_IX)
+
+        movpx_ld(Xmm0, Mesi, ray_DY)
+        movpx_rr(Xmm1, Xmm0)
+        andpx_ld(Xmm1, Mebp, inf_GPC06)
+        orrpx_ld(Xmm1, Mebp, ray_DMIN)
+        addps_rr(Xmm0, Xmm1)
+        rceps_rr(Xmm2, Xmm0)
+        rcsps_rr(Xmm2, Xmm0) /* destroys Xmm0 */
+        movpx_st(Xmm2, Mesi, ray_IY)
+
+        movpx_ld(Xmm0, Mesi, ray_DZ)
+        movpx_rr(Xmm1, Xmm0)
+        andpx_ld(Xmm1, Mebp, inf_GPC06)
+        orrpx_ld(Xmm1, Mebp, ray_DMIN)
+        addps_rr(Xmm0, Xmm1)
+        rceps_rr(Xmm2, Xmm0)
+        rcsps_rr(Xmm2, Xmm0) /* destroys Xmm0 */
+        movpx_st(Xmm2, Mesi, ray_IZ)
+
+        movpx_st(Xmm6, Mesi, ray_ID)
+        movpx_st(Xmm7, Mesi, ray_HM)
+
+        addxx_ri(Resi, IM(Q*0x0C0))
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 101500b) /* pkt_loop */
+
+    ASM_LEAVE(info)
+}
+
+/* ray_trin (Moller-Trumbore closest-hit of pcnt packets vs mcnt triangles)
+ * reads: pkts, prim, pcnt, mcnt, writes: pkts (tm, id, hm) */
+
+static
+rt_void ray_trin(rt_SIMD_RAYS *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, ray_PKTS)
+        movwx_ld(Recx, Mebp, ray_PCNT)
+
+    LBL(101501) /* tri_pckt */
+
+        movxx_ld(Rebx, Mebp, ray_PRIM)
+        movwx_ld(Redx, Mebp, ray_MCNT)
+
+    LBL(101502) /* tri_loop */
+
+        /* p = d x e2 */
+        movpx_ld(Xmm0, Mesi, ray_DY)
+        mulps_ld(Xmm0, Mebx, ray_E2Z)
+        movpx_ld(Xmm3, Mesi, ray_DZ)
+        mulps_ld(Xmm3, Mebx, ray_E2Y)
+        subps_rr(Xmm0, Xmm3)
+        movpx_ld(Xmm1, Mesi, ray_DZ)
+        mulps_ld(Xmm1, Mebx, ray_E2X)
+        movpx_ld(Xmm3, Mesi, ray_DX)
+        mulps_ld(Xmm3, Mebx, ray_E2Z)
+        subps_rr(Xmm1, Xmm3)
+        movpx_ld(Xmm2, Mesi, ray_DX)
+        mulps_ld(Xmm2, Mebx, ray_E2Y)
+        movpx_ld(Xmm3, Mesi, ray_DY)
+        mulps_ld(Xmm3, Mebx, ray_E2X)
+        subps_rr(Xmm2, Xmm3)
+
+        /* r = 1 / (e1 . p), degenerate det yields inf/nan (no hit) */
+        movpx_ld(Xmm3, Mebx, ray_E1X)
+        mulps_rr(Xmm3, Xmm0)
+        movpx_ld(Xmm4, Mebx, ray_E1Y)
+        mulps_rr(Xmm4, Xmm1)
+        addps_rr(Xmm3, Xmm4)
+        movpx_ld(Xmm4, Mebx, ray_E1Z)
+        mulps_rr(Xmm4, Xmm2)
+        addps_rr(Xmm3, Xmm4)
+        movpx_ld(Xmm4, Mebp, inf_GPC01)
+        divps_rr(Xmm4, Xmm3)
+
+        /* s = o - v0 */
+        movpx_ld(Xmm5, Mesi, ray_OX)
+        subps_ld(Xmm5, Mebx, ray_V0X)
+        movpx_ld(Xmm6, Mesi, ray_OY)
+        subps_ld(Xmm6, Mebx, ray_V0Y)
+        movpx_ld(Xmm7, Mesi, ray_OZ)
+        subps_ld(Xmm7, Mebx, ray_V0Z)
+
+        /* u = (s . p) * r */
+        mulps_rr(Xmm0, Xmm5)
+        mulps_rr(Xmm1, Xmm6)
+        addps_rr(Xmm0, Xmm1)
+        mulps_rr(Xmm2, Xmm7)
+        addps_rr(Xmm0, Xmm2)
+        mulps_rr(Xmm0, Xmm4)
+
+        /* q = s x e1 */
+        movpx_rr(Xmm1, Xmm6)
+        mulps_ld(Xmm1, Mebx, ray_E1Z)
+        movpx_rr(Xmm2, Xmm7)
+        mulps_ld(Xmm2, Mebx, ray_E1Y)
+        subps_rr(Xmm1, Xmm2)
+        movpx_rr(Xmm2, Xmm7)
+        mulps_ld(Xmm2, Mebx, ray_E1X)
+        movpx_rr(Xmm3, Xmm5)
+        mulps_ld(Xmm3, Mebx, ray_E1Z)
+        subps_rr(Xmm2, Xmm3)
+        mulps_ld(Xmm5, Mebx, ray_E1Y)
+        mulps_ld(Xmm6, Mebx, ray_E1X)
+        subps_rr(Xmm5, Xmm6)
+
+        /* v = (d . q) * r */
+        movpx_ld(Xmm6, Mesi, ray_DX)
+        mulps_rr(Xmm6, Xmm1)
+        movpx_ld(Xmm7, Mesi, ray_DY)
+        mulps_rr(Xmm7, Xmm2)
+        addps_rr(Xmm6, Xmm7)
+        movpx_ld(Xmm7, Mesi, ray_DZ)
+        mulps_rr(Xmm7, Xmm5)
+        addps_rr(Xmm6, Xmm7)
+        mulps_rr(Xmm6, Xmm4)
+
+        /* t = (e2 . q) * r */
+        mulps_ld(Xmm1, Mebx, ray_E2X)
+        mulps_ld(Xmm2, Mebx, ray_E2Y)
+        addps_rr(Xmm1, Xmm2)
+        mulps_ld(Xmm5, Mebx, ray_E2Z)
+        addps_rr(Xmm1, Xmm5)
+        mulps_rr(Xmm1, Xmm4)
+
+        /* hit = u >= 0 & v >= 0 & u + v <= 1 & t > 0 & t < tm */
+        movpx_rr(Xmm2, Xmm0)
+        addps_rr(Xmm2, Xmm6)
+        xorpx_rr(Xmm3, Xmm3)
+        cgeps_rr(Xmm0, Xmm3)
+        cgeps_rr(Xmm6, Xmm3)
+        andpx_rr(Xmm0, Xmm6)
+        cleps_ld(Xmm2, Mebp, inf_GPC01)
+        andpx_rr(Xmm0, Xmm2)
+        movpx_rr(Xmm2, Xmm1)
+        cgtps_rr(Xmm2, Xmm3)
+        andpx_rr(Xmm0, Xmm2)
+        movpx_rr(Xmm2, Xmm1)
+        cltps_ld(Xmm2, Mesi, ray_TM)
+        andpx_rr(Xmm0, Xmm2)
+        mkjpx_rx(Xmm0, NONE, 101503f) /* tri_skip */
+
+        /* blend t and id into closest hit */
+        andpx_rr(Xmm1, Xmm0)
+        movpx_rr(Xmm2, Xmm0)
+        annpx_ld(Xmm2, Mesi, ray_TM)
+        orrpx_rr(Xmm1, Xmm2)
+        movpx_st(Xmm1, Mesi, ray_TM)
+        movpx_ld(Xmm1, Mebx, ray_TID)
+        andpx_rr(Xmm1, Xmm0)
+        movpx_rr(Xmm2, Xmm0)
+        annpx_ld(Xmm2, Mesi, ray_ID)
+        orrpx_rr(Xmm1, Xmm2)
+        movpx_st(Xmm1, Mesi, ray_ID)
+        orrpx_ld(Xmm0, Mesi, ray_HM)
+        movpx_st(Xmm0, Mesi, ray_HM)
+
+    LBL(101503) /* tri_skip */
+
+        addxx_ri(Rebx, IM(Q*0x0A0))
+        arjwx_ri(Redx, IB(1),
+        sub_x, NZ_x, 101502b) /* tri_loop */
+
+        addxx_ri(Resi, IM(Q*0x0C0))
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 101501b) /* tri_pckt */
+
+    ASM_LEAVE(info)
+}
+
+/* ray_slab (slab test any-hit of pcnt packets vs mcnt broadcast boxes)
+ * reads: pkts, prim, pcnt, mcnt, writes: pkts (hm) */
+
+static
+rt_void ray_slab(rt_SIMD_RAYS *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, ray_PKTS)
+        movwx_ld(Recx, Mebp, ray_PCNT)
+
+    LBL(101504) /* box_pckt */
+
+        movxx_ld(Rebx, Mebp, ray_PRIM)
+        movwx_ld(Redx, Mebp, ray_MCNT)
+        xorpx_rr(Xmm7, Xmm7)
+
+    LBL(101505) /* box_loop */
+
+        xorpx_rr(Xmm0, Xmm0)
+        movpx_ld(Xmm1, Mesi, ray_TM)
+        ray_SLAB(Mebx, ray_MNX, ray_MXX, Mesi, ray_OX, ray_IX)
+        ray_SLAB(Mebx, ray_MNY, ray_MXY, Mesi, ray_OY, ray_IY)
+        ray_SLAB(Mebx, ray_MNZ, ray_MXZ, Mesi, ray_OZ, ray_IZ)
+        cleps_rr(Xmm0, Xmm1)
+        orrpx_rr(Xmm7, Xmm0)
+        mkjpx_rx(Xmm7, FULL, 101506f) /* box_done */
+
+        addxx_ri(Rebx, IM(Q*0x060))
+        arjwx_ri(Redx, IB(1),
+        sub_x, NZ_x, 101505b) /* box_loop */
+
+    LBL(101506) /* box_done */
+
+        movpx_st(Xmm7, Mesi, ray_HM)
+
+        addxx_ri(Resi, IM(Q*0x0C0))
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 101504b) /* box_pckt */
+
+    ASM_LEAVE(info)
+}
+
+/* ray_wide (slab test of broadcast ray vs S boxes of mcnt nodes)
+ * reads: rox..rtm, tinf, prim, mcnt, writes: hits */
+
+static
+rt_void ray_wide(rt_SIMD_RAYS *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Rebx, Mebp, ray_PRIM)
+        movxx_ld(Redi, Mebp, ray_HITS)
+        movwx_ld(Recx, Mebp, ray_MCNT)
+
+    LBL(101507) /* nod_loop */
+
+        xorpx_rr(Xmm0, Xmm0)
+        movpx_ld(Xmm1, Mebp, ray_RTM)
+        ray_SLAB(Mebx, ray_MNX, ray_MXX, Mebp, ray_ROX, ray_RIX)
+        ray_SLAB(Mebx, ray_MNY, ray_MXY, Mebp, ray_ROY, ray_RIY)
+        ray_SLAB(Mebx, ray_MNZ, ray_MXZ, Mebp, ray_ROZ, ray_RIZ)
+        movpx_rr(Xmm5, Xmm0)
+        cleps_rr(Xmm5, Xmm1)
+        andpx_rr(Xmm0, Xmm5)
+        movpx_rr(Xmm6, Xmm5)
+        annpx_ld(Xmm6, Mebp, ray_TINF)
+        orrpx_rr(Xmm0, Xmm6)
+        movpx_st(Xmm0, Medi, ray_TN)
+        movpx_st(Xmm5, Medi, ray_HN)
+
+        addxx_ri(Rebx, IM(Q*0x060))
+        addxx_ri(Redi, IM(Q*0x020))
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 101507b) /* nod_loop */
+
+    ASM_LEAVE(info)
+}
+
+/******************************************************************************/
+/*************************   INTERSECTION DRIVERS   ***************************/
+/******************************************************************************/
+
+/*
+ * Set kernel constants.
+ * Structure must be initialized with ASM_INIT before the first use.
+ */
+static
+rt_void ray_init(rt_SIMD_RAYS *info)
+{
+    RT_SIMD_SET(info->dmin, (rt_real)RT_RAYS_DMIN);
+    RT_SIMD_SET(info->tinf, RT_INF);
+}
+
+/*
+ * Return inverse of direction component d biased by RT_RAYS_DMIN,
+ * scalar counterpart of ray_pckt (computed exactly).
+ */
+static
+rt_real ray_rcpd(rt_real d)
+{
+    return (rt_real)1.0 / (d + (d < 0 ? (rt_real)-RT_RAYS_DMIN :
+                                        (rt_real)+RT_RAYS_DMIN));
+}
+
+/*
+ * Prepare n packets in pk (with origins, directions and tmax set)
+ * for intersection: inverse directions, hit ids -1, hit masks 0.
+ */
+static
+rt_void ray_prep(rt_SIMD_RAYS *info, rt_SIMD_RPKT *pk, rt_si32 n)
+{
+    if (n <= 0)
+    {
+        return;
+    }
+
+    info->pkts = pk;
+    info->pcnt = n;
+    ray_pckt(info);
+}
+
+/*
+ * Broadcast m triangles given by 3 vertices (9 values each) from v
+ * into t, triangle ids are set to j0 + index.
+ */
+static
+rt_void ray_tset(rt_SIMD_RTRI *t, const rt_real *v, rt_si32 m, rt_elem j0)
+{
+    rt_si32 j;
+
+    for (j = 0; j < m; j++, v += 9)
+    {
+        RT_SIMD_SET(t[j].v0x, v[0]);
+        RT_SIMD_SET(t[j].v0y, v[1]);
+        RT_SIMD_SET(t[j].v0z, v[2]);
+        RT_SIMD_SET(t[j].e1x, v[3] - v[0]);
+        RT_SIMD_SET(t[j].e1y, v[4] - v[1]);
+        RT_SIMD_SET(t[j].e1z, v[5] - v[2]);
+        RT_SIMD_SET(t[j].e2x, v[6] - v[0]);
+        RT_SIMD_SET(t[j].e2y, v[7] - v[1]);
+        RT_SIMD_SET(t[j].e2z, v[8] - v[2]);
+        RT_SIMD_SET(t[j].tid, j0 + j);
+    }
+}
+
+/*
+ * Broadcast m boxes given by min and max corners (6 values each)
+ * from v into b.
+ */
+static
+rt_void ray_bset(rt_SIMD_RBOX *b, const rt_real *v, rt_si32 m)
+{
+    rt_si32 j;
+
+    for (j = 0; j < m; j++, v += 6)
+    {
+        RT_SIMD_SET(b[j].mnx, v[0]);
+        RT_SIMD_SET(b[j].mny, v[1]);
+        RT_SIMD_SET(b[j].mnz, v[2]);
+        RT_SIMD_SET(b[j].mxx, v[3]);
+        RT_SIMD_SET(b[j].mxy, v[4]);
+        RT_SIMD_SET(b[j].mxz, v[5]);
+    }
+}
+
+/*
+ * Store k (up to S) boxes given by min and max corners (6 values each)
+ * from v into lanes of node b, unused lanes are placed at RT_INF.
+ */
+static
+rt_void ray_nset(rt_SIMD_RBOX *b, const rt_real *v, rt_si32 k)
+{
+    rt_si32 i;
+
+    for (i = 0; i < S; i++)
+    {
+        if (i < k)
+        {
+            b->mnx[i] = v[6*i+0];
+            b->mny[i] = v[6*i+1];
+            b->mnz[i] = v[6*i+2];
+            b->mxx[i] = v[6*i+3];
+            b->mxy[i] = v[6*i+4];
+            b->mxz[i] = v[6*i+5];
+        }
+        else
+        {
+            b->mnx[i] = b->mny[i] = b->mnz[i] = RT_INF;
+            b->mxx[i] = b->mxy[i] = b->mxz[i] = RT_INF;
+        }
+    }
+}
+
+/*
+ * Closest-hit of n packets in pk (prepared with ray_prep) against
+ * m triangles in t (broadcast with ray_tset).
+ */
+static
+rt_void ray_tris(rt_SIMD_RAYS *info, rt_SIMD_RPKT *pk, rt_si32 n,
+                 rt_SIMD_RTRI *t, rt_si32 m)
+{
+    if (n <= 0 || m <= 0)
+    {
+        return;
+    }
+
+    info->pkts = pk;
+    info->prim = t;
+    info->pcnt = n;
+    info->mcnt = m;
+    ray_trin(info);
+}
+
+/*
+ * Any-hit of n packets in pk (prepared with ray_prep) against
+ * m boxes in b (broadcast with ray_bset) within [0, tmax),
+ * overwrites hit masks of packets.
+ */
+static
+rt_void ray_boxs(rt_SIMD_RAYS *info, rt_SIMD_RPKT *pk, rt_si32 n,
+                 rt_SIMD_RBOX *b, rt_si32 m)
+{
+    if (n <= 0 || m <= 0)
+    {
+        return;
+    }
+
+    info->pkts = pk;
+    info->prim = b;
+    info->pcnt = n;
+    info->mcnt = m;
+    ray_slab(info);
+}
+
+/*
+ * Test ray with origin o, direction d and finite tmax against
+ * m nodes in b (set with ray_nset), writes m hits records to h.
+ */
+static
+rt_void ray_node(rt_SIMD_RAYS *info, const rt_real *o, const rt_real *d,
+                 rt_real tmax, rt_SIMD_RBOX *b, rt_si32 m, rt_SIMD_RHIT *h)
+{
+    if (m <= 0)
+    {
+        return;
+    }
+
+    RT_SIMD_SET(info->rox, o[0]);
+    RT_SIMD_SET(info->roy, o[1]);
+    RT_SIMD_SET(info->roz, o[2]);
+    RT_SIMD_SET(info->rix, ray_rcpd(d[0]));
+    RT_SIMD_SET(info->riy, ray_rcpd(d[1]));
+    RT_SIMD_SET(info->riz, ray_rcpd(d[2]));
+    RT_SIMD_SET(info->rtm, tmax);
+
+    info->prim = b;
+    info->hits = h;
+    info->mcnt = m;
+    ray_wide(info);
+}
+
+#endif /* RT_RTRAYS_H */
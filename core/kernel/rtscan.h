@@ -0,0 +1,789 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2023 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTSCAN_H
+#define RT_RTSCAN_H
+
+#include "rtbase.h"
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rtscan.h: byte search primitives in cmdm*_b (byte) subset.
+ * Table of contents is provided below.
+ *
+ * Drivers: scn_memchr, scn_memrchr, scn_strlen (libc semantics),
+ * scn_anychr (first of up to RT_SCAN_NDLS bytes from a set)
+ * and scn_memmem (substring search), take rt_SIMD_SCAN structure
+ * initialized with ASM_INIT as the first argument.
+ *
+ * Kernels scan groups of 4 SIMD registers (4 * J bytes), byte comparison
+ * results of the group are merged and checked with a single mkjmb_rx,
+ * the first group with a match is stored to the mask fields, where
+ * the kernel finds exact position of the first (or the last) match
+ * with a word-at-a-time bit scan (ctz/clz) and returns it in rptr.
+ * Set scans read groups aligned to their size, which never cross page
+ * boundaries, thus reading bytes before the start and past the end
+ * of the range (within the same group) is safe, although memory checking
+ * tools may report such overreads, drivers discard matches out of range.
+ *
+ * As kernel entry/exit saves and restores SIMD registers, the first
+ * RT_SCAN_HEAD bytes (up to the group boundary) are checked
+ * with word-at-a-time test in C/C++, which keeps short distances
+ * (such as lines of text) fast.
+ *
+ * Substring search compares the first byte of the needle at candidate
+ * positions and the last byte of the needle at the same positions
+ * offset by its length in one pass (using unaligned muvmx_ld loads),
+ * the kernel returns the first candidate matching both ends,
+ * then C/C++ driver compares the middle of the needle and resumes
+ * the scan from the next position if it doesn't match.
+ */
+
+/*----------------------------------------------------------------------------*/
+
+/*************************   SIMD BACKEND STRUCTURE   *************************/
+
+/*************************   SCAN KERNELS   ***********************************/
+
+/*************************   SCAN DRIVERS   ***********************************/
+
+/*----------------------------------------------------------------------------*/
+
+/* RT_SCAN_LIBC forwards scans to host libc (memchr, strlen, memrchr
+ * and memmem on Linux), on by default only where byte subset (cmdm*_b)
+ * is emulated through memory (AVX1, AVX512F without BW), 0 - use kernels */
+#ifndef RT_SCAN_LIBC
+#if (defined RT_X32 || defined RT_X64) && ((RT_SIMD == 256 && RT_256X1 == 1) \
+ || (RT_SIMD == 512 && (RT_512X1 == 1 || RT_512X1 == 4 || RT_256X2 == 1))  \
+ || (RT_SIMD == 1024 && RT_512X2 == 1) || (RT_SIMD == 2048 && RT_512X4 == 1))
+#define RT_SCAN_LIBC        1
+#else /* native byte subset */
+#define RT_SCAN_LIBC        0
+#endif /* native byte subset */
+#endif /* RT_SCAN_LIBC */
+
+/* max number of bytes in a set for scn_anychr */
+#define RT_SCAN_NDLS        8
+
+/* number of bytes checked in C/C++ before calling kernels */
+#define RT_SCAN_HEAD        128
+
+/* max number of groups scanned per kernel call */
+#define RT_SCAN_GCNT        0x40000000
+
+/* first (scn_FRST) and last (scn_LAST) matching byte in a 32-bit word
+ * of byte masks, RG = number of zero bits before (after) the byte */
+#if RT_ENDIAN == 0
+#define scn_FRST(RG)        ctzwx_rr(W(RG), W(RG))
+#define scn_LAST(RG)        clzwx_rr(W(RG), W(RG))
+#else  /* RT_ENDIAN */
+#define scn_FRST(RG)        clzwx_rr(W(RG), W(RG))
+#define scn_LAST(RG)        ctzwx_rr(W(RG), W(RG))
+#endif /* RT_ENDIAN */
+
+/******************************************************************************/
+/*************************   SIMD BACKEND STRUCTURE   *************************/
+/******************************************************************************/
+
+/*
+ * SIMD scan structure for ASM_ENTER/ASM_LEAVE contains broadcast needles,
+ * byte masks of the last group with a match and kernel parameters
+ * set by drivers, must be initialized with ASM_INIT before use.
+ * Note that DP offsets below start where rt_SIMD_INFO ends (at Q*0x100).
+ * SIMD width is taken into account via J and Q from rtbase.h
+ * Structure is read-write in backend.
+ */
+struct rt_SIMD_SCAN : public rt_SIMD_INFO
+{
+    /* kernel constants (SIMD-fields) */
+
+    rt_ui08 ndl0[J];        /* 1st needle byte (broadcast) */
+#define scn_NDL0            DP(Q*0x100)
+
+    rt_ui08 ndl1[J];        /* 2nd needle byte (broadcast) */
+#define scn_NDL1            DP(Q*0x110)
+
+    rt_ui08 ndl2[J];        /* 3rd needle byte (broadcast) */
+#define scn_NDL2            DP(Q*0x120)
+
+    rt_ui08 ndl3[J];        /* 4th needle byte (broadcast) */
+#define scn_NDL3            DP(Q*0x130)
+
+    rt_ui08 ndl4[J];        /* 5th needle byte (broadcast) */
+#define scn_NDL4            DP(Q*0x140)
+
+    rt_ui08 ndl5[J];        /* 6th needle byte (broadcast) */
+#define scn_NDL5            DP(Q*0x150)
+
+    rt_ui08 ndl6[J];        /* 7th needle byte (broadcast) */
+#define scn_NDL6            DP(Q*0x160)
+
+    rt_ui08 ndl7[J];        /* 8th needle byte (broadcast) */
+#define scn_NDL7            DP(Q*0x170)
+
+    /* kernel temporaries (SIMD-fields) */
+
+    rt_ui08 msk0[J];        /* byte masks of the group, 1st register */
+#define scn_MSK0            DP(Q*0x180)
+
+    rt_ui08 msk1[J];        /* byte masks of the group, 2nd register */
+#define scn_MSK1            DP(Q*0x190)
+
+    rt_ui08 msk2[J];        /* byte masks of the group, 3rd register */
+#define scn_MSK2            DP(Q*0x1A0)
+
+    rt_ui08 msk3[J];        /* byte masks of the group, 4th register */
+#define scn_MSK3            DP(Q*0x1B0)
+
+    /* kernel parameters (scalar) */
+
+    rt_ui08*sptr;           /* 1st group to scan */
+#define scn_SPTR            DP(Q*0x1C0+0x000*P+E)
+
+    rt_ui08*rptr;           /* 1st (last) match, unchanged if none */
+#define scn_RPTR            DP(Q*0x1C0+0x004*P+E)
+
+    rt_cell step;           /* group step in bytes (negative backwards) */
+#define scn_STEP            DP(Q*0x1C0+0x008*P+E)
+
+    rt_cell loff;           /* offset of the last byte of the needle */
+#define scn_LOFF            DP(Q*0x1C0+0x00C*P+E)
+
+    rt_si32 gcnt;           /* max number of groups to scan */
+#define scn_GCNT            DP(Q*0x1C0+0x010*P+0x000)
+
+    rt_si32 ncnt;           /* number of needles (1 to RT_SCAN_NDLS) */
+#define scn_NCNT            DP(Q*0x1C0+0x010*P+0x004)
+
+    rt_si32 back;           /* 1 - return the last match in the group */
+#define scn_BACK            DP(Q*0x1C0+0x010*P+0x008)
+
+};
+
+/******************************************************************************/
+/*************************   SCAN KERNELS   ***********************************/
+/******************************************************************************/
+
+/* scn_chrs (find the first or the last byte from a set of ncnt needles)
+ * reads: ndl0-ndl7, sptr, step, gcnt, ncnt, back,
+ * writes: msk0-msk3, rptr (if found)
+ * sets of up to 4 bytes are compared from registers only,
+ * larger sets compare the rest from memory */
+
+static
+rt_void scn_chrs(rt_SIMD_SCAN *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, scn_SPTR)
+        movwx_ld(Recx, Mebp, scn_GCNT)
+
+        movmx_ld(Xmm4, Mebp, scn_NDL0)
+        movmx_ld(Xmm5, Mebp, scn_NDL1)
+        movmx_ld(Xmm6, Mebp, scn_NDL2)
+        movmx_ld(Xmm7, Mebp, scn_NDL3)
+
+        cmjwx_mi(Mebp, scn_NCNT, IB(4),
+        /* if */ GT_x, 101205f) /* chrs_grp8 */
+        cmjwx_mi(Mebp, scn_NCNT, IB(1),
+        /* if */ GT_x, 101203f) /* chrs_grp4 */
+
+    LBL(101200) /* chrs_grp1 */
+
+        movmx_rr(Xmm0, Xmm4)
+        ceqmb_ld(Xmm0, Mesi, DP(Q*0x000))
+        movmx_rr(Xmm1, Xmm4)
+        ceqmb_ld(Xmm1, Mesi, DP(Q*0x010))
+        movmx_rr(Xmm2, Xmm4)
+        ceqmb_ld(Xmm2, Mesi, DP(Q*0x020))
+        movmx_rr(Xmm3, Xmm4)
+        ceqmb_ld(Xmm3, Mesi, DP(Q*0x030))
+        movmx_rr(Xmm5, Xmm0)
+        orrmx_rr(Xmm5, Xmm1)
+        movmx_rr(Xmm6, Xmm2)
+        orrmx_rr(Xmm6, Xmm3)
+        orrmx_rr(Xmm5, Xmm6)
+        mkjmb_rx(Xmm5, NONE, 101201f) /* chrs_nxt1 */
+
+        movmx_st(Xmm0, Mebp, scn_MSK0)
+        movmx_st(Xmm1, Mebp, scn_MSK1)
+        movmx_st(Xmm2, Mebp, scn_MSK2)
+        movmx_st(Xmm3, Mebp, scn_MSK3)
+        jmpxx_lb(101210f) /* chrs_find */
+
+    LBL(101201) /* chrs_nxt1 */
+
+        addxx_ld(Resi, Mebp, scn_STEP)
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 101200b) /* chrs_grp1 */
+
+        jmpxx_lb(101216f) /* chrs_done */
+
+    LBL(101203) /* chrs_grp4 */
+
+        xormx_rr(Xmm3, Xmm3)
+        movxx_ri(Reax, IB(0))
+
+    LBL(101204) /* chrs_vec4 */
+
+        movmx_ld(Xmm0, Iesi, DP(Q*0x000))
+        movmx_rr(Xmm1, Xmm0)
+        ceqmb_rr(Xmm1, Xmm4)
+        movmx_rr(Xmm2, Xmm0)
+        ceqmb_rr(Xmm2, Xmm5)
+        orrmx_rr(Xmm1, Xmm2)
+        movmx_rr(Xmm2, Xmm0)
+        ceqmb_rr(Xmm2, Xmm6)
+        orrmx_rr(Xmm1, Xmm2)
+        ceqmb_rr(Xmm0, Xmm7)
+        orrmx_rr(Xmm1, Xmm0)
+        movmx_st(Xmm1, Iebp, scn_MSK0)
+        orrmx_rr(Xmm3, Xmm1)
+
+        addxx_ri(Reax, IM(Q*0x010))
+        cmjxx_ri(Reax, IM(Q*0x040),
+        /* if */ LT_x, 101204b) /* chrs_vec4 */
+
+        mkjmb_rx(Xmm3, NONE, 101206f) /* chrs_nxt4 */
+        jmpxx_lb(101210f) /* chrs_find */
+
+    LBL(101206) /* chrs_nxt4 */
+
+        addxx_ld(Resi, Mebp, scn_STEP)
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 101203b) /* chrs_grp4 */
+
+        jmpxx_lb(101216f) /* chrs_done */
+
+    LBL(101205) /* chrs_grp8 */
+
+        xormx_rr(Xmm3, Xmm3)
+        movxx_ri(Reax, IB(0))
+
+    LBL(101207) /* chrs_vec8 */
+
+        movmx_ld(Xmm0, Iesi, DP(Q*0x000))
+        movmx_rr(Xmm1, Xmm0)
+        ceqmb_rr(Xmm1, Xmm4)
+        movmx_rr(Xmm2, Xmm0)
+        ceqmb_rr(Xmm2, Xmm5)
+        orrmx_rr(Xmm1, Xmm2)
+        movmx_rr(Xmm2, Xmm0)
+        ceqmb_rr(Xmm2, Xmm6)
+        orrmx_rr(Xmm1, Xmm2)
+        movmx_rr(Xmm2, Xmm0)
+        ceqmb_rr(Xmm2, Xmm7)
+        orrmx_rr(Xmm1, Xmm2)
+        movmx_ld(Xmm2, Mebp, scn_NDL4)
+        ceqmb_rr(Xmm2, Xmm0)
+        orrmx_rr(Xmm1, Xmm2)
+        movmx_ld(Xmm2, Mebp, scn_NDL5)
+        ceqmb_rr(Xmm2, Xmm0)
+        orrmx_rr(Xmm1, Xmm2)
+        movmx_ld(Xmm2, Mebp, scn_NDL6)
+        ceqmb_rr(Xmm2, Xmm0)
+        orrmx_rr(Xmm1, Xmm2)
+        movmx_ld(Xmm2, Mebp, scn_NDL7)
+        ceqmb_rr(Xmm2, Xmm0)
+        orrmx_rr(Xmm1, Xmm2)
+        movmx_st(Xmm1, Iebp, scn_MSK0)
+        orrmx_rr(Xmm3, Xmm1)
+
+        addxx_ri(Reax, IM(Q*0x010))
+        cmjxx_ri(Reax, IM(Q*0x040),
+        /* if */ LT_x, 101207b) /* chrs_vec8 */
+
+        mkjmb_rx(Xmm3, NONE, 101208f) /* chrs_nxt8 */
+        jmpxx_lb(101210f) /* chrs_find */
+
+    LBL(101208) /* chrs_nxt8 */
+
+        addxx_ld(Resi, Mebp, scn_STEP)
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 101205b) /* chrs_grp8 */
+
+        jmpxx_lb(101216f) /* chrs_done */
+
+    LBL(101210) /* chrs_find */
+
+        cmjwx_mi(Mebp, scn_BACK, IB(0),
+        /* if */ NE_x, 101212f) /* chrs_back */
+
+        movxx_ri(Reax, IB(0))
+
+    LBL(101211) /* chrs_frst */
+
+        movwx_ld(Rebx, Iebp, scn_MSK0)
+        cmjwx_ri(Rebx, IB(0),
+        /* if */ NE_x, 101214f) /* chrs_fbyt */
+        addxx_ri(Reax, IB(4))
+        jmpxx_lb(101211b) /* chrs_frst */
+
+    LBL(101214) /* chrs_fbyt */
+
+        scn_FRST(Rebx)
+        shrwx_ri(Rebx, IB(3))
+        jmpxx_lb(101215f) /* chrs_rptr */
+
+    LBL(101212) /* chrs_back */
+
+        movxx_ri(Reax, IM(Q*0x040-4))
+
+    LBL(101213) /* chrs_last */
+
+        movwx_ld(Rebx, Iebp, scn_MSK0)
+        cmjwx_ri(Rebx, IB(0),
+        /* if */ NE_x, 101217f) /* chrs_lbyt */
+        subxx_ri(Reax, IB(4))
+        jmpxx_lb(101213b) /* chrs_last */
+
+    LBL(101217) /* chrs_lbyt */
+
+        scn_LAST(Rebx)
+        shrwx_ri(Rebx, IB(3))
+        xorwx_ri(Rebx, IB(3))
+
+    LBL(101215) /* chrs_rptr */
+
+        addxx_rr(Reax, Rebx)
+        addxx_rr(Reax, Resi)
+        movxx_st(Reax, Mebp, scn_RPTR)
+
+    LBL(101216) /* chrs_done */
+
+    ASM_LEAVE(info)
+}
+
+/* scn_pair (find the first position with both needle bytes,
+ * ndl0 at the position and ndl1 at the position + loff)
+ * reads: ndl0, ndl1, sptr, loff, gcnt, writes: msk0-msk3, rptr (if found)
+ * groups start at any alignment (sptr is the 1st candidate position),
+ * step is 4 * J bytes forward */
+
+static
+rt_void scn_pair(rt_SIMD_SCAN *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, scn_SPTR)
+        movxx_rr(Redx, Resi)
+        addxx_ld(Redx, Mebp, scn_LOFF)
+        movwx_ld(Recx, Mebp, scn_GCNT)
+
+        movmx_ld(Xmm6, Mebp, scn_NDL0)
+        movmx_ld(Xmm7, Mebp, scn_NDL1)
+
+    LBL(101220) /* pair_grps */
+
+        muvmx_ld(Xmm0, Mesi, DP(Q*0x000))
+        ceqmb_rr(Xmm0, Xmm6)
+        muvmx_ld(Xmm4, Medx, DP(Q*0x000))
+        ceqmb_rr(Xmm4, Xmm7)
+        andmx_rr(Xmm0, Xmm4)
+        muvmx_ld(Xmm1, Mesi, DP(Q*0x010))
+        ceqmb_rr(Xmm1, Xmm6)
+        muvmx_ld(Xmm5, Medx, DP(Q*0x010))
+        ceqmb_rr(Xmm5, Xmm7)
+        andmx_rr(Xmm1, Xmm5)
+        muvmx_ld(Xmm2, Mesi, DP(Q*0x020))
+        ceqmb_rr(Xmm2, Xmm6)
+        muvmx_ld(Xmm4, Medx, DP(Q*0x020))
+        ceqmb_rr(Xmm4, Xmm7)
+        andmx_rr(Xmm2, Xmm4)
+        muvmx_ld(Xmm3, Mesi, DP(Q*0x030))
+        ceqmb_rr(Xmm3, Xmm6)
+        muvmx_ld(Xmm5, Medx, DP(Q*0x030))
+        ceqmb_rr(Xmm5, Xmm7)
+        andmx_rr(Xmm3, Xmm5)
+        movmx_rr(Xmm4, Xmm0)
+        orrmx_rr(Xmm4, Xmm1)
+        movmx_rr(Xmm5, Xmm2)
+        orrmx_rr(Xmm5, Xmm3)
+        orrmx_rr(Xmm4, Xmm5)
+        mkjmb_rx(Xmm4, NONE, 101221f) /* pair_next */
+
+        movmx_st(Xmm0, Mebp, scn_MSK0)
+        movmx_st(Xmm1, Mebp, scn_MSK1)
+        movmx_st(Xmm2, Mebp, scn_MSK2)
+        movmx_st(Xmm3, Mebp, scn_MSK3)
+        movxx_ri(Reax, IB(0))
+        jmpxx_lb(101222f) /* pair_frst */
+
+    LBL(101221) /* pair_next */
+
+        addxx_ri(Resi, IM(Q*0x040))
+        addxx_ri(Redx, IM(Q*0x040))
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 101220b) /* pair_grps */
+
+        jmpxx_lb(101224f) /* pair_done */
+
+    LBL(101222) /* pair_frst */
+
+        movwx_ld(Rebx, Iebp, scn_MSK0)
+        cmjwx_ri(Rebx, IB(0),
+        /* if */ NE_x, 101223f) /* pair_fbyt */
+        addxx_ri(Reax, IB(4))
+        jmpxx_lb(101222b) /* pair_frst */
+
+    LBL(101223) /* pair_fbyt */
+
+        scn_FRST(Rebx)
+        shrwx_ri(Rebx, IB(3))
+        addxx_rr(Reax, Rebx)
+        addxx_rr(Reax, Resi)
+        movxx_st(Reax, Mebp, scn_RPTR)
+
+    LBL(101224) /* pair_done */
+
+    ASM_LEAVE(info)
+}
+
+/******************************************************************************/
+/*************************   SCAN DRIVERS   ***********************************/
+/******************************************************************************/
+
+/*
+ * Set needles from c (k bytes), unused needles (read by the kernel)
+ * repeat the 1st one.
+ */
+static
+rt_void scn_ndls(rt_SIMD_SCAN *info, const rt_ui08 *c, rt_si32 k)
+{
+    rt_ui08 *n[RT_SCAN_NDLS] =
+    {
+        info->ndl0, info->ndl1, info->ndl2, info->ndl3,
+        info->ndl4, info->ndl5, info->ndl6, info->ndl7,
+    };
+    rt_si32 i, m = k <= 4 ? 4 : RT_SCAN_NDLS;
+
+    for (i = 0; i < m; i++)
+    {
+        memset(n[i], c[i < k ? i : 0], J);
+    }
+
+    info->ncnt = k;
+}
+
+/*
+ * Find the first (if f) or the last byte from set c (k bytes) in [p, e)
+ * with word-at-a-time test, words are aligned and may include bytes
+ * out of range (within the same word), return RT_NULL if none.
+ */
+static
+rt_ui08 *scn_swar(rt_ui08 *p, rt_ui08 *e, rt_bool f,
+                  const rt_ui08 *c, rt_si32 k)
+{
+    rt_ui64 l = ULL(0x0101010101010101), n[RT_SCAN_NDLS], w, v, m;
+    rt_ui08 *g, *i;
+    rt_si32 j;
+
+    for (j = 0; j < k; j++)
+    {
+        n[j] = l * c[j];
+    }
+
+    if (f && k == 1)
+    {
+        for (g = (rt_ui08 *)((rt_full)p & ~(rt_full)7); g < e; g += 8)
+        {
+            memcpy(&w, g, 8);
+            v = w ^ n[0];
+            if (((v - l) & ~v & (l << 7)) == 0)
+            {
+                continue;
+            }
+            for (i = RT_MAX(g, p); i < g + 8 && i < e; i++)
+            {
+                if (*i == c[0])
+                {
+                    return i;
+                }
+            }
+        }
+    }
+    else
+    if (f)
+    {
+        for (g = (rt_ui08 *)((rt_full)p & ~(rt_full)7); g < e; g += 8)
+        {
+            memcpy(&w, g, 8);
+            for (m = 0, j = 0; j < k; j++)
+            {
+                v = w ^ n[j];
+                m |= (v - l) & ~v & (l << 7);
+            }
+            if (m == 0)
+            {
+                continue;
+            }
+            for (i = RT_MAX(g, p); i < g + 8 && i < e; i++)
+            {
+                for (j = 0; j < k; j++)
+                {
+                    if (*i == c[j])
+                    {
+                        return i;
+                    }
+                }
+            }
+        }
+    }
+    else
+    {
+        for (g = (rt_ui08 *)((rt_full)e & ~(rt_full)7); g + 8 > p; g -= 8)
+        {
+            if (g >= e)
+            {
+                continue;
+            }
+            memcpy(&w, g, 8);
+            for (m = 0, j = 0; j < k; j++)
+            {
+                v = w ^ n[j];
+                m |= (v - l) & ~v & (l << 7);
+            }
+            if (m == 0)
+            {
+                continue;
+            }
+            for (i = RT_MIN(g + 8, e); i-- > g && i >= p;)
+            {
+                for (j = 0; j < k; j++)
+                {
+                    if (*i == c[j])
+                    {
+                        return i;
+                    }
+                }
+            }
+        }
+    }
+
+    return RT_NULL;
+}
+
+/*
+ * Find the first (if f) or the last byte from set c (k bytes) in [p, e),
+ * bytes up to the first group boundary past RT_SCAN_HEAD are checked
+ * in C/C++, then the kernel scans aligned groups for the rest,
+ * return RT_NULL if none.
+ */
+static
+rt_ui08 *scn_find(rt_SIMD_SCAN *info, rt_ui08 *p, rt_ui08 *e, rt_bool f,
+                  const rt_ui08 *c, rt_si32 k)
+{
+    rt_cell z = J * 4;
+    rt_full a;
+    rt_ui08 *g, *i;
+
+    g = (rt_ui08 *)(f ? ((rt_full)p + RT_SCAN_HEAD + z - 1) & ~(rt_full)(z-1)
+                      :  (rt_full)(e - RT_SCAN_HEAD) & ~(rt_full)(z - 1));
+
+    if (e - p <= RT_SCAN_HEAD || (f && g >= e) || (!f && g <= p))
+    {
+        return scn_swar(p, e, f, c, k);
+    }
+
+    i = scn_swar(f ? p : g, f ? g : e, f, c, k);
+
+    if (i != RT_NULL)
+    {
+        return i;
+    }
+
+    scn_ndls(info, c, k);
+
+    /* number of groups left, the last one may be partial */
+    a = f ? ((rt_full)e - (rt_full)g - 1) / z + 1
+          : ((rt_full)g - ((rt_full)p & ~(rt_full)(z - 1))) / z;
+
+    info->rptr = RT_NULL;
+    info->step = f ? z : -z;
+    info->back = f ? 0 : 1;
+
+    for (g = f ? g : g - z; a > 0; a -= info->gcnt)
+    {
+        info->sptr = g;
+        info->gcnt = (rt_si32)RT_MIN(a, (rt_full)RT_SCAN_GCNT);
+
+        scn_chrs(info);
+
+        i = info->rptr;
+
+        if (i != RT_NULL)
+        {
+            return (f && i >= e) || (!f && i < p) ? RT_NULL : i;
+        }
+
+        g += info->gcnt * info->step;
+    }
+
+    return RT_NULL;
+}
+
+/*
+ * Return pointer to the first byte c in p[0..n), RT_NULL if none.
+ */
+static
+rt_ui08 *scn_memchr(rt_SIMD_SCAN *info, const rt_pntr p, rt_ui08 c, rt_size n)
+{
+    rt_ui08 *s = (rt_ui08 *)p;
+
+#if RT_SCAN_LIBC != 0
+    return (rt_ui08 *)memchr(s, c, n);
+#else  /* RT_SCAN_LIBC */
+    return scn_find(info, s, s + n, RT_TRUE, &c, 1);
+#endif /* RT_SCAN_LIBC */
+}
+
+/*
+ * Return pointer to the last byte c in p[0..n), RT_NULL if none.
+ */
+static
+rt_ui08 *scn_memrchr(rt_SIMD_SCAN *info, const rt_pntr p, rt_ui08 c, rt_size n)
+{
+    rt_ui08 *s = (rt_ui08 *)p;
+
+#if RT_SCAN_LIBC != 0 && (defined RT_LINUX)
+    return (rt_ui08 *)memrchr(s, c, n);
+#else  /* RT_SCAN_LIBC */
+    return scn_find(info, s, s + n, RT_FALSE, &c, 1);
+#endif /* RT_SCAN_LIBC */
+}
+
+/*
+ * Return pointer to the first byte in p[0..n) equal to any of k bytes
+ * from set c (k = 1 to RT_SCAN_NDLS), RT_NULL if none.
+ */
+static
+rt_ui08 *scn_anychr(rt_SIMD_SCAN *info, const rt_pntr p, rt_size n,
+                    const rt_ui08 *c, rt_si32 k)
+{
+    rt_ui08 *s = (rt_ui08 *)p;
+
+    return scn_find(info, s, s + n, RT_TRUE, c, k);
+}
+
+/*
+ * Return length of zero-terminated string p.
+ */
+static
+rt_size scn_strlen(rt_SIMD_SCAN *info, const rt_pntr p)
+{
+#if RT_SCAN_LIBC != 0
+    return strlen((rt_char *)p);
+#else  /* RT_SCAN_LIBC */
+    rt_ui08 *s = (rt_ui08 *)p, *e, *i;
+    rt_ui08 c = 0;
+
+    /* the kernel stops at the terminator, reads past it stay within
+     * aligned words and groups, thus the range only bounds the scan */
+    e = (rt_ui08 *)(((rt_full)s + 0x40000000) & ~(rt_full)(J * 4 - 1));
+
+    for (;;)
+    {
+        i = scn_find(info, s, e, RT_TRUE, &c, 1);
+
+        if (i != RT_NULL)
+        {
+            return (rt_size)(i - (rt_ui08 *)p);
+        }
+
+        s = e;
+        e = s + 0x40000000;
+    }
+#endif /* RT_SCAN_LIBC */
+}
+
+/*
+ * Return pointer to the first occurrence of needle d[0..m) in p[0..n),
+ * RT_NULL if none, candidates are filtered by the first and the last byte
+ * of the needle in one pass before comparing the middle of the needle.
+ */
+static
+rt_ui08 *scn_memmem(rt_SIMD_SCAN *info, const rt_pntr p, rt_size n,
+                    const rt_pntr d, rt_size m)
+{
+#if RT_SCAN_LIBC != 0 && (defined RT_LINUX)
+    return (rt_ui08 *)memmem(p, n, d, m);
+#else  /* RT_SCAN_LIBC */
+    rt_cell z = J * 4;
+    rt_ui08 *s = (rt_ui08 *)p, *t = (rt_ui08 *)d, *e, *b, *i;
+    rt_ui08 c[2];
+    rt_full a;
+
+    if (m == 0)
+    {
+        return s;
+    }
+    if (m > n)
+    {
+        return RT_NULL;
+    }
+    if (m == 1)
+    {
+        return scn_find(info, s, s + n, RT_TRUE, t, 1);
+    }
+
+    e = s + n - m + 1; /* end of candidate positions */
+    b = RT_MIN(s + RT_SCAN_HEAD, e);
+
+    for (i = s; (i = scn_swar(i, b, RT_TRUE, t, 1)) != RT_NULL; i++)
+    {
+        if (i[m - 1] == t[m - 1] && memcmp(i + 1, t + 1, m - 2) == 0)
+        {
+            return i;
+        }
+    }
+
+    c[0] = t[0];
+    c[1] = t[m - 1];
+    scn_ndls(info, c, 2);
+
+    info->loff = (rt_cell)(m - 1);
+
+    /* kernel reads whole groups of candidates and their last bytes,
+     * which stay within [s, s + n), the tail is checked in C/C++ */
+    while ((a = (rt_full)(e - b) / z) > 0)
+    {
+        info->sptr = b;
+        info->rptr = RT_NULL;
+        info->gcnt = (rt_si32)RT_MIN(a, (rt_full)RT_SCAN_GCNT);
+
+        scn_pair(info);
+
+        i = info->rptr;
+
+        if (i == RT_NULL)
+        {
+            b += info->gcnt * z;
+            continue;
+        }
+        if (memcmp(i + 1, t + 1, m - 2) == 0)
+        {
+            return i;
+        }
+
+        b = i + 1;
+    }
+
+    for (i = b; (i = scn_swar(i, e, RT_TRUE, t, 1)) != RT_NULL; i++)
+    {
+        if (i[m - 1] == t[m - 1] && memcmp(i + 1, t + 1, m - 2) == 0)
+        {
+            return i;
+        }
+    }
+
+    return RT_NULL;
+#endif /* RT_SCAN_LIBC */
+}
+
+#endif /* RT_RTSCAN_H */
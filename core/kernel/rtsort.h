@@ -0,0 +1,1222 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2023 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTSORT_H
+#define RT_RTSORT_H
+
+#include "rtbase.h"
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rtsort.h: sorting networks and merge sort in configurable cmdp* subset.
+ * Table of contents is provided below.
+ *
+ * Keys are either rt_real (srt_real) or signed rt_elem (srt_elem), thus
+ * 32-bit or 64-bit keys are chosen by RT_ELEMENT, optional payload (values)
+ * is an array of rt_elem permuted along with the keys. Sorting is ascending,
+ * not stable, floating point keys must not be NaN.
+ *
+ * SIMD ISA has no lane permutes by design, therefore sorting networks
+ * run across registers instead of lanes: a tile of RT_SORT_ROWS rows
+ * of S elements is sorted column-wise by Batcher's odd-even merge network,
+ * where each comparator is a min/max pair (or compare mask with xor-swap
+ * of keys and payload) of two rows, every stage of the network being
+ * a vectorized merge of S pairs of sorted columns at once.
+ * Columns of adjacent tiles are then merged by bitonic networks
+ * (flip stage followed by half-cleaners) of the same comparators
+ * until each lane holds one sorted column of the whole array.
+ * The last log2(S) merges cross the lanes: each pair of runs is split
+ * by merge path into S parts of equal size in C/C++, every part is laid
+ * out into its own lane as bitonic sequence (part of the 1st run ascending,
+ * part of the 2nd run descending), which half-cleaners sort in place.
+ * Pairs of stages are fused into one pass over rows (4 rows per step),
+ * stages of short distance are fused over chunks of RT_SORT_FUSE rows
+ * to keep them in cache.
+ *
+ * Keys are padded with the largest value (RT_INF for rt_real keys)
+ * up to a power of 2 tiles, tiles of padding only are skipped until
+ * the lanes are crossed, keys with payload equal to the padding
+ * are set aside on entry and appended on exit. Keys are only accessed
+ * as rt_elem bits in C/C++ (via memcpy for rt_real keys).
+ */
+
+/*----------------------------------------------------------------------------*/
+
+/*************************   SIMD BACKEND STRUCTURE   *************************/
+
+/*************************   SORTING NETWORKS   *******************************/
+
+/*************************   MERGE SORT   *************************************/
+
+/*----------------------------------------------------------------------------*/
+
+/* number of rows per sorting network tile, power of 2 */
+#ifndef RT_SORT_ROWS
+#define RT_SORT_ROWS        64
+#endif /* RT_SORT_ROWS */
+
+/* number of rows per chunk of fused merge stages, power of 2 */
+#ifndef RT_SORT_FUSE
+#define RT_SORT_FUSE        2048
+#endif /* RT_SORT_FUSE */
+
+/******************************************************************************/
+/*************************   SIMD BACKEND STRUCTURE   *************************/
+/******************************************************************************/
+
+/*
+ * SIMD sort structure for ASM_ENTER/ASM_LEAVE contains kernel parameters
+ * set by drivers and buffers set by srt_init,
+ * must be initialized with ASM_INIT before use.
+ * Note that DP offsets below start where rt_SIMD_INFO ends (at Q*0x100).
+ * SIMD width is taken into account via S and Q from rtbase.h
+ * Structure is read-write in backend.
+ */
+struct rt_SIMD_SORT : public rt_SIMD_INFO
+{
+    /* kernel parameters (set by drivers) */
+
+    rt_elem*keys;           /* keys of the 1st tile (chunk) */
+#define srt_KEYS            DP(Q*0x100+0x000*P+E)
+
+    rt_elem*vals;           /* payload of the 1st tile (chunk) */
+#define srt_VALS            DP(Q*0x100+0x004*P+E)
+
+    rt_si32*pair;           /* comparators as pairs of row offsets */
+#define srt_PAIR            DP(Q*0x100+0x008*P+E)
+
+    rt_cell tstr;           /* stride of tiles in bytes */
+#define srt_TSTR            DP(Q*0x100+0x00C*P+E)
+
+    rt_cell csiz;           /* size of chunks in bytes */
+#define srt_CSIZ            DP(Q*0x100+0x010*P+E)
+
+    rt_elem*kcur;           /* internal, keys of the current chunk */
+#define srt_KCUR            DP(Q*0x100+0x014*P+E)
+
+    rt_elem*vcur;           /* internal, payload of the current chunk */
+#define srt_VCUR            DP(Q*0x100+0x018*P+E)
+
+    rt_elem*kend;           /* internal, end of keys of the current chunk */
+#define srt_KEND            DP(Q*0x100+0x01C*P+E)
+
+    rt_si32 pcnt;           /* number of comparators */
+#define srt_PCNT            DP(Q*0x100+0x020*P+0x000)
+
+    rt_si32 tcnt;           /* number of tiles */
+#define srt_TCNT            DP(Q*0x100+0x020*P+0x004)
+
+    rt_si32 ccnt;           /* number of chunks */
+#define srt_CCNT            DP(Q*0x100+0x020*P+0x008)
+
+    rt_si32 dmax;           /* distance of the 1st stage in bytes */
+#define srt_DMAX            DP(Q*0x100+0x020*P+0x00C)
+
+    rt_si32 dmin;           /* distance of the last stage in bytes */
+#define srt_DMIN            DP(Q*0x100+0x020*P+0x010)
+
+    rt_si32 flip;           /* 1st stage: 0 - half-cleaner, 1 - flip */
+#define srt_FLIP            DP(Q*0x100+0x020*P+0x014)
+
+    rt_si32 ktyp;           /* 0 - rt_real keys, 1 - rt_elem keys */
+#define srt_KTYP            DP(Q*0x100+0x020*P+0x018)
+
+    rt_si32 icnt;           /* internal, comparator counter */
+#define srt_ICNT            DP(Q*0x100+0x020*P+0x01C)
+
+    rt_si32 jcnt;           /* internal, tile (chunk) counter */
+#define srt_JCNT            DP(Q*0x100+0x020*P+0x020)
+
+    /* sort parameters (C/C++ only) */
+
+    rt_elem*work;           /* SIMD-aligned work area of srt_work bytes */
+
+    rt_elem*kbf0;           /* 1st keys buffer */
+    rt_elem*kbf1;           /* 2nd keys buffer */
+    rt_elem*vbf0;           /* 1st payload buffer */
+    rt_elem*vbf1;           /* 2nd payload buffer */
+    rt_si32*net0;           /* comparators of the network */
+
+    rt_si32 size;           /* max number of elements */
+    rt_si32 ncnt;           /* number of comparators in the network */
+
+};
+
+/******************************************************************************/
+/*************************   SORTING NETWORKS   *******************************/
+/******************************************************************************/
+
+/* srt_netk (sort columns of tiles of keys in place)
+ * reads: keys, pair, tstr, pcnt, tcnt, ktyp, destroys jcnt
+ * for each comparator (a, b): a = min(a, b), b = max(a, b) */
+
+static
+rt_void srt_netk(rt_SIMD_SORT *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, srt_KEYS)
+        movwx_ld(Reax, Mebp, srt_TCNT)
+        movwx_st(Reax, Mebp, srt_JCNT)
+        cmjwx_mz(Mebp, srt_KTYP,
+        /* if */ NE_x, 101102f) /* netk_ints */
+
+    LBL(101100) /* netk_real */
+
+        movxx_ld(Recx, Mebp, srt_PAIR)
+        movwx_ld(Redx, Mebp, srt_PCNT)
+
+    LBL(101101) /* netk_rcmp */
+
+        movwx_ld(Reax, Mecx, DP(0x000))
+        movwx_ld(Rebx, Mecx, DP(0x004))
+        addxx_rr(Rebx, Resi)
+        movpx_ld(Xmm0, Iesi, DP(Q*0x000))
+        movpx_rr(Xmm1, Xmm0)
+        minps_ld(Xmm0, Mebx, DP(Q*0x000))
+        maxps_ld(Xmm1, Mebx, DP(Q*0x000))
+        movpx_st(Xmm0, Iesi, DP(Q*0x000))
+        movpx_st(Xmm1, Mebx, DP(Q*0x000))
+
+        addxx_ri(Recx, IB(8))
+        arjwx_ri(Redx, IB(1),
+        sub_x, NZ_x, 101101b) /* netk_rcmp */
+
+        addxx_ld(Resi, Mebp, srt_TSTR)
+        arjwx_mi(Mebp, srt_JCNT, IB(1),
+        sub_x, NZ_x, 101100b) /* netk_real */
+
+        jmpxx_lb(101104f) /* netk_done */
+
+    LBL(101102) /* netk_ints */
+
+        movxx_ld(Recx, Mebp, srt_PAIR)
+        movwx_ld(Redx, Mebp, srt_PCNT)
+
+    LBL(101103) /* netk_icmp */
+
+        movwx_ld(Reax, Mecx, DP(0x000))
+        movwx_ld(Rebx, Mecx, DP(0x004))
+        addxx_rr(Rebx, Resi)
+        movpx_ld(Xmm0, Iesi, DP(Q*0x000))
+        movpx_ld(Xmm1, Mebx, DP(Q*0x000))
+        movpx_rr(Xmm2, Xmm0)
+        cgtpn_rr(Xmm2, Xmm1)
+        movpx_rr(Xmm3, Xmm0)
+        xorpx_rr(Xmm3, Xmm1)
+        andpx_rr(Xmm3, Xmm2)
+        xorpx_rr(Xmm0, Xmm3)
+        xorpx_rr(Xmm1, Xmm3)
+        movpx_st(Xmm0, Iesi, DP(Q*0x000))
+        movpx_st(Xmm1, Mebx, DP(Q*0x000))
+
+        addxx_ri(Recx, IB(8))
+        arjwx_ri(Redx, IB(1),
+        sub_x, NZ_x, 101103b) /* netk_icmp */
+
+        addxx_ld(Resi, Mebp, srt_TSTR)
+        arjwx_mi(Mebp, srt_JCNT, IB(1),
+        sub_x, NZ_x, 101102b) /* netk_ints */
+
+    LBL(101104) /* netk_done */
+
+    ASM_LEAVE(info)
+}
+
+/* srt_netv (sort columns of tiles of keys with payload in place)
+ * reads: keys, vals, pair, tstr, pcnt, tcnt, ktyp, destroys icnt, jcnt
+ * for each comparator (a, b): swap keys and payload where a > b */
+
+static
+rt_void srt_netv(rt_SIMD_SORT *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, srt_KEYS)
+        movxx_ld(Redi, Mebp, srt_VALS)
+        movwx_ld(Reax, Mebp, srt_TCNT)
+        movwx_st(Reax, Mebp, srt_JCNT)
+
+    LBL(101105) /* netv_tile */
+
+        movxx_ld(Recx, Mebp, srt_PAIR)
+        movwx_ld(Reax, Mebp, srt_PCNT)
+        movwx_st(Reax, Mebp, srt_ICNT)
+
+    LBL(101106) /* netv_pair */
+
+        movwx_ld(Reax, Mecx, DP(0x000))
+        movwx_ld(Rebx, Mecx, DP(0x004))
+        movxx_rr(Redx, Rebx)
+        addxx_rr(Rebx, Resi)
+        addxx_rr(Redx, Redi)
+        movpx_ld(Xmm0, Iesi, DP(Q*0x000))
+        movpx_ld(Xmm1, Mebx, DP(Q*0x000))
+        movpx_rr(Xmm2, Xmm0)
+        cmjwx_mz(Mebp, srt_KTYP,
+        /* if */ NE_x, 101107f) /* netv_ints */
+        cgtps_rr(Xmm2, Xmm1)
+        jmpxx_lb(101108f) /* netv_swap */
+
+    LBL(101107) /* netv_ints */
+
+        cgtpn_rr(Xmm2, Xmm1)
+
+    LBL(101108) /* netv_swap */
+
+        movpx_rr(Xmm3, Xmm0)
+        xorpx_rr(Xmm3, Xmm1)
+        andpx_rr(Xmm3, Xmm2)
+        xorpx_rr(Xmm0, Xmm3)
+        xorpx_rr(Xmm1, Xmm3)
+        movpx_st(Xmm0, Iesi, DP(Q*0x000))
+        movpx_st(Xmm1, Mebx, DP(Q*0x000))
+
+        movpx_ld(Xmm4, Iedi, DP(Q*0x000))
+        movpx_ld(Xmm5, Medx, DP(Q*0x000))
+        movpx_rr(Xmm6, Xmm4)
+        xorpx_rr(Xmm6, Xmm5)
+        andpx_rr(Xmm6, Xmm2)
+        xorpx_rr(Xmm4, Xmm6)
+        xorpx_rr(Xmm5, Xmm6)
+        movpx_st(Xmm4, Iedi, DP(Q*0x000))
+        movpx_st(Xmm5, Medx, DP(Q*0x000))
+
+        addxx_ri(Recx, IB(8))
+        arjwx_mi(Mebp, srt_ICNT, IB(1),
+        sub_x, NZ_x, 101106b) /* netv_pair */
+
+        addxx_ld(Resi, Mebp, srt_TSTR)
+        addxx_ld(Redi, Mebp, srt_TSTR)
+        arjwx_mi(Mebp, srt_JCNT, IB(1),
+        sub_x, NZ_x, 101105b) /* netv_tile */
+
+    ASM_LEAVE(info)
+}
+
+/*
+ * Comparators of merge passes, keys (XA, XB) become (min, max) for srt_CMPR
+ * (rt_real) and srt_CMPI (rt_elem), srt_MSKR and srt_MSKI set XG to mask
+ * of lanes where XG > XS for xor-swap of keys with payload.
+ */
+#define srt_CMPR(XA, XB) /* destroys Xmm6 */                                \
+        movpx_rr(Xmm6, W(XA))                                               \
+        minps_rr(W(XA), W(XB))                                              \
+        maxps_rr(W(XB), Xmm6)
+
+#define srt_CMPI(XA, XB) /* destroys Xmm6, Xmm7 */                          \
+        movpx_rr(Xmm6, W(XA))                                               \
+        cgtpn_rr(Xmm6, W(XB))                                               \
+        movpx_rr(Xmm7, W(XA))                                               \
+        xorpx_rr(Xmm7, W(XB))                                               \
+        andpx_rr(Xmm7, Xmm6)                                                \
+        xorpx_rr(W(XA), Xmm7)                                               \
+        xorpx_rr(W(XB), Xmm7)
+
+#define srt_MSKR(XG, XS)                                                    \
+        cgtps_rr(W(XG), W(XS))
+
+#define srt_MSKI(XG, XS)                                                    \
+        cgtpn_rr(W(XG), W(XS))
+
+/*
+ * Merge passes over keys of the chunk from Resi to Redi with distance
+ * in Reax (in bytes), each block of 2d (4h) rows is processed by rows
+ * of its 1st half (quarter) with pointers in Rebx, Redx, counter in Recx:
+ * srt_K2FL - flip stage d, (a, 2d - 1 - a),
+ * srt_K2HF - half-cleaner stage d, (a, a + d),
+ * srt_K4FL - flip stage 2h fused with half-cleaner stage h,
+ * srt_K4HF - half-cleaner stages 2h and h fused.
+ */
+#define srt_K2FL(lb, lp, cmp)                                               \
+        movxx_rr(Rebx, Resi)                                                \
+        movxx_rr(Redx, Resi)                                                \
+        addxx_rr(Redx, Reax)                                                \
+        addxx_rr(Redx, Reax)                                                \
+        subxx_ri(Redx, IH(Q*0x10))                                          \
+    LBL(lb)                                                                 \
+        movxx_rr(Recx, Reax)                                                \
+    LBL(lp)                                                                 \
+        movpx_ld(Xmm0, Mebx, DP(Q*0x000))                                   \
+        movpx_ld(Xmm1, Medx, DP(Q*0x000))                                   \
+        cmp(Xmm0, Xmm1)                                                     \
+        movpx_st(Xmm0, Mebx, DP(Q*0x000))                                   \
+        movpx_st(Xmm1, Medx, DP(Q*0x000))                                   \
+        addxx_ri(Rebx, IH(Q*0x10))                                          \
+        subxx_ri(Redx, IH(Q*0x10))                                          \
+        arjxx_ri(Recx, IH(Q*0x10),                                          \
+        sub_x, NZ_x, lp##b)                                                 \
+        addxx_rr(Rebx, Reax)                                                \
+        addxx_rr(Redx, Reax)                                                \
+        addxx_rr(Redx, Reax)                                                \
+        addxx_rr(Redx, Reax)                                                \
+        cmjxx_rr(Rebx, Redi,                                                \
+        /* if */ LT_x, lb##b)
+
+#define srt_K2HF(lb, lp, cmp)                                               \
+        movxx_rr(Rebx, Resi)                                                \
+    LBL(lb)                                                                 \
+        movxx_rr(Recx, Reax)                                                \
+    LBL(lp)                                                                 \
+        movpx_ld(Xmm0, Mebx, DP(Q*0x000))                                   \
+        movpx_ld(Xmm1, Iebx, DP(Q*0x000))                                   \
+        cmp(Xmm0, Xmm1)                                                     \
+        movpx_st(Xmm0, Mebx, DP(Q*0x000))                                   \
+        movpx_st(Xmm1, Iebx, DP(Q*0x000))                                   \
+        addxx_ri(Rebx, IH(Q*0x10))                                          \
+        arjxx_ri(Recx, IH(Q*0x10),                                          \
+        sub_x, NZ_x, lp##b)                                                 \
+        addxx_rr(Rebx, Reax)                                                \
+        cmjxx_rr(Rebx, Redi,                                                \
+        /* if */ LT_x, lb##b)
+
+#define srt_K4FL(lb, lp, cmp)                                               \
+        movxx_rr(Rebx, Resi)                                                \
+        movxx_rr(Redx, Resi)                                                \
+        addxx_rr(Redx, Reax)                                                \
+        addxx_rr(Redx, Reax)                                                \
+        addxx_rr(Redx, Reax)                                                \
+        subxx_ri(Redx, IH(Q*0x10))                                          \
+    LBL(lb)                                                                 \
+        movxx_rr(Recx, Reax)                                                \
+    LBL(lp)                                                                 \
+        movpx_ld(Xmm0, Mebx, DP(Q*0x000))                                   \
+        movpx_ld(Xmm1, Iebx, DP(Q*0x000))                                   \
+        movpx_ld(Xmm2, Medx, DP(Q*0x000))                                   \
+        movpx_ld(Xmm3, Iedx, DP(Q*0x000))                                   \
+        cmp(Xmm0, Xmm3)                                                     \
+        cmp(Xmm1, Xmm2)                                                     \
+        cmp(Xmm0, Xmm1)                                                     \
+        cmp(Xmm2, Xmm3)                                                     \
+        movpx_st(Xmm0, Mebx, DP(Q*0x000))                                   \
+        movpx_st(Xmm1, Iebx, DP(Q*0x000))                                   \
+        movpx_st(Xmm2, Medx, DP(Q*0x000))                                   \
+        movpx_st(Xmm3, Iedx, DP(Q*0x000))                                   \
+        addxx_ri(Rebx, IH(Q*0x10))                                          \
+        subxx_ri(Redx, IH(Q*0x10))                                          \
+        arjxx_ri(Recx, IH(Q*0x10),                                          \
+        sub_x, NZ_x, lp##b)                                                 \
+        addxx_rr(Rebx, Reax)                                                \
+        addxx_rr(Rebx, Reax)                                                \
+        addxx_rr(Rebx, Reax)                                                \
+        movxx_rr(Recx, Reax)                                                \
+        shlxx_ri(Recx, IB(2))                                               \
+        addxx_rr(Redx, Recx)                                                \
+        addxx_rr(Redx, Reax)                                                \
+        cmjxx_rr(Rebx, Redi,                                                \
+        /* if */ LT_x, lb##b)
+
+#define srt_K4HF(lb, lp, cmp)                                               \
+        movxx_rr(Rebx, Resi)                                                \
+        movxx_rr(Redx, Resi)                                                \
+        addxx_rr(Redx, Reax)                                                \
+        addxx_rr(Redx, Reax)                                                \
+    LBL(lb)                                                                 \
+        movxx_rr(Recx, Reax)                                                \
+    LBL(lp)                                                                 \
+        movpx_ld(Xmm0, Mebx, DP(Q*0x000))                                   \
+        movpx_ld(Xmm1, Iebx, DP(Q*0x000))                                   \
+        movpx_ld(Xmm2, Medx, DP(Q*0x000))                                   \
+        movpx_ld(Xmm3, Iedx, DP(Q*0x000))                                   \
+        cmp(Xmm0, Xmm2)                                                     \
+        cmp(Xmm1, Xmm3)                                                     \
+        cmp(Xmm0, Xmm1)                                                     \
+        cmp(Xmm2, Xmm3)                                                     \
+        movpx_st(Xmm0, Mebx, DP(Q*0x000))                                   \
+        movpx_st(Xmm1, Iebx, DP(Q*0x000))                                   \
+        movpx_st(Xmm2, Medx, DP(Q*0x000))                                   \
+        movpx_st(Xmm3, Iedx, DP(Q*0x000))                                   \
+        addxx_ri(Rebx, IH(Q*0x10))                                          \
+        addxx_ri(Redx, IH(Q*0x10))                                          \
+        arjxx_ri(Recx, IH(Q*0x10),                                          \
+        sub_x, NZ_x, lp##b)                                                 \
+        movxx_rr(Recx, Reax)                                                \
+        addxx_rr(Recx, Reax)                                                \
+        addxx_rr(Recx, Reax)                                                \
+        addxx_rr(Rebx, Recx)                                                \
+        addxx_rr(Redx, Recx)                                                \
+        cmjxx_rr(Rebx, Redi,                                                \
+        /* if */ LT_x, lb##b)
+
+/*
+ * Comparator of keys in XA, XB with payload at MA, MB, keys become
+ * (min, max) as for srt_CMPI, payload is xor-swapped by the same mask.
+ */
+#define srt_CMPV(msk, XA, XB, MA, MB) /* destroys Xmm4 - Xmm7 */            \
+        movpx_rr(Xmm4, W(XA))                                               \
+        msk(Xmm4, W(XB))                                                    \
+        movpx_rr(Xmm5, W(XA))                                               \
+        xorpx_rr(Xmm5, W(XB))                                               \
+        andpx_rr(Xmm5, Xmm4)                                                \
+        xorpx_rr(W(XA), Xmm5)                                               \
+        xorpx_rr(W(XB), Xmm5)                                               \
+        movpx_ld(Xmm6, W(MA), DP(Q*0x000))                                  \
+        movpx_ld(Xmm7, W(MB), DP(Q*0x000))                                  \
+        movpx_rr(Xmm5, Xmm6)                                                \
+        xorpx_rr(Xmm5, Xmm7)                                                \
+        andpx_rr(Xmm5, Xmm4)                                                \
+        xorpx_rr(Xmm6, Xmm5)                                                \
+        xorpx_rr(Xmm7, Xmm5)                                                \
+        movpx_st(Xmm6, W(MA), DP(Q*0x000))                                  \
+        movpx_st(Xmm7, W(MB), DP(Q*0x000))
+
+/*
+ * Merge passes over keys with payload of the chunk from kcur, vcur
+ * to kend with distance in Reax (in bytes), keys in Resi, Rebx,
+ * payload in Redi, Redx, counter in Recx, stages as for srt_K*.
+ */
+#define srt_V2FL(lb, lp, msk)                                               \
+        movxx_ld(Resi, Mebp, srt_KCUR)                                      \
+        movxx_ld(Redi, Mebp, srt_VCUR)                                      \
+        movxx_rr(Rebx, Reax)                                                \
+        addxx_rr(Rebx, Reax)                                                \
+        subxx_ri(Rebx, IH(Q*0x10))                                          \
+        movxx_rr(Redx, Rebx)                                                \
+        addxx_rr(Rebx, Resi)                                                \
+        addxx_rr(Redx, Redi)                                                \
+    LBL(lb)                                                                 \
+        movxx_rr(Recx, Reax)                                                \
+    LBL(lp)                                                                 \
+        movpx_ld(Xmm0, Mesi, DP(Q*0x000))                                   \
+        movpx_ld(Xmm1, Mebx, DP(Q*0x000))                                   \
+        srt_CMPV(msk, Xmm0, Xmm1, Medi, Medx)                               \
+        movpx_st(Xmm0, Mesi, DP(Q*0x000))                                   \
+        movpx_st(Xmm1, Mebx, DP(Q*0x000))                                   \
+        addxx_ri(Resi, IH(Q*0x10))                                          \
+        addxx_ri(Redi, IH(Q*0x10))                                          \
+        subxx_ri(Rebx, IH(Q*0x10))                                          \
+        subxx_ri(Redx, IH(Q*0x10))                                          \
+        arjxx_ri(Recx, IH(Q*0x10),                                          \
+        sub_x, NZ_x, lp##b)                                                 \
+        addxx_rr(Resi, Reax)                                                \
+        addxx_rr(Redi, Reax)                                                \
+        movxx_rr(Recx, Reax)                                                \
+        addxx_rr(Recx, Reax)                                                \
+        addxx_rr(Recx, Reax)                                                \
+        addxx_rr(Rebx, Recx)                                                \
+        addxx_rr(Redx, Recx)                                                \
+        cmjxx_rm(Resi, Mebp, srt_KEND,                                      \
+        /* if */ LT_x, lb##b)
+
+#define srt_V2HF(lb, lp, msk)                                               \
+        movxx_ld(Resi, Mebp, srt_KCUR)                                      \
+        movxx_ld(Redi, Mebp, srt_VCUR)                                      \
+    LBL(lb)                                                                 \
+        movxx_rr(Recx, Reax)                                                \
+    LBL(lp)                                                                 \
+        movpx_ld(Xmm0, Mesi, DP(Q*0x000))                                   \
+        movpx_ld(Xmm1, Iesi, DP(Q*0x000))                                   \
+        srt_CMPV(msk, Xmm0, Xmm1, Medi, Iedi)                               \
+        movpx_st(Xmm0, Mesi, DP(Q*0x000))                                   \
+        movpx_st(Xmm1, Iesi, DP(Q*0x000))                                   \
+        addxx_ri(Resi, IH(Q*0x10))                                          \
+        addxx_ri(Redi, IH(Q*0x10))                                          \
+        arjxx_ri(Recx, IH(Q*0x10),                                          \
+        sub_x, NZ_x, lp##b)                                                 \
+        addxx_rr(Resi, Reax)                                                \
+        addxx_rr(Redi, Reax)                                                \
+        cmjxx_rm(Resi, Mebp, srt_KEND,                                      \
+        /* if */ LT_x, lb##b)
+
+#define srt_V4FL(lb, lp, msk)                                               \
+        movxx_ld(Resi, Mebp, srt_KCUR)                                      \
+        movxx_ld(Redi, Mebp, srt_VCUR)                                      \
+        movxx_rr(Rebx, Reax)                                                \
+        addxx_rr(Rebx, Reax)                                                \
+        addxx_rr(Rebx, Reax)                                                \
+        subxx_ri(Rebx, IH(Q*0x10))                                          \
+        movxx_rr(Redx, Rebx)                                                \
+        addxx_rr(Rebx, Resi)                                                \
+        addxx_rr(Redx, Redi)                                                \
+    LBL(lb)                                                                 \
+        movxx_rr(Recx, Reax)                                                \
+    LBL(lp)                                                                 \
+        movpx_ld(Xmm0, Mesi, DP(Q*0x000))                                   \
+        movpx_ld(Xmm1, Iesi, DP(Q*0x000))                                   \
+        movpx_ld(Xmm2, Mebx, DP(Q*0x000))                                   \
+        movpx_ld(Xmm3, Iebx, DP(Q*0x000))                                   \
+        srt_CMPV(msk, Xmm0, Xmm3, Medi, Iedx)                               \
+        srt_CMPV(msk, Xmm1, Xmm2, Iedi, Medx)                               \
+        srt_CMPV(msk, Xmm0, Xmm1, Medi, Iedi)                               \
+        srt_CMPV(msk, Xmm2, Xmm3, Medx, Iedx)                               \
+        movpx_st(Xmm0, Mesi, DP(Q*0x000))                                   \
+        movpx_st(Xmm1, Iesi, DP(Q*0x000))                                   \
+        movpx_st(Xmm2, Mebx, DP(Q*0x000))                                   \
+        movpx_st(Xmm3, Iebx, DP(Q*0x000))                                   \
+        addxx_ri(Resi, IH(Q*0x10))                                          \
+        addxx_ri(Redi, IH(Q*0x10))                                          \
+        subxx_ri(Rebx, IH(Q*0x10))                                          \
+        subxx_ri(Redx, IH(Q*0x10))                                          \
+        arjxx_ri(Recx, IH(Q*0x10),                                          \
+        sub_x, NZ_x, lp##b)                                                 \
+        movxx_rr(Recx, Reax)                                                \
+        addxx_rr(Recx, Reax)                                                \
+        addxx_rr(Recx, Reax)                                                \
+        addxx_rr(Resi, Recx)                                                \
+        addxx_rr(Redi, Recx)                                                \
+        addxx_rr(Recx, Reax)                                                \
+        addxx_rr(Recx, Reax)                                                \
+        addxx_rr(Rebx, Recx)                                                \
+        addxx_rr(Redx, Recx)                                                \
+        cmjxx_rm(Resi, Mebp, srt_KEND,                                      \
+        /* if */ LT_x, lb##b)
+
+#define srt_V4HF(lb, lp, msk)                                               \
+        movxx_ld(Resi, Mebp, srt_KCUR)                                      \
+        movxx_ld(Redi, Mebp, srt_VCUR)                                      \
+        movxx_rr(Rebx, Reax)                                                \
+        addxx_rr(Rebx, Reax)                                                \
+        movxx_rr(Redx, Rebx)                                                \
+        addxx_rr(Rebx, Resi)                                                \
+        addxx_rr(Redx, Redi)                                                \
+    LBL(lb)                                                                 \
+        movxx_rr(Recx, Reax)                                                \
+    LBL(lp)                                                                 \
+        movpx_ld(Xmm0, Mesi, DP(Q*0x000))                                   \
+        movpx_ld(Xmm1, Iesi, DP(Q*0x000))                                   \
+        movpx_ld(Xmm2, Mebx, DP(Q*0x000))                                   \
+        movpx_ld(Xmm3, Iebx, DP(Q*0x000))                                   \
+        srt_CMPV(msk, Xmm0, Xmm2, Medi, Medx)                               \
+        srt_CMPV(msk, Xmm1, Xmm3, Iedi, Iedx)                               \
+        srt_CMPV(msk, Xmm0, Xmm1, Medi, Iedi)                               \
+        srt_CMPV(msk, Xmm2, Xmm3, Medx, Iedx)                               \
+        movpx_st(Xmm0, Mesi, DP(Q*0x000))                                   \
+        movpx_st(Xmm1, Iesi, DP(Q*0x000))                                   \
+        movpx_st(Xmm2, Mebx, DP(Q*0x000))                                   \
+        movpx_st(Xmm3, Iebx, DP(Q*0x000))                                   \
+        addxx_ri(Resi, IH(Q*0x10))                                          \
+        addxx_ri(Redi, IH(Q*0x10))                                          \
+        addxx_ri(Rebx, IH(Q*0x10))                                          \
+        addxx_ri(Redx, IH(Q*0x10))                                          \
+        arjxx_ri(Recx, IH(Q*0x10),                                          \
+        sub_x, NZ_x, lp##b)                                                 \
+        movxx_rr(Recx, Reax)                                                \
+        addxx_rr(Recx, Reax)                                                \
+        addxx_rr(Recx, Reax)                                                \
+        addxx_rr(Resi, Recx)                                                \
+        addxx_rr(Redi, Recx)                                                \
+        addxx_rr(Rebx, Recx)                                                \
+        addxx_rr(Redx, Recx)                                                \
+        cmjxx_rm(Resi, Mebp, srt_KEND,                                      \
+        /* if */ LT_x, lb##b)
+
+/* srt_mrgk (bitonic merge of columns of keys in place)
+ * reads: keys, csiz, ccnt, dmax, dmin, flip, ktyp, destroys jcnt
+ * for each chunk, for each stage of distance d from dmax down to dmin,
+ * for each block of 2d bytes, for each row a of its 1st half:
+ * (a, b) as for srt_netk, b = 2d - 1 - a for flip, b = a + d otherwise,
+ * pairs of stages are fused into one pass while at least two are left */
+
+static
+rt_void srt_mrgk(rt_SIMD_SORT *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, srt_KEYS)
+        movwx_ld(Reax, Mebp, srt_CCNT)
+        movwx_st(Reax, Mebp, srt_JCNT)
+        cmjwx_mz(Mebp, srt_KTYP,
+        /* if */ NE_x, 101123f) /* mrgk_ints */
+
+    LBL(101110) /* mrgk_real */
+
+        movxx_rr(Redi, Resi)
+        addxx_ld(Redi, Mebp, srt_CSIZ)
+        movwx_ld(Reax, Mebp, srt_DMAX)
+        cmjwx_mz(Mebp, srt_FLIP,
+        /* if */ EQ_x, 101113f) /* mrgk_rnxt */
+        movxx_rr(Recx, Reax)
+        shrxx_ri(Recx, IB(1))
+        cmjwx_rm(Recx, Mebp, srt_DMIN,
+        /* if */ LT_x, 101111f) /* mrgk_rfl2 */
+        movxx_rr(Reax, Recx)
+        srt_K4FL(101115, 101116, srt_CMPR)
+        shrxx_ri(Reax, IB(1))
+        jmpxx_lb(101113f) /* mrgk_rnxt */
+
+    LBL(101111) /* mrgk_rfl2 */
+
+        srt_K2FL(101117, 101118, srt_CMPR)
+        shrxx_ri(Reax, IB(1))
+
+    LBL(101113) /* mrgk_rnxt */
+
+        cmjwx_rm(Reax, Mebp, srt_DMIN,
+        /* if */ LT_x, 101112f) /* mrgk_rend */
+        movxx_rr(Recx, Reax)
+        shrxx_ri(Recx, IB(1))
+        cmjwx_rm(Recx, Mebp, srt_DMIN,
+        /* if */ LT_x, 101114f) /* mrgk_rhf2 */
+        movxx_rr(Reax, Recx)
+        srt_K4HF(101119, 101120, srt_CMPR)
+        shrxx_ri(Reax, IB(1))
+        jmpxx_lb(101113b) /* mrgk_rnxt */
+
+    LBL(101114) /* mrgk_rhf2 */
+
+        srt_K2HF(101121, 101122, srt_CMPR)
+        shrxx_ri(Reax, IB(1))
+        jmpxx_lb(101113b) /* mrgk_rnxt */
+
+    LBL(101112) /* mrgk_rend */
+
+        movxx_rr(Resi, Redi)
+        arjwx_mi(Mebp, srt_JCNT, IB(1),
+        sub_x, NZ_x, 101110b) /* mrgk_real */
+
+        jmpxx_lb(101136f) /* mrgk_done */
+
+    LBL(101123) /* mrgk_ints */
+
+        movxx_rr(Redi, Resi)
+        addxx_ld(Redi, Mebp, srt_CSIZ)
+        movwx_ld(Reax, Mebp, srt_DMAX)
+        cmjwx_mz(Mebp, srt_FLIP,
+        /* if */ EQ_x, 101126f) /* mrgk_inxt */
+        movxx_rr(Recx, Reax)
+        shrxx_ri(Recx, IB(1))
+        cmjwx_rm(Recx, Mebp, srt_DMIN,
+        /* if */ LT_x, 101124f) /* mrgk_ifl2 */
+        movxx_rr(Reax, Recx)
+        srt_K4FL(101128, 101129, srt_CMPI)
+        shrxx_ri(Reax, IB(1))
+        jmpxx_lb(101126f) /* mrgk_inxt */
+
+    LBL(101124) /* mrgk_ifl2 */
+
+        srt_K2FL(101130, 101131, srt_CMPI)
+        shrxx_ri(Reax, IB(1))
+
+    LBL(101126) /* mrgk_inxt */
+
+        cmjwx_rm(Reax, Mebp, srt_DMIN,
+        /* if */ LT_x, 101125f) /* mrgk_iend */
+        movxx_rr(Recx, Reax)
+        shrxx_ri(Recx, IB(1))
+        cmjwx_rm(Recx, Mebp, srt_DMIN,
+        /* if */ LT_x, 101127f) /* mrgk_ihf2 */
+        movxx_rr(Reax, Recx)
+        srt_K4HF(101132, 101133, srt_CMPI)
+        shrxx_ri(Reax, IB(1))
+        jmpxx_lb(101126b) /* mrgk_inxt */
+
+    LBL(101127) /* mrgk_ihf2 */
+
+        srt_K2HF(101134, 101135, srt_CMPI)
+        shrxx_ri(Reax, IB(1))
+        jmpxx_lb(101126b) /* mrgk_inxt */
+
+    LBL(101125) /* mrgk_iend */
+
+        movxx_rr(Resi, Redi)
+        arjwx_mi(Mebp, srt_JCNT, IB(1),
+        sub_x, NZ_x, 101123b) /* mrgk_ints */
+
+    LBL(101136) /* mrgk_done */
+
+    ASM_LEAVE(info)
+}
+
+/* srt_mrgv (bitonic merge of columns of keys with payload in place)
+ * reads: keys, vals, csiz, ccnt, dmax, dmin, flip, ktyp,
+ * destroys kcur, vcur, kend, jcnt
+ * stages as for srt_mrgk, comparators as for srt_netv */
+
+static
+rt_void srt_mrgv(rt_SIMD_SORT *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, srt_KEYS)
+        movxx_ld(Redi, Mebp, srt_VALS)
+        movwx_ld(Reax, Mebp, srt_CCNT)
+        movwx_st(Reax, Mebp, srt_JCNT)
+        cmjwx_mz(Mebp, srt_KTYP,
+        /* if */ NE_x, 101150f) /* mrgv_ints */
+
+    LBL(101137) /* mrgv_real */
+
+        movxx_st(Resi, Mebp, srt_KCUR)
+        movxx_st(Redi, Mebp, srt_VCUR)
+        addxx_ld(Resi, Mebp, srt_CSIZ)
+        movxx_st(Resi, Mebp, srt_KEND)
+        movwx_ld(Reax, Mebp, srt_DMAX)
+        cmjwx_mz(Mebp, srt_FLIP,
+        /* if */ EQ_x, 101140f) /* mrgv_rnxt */
+        movxx_rr(Recx, Reax)
+        shrxx_ri(Recx, IB(1))
+        cmjwx_rm(Recx, Mebp, srt_DMIN,
+        /* if */ LT_x, 101138f) /* mrgv_rfl2 */
+        movxx_rr(Reax, Recx)
+        srt_V4FL(101142, 101143, srt_MSKR)
+        shrxx_ri(Reax, IB(1))
+        jmpxx_lb(101140f) /* mrgv_rnxt */
+
+    LBL(101138) /* mrgv_rfl2 */
+
+        srt_V2FL(101144, 101145, srt_MSKR)
+        shrxx_ri(Reax, IB(1))
+
+    LBL(101140) /* mrgv_rnxt */
+
+        cmjwx_rm(Reax, Mebp, srt_DMIN,
+        /* if */ LT_x, 101139f) /* mrgv_rend */
+        movxx_rr(Recx, Reax)
+        shrxx_ri(Recx, IB(1))
+        cmjwx_rm(Recx, Mebp, srt_DMIN,
+        /* if */ LT_x, 101141f) /* mrgv_rhf2 */
+        movxx_rr(Reax, Recx)
+        srt_V4HF(101146, 101147, srt_MSKR)
+        shrxx_ri(Reax, IB(1))
+        jmpxx_lb(101140b) /* mrgv_rnxt */
+
+    LBL(101141) /* mrgv_rhf2 */
+
+        srt_V2HF(101148, 101149, srt_MSKR)
+        shrxx_ri(Reax, IB(1))
+        jmpxx_lb(101140b) /* mrgv_rnxt */
+
+    LBL(101139) /* mrgv_rend */
+
+        movxx_ld(Resi, Mebp, srt_KEND)
+        movxx_ld(Redi, Mebp, srt_VCUR)
+        addxx_ld(Redi, Mebp, srt_CSIZ)
+        arjwx_mi(Mebp, srt_JCNT, IB(1),
+        sub_x, NZ_x, 101137b) /* mrgv_real */
+
+        jmpxx_lb(101163f) /* mrgv_done */
+
+    LBL(101150) /* mrgv_ints */
+
+        movxx_st(Resi, Mebp, srt_KCUR)
+        movxx_st(Redi, Mebp, srt_VCUR)
+        addxx_ld(Resi, Mebp, srt_CSIZ)
+        movxx_st(Resi, Mebp, srt_KEND)
+        movwx_ld(Reax, Mebp, srt_DMAX)
+        cmjwx_mz(Mebp, srt_FLIP,
+        /* if */ EQ_x, 101153f) /* mrgv_inxt */
+        movxx_rr(Recx, Reax)
+        shrxx_ri(Recx, IB(1))
+        cmjwx_rm(Recx, Mebp, srt_DMIN,
+        /* if */ LT_x, 101151f) /* mrgv_ifl2 */
+        movxx_rr(Reax, Recx)
+        srt_V4FL(101155, 101156, srt_MSKI)
+        shrxx_ri(Reax, IB(1))
+        jmpxx_lb(101153f) /* mrgv_inxt */
+
+    LBL(101151) /* mrgv_ifl2 */
+
+        srt_V2FL(101157, 101158, srt_MSKI)
+        shrxx_ri(Reax, IB(1))
+
+    LBL(101153) /* mrgv_inxt */
+
+        cmjwx_rm(Reax, Mebp, srt_DMIN,
+        /* if */ LT_x, 101152f) /* mrgv_iend */
+        movxx_rr(Recx, Reax)
+        shrxx_ri(Recx, IB(1))
+        cmjwx_rm(Recx, Mebp, srt_DMIN,
+        /* if */ LT_x, 101154f) /* mrgv_ihf2 */
+        movxx_rr(Reax, Recx)
+        srt_V4HF(101159, 101160, srt_MSKI)
+        shrxx_ri(Reax, IB(1))
+        jmpxx_lb(101153b) /* mrgv_inxt */
+
+    LBL(101154) /* mrgv_ihf2 */
+
+        srt_V2HF(101161, 101162, srt_MSKI)
+        shrxx_ri(Reax, IB(1))
+        jmpxx_lb(101153b) /* mrgv_inxt */
+
+    LBL(101152) /* mrgv_iend */
+
+        movxx_ld(Resi, Mebp, srt_KEND)
+        movxx_ld(Redi, Mebp, srt_VCUR)
+        addxx_ld(Redi, Mebp, srt_CSIZ)
+        arjwx_mi(Mebp, srt_JCNT, IB(1),
+        sub_x, NZ_x, 101150b) /* mrgv_ints */
+
+    LBL(101163) /* mrgv_done */
+
+    ASM_LEAVE(info)
+}
+
+/******************************************************************************/
+/*************************   MERGE SORT   *************************************/
+/******************************************************************************/
+
+/*
+ * Generate comparators of Batcher's odd-even merge sort for n rows
+ * (n = 2^k) into t as pairs of row offsets in bytes (if t isn't RT_NULL),
+ * return number of comparators.
+ */
+static
+rt_si32 srt_oemg(rt_si32 *t, rt_si32 n)
+{
+    rt_si32 c = 0, i, j, k, p;
+
+    for (p = 1; p < n; p += p)
+    {
+        for (k = p; k > 0; k /= 2)
+        {
+            for (j = k % p; j + k < n; j += 2 * k)
+            {
+                for (i = 0; i < k && i + j + k < n; i++)
+                {
+                    if ((i + j) / (2 * p) != (i + j + k) / (2 * p))
+                    {
+                        continue;
+                    }
+                    if (t != RT_NULL)
+                    {
+                        t[2 * c + 0] = (i + j) * Q * 0x10;
+                        t[2 * c + 1] = (i + j + k) * Q * 0x10;
+                    }
+                    c++;
+                }
+            }
+        }
+    }
+
+    return c;
+}
+
+/*
+ * Return number of rows of S keys for sorting n keys,
+ * which is a power of 2 tiles.
+ */
+static
+rt_si32 srt_rows(rt_si32 n)
+{
+    rt_si32 r = RT_SORT_ROWS;
+
+    while (r * S < n)
+    {
+        r *= 2;
+    }
+
+    return r;
+}
+
+/*
+ * Return size of the work area in bytes required by srt_init and drivers
+ * for sorting up to n keys with payload (up to 2n keys with padding),
+ * the work area itself must be SIMD-aligned (to RT_SIMD_ALIGN)
+ * and set to info->work.
+ */
+static
+rt_size srt_work(rt_si32 n)
+{
+    rt_size b = (rt_size)srt_rows(n) * S;
+
+    return b * 4 * sizeof(rt_elem)
+         + srt_oemg(RT_NULL, RT_SORT_ROWS) * 2 * sizeof(rt_si32);
+}
+
+/*
+ * Prepare sorting of up to n keys with payload,
+ * info->work must point to SIMD-aligned area of srt_work(n) bytes.
+ * Structure must be initialized with ASM_INIT before the first use.
+ */
+static
+rt_void srt_init(rt_SIMD_SORT *info, rt_si32 n)
+{
+    rt_size b = (rt_size)srt_rows(n) * S;
+
+    info->size = n;
+
+    info->kbf0 = info->work;
+    info->kbf1 = info->kbf0 + b;
+    info->vbf0 = info->kbf1 + b;
+    info->vbf1 = info->vbf0 + b;
+    info->net0 = (rt_si32 *)(info->vbf1 + b);
+
+    info->ncnt = srt_oemg(info->net0, RT_SORT_ROWS);
+}
+
+/*
+ * Map rt_real key bits to rt_elem of the same order for merge path,
+ * negative values get their magnitude bits inverted.
+ */
+static
+rt_elem srt_kmap(rt_elem x)
+{
+    return x ^ (rt_elem)((rt_uelm)(x >> (RT_ELEMENT - 1)) >> 1);
+}
+
+/*
+ * Merge columns of tiles of l rows of keys k (with payload v if it isn't
+ * RT_NULL) in place, n rows in total, halves of each column are sorted
+ * (f = 1, flip stage first) or each column is bitonic (f = 0),
+ * stages of short distance are fused over chunks of RT_SORT_FUSE rows.
+ */
+static
+rt_void srt_bmrg(rt_SIMD_SORT *info, rt_elem *k, rt_elem *v,
+                 rt_si32 n, rt_si32 l, rt_si32 f)
+{
+    rt_si32 c = RT_MIN(n, RT_SORT_FUSE), d = l / 2, e;
+
+    info->keys = k;
+    info->vals = v;
+    info->flip = f;
+
+    /* pairs of long stages per pass over all rows */
+    for (; d > c / 2; d = e / 2)
+    {
+        e = d / 2 > c / 2 ? d / 2 : d;
+
+        info->csiz = (rt_cell)n * Q * 0x10;
+        info->ccnt = 1;
+        info->dmax = d * Q * 0x10;
+        info->dmin = e * Q * 0x10;
+
+        if (v != RT_NULL)
+        {
+            srt_mrgv(info);
+        }
+        else
+        {
+            srt_mrgk(info);
+        }
+
+        info->flip = 0;
+    }
+
+    info->csiz = (rt_cell)c * Q * 0x10;
+    info->ccnt = n / c;
+    info->dmax = d * Q * 0x10;
+    info->dmin = Q * 0x10;
+
+    if (v != RT_NULL)
+    {
+        srt_mrgv(info);
+    }
+    else
+    {
+        srt_mrgk(info);
+    }
+}
+
+/*
+ * Return offset of the i-th key of a run laid out in columns
+ * of h = 2^s rows of S keys.
+ */
+static
+rt_si32 srt_rpos(rt_si32 i, rt_si32 h, rt_si32 s)
+{
+    return (i & (h - 1)) * S + (i >> s);
+}
+
+/*
+ * Return number of keys of the 1st of two sorted runs a and b
+ * (of w keys each, laid out as for srt_rpos) among the first o keys
+ * of their merge, keys of the 1st run go first if equal,
+ * t = 0 for rt_real keys, t = 1 for rt_elem keys.
+ */
+static
+rt_si32 srt_rank(rt_elem *a, rt_elem *b, rt_si32 o, rt_si32 w,
+                 rt_si32 h, rt_si32 s, rt_si32 t)
+{
+    rt_si32 i, lo = RT_MAX(0, o - w), hi = RT_MIN(o, w);
+    rt_elem x, y;
+
+    while (lo < hi)
+    {
+        i = (lo + hi) / 2;
+        x = a[srt_rpos(i, h, s)];
+        y = b[srt_rpos(o - i - 1, h, s)];
+        if (t ? x <= y : srt_kmap(x) <= srt_kmap(y))
+        {
+            lo = i + 1;
+        }
+        else
+        {
+            hi = i;
+        }
+    }
+
+    return lo;
+}
+
+/*
+ * Lay out pairs of sorted runs of w keys (with payload if vs isn't RT_NULL)
+ * from ks into tiles of 2w / S rows in kd (n keys in total), each pair
+ * is split by merge path into S parts, which go to lanes as bitonic
+ * columns (part of the 1st run ascending, part of the 2nd descending).
+ * Runs in ks are lanes of r rows if w = r, tiles of w / S rows otherwise,
+ * t = 0 for rt_real keys, t = 1 for rt_elem keys.
+ */
+static
+rt_void srt_lane(rt_elem *ks, rt_elem *vs, rt_elem *kd, rt_elem *vd,
+                 rt_si32 n, rt_si32 w, rt_si32 r, rt_si32 t)
+{
+    rt_si32 a0, a1, c, h, i, j, l = 2 * w / S, p, s, u, x, y;
+
+    h = w == r ? r : w / S;
+    for (s = 0; (1 << s) < h; s++);
+
+    for (p = 0; p < n / (2 * w); p++)
+    {
+        x = w == r ? 2 * p + 0 : (2 * p + 0) * w;
+        y = w == r ? 2 * p + 1 : (2 * p + 1) * w;
+        u = 2 * p * w;
+
+        for (a0 = 0, c = 0; c < S; c++, a0 = a1)
+        {
+            a1 = c + 1 < S ? srt_rank(ks + x, ks + y, (c + 1) * l, w, h, s, t)
+                           : w;
+
+            for (i = 0, j = a0; j < a1; i++, j++)
+            {
+                kd[u + i * S + c] = ks[x + srt_rpos(j, h, s)];
+                if (vs != RT_NULL)
+                {
+                    vd[u + i * S + c] = vs[x + srt_rpos(j, h, s)];
+                }
+            }
+            for (j = (c + 1) * l - a1 - 1; i < l; i++, j--)
+            {
+                kd[u + i * S + c] = ks[y + srt_rpos(j, h, s)];
+                if (vs != RT_NULL)
+                {
+                    vd[u + i * S + c] = vs[y + srt_rpos(j, h, s)];
+                }
+            }
+        }
+    }
+}
+
+/*
+ * Sort n keys k in place (with payload v if it isn't RT_NULL),
+ * t = 0 for rt_real keys, t = 1 for rt_elem keys,
+ * keys are copied via memcpy and compared as rt_elem bits in C/C++.
+ */
+static
+rt_void srt_sort(rt_SIMD_SORT *info, rt_pntr k, rt_elem *v,
+                 rt_si32 n, rt_si32 t)
+{
+    rt_si32 g = 0, i, m = n, r = srt_rows(n), s, w, b = r * S, c, u;
+    rt_elem *ks = info->kbf0, *kd = info->kbf1, *vs, *vd, *p, e;
+    rt_real f = RT_INF;
+
+    vs = v != RT_NULL ? info->vbf0 : RT_NULL;
+    vd = v != RT_NULL ? info->vbf1 : RT_NULL;
+
+    /* largest key as padding */
+    e = (rt_elem)((rt_uelm)-1 >> 1);
+    if (t == 0)
+    {
+        memcpy(&e, &f, sizeof(rt_elem));
+    }
+
+    memcpy(ks, k, n * sizeof(rt_elem));
+
+    /* set aside payload of keys equal to padding */
+    if (v != RT_NULL)
+    {
+        for (i = 0, m = 0; i < n; i++)
+        {
+            if (ks[i] == e)
+            {
+                v[g++] = v[i];
+                continue;
+            }
+            ks[m] = ks[i];
+            vs[m++] = v[i];
+        }
+    }
+    for (i = m; i < b; i++)
+    {
+        ks[i] = e;
+        if (v != RT_NULL)
+        {
+            vs[i] = 0;
+        }
+    }
+
+    /* rows past u hold padding only, their tiles are sorted already */
+    u = RT_MAX(1, (m + S - 1) / S);
+
+    info->keys = ks;
+    info->vals = vs;
+    info->pair = info->net0;
+    info->tstr = RT_SORT_ROWS * Q * 0x10;
+    info->pcnt = info->ncnt;
+    info->tcnt = (u + RT_SORT_ROWS - 1) / RT_SORT_ROWS;
+    info->ktyp = t;
+
+    if (v != RT_NULL)
+    {
+        srt_netv(info);
+    }
+    else
+    {
+        srt_netk(info);
+    }
+
+    /* merge columns of adjacent tiles within lanes up to row u */
+    for (w = RT_SORT_ROWS; w < r; w *= 2)
+    {
+        c = RT_MAX(2 * w, RT_SORT_FUSE);
+        srt_bmrg(info, ks, vs, RT_MIN(r, (u + c - 1) / c * c), 2 * w, 1);
+    }
+
+    /* merge runs across lanes */
+    for (w = r; w < b; w *= 2)
+    {
+        srt_lane(ks, vs, kd, vd, b, w, r, t);
+        srt_bmrg(info, kd, vd, r, 2 * w / S, 0);
+        p = ks; ks = kd; kd = p;
+        p = vs; vs = vd; vd = p;
+    }
+
+    /* the last run is a tile of r rows */
+    for (s = 0; (1 << s) < r; s++);
+
+    if (g > 0)
+    {
+        memmove(v + m, v, g * sizeof(rt_elem));
+    }
+    for (i = 0; i < m; i++)
+    {
+        kd[i] = ks[srt_rpos(i, r, s)];
+        if (v != RT_NULL)
+        {
+            v[i] = vs[srt_rpos(i, r, s)];
+        }
+    }
+    for (i = m; i < n; i++)
+    {
+        kd[i] = e;
+    }
+
+    memcpy(k, kd, n * sizeof(rt_elem));
+}
+
+/*
+ * Sort n rt_real keys k in place (with rt_elem payload v if not RT_NULL),
+ * n must not exceed the size given to srt_init.
+ */
+static
+rt_void srt_real(rt_SIMD_SORT *info, rt_real *k, rt_elem *v, rt_si32 n)
+{
+    srt_sort(info, k, v, n, 0);
+}
+
+/*
+ * Sort n signed rt_elem keys k in place (with rt_elem payload v if not
+ * RT_NULL), n must not exceed the size given to srt_init.
+ */
+static
+rt_void srt_elem(rt_SIMD_SORT *info, rt_elem *k, rt_elem *v, rt_si32 n)
+{
+    srt_sort(info, k, v, n, 1);
+}
+
+#endif /* RT_RTSORT_H */
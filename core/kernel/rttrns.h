@@ -0,0 +1,311 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2023 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTTRNS_H
+#define RT_RTTRNS_H
+
+#include "rtbase.h"
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rttrns.h: bulk matrix transpose of 32-bit elements for layout changes.
+ * Table of contents is provided below.
+ *
+ * Transpose is the common primitive behind SoA <-> AoS conversions
+ * (k x n <-> n x k) and tensor layout changes such as NCHW <-> NHWC
+ * (batch of N transposes C x HW <-> HW x C), thus batches are supported.
+ *
+ * The driver (trns_run) splits the matrix recursively along its longer side
+ * until blocks fit RT_TRNS_LEAF x RT_TRNS_LEAF (cache-oblivious tiling),
+ * then the ASM leaf kernel (trns_leaf) moves elements within the block,
+ * so that both source rows and destination columns stay in cache.
+ *
+ * Leaf kernel transposes 4x4 sub-blocks in 128-bit SIMD registers
+ * with lane unpacks (unlix/unhix, unljx/unhjx) and unaligned loads/stores
+ * (muvix_ld/muvix_st), thus any strides/alignments are supported.
+ * 128-bit subset is used on all targets as the kernel is memory-bound,
+ * row and column remainders of the block are moved with 32-bit BASE
+ * loads/stores (cmdw*).
+ */
+
+/*----------------------------------------------------------------------------*/
+
+/*************************   SIMD BACKEND STRUCTURE   *************************/
+
+/*************************   TRANSPOSE LEAF KERNEL   **************************/
+
+/*************************   TRANSPOSE DRIVER   *******************************/
+
+/*----------------------------------------------------------------------------*/
+
+/* leaf block size (in elements) for recursive tiling */
+#ifndef RT_TRNS_LEAF
+#define RT_TRNS_LEAF        64
+#endif /* RT_TRNS_LEAF */
+
+/******************************************************************************/
+/*************************   SIMD BACKEND STRUCTURE   *************************/
+/******************************************************************************/
+
+/*
+ * SIMD transpose structure for ASM_ENTER/ASM_LEAVE contains parameters
+ * set in C/C++ code and leaf kernel parameters set by trns_run,
+ * must be initialized with ASM_INIT before use.
+ * Note that DP offsets below start where rt_SIMD_INFO ends (at Q*0x100).
+ * SIMD width is taken into account via S and Q from rtbase.h
+ * Structure is read-write in backend.
+ */
+struct rt_SIMD_TRNS : public rt_SIMD_INFO
+{
+    /* leaf kernel parameters (set by trns_run) */
+
+    rt_ui32*lsrc;           /* source block */
+#define trn_LSRC            DP(Q*0x100+0x000*P+E)
+
+    rt_ui32*ldst;           /* destination block */
+#define trn_LDST            DP(Q*0x100+0x004*P+E)
+
+    rt_cell ssrc;           /* source row stride in bytes */
+#define trn_SSRC            DP(Q*0x100+0x008*P+E)
+
+    rt_cell sdst;           /* destination row stride in bytes */
+#define trn_SDST            DP(Q*0x100+0x00C*P+E)
+
+    rt_si32 rcnt;           /* number of source rows in block */
+#define trn_RCNT            DP(Q*0x100+0x010*P+0x000)
+
+    rt_si32 ccnt;           /* number of source cols in block */
+#define trn_CCNT            DP(Q*0x100+0x010*P+0x004)
+
+    /* transpose parameters (C/C++ only) */
+
+    rt_ui32*src;            /* source matrix (rows x cols) */
+    rt_ui32*dst;            /* destination matrix (cols x rows) */
+
+    rt_si32 rows, cols;     /* source matrix dimensions */
+    rt_si32 lds, ldd;       /* leading dimensions (in elements) */
+
+    rt_si32 bcnt;           /* number of matrices in batch (0 means 1) */
+    rt_cell bsrc, bdst;     /* batch strides (in elements) */
+
+};
+
+/******************************************************************************/
+/*************************   TRANSPOSE LEAF KERNEL   **************************/
+/******************************************************************************/
+
+/* trns_leaf (ldst = transpose(lsrc))
+ * reads: lsrc, ldst, ssrc, sdst, rcnt, ccnt, destroys rcnt
+ * each source row is written to a destination column,
+ * groups of 4 rows x 4 cols are transposed in SIMD registers */
+
+static
+rt_void trns_leaf(rt_SIMD_TRNS *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, trn_LSRC)
+        movxx_ld(Redx, Mebp, trn_LDST)
+
+    LBL(100700) /* trn_rqud */
+
+        cmjwx_mi(Mebp, trn_RCNT, IB(4),
+        /* if */ LT_x, 100704f) /* trn_rows */
+
+        movxx_rr(Rebx, Resi)
+        movxx_rr(Redi, Redx)
+        movwx_ld(Recx, Mebp, trn_CCNT)
+
+    LBL(100701) /* trn_cqud */
+
+        cmjwx_ri(Recx, IB(4),
+        /* if */ LT_x, 100702f) /* trn_ctal */
+
+        movxx_rr(Reax, Rebx)
+        muvix_ld(Xmm0, Oeax, PLAIN)
+        addxx_ld(Reax, Mebp, trn_SSRC)
+        muvix_ld(Xmm1, Oeax, PLAIN)
+        addxx_ld(Reax, Mebp, trn_SSRC)
+        muvix_ld(Xmm2, Oeax, PLAIN)
+        addxx_ld(Reax, Mebp, trn_SSRC)
+        muvix_ld(Xmm3, Oeax, PLAIN)
+
+        unlix3rr(Xmm4, Xmm0, Xmm1)
+        unhix3rr(Xmm5, Xmm0, Xmm1)
+        unlix3rr(Xmm6, Xmm2, Xmm3)
+        unhix3rr(Xmm7, Xmm2, Xmm3)
+        unljx3rr(Xmm0, Xmm4, Xmm6)
+        unhjx3rr(Xmm1, Xmm4, Xmm6)
+        unljx3rr(Xmm2, Xmm5, Xmm7)
+        unhjx3rr(Xmm3, Xmm5, Xmm7)
+
+        muvix_st(Xmm0, Medi, DP(0x00))
+        addxx_ld(Redi, Mebp, trn_SDST)
+        muvix_st(Xmm1, Medi, DP(0x00))
+        addxx_ld(Redi, Mebp, trn_SDST)
+        muvix_st(Xmm2, Medi, DP(0x00))
+        addxx_ld(Redi, Mebp, trn_SDST)
+        muvix_st(Xmm3, Medi, DP(0x00))
+        addxx_ld(Redi, Mebp, trn_SDST)
+
+        addxx_ri(Rebx, IB(0x10))
+        subwx_ri(Recx, IB(4))
+        jmpxx_lb(100701b) /* trn_cqud */
+
+    LBL(100702) /* trn_ctal */
+
+        cmjwx_rz(Recx,
+        /* if */ EQ_x, 100703f) /* trn_rnxt */
+
+        movwx_ld(Reax, Mebx, DP(0x00))
+        movwx_st(Reax, Medi, DP(0x00))
+        addxx_ld(Rebx, Mebp, trn_SSRC)
+        movwx_ld(Reax, Mebx, DP(0x00))
+        movwx_st(Reax, Medi, DP(0x04))
+        addxx_ld(Rebx, Mebp, trn_SSRC)
+        movwx_ld(Reax, Mebx, DP(0x00))
+        movwx_st(Reax, Medi, DP(0x08))
+        addxx_ld(Rebx, Mebp, trn_SSRC)
+        movwx_ld(Reax, Mebx, DP(0x00))
+        movwx_st(Reax, Medi, DP(0x0C))
+        subxx_ld(Rebx, Mebp, trn_SSRC)
+        subxx_ld(Rebx, Mebp, trn_SSRC)
+        subxx_ld(Rebx, Mebp, trn_SSRC)
+        addxx_ld(Redi, Mebp, trn_SDST)
+
+        addxx_ri(Rebx, IB(0x04))
+        subwx_ri(Recx, IB(1))
+        jmpxx_lb(100702b) /* trn_ctal */
+
+    LBL(100703) /* trn_rnxt */
+
+        addxx_ld(Resi, Mebp, trn_SSRC)
+        addxx_ld(Resi, Mebp, trn_SSRC)
+        addxx_ld(Resi, Mebp, trn_SSRC)
+        addxx_ld(Resi, Mebp, trn_SSRC)
+        addxx_ri(Redx, IB(0x10))
+        subwx_mi(Mebp, trn_RCNT, IB(4))
+        jmpxx_lb(100700b) /* trn_rqud */
+
+    LBL(100704) /* trn_rows */
+
+        cmjwx_mz(Mebp, trn_RCNT,
+        /* if */ EQ_x, 100708f) /* trn_done */
+
+        movxx_rr(Rebx, Resi)
+        movxx_rr(Redi, Redx)
+        movwx_ld(Recx, Mebp, trn_CCNT)
+
+    LBL(100705) /* trn_quad */
+
+        cmjwx_ri(Recx, IB(4),
+        /* if */ LT_x, 100706f) /* trn_tail */
+
+        movwx_ld(Reax, Mebx, DP(0x00))
+        movwx_st(Reax, Medi, DP(0x00))
+        addxx_ld(Redi, Mebp, trn_SDST)
+        movwx_ld(Reax, Mebx, DP(0x04))
+        movwx_st(Reax, Medi, DP(0x00))
+        addxx_ld(Redi, Mebp, trn_SDST)
+        movwx_ld(Reax, Mebx, DP(0x08))
+        movwx_st(Reax, Medi, DP(0x00))
+        addxx_ld(Redi, Mebp, trn_SDST)
+        movwx_ld(Reax, Mebx, DP(0x0C))
+        movwx_st(Reax, Medi, DP(0x00))
+        addxx_ld(Redi, Mebp, trn_SDST)
+
+        addxx_ri(Rebx, IB(0x10))
+        subwx_ri(Recx, IB(4))
+        jmpxx_lb(100705b) /* trn_quad */
+
+    LBL(100706) /* trn_tail */
+
+        cmjwx_rz(Recx,
+        /* if */ EQ_x, 100707f) /* trn_next */
+
+        movwx_ld(Reax, Mebx, DP(0x00))
+        movwx_st(Reax, Medi, DP(0x00))
+        addxx_ld(Redi, Mebp, trn_SDST)
+
+        addxx_ri(Rebx, IB(0x04))
+        subwx_ri(Recx, IB(1))
+        jmpxx_lb(100706b) /* trn_tail */
+
+    LBL(100707) /* trn_next */
+
+        addxx_ld(Resi, Mebp, trn_SSRC)
+        addxx_ri(Redx, IB(0x04))
+        arjwx_mi(Mebp, trn_RCNT, IB(1),
+        sub_x, NZ_x, 100704b) /* trn_rows */
+
+    LBL(100708) /* trn_done */
+
+    ASM_LEAVE(info)
+}
+
+/******************************************************************************/
+/*************************   TRANSPOSE DRIVER   *******************************/
+/******************************************************************************/
+
+/*
+ * Transpose block of rows x cols elements at (r0, c0) of current matrix
+ * by splitting its longer side in halves until it fits the leaf size.
+ */
+static
+rt_void trns_tile(rt_SIMD_TRNS *info, rt_ui32 *src, rt_ui32 *dst,
+                  rt_si32 r0, rt_si32 rows, rt_si32 c0, rt_si32 cols)
+{
+    if (rows <= RT_TRNS_LEAF && cols <= RT_TRNS_LEAF)
+    {
+        info->lsrc = src + (rt_cell)r0 * info->lds + c0;
+        info->ldst = dst + (rt_cell)c0 * info->ldd + r0;
+        info->rcnt = rows;
+        info->ccnt = cols;
+        trns_leaf(info);
+    }
+    else
+    if (rows >= cols)
+    {
+        trns_tile(info, src, dst, r0, rows / 2, c0, cols);
+        trns_tile(info, src, dst, r0 + rows / 2, rows - rows / 2, c0, cols);
+    }
+    else
+    {
+        trns_tile(info, src, dst, r0, rows, c0, cols / 2);
+        trns_tile(info, src, dst, r0, rows, c0 + cols / 2, cols - cols / 2);
+    }
+}
+
+/*
+ * Transpose src (rows x cols) into dst (cols x rows) with parameters from info,
+ * repeated bcnt times with batch strides bsrc/bdst (NCHW <-> NHWC).
+ * Source and destination must not overlap.
+ * Structure must be initialized with ASM_INIT before the first use.
+ */
+static
+rt_void trns_run(rt_SIMD_TRNS *info)
+{
+    rt_si32 b, bcnt = RT_MAX(info->bcnt, 1);
+
+    if (info->rows <= 0 || info->cols <= 0)
+    {
+        return;
+    }
+
+    info->ssrc = (rt_cell)info->lds * sizeof(rt_ui32);
+    info->sdst = (rt_cell)info->ldd * sizeof(rt_ui32);
+
+    for (b = 0; b < bcnt; b++)
+    {
+        trns_tile(info, info->src + b * info->bsrc, info->dst + b * info->bdst,
+                  0, info->rows, 0, info->cols);
+    }
+}
+
+#endif /* RT_RTTRNS_H */
@@ -0,0 +1,1042 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2023 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTVECM_H
+#define RT_RTVECM_H
+
+#include "rtbase.h"
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rtvecm.h: batch vector/quaternion/matrix math on SoA packets
+ * in configurable cmdp* subset.
+ * Table of contents is provided below.
+ *
+ * Each packet holds S vectors, quaternions or matrices with each component
+ * stored as a SIMD-vector (SoA), one lane per item, so that all operations
+ * are plain lane-wise arithmetic without shuffles, same source on all targets.
+ * Packets are filled from AoS arrays with vcm_pack (unused lanes are zeroed)
+ * and read back with vcm_unpk, SIMD ISA has no broadcast from memory
+ * by design, therefore a single matrix applied to all lanes is broadcast
+ * into a packet in C/C++ with RT_SIMD_SET (rtbase.h), one per component.
+ *
+ * vcm_dot3: dot products of 3D vectors,
+ * vcm_crs3: cross products of 3D vectors,
+ * vcm_nrm3: normalization of 3D vectors via rsq (zero vectors give NaNs),
+ * vcm_xfm3: 3x3 matrix times 3D vector,
+ * vcm_xfm4: 4x4 matrix times 4D vector,
+ * vcm_mul3: 3x3 matrix product,
+ * vcm_mul4: 4x4 matrix product,
+ * vcm_qmul: quaternion (Hamilton) product,
+ * vcm_slrp: quaternion slerp with broadcast parameter t in [0, 1],
+ * vcm_inv4: 4x4 matrix inverse via 2x2 sub-determinants (cofactors).
+ *
+ * Slerp evaluates sin(t * a) / sin(a) for cos(a) in [0, 1] with the series
+ * of Eberly ("A Fast and Accurate Algorithm for Computing SLERP"),
+ * truncated at RT_VECM_TERM terms with corrected last term, using only
+ * mul/add (max error about 1.0e-6), the shorter arc is taken by flipping
+ * the sign of the 2nd quaternion when the dot product is negative.
+ *
+ * Outputs can alias the 1st input in all operations except vcm_inv4,
+ * outputs of vcm_xfm3, vcm_xfm4, vcm_qmul and vcm_slrp can alias any input.
+ */
+
+/*----------------------------------------------------------------------------*/
+
+/*************************   SIMD BACKEND STRUCTURE   *************************/
+
+/*************************   PACKET STRUCTURES   ******************************/
+
+/*************************   VECTOR/MATRIX KERNELS   **************************/
+
+/*************************   VECTOR/MATRIX DRIVERS   **************************/
+
+/*----------------------------------------------------------------------------*/
+
+/* number of terms of slerp series, kernel code is unrolled for 12 */
+#define RT_VECM_TERM        12
+
+/* correction factor of the last term of slerp series */
+#define RT_VECM_CORR        1.9
+
+/******************************************************************************/
+/*************************   SIMD BACKEND STRUCTURE   *************************/
+/******************************************************************************/
+
+/*
+ * SIMD vecm structure for ASM_ENTER/ASM_LEAVE contains slerp constants,
+ * kernel scratchpads and parameters set by drivers,
+ * must be initialized with ASM_INIT before use.
+ * Note that DP offsets below start where rt_SIMD_INFO ends (at Q*0x100).
+ * SIMD width is taken into account via S and Q from rtbase.h
+ * Structure is read-write in backend.
+ */
+struct rt_SIMD_VECM : public rt_SIMD_INFO
+{
+    /* slerp constants (SIMD-fields) */
+
+    rt_real slu[RT_VECM_TERM][S];   /* 1 / (i * (2 * i + 1)) */
+#define vcm_SLU(i)          DP(Q*0x100+Q*0x010*(i))
+
+    rt_real slv[RT_VECM_TERM][S];   /* i / (2 * i + 1) */
+#define vcm_SLV(i)          DP(Q*0x1C0+Q*0x010*(i))
+
+    /* slerp parameters (SIMD-fields) */
+
+    rt_real tval[S];        /* t */
+#define vcm_TVAL            DP(Q*0x280)
+
+    rt_real tsqr[S];        /* t * t */
+#define vcm_TSQR            DP(Q*0x290)
+
+    rt_real sval[S];        /* 1 - t */
+#define vcm_SVAL            DP(Q*0x2A0)
+
+    rt_real ssqr[S];        /* (1 - t) * (1 - t) */
+#define vcm_SSQR            DP(Q*0x2B0)
+
+    /* kernel scratchpads (SIMD-fields) */
+
+    rt_real sign[S];        /* sign of dot product in slerp */
+#define vcm_SIGN            DP(Q*0x2C0)
+
+    rt_real tmp0[S];        /* temporary result of quaternion product */
+#define vcm_TMP0            DP(Q*0x2D0)
+
+    rt_real sdet[6][S];     /* 2x2 sub-determinants of rows 0, 1 */
+#define vcm_S0              DP(Q*0x2E0)
+#define vcm_S1              DP(Q*0x2F0)
+#define vcm_S2              DP(Q*0x300)
+#define vcm_S3              DP(Q*0x310)
+#define vcm_S4              DP(Q*0x320)
+#define vcm_S5              DP(Q*0x330)
+
+    rt_real cdet[6][S];     /* 2x2 sub-determinants of rows 2, 3 */
+#define vcm_C0              DP(Q*0x340)
+#define vcm_C1              DP(Q*0x350)
+#define vcm_C2              DP(Q*0x360)
+#define vcm_C3              DP(Q*0x370)
+#define vcm_C4              DP(Q*0x380)
+#define vcm_C5              DP(Q*0x390)
+
+    rt_real idet[S];        /* +1 / determinant */
+#define vcm_IDET            DP(Q*0x3A0)
+
+    rt_real ndet[S];        /* -1 / determinant */
+#define vcm_NDET            DP(Q*0x3B0)
+
+    /* kernel parameters (scalar) */
+
+    rt_real*src0;           /* 1st input packets */
+#define vcm_SRC0            DP(Q*0x3C0+0x000*P+E)
+
+    rt_real*src1;           /* 2nd input packets */
+#define vcm_SRC1            DP(Q*0x3C0+0x004*P+E)
+
+    rt_real*dst0;           /* output packets */
+#define vcm_DST0            DP(Q*0x3C0+0x008*P+E)
+
+    rt_si32 pcnt;           /* number of packets */
+#define vcm_PCNT            DP(Q*0x3C0+0x00C*P+0x000)
+
+};
+
+/******************************************************************************/
+/*************************   PACKET STRUCTURES   ******************************/
+/******************************************************************************/
+
+/*
+ * Packet of S 3D vectors.
+ */
+struct rt_SIMD_VEC3
+{
+    rt_real x[S];
+#define vcm_X               DP(Q*0x000)
+
+    rt_real y[S];
+#define vcm_Y               DP(Q*0x010)
+
+    rt_real z[S];
+#define vcm_Z               DP(Q*0x020)
+
+};
+
+/*
+ * Packet of S 4D vectors (same offsets as 3D for x, y, z).
+ */
+struct rt_SIMD_VEC4
+{
+    rt_real x[S];
+    rt_real y[S];
+    rt_real z[S];
+
+    rt_real w[S];
+#define vcm_W               DP(Q*0x030)
+
+};
+
+/*
+ * Packet of S quaternions (x, y, z vector part, w scalar part).
+ */
+struct rt_SIMD_QUAT
+{
+    rt_real x[S];
+    rt_real y[S];
+    rt_real z[S];
+    rt_real w[S];
+};
+
+/*
+ * Packet of S 3x3 matrices, elements in row-major order.
+ */
+struct rt_SIMD_MAT3
+{
+    rt_real m[9][S];
+};
+
+#define vcm_N00             DP(Q*0x000)
+#define vcm_N01             DP(Q*0x010)
+#define vcm_N02             DP(Q*0x020)
+#define vcm_N10             DP(Q*0x030)
+#define vcm_N11             DP(Q*0x040)
+#define vcm_N12             DP(Q*0x050)
+#define vcm_N20             DP(Q*0x060)
+#define vcm_N21             DP(Q*0x070)
+#define vcm_N22             DP(Q*0x080)
+
+/*
+ * Packet of S 4x4 matrices, elements in row-major order.
+ */
+struct rt_SIMD_MAT4
+{
+    rt_real m[16][S];
+};
+
+#define vcm_M00             DP(Q*0x000)
+#define vcm_M01             DP(Q*0x010)
+#define vcm_M02             DP(Q*0x020)
+#define vcm_M03             DP(Q*0x030)
+#define vcm_M10             DP(Q*0x040)
+#define vcm_M11             DP(Q*0x050)
+#define vcm_M12             DP(Q*0x060)
+#define vcm_M13             DP(Q*0x070)
+#define vcm_M20             DP(Q*0x080)
+#define vcm_M21             DP(Q*0x090)
+#define vcm_M22             DP(Q*0x0A0)
+#define vcm_M23             DP(Q*0x0B0)
+#define vcm_M30             DP(Q*0x0C0)
+#define vcm_M31             DP(Q*0x0D0)
+#define vcm_M32             DP(Q*0x0E0)
+#define vcm_M33             DP(Q*0x0F0)
+
+/******************************************************************************/
+/*************************   VECTOR/MATRIX KERNELS   **************************/
+/******************************************************************************/
+
+/*
+ * Dot product of Xmm0, Xmm1, Xmm2 with 3 components at D0, D1, D2 of MB
+ * into XD, uses XT as temporary.
+ */
+#define vcm_DOT3(XD, XT, MB, D0, D1, D2)                                    \
+        movpx_ld(W(XD), W(MB), W(D0))                                       \
+        mulps_rr(W(XD), Xmm0)                                               \
+        movpx_ld(W(XT), W(MB), W(D1))                                       \
+        mulps_rr(W(XT), Xmm1)                                               \
+        addps_rr(W(XD), W(XT))                                              \
+        movpx_ld(W(XT), W(MB), W(D2))                                       \
+        mulps_rr(W(XT), Xmm2)                                               \
+        addps_rr(W(XD), W(XT))
+
+/*
+ * Dot product of Xmm0, Xmm1, Xmm2, Xmm3 with 4 components at D0, D1, D2, D3
+ * of MB into XD, uses XT as temporary.
+ */
+#define vcm_DOT4(XD, XT, MB, D0, D1, D2, D3)                                \
+        vcm_DOT3(W(XD), W(XT), W(MB), W(D0), W(D1), W(D2))                  \
+        movpx_ld(W(XT), W(MB), W(D3))                                       \
+        mulps_rr(W(XT), Xmm3)                                               \
+        addps_rr(W(XD), W(XT))
+
+/*
+ * Compute 2x2 sub-determinant A * B - C * D of Mesi into DD of Mebp.
+ */
+#define vcm_DET2(DA, DB, DC, DD, DR)                                        \
+        movpx_ld(Xmm0, Mesi, W(DA))                                         \
+        mulps_ld(Xmm0, Mesi, W(DB))                                         \
+        movpx_ld(Xmm1, Mesi, W(DC))                                         \
+        mulps_ld(Xmm1, Mesi, W(DD))                                         \
+        subps_rr(Xmm0, Xmm1)                                                \
+        movpx_st(Xmm0, Mebp, W(DR))
+
+/*
+ * Compute cofactor (A1 * C1 - A2 * C2 + A3 * C3) * DI with elements A
+ * of Mesi and sub-determinants C of Mebp, store at DO of Medi.
+ */
+#define vcm_COF3(A1, C1, A2, C2, A3, C3, DI, DO)                            \
+        movpx_ld(Xmm0, Mesi, W(A1))                                         \
+        mulps_ld(Xmm0, Mebp, W(C1))                                         \
+        movpx_ld(Xmm1, Mesi, W(A2))                                         \
+        mulps_ld(Xmm1, Mebp, W(C2))                                         \
+        subps_rr(Xmm0, Xmm1)                                                \
+        movpx_ld(Xmm1, Mesi, W(A3))                                         \
+        mulps_ld(Xmm1, Mebp, W(C3))                                         \
+        addps_rr(Xmm0, Xmm1)                                                \
+        mulps_ld(Xmm0, Mebp, W(DI))                                         \
+        movpx_st(Xmm0, Medi, W(DO))
+
+/*
+ * Apply slerp series term with constants DU, DV to Xmm3 (for t^2 in Xmm0)
+ * and Xmm4 (for (1-t)^2 in Xmm1) with cos(a) - 1 in Xmm2:
+ * r = 1 + (u * tt - v) * (x - 1) * r, uses Xmm5, Xmm6 as temporaries.
+ */
+#define vcm_TERM(DU, DV)                                                    \
+        movpx_ld(Xmm5, Mebp, W(DU))                                         \
+        movpx_rr(Xmm6, Xmm5)                                                \
+        mulps_rr(Xmm5, Xmm0)                                                \
+        subps_ld(Xmm5, Mebp, W(DV))                                         \
+        mulps_rr(Xmm5, Xmm2)                                                \
+        mulps_rr(Xmm3, Xmm5)                                                \
+        addps_ld(Xmm3, Mebp, inf_GPC01)                                     \
+        mulps_rr(Xmm6, Xmm1)                                                \
+        subps_ld(Xmm6, Mebp, W(DV))                                         \
+        mulps_rr(Xmm6, Xmm2)                                                \
+        mulps_rr(Xmm4, Xmm6)                                                \
+        addps_ld(Xmm4, Mebp, inf_GPC01)
+
+/* vcm_vdot (dot products of 3D vectors)
+ * reads: src0, src1, pcnt, writes: dst0 (S values per packet) */
+
+static
+rt_void vcm_vdot(rt_SIMD_VECM *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, vcm_SRC0)
+        movxx_ld(Rebx, Mebp, vcm_SRC1)
+        movxx_ld(Redi, Mebp, vcm_DST0)
+        movwx_ld(Recx, Mebp, vcm_PCNT)
+
+    LBL(101700) /* dot_loop */
+
+        movpx_ld(Xmm0, Mesi, vcm_X)
+        movpx_ld(Xmm1, Mesi, vcm_Y)
+        movpx_ld(Xmm2, Mesi, vcm_Z)
+        vcm_DOT3(Xmm3, Xmm4, Mebx, vcm_X, vcm_Y, vcm_Z)
+        movpx_st(Xmm3, Medi, DP(Q*0x000))
+
+        addxx_ri(Resi, IM(Q*0x030))
+        addxx_ri(Rebx, IM(Q*0x030))
+        addxx_ri(Redi, IM(Q*0x010))
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 101700b) /* dot_loop */
+
+    ASM_LEAVE(info)
+}
+
+/* vcm_vcrs (cross products of 3D vectors)
+ * reads: src0, src1, pcnt, writes: dst0 */
+
+static
+rt_void vcm_vcrs(rt_SIMD_VECM *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, vcm_SRC0)
+        movxx_ld(Rebx, Mebp, vcm_SRC1)
+        movxx_ld(Redi, Mebp, vcm_DST0)
+        movwx_ld(Recx, Mebp, vcm_PCNT)
+
+    LBL(101701) /* crs_loop */
+
+        movpx_ld(Xmm0, Mesi, vcm_X)
+        movpx_ld(Xmm1, Mesi, vcm_Y)
+        movpx_ld(Xmm2, Mesi, vcm_Z)
+
+        movpx_ld(Xmm3, Mebx, vcm_Z)
+        mulps_rr(Xmm3, Xmm1)
+        movpx_ld(Xmm6, Mebx, vcm_Y)
+        mulps_rr(Xmm6, Xmm2)
+        subps_rr(Xmm3, Xmm6)
+
+        movpx_ld(Xmm4, Mebx, vcm_X)
+        mulps_rr(Xmm4, Xmm2)
+        movpx_ld(Xmm6, Mebx, vcm_Z)
+        mulps_rr(Xmm6, Xmm0)
+        subps_rr(Xmm4, Xmm6)
+
+        movpx_ld(Xmm5, Mebx, vcm_Y)
+        mulps_rr(Xmm5, Xmm0)
+        movpx_ld(Xmm6, Mebx, vcm_X)
+        mulps_rr(Xmm6, Xmm1)
+        subps_rr(Xmm5, Xmm6)
+
+        movpx_st(Xmm3, Medi, vcm_X)
+        movpx_st(Xmm4, Medi, vcm_Y)
+        movpx_st(Xmm5, Medi, vcm_Z)
+
+        addxx_ri(Resi, IM(Q*0x030))
+        addxx_ri(Rebx, IM(Q*0x030))
+        addxx_ri(Redi, IM(Q*0x030))
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 101701b) /* crs_loop */
+
+    ASM_LEAVE(info)
+}
+
+/* vcm_vnrm (normalization of 3D vectors)
+ * reads: src0, pcnt, writes: dst0 */
+
+static
+rt_void vcm_vnrm(rt_SIMD_VECM *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, vcm_SRC0)
+        movxx_ld(Redi, Mebp, vcm_DST0)
+        movwx_ld(Recx, Mebp, vcm_PCNT)
+
+    LBL(101702) /* nrm_loop */
+
+        movpx_ld(Xmm0, Mesi, vcm_X)
+        movpx_ld(Xmm1, Mesi, vcm_Y)
+        movpx_ld(Xmm2, Mesi, vcm_Z)
+        vcm_DOT3(Xmm3, Xmm4, Mesi, vcm_X, vcm_Y, vcm_Z)
+        rsqps_rr(Xmm4, Xmm3)
+        mulps_rr(Xmm0, Xmm4)
+        mulps_rr(Xmm1, Xmm4)
+        mulps_rr(Xmm2, Xmm4)
+        movpx_st(Xmm0, Medi, vcm_X)
+        movpx_st(Xmm1, Medi, vcm_Y)
+        movpx_st(Xmm2, Medi, vcm_Z)
+
+        addxx_ri(Resi, IM(Q*0x030))
+        addxx_ri(Redi, IM(Q*0x030))
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 101702b) /* nrm_loop */
+
+    ASM_LEAVE(info)
+}
+
+/* vcm_mv33 (3x3 matrices times 3D vectors)
+ * reads: src0 (matrices), src1 (vectors), pcnt, writes: dst0 */
+
+static
+rt_void vcm_mv33(rt_SIMD_VECM *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, vcm_SRC0)
+        movxx_ld(Rebx, Mebp, vcm_SRC1)
+        movxx_ld(Redi, Mebp, vcm_DST0)
+        movwx_ld(Recx, Mebp, vcm_PCNT)
+
+    LBL(101703) /* mv3_loop */
+
+        movpx_ld(Xmm0, Mebx, vcm_X)
+        movpx_ld(Xmm1, Mebx, vcm_Y)
+        movpx_ld(Xmm2, Mebx, vcm_Z)
+        vcm_DOT3(Xmm3, Xmm6, Mesi, vcm_N00, vcm_N01, vcm_N02)
+        vcm_DOT3(Xmm4, Xmm6, Mesi, vcm_N10, vcm_N11, vcm_N12)
+        vcm_DOT3(Xmm5, Xmm6, Mesi, vcm_N20, vcm_N21, vcm_N22)
+        movpx_st(Xmm3, Medi, vcm_X)
+        movpx_st(Xmm4, Medi, vcm_Y)
+        movpx_st(Xmm5, Medi, vcm_Z)
+
+        addxx_ri(Resi, IM(Q*0x090))
+        addxx_ri(Rebx, IM(Q*0x030))
+        addxx_ri(Redi, IM(Q*0x030))
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 101703b) /* mv3_loop */
+
+    ASM_LEAVE(info)
+}
+
+/* vcm_mv44 (4x4 matrices times 4D vectors)
+ * reads: src0 (matrices), src1 (vectors), pcnt, writes: dst0 */
+
+static
+rt_void vcm_mv44(rt_SIMD_VECM *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, vcm_SRC0)
+        movxx_ld(Rebx, Mebp, vcm_SRC1)
+        movxx_ld(Redi, Mebp, vcm_DST0)
+        movwx_ld(Recx, Mebp, vcm_PCNT)
+
+    LBL(101704) /* mv4_loop */
+
+        movpx_ld(Xmm0, Mebx, vcm_X)
+        movpx_ld(Xmm1, Mebx, vcm_Y)
+        movpx_ld(Xmm2, Mebx, vcm_Z)
+        movpx_ld(Xmm3, Mebx, vcm_W)
+        vcm_DOT4(Xmm4, Xmm7, Mesi, vcm_M00, vcm_M01, vcm_M02, vcm_M03)
+        vcm_DOT4(Xmm5, Xmm7, Mesi, vcm_M10, vcm_M11, vcm_M12, vcm_M13)
+        vcm_DOT4(Xmm6, Xmm7, Mesi, vcm_M20, vcm_M21, vcm_M22, vcm_M23)
+        movpx_st(Xmm4, Medi, vcm_X)
+        movpx_st(Xmm5, Medi, vcm_Y)
+        movpx_st(Xmm6, Medi, vcm_Z)
+        vcm_DOT4(Xmm4, Xmm7, Mesi, vcm_M30, vcm_M31, vcm_M32, vcm_M33)
+        movpx_st(Xmm4, Medi, vcm_W)
+
+        addxx_ri(Resi, IG(Q*0x100))
+        addxx_ri(Rebx, IM(Q*0x040))
+        addxx_ri(Redi, IM(Q*0x040))
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 101704b) /* mv4_loop */
+
+    ASM_LEAVE(info)
+}
+
+/* vcm_mm33 (3x3 matrix products, output can alias src0)
+ * reads: src0, src1, pcnt, writes: dst0 */
+
+static
+rt_void vcm_mm33(rt_SIMD_VECM *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, vcm_SRC0)
+        movxx_ld(Rebx, Mebp, vcm_SRC1)
+        movxx_ld(Redi, Mebp, vcm_DST0)
+        movwx_ld(Recx, Mebp, vcm_PCNT)
+
+    LBL(101705) /* mm3_loop */
+
+        movpx_ld(Xmm0, Mesi, vcm_N00)
+        movpx_ld(Xmm1, Mesi, vcm_N01)
+        movpx_ld(Xmm2, Mesi, vcm_N02)
+        vcm_DOT3(Xmm3, Xmm6, Mebx, vcm_N00, vcm_N10, vcm_N20)
+        vcm_DOT3(Xmm4, Xmm6, Mebx, vcm_N01, vcm_N11, vcm_N21)
+        vcm_DOT3(Xmm5, Xmm6, Mebx, vcm_N02, vcm_N12, vcm_N22)
+        movpx_st(Xmm3, Medi, vcm_N00)
+        movpx_st(Xmm4, Medi, vcm_N01)
+        movpx_st(Xmm5, Medi, vcm_N02)
+
+        movpx_ld(Xmm0, Mesi, vcm_N10)
+        movpx_ld(Xmm1, Mesi, vcm_N11)
+        movpx_ld(Xmm2, Mesi, vcm_N12)
+        vcm_DOT3(Xmm3, Xmm6, Mebx, vcm_N00, vcm_N10, vcm_N20)
+        vcm_DOT3(Xmm4, Xmm6, Mebx, vcm_N01, vcm_N11, vcm_N21)
+        vcm_DOT3(Xmm5, Xmm6, Mebx, vcm_N02, vcm_N12, vcm_N22)
+        movpx_st(Xmm3, Medi, vcm_N10)
+        movpx_st(Xmm4, Medi, vcm_N11)
+        movpx_st(Xmm5, Medi, vcm_N12)
+
+        movpx_ld(Xmm0, Mesi, vcm_N20)
+        movpx_ld(Xmm1, Mesi, vcm_N21)
+        movpx_ld(Xmm2, Mesi, vcm_N22)
+        vcm_DOT3(Xmm3, Xmm6, Mebx, vcm_N00, vcm_N10, vcm_N20)
+        vcm_DOT3(Xmm4, Xmm6, Mebx, vcm_N01, vcm_N11, vcm_N21)
+        vcm_DOT3(Xmm5, Xmm6, Mebx, vcm_N02, vcm_N12, vcm_N22)
+        movpx_st(Xmm3, Medi, vcm_N20)
+        movpx_st(Xmm4, Medi, vcm_N21)
+        movpx_st(Xmm5, Medi, vcm_N22)
+
+        addxx_ri(Resi, IM(Q*0x090))
+        addxx_ri(Rebx, IM(Q*0x090))
+        addxx_ri(Redi, IM(Q*0x090))
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 101705b) /* mm3_loop */
+
+    ASM_LEAVE(info)
+}
+
+/*
+ * Compute row of 4x4 matrix product from row at DA0..DA3 of Mesi
+ * and columns of Mebx, store at DC0..DC3 of Medi.
+ */
+#define vcm_ROW4(DA0, DA1, DA2, DA3, DC0, DC1, DC2, DC3)                    \
+        movpx_ld(Xmm0, Mesi, W(DA0))                                        \
+        movpx_ld(Xmm1, Mesi, W(DA1))                                        \
+        movpx_ld(Xmm2, Mesi, W(DA2))                                        \
+        movpx_ld(Xmm3, Mesi, W(DA3))                                        \
+        vcm_DOT4(Xmm4, Xmm7, Mebx, vcm_M00, vcm_M10, vcm_M20, vcm_M30)      \
+        vcm_DOT4(Xmm5, Xmm7, Mebx, vcm_M01, vcm_M11, vcm_M21, vcm_M31)      \
+        vcm_DOT4(Xmm6, Xmm7, Mebx, vcm_M02, vcm_M12, vcm_M22, vcm_M32)      \
+        movpx_st(Xmm4, Medi, W(DC0))                                        \
+        movpx_st(Xmm5, Medi, W(DC1))                                        \
+        movpx_st(Xmm6, Medi, W(DC2))                                        \
+        vcm_DOT4(Xmm4, Xmm7, Mebx, vcm_M03, vcm_M13, vcm_M23, vcm_M33)      \
+        movpx_st(Xmm4, Medi, W(DC3))
+
+/* vcm_mm44 (4x4 matrix products, output can alias src0)
+ * reads: src0, src1, pcnt, writes: dst0 */
+
+static
+rt_void vcm_mm44(rt_SIMD_VECM *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, vcm_SRC0)
+        movxx_ld(Rebx, Mebp, vcm_SRC1)
+        movxx_ld(Redi, Mebp, vcm_DST0)
+        movwx_ld(Recx, Mebp, vcm_PCNT)
+
+    LBL(101706) /* mm4_loop */
+
+        vcm_ROW4(vcm_M00, vcm_M01, vcm_M02, vcm_M03,
+                 vcm_M00, vcm_M01, vcm_M02, vcm_M03)
+        vcm_ROW4(vcm_M10, vcm_M11, vcm_M12, vcm_M13,
+                 vcm_M10, vcm_M11, vcm_M12, vcm_M13)
+        vcm_ROW4(vcm_M20, vcm_M21, vcm_M22, vcm_M23,
+                 vcm_M20, vcm_M21, vcm_M22, vcm_M23)
+        vcm_ROW4(vcm_M30, vcm_M31, vcm_M32, vcm_M33,
+                 vcm_M30, vcm_M31, vcm_M32, vcm_M33)
+
+        addxx_ri(Resi, IG(Q*0x100))
+        addxx_ri(Rebx, IG(Q*0x100))
+        addxx_ri(Redi, IG(Q*0x100))
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 101706b) /* mm4_loop */
+
+    ASM_LEAVE(info)
+}
+
+/* vcm_qmlt (quaternion products a * b)
+ * reads: src0 (a), src1 (b), pcnt, writes: dst0 */
+
+static
+rt_void vcm_qmlt(rt_SIMD_VECM *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, vcm_SRC0)
+        movxx_ld(Rebx, Mebp, vcm_SRC1)
+        movxx_ld(Redi, Mebp, vcm_DST0)
+        movwx_ld(Recx, Mebp, vcm_PCNT)
+
+    LBL(101707) /* qml_loop */
+
+        movpx_ld(Xmm0, Mesi, vcm_X)
+        movpx_ld(Xmm1, Mesi, vcm_Y)
+        movpx_ld(Xmm2, Mesi, vcm_Z)
+        movpx_ld(Xmm3, Mesi, vcm_W)
+
+        /* w = aw * bw - ax * bx - ay * by - az * bz */
+        movpx_ld(Xmm4, Mebx, vcm_W)
+        mulps_rr(Xmm4, Xmm3)
+        vcm_DOT3(Xmm5, Xmm7, Mebx, vcm_X, vcm_Y, vcm_Z)
+        subps_rr(Xmm4, Xmm5)
+        movpx_st(Xmm4, Mebp, vcm_TMP0)
+
+        /* x = aw * bx + ax * bw + ay * bz - az * by */
+        movpx_ld(Xmm4, Mebx, vcm_X)
+        mulps_rr(Xmm4, Xmm3)
+        movpx_ld(Xmm7, Mebx, vcm_W)
+        mulps_rr(Xmm7, Xmm0)
+        addps_rr(Xmm4, Xmm7)
+        movpx_ld(Xmm7, Mebx, vcm_Z)
+        mulps_rr(Xmm7, Xmm1)
+        addps_rr(Xmm4, Xmm7)
+        movpx_ld(Xmm7, Mebx, vcm_Y)
+        mulps_rr(Xmm7, Xmm2)
+        subps_rr(Xmm4, Xmm7)
+
+        /* y = aw * by - ax * bz + ay * bw + az * bx */
+        movpx_ld(Xmm5, Mebx, vcm_Y)
+        mulps_rr(Xmm5, Xmm3)
+        movpx_ld(Xmm7, Mebx, vcm_Z)
+        mulps_rr(Xmm7, Xmm0)
+        subps_rr(Xmm5, Xmm7)
+        movpx_ld(Xmm7, Mebx, vcm_W)
+        mulps_rr(Xmm7, Xmm1)
+        addps_rr(Xmm5, Xmm7)
+        movpx_ld(Xmm7, Mebx, vcm_X)
+        mulps_rr(Xmm7, Xmm2)
+        addps_rr(Xmm5, Xmm7)
+
+        /* z = aw * bz + ax * by - ay * bx + az * bw */
+        movpx_ld(Xmm6, Mebx, vcm_Z)
+        mulps_rr(Xmm6, Xmm3)
+        movpx_ld(Xmm7, Mebx, vcm_Y)
+        mulps_rr(Xmm7, Xmm0)
+        addps_rr(Xmm6, Xmm7)
+        movpx_ld(Xmm7, Mebx, vcm_X)
+        mulps_rr(Xmm7, Xmm1)
+        subps_rr(Xmm6, Xmm7)
+        movpx_ld(Xmm7, Mebx, vcm_W)
+        mulps_rr(Xmm7, Xmm2)
+        addps_rr(Xmm6, Xmm7)
+
+        movpx_st(Xmm4, Medi, vcm_X)
+        movpx_st(Xmm5, Medi, vcm_Y)
+        movpx_st(Xmm6, Medi, vcm_Z)
+        movpx_ld(Xmm4, Mebp, vcm_TMP0)
+        movpx_st(Xmm4, Medi, vcm_W)
+
+        addxx_ri(Resi, IM(Q*0x040))
+        addxx_ri(Rebx, IM(Q*0x040))
+        addxx_ri(Redi, IM(Q*0x040))
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 101707b) /* qml_loop */
+
+    ASM_LEAVE(info)
+}
+
+/* vcm_qslr (quaternion slerp from a to b at t)
+ * reads: consts, tval, tsqr, sval, ssqr, src0 (a), src1 (b), pcnt,
+ * writes: dst0 */
+
+static
+rt_void vcm_qslr(rt_SIMD_VECM *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, vcm_SRC0)
+        movxx_ld(Rebx, Mebp, vcm_SRC1)
+        movxx_ld(Redi, Mebp, vcm_DST0)
+        movwx_ld(Recx, Mebp, vcm_PCNT)
+
+    LBL(101708) /* slr_loop */
+
+        movpx_ld(Xmm0, Mesi, vcm_X)
+        movpx_ld(Xmm1, Mesi, vcm_Y)
+        movpx_ld(Xmm2, Mesi, vcm_Z)
+        movpx_ld(Xmm3, Mesi, vcm_W)
+        vcm_DOT4(Xmm4, Xmm7, Mebx, vcm_X, vcm_Y, vcm_Z, vcm_W)
+
+        /* take the shorter arc, x - 1 = |dot| - 1 */
+        movpx_rr(Xmm2, Xmm4)
+        movpx_ld(Xmm7, Mebp, inf_GPC06)
+        andpx_rr(Xmm7, Xmm2)
+        movpx_st(Xmm7, Mebp, vcm_SIGN)
+        xorpx_rr(Xmm2, Xmm7)
+        subps_ld(Xmm2, Mebp, inf_GPC01)
+
+        movpx_ld(Xmm0, Mebp, vcm_TSQR)
+        movpx_ld(Xmm1, Mebp, vcm_SSQR)
+        movpx_ld(Xmm3, Mebp, inf_GPC01)
+        movpx_rr(Xmm4, Xmm3)
+
+        vcm_TERM(vcm_SLU(11), vcm_SLV(11))
+        vcm_TERM(vcm_SLU(10), vcm_SLV(10))
+        vcm_TERM(vcm_SLU(9), vcm_SLV(9))
+        vcm_TERM(vcm_SLU(8), vcm_SLV(8))
+        vcm_TERM(vcm_SLU(7), vcm_SLV(7))
+        vcm_TERM(vcm_SLU(6), vcm_SLV(6))
+        vcm_TERM(vcm_SLU(5), vcm_SLV(5))
+        vcm_TERM(vcm_SLU(4), vcm_SLV(4))
+        vcm_TERM(vcm_SLU(3), vcm_SLV(3))
+        vcm_TERM(vcm_SLU(2), vcm_SLV(2))
+        vcm_TERM(vcm_SLU(1), vcm_SLV(1))
+        vcm_TERM(vcm_SLU(0), vcm_SLV(0))
+
+        /* s1 = t * r(t) with sign of dot, s0 = (1 - t) * r(1 - t) */
+        mulps_ld(Xmm3, Mebp, vcm_TVAL)
+        xorpx_ld(Xmm3, Mebp, vcm_SIGN)
+        mulps_ld(Xmm4, Mebp, vcm_SVAL)
+
+        movpx_ld(Xmm0, Mesi, vcm_X)
+        mulps_rr(Xmm0, Xmm4)
+        movpx_ld(Xmm5, Mebx, vcm_X)
+        mulps_rr(Xmm5, Xmm3)
+        addps_rr(Xmm0, Xmm5)
+        movpx_ld(Xmm1, Mesi, vcm_Y)
+        mulps_rr(Xmm1, Xmm4)
+        movpx_ld(Xmm5, Mebx, vcm_Y)
+        mulps_rr(Xmm5, Xmm3)
+        addps_rr(Xmm1, Xmm5)
+        movpx_ld(Xmm2, Mesi, vcm_Z)
+        mulps_rr(Xmm2, Xmm4)
+        movpx_ld(Xmm5, Mebx, vcm_Z)
+        mulps_rr(Xmm5, Xmm3)
+        addps_rr(Xmm2, Xmm5)
+        movpx_ld(Xmm6, Mesi, vcm_W)
+        mulps_rr(Xmm6, Xmm4)
+        movpx_ld(Xmm5, Mebx, vcm_W)
+        mulps_rr(Xmm5, Xmm3)
+        addps_rr(Xmm6, Xmm5)
+
+        movpx_st(Xmm0, Medi, vcm_X)
+        movpx_st(Xmm1, Medi, vcm_Y)
+        movpx_st(Xmm2, Medi, vcm_Z)
+        movpx_st(Xmm6, Medi, vcm_W)
+
+        addxx_ri(Resi, IM(Q*0x040))
+        addxx_ri(Rebx, IM(Q*0x040))
+        addxx_ri(Redi, IM(Q*0x040))
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 101708b) /* slr_loop */
+
+    ASM_LEAVE(info)
+}
+
+/* vcm_mi44 (4x4 matrix inverses, output must not alias src0)
+ * reads: src0, pcnt, writes: dst0 */
+
+static
+rt_void vcm_mi44(rt_SIMD_VECM *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, vcm_SRC0)
+        movxx_ld(Redi, Mebp, vcm_DST0)
+        movwx_ld(Recx, Mebp, vcm_PCNT)
+
+    LBL(101709) /* inv_loop */
+
+        vcm_DET2(vcm_M00, vcm_M11, vcm_M10, vcm_M01, vcm_S0)
+        vcm_DET2(vcm_M00, vcm_M12, vcm_M10, vcm_M02, vcm_S1)
+        vcm_DET2(vcm_M00, vcm_M13, vcm_M10, vcm_M03, vcm_S2)
+        vcm_DET2(vcm_M01, vcm_M12, vcm_M11, vcm_M02, vcm_S3)
+        vcm_DET2(vcm_M01, vcm_M13, vcm_M11, vcm_M03, vcm_S4)
+        vcm_DET2(vcm_M02, vcm_M13, vcm_M12, vcm_M03, vcm_S5)
+        vcm_DET2(vcm_M20, vcm_M31, vcm_M30, vcm_M21, vcm_C0)
+        vcm_DET2(vcm_M20, vcm_M32, vcm_M30, vcm_M22, vcm_C1)
+        vcm_DET2(vcm_M20, vcm_M33, vcm_M30, vcm_M23, vcm_C2)
+        vcm_DET2(vcm_M21, vcm_M32, vcm_M31, vcm_M22, vcm_C3)
+        vcm_DET2(vcm_M21, vcm_M33, vcm_M31, vcm_M23, vcm_C4)
+        vcm_DET2(vcm_M22, vcm_M33, vcm_M32, vcm_M23, vcm_C5)
+
+        /* det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0 */
+        movpx_ld(Xmm0, Mebp, vcm_S0)
+        mulps_ld(Xmm0, Mebp, vcm_C5)
+        movpx_ld(Xmm1, Mebp, vcm_S1)
+        mulps_ld(Xmm1, Mebp, vcm_C4)
+        subps_rr(Xmm0, Xmm1)
+        movpx_ld(Xmm1, Mebp, vcm_S2)
+        mulps_ld(Xmm1, Mebp, vcm_C3)
+        addps_rr(Xmm0, Xmm1)
+        movpx_ld(Xmm1, Mebp, vcm_S3)
+        mulps_ld(Xmm1, Mebp, vcm_C2)
+        addps_rr(Xmm0, Xmm1)
+        movpx_ld(Xmm1, Mebp, vcm_S4)
+        mulps_ld(Xmm1, Mebp, vcm_C1)
+        subps_rr(Xmm0, Xmm1)
+        movpx_ld(Xmm1, Mebp, vcm_S5)
+        mulps_ld(Xmm1, Mebp, vcm_C0)
+        addps_rr(Xmm0, Xmm1)
+
+        movpx_ld(Xmm1, Mebp, inf_GPC01)
+        divps_rr(Xmm1, Xmm0)
+        movpx_st(Xmm1, Mebp, vcm_IDET)
+        xorpx_ld(Xmm1, Mebp, inf_GPC06)
+        movpx_st(Xmm1, Mebp, vcm_NDET)
+
+        vcm_COF3(vcm_M11, vcm_C5, vcm_M12, vcm_C4, vcm_M13, vcm_C3,
+                 vcm_IDET, vcm_M00)
+        vcm_COF3(vcm_M01, vcm_C5, vcm_M02, vcm_C4, vcm_M03, vcm_C3,
+                 vcm_NDET, vcm_M01)
+        vcm_COF3(vcm_M31, vcm_S5, vcm_M32, vcm_S4, vcm_M33, vcm_S3,
+                 vcm_IDET, vcm_M02)
+        vcm_COF3(vcm_M21, vcm_S5, vcm_M22, vcm_S4, vcm_M23, vcm_S3,
+                 vcm_NDET, vcm_M03)
+        vcm_COF3(vcm_M10, vcm_C5, vcm_M12, vcm_C2, vcm_M13, vcm_C1,
+                 vcm_NDET, vcm_M10)
+        vcm_COF3(vcm_M00, vcm_C5, vcm_M02, vcm_C2, vcm_M03, vcm_C1,
+                 vcm_IDET, vcm_M11)
+        vcm_COF3(vcm_M30, vcm_S5, vcm_M32, vcm_S2, vcm_M33, vcm_S1,
+                 vcm_NDET, vcm_M12)
+        vcm_COF3(vcm_M20, vcm_S5, vcm_M22, vcm_S2, vcm_M23, vcm_S1,
+                 vcm_IDET, vcm_M13)
+        vcm_COF3(vcm_M10, vcm_C4, vcm_M11, vcm_C2, vcm_M13, vcm_C0,
+                 vcm_IDET, vcm_M20)
+        vcm_COF3(vcm_M00, vcm_C4, vcm_M01, vcm_C2, vcm_M03, vcm_C0,
+                 vcm_NDET, vcm_M21)
+        vcm_COF3(vcm_M30, vcm_S4, vcm_M31, vcm_S2, vcm_M33, vcm_S0,
+                 vcm_IDET, vcm_M22)
+        vcm_COF3(vcm_M20, vcm_S4, vcm_M21, vcm_S2, vcm_M23, vcm_S0,
+                 vcm_NDET, vcm_M23)
+        vcm_COF3(vcm_M10, vcm_C3, vcm_M11, vcm_C1, vcm_M12, vcm_C0,
+                 vcm_NDET, vcm_M30)
+        vcm_COF3(vcm_M00, vcm_C3, vcm_M01, vcm_C1, vcm_M02, vcm_C0,
+                 vcm_IDET, vcm_M31)
+        vcm_COF3(vcm_M30, vcm_S3, vcm_M31, vcm_S1, vcm_M32, vcm_S0,
+                 vcm_NDET, vcm_M32)
+        vcm_COF3(vcm_M20, vcm_S3, vcm_M21, vcm_S1, vcm_M22, vcm_S0,
+                 vcm_IDET, vcm_M33)
+
+        addxx_ri(Resi, IG(Q*0x100))
+        addxx_ri(Redi, IG(Q*0x100))
+        arjwx_ri(Recx, IB(1),
+        sub_x, NZ_x, 101709b) /* inv_loop */
+
+    ASM_LEAVE(info)
+}
+
+/******************************************************************************/
+/*************************   VECTOR/MATRIX DRIVERS   **************************/
+/******************************************************************************/
+
+/*
+ * Set slerp constants.
+ * Structure must be initialized with ASM_INIT before the first use.
+ */
+static
+rt_void vcm_init(rt_SIMD_VECM *info)
+{
+    rt_si32 i;
+    rt_real c;
+
+    for (i = 1; i <= RT_VECM_TERM; i++)
+    {
+        c = i < RT_VECM_TERM ? (rt_real)1.0 : (rt_real)RT_VECM_CORR;
+        RT_SIMD_SET(info->slu[i - 1], c / (rt_real)(i * (2 * i + 1)));
+        RT_SIMD_SET(info->slv[i - 1], c * (rt_real)i / (rt_real)(2 * i + 1));
+    }
+}
+
+/*
+ * Pack n items of k components each from AoS array v into packets at p
+ * (k SIMD-vectors per packet), unused lanes of the last packet are zeroed.
+ */
+static
+rt_void vcm_pack(rt_real *p, const rt_real *v, rt_si32 k, rt_si32 n)
+{
+    rt_si32 i, j;
+
+    for (i = 0; i < (n + S - 1) / S * S; i++)
+    {
+        for (j = 0; j < k; j++)
+        {
+            p[(i / S) * k * S + j * S + i % S] = i < n ? v[i * k + j] : 0;
+        }
+    }
+}
+
+/*
+ * Unpack n items of k components each from packets at p into AoS array v.
+ */
+static
+rt_void vcm_unpk(rt_real *v, const rt_real *p, rt_si32 k, rt_si32 n)
+{
+    rt_si32 i, j;
+
+    for (i = 0; i < n; i++)
+    {
+        for (j = 0; j < k; j++)
+        {
+            v[i * k + j] = p[(i / S) * k * S + j * S + i % S];
+        }
+    }
+}
+
+/*
+ * Set kernel parameters and call kernel k on n packets.
+ */
+#define vcm_CALL(info, k, a, b, c, n)                                       \
+    if (n > 0)                                                              \
+    {                                                                       \
+        info->src0 = (rt_real *)(a);                                        \
+        info->src1 = (rt_real *)(b);                                        \
+        info->dst0 = (rt_real *)(c);                                        \
+        info->pcnt = n;                                                     \
+        k(info);                                                            \
+    }
+
+/*
+ * Dot products of n packets of 3D vectors a, b into c (S values each).
+ */
+static
+rt_void vcm_dot3(rt_SIMD_VECM *info, rt_SIMD_VEC3 *a, rt_SIMD_VEC3 *b,
+                 rt_real *c, rt_si32 n)
+{
+    vcm_CALL(info, vcm_vdot, a, b, c, n)
+}
+
+/*
+ * Cross products of n packets of 3D vectors a, b into c.
+ */
+static
+rt_void vcm_crs3(rt_SIMD_VECM *info, rt_SIMD_VEC3 *a, rt_SIMD_VEC3 *b,
+                 rt_SIMD_VEC3 *c, rt_si32 n)
+{
+    vcm_CALL(info, vcm_vcrs, a, b, c, n)
+}
+
+/*
+ * Normalize n packets of 3D vectors a into c.
+ */
+static
+rt_void vcm_nrm3(rt_SIMD_VECM *info, rt_SIMD_VEC3 *a,
+                 rt_SIMD_VEC3 *c, rt_si32 n)
+{
+    vcm_CALL(info, vcm_vnrm, a, RT_NULL, c, n)
+}
+
+/*
+ * Transform n packets of 3D vectors v by 3x3 matrices m into c.
+ */
+static
+rt_void vcm_xfm3(rt_SIMD_VECM *info, rt_SIMD_MAT3 *m, rt_SIMD_VEC3 *v,
+                 rt_SIMD_VEC3 *c, rt_si32 n)
+{
+    vcm_CALL(info, vcm_mv33, m, v, c, n)
+}
+
+/*
+ * Transform n packets of 4D vectors v by 4x4 matrices m into c.
+ */
+static
+rt_void vcm_xfm4(rt_SIMD_VECM *info, rt_SIMD_MAT4 *m, rt_SIMD_VEC4 *v,
+                 rt_SIMD_VEC4 *c, rt_si32 n)
+{
+    vcm_CALL(info, vcm_mv44, m, v, c, n)
+}
+
+/*
+ * Multiply n packets of 3x3 matrices a * b into c (c can alias a).
+ */
+static
+rt_void vcm_mul3(rt_SIMD_VECM *info, rt_SIMD_MAT3 *a, rt_SIMD_MAT3 *b,
+                 rt_SIMD_MAT3 *c, rt_si32 n)
+{
+    vcm_CALL(info, vcm_mm33, a, b, c, n)
+}
+
+/*
+ * Multiply n packets of 4x4 matrices a * b into c (c can alias a).
+ */
+static
+rt_void vcm_mul4(rt_SIMD_VECM *info, rt_SIMD_MAT4 *a, rt_SIMD_MAT4 *b,
+                 rt_SIMD_MAT4 *c, rt_si32 n)
+{
+    vcm_CALL(info, vcm_mm44, a, b, c, n)
+}
+
+/*
+ * Multiply n packets of quaternions a * b into c.
+ */
+static
+rt_void vcm_qmul(rt_SIMD_VECM *info, rt_SIMD_QUAT *a, rt_SIMD_QUAT *b,
+                 rt_SIMD_QUAT *c, rt_si32 n)
+{
+    vcm_CALL(info, vcm_qmlt, a, b, c, n)
+}
+
+/*
+ * Interpolate n packets of unit quaternions from a to b at t into c.
+ */
+static
+rt_void vcm_slrp(rt_SIMD_VECM *info, rt_SIMD_QUAT *a, rt_SIMD_QUAT *b,
+                 rt_real t, rt_SIMD_QUAT *c, rt_si32 n)
+{
+    RT_SIMD_SET(info->tval, t);
+    RT_SIMD_SET(info->tsqr, t * t);
+    RT_SIMD_SET(info->sval, (rt_real)1.0 - t);
+    RT_SIMD_SET(info->ssqr, ((rt_real)1.0 - t) * ((rt_real)1.0 - t));
+
+    vcm_CALL(info, vcm_qslr, a, b, c, n)
+}
+
+/*
+ * Invert n packets of 4x4 matrices a into c (c must not alias a),
+ * singular matrices give infinities or NaNs.
+ */
+static
+rt_void vcm_inv4(rt_SIMD_VECM *info, rt_SIMD_MAT4 *a,
+                 rt_SIMD_MAT4 *c, rt_si32 n)
+{
+    vcm_CALL(info, vcm_mi44, a, RT_NULL, c, n)
+}
+
+#undef vcm_CALL
+
+#endif /* RT_RTVECM_H */
@@ -4,5 +4,7 @@
 # works on Ubuntu MATE 18.04/20.04 LTS (binaries aren't backward compatible)
 
 make -f simd_make_x64.mk build -j8
+make -f kern_make_x64.mk build -j8
 
 make -f simd_make_x64.mk strip
+make -f kern_make_x64.mk strip
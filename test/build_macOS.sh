@@ -4,9 +4,13 @@
 # build on the least recent OS as binaries aren't always backward compatible
 
 make -f simd_make_x64.mk build -j8
+make -f kern_make_x64.mk build -j8
 
 make -f simd_make_x64.mk macRD
+make -f kern_make_x64.mk macRD
 
 make -f simd_make_x64.mk strip
+make -f kern_make_x64.mk strip
 
 make -f simd_make_x64.mk macOS
+make -f kern_make_x64.mk macOS
@@ -4,7 +4,11 @@
 # refer to individual makefiles for installation instructions
 
 make -f simd_make_x86.mk build -j4
+make -f kern_make_x86.mk build -j4
 make -f simd_make_x32.mk build
+make -f kern_make_x32.mk build
 
 make -f simd_make_x86.mk strip
+make -f kern_make_x86.mk strip
 make -f simd_make_x32.mk strip
+make -f kern_make_x32.mk strip
@@ -3,5 +3,7 @@
 # http://wiki.maemo.org/Documentation/Maemo_5_Final_SDK_Installation
 
 make -f simd_make_arm.mk build_n900
+make -f kern_make_arm.mk build_n900
 
 make -f simd_make_arm.mk strip_n900
+make -f kern_make_arm.mk strip_n900
@@ -3,5 +3,7 @@
 # with native g++ compiler installed (32-bit Raspbian 7 and 8 tested)
 
 make -f simd_make_arm.mk build_rpiX -j4
+make -f kern_make_arm.mk build_rpiX -j4
 
 make -f simd_make_arm.mk strip_rpiX
+make -f kern_make_arm.mk strip_rpiX
@@ -4,8 +4,14 @@
 # refer to individual makefiles for installation instructions
 
 make -f simd_make_arm.mk clean
+make -f kern_make_arm.mk clean
 make -f simd_make_m32.mk clean
+make -f kern_make_m32.mk clean
 make -f simd_make_p32.mk clean
+make -f kern_make_p32.mk clean
 make -f simd_make_a64.mk clean
+make -f kern_make_a64.mk clean
 make -f simd_make_m64.mk clean
+make -f kern_make_m64.mk clean
 make -f simd_make_p64.mk clean
+make -f kern_make_p64.mk clean
@@ -4,3 +4,4 @@
 # works on Ubuntu MATE 18.04/20.04 LTS (binaries aren't backward compatible)
 
 make -f simd_make_x64.mk clean
+make -f kern_make_x64.mk clean
@@ -4,3 +4,4 @@
 # build on the least recent OS as binaries aren't always backward compatible
 
 make -f simd_make_a64.mk macRM
+make -f kern_make_a64.mk macRM
@@ -4,4 +4,6 @@
 # refer to individual makefiles for installation instructions
 
 make -f simd_make_x86.mk clean
+make -f kern_make_x86.mk clean
 make -f simd_make_x32.mk clean
+make -f kern_make_x32.mk clean
@@ -3,3 +3,4 @@
 # http://wiki.maemo.org/Documentation/Maemo_5_Final_SDK_Installation
 
 make -f simd_make_arm.mk clean_n900
+make -f kern_make_arm.mk clean_n900
@@ -3,3 +3,4 @@
 # with native g++ compiler installed (32-bit Raspbian 7 and 8 tested)
 
 make -f simd_make_arm.mk clean_rpiX
+make -f kern_make_arm.mk clean_rpiX
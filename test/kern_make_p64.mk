@@ -0,0 +1,205 @@
+
+INC_PATH =                              \
+        -I../core/config/               \
+        -I../core/kernel/
+
+SRC_LIST =                              \
+        kern_test.cpp
+
+LIB_PATH =
+
+LIB_LIST =                              \
+        -lm
+
+
+build: build_p9 build_le build_be
+
+strip:
+	powerpc64le-linux-gnu-strip kern_test.p64???L*
+	powerpc64-linux-gnu-strip kern_test.p64???B*
+
+clean:
+	rm kern_test.p64*
+
+
+# using -mcpu=power8 for power9 targets is a workaround for QEMU 6.2.0 bug
+# https://bugs.launchpad.net/ubuntu/+source/qemu/+bug/2011832
+
+build_p9: kern_test_p64_32Lp9 kern_test_p64_64Lp9 \
+          kern_test_p64f32Lp9 kern_test_p64f64Lp9
+
+kern_test_p64_32Lp9:
+	powerpc64le-linux-gnu-g++ -O2 -g -static -mcpu=power8 \
+        -DRT_LINUX -DRT_P64 -DRT_128=2 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o kern_test.p64_32Lp9
+
+kern_test_p64_64Lp9:
+	powerpc64le-linux-gnu-g++ -O2 -g -static -mcpu=power8 \
+        -DRT_LINUX -DRT_P64 -DRT_128=2 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=64 -DRT_ENDIAN=0 \
+        ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o kern_test.p64_64Lp9
+
+kern_test_p64f32Lp9:
+	powerpc64le-linux-gnu-g++ -O2 -g -static -mcpu=power8 \
+        -DRT_LINUX -DRT_P64 -DRT_256=2 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o kern_test.p64f32Lp9
+
+kern_test_p64f64Lp9:
+	powerpc64le-linux-gnu-g++ -O2 -g -static -mcpu=power8 \
+        -DRT_LINUX -DRT_P64 -DRT_256=2 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=64 -DRT_ENDIAN=0 \
+        ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o kern_test.p64f64Lp9
+
+
+build_pX: kern_test_p64_32LpX kern_test_p64_64LpX \
+          kern_test_p64f32LpX kern_test_p64f64LpX
+
+kern_test_p64_32LpX:
+	powerpc64le-linux-gnu-g++ -O0 -g -static \
+        -DRT_LINUX -DRT_P64 -DRT_256=8 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o kern_test.p64_32LpX
+
+kern_test_p64_64LpX:
+	powerpc64le-linux-gnu-g++ -O0 -g -static \
+        -DRT_LINUX -DRT_P64 -DRT_256=8 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=64 -DRT_ENDIAN=0 \
+        ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o kern_test.p64_64LpX
+
+kern_test_p64f32LpX:
+	powerpc64le-linux-gnu-g++ -O0 -g -static \
+        -DRT_LINUX -DRT_P64 -DRT_512=2 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o kern_test.p64f32LpX
+
+kern_test_p64f64LpX:
+	powerpc64le-linux-gnu-g++ -O0 -g -static \
+        -DRT_LINUX -DRT_P64 -DRT_512=2 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=64 -DRT_ENDIAN=0 \
+        ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o kern_test.p64f64LpX
+
+
+build_le: kern_test_p64_32Lp8 kern_test_p64_64Lp8 \
+          kern_test_p64f32Lp8 kern_test_p64f64Lp8
+
+kern_test_p64_32Lp8:
+	powerpc64le-linux-gnu-g++ -O2 -g -static -mcpu=power8 \
+        -DRT_LINUX -DRT_P64 -DRT_128=1 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o kern_test.p64_32Lp8
+
+kern_test_p64_64Lp8:
+	powerpc64le-linux-gnu-g++ -O2 -g -static -mcpu=power8 \
+        -DRT_LINUX -DRT_P64 -DRT_128=1 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=64 -DRT_ENDIAN=0 \
+        ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o kern_test.p64_64Lp8
+
+kern_test_p64f32Lp8:
+	powerpc64le-linux-gnu-g++ -O2 -g -static -mcpu=power8 \
+        -DRT_LINUX -DRT_P64 -DRT_256=1 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o kern_test.p64f32Lp8
+
+kern_test_p64f64Lp8:
+	powerpc64le-linux-gnu-g++ -O2 -g -static -mcpu=power8 \
+        -DRT_LINUX -DRT_P64 -DRT_256=1 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=64 -DRT_ENDIAN=0 \
+        ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o kern_test.p64f64Lp8
+
+
+build_be: kern_test_p64_32Bp7 kern_test_p64_64Bp7 \
+          kern_test_p64f32Bp7 kern_test_p64f64Bp7
+
+kern_test_p64_32Bp7:
+	powerpc64-linux-gnu-g++ -O2 -g -static \
+        -DRT_LINUX -DRT_P64 -DRT_128=1 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=1 \
+        ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o kern_test.p64_32Bp7
+
+kern_test_p64_64Bp7:
+	powerpc64-linux-gnu-g++ -O2 -g -static \
+        -DRT_LINUX -DRT_P64 -DRT_128=1 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=64 -DRT_ENDIAN=1 \
+        ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o kern_test.p64_64Bp7
+
+kern_test_p64f32Bp7:
+	powerpc64-linux-gnu-g++ -O2 -g -static \
+        -DRT_LINUX -DRT_P64 -DRT_256=1 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=1 \
+        ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o kern_test.p64f32Bp7
+
+kern_test_p64f64Bp7:
+	powerpc64-linux-gnu-g++ -O2 -g -static \
+        -DRT_LINUX -DRT_P64 -DRT_256=1 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=64 -DRT_ENDIAN=1 \
+        ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o kern_test.p64f64Bp7
+
+
+# On Ubuntu (MATE) 16.04-22.04 add "universe multiverse" to "main restricted"
+# in /etc/apt/sources.list (sudo nano /etc/apt/sources.list) then run:
+# sudo apt-get update
+# (Ubuntu MATE is set up for an update without a need to edit the file)
+# (extended repositories "universe multiverse" are only needed for clang)
+#
+# Prerequisites for the build:
+# (cross-)compiler for 64-bit POWER is installed and in the PATH variable.
+# sudo apt-get install make g++-powerpc64le-linux-gnu
+# sudo apt-get install make g++-powerpc64-linux-gnu
+# (recent g++-5-powerpc64le series target POWER8 and don't work well with -O3)
+#
+# Prerequisites for emulation:
+# recent QEMU(-2.5) is installed or built from source and in the PATH variable.
+# POWER9 target requires more recent QEMU, tested with 3.x.y series and 4.2.0.
+# QEMU versions 4.x.y prior to 4.2.0 show issues with POWER8/9 fp32 LE targets.
+# sudo apt-get install qemu-user
+#
+# Compiling/running SIMD test:
+# make -f simd_make_p64.mk
+# qemu-ppc64le -cpu POWER9 kern_test.p64_32Lp9 -c 1
+# qemu-ppc64le -cpu POWER9 kern_test.p64_64Lp9 -c 1
+# qemu-ppc64le -cpu POWER9 kern_test.p64f32Lp9 -c 1
+# qemu-ppc64le -cpu POWER9 kern_test.p64f64Lp9 -c 1
+# qemu-ppc64le -cpu POWER9 kern_test.p64_32LpX -c 1
+# qemu-ppc64le -cpu POWER9 kern_test.p64_64LpX -c 1
+# qemu-ppc64le -cpu POWER9 kern_test.p64f32LpX -c 1
+# qemu-ppc64le -cpu POWER9 kern_test.p64f64LpX -c 1
+# qemu-ppc64le -cpu POWER8 kern_test.p64_32Lp8 -c 1 (use POWER9 on Ubuntu 22.04)
+# qemu-ppc64le -cpu POWER8 kern_test.p64_64Lp8 -c 1 (use POWER9 on Ubuntu 22.04)
+# qemu-ppc64le -cpu POWER8 kern_test.p64f32Lp8 -c 1 (use POWER9 on Ubuntu 22.04)
+# qemu-ppc64le -cpu POWER8 kern_test.p64f64Lp8 -c 1 (use POWER9 on Ubuntu 22.04)
+# qemu-ppc64   -cpu POWER7 kern_test.p64_32Bp7 -c 1
+# qemu-ppc64   -cpu POWER7 kern_test.p64_64Bp7 -c 1
+# qemu-ppc64   -cpu POWER7 kern_test.p64f32Bp7 -c 1
+# qemu-ppc64   -cpu POWER7 kern_test.p64f64Bp7 -c 1
+# Use "-c 1" option to reduce test time when emulating with QEMU
+
+# Clang native build works too (takes much longer prior to 3.8), use (replace):
+# clang++ -O0 (in place of ...-g++ -O2) on 64-bit POWER host (Tyan TN71-BP012)
+# sudo apt-get install clang
+
+# For interpretation of SIMD build flags check compatibility layer in rtzero.h.
+# The RT_SIMD_COMPAT_PW8=1 flag below is redundant when building in LE mode.
+
+# For 128-bit VSX1 build use (replace): RT_128=1            (30 SIMD registers)
+# For 128-bit VSX2 build use (replace): RT_128=1 RT_SIMD_COMPAT_PW8=1 (30 regs)
+# For 128-bit VSX3 build use (replace): RT_128=2            (30 SIMD registers)
+# For 128-bit VMX  build use (replace): RT_128=4 RT_SIMD_COMPAT_VSX=0 (15 regs)
+
+# For 256-bit VMX  build use (replace): RT_256_R8=4 RT_SIMD_COMPAT_VSX=0 (8 rp)
+# For 256-bit VSX1 build use (replace): RT_256=1            (15 SIMD reg-pairs)
+# For 256-bit VSX2 build use (replace): RT_256=1 RT_SIMD_COMPAT_PW8=1   (15 rp)
+# For 256-bit VSX3 build use (replace): RT_256=2            (15 SIMD reg-pairs)
+# For 256-bit VSX1 build use (replace): RT_256=4 (<=test29) (30 SIMD reg-pairs)
+# For 256-bit VSX2 build use (replace): RT_256=4 RT_SIMD_COMPAT_PW8=1   (30 rp)
+# For 256-bit VSX3 build use (replace): RT_256=8 (<=test29) (30 SIMD reg-pairs)
+
+# For 512-bit VSX1 build use (replace): RT_512=1 (<=test29) (15 SIMD reg-quads)
+# For 512-bit VSX2 build use (replace): RT_512=1 RT_SIMD_COMPAT_PW8=1   (15 rq)
+# For 512-bit VSX3 build use (replace): RT_512=2 (<=test29) (15 SIMD reg-quads)
+
+# 64/32-bit (ptr/adr) hybrid mode is compatible with native 64-bit ABI,
+# use (replace): RT_ADDRESS=32, rename the binary to kern_test.p64_**
+# 64-bit packed SIMD mode (fp64/int64) is supported on 64-bit targets,
+# use (replace): RT_ELEMENT=64, rename the binary to kern_test.p64*64
@@ -0,0 +1,6246 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2023 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <algorithm> /* std::sort as host library reference for sorting */
+
+/* to compare with host BLAS library define RT_HOST_BLAS
+ * and add -lblas (or -lopenblas) to LIB_LIST in makefiles,
+ * system headers go before rtbase.h due to its short macro names */
+
+#ifdef RT_HOST_BLAS
+#include <cblas.h>
+#endif /* RT_HOST_BLAS */
+
+#define RT_SIMD_CODE /* enable SIMD instruction definitions */
+#define RT_PRINT_CPP /* enable printouts from C++ code sections of the tests */
+#define RT_PRINT_ASM /* enable printouts from ASM code sections of the tests */
+#define RT_PRINT_NUM /* enable printouts of test times and SIMD version */
+#define RT_SCAN_LIBC 0 /* test SIMD kernels on all targets */
+
+/*
+ * Kernel tests validate kernels from core/kernel against C++ references
+ * and measure their performance, C++ and ASM times are printed separately.
+ * Unlike simd_test, data sets are sized to exceed SIMD width by far
+ * in order to exercise head/tail handling and to produce meaningful timings.
+ */
+
+#include "rtbase.h"
+#include "rtblas.h"
+#include "rtgemm.h"
+#include "rttrns.h"
+#include "rtfilt.h"
+#include "rtimgf.h"
+#include "rtffts.h"
+#include "rtsort.h"
+#include "rtscan.h"
+#include "rthist.h"
+#include "rthash.h"
+#include "rtrays.h"
+#include "rtbvhs.h"
+#include "rtvecm.h"
+#include "rtpoly.h"
+#include "rtquad.h"
+#include "rthalf.h"
+
+/******************************************************************************/
+/*******************************   DEFINITIONS   ******************************/
+/******************************************************************************/
+
+#define SUB_TEST            32
+#define CYC_SIZE            10000
+
+#define ARR_SIZE            4096 /* multiple of S for all supported targets */
+#define RES_SIZE            4 /* number of scalar results per subtest */
+
+#define GMM_M               251 /* GEMM dimensions, not multiples of tiles */
+#define GMM_N               253
+#define GMM_K               255
+
+#define TRN_B               4   /* transpose batch (NCHW <-> NHWC) */
+#define TRN_R               509 /* transpose dimensions, not multiples */
+#define TRN_C               1021 /* of leaf blocks, sized to exceed L2 */
+#define FIR_T1              67  /* FIR taps, not multiple of R */
+#define FIR_T2              256 /* FIR taps, long filter */
+
+#define BQD_C               5   /* biquad channels, not multiple of R */
+#define BQD_S               3   /* biquad stages in cascade */
+
+#define IMG_W               3840 /* image planes (4K frame), width */
+#define IMG_H               2160 /* isn't multiple of strips (tiles) */
+#define BOX_R1              2   /* box blur radius, small */
+#define BOX_R2              12  /* box blur radius, large */
+
+#define FFT_N               1024 /* FFT points, radix-4 with radix-2 stage */
+#define FFT_S               64  /* FFT points, short (fewer than S * S) */
+
+#define SRT_N               1048576 /* sort keys, multiple of tiles */
+#define SRT_H               (SRT_N/2 - 7) /* sort keys, split with tail */
+#define SRS_N               1024 /* small sort keys, SRT_N/SRS_N slices */
+#define SRL_N               8388608 /* large sort keys, fit 32-bit address */
+
+#define SCN_N               4194304 /* scan buffer (text log), bytes */
+#define SCN_O               3   /* scan offset, isn't multiple of J */
+
+#define HST_N               2097151 /* histogram values, odd count */
+#define HST_B               1000 /* histogram bins, quantized values */
+
+#define HSH_N               1048575 /* hash keys, odd count */
+#define HSH_S               256 /* hash strings, short lengths */
+
+#define RAY_N               16384 /* rays, multiple of max S */
+#define RAY_M               64  /* triangles */
+#define RAY_B               16  /* boxes */
+#define RAY_W               16  /* wide BVH nodes */
+#define RAY_R               256 /* rays tested against nodes */
+
+#define BVH_N               65535 /* bvh boxes, odd count */
+#define BVH_R               16  /* rays traversing bvh */
+
+#define VCM_N               16383 /* vectors/matrices, odd count */
+
+#define KSM_N               1048575 /* compensated sum terms, odd count */
+#define KSM_M               1048576 /* compensated sum arrays stride */
+#define KSM_R               (3*KSM_M+16) /* references: sum, dot, |sum|, |dot| */
+
+#if RT_ELEMENT == 32
+#define KSM_E               12  /* max exponent of cancelling terms */
+#define KSM_U               1.1920929e-7  /* machine epsilon */
+#else  /* RT_ELEMENT == 64 */
+#define KSM_E               40  /* max exponent of cancelling terms */
+#define KSM_U               2.220446049250313e-16  /* machine epsilon */
+#endif /* RT_ELEMENT */
+
+#define QUD_N               65535 /* double-double values, odd count */
+#define QUD_Z               ((QUD_N+15)/16*32) /* packed array size, max T */
+#define QUD_IX(i)           ((i) / T * 2 * T + (i) % T) /* hi index in packet */
+
+#define HLF_N               65535 /* fp16 values, odd count */
+#define HLF_Z               ((HLF_N+127)/128*128) /* array size, max N */
+
+#define MASK                (RT_SIMD_ALIGN - 1) /* SIMD alignment mask */
+
+/* NOTE: floating point values are not tested for equality precisely due to
+ * the slight difference in SIMD/FPU implementations across supported targets */
+#define FRK(f)              (RT_FABS(f) < 10.0       ?   0.0001   :         \
+                             RT_FABS(f) < 100.0      ?   0.001    :         \
+                             RT_FABS(f) < 1000.0     ?   0.01     :         \
+                             RT_FABS(f) < 10000.0    ?   0.1      :         \
+                             RT_FABS(f) < 100000.0   ?   1.0      :         \
+                             RT_FABS(f) < 1000000.0  ?  10.0      :  100.0)
+
+#define IEQ(i1, i2)         (i1 == i2)
+
+#define FEQ(f1, f2)         (RT_FABS((f1) - (f2)) <= t_diff *               \
+                             RT_MIN(FRK(f1), FRK(f2)))
+
+#define RT_LOGI             printf
+#define RT_LOGE             printf
+
+/******************************************************************************/
+/***************************   VARS, FUNCS, TYPES   ***************************/
+/******************************************************************************/
+
+rt_si32     n_init      = 0;            /* subtest-init (from command-line) */
+rt_si32     n_done      = SUB_TEST-1;   /* subtest-done (from command-line) */
+rt_si32     t_diff      = 2;          /* diff-threshold (from command-line) */
+rt_si32     r_test      = CYC_SIZE;   /* test-redundant (from command-line) */
+rt_bool     v_mode      = RT_FALSE;     /* verbose mode (from command-line) */
+
+/*
+ * Get system time in milliseconds.
+ */
+rt_time get_time();
+
+/*
+ * Allocate memory from system heap.
+ */
+rt_pntr sys_alloc(rt_size size);
+
+/*
+ * Free memory from system heap.
+ */
+rt_void sys_free(rt_pntr ptr, rt_size size);
+
+/*
+ * Extended SIMD info structure for ASM_ENTER/ASM_LEAVE
+ * serves as a container for test arrays and kernel structures.
+ * Note that DP offsets below start where rt_SIMD_INFO ends (at Q*0x100).
+ * SIMD width is taken into account via S and Q from rtbase.h
+ */
+struct rt_SIMD_INFOX : public rt_SIMD_INFO
+{
+    /* internal variables */
+
+    rt_si32 cyc;
+#define inf_CYC             DP(Q*0x100+0x000)
+
+    rt_si32 size;
+#define inf_SIZE            DP(Q*0x100+0x004)
+
+    /* floating point arrays */
+
+    rt_real*far0;
+#define inf_FAR0            DP(Q*0x100+0x008+0x000*P+E)
+
+    rt_real*far1;
+#define inf_FAR1            DP(Q*0x100+0x008+0x004*P+E)
+
+    rt_real*fco1;
+#define inf_FCO1            DP(Q*0x100+0x008+0x008*P+E)
+
+    rt_real*fco2;
+#define inf_FCO2            DP(Q*0x100+0x008+0x00C*P+E)
+
+    rt_real*fso1;
+#define inf_FSO1            DP(Q*0x100+0x008+0x010*P+E)
+
+    rt_real*fso2;
+#define inf_FSO2            DP(Q*0x100+0x008+0x014*P+E)
+
+    /* scalar results */
+
+    rt_real*frc0;
+#define inf_FRC0            DP(Q*0x100+0x008+0x018*P+E)
+
+    rt_real*frs0;
+#define inf_FRS0            DP(Q*0x100+0x008+0x01C*P+E)
+
+    rt_elem*irc0;
+#define inf_IRC0            DP(Q*0x100+0x008+0x020*P+E)
+
+    rt_elem*irs0;
+#define inf_IRS0            DP(Q*0x100+0x008+0x024*P+E)
+
+    /* matrices */
+
+    rt_real*mat0;
+#define inf_MAT0            DP(Q*0x100+0x008+0x028*P+E)
+
+    rt_real*mat1;
+#define inf_MAT1            DP(Q*0x100+0x008+0x02C*P+E)
+
+    rt_real*mco0;
+#define inf_MCO0            DP(Q*0x100+0x008+0x030*P+E)
+
+    rt_real*mso0;
+#define inf_MSO0            DP(Q*0x100+0x008+0x034*P+E)
+
+    rt_real*mho0;
+#define inf_MHO0            DP(Q*0x100+0x008+0x038*P+E)
+
+    /* transpose buffers */
+
+    rt_ui32*tsrc;
+#define inf_TSRC            DP(Q*0x100+0x008+0x03C*P+E)
+
+    rt_ui32*tco0;
+#define inf_TCO0            DP(Q*0x100+0x008+0x040*P+E)
+
+    rt_ui32*tso0;
+#define inf_TSO0            DP(Q*0x100+0x008+0x044*P+E)
+
+    /* single precision arrays */
+
+    rt_fp32*sar0;
+#define inf_SAR0            DP(Q*0x100+0x008+0x048*P+E)
+
+    rt_fp32*sco1;
+#define inf_SCO1            DP(Q*0x100+0x008+0x04C*P+E)
+
+    rt_fp32*sco2;
+#define inf_SCO2            DP(Q*0x100+0x008+0x050*P+E)
+
+    rt_fp32*sso1;
+#define inf_SSO1            DP(Q*0x100+0x008+0x054*P+E)
+
+    rt_fp32*sso2;
+#define inf_SSO2            DP(Q*0x100+0x008+0x058*P+E)
+
+    /* kernel structures */
+
+    rt_SIMD_BLAS *blas;
+#define inf_BLAS            DP(Q*0x100+0x008+0x05C*P+E)
+
+    rt_SIMD_GEMM *gemm;
+#define inf_GEMM            DP(Q*0x100+0x008+0x060*P+E)
+
+    rt_SIMD_TRNS *trns;
+#define inf_TRNS            DP(Q*0x100+0x008+0x064*P+E)
+
+    rt_SIMD_FIRF *firf;
+#define inf_FIRF            DP(Q*0x100+0x008+0x068*P+E)
+
+    rt_SIMD_BIQD *biqd;
+#define inf_BIQD            DP(Q*0x100+0x008+0x06C*P+E)
+
+    rt_SIMD_IMGF *imgf;
+#define inf_IMGF            DP(Q*0x100+0x008+0x070*P+E)
+
+    /* image planes */
+
+    rt_ui08*isrc;
+#define inf_ISRC            DP(Q*0x100+0x008+0x074*P+E)
+
+    rt_ui08*ico1;
+#define inf_ICO1            DP(Q*0x100+0x008+0x078*P+E)
+
+    rt_ui08*ico2;
+#define inf_ICO2            DP(Q*0x100+0x008+0x07C*P+E)
+
+    rt_ui08*iso1;
+#define inf_ISO1            DP(Q*0x100+0x008+0x080*P+E)
+
+    rt_ui08*iso2;
+#define inf_ISO2            DP(Q*0x100+0x008+0x084*P+E)
+
+    /* FFT plans */
+
+    rt_SIMD_FFTS *fftl;
+#define inf_FFTL            DP(Q*0x100+0x008+0x088*P+E)
+
+    rt_SIMD_FFTS *ffts;
+#define inf_FFTS            DP(Q*0x100+0x008+0x08C*P+E)
+
+    /* sort arrays and structure */
+
+    rt_real*kar0;
+#define inf_KAR0            DP(Q*0x100+0x008+0x090*P+E)
+
+    rt_real*kco0;
+#define inf_KCO0            DP(Q*0x100+0x008+0x094*P+E)
+
+    rt_real*kso0;
+#define inf_KSO0            DP(Q*0x100+0x008+0x098*P+E)
+
+    rt_real*kho0;
+#define inf_KHO0            DP(Q*0x100+0x008+0x09C*P+E)
+
+    rt_elem*jar0;
+#define inf_JAR0            DP(Q*0x100+0x008+0x0A0*P+E)
+
+    rt_elem*jco0;
+#define inf_JCO0            DP(Q*0x100+0x008+0x0A4*P+E)
+
+    rt_elem*jso0;
+#define inf_JSO0            DP(Q*0x100+0x008+0x0A8*P+E)
+
+    rt_elem*jho0;
+#define inf_JHO0            DP(Q*0x100+0x008+0x0AC*P+E)
+
+    rt_elem*vco0;
+#define inf_VCO0            DP(Q*0x100+0x008+0x0B0*P+E)
+
+    rt_elem*vso0;
+#define inf_VSO0            DP(Q*0x100+0x008+0x0B4*P+E)
+
+    rt_elem*vho0;
+#define inf_VHO0            DP(Q*0x100+0x008+0x0B8*P+E)
+
+    rt_SIMD_SORT *sort;
+#define inf_SORT            DP(Q*0x100+0x008+0x0BC*P+E)
+
+    /* scan buffer and structure */
+
+    rt_ui08*text;
+#define inf_TEXT            DP(Q*0x100+0x008+0x0C0*P+E)
+
+    rt_SIMD_SCAN *scan;
+#define inf_SCAN            DP(Q*0x100+0x008+0x0C4*P+E)
+
+    /* histogram inputs, outputs and structure */
+
+    rt_ui08*hb00;
+#define inf_HB00            DP(Q*0x100+0x008+0x0C8*P+E)
+
+    rt_ui08*hb01;
+#define inf_HB01            DP(Q*0x100+0x008+0x0CC*P+E)
+
+    rt_ui16*hw00;
+#define inf_HW00            DP(Q*0x100+0x008+0x0D0*P+E)
+
+    rt_ui16*hw01;
+#define inf_HW01            DP(Q*0x100+0x008+0x0D4*P+E)
+
+    rt_real*hr00;
+#define inf_HR00            DP(Q*0x100+0x008+0x0D8*P+E)
+
+    rt_real*hr01;
+#define inf_HR01            DP(Q*0x100+0x008+0x0DC*P+E)
+
+    rt_elem*hco0;
+#define inf_HCO0            DP(Q*0x100+0x008+0x0E0*P+E)
+
+    rt_elem*hso0;
+#define inf_HSO0            DP(Q*0x100+0x008+0x0E4*P+E)
+
+    rt_SIMD_HIST *hist;
+#define inf_HIST            DP(Q*0x100+0x008+0x0E8*P+E)
+
+    /* hash keys, outputs and structure */
+
+    rt_ui32*hk32;
+#define inf_HK32            DP(Q*0x100+0x008+0x0EC*P+E)
+
+    rt_ui64*hk64;
+#define inf_HK64            DP(Q*0x100+0x008+0x0F0*P+E)
+
+    rt_ui32*hc32;
+#define inf_HC32            DP(Q*0x100+0x008+0x0F4*P+E)
+
+    rt_ui64*hc64;
+#define inf_HC64            DP(Q*0x100+0x008+0x0F8*P+E)
+
+    rt_ui32*hs32;
+#define inf_HS32            DP(Q*0x100+0x008+0x0FC*P+E)
+
+    rt_ui64*hs64;
+#define inf_HS64            DP(Q*0x100+0x008+0x100*P+E)
+
+    rt_SIMD_HASH *hash;
+#define inf_HASH            DP(Q*0x100+0x008+0x104*P+E)
+
+    /* rays, primitives (AoS and SIMD) and structure */
+
+    rt_real*ro00;
+#define inf_RO00            DP(Q*0x100+0x008+0x108*P+E)
+
+    rt_real*rd00;
+#define inf_RD00            DP(Q*0x100+0x008+0x10C*P+E)
+
+    rt_real*rt00;
+#define inf_RT00            DP(Q*0x100+0x008+0x110*P+E)
+
+    rt_real*rb00;
+#define inf_RB00            DP(Q*0x100+0x008+0x114*P+E)
+
+    rt_real*rn00;
+#define inf_RN00            DP(Q*0x100+0x008+0x118*P+E)
+
+    rt_SIMD_RPKT *rpkt;
+#define inf_RPKT            DP(Q*0x100+0x008+0x11C*P+E)
+
+    rt_SIMD_RTRI *rtri;
+#define inf_RTRI            DP(Q*0x100+0x008+0x120*P+E)
+
+    rt_SIMD_RBOX *rbox;
+#define inf_RBOX            DP(Q*0x100+0x008+0x124*P+E)
+
+    rt_SIMD_RBOX *rnod;
+#define inf_RNOD            DP(Q*0x100+0x008+0x128*P+E)
+
+    rt_SIMD_RHIT *rhit;
+#define inf_RHIT            DP(Q*0x100+0x008+0x12C*P+E)
+
+    rt_SIMD_RAYS *rays;
+#define inf_RAYS            DP(Q*0x100+0x008+0x130*P+E)
+
+    /* bvh boxes (AoS) and structure */
+
+    rt_real*bv00;
+#define inf_BV00            DP(Q*0x100+0x008+0x134*P+E)
+
+    rt_SIMD_BVHS *bvhs;
+#define inf_BVHS            DP(Q*0x100+0x008+0x138*P+E)
+
+    /* vecm inputs/outputs (AoS and SIMD) and structure */
+
+    rt_real*vm00;
+#define inf_VM00            DP(Q*0x100+0x008+0x13C*P+E)
+
+    rt_real*vp00;
+#define inf_VP00            DP(Q*0x100+0x008+0x140*P+E)
+
+    rt_SIMD_VECM *vecm;
+#define inf_VECM            DP(Q*0x100+0x008+0x144*P+E)
+
+    /* polynomial structure */
+
+    rt_SIMD_POLY *poly;
+#define inf_POLY            DP(Q*0x100+0x008+0x148*P+E)
+
+    /* compensated sum arrays and references */
+
+    rt_real*ks00;
+#define inf_KS00            DP(Q*0x100+0x008+0x14C*P+E)
+
+    /* double-double arrays (packed) and structure */
+
+    rt_fp64*qd00;
+#define inf_QD00            DP(Q*0x100+0x008+0x150*P+E)
+
+    rt_SIMD_QUAD *quad;
+#define inf_QUAD            DP(Q*0x100+0x008+0x154*P+E)
+
+    /* fp16 arrays and structure */
+
+    rt_half*hf00;
+#define inf_HF00            DP(Q*0x100+0x008+0x158*P+E)
+
+    rt_SIMD_HALF *half;
+#define inf_HALF            DP(Q*0x100+0x008+0x15C*P+E)
+
+    /* large sort arrays */
+
+    rt_real*kl00;
+#define inf_KL00            DP(Q*0x100+0x008+0x160*P+E)
+
+};
+
+/*
+ * Print mismatching elements of C/S output arrays from given subtest.
+ */
+rt_void p_arrays(rt_SIMD_INFOX *info, rt_pstr name)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+    rt_real *fso1 = info->fso1;
+    rt_real *fso2 = info->fso2;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C %s: arr1[%d] = %e, arr2[%d] = %e\n",
+                name, j, fco1[j], j, fco2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S %s: arr1[%d] = %e, arr2[%d] = %e\n",
+                name, j, fso1[j], j, fso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+/*
+ * Print mismatching elements of C/S single precision arrays from given subtest.
+ */
+rt_void p_singles(rt_SIMD_INFOX *info, rt_pstr name)
+{
+    rt_si32 j, n = info->size;
+
+    rt_fp32 *sco1 = info->sco1;
+    rt_fp32 *sco2 = info->sco2;
+    rt_fp32 *sso1 = info->sso1;
+    rt_fp32 *sso2 = info->sso2;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(sco1[j], sso1[j]) && FEQ(sco2[j], sso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C %s: arr1[%d] = %e, arr2[%d] = %e\n",
+                name, j, sco1[j], j, sco2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S %s: arr1[%d] = %e, arr2[%d] = %e\n",
+                name, j, sso1[j], j, sso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+/*
+ * Print mismatching pixels of C/S output image planes from given subtest.
+ */
+rt_void p_planes(rt_SIMD_INFOX *info, rt_pstr name)
+{
+    rt_si32 j, n = IMG_W*IMG_H;
+
+    rt_ui08 *ico1 = info->ico1;
+    rt_ui08 *ico2 = info->ico2;
+    rt_ui08 *iso1 = info->iso1;
+    rt_ui08 *iso2 = info->iso2;
+
+    j = n;
+    while (j-->0)
+    {
+        if (IEQ(ico1[j], iso1[j]) && IEQ(ico2[j], iso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C %s: img1[%d][%d] = %d, img2[%d][%d] = %d\n",
+                name, j / IMG_W, j % IMG_W, ico1[j],
+                      j / IMG_W, j % IMG_W, ico2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S %s: img1[%d][%d] = %d, img2[%d][%d] = %d\n",
+                name, j / IMG_W, j % IMG_W, iso1[j],
+                      j / IMG_W, j % IMG_W, iso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+/*
+ * Print mismatching scalar results of C/S from given subtest.
+ */
+rt_void p_results(rt_SIMD_INFOX *info, rt_pstr name)
+{
+    rt_si32 j, n = RES_SIZE;
+
+    rt_real *frc0 = info->frc0;
+    rt_real *frs0 = info->frs0;
+    rt_elem *irc0 = info->irc0;
+    rt_elem *irs0 = info->irs0;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(frc0[j], frs0[j]) && IEQ(irc0[j], irs0[j]) && !v_mode)
+        {
+            continue;
+        }
+
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C %s: res[%d] = %e, idx[%d] = %" PR_L "d\n",
+                name, j, frc0[j], j, irc0[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S %s: res[%d] = %e, idx[%d] = %" PR_L "d\n",
+                name, j, frs0[j], j, irs0[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+/******************************************************************************/
+/*******************************   SUB TEST  1   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >=  1
+
+/*
+ * axpy: 1st call has mutually SIMD-alignable arrays (head/body/tail),
+ * 2nd call has arrays misaligned against each other (unaligned x loads).
+ */
+rt_void c_test01(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size - 5;
+    rt_real a = 0.5;
+
+    rt_real *far0 = info->far0 + 1;
+    rt_real *fco1 = info->fco1 + 1;
+    rt_real *fco2 = info->fco2 + 2;
+
+    j = n;
+    while (j-->0)
+    {
+        fco1[j] = a * far0[j] + fco1[j];
+    }
+
+    j = n - 1;
+    while (j-->0)
+    {
+        fco2[j] = a * far0[j] + fco2[j];
+    }
+}
+
+rt_void s_test01(rt_SIMD_INFOX *info)
+{
+    rt_si32 n = info->size - 5;
+    rt_SIMD_BLAS *blas = info->blas;
+
+    RT_SIMD_SET(blas->alpha, 0.5);
+
+    blas->x = info->far0 + 1;
+    blas->y = info->fso1 + 1;
+    blas->size = n;
+    blas_axpy(blas);
+
+    blas->x = info->far0 + 1;
+    blas->y = info->fso2 + 2;
+    blas->size = n - 1;
+    blas_axpy(blas);
+}
+
+rt_void p_test01(rt_SIMD_INFOX *info)
+{
+    p_arrays(info, "axpy");
+}
+
+#endif /* SUB_TEST  1 */
+
+/******************************************************************************/
+/*******************************   SUB TEST  2   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >=  2
+
+/*
+ * dot: 1st call has mutually SIMD-alignable arrays (head/body/tail),
+ * 2nd call has arrays misaligned against each other (unaligned y loads),
+ * 3rd call is shorter than 2 SIMD registers.
+ */
+rt_void c_test02(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size - 5;
+    rt_real r;
+
+    rt_real *far0 = info->far0;
+    rt_real *far1 = info->far1;
+    rt_real *frc0 = info->frc0;
+
+    for (r = 0.0, j = 0; j < n; j++)
+    {
+        r += far0[j + 1] * far1[j + 1];
+    }
+    frc0[0] = r;
+
+    for (r = 0.0, j = 0; j < n - 1; j++)
+    {
+        r += far0[j + 1] * far1[j + 2];
+    }
+    frc0[1] = r;
+
+    for (r = 0.0, j = 0; j < S + 3; j++)
+    {
+        r += far0[j + 3] * far1[j + 3];
+    }
+    frc0[2] = r;
+}
+
+rt_void s_test02(rt_SIMD_INFOX *info)
+{
+    rt_si32 n = info->size - 5;
+    rt_SIMD_BLAS *blas = info->blas;
+
+    blas->x = info->far0 + 1;
+    blas->y = info->far1 + 1;
+    blas->size = n;
+    blas_dot(blas);
+    info->frs0[0] = blas->rval[0];
+
+    blas->x = info->far0 + 1;
+    blas->y = info->far1 + 2;
+    blas->size = n - 1;
+    blas_dot(blas);
+    info->frs0[1] = blas->rval[0];
+
+    blas->x = info->far0 + 3;
+    blas->y = info->far1 + 3;
+    blas->size = S + 3;
+    blas_dot(blas);
+    info->frs0[2] = blas->rval[0];
+}
+
+rt_void p_test02(rt_SIMD_INFOX *info)
+{
+    p_results(info, "dot");
+}
+
+#endif /* SUB_TEST  2 */
+
+/******************************************************************************/
+/*******************************   SUB TEST  3   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >=  3
+
+/*
+ * scal: 1st call has head/body/tail, 2nd call is shorter than SIMD register.
+ */
+rt_void c_test03(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size - 5;
+    rt_real a = -1.0;
+
+    rt_real *fco1 = info->fco1 + 1;
+    rt_real *fco2 = info->fco2 + 3;
+
+    j = n;
+    while (j-->0)
+    {
+        fco1[j] = a * fco1[j];
+    }
+
+    j = S - 1;
+    while (j-->0)
+    {
+        fco2[j] = a * fco2[j];
+    }
+}
+
+rt_void s_test03(rt_SIMD_INFOX *info)
+{
+    rt_si32 n = info->size - 5;
+    rt_SIMD_BLAS *blas = info->blas;
+
+    RT_SIMD_SET(blas->alpha, -1.0);
+
+    blas->x = info->fso1 + 1;
+    blas->size = n;
+    blas_scal(blas);
+
+    blas->x = info->fso2 + 3;
+    blas->size = S - 1;
+    blas_scal(blas);
+}
+
+rt_void p_test03(rt_SIMD_INFOX *info)
+{
+    p_arrays(info, "scal");
+}
+
+#endif /* SUB_TEST  3 */
+
+/******************************************************************************/
+/*******************************   SUB TEST  4   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >=  4
+
+/*
+ * nrm2: calls with different head/tail sizes.
+ */
+rt_void c_test04(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size - 5;
+    rt_real r;
+
+    rt_real *far0 = info->far0;
+    rt_real *frc0 = info->frc0;
+
+    for (r = 0.0, j = 0; j < n; j++)
+    {
+        r += far0[j + 1] * far0[j + 1];
+    }
+    frc0[0] = RT_SQRT(r);
+
+    for (r = 0.0, j = 0; j < n - 2; j++)
+    {
+        r += far0[j + 3] * far0[j + 3];
+    }
+    frc0[1] = RT_SQRT(r);
+
+    for (r = 0.0, j = 0; j < S + 1; j++)
+    {
+        r += far0[j + 2] * far0[j + 2];
+    }
+    frc0[2] = RT_SQRT(r);
+}
+
+rt_void s_test04(rt_SIMD_INFOX *info)
+{
+    rt_si32 n = info->size - 5;
+    rt_SIMD_BLAS *blas = info->blas;
+
+    blas->x = info->far0 + 1;
+    blas->size = n;
+    blas_nrm2(blas);
+    info->frs0[0] = blas->rval[0];
+
+    blas->x = info->far0 + 3;
+    blas->size = n - 2;
+    blas_nrm2(blas);
+    info->frs0[1] = blas->rval[0];
+
+    blas->x = info->far0 + 2;
+    blas->size = S + 1;
+    blas_nrm2(blas);
+    info->frs0[2] = blas->rval[0];
+}
+
+rt_void p_test04(rt_SIMD_INFOX *info)
+{
+    p_results(info, "nrm2");
+}
+
+#endif /* SUB_TEST  4 */
+
+/******************************************************************************/
+/*******************************   SUB TEST  5   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >=  5
+
+/*
+ * asum: calls with different head/tail sizes.
+ */
+rt_void c_test05(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size - 5;
+    rt_real r;
+
+    rt_real *far0 = info->far0;
+    rt_real *frc0 = info->frc0;
+
+    for (r = 0.0, j = 0; j < n; j++)
+    {
+        r += RT_FABS(far0[j + 1]);
+    }
+    frc0[0] = r;
+
+    for (r = 0.0, j = 0; j < n - 2; j++)
+    {
+        r += RT_FABS(far0[j + 3]);
+    }
+    frc0[1] = r;
+
+    for (r = 0.0, j = 0; j < S + 1; j++)
+    {
+        r += RT_FABS(far0[j + 2]);
+    }
+    frc0[2] = r;
+}
+
+rt_void s_test05(rt_SIMD_INFOX *info)
+{
+    rt_si32 n = info->size - 5;
+    rt_SIMD_BLAS *blas = info->blas;
+
+    blas->x = info->far0 + 1;
+    blas->size = n;
+    blas_asum(blas);
+    info->frs0[0] = blas->rval[0];
+
+    blas->x = info->far0 + 3;
+    blas->size = n - 2;
+    blas_asum(blas);
+    info->frs0[1] = blas->rval[0];
+
+    blas->x = info->far0 + 2;
+    blas->size = S + 1;
+    blas_asum(blas);
+    info->frs0[2] = blas->rval[0];
+}
+
+rt_void p_test05(rt_SIMD_INFOX *info)
+{
+    p_results(info, "asum");
+}
+
+#endif /* SUB_TEST  5 */
+
+/******************************************************************************/
+/*******************************   SUB TEST  6   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >=  6
+
+/*
+ * iamax: calls with different head/tail sizes, input has many ties,
+ * last call is empty and must return -1.
+ */
+rt_void c_test06(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k, n = info->size - 5;
+    rt_real r;
+
+    rt_real *far0 = info->far0;
+    rt_elem *irc0 = info->irc0;
+
+    for (r = -1.0, k = -1, j = 0; j < n; j++)
+    {
+        if (RT_FABS(far0[j + 1]) > r)
+        {
+            r = RT_FABS(far0[j + 1]);
+            k = j;
+        }
+    }
+    irc0[0] = k;
+
+    for (r = -1.0, k = -1, j = 0; j < n - 2; j++)
+    {
+        if (RT_FABS(far0[j + 3]) > r)
+        {
+            r = RT_FABS(far0[j + 3]);
+            k = j;
+        }
+    }
+    irc0[1] = k;
+
+    for (r = -1.0, k = -1, j = 0; j < S + 1; j++)
+    {
+        if (RT_FABS(far0[j + 2]) > r)
+        {
+            r = RT_FABS(far0[j + 2]);
+            k = j;
+        }
+    }
+    irc0[2] = k;
+
+    irc0[3] = -1;
+}
+
+rt_void s_test06(rt_SIMD_INFOX *info)
+{
+    rt_si32 n = info->size - 5;
+    rt_SIMD_BLAS *blas = info->blas;
+
+    blas->x = info->far0 + 1;
+    blas->size = n;
+    blas_iamax(blas);
+    info->irs0[0] = blas->ridx[0];
+
+    blas->x = info->far0 + 3;
+    blas->size = n - 2;
+    blas_iamax(blas);
+    info->irs0[1] = blas->ridx[0];
+
+    blas->x = info->far0 + 2;
+    blas->size = S + 1;
+    blas_iamax(blas);
+    info->irs0[2] = blas->ridx[0];
+
+    blas->x = info->far0;
+    blas->size = 0;
+    blas_iamax(blas);
+    info->irs0[3] = blas->ridx[0];
+}
+
+rt_void p_test06(rt_SIMD_INFOX *info)
+{
+    p_results(info, "iamax");
+}
+
+#endif /* SUB_TEST  6 */
+
+/******************************************************************************/
+/*******************************   SUB TEST  7   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >=  7
+
+/*
+ * gemm: C = alpha * A * B + beta * C, dimensions aren't multiples of tiles,
+ * C reference is the plain triple loop.
+ */
+rt_void c_test07(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, p;
+    rt_real r, alpha = 0.5, beta = 0.5;
+
+    rt_real *mat0 = info->mat0;
+    rt_real *mat1 = info->mat1;
+    rt_real *mco0 = info->mco0;
+
+    for (i = 0; i < GMM_M; i++)
+    {
+        for (j = 0; j < GMM_N; j++)
+        {
+            for (r = 0.0, p = 0; p < GMM_K; p++)
+            {
+                r += mat0[i*GMM_K + p] * mat1[p*GMM_N + j];
+            }
+            mco0[i*GMM_N + j] = alpha * r + beta * mco0[i*GMM_N + j];
+        }
+    }
+}
+
+rt_void s_test07(rt_SIMD_INFOX *info)
+{
+    rt_SIMD_GEMM *gemm = info->gemm;
+
+    gemm->a = info->mat0;
+    gemm->b = info->mat1;
+    gemm->c = info->mso0;
+    gemm->m = GMM_M;
+    gemm->n = GMM_N;
+    gemm->k = GMM_K;
+    gemm->lda = GMM_K;
+    gemm->ldb = GMM_N;
+    gemm->ldc = GMM_N;
+    gemm->alpha = 0.5;
+    gemm->beta = 0.5;
+    gemm_run(gemm);
+}
+
+rt_void h_test07(rt_SIMD_INFOX *info)
+{
+#ifdef RT_HOST_BLAS
+#if   RT_ELEMENT == 32
+    cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans,
+                GMM_M, GMM_N, GMM_K, 0.5, info->mat0, GMM_K,
+                info->mat1, GMM_N, 0.5, info->mho0, GMM_N);
+#elif RT_ELEMENT == 64
+    cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans,
+                GMM_M, GMM_N, GMM_K, 0.5, info->mat0, GMM_K,
+                info->mat1, GMM_N, 0.5, info->mho0, GMM_N);
+#endif /* RT_ELEMENT */
+#endif /* RT_HOST_BLAS */
+}
+
+rt_void p_test07(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = GMM_M*GMM_N;
+
+    rt_real *mco0 = info->mco0;
+    rt_real *mso0 = info->mso0;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(mco0[j], mso0[j]) && !v_mode)
+        {
+            continue;
+        }
+
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C gemm: mat[%d][%d] = %e\n",
+                j / GMM_N, j % GMM_N, mco0[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S gemm: mat[%d][%d] = %e\n",
+                j / GMM_N, j % GMM_N, mso0[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST  7 */
+
+/******************************************************************************/
+/*******************************   SUB TEST  8   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >=  8
+
+/*
+ * trns: batch of TRN_B matrices (TRN_R x TRN_C) transposed to (TRN_C x TRN_R),
+ * which is NCHW -> NHWC with N = TRN_B, C = TRN_R, HW = TRN_C,
+ * C reference is the plain double loop, elements are compared exactly.
+ */
+rt_void c_test08(rt_SIMD_INFOX *info)
+{
+    rt_si32 b, i, j;
+
+    rt_ui32 *tsrc = info->tsrc;
+    rt_ui32 *tco0 = info->tco0;
+
+    for (b = 0; b < TRN_B; b++)
+    {
+        for (i = 0; i < TRN_R; i++)
+        {
+            for (j = 0; j < TRN_C; j++)
+            {
+                tco0[j*TRN_R + i] = tsrc[i*TRN_C + j];
+            }
+        }
+        tsrc += TRN_R*TRN_C;
+        tco0 += TRN_R*TRN_C;
+    }
+}
+
+rt_void s_test08(rt_SIMD_INFOX *info)
+{
+    rt_SIMD_TRNS *trns = info->trns;
+
+    trns->src = info->tsrc;
+    trns->dst = info->tso0;
+    trns->rows = TRN_R;
+    trns->cols = TRN_C;
+    trns->lds = TRN_C;
+    trns->ldd = TRN_R;
+    trns->bcnt = TRN_B;
+    trns->bsrc = TRN_R*TRN_C;
+    trns->bdst = TRN_R*TRN_C;
+    trns_run(trns);
+}
+
+rt_void p_test08(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = TRN_B*TRN_R*TRN_C;
+
+    rt_ui32 *tco0 = info->tco0;
+    rt_ui32 *tso0 = info->tso0;
+
+    j = n;
+    while (j-->0)
+    {
+        if (IEQ(tco0[j], tso0[j]) && !v_mode)
+        {
+            continue;
+        }
+
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C trns: mat[%d][%d] = %u\n",
+                j / TRN_R, j % TRN_R, tco0[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S trns: mat[%d][%d] = %u\n",
+                j / TRN_R, j % TRN_R, tso0[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST  8 */
+
+/******************************************************************************/
+/*******************************   SUB TEST  9   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >=  9
+
+/* FIR coefficients, h[0] applies to the newest sample */
+#define FIR_H(k)            ((rt_fp32)((k) * 13 % 17 - 8) / 64)
+
+/*
+ * fir: 1st filter (FIR_T1 taps) is streamed in chunks of varying sizes
+ * to check state carried between calls, 2nd filter (FIR_T2 taps)
+ * runs in place over the whole array in one call.
+ */
+rt_void c_test09(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k, n = info->size;
+    rt_fp32 r;
+
+    rt_fp32 *sar0 = info->sar0;
+    rt_fp32 *sco1 = info->sco1;
+    rt_fp32 *sco2 = info->sco2;
+
+    for (j = 0; j < n; j++)
+    {
+        for (r = 0.0f, k = 0; k < FIR_T1 && k <= j; k++)
+        {
+            r += FIR_H(k) * sar0[j - k];
+        }
+        sco1[j] = r;
+    }
+
+    for (j = 0; j < n; j++)
+    {
+        for (r = 0.0f, k = 0; k < FIR_T2 && k <= j; k++)
+        {
+            r += FIR_H(k) * sar0[j - k];
+        }
+        sco2[j] = r;
+    }
+}
+
+rt_void s_test09(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k, n = info->size;
+    rt_fp32 h[FIR_T2];
+    rt_SIMD_FIRF *firf = info->firf;
+
+    rt_fp32 *sar0 = info->sar0;
+    rt_fp32 *sso1 = info->sso1;
+    rt_fp32 *sso2 = info->sso2;
+
+    for (k = 0; k < FIR_T2; k++)
+    {
+        h[k] = FIR_H(k);
+    }
+
+    fir_init(firf, FIR_T1, h);
+
+    for (j = 0, k = 1; j < n; j += k, k = k * 7 + 3)
+    {
+        k = RT_MIN(k, n - j);
+        fir_run(firf, sar0 + j, sso1 + j, k);
+    }
+
+    fir_init(firf, FIR_T2, h);
+
+    for (j = 0; j < n; j++)
+    {
+        sso2[j] = sar0[j];
+    }
+    fir_run(firf, sso2, sso2, n);
+}
+
+rt_void p_test09(rt_SIMD_INFOX *info)
+{
+    p_singles(info, "fir");
+}
+
+#endif /* SUB_TEST  9 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 10   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 10
+
+/*
+ * Coefficients of given channel and stage (b0, b1, b2, a1, a2),
+ * poles stay inside of the unit circle for all combinations.
+ */
+rt_void t_biquad(rt_si32 c, rt_si32 s, rt_fp32 *p)
+{
+    p[0] = 0.25f + 0.0625f * s;
+    p[1] = 0.5f - 0.125f * c;
+    p[2] = 0.125f;
+    p[3] = -0.75f + 0.25f * ((c + s) % 4);
+    p[4] = 0.25f - 0.125f * (c % 3);
+}
+
+/*
+ * bqd: cascade of BQD_S stages over BQD_C interleaved channels
+ * with different coefficients per channel and stage, 1st call is streamed
+ * in chunks of varying sizes, 2nd call runs in place in one call.
+ */
+rt_void c_test10(rt_SIMD_INFOX *info)
+{
+    rt_si32 c, j, s, n = info->size / BQD_C;
+    rt_fp32 p[5], x, y, z1, z2;
+
+    rt_fp32 *sar0 = info->sar0;
+    rt_fp32 *sco1 = info->sco1;
+    rt_fp32 *sco2 = info->sco2;
+
+    for (j = 0; j < n * BQD_C; j++)
+    {
+        sco1[j] = sar0[j];
+    }
+
+    for (c = 0; c < BQD_C; c++)
+    {
+        for (s = 0; s < BQD_S; s++)
+        {
+            t_biquad(c, s, p);
+
+            for (z1 = z2 = 0.0f, j = 0; j < n; j++)
+            {
+                x = sco1[j * BQD_C + c];
+                y = p[0] * x + z1;
+                z1 = p[1] * x - p[3] * y + z2;
+                z2 = p[2] * x - p[4] * y;
+                sco1[j * BQD_C + c] = y;
+            }
+        }
+    }
+
+    for (j = 0; j < n * BQD_C; j++)
+    {
+        sco2[j] = sco1[j];
+    }
+}
+
+rt_void s_test10(rt_SIMD_INFOX *info)
+{
+    rt_si32 c, j, k, s, n = info->size / BQD_C;
+    rt_fp32 p[5];
+    rt_SIMD_BIQD *biqd = info->biqd;
+
+    rt_fp32 *sar0 = info->sar0;
+    rt_fp32 *sso1 = info->sso1;
+    rt_fp32 *sso2 = info->sso2;
+
+    bqd_init(biqd, BQD_C, BQD_S);
+
+    for (c = 0; c < BQD_C; c++)
+    {
+        for (s = 0; s < BQD_S; s++)
+        {
+            t_biquad(c, s, p);
+            bqd_set(biqd, c, s, p);
+        }
+    }
+
+    for (j = 0, k = 1; j < n; j += k, k = k * 5 + 2)
+    {
+        k = RT_MIN(k, n - j);
+        bqd_run(biqd, sar0 + j * BQD_C, sso1 + j * BQD_C, k);
+    }
+
+    bqd_init(biqd, BQD_C, BQD_S);
+
+    for (c = 0; c < BQD_C; c++)
+    {
+        for (s = 0; s < BQD_S; s++)
+        {
+            t_biquad(c, s, p);
+            bqd_set(biqd, c, s, p);
+        }
+    }
+
+    for (j = 0; j < n * BQD_C; j++)
+    {
+        sso2[j] = sar0[j];
+    }
+    bqd_run(biqd, sso2, sso2, n);
+}
+
+rt_void p_test10(rt_SIMD_INFOX *info)
+{
+    p_singles(info, "bqd");
+}
+
+#endif /* SUB_TEST 10 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 11   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 11
+
+#define IMG_P(p, y, x)      p[RT_MIN(RT_MAX(y, 0), IMG_H - 1) * IMG_W +     \
+                              RT_MIN(RT_MAX(x, 0), IMG_W - 1)]
+
+/*
+ * Convolve image plane with binomial n x n kernel directly (clamp-to-edge),
+ * rounding once with shift sh.
+ */
+rt_void t_gauss(rt_ui08 *s, rt_ui08 *d, rt_si32 n, rt_si32 sh)
+{
+    rt_si32 g[5] = {1, 4, 6, 4, 1}, i, j, r = n / 2, x, y, t;
+
+    if (n == 3)
+    {
+        g[0] = 1; g[1] = 2; g[2] = 1;
+    }
+
+    for (y = 0; y < IMG_H; y++)
+    {
+        for (x = 0; x < IMG_W; x++)
+        {
+            for (t = 0, i = 0; i < n; i++)
+            {
+                for (j = 0; j < n; j++)
+                {
+                    t += g[i] * g[j] * IMG_P(s, y + i - r, x + j - r);
+                }
+            }
+            d[y * IMG_W + x] = (rt_ui08)((t + (1 << (sh - 1))) >> sh);
+        }
+    }
+}
+
+/*
+ * gss: Gaussian 3x3 and 5x5 over 4K frame, C reference is the direct
+ * 2D convolution, SIMD version goes through separable strips.
+ */
+rt_void c_test11(rt_SIMD_INFOX *info)
+{
+    t_gauss(info->isrc, info->ico1, 3, 4);
+    t_gauss(info->isrc, info->ico2, 5, 8);
+}
+
+rt_void s_test11(rt_SIMD_INFOX *info)
+{
+    rt_SIMD_IMGF *imgf = info->imgf;
+
+    img_gauss_init(imgf, 3);
+    img_conv_run(imgf, info->isrc, info->iso1, IMG_W, IMG_H, IMG_W, IMG_W);
+    img_gauss_init(imgf, 5);
+    img_conv_run(imgf, info->isrc, info->iso2, IMG_W, IMG_H, IMG_W, IMG_W);
+}
+
+rt_void p_test11(rt_SIMD_INFOX *info)
+{
+    p_planes(info, "gss");
+}
+
+#endif /* SUB_TEST 11 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 12   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 12
+
+/*
+ * Blur image plane with box (2 * r + 1) x (2 * r + 1) summing each window
+ * directly (clamp-to-edge), horizontal pass first, both passes rounded.
+ */
+rt_void t_boxes(rt_ui08 *s, rt_ui08 *d, rt_si32 r)
+{
+    rt_si32 i, n = 2 * r + 1, x, y, t;
+    rt_ui08 col[IMG_H];
+
+    for (y = 0; y < IMG_H; y++)
+    {
+        for (x = 0; x < IMG_W; x++)
+        {
+            for (t = 0, i = -r; i <= r; i++)
+            {
+                t += IMG_P(s, y, x + i);
+            }
+            d[y * IMG_W + x] = (rt_ui08)((t + r) / n);
+        }
+    }
+
+    for (x = 0; x < IMG_W; x++)
+    {
+        for (y = 0; y < IMG_H; y++)
+        {
+            col[y] = d[y * IMG_W + x];
+        }
+        for (y = 0; y < IMG_H; y++)
+        {
+            for (t = 0, i = -r; i <= r; i++)
+            {
+                t += col[RT_MIN(RT_MAX(y + i, 0), IMG_H - 1)];
+            }
+            d[y * IMG_W + x] = (rt_ui08)((t + r) / n);
+        }
+    }
+}
+
+/*
+ * box: box blur with small and large radius over 4K frame,
+ * C reference sums each window, SIMD version keeps running sums.
+ */
+rt_void c_test12(rt_SIMD_INFOX *info)
+{
+    t_boxes(info->isrc, info->ico1, BOX_R1);
+    t_boxes(info->isrc, info->ico2, BOX_R2);
+}
+
+rt_void s_test12(rt_SIMD_INFOX *info)
+{
+    rt_SIMD_IMGF *imgf = info->imgf;
+
+    img_box_init(imgf, BOX_R1);
+    img_box_run(imgf, info->isrc, info->iso1, IMG_W, IMG_H, IMG_W, IMG_W);
+    img_box_init(imgf, BOX_R2);
+    img_box_run(imgf, info->isrc, info->iso2, IMG_W, IMG_H, IMG_W, IMG_W);
+}
+
+rt_void p_test12(rt_SIMD_INFOX *info)
+{
+    p_planes(info, "box");
+}
+
+#endif /* SUB_TEST 12 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 13   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 13
+
+/*
+ * Transform n complex points in place (n = 2^k) with iterative radix-2
+ * in double precision, sg = -1 for forward, sg = +1 for inverse (unscaled).
+ */
+rt_void t_dft(rt_fp64 *re, rt_fp64 *im, rt_si32 n, rt_si32 sg)
+{
+    rt_si32 i, j, k, m;
+    rt_fp64 a, wr, wi, tr, ti;
+
+    for (i = 1, j = 0; i < n; i++)
+    {
+        for (k = n >> 1; j & k; k >>= 1)
+        {
+            j ^= k;
+        }
+        j ^= k;
+
+        if (i < j)
+        {
+            tr = re[i]; re[i] = re[j]; re[j] = tr;
+            ti = im[i]; im[i] = im[j]; im[j] = ti;
+        }
+    }
+
+    for (m = 2; m <= n; m <<= 1)
+    {
+        for (k = 0; k < m / 2; k++)
+        {
+            a = sg * RT_2_PI * k / m;
+            wr = RT_COS64(a);
+            wi = RT_SIN64(a);
+
+            for (i = k; i < n; i += m)
+            {
+                j = i + m / 2;
+                tr = re[j] * wr - im[j] * wi;
+                ti = im[j] * wr + re[j] * wi;
+                re[j] = re[i] - tr;
+                im[j] = im[i] - ti;
+                re[i] = re[i] + tr;
+                im[i] = im[i] + ti;
+            }
+        }
+    }
+}
+
+/*
+ * Transform n complex points from (xre, xim) into (yre, yim) via t_dft.
+ */
+rt_void t_cfft(rt_real *xre, rt_real *xim, rt_real *yre, rt_real *yim,
+               rt_si32 n, rt_si32 sg)
+{
+    rt_fp64 re[2*FFT_N], im[2*FFT_N];
+    rt_si32 k;
+
+    for (k = 0; k < n; k++)
+    {
+        re[k] = xre[k];
+        im[k] = xim[k];
+    }
+
+    t_dft(re, im, n, sg);
+
+    for (k = 0; k < n; k++)
+    {
+        yre[k] = (rt_real)re[k];
+        yim[k] = (rt_real)im[k];
+    }
+}
+
+/*
+ * fft: forward and inverse complex transforms of FFT_N points,
+ * forward transform of FFT_S points (fewer than S * S on wide targets).
+ */
+rt_void c_test13(rt_SIMD_INFOX *info)
+{
+    rt_real *far0 = info->far0;
+    rt_real *far1 = info->far1;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+
+    t_cfft(far0, far1, fco1, fco2, FFT_N, -1);
+    t_cfft(far0 + FFT_N, far1 + FFT_N, fco1 + FFT_N, fco2 + FFT_N, FFT_N, +1);
+    t_cfft(far0 + FFT_N * 2, far1 + FFT_N * 2,
+           fco1 + FFT_N * 2, fco2 + FFT_N * 2, FFT_S, -1);
+}
+
+rt_void s_test13(rt_SIMD_INFOX *info)
+{
+    rt_SIMD_FFTS *fftl = info->fftl;
+    rt_SIMD_FFTS *ffts = info->ffts;
+
+    rt_real *far0 = info->far0;
+    rt_real *far1 = info->far1;
+    rt_real *fso1 = info->fso1;
+    rt_real *fso2 = info->fso2;
+
+    fft_fwd(fftl, far0, far1, fso1, fso2);
+    fft_inv(fftl, far0 + FFT_N, far1 + FFT_N, fso1 + FFT_N, fso2 + FFT_N);
+    fft_fwd(ffts, far0 + FFT_N * 2, far1 + FFT_N * 2,
+                  fso1 + FFT_N * 2, fso2 + FFT_N * 2);
+}
+
+rt_void p_test13(rt_SIMD_INFOX *info)
+{
+    p_arrays(info, "fft");
+}
+
+#endif /* SUB_TEST 13 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 14   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 14
+
+/*
+ * rft: forward real transform of 2 * FFT_N samples into FFT_N + 1 bins,
+ * inverse real transform of FFT_N + 1 bins (with imaginary parts of bins
+ * 0 and FFT_N zeroed in 2nd output) into 2 * FFT_N samples,
+ * C reference runs complex transforms of full length.
+ */
+rt_void c_test14(rt_SIMD_INFOX *info)
+{
+    rt_fp64 re[2*FFT_N], im[2*FFT_N];
+    rt_si32 k, n = FFT_N;
+
+    rt_real *far0 = info->far0;
+    rt_real *far1 = info->far1;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+
+    for (k = 0; k < 2 * n; k++)
+    {
+        re[k] = far0[k];
+        im[k] = 0.0;
+    }
+
+    t_dft(re, im, 2 * n, -1);
+
+    for (k = 0; k <= n; k++)
+    {
+        fco1[k] = (rt_real)re[k];
+        fco2[k] = (rt_real)im[k];
+    }
+
+    for (k = 0; k <= n; k++)
+    {
+        fco2[2 * n + k] = k % n == 0 ? 0 : far1[2 * n + k];
+    }
+
+    for (k = 0; k <= n; k++)
+    {
+        re[k] = far0[2 * n + k];
+        im[k] = fco2[2 * n + k];
+    }
+
+    for (k = 1; k < n; k++)
+    {
+        re[2 * n - k] = +re[k];
+        im[2 * n - k] = -im[k];
+    }
+
+    t_dft(re, im, 2 * n, +1);
+
+    for (k = 0; k < 2 * n; k++)
+    {
+        fco1[2 * n + k] = (rt_real)re[k];
+    }
+}
+
+rt_void s_test14(rt_SIMD_INFOX *info)
+{
+    rt_SIMD_FFTS *fftl = info->fftl;
+    rt_si32 k, n = FFT_N;
+
+    rt_real *far0 = info->far0;
+    rt_real *far1 = info->far1;
+    rt_real *fso1 = info->fso1;
+    rt_real *fso2 = info->fso2;
+
+    fft_rfwd(fftl, far0, fso1, fso2);
+
+    for (k = 0; k <= n; k++)
+    {
+        fso2[2 * n + k] = k % n == 0 ? 0 : far1[2 * n + k];
+    }
+
+    fft_rinv(fftl, far0 + 2 * n, fso2 + 2 * n, fso1 + 2 * n);
+}
+
+rt_void p_test14(rt_SIMD_INFOX *info)
+{
+    p_arrays(info, "rft");
+}
+
+#endif /* SUB_TEST 14 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 15   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 15
+
+/*
+ * Print mismatching keys (and payload) of C/S sorted arrays from given subtest,
+ * payload is checked to point at input element with the same key
+ * as order of equal keys isn't defined.
+ */
+rt_void p_sorted(rt_SIMD_INFOX *info, rt_pstr name, rt_bool pl)
+{
+    rt_si32 j, n = SRT_N, h = SRT_H;
+
+    rt_real *kar0 = info->kar0;
+    rt_real *kco0 = info->kco0;
+    rt_real *kso0 = info->kso0;
+    rt_elem *jar0 = info->jar0;
+    rt_elem *jco0 = info->jco0;
+    rt_elem *jso0 = info->jso0;
+    rt_elem *vco0 = info->vco0;
+    rt_elem *vso0 = info->vso0;
+
+    j = n;
+    while (j-->0)
+    {
+        if (kco0[j] == kso0[j] && jco0[j] == jso0[j] && (!pl || j >= h
+        || (vso0[j] >= 0 && vso0[j] < h && jar0[vso0[j]] == jso0[j])) && (!pl
+        || j < h || (vso0[j] >= 0 && vso0[j] < n - h
+                                  && kar0[h + vso0[j]] == kso0[j])) && !v_mode)
+        {
+            continue;
+        }
+
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C %s: key[%d] = %e, elm[%d] = %d, val[%d] = %d\n",
+                name, j, kco0[j], j, (rt_si32)jco0[j], j, (rt_si32)vco0[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S %s: key[%d] = %e, elm[%d] = %d, val[%d] = %d\n",
+                name, j, kso0[j], j, (rt_si32)jso0[j], j, (rt_si32)vso0[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+rt_si32 t_creal(const rt_void *a, const rt_void *b)
+{
+    rt_real x = *(const rt_real *)a, y = *(const rt_real *)b;
+
+    return (x > y) - (x < y);
+}
+
+rt_si32 t_celem(const rt_void *a, const rt_void *b)
+{
+    rt_elem x = *(const rt_elem *)a, y = *(const rt_elem *)b;
+
+    return (x > y) - (x < y);
+}
+
+/*
+ * srt: sort SRT_N rt_real keys and SRT_N - 7 rt_elem keys in place
+ * (copied from inputs), C reference is qsort, host reference is std::sort.
+ */
+rt_void c_test15(rt_SIMD_INFOX *info)
+{
+    memcpy(info->kco0, info->kar0, SRT_N*sizeof(rt_real));
+    qsort(info->kco0, SRT_N, sizeof(rt_real), t_creal);
+    memcpy(info->jco0, info->jar0, (SRT_N - 7)*sizeof(rt_elem));
+    qsort(info->jco0, SRT_N - 7, sizeof(rt_elem), t_celem);
+}
+
+rt_void s_test15(rt_SIMD_INFOX *info)
+{
+    rt_SIMD_SORT *sort = info->sort;
+
+    memcpy(info->kso0, info->kar0, SRT_N*sizeof(rt_real));
+    srt_real(sort, info->kso0, RT_NULL, SRT_N);
+    memcpy(info->jso0, info->jar0, (SRT_N - 7)*sizeof(rt_elem));
+    srt_elem(sort, info->jso0, RT_NULL, SRT_N - 7);
+}
+
+rt_void h_test15(rt_SIMD_INFOX *info)
+{
+    memcpy(info->kho0, info->kar0, SRT_N*sizeof(rt_real));
+    std::sort(info->kho0, info->kho0 + SRT_N);
+    memcpy(info->jho0, info->jar0, (SRT_N - 7)*sizeof(rt_elem));
+    std::sort(info->jho0, info->jho0 + SRT_N - 7);
+}
+
+rt_void p_test15(rt_SIMD_INFOX *info)
+{
+    p_sorted(info, "srt", RT_FALSE);
+}
+
+#endif /* SUB_TEST 15 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 16   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 16
+
+rt_real *t_kreal = RT_NULL; /* keys of indices sorted by qsort/std::sort */
+rt_elem *t_kelem = RT_NULL;
+
+rt_si32 t_ireal(const rt_void *a, const rt_void *b)
+{
+    rt_elem i = *(const rt_elem *)a, j = *(const rt_elem *)b;
+    rt_real x = t_kreal[i], y = t_kreal[j];
+
+    return x != y ? (x > y) - (x < y) : (i > j) - (i < j);
+}
+
+rt_si32 t_ielem(const rt_void *a, const rt_void *b)
+{
+    rt_elem i = *(const rt_elem *)a, j = *(const rt_elem *)b;
+    rt_elem x = t_kelem[i], y = t_kelem[j];
+
+    return x != y ? (x > y) - (x < y) : (i > j) - (i < j);
+}
+
+struct t_lreal
+{
+    rt_bool operator()(rt_elem i, rt_elem j) const
+    {
+        return t_kreal[i] < t_kreal[j] || (t_kreal[i] == t_kreal[j] && i < j);
+    }
+};
+
+struct t_lelem
+{
+    rt_bool operator()(rt_elem i, rt_elem j) const
+    {
+        return t_kelem[i] < t_kelem[j] || (t_kelem[i] == t_kelem[j] && i < j);
+    }
+};
+
+/*
+ * srv: sort SRT_H rt_elem keys and SRT_N - SRT_H rt_real keys
+ * with payload (indices), C reference sorts indices by qsort,
+ * host reference sorts indices by std::sort.
+ */
+rt_void c_test16(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, h = SRT_H, n = SRT_N;
+
+    rt_real *kco0 = info->kco0;
+    rt_elem *jco0 = info->jco0;
+    rt_elem *vco0 = info->vco0;
+
+    t_kelem = info->jar0;
+    t_kreal = info->kar0 + h;
+
+    for (j = 0; j < n; j++)
+    {
+        vco0[j] = j < h ? j : j - h;
+    }
+
+    qsort(vco0, h, sizeof(rt_elem), t_ielem);
+    qsort(vco0 + h, n - h, sizeof(rt_elem), t_ireal);
+
+    for (j = 0; j < n; j++)
+    {
+        if (j < h)
+        {
+            jco0[j] = t_kelem[vco0[j]];
+        }
+        else
+        {
+            kco0[j] = t_kreal[vco0[j]];
+        }
+    }
+}
+
+rt_void s_test16(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, h = SRT_H, n = SRT_N;
+    rt_SIMD_SORT *sort = info->sort;
+
+    rt_real *kso0 = info->kso0;
+    rt_elem *jso0 = info->jso0;
+    rt_elem *vso0 = info->vso0;
+
+    for (j = 0; j < n; j++)
+    {
+        vso0[j] = j < h ? j : j - h;
+    }
+
+    memcpy(jso0, info->jar0, h*sizeof(rt_elem));
+    srt_elem(sort, jso0, vso0, h);
+    memcpy(kso0 + h, info->kar0 + h, (n - h)*sizeof(rt_real));
+    srt_real(sort, kso0 + h, vso0 + h, n - h);
+}
+
+rt_void h_test16(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, h = SRT_H, n = SRT_N;
+
+    rt_real *kho0 = info->kho0;
+    rt_elem *jho0 = info->jho0;
+    rt_elem *vho0 = info->vho0;
+
+    t_kelem = info->jar0;
+    t_kreal = info->kar0 + h;
+
+    for (j = 0; j < n; j++)
+    {
+        vho0[j] = j < h ? j : j - h;
+    }
+
+    std::sort(vho0, vho0 + h, t_lelem());
+    std::sort(vho0 + h, vho0 + n, t_lreal());
+
+    for (j = 0; j < n; j++)
+    {
+        if (j < h)
+        {
+            jho0[j] = t_kelem[vho0[j]];
+        }
+        else
+        {
+            kho0[j] = t_kreal[vho0[j]];
+        }
+    }
+}
+
+rt_void p_test16(rt_SIMD_INFOX *info)
+{
+    p_sorted(info, "srv", RT_TRUE);
+}
+
+#endif /* SUB_TEST 16 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 17   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 17
+
+rt_elem t_hres[RES_SIZE]; /* host library results (not checked) */
+
+/*
+ * chr: count lines with memchr (many short scans), sum strlen
+ * from several offsets, xor positions of a rare byte found with memrchr
+ * and search for an absent byte, all ranges start at unaligned offsets.
+ */
+rt_void c_test17(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k;
+    rt_elem r;
+
+    rt_ui08 *text = info->text;
+    rt_elem *irc0 = info->irc0;
+
+    for (r = 0, j = SCN_O; j < SCN_N - 1; j++)
+    {
+        r += text[j] == '\n';
+    }
+    irc0[0] = r;
+
+    for (r = 0, k = 0; k < 3; k++)
+    {
+        for (j = SCN_O + k * 1234567; text[j] != 0; j++);
+        r += j - (SCN_O + k * 1234567);
+    }
+    irc0[1] = r;
+
+    for (r = 0, j = SCN_N - 1 - SCN_O; j-- > SCN_O;)
+    {
+        r ^= text[j] == '#' ? j : 0;
+    }
+    irc0[2] = r;
+
+    for (r = -1, j = SCN_O; j < SCN_N - SCN_O; j++)
+    {
+        if (text[j] == 0xFF)
+        {
+            r = j;
+            break;
+        }
+    }
+    irc0[3] = r;
+}
+
+rt_void s_test17(rt_SIMD_INFOX *info)
+{
+    rt_si32 k;
+    rt_elem r;
+
+    rt_ui08 *text = info->text, *e, *t;
+    rt_elem *irs0 = info->irs0;
+    rt_SIMD_SCAN *scan = info->scan;
+
+    e = text + SCN_N - 1;
+    for (r = 0, t = text + SCN_O;
+        (t = scn_memchr(scan, t, '\n', e - t)) != RT_NULL; t++)
+    {
+        r++;
+    }
+    irs0[0] = r;
+
+    for (r = 0, k = 0; k < 3; k++)
+    {
+        r += scn_strlen(scan, text + SCN_O + k * 1234567);
+    }
+    irs0[1] = r;
+
+    e = text + SCN_N - 1 - SCN_O;
+    for (r = 0, t = text + SCN_O;
+        (e = scn_memrchr(scan, t, '#', e - t)) != RT_NULL;)
+    {
+        r ^= e - text;
+    }
+    irs0[2] = r;
+
+    t = scn_memchr(scan, text + SCN_O, 0xFF, SCN_N - 2 * SCN_O);
+    irs0[3] = t != RT_NULL ? t - text : -1;
+}
+
+rt_void h_test17(rt_SIMD_INFOX *info)
+{
+    rt_si32 k;
+    rt_elem r;
+
+    rt_ui08 *text = info->text, *e, *t;
+
+    e = text + SCN_N - 1;
+    for (r = 0, t = text + SCN_O;
+        (t = (rt_ui08 *)memchr(t, '\n', e - t)) != RT_NULL; t++)
+    {
+        r++;
+    }
+    t_hres[0] = r;
+
+    for (r = 0, k = 0; k < 3; k++)
+    {
+        r += strlen((rt_char *)text + SCN_O + k * 1234567);
+    }
+    t_hres[1] = r;
+
+#if (defined RT_LINUX)
+    e = text + SCN_N - 1 - SCN_O;
+    for (r = 0, t = text + SCN_O;
+        (e = (rt_ui08 *)memrchr(t, '#', e - t)) != RT_NULL;)
+    {
+        r ^= e - text;
+    }
+    t_hres[2] = r;
+#endif /* RT_LINUX */
+
+    t = (rt_ui08 *)memchr(text + SCN_O, 0xFF, SCN_N - 2 * SCN_O);
+    t_hres[3] = t != RT_NULL ? t - text : -1;
+}
+
+rt_void p_test17(rt_SIMD_INFOX *info)
+{
+    p_results(info, "chr");
+}
+
+#endif /* SUB_TEST 17 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 18   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 18
+
+const rt_ui08 t_set4[] = "{}[]";     /* bytes for any-of search, small set */
+const rt_ui08 t_set8[] = "{}[]<>|#"; /* bytes for any-of search, large set */
+const rt_ui08 t_ndl0[] = "ERROR";    /* substring, has many near misses */
+const rt_ui08 t_ndl1[] = "ERROR: ERROR"; /* substring, never occurs */
+
+/*
+ * str: count bytes from sets of 4 and 8 with any-of search,
+ * count occurrences of a substring and search for an absent one,
+ * all ranges start at unaligned offsets.
+ */
+rt_void c_test18(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k;
+    rt_elem r;
+
+    rt_ui08 *text = info->text;
+    rt_elem *irc0 = info->irc0;
+
+    for (r = 0, j = SCN_O; j < SCN_N - 1; j++)
+    {
+        for (k = 0; k < 4; k++)
+        {
+            r += text[j] == t_set4[k];
+        }
+    }
+    irc0[0] = r;
+
+    for (r = 0, j = SCN_O; j < SCN_N - 1; j++)
+    {
+        for (k = 0; k < 8; k++)
+        {
+            r += text[j] == t_set8[k];
+        }
+    }
+    irc0[1] = r;
+
+    for (r = 0, j = SCN_O; j < SCN_N - 1 - 5 + 1; j++)
+    {
+        r += memcmp(text + j, t_ndl0, 5) == 0;
+    }
+    irc0[2] = r;
+
+    for (r = -1, j = SCN_O; j < SCN_N - 1 - 12 + 1; j++)
+    {
+        if (memcmp(text + j, t_ndl1, 12) == 0)
+        {
+            r = j;
+            break;
+        }
+    }
+    irc0[3] = r;
+}
+
+rt_void s_test18(rt_SIMD_INFOX *info)
+{
+    rt_elem r;
+
+    rt_ui08 *text = info->text, *e, *t;
+    rt_elem *irs0 = info->irs0;
+    rt_SIMD_SCAN *scan = info->scan;
+
+    e = text + SCN_N - 1;
+    for (r = 0, t = text + SCN_O;
+        (t = scn_anychr(scan, t, e - t, t_set4, 4)) != RT_NULL; t++)
+    {
+        r++;
+    }
+    irs0[0] = r;
+
+    for (r = 0, t = text + SCN_O;
+        (t = scn_anychr(scan, t, e - t, t_set8, 8)) != RT_NULL; t++)
+    {
+        r++;
+    }
+    irs0[1] = r;
+
+    for (r = 0, t = text + SCN_O;
+        (t = scn_memmem(scan, t, e - t, (rt_pntr)t_ndl0, 5)) != RT_NULL; t++)
+    {
+        r++;
+    }
+    irs0[2] = r;
+
+    t = scn_memmem(scan, text + SCN_O, e - text - SCN_O, (rt_pntr)t_ndl1, 12);
+    irs0[3] = t != RT_NULL ? t - text : -1;
+}
+
+rt_void h_test18(rt_SIMD_INFOX *info)
+{
+    rt_elem r;
+
+    rt_ui08 *text = info->text, *e, *t;
+
+    e = text + SCN_N - 1;
+    for (r = 0, t = text + SCN_O;
+        (t = (rt_ui08 *)strpbrk((rt_char *)t, (rt_char *)t_set4)) != RT_NULL;
+         t++)
+    {
+        r++;
+    }
+    t_hres[0] = r;
+
+    for (r = 0, t = text + SCN_O;
+        (t = (rt_ui08 *)strpbrk((rt_char *)t, (rt_char *)t_set8)) != RT_NULL;
+         t++)
+    {
+        r++;
+    }
+    t_hres[1] = r;
+
+#if (defined RT_LINUX)
+    for (r = 0, t = text + SCN_O;
+        (t = (rt_ui08 *)memmem(t, e - t, t_ndl0, 5)) != RT_NULL; t++)
+    {
+        r++;
+    }
+    t_hres[2] = r;
+
+    t = (rt_ui08 *)memmem(text + SCN_O, e - text - SCN_O, t_ndl1, 12);
+    t_hres[3] = t != RT_NULL ? t - text : -1;
+#endif /* RT_LINUX */
+}
+
+rt_void p_test18(rt_SIMD_INFOX *info)
+{
+    p_results(info, "str");
+}
+
+#endif /* SUB_TEST 18 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 19   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 19
+
+/*
+ * Return checksum of histogram h of nb bins.
+ */
+rt_elem t_hsum(rt_elem *h, rt_si32 nb)
+{
+    rt_si32 j;
+    rt_elem r;
+
+    for (r = 0, j = 0; j < nb; j++)
+    {
+        r += h[j] * (j % 97 + 1);
+    }
+
+    return r;
+}
+
+/*
+ * Build histograms of rt_ui08, rt_ui16 and quantized rt_real values
+ * with a single histogram (C reference), results are checksums
+ * and the number of values clamped into the last bin.
+ */
+rt_void t_histc(rt_SIMD_INFOX *info,
+                rt_ui08 *b, rt_ui16 *w, rt_real *x, rt_elem *irc0)
+{
+    rt_si32 j;
+    rt_real s = (rt_real)HST_B / (1.0f - -1.0f), m = (rt_real)(HST_B - 1), t;
+
+    rt_elem *hco0 = info->hco0;
+
+    memset(hco0, 0, 256 * sizeof(rt_elem));
+    for (j = 0; j < HST_N; j++)
+    {
+        hco0[b[j]]++;
+    }
+    irc0[0] = t_hsum(hco0, 256);
+
+    memset(hco0, 0, 65536 * sizeof(rt_elem));
+    for (j = 0; j < HST_N; j++)
+    {
+        hco0[w[j]]++;
+    }
+    irc0[1] = t_hsum(hco0, 65536);
+
+    memset(hco0, 0, HST_B * sizeof(rt_elem));
+    for (j = 0; j < HST_N - 1; j++)
+    {
+        t = (x[j + 1] - -1.0f) * s;
+        hco0[(rt_elem)RT_MIN(RT_MAX(t, (rt_real)0), m)]++;
+    }
+    irc0[2] = t_hsum(hco0, HST_B);
+    irc0[3] = hco0[HST_B - 1];
+}
+
+rt_void t_hists(rt_SIMD_INFOX *info,
+                rt_ui08 *b, rt_ui16 *w, rt_real *x, rt_elem *irs0)
+{
+    rt_elem *hso0 = info->hso0;
+    rt_SIMD_HIST *hist = info->hist;
+
+    hst_ui08(hist, b, HST_N, hso0);
+    irs0[0] = t_hsum(hso0, 256);
+
+    hst_ui16(hist, w, HST_N, hso0);
+    irs0[1] = t_hsum(hso0, 65536);
+
+    /* input is offset by one element to exercise scalar head */
+    hst_real(hist, x + 1, HST_N - 1, -1.0f, 1.0f, HST_B, hso0);
+    irs0[2] = t_hsum(hso0, HST_B);
+    irs0[3] = hso0[HST_B - 1];
+}
+
+/*
+ * hsu: histograms of uniformly distributed values.
+ */
+rt_void c_test19(rt_SIMD_INFOX *info)
+{
+    t_histc(info, info->hb00, info->hw00, info->hr00, info->irc0);
+}
+
+rt_void s_test19(rt_SIMD_INFOX *info)
+{
+    t_hists(info, info->hb00, info->hw00, info->hr00, info->irs0);
+}
+
+rt_void p_test19(rt_SIMD_INFOX *info)
+{
+    p_results(info, "hsu");
+}
+
+#endif /* SUB_TEST 19 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 20   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 20
+
+/*
+ * hss: histograms of skewed values (7/8 of them hit the same bin).
+ */
+rt_void c_test20(rt_SIMD_INFOX *info)
+{
+    t_histc(info, info->hb01, info->hw01, info->hr01, info->irc0);
+}
+
+rt_void s_test20(rt_SIMD_INFOX *info)
+{
+    t_hists(info, info->hb01, info->hw01, info->hr01, info->irs0);
+}
+
+rt_void p_test20(rt_SIMD_INFOX *info)
+{
+    p_results(info, "hss");
+}
+
+#endif /* SUB_TEST 20 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 21   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 21
+
+#define HSH_SEED            0x5EED
+
+/*
+ * Return striped hash of n bytes from p with given seed (C reference),
+ * stripes are accumulated one 64-bit lane at a time.
+ */
+rt_ui64 t_hstrp(const rt_ui08 *p, rt_si32 n, rt_ui64 seed)
+{
+    rt_ui64 k[RT_HASH_STRP / 8], a[RT_HASH_STRP / 8], d, x, s;
+    rt_si32 i, j, m = n / RT_HASH_STRP;
+
+    hsh_lane(k, a, seed);
+
+    for (j = 0; j < m; j++)
+    {
+        s = (rt_ui64)j * RT_HASH_P64_3;
+
+        for (i = 0; i < RT_HASH_STRP / 8; i++)
+        {
+            d = hsh_ld64(p + j * RT_HASH_STRP + i * 8);
+            x = d ^ (k[i] + s);
+            a[i] += d + (rt_ui64)(rt_ui32)x * (rt_ui32)(x >> 32);
+        }
+        if (j % RT_HASH_BLCK == RT_HASH_BLCK - 1)
+        {
+            for (i = 0; i < RT_HASH_STRP / 8; i++)
+            {
+                a[i] ^= a[i] >> 47;
+                a[i] ^= k[i];
+                a[i] *= RT_HASH_P64_1;
+            }
+        }
+    }
+
+    m *= RT_HASH_STRP;
+
+    return hsh_last(a, k, p + m, n - m, n, seed);
+}
+
+/*
+ * hsh: hashes of 32/64-bit keys, long (text log) and short strings.
+ */
+rt_void c_test21(rt_SIMD_INFOX *info)
+{
+    rt_si32 j;
+    rt_ui64 r;
+
+    rt_ui32 *hk32 = info->hk32, *hc32 = info->hc32;
+    rt_ui64 *hk64 = info->hk64, *hc64 = info->hc64;
+    rt_ui08 *text = info->text;
+    rt_elem *irc0 = info->irc0;
+
+    for (j = 1; j < HSH_N; j++)
+    {
+        hc32[j] = hsh_mix32(hk32[j], HSH_SEED);
+    }
+    for (r = 0, j = 1; j < HSH_N; j++)
+    {
+        r = r * 31 + hc32[j];
+    }
+    irc0[0] = (rt_elem)(r ^ (r >> 32));
+
+    for (j = 1; j < HSH_N; j++)
+    {
+        hc64[j] = hsh_mix64(hk64[j], HSH_SEED);
+    }
+    for (r = 0, j = 1; j < HSH_N; j++)
+    {
+        r = r * 31 + hc64[j];
+    }
+    irc0[1] = (rt_elem)(r ^ (r >> 32));
+
+    r = t_hstrp(text, SCN_N, HSH_SEED) * 31
+      + t_hstrp(text + SCN_O, SCN_N - 2 * SCN_O, HSH_SEED);
+    irc0[2] = (rt_elem)(r ^ (r >> 32));
+
+    for (r = 0, j = 0; j <= HSH_S; j++)
+    {
+        r = r * 31 + t_hstrp(text + j, j, j);
+    }
+    irc0[3] = (rt_elem)(r ^ (r >> 32));
+}
+
+rt_void s_test21(rt_SIMD_INFOX *info)
+{
+    rt_si32 j;
+    rt_ui64 r;
+
+    rt_ui32 *hk32 = info->hk32, *hs32 = info->hs32;
+    rt_ui64 *hk64 = info->hk64, *hs64 = info->hs64;
+    rt_ui08 *text = info->text;
+    rt_elem *irs0 = info->irs0;
+    rt_SIMD_HASH *hash = info->hash;
+
+    /* keys are offset by one element to exercise scalar head */
+    hsh_ui32(hash, hk32 + 1, HSH_N - 1, HSH_SEED, hs32 + 1);
+    for (r = 0, j = 1; j < HSH_N; j++)
+    {
+        r = r * 31 + hs32[j];
+    }
+    irs0[0] = (rt_elem)(r ^ (r >> 32));
+
+    hsh_ui64(hash, hk64 + 1, HSH_N - 1, HSH_SEED, hs64 + 1);
+    for (r = 0, j = 1; j < HSH_N; j++)
+    {
+        r = r * 31 + hs64[j];
+    }
+    irs0[1] = (rt_elem)(r ^ (r >> 32));
+
+    /* aligned input is hashed in place, unaligned is copied in chunks */
+    r = hsh_strp(hash, text, SCN_N, HSH_SEED) * 31
+      + hsh_strp(hash, text + SCN_O, SCN_N - 2 * SCN_O, HSH_SEED);
+    irs0[2] = (rt_elem)(r ^ (r >> 32));
+
+    for (r = 0, j = 0; j <= HSH_S; j++)
+    {
+        r = r * 31 + hsh_strp(hash, text + j, j, j);
+    }
+    irs0[3] = (rt_elem)(r ^ (r >> 32));
+}
+
+rt_void p_test21(rt_SIMD_INFOX *info)
+{
+    p_results(info, "hsh");
+}
+
+#endif /* SUB_TEST 21 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 22   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 22
+
+#define RAY_T               100.0f /* initial tmax */
+
+/*
+ * ray: closest-hit of RAY_N rays vs RAY_M triangles, any-hit vs RAY_B boxes
+ * within closest-hit distance, RAY_R rays vs RAY_W nodes of up to S boxes,
+ * packet results are hit rates and mean distances (grazing hits may differ
+ * as inverse directions are estimated), node hits are counted exactly.
+ */
+rt_void c_test22(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, k, a;
+    rt_real p[3], s[3], q[3], r[3], det, u, v, t, tn, tf, t0, t1, tm;
+    rt_real nt = 0, st = 0, nb = 0, nn = 0, sn = 0;
+
+    rt_real *ro00 = info->ro00, *rd00 = info->rd00, *rt00 = info->rt00;
+    rt_real *rb00 = info->rb00, *rn00 = info->rn00, *e1, *e2, *v0, *o, *d;
+    rt_real e[6];
+    rt_real *frc0 = info->frc0;
+    rt_elem *irc0 = info->irc0;
+
+    for (i = 0; i < RAY_N; i++)
+    {
+        o = ro00 + 3 * i;
+        d = rd00 + 3 * i;
+        tm = RAY_T;
+
+        for (j = 0; j < RAY_M; j++)
+        {
+            v0 = rt00 + 9 * j;
+            e[0] = v0[3] - v0[0]; e[1] = v0[4] - v0[1]; e[2] = v0[5] - v0[2];
+            e[3] = v0[6] - v0[0]; e[4] = v0[7] - v0[1]; e[5] = v0[8] - v0[2];
+            e1 = e; e2 = e + 3;
+
+            p[0] = d[1] * e2[2] - d[2] * e2[1];
+            p[1] = d[2] * e2[0] - d[0] * e2[2];
+            p[2] = d[0] * e2[1] - d[1] * e2[0];
+            det = e1[0] * p[0] + e1[1] * p[1] + e1[2] * p[2];
+            det = (rt_real)1.0 / det;
+
+            s[0] = o[0] - v0[0]; s[1] = o[1] - v0[1]; s[2] = o[2] - v0[2];
+            u = (s[0] * p[0] + s[1] * p[1] + s[2] * p[2]) * det;
+
+            q[0] = s[1] * e1[2] - s[2] * e1[1];
+            q[1] = s[2] * e1[0] - s[0] * e1[2];
+            q[2] = s[0] * e1[1] - s[1] * e1[0];
+            v = (d[0] * q[0] + d[1] * q[1] + d[2] * q[2]) * det;
+            t = (e2[0] * q[0] + e2[1] * q[1] + e2[2] * q[2]) * det;
+
+            if (u >= 0 && v >= 0 && u + v <= 1 && t > 0 && t < tm)
+            {
+                tm = t;
+            }
+        }
+        if (tm < RAY_T)
+        {
+            nt += 1;
+            st += tm;
+        }
+
+        r[0] = ray_rcpd(d[0]); r[1] = ray_rcpd(d[1]); r[2] = ray_rcpd(d[2]);
+
+        for (j = 0; j < RAY_B; j++)
+        {
+            for (tn = 0, tf = tm, a = 0; a < 3; a++)
+            {
+                t0 = (rb00[6 * j + a + 0] - o[a]) * r[a];
+                t1 = (rb00[6 * j + a + 3] - o[a]) * r[a];
+                tn = RT_MAX(tn, RT_MIN(t0, t1));
+                tf = RT_MIN(tf, RT_MAX(t0, t1));
+            }
+            if (tn <= tf)
+            {
+                nb += 1;
+                break;
+            }
+        }
+    }
+
+    for (i = 0; i < RAY_R; i++)
+    {
+        o = ro00 + 3 * i;
+        d = rd00 + 3 * i;
+        r[0] = ray_rcpd(d[0]); r[1] = ray_rcpd(d[1]); r[2] = ray_rcpd(d[2]);
+
+        for (j = 0; j < RAY_W; j++)
+        {
+            for (k = 0; k < 1 + j % S; k++)
+            {
+                for (tn = 0, tf = RAY_T, a = 0; a < 3; a++)
+                {
+                    t0 = (rn00[6 * (j * S + k) + a + 0] - o[a]) * r[a];
+                    t1 = (rn00[6 * (j * S + k) + a + 3] - o[a]) * r[a];
+                    tn = RT_MAX(tn, RT_MIN(t0, t1));
+                    tf = RT_MIN(tf, RT_MAX(t0, t1));
+                }
+                if (tn <= tf)
+                {
+                    nn += 1;
+                    sn += tn;
+                }
+            }
+        }
+    }
+
+    frc0[0] = nt / RAY_N;
+    frc0[1] = st / RT_MAX(nt, 1);
+    frc0[2] = nb / RAY_N;
+    frc0[3] = sn / RT_MAX(nn, 1);
+    irc0[0] = (rt_elem)nn;
+}
+
+rt_void s_test22(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, k;
+    rt_real nt = 0, st = 0, nb = 0, nn = 0, sn = 0;
+
+    rt_real *ro00 = info->ro00, *rd00 = info->rd00;
+    rt_SIMD_RPKT *rpkt = info->rpkt;
+    rt_SIMD_RHIT *rhit = info->rhit;
+    rt_SIMD_RAYS *rays = info->rays;
+    rt_real *frs0 = info->frs0;
+    rt_elem *irs0 = info->irs0;
+
+    for (i = 0; i < RAY_N; i++)
+    {
+        rt_SIMD_RPKT *pk = rpkt + i / S;
+        pk->ox[i % S] = ro00[3 * i + 0];
+        pk->oy[i % S] = ro00[3 * i + 1];
+        pk->oz[i % S] = ro00[3 * i + 2];
+        pk->dx[i % S] = rd00[3 * i + 0];
+        pk->dy[i % S] = rd00[3 * i + 1];
+        pk->dz[i % S] = rd00[3 * i + 2];
+        pk->tm[i % S] = RAY_T;
+    }
+
+    ray_prep(rays, rpkt, RAY_N / S);
+    ray_tris(rays, rpkt, RAY_N / S, info->rtri, RAY_M);
+
+    for (i = 0; i < RAY_N; i++)
+    {
+        rt_SIMD_RPKT *pk = rpkt + i / S;
+        if (pk->hm[i % S] != 0)
+        {
+            nt += 1;
+            st += pk->tm[i % S];
+        }
+    }
+
+    ray_boxs(rays, rpkt, RAY_N / S, info->rbox, RAY_B);
+
+    for (i = 0; i < RAY_N; i++)
+    {
+        nb += rpkt[i / S].hm[i % S] != 0;
+    }
+
+    for (i = 0; i < RAY_R; i++)
+    {
+        ray_node(rays, ro00 + 3 * i, rd00 + 3 * i, RAY_T,
+                 info->rnod, RAY_W, rhit);
+
+        for (j = 0; j < RAY_W; j++)
+        {
+            for (k = 0; k < S; k++)
+            {
+                if (rhit[j].hm[k] != 0)
+                {
+                    nn += 1;
+                    sn += rhit[j].tn[k];
+                }
+            }
+        }
+    }
+
+    frs0[0] = nt / RAY_N;
+    frs0[1] = st / RT_MAX(nt, 1);
+    frs0[2] = nb / RAY_N;
+    frs0[3] = sn / RT_MAX(nn, 1);
+    irs0[0] = (rt_elem)nn;
+}
+
+rt_void p_test22(rt_SIMD_INFOX *info)
+{
+    p_results(info, "ray");
+}
+
+#endif /* SUB_TEST 22 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 23   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 23
+
+/*
+ * Check wide bvh built over BVH_N boxes: child boxes must enclose
+ * grandchild boxes and leaf primitives, which must be a permutation,
+ * results are SAH cost (relative to root), number of enclosed primitives,
+ * number of violations and sum of primitive indices.
+ */
+rt_void b_check(rt_SIMD_INFOX *info, rt_real *f, rt_elem *e)
+{
+    rt_SIMD_BVHS *bvhs = info->bvhs;
+    rt_SIMD_RBOX *b, *c;
+    rt_real *v, *bv00 = info->bv00, sah = 0, ax, ay, az, ar = 0;
+    rt_si32 i, j, k, m, w;
+    rt_elem r, n = 0, x = 0, h = 0;
+
+    for (w = 0; w < bvhs->ncnt; w++)
+    {
+        b = bvhs->boxs + w;
+        for (k = 0; k < S; k++)
+        {
+            r = bvhs->link[w].ref[k];
+            m = (rt_si32)bvhs->link[w].cnt[k];
+            if (r == -1 && m == 0)
+            {
+                continue;
+            }
+
+            ax = b->mxx[k] - b->mnx[k];
+            ay = b->mxy[k] - b->mny[k];
+            az = b->mxz[k] - b->mnz[k];
+            ax = ax * ay + az * (ax + ay);
+            ar += w == 0 ? ax : 0;
+            sah += ax * (r < 0 ? m : 1);
+
+            if (r >= 0)
+            {
+                c = bvhs->boxs + r;
+                for (j = 0; j < S; j++)
+                {
+                    if (bvhs->link[r].ref[j] == -1 && bvhs->link[r].cnt[j] == 0)
+                    {
+                        continue;
+                    }
+                    x += c->mnx[j] < b->mnx[k] || c->mxx[j] > b->mxx[k]
+                      || c->mny[j] < b->mny[k] || c->mxy[j] > b->mxy[k]
+                      || c->mnz[j] < b->mnz[k] || c->mxz[j] > b->mxz[k];
+                }
+                continue;
+            }
+
+            for (i = (rt_si32)~r; i < (rt_si32)~r + m; i++)
+            {
+                v = bv00 + 6 * bvhs->pidx[i];
+                h += bvhs->pidx[i];
+                n += v[0] >= b->mnx[k] && v[3] <= b->mxx[k]
+                  && v[1] >= b->mny[k] && v[4] <= b->mxy[k]
+                  && v[2] >= b->mnz[k] && v[5] <= b->mxz[k];
+            }
+        }
+    }
+
+    f[0] = sah / RT_MAX(ar, (rt_real)1.0e-30);
+    e[0] = n;
+    e[1] = x;
+    e[2] = h;
+}
+
+/*
+ * Count hits of ray with origin o and inverse direction r
+ * against primitive boxes of leaf child (ref, cnt).
+ */
+rt_elem b_leaf(rt_SIMD_INFOX *info, rt_real *o, rt_real *r,
+               rt_elem ref, rt_elem cnt)
+{
+    rt_SIMD_BVHS *bvhs = info->bvhs;
+    rt_real *v, tn, tf, t0, t1;
+    rt_si32 j, a;
+    rt_elem nh = 0;
+
+    for (j = (rt_si32)~ref; j < (rt_si32)(~ref + cnt); j++)
+    {
+        v = info->bv00 + 6 * bvhs->pidx[j];
+        for (tn = 0, tf = RAY_T, a = 0; a < 3; a++)
+        {
+            t0 = (v[a + 0] - o[a]) * r[a];
+            t1 = (v[a + 3] - o[a]) * r[a];
+            tn = RT_MAX(tn, RT_MIN(t0, t1));
+            tf = RT_MIN(tf, RT_MAX(t0, t1));
+        }
+        nh += tn <= tf;
+    }
+
+    return nh;
+}
+
+/*
+ * bvh: build wide bvh over BVH_N boxes with scalar binning (C)
+ * and SIMD binning of top-level nodes (S), trace BVH_R rays through it
+ * with scalar slabs (C) and ray_node (S), results are from b_check
+ * and number of ray/primitive box hits (independent of bvh layout).
+ */
+rt_void c_test23(rt_SIMD_INFOX *info)
+{
+    rt_SIMD_BVHS *bvhs = info->bvhs;
+    rt_SIMD_RBOX *b;
+    rt_real *o, *d, r[3], mn[3], mx[3], tn, tf, t0, t1;
+    rt_si32 i, k, a, w, t, *stck = bvhs->stck;
+    rt_elem ref, nh = 0;
+
+    rt_real *frc0 = info->frc0;
+    rt_elem *irc0 = info->irc0;
+
+    bvhs->smin = BVH_N + 1;
+    bvh_build(bvhs, info->bv00, BVH_N);
+
+    b_check(info, frc0, irc0);
+
+    for (i = 0; i < BVH_R; i++)
+    {
+        o = info->ro00 + 3 * (16 * i + 4);
+        d = info->rd00 + 3 * (16 * i + 4);
+        r[0] = ray_rcpd(d[0]); r[1] = ray_rcpd(d[1]); r[2] = ray_rcpd(d[2]);
+
+        stck[0] = 0;
+        t = 1;
+        while (t > 0)
+        {
+            w = stck[--t];
+            b = bvhs->boxs + w;
+            for (k = 0; k < S; k++)
+            {
+                mn[0] = b->mnx[k]; mn[1] = b->mny[k]; mn[2] = b->mnz[k];
+                mx[0] = b->mxx[k]; mx[1] = b->mxy[k]; mx[2] = b->mxz[k];
+                for (tn = 0, tf = RAY_T, a = 0; a < 3; a++)
+                {
+                    t0 = (mn[a] - o[a]) * r[a];
+                    t1 = (mx[a] - o[a]) * r[a];
+                    tn = RT_MAX(tn, RT_MIN(t0, t1));
+                    tf = RT_MIN(tf, RT_MAX(t0, t1));
+                }
+                if (tn > tf)
+                {
+                    continue;
+                }
+                ref = bvhs->link[w].ref[k];
+                if (ref >= 0)
+                {
+                    stck[t++] = (rt_si32)ref;
+                }
+                else
+                {
+                    nh += b_leaf(info, o, r, ref, bvhs->link[w].cnt[k]);
+                }
+            }
+        }
+    }
+
+    irc0[3] = nh;
+}
+
+rt_void s_test23(rt_SIMD_INFOX *info)
+{
+    rt_SIMD_BVHS *bvhs = info->bvhs;
+    rt_SIMD_RHIT *rhit = info->rhit;
+    rt_real *o, *d, r[3];
+    rt_si32 i, k, w, t, *stck = bvhs->stck;
+    rt_elem ref, nh = 0;
+
+    rt_real *frs0 = info->frs0;
+    rt_elem *irs0 = info->irs0;
+
+    bvhs->smin = RT_BVHS_SIMD;
+    bvh_build(bvhs, info->bv00, BVH_N);
+
+    b_check(info, frs0, irs0);
+
+    for (i = 0; i < BVH_R; i++)
+    {
+        o = info->ro00 + 3 * (16 * i + 4);
+        d = info->rd00 + 3 * (16 * i + 4);
+        r[0] = ray_rcpd(d[0]); r[1] = ray_rcpd(d[1]); r[2] = ray_rcpd(d[2]);
+
+        stck[0] = 0;
+        t = 1;
+        while (t > 0)
+        {
+            w = stck[--t];
+            ray_node(info->rays, o, d, RAY_T, bvhs->boxs + w, 1, rhit);
+            for (k = 0; k < S; k++)
+            {
+                if (rhit->hm[k] == 0)
+                {
+                    continue;
+                }
+                ref = bvhs->link[w].ref[k];
+                if (ref >= 0)
+                {
+                    stck[t++] = (rt_si32)ref;
+                }
+                else
+                {
+                    nh += b_leaf(info, o, r, ref, bvhs->link[w].cnt[k]);
+                }
+            }
+        }
+    }
+
+    irs0[3] = nh;
+}
+
+rt_void p_test23(rt_SIMD_INFOX *info)
+{
+    p_results(info, "bvh");
+}
+
+#endif /* SUB_TEST 23 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 24   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 24
+
+#define VCM_T               0.3f /* slerp parameter */
+
+/* offsets of inputs and outputs in units of VCM_N items (AoS)
+ * or packet-rounded VCM_N items (SIMD), each array holds all items */
+#define VCM_M4              0   /* 4x4 matrices */
+#define VCM_M3              16  /* 3x3 matrices (upper-left of 4x4) */
+#define VCM_Q0              25  /* 1st unit quaternions */
+#define VCM_Q1              29  /* 2nd unit quaternions */
+#define VCM_V4              33  /* 4D vectors */
+#define VCM_V3              37  /* 1st 3D vectors (xyz of 4D) */
+#define VCM_W3              40  /* 2nd 3D vectors */
+#define VCM_DOT             43  /* dot products */
+#define VCM_CRS             44  /* cross products */
+#define VCM_NRM             47  /* normalized vectors */
+#define VCM_XF3             50  /* 3x3 matrices times vectors */
+#define VCM_ML3             53  /* 3x3 matrix squares */
+#define VCM_XF4             62  /* 4x4 matrix squares times vectors */
+#define VCM_QML             66  /* quaternion products */
+#define VCM_SLR             70  /* quaternion slerps */
+#define VCM_INV             74  /* 4x4 matrix inverses */
+#define VCM_TMP             90  /* 4x4 matrix squares (SIMD only) */
+#define VCM_END             106
+
+/*
+ * Check vecm outputs (AoS), results are mean absolute sums of vector,
+ * matrix, quaternion and inverse outputs, numbers of inverses
+ * with A * inv(A) = I, unit slerps, crosses orthogonal to 1st vectors
+ * and unit normals (all within tolerance).
+ */
+rt_void v_check(rt_SIMD_INFOX *info, rt_real *f, rt_elem *e)
+{
+    rt_real *b = info->vm00, *a, *c, *v, t, u, w;
+    rt_si32 i, j, k, l;
+
+    f[0] = f[1] = f[2] = f[3] = 0;
+    e[0] = e[1] = e[2] = e[3] = 0;
+
+    for (i = VCM_DOT * VCM_N; i < VCM_INV * VCM_N; i++)
+    {
+        j = i < VCM_XF3 * VCM_N ? 0 : i < VCM_QML * VCM_N ? 1 : 2;
+        f[j] += RT_FABS(b[i]);
+    }
+    for (i = VCM_INV * VCM_N; i < VCM_TMP * VCM_N; i++)
+    {
+        f[3] += RT_FABS(b[i]);
+    }
+    for (j = 0; j < 4; j++)
+    {
+        f[j] /= VCM_N;
+    }
+
+    for (i = 0; i < VCM_N; i++)
+    {
+        a = b + VCM_M4 * VCM_N + 16 * i;
+        c = b + VCM_INV * VCM_N + 16 * i;
+        for (w = 0, k = 0; k < 4; k++)
+        {
+            for (l = 0; l < 4; l++)
+            {
+                for (t = 0, j = 0; j < 4; j++)
+                {
+                    t += a[4 * k + j] * c[4 * j + l];
+                }
+                w = RT_MAX(w, RT_FABS(t - (rt_real)(k == l)));
+            }
+        }
+        e[0] += w < 1.0e-4f;
+
+        v = b + VCM_SLR * VCM_N + 4 * i;
+        t = v[0] * v[0] + v[1] * v[1] + v[2] * v[2] + v[3] * v[3];
+        e[1] += RT_FABS(t - 1) < 1.0e-4f;
+
+        a = b + VCM_V3 * VCM_N + 3 * i;
+        v = b + VCM_CRS * VCM_N + 3 * i;
+        t = a[0] * v[0] + a[1] * v[1] + a[2] * v[2];
+        u = a[0] * a[0] + a[1] * a[1] + a[2] * a[2];
+        e[2] += RT_FABS(t) < 1.0e-4f * (u + 1);
+
+        v = b + VCM_NRM * VCM_N + 3 * i;
+        t = v[0] * v[0] + v[1] * v[1] + v[2] * v[2];
+        e[3] += RT_FABS(t - 1) < 1.0e-4f;
+    }
+}
+
+/*
+ * vecm: batch vector, quaternion and matrix math over VCM_N items
+ * on AoS arrays (C) and SoA packets with unpacked outputs (S),
+ * inverse is computed with Gauss-Jordan elimination (C)
+ * and cofactors (S), slerp with trigonometry (C) and series (S).
+ */
+rt_void c_test24(rt_SIMD_INFOX *info)
+{
+    rt_real *b = info->vm00, *m, *q, *r, *v, *w, *o;
+    rt_real g[16], d, t, s0, s1;
+    rt_si32 i, j, k, l;
+
+    rt_real *frc0 = info->frc0;
+    rt_elem *irc0 = info->irc0;
+
+    for (i = 0; i < VCM_N; i++)
+    {
+        v = b + VCM_V3 * VCM_N + 3 * i;
+        w = b + VCM_W3 * VCM_N + 3 * i;
+        o = b + VCM_DOT * VCM_N + i;
+        o[0] = v[0] * w[0] + v[1] * w[1] + v[2] * w[2];
+        o = b + VCM_CRS * VCM_N + 3 * i;
+        o[0] = v[1] * w[2] - v[2] * w[1];
+        o[1] = v[2] * w[0] - v[0] * w[2];
+        o[2] = v[0] * w[1] - v[1] * w[0];
+        o = b + VCM_NRM * VCM_N + 3 * i;
+        d = (rt_real)1.0 / RT_SQRT(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+        o[0] = v[0] * d;
+        o[1] = v[1] * d;
+        o[2] = v[2] * d;
+
+        m = b + VCM_M3 * VCM_N + 9 * i;
+        for (k = 0; k < 3; k++)
+        {
+            o = b + VCM_XF3 * VCM_N + 3 * i;
+            o[k] = m[3 * k] * v[0] + m[3 * k + 1] * v[1] + m[3 * k + 2] * v[2];
+            o = b + VCM_ML3 * VCM_N + 9 * i;
+            for (l = 0; l < 3; l++)
+            {
+                o[3 * k + l] = m[3 * k + 0] * m[0 + l]
+                             + m[3 * k + 1] * m[3 + l]
+                             + m[3 * k + 2] * m[6 + l];
+            }
+        }
+
+        m = b + VCM_M4 * VCM_N + 16 * i;
+        v = b + VCM_V4 * VCM_N + 4 * i;
+        for (k = 0; k < 4; k++)
+        {
+            for (l = 0; l < 4; l++)
+            {
+                g[4 * k + l] = m[4 * k + 0] * m[0 + l]
+                             + m[4 * k + 1] * m[4 + l]
+                             + m[4 * k + 2] * m[8 + l]
+                             + m[4 * k + 3] * m[12 + l];
+            }
+        }
+        o = b + VCM_XF4 * VCM_N + 4 * i;
+        for (k = 0; k < 4; k++)
+        {
+            o[k] = g[4 * k + 0] * v[0] + g[4 * k + 1] * v[1]
+                 + g[4 * k + 2] * v[2] + g[4 * k + 3] * v[3];
+        }
+
+        q = b + VCM_Q0 * VCM_N + 4 * i;
+        r = b + VCM_Q1 * VCM_N + 4 * i;
+        o = b + VCM_QML * VCM_N + 4 * i;
+        o[0] = q[3] * r[0] + q[0] * r[3] + q[1] * r[2] - q[2] * r[1];
+        o[1] = q[3] * r[1] - q[0] * r[2] + q[1] * r[3] + q[2] * r[0];
+        o[2] = q[3] * r[2] + q[0] * r[1] - q[1] * r[0] + q[2] * r[3];
+        o[3] = q[3] * r[3] - q[0] * r[0] - q[1] * r[1] - q[2] * r[2];
+
+        d = q[0] * r[0] + q[1] * r[1] + q[2] * r[2] + q[3] * r[3];
+        t = (rt_real)acos(RT_MIN(RT_FABS(d), (rt_real)1.0));
+        s0 = 1.0f - VCM_T;
+        s1 = VCM_T;
+        if (t > 1.0e-3f)
+        {
+            s0 = (rt_real)(sin((1.0 - VCM_T) * t) / sin(t));
+            s1 = (rt_real)(sin(VCM_T * t) / sin(t));
+        }
+        s1 = d < 0 ? -s1 : s1;
+        o = b + VCM_SLR * VCM_N + 4 * i;
+        for (k = 0; k < 4; k++)
+        {
+            o[k] = s0 * q[k] + s1 * r[k];
+        }
+
+        /* Gauss-Jordan on diagonally dominant matrix, no pivoting */
+        o = b + VCM_INV * VCM_N + 16 * i;
+        for (k = 0; k < 16; k++)
+        {
+            g[k] = m[k];
+            o[k] = (rt_real)((k >> 2) == (k & 3));
+        }
+        for (k = 0; k < 4; k++)
+        {
+            d = (rt_real)1.0 / g[5 * k];
+            for (l = 0; l < 4; l++)
+            {
+                g[4 * k + l] *= d;
+                o[4 * k + l] *= d;
+            }
+            for (j = 0; j < 4; j++)
+            {
+                d = j != k ? g[4 * j + k] : 0;
+                for (l = 0; l < 4; l++)
+                {
+                    g[4 * j + l] -= d * g[4 * k + l];
+                    o[4 * j + l] -= d * o[4 * k + l];
+                }
+            }
+        }
+    }
+
+    v_check(info, frc0, irc0);
+}
+
+rt_void s_test24(rt_SIMD_INFOX *info)
+{
+    rt_SIMD_VECM *vecm = info->vecm;
+    rt_real *b = info->vm00, *p = info->vp00;
+    rt_si32 n = (VCM_N + S - 1) / S, z = n * S;
+
+    rt_real *frs0 = info->frs0;
+    rt_elem *irs0 = info->irs0;
+
+    vcm_dot3(vecm, (rt_SIMD_VEC3 *)(p + VCM_V3 * z),
+                   (rt_SIMD_VEC3 *)(p + VCM_W3 * z), p + VCM_DOT * z, n);
+    vcm_crs3(vecm, (rt_SIMD_VEC3 *)(p + VCM_V3 * z),
+                   (rt_SIMD_VEC3 *)(p + VCM_W3 * z),
+                   (rt_SIMD_VEC3 *)(p + VCM_CRS * z), n);
+    vcm_nrm3(vecm, (rt_SIMD_VEC3 *)(p + VCM_V3 * z),
+                   (rt_SIMD_VEC3 *)(p + VCM_NRM * z), n);
+
+    vcm_xfm3(vecm, (rt_SIMD_MAT3 *)(p + VCM_M3 * z),
+                   (rt_SIMD_VEC3 *)(p + VCM_V3 * z),
+                   (rt_SIMD_VEC3 *)(p + VCM_XF3 * z), n);
+    vcm_mul3(vecm, (rt_SIMD_MAT3 *)(p + VCM_M3 * z),
+                   (rt_SIMD_MAT3 *)(p + VCM_M3 * z),
+                   (rt_SIMD_MAT3 *)(p + VCM_ML3 * z), n);
+    vcm_mul4(vecm, (rt_SIMD_MAT4 *)(p + VCM_M4 * z),
+                   (rt_SIMD_MAT4 *)(p + VCM_M4 * z),
+                   (rt_SIMD_MAT4 *)(p + VCM_TMP * z), n);
+    vcm_xfm4(vecm, (rt_SIMD_MAT4 *)(p + VCM_TMP * z),
+                   (rt_SIMD_VEC4 *)(p + VCM_V4 * z),
+                   (rt_SIMD_VEC4 *)(p + VCM_XF4 * z), n);
+
+    vcm_qmul(vecm, (rt_SIMD_QUAT *)(p + VCM_Q0 * z),
+                   (rt_SIMD_QUAT *)(p + VCM_Q1 * z),
+                   (rt_SIMD_QUAT *)(p + VCM_QML * z), n);
+    vcm_slrp(vecm, (rt_SIMD_QUAT *)(p + VCM_Q0 * z),
+                   (rt_SIMD_QUAT *)(p + VCM_Q1 * z), VCM_T,
+                   (rt_SIMD_QUAT *)(p + VCM_SLR * z), n);
+
+    vcm_inv4(vecm, (rt_SIMD_MAT4 *)(p + VCM_M4 * z),
+                   (rt_SIMD_MAT4 *)(p + VCM_INV * z), n);
+
+    vcm_unpk(b + VCM_DOT * VCM_N, p + VCM_DOT * z, 1, VCM_N);
+    vcm_unpk(b + VCM_CRS * VCM_N, p + VCM_CRS * z, 3, VCM_N);
+    vcm_unpk(b + VCM_NRM * VCM_N, p + VCM_NRM * z, 3, VCM_N);
+    vcm_unpk(b + VCM_XF3 * VCM_N, p + VCM_XF3 * z, 3, VCM_N);
+    vcm_unpk(b + VCM_ML3 * VCM_N, p + VCM_ML3 * z, 9, VCM_N);
+    vcm_unpk(b + VCM_XF4 * VCM_N, p + VCM_XF4 * z, 4, VCM_N);
+    vcm_unpk(b + VCM_QML * VCM_N, p + VCM_QML * z, 4, VCM_N);
+    vcm_unpk(b + VCM_SLR * VCM_N, p + VCM_SLR * z, 4, VCM_N);
+    vcm_unpk(b + VCM_INV * VCM_N, p + VCM_INV * z, 16, VCM_N);
+
+    v_check(info, frs0, irs0);
+}
+
+rt_void p_test24(rt_SIMD_INFOX *info)
+{
+    p_results(info, "vecm");
+}
+
+#endif /* SUB_TEST 24 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 25   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 25
+
+/*
+ * poly: degree 8 Taylor polynomial of exp(x) over far0 with Horner (1st)
+ * and Estrin (2nd) in C and S, tail shorter than S is evaluated in C.
+ */
+rt_void c_test25(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k, n = info->size - 3;
+    rt_real r, x, x2, x4;
+
+    rt_real *far0 = info->far0;
+    rt_real *fco1 = info->fco1;
+    rt_real *fco2 = info->fco2;
+    rt_real c[RT_POLY_SIZE];
+
+    for (c[0] = 1.0, k = 1; k < RT_POLY_SIZE; k++)
+    {
+        c[k] = c[k - 1] / k;
+    }
+
+    for (j = 0; j < n; j++)
+    {
+        x = far0[j];
+        for (r = c[8], k = 7; k >= 0; k--)
+        {
+            r = r * x + c[k];
+        }
+        fco1[j] = r;
+
+        x2 = x * x;
+        x4 = x2 * x2;
+        fco2[j] = ((c[0] + c[1] * x) + (c[2] + c[3] * x) * x2)
+                + ((c[4] + c[5] * x) + (c[6] + c[7] * x) * x2) * x4
+                + c[8] * (x4 * x4);
+    }
+}
+
+rt_void s_test25(rt_SIMD_INFOX *info)
+{
+    rt_SIMD_POLY *poly = info->poly;
+    rt_si32 k, n = info->size - 3;
+    rt_real c[RT_POLY_SIZE];
+
+    for (c[0] = 1.0, k = 1; k < RT_POLY_SIZE; k++)
+    {
+        c[k] = c[k - 1] / k;
+    }
+    ply_init(poly, c, RT_POLY_SIZE);
+
+    ply_horn(poly, info->fso1, info->far0, n);
+    ply_estn(poly, info->fso2, info->far0, n);
+}
+
+rt_void p_test25(rt_SIMD_INFOX *info)
+{
+    p_arrays(info, "poly");
+}
+
+#endif /* SUB_TEST 25 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 26   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 26
+
+/*
+ * ksum: compensated sum (1st) and dot (2nd, 3rd with misaligned y) of shuffled
+ * cancelling terms of large magnitude and small residuals, results match
+ * exact references within compensated error bound (idx 0-2) where plain dot
+ * drifts away (idx 3), bound is eps * |sum| + eps^2 * sqrt(n) * sum |terms|.
+ */
+rt_si32 ksm_check(rt_real r, rt_real e, rt_real a)
+{
+    return RT_FABS(r - e) <= 4.0 * KSM_U * RT_FABS(e)
+                           + KSM_U * KSM_U * a * RT_SQRT((rt_real)KSM_N);
+}
+
+rt_void c_test26(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = KSM_N;
+    rt_real s, c, t, p, e, r;
+
+    rt_real *x = info->ks00 + 1;
+    rt_real *y = info->ks00 + KSM_M + 1;
+    rt_real *z = info->ks00 + 2 * KSM_M + 2;
+    rt_real *k = info->ks00 + KSM_R;
+    rt_real *frc0 = info->frc0;
+    rt_elem *irc0 = info->irc0;
+
+    for (s = 0.0, c = 0.0, j = 0; j < n; j++)
+    {
+        t = s + x[j];
+        c += RT_FABS(s) >= RT_FABS(x[j]) ? (s - t) + x[j] : (x[j] - t) + s;
+        s = t;
+    }
+    frc0[0] = s + c;
+
+    for (s = 0.0, c = 0.0, j = 0; j < n; j++)
+    {
+        p = x[j] * y[j];
+#if RT_ELEMENT == 32
+        e = fmaf(x[j], y[j], -p);
+#else  /* RT_ELEMENT == 64 */
+        e = fma(x[j], y[j], -p);
+#endif /* RT_ELEMENT */
+        t = s + p;
+        c += RT_FABS(s) >= RT_FABS(p) ? (s - t) + p : (p - t) + s;
+        c += e;
+        s = t;
+    }
+    frc0[1] = s + c;
+    frc0[2] = s + c;
+
+    for (r = 0.0, j = 0; j < n; j++)
+    {
+        r += x[j] * z[j];
+    }
+    frc0[3] = 0.0;
+
+    irc0[0] = ksm_check(frc0[0], k[0], k[2]);
+    irc0[1] = ksm_check(frc0[1], k[1], k[3]);
+    irc0[2] = ksm_check(frc0[2], k[1], k[3]);
+    irc0[3] = !ksm_check(r, k[1], k[3]);
+}
+
+rt_void s_test26(rt_SIMD_INFOX *info)
+{
+    rt_SIMD_BLAS *blas = info->blas;
+    rt_real *k = info->ks00 + KSM_R;
+    rt_real *frs0 = info->frs0;
+    rt_elem *irs0 = info->irs0;
+
+    blas->x = info->ks00 + 1;
+    blas->size = KSM_N;
+    blas_ksum(blas);
+    frs0[0] = blas->rval[0];
+
+    blas->y = info->ks00 + KSM_M + 1;
+    blas_kdot(blas);
+    frs0[1] = blas->rval[0];
+
+    blas->y = info->ks00 + 2 * KSM_M + 2;
+    blas_kdot(blas);
+    frs0[2] = blas->rval[0];
+
+    blas_dot(blas);
+    frs0[3] = 0.0;
+
+    irs0[0] = ksm_check(frs0[0], k[0], k[2]);
+    irs0[1] = ksm_check(frs0[1], k[1], k[3]);
+    irs0[2] = ksm_check(frs0[2], k[1], k[3]);
+    irs0[3] = !ksm_check(blas->rval[0], k[1], k[3]);
+}
+
+rt_void p_test26(rt_SIMD_INFOX *info)
+{
+    p_results(info, "ksum");
+}
+
+#endif /* SUB_TEST 26 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 27   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 27
+
+/*
+ * quad: double-double add, sub, mul, div, sqrt, fma over packed arrays
+ * in S against __float128 (or long double) references rounded to hi + lo
+ * in C, counts results within 2^-100 relative error (idx 0: add, sub,
+ * idx 1: mul, fma, idx 2: div, idx 3: sqrt) and their mean magnitudes.
+ * Inputs a, b, c are at qd00 + QUD_Z * (0, 1, 2), C outputs follow at 3-8,
+ * S outputs at 9-14, in the order of ops above.
+ */
+#if defined (__SIZEOF_FLOAT128__)
+typedef __float128      rt_f128;
+#else /* long double is 128-bit on AArch64, POWER, MIPS64, RISC-V */
+typedef long double     rt_f128;
+#endif /* __SIZEOF_FLOAT128__ */
+
+rt_void q_check(rt_SIMD_INFOX *info, rt_fp64 *d, rt_real *f, rt_elem *e)
+{
+    rt_fp64 *a = info->qd00, *b = a + QUD_Z, *c = b + QUD_Z;
+    rt_fp64 *r = a + QUD_Z * 3, *h, *g, m, t, u;
+    rt_si32 i, j, k;
+
+    f[0] = f[1] = f[2] = f[3] = 0;
+    e[0] = e[1] = e[2] = e[3] = 0;
+
+    for (k = 0; k < 6; k++)
+    {
+        j = k < 2 ? 0 : k == 2 || k == 5 ? 1 : k - 1;
+        h = r + QUD_Z * k;
+        g = d + QUD_Z * k;
+        for (i = QUD_IX(0); i < QUD_N; i++)
+        {
+            u = h[QUD_IX(i)];
+            m = k < 2 ? RT_FABS(a[QUD_IX(i)]) + RT_FABS(b[QUD_IX(i)]) :
+                k < 5 ? RT_FABS(u) :
+                RT_FABS(a[QUD_IX(i)] * b[QUD_IX(i)]) + RT_FABS(c[QUD_IX(i)]);
+            t = (g[QUD_IX(i)] - u) + (g[QUD_IX(i) + T] - h[QUD_IX(i) + T]);
+            e[j] += RT_FABS(t) <= m * 7.888609052210118e-31; /* 2^-100 */
+            f[j] += (rt_real)(RT_FABS(g[QUD_IX(i)]) / QUD_N);
+        }
+    }
+}
+
+rt_void c_test27(rt_SIMD_INFOX *info)
+{
+    rt_fp64 *a = info->qd00, *b = a + QUD_Z, *c = b + QUD_Z;
+    rt_fp64 *d = a + QUD_Z * 3;
+    rt_f128 x, y, z, w[6];
+    rt_si32 i, k;
+
+    for (i = 0; i < QUD_N; i++)
+    {
+        x = (rt_f128)a[QUD_IX(i)] + a[QUD_IX(i) + T];
+        y = (rt_f128)b[QUD_IX(i)] + b[QUD_IX(i) + T];
+        z = (rt_f128)c[QUD_IX(i)] + c[QUD_IX(i) + T];
+
+        w[0] = x + y;
+        w[1] = x - y;
+        w[2] = x * y;
+        w[3] = x / y;
+        w[4] = sqrt(a[QUD_IX(i)]);
+        w[4] = (w[4] + x / w[4]) / 2;
+        w[4] = (w[4] + x / w[4]) / 2;
+        w[5] = x * y + z;
+
+        for (k = 0; k < 6; k++)
+        {
+            d[QUD_Z * k + QUD_IX(i) + 0] = (rt_fp64)w[k];
+            d[QUD_Z * k + QUD_IX(i) + T] = (rt_fp64)(w[k] - (rt_fp64)w[k]);
+        }
+    }
+
+    q_check(info, d, info->frc0, info->irc0);
+}
+
+rt_void s_test27(rt_SIMD_INFOX *info)
+{
+    rt_SIMD_QUAD *quad = info->quad;
+    rt_fp64 *a = info->qd00, *b = a + QUD_Z, *c = b + QUD_Z;
+    rt_fp64 *d = a + QUD_Z * 9;
+
+    qud_add(quad, d + QUD_Z * 0, a, b, QUD_N);
+    qud_sub(quad, d + QUD_Z * 1, a, b, QUD_N);
+    qud_mul(quad, d + QUD_Z * 2, a, b, QUD_N);
+    qud_div(quad, d + QUD_Z * 3, a, b, QUD_N);
+    qud_sqr(quad, d + QUD_Z * 4, a, QUD_N);
+    qud_fma(quad, d + QUD_Z * 5, a, b, c, QUD_N);
+
+    q_check(info, d, info->frs0, info->irs0);
+}
+
+rt_void p_test27(rt_SIMD_INFOX *info)
+{
+    p_results(info, "quad");
+}
+
+#endif /* SUB_TEST 27 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 28   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 28
+
+/*
+ * half: fp16 add, sub, mul, div, min, max, sqrt, fma over arrays in S
+ * (native or emulated cmdm* subset) against fp32 results rounded to fp16
+ * in C, counts matching results (idx 0: add, sub, idx 1: mul, fma,
+ * idx 2: div, sqrt, idx 3: min, max) and their mean magnitudes,
+ * fused native fma may differ by 1 ulp (rounded once), NaNs match as class,
+ * magnitudes exclude overflowed results.
+ * Inputs a, b, c are at hf00 + HLF_Z * (0, 1, 2), C outputs follow at 3-10,
+ * S outputs at 11-18, in the order of ops above.
+ */
+rt_si32 t_hlfop[8] = {0, 0, 1, 2, 3, 3, 2, 1}; /* op to result idx */
+
+rt_void h_check(rt_SIMD_INFOX *info, rt_half *d, rt_real *f, rt_elem *e)
+{
+    rt_half *r = info->hf00 + HLF_Z * 3, *h, *g;
+    rt_si32 i, j, k, u, v;
+
+    f[0] = f[1] = f[2] = f[3] = 0;
+    e[0] = e[1] = e[2] = e[3] = 0;
+
+    for (k = 0; k < 8; k++)
+    {
+        j = t_hlfop[k];
+        h = r + HLF_Z * k;
+        g = d + HLF_Z * k;
+        for (i = 0; i < HLF_N; i++)
+        {
+            u = (h[i] & 0x7C00) == 0x7C00 && (h[i] & 0x3FF) ? -1 : h[i];
+            v = (g[i] & 0x7C00) == 0x7C00 && (g[i] & 0x3FF) ? -1 : g[i];
+            e[j] += u == v || (k == 7 && u >= 0 && v >= 0 && RT_ABS(u - v) <= 1);
+            f[j] += (g[i] & 0x7C00) == 0x7C00 ? 0 :
+                    RT_FABS(hlf_h2f(g[i])) / HLF_N;
+        }
+    }
+}
+
+rt_void c_test28(rt_SIMD_INFOX *info)
+{
+    rt_half *a = info->hf00, *b = a + HLF_Z, *c = b + HLF_Z;
+    rt_half *d = a + HLF_Z * 3;
+    rt_fp32 x, y, z;
+    rt_si32 i;
+
+    for (i = 0; i < HLF_N; i++)
+    {
+        x = hlf_h2f(a[i]);
+        y = hlf_h2f(b[i]);
+        z = hlf_h2f(c[i]);
+
+        d[HLF_Z * 0 + i] = hlf_f2h(x + y);
+        d[HLF_Z * 1 + i] = hlf_f2h(x - y);
+        d[HLF_Z * 2 + i] = hlf_f2h(x * y);
+        d[HLF_Z * 3 + i] = hlf_f2h(x / y);
+        d[HLF_Z * 4 + i] = hlf_f2h(x < y ? x : y);
+        d[HLF_Z * 5 + i] = hlf_f2h(x > y ? x : y);
+        d[HLF_Z * 6 + i] = hlf_f2h((rt_fp32)sqrt(x));
+        d[HLF_Z * 7 + i] = hlf_f2h(x * y + z);
+    }
+
+    h_check(info, d, info->frc0, info->irc0);
+}
+
+rt_void s_test28(rt_SIMD_INFOX *info)
+{
+    rt_SIMD_HALF *half = info->half;
+    rt_half *a = info->hf00, *b = a + HLF_Z, *c = b + HLF_Z;
+    rt_half *d = a + HLF_Z * 11;
+
+    hlf_add(half, d + HLF_Z * 0, a, b, HLF_N);
+    hlf_sub(half, d + HLF_Z * 1, a, b, HLF_N);
+    hlf_mul(half, d + HLF_Z * 2, a, b, HLF_N);
+    hlf_div(half, d + HLF_Z * 3, a, b, HLF_N);
+    hlf_min(half, d + HLF_Z * 4, a, b, HLF_N);
+    hlf_max(half, d + HLF_Z * 5, a, b, HLF_N);
+    hlf_sqr(half, d + HLF_Z * 6, a, HLF_N);
+    hlf_fma(half, d + HLF_Z * 7, a, b, c, HLF_N);
+
+    h_check(info, d, info->frs0, info->irs0);
+}
+
+rt_void p_test28(rt_SIMD_INFOX *info)
+{
+    p_results(info, "half");
+}
+
+#endif /* SUB_TEST 28 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 29   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 29
+
+/*
+ * half: fp16 reductions over consecutive segments of growing length (whole
+ * packets and remainders) of input a limited to |a| < 2 (no overflow),
+ * counts matching results (idx 0: sum with fp32 accumulation, idx 1: sum with
+ * fp16 per-lane accumulation, idx 2: min, idx 3: max) and their mean values,
+ * fp32 sums may differ by 2^-20 of the sum of |a| (order of additions),
+ * fp16 sums by 1 ulp (rounding of lane values), min/max are exact.
+ * Input is at hf00 + HLF_Z * 3, C results follow at 4, S results at 5,
+ * fp32 sums first, then fp16 sum, min, max (4 per segment), segments are
+ * copied to SIMD-aligned buffer at 6 for S.
+ */
+#define HLF_K(i, k)         ((k) = (i) * 37 + 1) /* length of segment i */
+
+rt_void h_input(rt_SIMD_INFOX *info)
+{
+    rt_half *a = info->hf00, *h = a + HLF_Z * 3;
+    rt_si32 i;
+
+    for (i = 0; i < HLF_N; i++)
+    {
+        h[i] = a[i] & 0xBFFF; /* clear top exponent bit */
+    }
+}
+
+rt_void h_rcheck(rt_SIMD_INFOX *info, rt_half *d, rt_real *f, rt_elem *e)
+{
+    rt_half *a = info->hf00 + HLF_Z * 3, *r = a + HLF_Z;
+    rt_fp32 *x = (rt_fp32 *)r, *y = (rt_fp32 *)d;
+    rt_half *u = r + 256, *v = d + 256;
+    rt_si32 i, j, k, n;
+    rt_fp32 t;
+
+    f[0] = f[1] = f[2] = f[3] = 0;
+    e[0] = e[1] = e[2] = e[3] = 0;
+
+    for (i = 0, n = 0; n + HLF_K(i, k) <= HLF_N; i++, n += k)
+    {
+        for (j = 0, t = 0; j < k; j++)
+        {
+            t += RT_FABS(hlf_h2f(a[n + j]));
+        }
+        e[0] += RT_FABS(y[i] - x[i]) <= t * (1.0f / 1048576.0f);
+        e[1] += RT_ABS((rt_si32)v[i*4+0] - (rt_si32)u[i*4+0]) <= 1;
+        e[2] += v[i*4+1] == u[i*4+1];
+        e[3] += v[i*4+2] == u[i*4+2];
+        f[0] += y[i] / 64;
+        f[1] += hlf_h2f(v[i*4+0]) / 64;
+        f[2] += hlf_h2f(v[i*4+1]) / 64;
+        f[3] += hlf_h2f(v[i*4+2]) / 64;
+    }
+}
+
+rt_void c_test29(rt_SIMD_INFOX *info)
+{
+    rt_half *a = info->hf00 + HLF_Z * 3, *d = a + HLF_Z;
+    rt_fp32 *x = (rt_fp32 *)d;
+    rt_half *u = d + 256, h[N], w;
+    rt_si32 i, j, k, l, n;
+    rt_fp64 s;
+
+    h_input(info);
+
+    for (i = 0, n = 0; n + HLF_K(i, k) <= HLF_N; i++, n += k)
+    {
+        for (j = 0, s = 0.0; j < k; j++)
+        {
+            s += hlf_h2f(a[n + j]);
+        }
+        x[i] = (rt_fp32)s;
+
+        for (j = 0, s = 0.0; j < k / N * N; j++)
+        {
+            l = j % N;
+            w = a[n + j];
+            h[l] = j < N ? w : hlf_f2h(hlf_h2f(h[l]) + hlf_h2f(w));
+        }
+        for (l = 0; l < N && j > 0; l++)
+        {
+            s += hlf_h2f(h[l]);
+        }
+        h[0] = hlf_f2h((rt_fp32)s);
+        for (; j < k; j++)
+        {
+            h[0] = hlf_f2h(hlf_h2f(h[0]) + hlf_h2f(a[n + j]));
+        }
+        u[i*4+0] = h[0];
+
+        u[i*4+1] = u[i*4+2] = a[n];
+        for (j = 1; j < k; j++)
+        {
+            w = a[n + j];
+            u[i*4+1] = hlf_h2f(w) < hlf_h2f(u[i*4+1]) ? w : u[i*4+1];
+            u[i*4+2] = hlf_h2f(w) > hlf_h2f(u[i*4+2]) ? w : u[i*4+2];
+        }
+    }
+
+    h_rcheck(info, d, info->frc0, info->irc0);
+}
+
+rt_void s_test29(rt_SIMD_INFOX *info)
+{
+    rt_SIMD_HALF *half = info->half;
+    rt_half *a = info->hf00 + HLF_Z * 3, *d = a + HLF_Z * 2;
+    rt_fp32 *y = (rt_fp32 *)d;
+    rt_half *v = d + 256, *b = d + HLF_Z;
+    rt_si32 i, k, n;
+
+    h_input(info);
+
+    for (i = 0, n = 0; n + HLF_K(i, k) <= HLF_N; i++, n += k)
+    {
+        memcpy(b, a + n, k * sizeof(rt_half));
+        y[i] = hlf_sum(half, b, k);
+        v[i*4+0] = hlf_smh(half, b, k);
+        v[i*4+1] = hlf_mnh(half, b, k);
+        v[i*4+2] = hlf_mxh(half, b, k);
+    }
+
+    h_rcheck(info, d, info->frs0, info->irs0);
+}
+
+rt_void p_test29(rt_SIMD_INFOX *info)
+{
+    p_results(info, "hrdx");
+}
+
+#endif /* SUB_TEST 29 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 30   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 30
+
+/*
+ * Shift values of farx by a into fary, zeros at odd indices become -0.0.
+ */
+rt_void t_zeros(rt_real *fary, rt_real *farx, rt_real a, rt_si32 n)
+{
+    rt_si32 j;
+    rt_real r;
+
+    for (j = 0; j < n; j++)
+    {
+        r = farx[j] + a;
+        fary[j] = r == 0.0 && j % 2 != 0 ? -r : r;
+    }
+}
+
+/*
+ * imin, imax, iminn, imaxn: calls with different head/tail sizes,
+ * inputs have many ties (first index is expected), fp inputs are made
+ * from far0 shifted so that its min/max become zeros of alternating sign
+ * in fco2/fso2, integer input is made from far1 in fso1 (rt_elem array).
+ */
+rt_void c_test30(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k, n = info->size - 5;
+    rt_real r;
+    rt_elem m;
+
+    rt_real *far1 = info->far1;
+    rt_real *fco2 = info->fco2;
+    rt_elem *irc0 = info->irc0;
+
+    t_zeros(fco2, info->far0, +(rt_real)50 / 16, info->size);
+    for (r = fco2[1], k = 0, j = 1; j < n; j++)
+    {
+        if (fco2[j + 1] < r)
+        {
+            r = fco2[j + 1];
+            k = j;
+        }
+    }
+    irc0[0] = k;
+
+    t_zeros(fco2, info->far0, -(rt_real)50 / 16, info->size);
+    for (r = fco2[3], k = 0, j = 1; j < n - 2; j++)
+    {
+        if (fco2[j + 3] > r)
+        {
+            r = fco2[j + 3];
+            k = j;
+        }
+    }
+    irc0[1] = k;
+
+    for (m = (rt_elem)(far1[2] * 32), k = 0, j = 1; j < n - 1; j++)
+    {
+        if ((rt_elem)(far1[j + 2] * 32) < m)
+        {
+            m = (rt_elem)(far1[j + 2] * 32);
+            k = j;
+        }
+    }
+    irc0[2] = k;
+
+    for (m = (rt_elem)(far1[1] * 32), k = 0, j = 1; j < S + 1; j++)
+    {
+        if ((rt_elem)(far1[j + 1] * 32) > m)
+        {
+            m = (rt_elem)(far1[j + 1] * 32);
+            k = j;
+        }
+    }
+    irc0[3] = k;
+}
+
+rt_void s_test30(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size - 5;
+    rt_SIMD_BLAS *blas = info->blas;
+    rt_elem *ints = (rt_elem *)info->fso1;
+
+    for (j = 0; j < info->size; j++)
+    {
+        ints[j] = (rt_elem)(info->far1[j] * 32);
+    }
+
+    t_zeros(info->fso2, info->far0, +(rt_real)50 / 16, info->size);
+    blas->x = info->fso2 + 1;
+    blas->size = n;
+    blas_imin(blas);
+    info->irs0[0] = blas->ridx[0];
+
+    t_zeros(info->fso2, info->far0, -(rt_real)50 / 16, info->size);
+    blas->x = info->fso2 + 3;
+    blas->size = n - 2;
+    blas_imax(blas);
+    info->irs0[1] = blas->ridx[0];
+
+    blas->x = (rt_real *)(ints + 2);
+    blas->size = n - 1;
+    blas_iminn(blas);
+    info->irs0[2] = blas->ridx[0];
+
+    blas->x = (rt_real *)(ints + 1);
+    blas->size = S + 1;
+    blas_imaxn(blas);
+    info->irs0[3] = blas->ridx[0];
+}
+
+rt_void p_test30(rt_SIMD_INFOX *info)
+{
+    p_results(info, "iarg");
+}
+
+#endif /* SUB_TEST 30 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 31   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 31
+
+/*
+ * srs: sort SRT_N/SRS_N slices of SRS_N rt_real keys and SRS_N - 7 rt_elem
+ * keys in place (copied from inputs), small sizes show per-call overhead,
+ * C reference is qsort, host reference is std::sort.
+ */
+rt_void c_test31(rt_SIMD_INFOX *info)
+{
+    rt_si32 j;
+
+    memcpy(info->kco0, info->kar0, SRT_N*sizeof(rt_real));
+    memcpy(info->jco0, info->jar0, SRT_N*sizeof(rt_elem));
+
+    for (j = 0; j < SRT_N; j += SRS_N)
+    {
+        qsort(info->kco0 + j, SRS_N, sizeof(rt_real), t_creal);
+        qsort(info->jco0 + j, SRS_N - 7, sizeof(rt_elem), t_celem);
+    }
+}
+
+rt_void s_test31(rt_SIMD_INFOX *info)
+{
+    rt_SIMD_SORT *sort = info->sort;
+    rt_si32 j;
+
+    memcpy(info->kso0, info->kar0, SRT_N*sizeof(rt_real));
+    memcpy(info->jso0, info->jar0, SRT_N*sizeof(rt_elem));
+
+    for (j = 0; j < SRT_N; j += SRS_N)
+    {
+        srt_real(sort, info->kso0 + j, RT_NULL, SRS_N);
+        srt_elem(sort, info->jso0 + j, RT_NULL, SRS_N - 7);
+    }
+}
+
+rt_void h_test31(rt_SIMD_INFOX *info)
+{
+    rt_si32 j;
+
+    memcpy(info->kho0, info->kar0, SRT_N*sizeof(rt_real));
+    memcpy(info->jho0, info->jar0, SRT_N*sizeof(rt_elem));
+
+    for (j = 0; j < SRT_N; j += SRS_N)
+    {
+        std::sort(info->kho0 + j, info->kho0 + j + SRS_N);
+        std::sort(info->jho0 + j, info->jho0 + j + SRS_N - 7);
+    }
+}
+
+rt_void p_test31(rt_SIMD_INFOX *info)
+{
+    p_sorted(info, "srs", RT_FALSE);
+}
+
+#endif /* SUB_TEST 31 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 32   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 32
+
+/*
+ * srl: sort SRL_N rt_real keys in place (copied from input), the largest
+ * size fitting into 32-bit address range of the tests along with the rest,
+ * inputs, C, S and H outputs are at kl00 + SRL_N * (0, 1, 2, 3),
+ * C reference is qsort, host reference is std::sort.
+ */
+rt_void c_test32(rt_SIMD_INFOX *info)
+{
+    rt_real *k = info->kl00;
+
+    memcpy(k + SRL_N * 1, k, SRL_N*sizeof(rt_real));
+    qsort(k + SRL_N * 1, SRL_N, sizeof(rt_real), t_creal);
+}
+
+rt_void s_test32(rt_SIMD_INFOX *info)
+{
+    rt_real *k = info->kl00;
+
+    memcpy(k + SRL_N * 2, k, SRL_N*sizeof(rt_real));
+    srt_real(info->sort, k + SRL_N * 2, RT_NULL, SRL_N);
+}
+
+rt_void h_test32(rt_SIMD_INFOX *info)
+{
+    rt_real *k = info->kl00;
+
+    memcpy(k + SRL_N * 3, k, SRL_N*sizeof(rt_real));
+    std::sort(k + SRL_N * 3, k + SRL_N * 4);
+}
+
+rt_void p_test32(rt_SIMD_INFOX *info)
+{
+    rt_si32 j;
+
+    rt_real *kco0 = info->kl00 + SRL_N * 1;
+    rt_real *kso0 = info->kl00 + SRL_N * 2;
+
+    j = SRL_N;
+    while (j-->0)
+    {
+        if (kco0[j] == kso0[j] && !v_mode)
+        {
+            continue;
+        }
+
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C srl: key[%d] = %e\n", j, kco0[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S srl: key[%d] = %e\n", j, kso0[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 32 */
+
+/******************************************************************************/
+/*********************************   TABLES   *********************************/
+/******************************************************************************/
+
+typedef rt_void (*testXX)(rt_SIMD_INFOX *);
+
+volatile
+testXX c_test[SUB_TEST] =
+{
+#if SUB_TEST >=  1
+    c_test01,
+#endif /* SUB_TEST  1 */
+
+#if SUB_TEST >=  2
+    c_test02,
+#endif /* SUB_TEST  2 */
+
+#if SUB_TEST >=  3
+    c_test03,
+#endif /* SUB_TEST  3 */
+
+#if SUB_TEST >=  4
+    c_test04,
+#endif /* SUB_TEST  4 */
+
+#if SUB_TEST >=  5
+    c_test05,
+#endif /* SUB_TEST  5 */
+
+#if SUB_TEST >=  6
+    c_test06,
+#endif /* SUB_TEST  6 */
+
+#if SUB_TEST >=  7
+    c_test07,
+#endif /* SUB_TEST  7 */
+
+#if SUB_TEST >=  8
+    c_test08,
+#endif /* SUB_TEST  8 */
+
+#if SUB_TEST >=  9
+    c_test09,
+#endif /* SUB_TEST  9 */
+
+#if SUB_TEST >= 10
+    c_test10,
+#endif /* SUB_TEST 10 */
+
+#if SUB_TEST >= 11
+    c_test11,
+#endif /* SUB_TEST 11 */
+
+#if SUB_TEST >= 12
+    c_test12,
+#endif /* SUB_TEST 12 */
+
+#if SUB_TEST >= 13
+    c_test13,
+#endif /* SUB_TEST 13 */
+
+#if SUB_TEST >= 14
+    c_test14,
+#endif /* SUB_TEST 14 */
+
+#if SUB_TEST >= 15
+    c_test15,
+#endif /* SUB_TEST 15 */
+
+#if SUB_TEST >= 16
+    c_test16,
+#endif /* SUB_TEST 16 */
+
+#if SUB_TEST >= 17
+    c_test17,
+#endif /* SUB_TEST 17 */
+
+#if SUB_TEST >= 18
+    c_test18,
+#endif /* SUB_TEST 18 */
+
+#if SUB_TEST >= 19
+    c_test19,
+#endif /* SUB_TEST 19 */
+
+#if SUB_TEST >= 20
+    c_test20,
+#endif /* SUB_TEST 20 */
+
+#if SUB_TEST >= 21
+    c_test21,
+#endif /* SUB_TEST 21 */
+
+#if SUB_TEST >= 22
+    c_test22,
+#endif /* SUB_TEST 22 */
+
+#if SUB_TEST >= 23
+    c_test23,
+#endif /* SUB_TEST 23 */
+
+#if SUB_TEST >= 24
+    c_test24,
+#endif /* SUB_TEST 24 */
+
+#if SUB_TEST >= 25
+    c_test25,
+#endif /* SUB_TEST 25 */
+
+#if SUB_TEST >= 26
+    c_test26,
+#endif /* SUB_TEST 26 */
+
+#if SUB_TEST >= 27
+    c_test27,
+#endif /* SUB_TEST 27 */
+
+#if SUB_TEST >= 28
+    c_test28,
+#endif /* SUB_TEST 28 */
+
+#if SUB_TEST >= 29
+    c_test29,
+#endif /* SUB_TEST 29 */
+
+#if SUB_TEST >= 30
+    c_test30,
+#endif /* SUB_TEST 30 */
+
+#if SUB_TEST >= 31
+    c_test31,
+#endif /* SUB_TEST 31 */
+
+#if SUB_TEST >= 32
+    c_test32,
+#endif /* SUB_TEST 32 */
+};
+
+volatile
+testXX s_test[SUB_TEST] =
+{
+#if SUB_TEST >=  1
+    s_test01,
+#endif /* SUB_TEST  1 */
+
+#if SUB_TEST >=  2
+    s_test02,
+#endif /* SUB_TEST  2 */
+
+#if SUB_TEST >=  3
+    s_test03,
+#endif /* SUB_TEST  3 */
+
+#if SUB_TEST >=  4
+    s_test04,
+#endif /* SUB_TEST  4 */
+
+#if SUB_TEST >=  5
+    s_test05,
+#endif /* SUB_TEST  5 */
+
+#if SUB_TEST >=  6
+    s_test06,
+#endif /* SUB_TEST  6 */
+
+#if SUB_TEST >=  7
+    s_test07,
+#endif /* SUB_TEST  7 */
+
+#if SUB_TEST >=  8
+    s_test08,
+#endif /* SUB_TEST  8 */
+
+#if SUB_TEST >=  9
+    s_test09,
+#endif /* SUB_TEST  9 */
+
+#if SUB_TEST >= 10
+    s_test10,
+#endif /* SUB_TEST 10 */
+
+#if SUB_TEST >= 11
+    s_test11,
+#endif /* SUB_TEST 11 */
+
+#if SUB_TEST >= 12
+    s_test12,
+#endif /* SUB_TEST 12 */
+
+#if SUB_TEST >= 13
+    s_test13,
+#endif /* SUB_TEST 13 */
+
+#if SUB_TEST >= 14
+    s_test14,
+#endif /* SUB_TEST 14 */
+
+#if SUB_TEST >= 15
+    s_test15,
+#endif /* SUB_TEST 15 */
+
+#if SUB_TEST >= 16
+    s_test16,
+#endif /* SUB_TEST 16 */
+
+#if SUB_TEST >= 17
+    s_test17,
+#endif /* SUB_TEST 17 */
+
+#if SUB_TEST >= 18
+    s_test18,
+#endif /* SUB_TEST 18 */
+
+#if SUB_TEST >= 19
+    s_test19,
+#endif /* SUB_TEST 19 */
+
+#if SUB_TEST >= 20
+    s_test20,
+#endif /* SUB_TEST 20 */
+
+#if SUB_TEST >= 21
+    s_test21,
+#endif /* SUB_TEST 21 */
+
+#if SUB_TEST >= 22
+    s_test22,
+#endif /* SUB_TEST 22 */
+
+#if SUB_TEST >= 23
+    s_test23,
+#endif /* SUB_TEST 23 */
+
+#if SUB_TEST >= 24
+    s_test24,
+#endif /* SUB_TEST 24 */
+
+#if SUB_TEST >= 25
+    s_test25,
+#endif /* SUB_TEST 25 */
+
+#if SUB_TEST >= 26
+    s_test26,
+#endif /* SUB_TEST 26 */
+
+#if SUB_TEST >= 27
+    s_test27,
+#endif /* SUB_TEST 27 */
+
+#if SUB_TEST >= 28
+    s_test28,
+#endif /* SUB_TEST 28 */
+
+#if SUB_TEST >= 29
+    s_test29,
+#endif /* SUB_TEST 29 */
+
+#if SUB_TEST >= 30
+    s_test30,
+#endif /* SUB_TEST 30 */
+
+#if SUB_TEST >= 31
+    s_test31,
+#endif /* SUB_TEST 31 */
+
+#if SUB_TEST >= 32
+    s_test32,
+#endif /* SUB_TEST 32 */
+};
+
+volatile
+testXX p_test[SUB_TEST] =
+{
+#if SUB_TEST >=  1
+    p_test01,
+#endif /* SUB_TEST  1 */
+
+#if SUB_TEST >=  2
+    p_test02,
+#endif /* SUB_TEST  2 */
+
+#if SUB_TEST >=  3
+    p_test03,
+#endif /* SUB_TEST  3 */
+
+#if SUB_TEST >=  4
+    p_test04,
+#endif /* SUB_TEST  4 */
+
+#if SUB_TEST >=  5
+    p_test05,
+#endif /* SUB_TEST  5 */
+
+#if SUB_TEST >=  6
+    p_test06,
+#endif /* SUB_TEST  6 */
+
+#if SUB_TEST >=  7
+    p_test07,
+#endif /* SUB_TEST  7 */
+
+#if SUB_TEST >=  8
+    p_test08,
+#endif /* SUB_TEST  8 */
+
+#if SUB_TEST >=  9
+    p_test09,
+#endif /* SUB_TEST  9 */
+
+#if SUB_TEST >= 10
+    p_test10,
+#endif /* SUB_TEST 10 */
+
+#if SUB_TEST >= 11
+    p_test11,
+#endif /* SUB_TEST 11 */
+
+#if SUB_TEST >= 12
+    p_test12,
+#endif /* SUB_TEST 12 */
+
+#if SUB_TEST >= 13
+    p_test13,
+#endif /* SUB_TEST 13 */
+
+#if SUB_TEST >= 14
+    p_test14,
+#endif /* SUB_TEST 14 */
+
+#if SUB_TEST >= 15
+    p_test15,
+#endif /* SUB_TEST 15 */
+
+#if SUB_TEST >= 16
+    p_test16,
+#endif /* SUB_TEST 16 */
+
+#if SUB_TEST >= 17
+    p_test17,
+#endif /* SUB_TEST 17 */
+
+#if SUB_TEST >= 18
+    p_test18,
+#endif /* SUB_TEST 18 */
+
+#if SUB_TEST >= 19
+    p_test19,
+#endif /* SUB_TEST 19 */
+
+#if SUB_TEST >= 20
+    p_test20,
+#endif /* SUB_TEST 20 */
+
+#if SUB_TEST >= 21
+    p_test21,
+#endif /* SUB_TEST 21 */
+
+#if SUB_TEST >= 22
+    p_test22,
+#endif /* SUB_TEST 22 */
+
+#if SUB_TEST >= 23
+    p_test23,
+#endif /* SUB_TEST 23 */
+
+#if SUB_TEST >= 24
+    p_test24,
+#endif /* SUB_TEST 24 */
+
+#if SUB_TEST >= 25
+    p_test25,
+#endif /* SUB_TEST 25 */
+
+#if SUB_TEST >= 26
+    p_test26,
+#endif /* SUB_TEST 26 */
+
+#if SUB_TEST >= 27
+    p_test27,
+#endif /* SUB_TEST 27 */
+
+#if SUB_TEST >= 28
+    p_test28,
+#endif /* SUB_TEST 28 */
+
+#if SUB_TEST >= 29
+    p_test29,
+#endif /* SUB_TEST 29 */
+
+#if SUB_TEST >= 30
+    p_test30,
+#endif /* SUB_TEST 30 */
+
+#if SUB_TEST >= 31
+    p_test31,
+#endif /* SUB_TEST 31 */
+
+#if SUB_TEST >= 32
+    p_test32,
+#endif /* SUB_TEST 32 */
+};
+
+/* host library references, timed separately if available */
+volatile
+testXX h_test[SUB_TEST] =
+{
+#if SUB_TEST >=  1
+    RT_NULL,
+#endif /* SUB_TEST  1 */
+
+#if SUB_TEST >=  2
+    RT_NULL,
+#endif /* SUB_TEST  2 */
+
+#if SUB_TEST >=  3
+    RT_NULL,
+#endif /* SUB_TEST  3 */
+
+#if SUB_TEST >=  4
+    RT_NULL,
+#endif /* SUB_TEST  4 */
+
+#if SUB_TEST >=  5
+    RT_NULL,
+#endif /* SUB_TEST  5 */
+
+#if SUB_TEST >=  6
+    RT_NULL,
+#endif /* SUB_TEST  6 */
+
+#if SUB_TEST >=  7
+#ifdef RT_HOST_BLAS
+    h_test07,
+#else  /* RT_HOST_BLAS */
+    RT_NULL,
+#endif /* RT_HOST_BLAS */
+#endif /* SUB_TEST  7 */
+
+#if SUB_TEST >=  8
+    RT_NULL,
+#endif /* SUB_TEST  8 */
+
+#if SUB_TEST >=  9
+    RT_NULL,
+#endif /* SUB_TEST  9 */
+
+#if SUB_TEST >= 10
+    RT_NULL,
+#endif /* SUB_TEST 10 */
+
+#if SUB_TEST >= 11
+    RT_NULL,
+#endif /* SUB_TEST 11 */
+
+#if SUB_TEST >= 12
+    RT_NULL,
+#endif /* SUB_TEST 12 */
+
+#if SUB_TEST >= 13
+    RT_NULL,
+#endif /* SUB_TEST 13 */
+
+#if SUB_TEST >= 14
+    RT_NULL,
+#endif /* SUB_TEST 14 */
+
+#if SUB_TEST >= 15
+    h_test15,
+#endif /* SUB_TEST 15 */
+
+#if SUB_TEST >= 16
+    h_test16,
+#endif /* SUB_TEST 16 */
+
+#if SUB_TEST >= 17
+    h_test17,
+#endif /* SUB_TEST 17 */
+
+#if SUB_TEST >= 18
+    h_test18,
+#endif /* SUB_TEST 18 */
+
+#if SUB_TEST >= 19
+    RT_NULL,
+#endif /* SUB_TEST 19 */
+
+#if SUB_TEST >= 20
+    RT_NULL,
+#endif /* SUB_TEST 20 */
+
+#if SUB_TEST >= 21
+    RT_NULL,
+#endif /* SUB_TEST 21 */
+
+#if SUB_TEST >= 22
+    RT_NULL,
+#endif /* SUB_TEST 22 */
+
+#if SUB_TEST >= 23
+    RT_NULL,
+#endif /* SUB_TEST 23 */
+
+#if SUB_TEST >= 24
+    RT_NULL,
+#endif /* SUB_TEST 24 */
+
+#if SUB_TEST >= 25
+    RT_NULL,
+#endif /* SUB_TEST 25 */
+
+#if SUB_TEST >= 26
+    RT_NULL,
+#endif /* SUB_TEST 26 */
+
+#if SUB_TEST >= 27
+    RT_NULL,
+#endif /* SUB_TEST 27 */
+
+#if SUB_TEST >= 28
+    RT_NULL,
+#endif /* SUB_TEST 28 */
+
+#if SUB_TEST >= 29
+    RT_NULL,
+#endif /* SUB_TEST 29 */
+
+#if SUB_TEST >= 30
+    RT_NULL,
+#endif /* SUB_TEST 30 */
+
+#if SUB_TEST >= 31
+    h_test31,
+#endif /* SUB_TEST 31 */
+
+#if SUB_TEST >= 32
+    h_test32,
+#endif /* SUB_TEST 32 */
+};
+
+/* cycle divisors for heavy subtests (applied to test-redundant counter),
+ * number of fp-operations per cycle for GFLOP/s printouts (or 0)
+ * and number of ray queries per cycle for Mrays/s printouts (or 0) */
+rt_si32 d_test[SUB_TEST] =
+{
+#if SUB_TEST >=  1
+    1,
+#endif /* SUB_TEST  1 */
+
+#if SUB_TEST >=  2
+    1,
+#endif /* SUB_TEST  2 */
+
+#if SUB_TEST >=  3
+    1,
+#endif /* SUB_TEST  3 */
+
+#if SUB_TEST >=  4
+    1,
+#endif /* SUB_TEST  4 */
+
+#if SUB_TEST >=  5
+    1,
+#endif /* SUB_TEST  5 */
+
+#if SUB_TEST >=  6
+    1,
+#endif /* SUB_TEST  6 */
+
+#if SUB_TEST >=  7
+    1000,
+#endif /* SUB_TEST  7 */
+
+#if SUB_TEST >=  8
+    1000,
+#endif /* SUB_TEST  8 */
+
+#if SUB_TEST >=  9
+    100,
+#endif /* SUB_TEST  9 */
+
+#if SUB_TEST >= 10
+    10,
+#endif /* SUB_TEST 10 */
+
+#if SUB_TEST >= 11
+    10000,
+#endif /* SUB_TEST 11 */
+
+#if SUB_TEST >= 12
+    10000,
+#endif /* SUB_TEST 12 */
+
+#if SUB_TEST >= 13
+    10,
+#endif /* SUB_TEST 13 */
+
+#if SUB_TEST >= 14
+    10,
+#endif /* SUB_TEST 14 */
+
+#if SUB_TEST >= 15
+    10000,
+#endif /* SUB_TEST 15 */
+
+#if SUB_TEST >= 16
+    10000,
+#endif /* SUB_TEST 16 */
+
+#if SUB_TEST >= 17
+    1000,
+#endif /* SUB_TEST 17 */
+
+#if SUB_TEST >= 18
+    1000,
+#endif /* SUB_TEST 18 */
+
+#if SUB_TEST >= 19
+    100,
+#endif /* SUB_TEST 19 */
+
+#if SUB_TEST >= 20
+    100,
+#endif /* SUB_TEST 20 */
+
+#if SUB_TEST >= 21
+    100,
+#endif /* SUB_TEST 21 */
+
+#if SUB_TEST >= 22
+    100,
+#endif /* SUB_TEST 22 */
+
+#if SUB_TEST >= 23
+    1000,
+#endif /* SUB_TEST 23 */
+
+#if SUB_TEST >= 24
+    10,
+#endif /* SUB_TEST 24 */
+
+#if SUB_TEST >= 25
+    1,
+#endif /* SUB_TEST 25 */
+
+#if SUB_TEST >= 26
+    1,
+#endif /* SUB_TEST 26 */
+
+#if SUB_TEST >= 27
+    1,
+#endif /* SUB_TEST 27 */
+
+#if SUB_TEST >= 28
+    1,
+#endif /* SUB_TEST 28 */
+
+#if SUB_TEST >= 29
+    1,
+#endif /* SUB_TEST 29 */
+
+#if SUB_TEST >= 30
+    1,
+#endif /* SUB_TEST 30 */
+
+#if SUB_TEST >= 31
+    10000,
+#endif /* SUB_TEST 31 */
+
+#if SUB_TEST >= 32
+    10000,
+#endif /* SUB_TEST 32 */
+};
+
+rt_fp64 f_test[SUB_TEST] =
+{
+#if SUB_TEST >=  1
+    2.0 * (ARR_SIZE - 5) + 2.0 * (ARR_SIZE - 6),
+#endif /* SUB_TEST  1 */
+
+#if SUB_TEST >=  2
+    2.0 * (ARR_SIZE - 5) + 2.0 * (ARR_SIZE - 6) + 2.0 * (S + 3),
+#endif /* SUB_TEST  2 */
+
+#if SUB_TEST >=  3
+    0.0,
+#endif /* SUB_TEST  3 */
+
+#if SUB_TEST >=  4
+    0.0,
+#endif /* SUB_TEST  4 */
+
+#if SUB_TEST >=  5
+    0.0,
+#endif /* SUB_TEST  5 */
+
+#if SUB_TEST >=  6
+    0.0,
+#endif /* SUB_TEST  6 */
+
+#if SUB_TEST >=  7
+    2.0 * GMM_M * GMM_N * GMM_K,
+#endif /* SUB_TEST  7 */
+
+#if SUB_TEST >=  8
+    0.0,
+#endif /* SUB_TEST  8 */
+
+#if SUB_TEST >=  9
+    2.0 * FIR_T1 * ARR_SIZE + 2.0 * FIR_T2 * ARR_SIZE,
+#endif /* SUB_TEST  9 */
+
+#if SUB_TEST >= 10
+    2.0 * 9.0 * BQD_S * (ARR_SIZE / BQD_C * BQD_C),
+#endif /* SUB_TEST 10 */
+
+#if SUB_TEST >= 11
+    0.0,
+#endif /* SUB_TEST 11 */
+
+#if SUB_TEST >= 12
+    0.0,
+#endif /* SUB_TEST 12 */
+
+#if SUB_TEST >= 13
+    5.0 * FFT_N * 10 * 2 + 5.0 * FFT_S * 6,
+#endif /* SUB_TEST 13 */
+
+#if SUB_TEST >= 14
+    2.5 * FFT_N * 2 * 11 * 2,
+#endif /* SUB_TEST 14 */
+
+#if SUB_TEST >= 15
+    0.0,
+#endif /* SUB_TEST 15 */
+
+#if SUB_TEST >= 16
+    0.0,
+#endif /* SUB_TEST 16 */
+
+#if SUB_TEST >= 17
+    0.0,
+#endif /* SUB_TEST 17 */
+
+#if SUB_TEST >= 18
+    0.0,
+#endif /* SUB_TEST 18 */
+
+#if SUB_TEST >= 19
+    0.0,
+#endif /* SUB_TEST 19 */
+
+#if SUB_TEST >= 20
+    0.0,
+#endif /* SUB_TEST 20 */
+
+#if SUB_TEST >= 21
+    0.0,
+#endif /* SUB_TEST 21 */
+
+#if SUB_TEST >= 22
+    0.0,
+#endif /* SUB_TEST 22 */
+
+#if SUB_TEST >= 23
+    0.0,
+#endif /* SUB_TEST 23 */
+
+#if SUB_TEST >= 24
+    0.0,
+#endif /* SUB_TEST 24 */
+
+#if SUB_TEST >= 25
+    0.0,
+#endif /* SUB_TEST 25 */
+
+#if SUB_TEST >= 26
+    0.0,
+#endif /* SUB_TEST 26 */
+
+#if SUB_TEST >= 27
+    0.0,
+#endif /* SUB_TEST 27 */
+
+#if SUB_TEST >= 28
+    0.0,
+#endif /* SUB_TEST 28 */
+
+#if SUB_TEST >= 29
+    0.0,
+#endif /* SUB_TEST 29 */
+
+#if SUB_TEST >= 30
+    0.0,
+#endif /* SUB_TEST 30 */
+
+#if SUB_TEST >= 31
+    0.0,
+#endif /* SUB_TEST 31 */
+
+#if SUB_TEST >= 32
+    0.0,
+#endif /* SUB_TEST 32 */
+};
+
+rt_fp64 m_test[SUB_TEST] =
+{
+#if SUB_TEST >=  1
+    0.0,
+#endif /* SUB_TEST  1 */
+
+#if SUB_TEST >=  2
+    0.0,
+#endif /* SUB_TEST  2 */
+
+#if SUB_TEST >=  3
+    0.0,
+#endif /* SUB_TEST  3 */
+
+#if SUB_TEST >=  4
+    0.0,
+#endif /* SUB_TEST  4 */
+
+#if SUB_TEST >=  5
+    0.0,
+#endif /* SUB_TEST  5 */
+
+#if SUB_TEST >=  6
+    0.0,
+#endif /* SUB_TEST  6 */
+
+#if SUB_TEST >=  7
+    0.0,
+#endif /* SUB_TEST  7 */
+
+#if SUB_TEST >=  8
+    0.0,
+#endif /* SUB_TEST  8 */
+
+#if SUB_TEST >=  9
+    0.0,
+#endif /* SUB_TEST  9 */
+
+#if SUB_TEST >= 10
+    0.0,
+#endif /* SUB_TEST 10 */
+
+#if SUB_TEST >= 11
+    0.0,
+#endif /* SUB_TEST 11 */
+
+#if SUB_TEST >= 12
+    0.0,
+#endif /* SUB_TEST 12 */
+
+#if SUB_TEST >= 13
+    0.0,
+#endif /* SUB_TEST 13 */
+
+#if SUB_TEST >= 14
+    0.0,
+#endif /* SUB_TEST 14 */
+
+#if SUB_TEST >= 15
+    0.0,
+#endif /* SUB_TEST 15 */
+
+#if SUB_TEST >= 16
+    0.0,
+#endif /* SUB_TEST 16 */
+
+#if SUB_TEST >= 17
+    0.0,
+#endif /* SUB_TEST 17 */
+
+#if SUB_TEST >= 18
+    0.0,
+#endif /* SUB_TEST 18 */
+
+#if SUB_TEST >= 19
+    0.0,
+#endif /* SUB_TEST 19 */
+
+#if SUB_TEST >= 20
+    0.0,
+#endif /* SUB_TEST 20 */
+
+#if SUB_TEST >= 21
+    0.0,
+#endif /* SUB_TEST 21 */
+
+#if SUB_TEST >= 22
+    2.0 * RAY_N + RAY_R,
+#endif /* SUB_TEST 22 */
+
+#if SUB_TEST >= 23
+    0.0,
+#endif /* SUB_TEST 23 */
+
+#if SUB_TEST >= 24
+    0.0,
+#endif /* SUB_TEST 24 */
+
+#if SUB_TEST >= 25
+    0.0,
+#endif /* SUB_TEST 25 */
+
+#if SUB_TEST >= 26
+    0.0,
+#endif /* SUB_TEST 26 */
+
+#if SUB_TEST >= 27
+    0.0,
+#endif /* SUB_TEST 27 */
+
+#if SUB_TEST >= 28
+    0.0,
+#endif /* SUB_TEST 28 */
+
+#if SUB_TEST >= 29
+    0.0,
+#endif /* SUB_TEST 29 */
+
+#if SUB_TEST >= 30
+    0.0,
+#endif /* SUB_TEST 30 */
+
+#if SUB_TEST >= 31
+    0.0,
+#endif /* SUB_TEST 31 */
+
+#if SUB_TEST >= 32
+    0.0,
+#endif /* SUB_TEST 32 */
+};
+
+/******************************************************************************/
+/**********************************   MAIN   **********************************/
+/******************************************************************************/
+
+#undef sregs_sa /* turn off SIMD-regs instruction definitions */
+#undef sregs_la /* turn off SIMD-regs instruction definitions */
+
+#define sregs_sa() /* empty SIMD-regs instruction definitions */
+#define sregs_la() /* empty SIMD-regs instruction definitions */
+
+/*
+ * When ASM sections are used together with non-trivial logic written in C/C++
+ * in the same function, optimizing compilers may produce inconsistent results
+ * with optimization levels higher than O0 (tested both clang and g++).
+ * Using separate functions for ASM and C/C++ resolves the issue
+ * if the ASM function is not inlined (thus calling it via function pointer).
+ */
+rt_void simd_version(rt_SIMD_INFOX *s_inf)
+{
+    ASM_ENTER(s_inf)
+        verxx_xx()
+    ASM_LEAVE(s_inf)
+}
+
+volatile
+testXX v_simd = simd_version;
+
+/*
+ * info - info original pointer
+ * inf0 - info aligned pointer
+ * marr - memory original pointer
+ * mar0 - memory aligned pointer
+ *
+ * far0 - float aligned input 0
+ * far1 - float aligned input 1
+ * fco1 - float aligned C out 1
+ * fco2 - float aligned C out 2
+ * fso1 - float aligned S out 1
+ * fso2 - float aligned S out 2
+ *
+ * frc0 - float C results
+ * frs0 - float S results
+ * irc0 - int C results
+ * irs0 - int S results
+ *
+ * mmat - matrix original pointer
+ * mat0 - matrix A (GMM_M x GMM_K)
+ * mat1 - matrix B (GMM_K x GMM_N)
+ * mci0 - matrix C initial values
+ * mco0 - matrix C out C
+ * mso0 - matrix C out S
+ * mho0 - matrix C out H (host library)
+ *
+ * mtrn - transpose original pointer
+ * tsrc - transpose source (TRN_B x TRN_R x TRN_C)
+ * tco0 - transpose out C (TRN_B x TRN_C x TRN_R)
+ * tso0 - transpose out S (TRN_B x TRN_C x TRN_R)
+ *
+ * blas - BLAS original pointer
+ * bls0 - BLAS aligned pointer
+ * gemm - GEMM original pointer
+ * gmm0 - GEMM aligned pointer
+ * wgmm - GEMM work original pointer
+ * trns - transpose original pointer
+ * trn0 - transpose aligned pointer
+ *
+ * msgl - single precision original pointer
+ * sar0 - single aligned input 0
+ * sco1 - single aligned C out 1
+ * sco2 - single aligned C out 2
+ * sso1 - single aligned S out 1
+ * sso2 - single aligned S out 2
+ *
+ * firf - FIR original pointer
+ * fir0 - FIR aligned pointer
+ * wfir - FIR work original pointer
+ * biqd - biquad original pointer
+ * bqd0 - biquad aligned pointer
+ * wbqd - biquad work original pointer
+ *
+ * mimg - image planes original pointer
+ * isrc - image source (IMG_W x IMG_H)
+ * ico1 - image C out 1
+ * ico2 - image C out 2
+ * iso1 - image S out 1
+ * iso2 - image S out 2
+ *
+ * imgf - image filter original pointer
+ * img0 - image filter aligned pointer
+ * wimg - image filter work original pointer
+ *
+ * fftl - FFT long plan original pointer
+ * ffl0 - FFT long plan aligned pointer
+ * wffl - FFT long plan work original pointer
+ * ffts - FFT short plan original pointer
+ * ffs0 - FFT short plan aligned pointer
+ * wffs - FFT short plan work original pointer
+ *
+ * msrt - sort arrays original pointer
+ * kar0 - sort rt_real keys input
+ * kco0 - sort rt_real keys C out
+ * kso0 - sort rt_real keys S out
+ * kho0 - sort rt_real keys H out (host library)
+ * jar0 - sort rt_elem keys input
+ * jco0 - sort rt_elem keys C out
+ * jso0 - sort rt_elem keys S out
+ * jho0 - sort rt_elem keys H out (host library)
+ * vco0 - sort payload C out
+ * vso0 - sort payload S out
+ * vho0 - sort payload H out (host library)
+ *
+ * sort - sort original pointer
+ * srt0 - sort aligned pointer
+ * wsrt - sort work original pointer
+ *
+ * msrl - large sort arrays original pointer
+ * kl00 - large sort rt_real keys (input, C, S and H outs)
+ *
+ * mscn - scan buffer original pointer
+ * text - scan buffer aligned pointer (text log, zero-terminated)
+ *
+ * scan - scan original pointer
+ * scn0 - scan aligned pointer
+ *
+ * mhst - histogram arrays original pointer
+ * hr00 - histogram rt_real uniform input
+ * hr01 - histogram rt_real skewed input
+ * hco0 - histogram C out
+ * hso0 - histogram S out
+ * hw00 - histogram rt_ui16 uniform input
+ * hw01 - histogram rt_ui16 skewed input
+ * hb00 - histogram rt_ui08 uniform input
+ * hb01 - histogram rt_ui08 skewed input
+ *
+ * hist - histogram original pointer
+ * hst0 - histogram aligned pointer
+ * whst - histogram work original pointer
+ *
+ * mhsh - hash arrays original pointer
+ * hk64 - hash rt_ui64 keys
+ * hc64 - hash rt_ui64 C out
+ * hs64 - hash rt_ui64 S out
+ * hk32 - hash rt_ui32 keys
+ * hc32 - hash rt_ui32 C out
+ * hs32 - hash rt_ui32 S out
+ *
+ * hash - hash original pointer
+ * hsh0 - hash aligned pointer
+ * whsh - hash work original pointer
+ *
+ * mray - rays arrays original pointer
+ * ro00 - rays origins (AoS)
+ * rd00 - rays directions (AoS)
+ * rt00 - rays triangles (AoS)
+ * rb00 - rays boxes (AoS)
+ * rn00 - rays node boxes (AoS)
+ * rpkt - rays packets (SIMD)
+ * rtri - rays triangles (SIMD)
+ * rbox - rays boxes (SIMD)
+ * rnod - rays nodes (SIMD)
+ * rhit - rays node hits (SIMD)
+ *
+ * rays - rays original pointer
+ * ray0 - rays aligned pointer
+ *
+ * mbvh - bvh boxes original pointer
+ * bv00 - bvh boxes (AoS)
+ *
+ * bvhs - bvh original pointer
+ * bvh0 - bvh aligned pointer
+ * wbvh - bvh work original pointer
+ *
+ * mvcm - vecm arrays original pointer
+ * vm00 - vecm inputs/outputs (AoS)
+ * vp00 - vecm inputs/outputs (SIMD)
+ *
+ * vecm - vecm original pointer
+ * vcm0 - vecm aligned pointer
+ *
+ * poly - poly original pointer
+ * ply0 - poly aligned pointer
+ *
+ * mksm - ksum arrays original pointer
+ * ks00 - ksum arrays (x, y, misaligned y, references)
+ *
+ * mqud - quad arrays original pointer
+ * qd00 - quad arrays (packed inputs, C and S outputs)
+ *
+ * quad - quad original pointer
+ * qud0 - quad aligned pointer
+ *
+ * mhlf - half arrays original pointer
+ * hf00 - half arrays (inputs, C and S outputs)
+ *
+ * half - half original pointer
+ * hlf0 - half aligned pointer
+ */
+rt_si32 main(rt_si32 argc, rt_char *argv[])
+{
+    rt_si32 k, l, r, t;
+
+    if (argc >= 2)
+    {
+        RT_LOGI("--------------------------------------------------------\n");
+        RT_LOGI("Usage options are given below:\n");
+        RT_LOGI(" -b n, specify subtest # at which testing begins, n >= 1\n");
+        RT_LOGI(" -e n, specify subtest # at which testing ends, n <= max\n");
+        RT_LOGI(" -d n, override diff-threshold for qualification, n >= 0\n");
+        RT_LOGI(" -c n, override counter of redundant test cycles, n >= 1\n");
+        RT_LOGI(" -v, enable verbose mode, always print values from tests\n");
+        RT_LOGI("all options can be used together\n");
+        RT_LOGI("--------------------------------------------------------\n");
+    }
+
+    for (k = 1; k < argc; k++)
+    {
+        if (k < argc && strcmp(argv[k], "-b") == 0 && ++k < argc)
+        {
+            for (l = strlen(argv[k]), r = 1, t = 0; l > 0; l--, r *= 10)
+            {
+                t += (argv[k][l-1] - '0') * r;
+            }
+            if (t >= 1 && t <= SUB_TEST)
+            {
+                RT_LOGI("Subtest-index-init overridden: %d\n", t);
+                n_init = t-1;
+            }
+            else
+            {
+                RT_LOGI("Subtest-index-init value out of range\n");
+                return 0;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-e") == 0 && ++k < argc)
+        {
+            for (l = strlen(argv[k]), r = 1, t = 0; l > 0; l--, r *= 10)
+            {
+                t += (argv[k][l-1] - '0') * r;
+            }
+            if (t >= 1 && t <= SUB_TEST)
+            {
+                RT_LOGI("Subtest-index-done overridden: %d\n", t);
+                n_done = t-1;
+            }
+            else
+            {
+                RT_LOGI("Subtest-index-done value out of range\n");
+                return 0;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-d") == 0 && ++k < argc)
+        {
+            for (l = strlen(argv[k]), r = 1, t = 0; l > 0; l--, r *= 10)
+            {
+                t += (argv[k][l-1] - '0') * r;
+            }
+            if (t >= 0)
+            {
+                RT_LOGI("Diff-threshold overridden: %d\n", t);
+                t_diff = t;
+            }
+            else
+            {
+                RT_LOGI("Diff-threshold value out of range\n");
+                return 0;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-c") == 0 && ++k < argc)
+        {
+            for (l = strlen(argv[k]), r = 1, t = 0; l > 0; l--, r *= 10)
+            {
+                t += (argv[k][l-1] - '0') * r;
+            }
+            if (t >= 1)
+            {
+                RT_LOGI("Test-redundant overridden: %d\n", t);
+                r_test = t;
+            }
+            else
+            {
+                RT_LOGI("Test-redundant value out of range\n");
+                return 0;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-v") == 0 && !v_mode)
+        {
+            v_mode = RT_TRUE;
+            RT_LOGI("Verbose mode enabled\n");
+        }
+    }
+
+    rt_pntr marr = sys_alloc(6*ARR_SIZE*sizeof(rt_real) + MASK);
+    memset(marr, 0, 6*ARR_SIZE*sizeof(rt_real) + MASK);
+    rt_pntr mar0 = (rt_pntr)(((rt_full)marr + MASK) & ~MASK);
+
+    rt_real *far0 = (rt_real *)mar0 + ARR_SIZE*0x0;
+    rt_real *far1 = (rt_real *)mar0 + ARR_SIZE*0x1;
+    rt_real *fco1 = (rt_real *)mar0 + ARR_SIZE*0x2;
+    rt_real *fco2 = (rt_real *)mar0 + ARR_SIZE*0x3;
+    rt_real *fso1 = (rt_real *)mar0 + ARR_SIZE*0x4;
+    rt_real *fso2 = (rt_real *)mar0 + ARR_SIZE*0x5;
+
+    /* inputs are small multiples of powers of 2 with many repeating values,
+     * thus sums are mostly exact regardless of the order of operations */
+    for (k = 0; k < ARR_SIZE; k++)
+    {
+        far0[k] = (rt_real)((k * 37 + 11) % 101 - 50) / 16;
+        far1[k] = (rt_real)((k * 53 +  7) %  97 - 48) / 32;
+    }
+
+    rt_size gmsz = GMM_M*GMM_K + GMM_K*GMM_N + 4*GMM_M*GMM_N;
+
+    rt_pntr mmat = sys_alloc(gmsz*sizeof(rt_real) + MASK);
+    rt_real *mat0 = (rt_real *)(((rt_full)mmat + MASK) & ~MASK);
+    rt_real *mat1 = mat0 + GMM_M*GMM_K;
+    rt_real *mci0 = mat1 + GMM_K*GMM_N;
+    rt_real *mco0 = mci0 + GMM_M*GMM_N;
+    rt_real *mso0 = mco0 + GMM_M*GMM_N;
+    rt_real *mho0 = mso0 + GMM_M*GMM_N;
+
+    for (k = 0; k < GMM_M*GMM_K; k++)
+    {
+        mat0[k] = (rt_real)((k * 29 +  3) % 89 - 44) / 16;
+    }
+    for (k = 0; k < GMM_K*GMM_N; k++)
+    {
+        mat1[k] = (rt_real)((k * 41 +  5) % 83 - 41) / 16;
+    }
+    for (k = 0; k < GMM_M*GMM_N; k++)
+    {
+        mci0[k] = (rt_real)((k * 17 + 13) % 79 - 39) / 32;
+    }
+
+    rt_size tnsz = 3*TRN_B*TRN_R*TRN_C;
+
+    rt_pntr mtrn = sys_alloc(tnsz*sizeof(rt_ui32) + MASK);
+    rt_ui32 *tsrc = (rt_ui32 *)(((rt_full)mtrn + MASK) & ~MASK);
+    rt_ui32 *tco0 = tsrc + TRN_B*TRN_R*TRN_C;
+    rt_ui32 *tso0 = tco0 + TRN_B*TRN_R*TRN_C;
+
+    for (k = 0; k < TRN_B*TRN_R*TRN_C; k++)
+    {
+        tsrc[k] = (rt_ui32)k * 2654435761U;
+    }
+
+    rt_pntr msgl = sys_alloc(5*ARR_SIZE*sizeof(rt_fp32) + MASK);
+    rt_fp32 *sar0 = (rt_fp32 *)(((rt_full)msgl + MASK) & ~MASK);
+    rt_fp32 *sco1 = sar0 + ARR_SIZE*0x1;
+    rt_fp32 *sco2 = sar0 + ARR_SIZE*0x2;
+    rt_fp32 *sso1 = sar0 + ARR_SIZE*0x3;
+    rt_fp32 *sso2 = sar0 + ARR_SIZE*0x4;
+
+    for (k = 0; k < ARR_SIZE; k++)
+    {
+        sar0[k] = (rt_fp32)far0[k];
+    }
+
+    rt_size imsz = 5*IMG_W*IMG_H;
+
+    rt_pntr mimg = sys_alloc(imsz*sizeof(rt_ui08) + MASK);
+    rt_ui08 *isrc = (rt_ui08 *)(((rt_full)mimg + MASK) & ~MASK);
+    rt_ui08 *ico1 = isrc + IMG_W*IMG_H*0x1;
+    rt_ui08 *ico2 = isrc + IMG_W*IMG_H*0x2;
+    rt_ui08 *iso1 = isrc + IMG_W*IMG_H*0x3;
+    rt_ui08 *iso2 = isrc + IMG_W*IMG_H*0x4;
+
+    for (k = 0; k < IMG_W*IMG_H; k++)
+    {
+        isrc[k] = (rt_ui08)(((rt_ui32)k * 2654435761U) >> 24);
+    }
+
+    rt_size srsz = 11*SRT_N;
+
+    rt_pntr msrt = sys_alloc(srsz*sizeof(rt_elem) + MASK);
+    rt_real *kar0 = (rt_real *)(((rt_full)msrt + MASK) & ~MASK);
+    rt_elem *jar0 = (rt_elem *)kar0 + SRT_N*0x1;
+    rt_real *kco0 = kar0 + SRT_N*0x2;
+    rt_real *kso0 = kar0 + SRT_N*0x3;
+    rt_real *kho0 = kar0 + SRT_N*0x4;
+    rt_elem *jco0 = (rt_elem *)kar0 + SRT_N*0x5;
+    rt_elem *jso0 = (rt_elem *)kar0 + SRT_N*0x6;
+    rt_elem *jho0 = (rt_elem *)kar0 + SRT_N*0x7;
+    rt_elem *vco0 = (rt_elem *)kar0 + SRT_N*0x8;
+    rt_elem *vso0 = (rt_elem *)kar0 + SRT_N*0x9;
+    rt_elem *vho0 = (rt_elem *)kar0 + SRT_N*0xA;
+
+    for (k = 0; k < SRT_N; k++)
+    {
+        rt_ui32 h = (rt_ui32)k * 2654435761U;
+        h = (h ^ (h >> 15)) * 2246822519U;
+        h = h ^ (h >> 13);
+        kar0[k] = (rt_real)((rt_si32)(h >> 9) - 4194304) / 16;
+        jar0[k] = (rt_elem)(h % 100003) - 50001;
+    }
+
+    rt_size slsz = 4*SRL_N;
+
+    rt_pntr msrl = sys_alloc(slsz*sizeof(rt_real) + MASK);
+    rt_real *kl00 = (rt_real *)(((rt_full)msrl + MASK) & ~MASK);
+
+    for (k = 0; k < SRL_N; k++)
+    {
+        rt_ui32 h = (rt_ui32)k * 2654435761U;
+        h = (h ^ (h >> 15)) * 2246822519U;
+        h = h ^ (h >> 13);
+        kl00[k] = (rt_real)((rt_si32)(h >> 9) - 4194304) / 16;
+    }
+
+    rt_pntr mscn = sys_alloc(SCN_N*sizeof(rt_ui08) + MASK);
+    rt_ui08 *text = (rt_ui08 *)(((rt_full)mscn + MASK) & ~MASK);
+
+    for (k = 0, l = 1; k < SCN_N - 1; k++, l--)
+    {
+        rt_ui32 h = (rt_ui32)k * 2654435761U;
+        h = (h ^ (h >> 15)) * 2246822519U;
+        h = h ^ (h >> 13);
+        if (l == 0)
+        {
+            text[k] = '\n';
+            l = 40 + h % 81;
+        }
+        else
+        if (l > 12 && (h >> 22) < 2 && k < SCN_N - 12)
+        {
+            memcpy(text + k, (h >> 22) == 0 ? "ERROR" : "ERRAR", 5);
+            k += 4;
+            l -= 4;
+        }
+        else
+        {
+            text[k] = (h >> 24) == 0 ? "{}[]<>|#"[h % 8] :
+                                       "etaoinshrdlu ETAOIN  "[h % 21];
+        }
+    }
+    text[SCN_N - 1] = 0;
+
+    rt_size hssz = (HST_N + 1)*(2*sizeof(rt_real) + 2*sizeof(rt_ui16)
+                 + 2*sizeof(rt_ui08)) + 2*65536*sizeof(rt_elem) + 6*MASK;
+
+    rt_pntr mhst = sys_alloc(hssz);
+    rt_real *hr00 = (rt_real *)(((rt_full)mhst + MASK) & ~MASK);
+    rt_real *hr01 = hr00 + HST_N + 1;
+    rt_elem *hco0 = (rt_elem *)(((rt_full)(hr01 + HST_N + 1) + MASK) & ~MASK);
+    rt_elem *hso0 = hco0 + 65536;
+    rt_ui16 *hw00 = (rt_ui16 *)(hso0 + 65536);
+    rt_ui16 *hw01 = hw00 + HST_N + 1;
+    rt_ui08 *hb00 = (rt_ui08 *)(hw01 + HST_N + 1);
+    rt_ui08 *hb01 = hb00 + HST_N + 1;
+
+    for (k = 0; k < HST_N; k++)
+    {
+        rt_ui32 h = (rt_ui32)k * 2246822519U;
+        h = (h ^ (h >> 13)) * 2654435761U;
+        h = h ^ (h >> 16);
+        hb00[k] = (rt_ui08)(h >> 24);
+        hw00[k] = (rt_ui16)(h >> 16);
+        hr00[k] = (rt_real)((rt_si32)(h >> 8) - 8388608) / 6710886.4f;
+        hb01[k] = (h & 7) != 0 ? 42 : hb00[k];
+        hw01[k] = (h & 7) != 0 ? 4242 : hw00[k];
+        hr01[k] = (h & 7) != 0 ? 0.25f : hr00[k];
+    }
+
+    rt_size hksz = (HSH_N + 1)*(3*sizeof(rt_ui64) + 3*sizeof(rt_ui32))
+                 + 6*MASK;
+
+    rt_pntr mhsh = sys_alloc(hksz);
+    rt_ui64 *hk64 = (rt_ui64 *)(((rt_full)mhsh + MASK) & ~MASK);
+    rt_ui64 *hc64 = (rt_ui64 *)(((rt_full)(hk64 + HSH_N + 1) + MASK) & ~MASK);
+    rt_ui64 *hs64 = (rt_ui64 *)(((rt_full)(hc64 + HSH_N + 1) + MASK) & ~MASK);
+    rt_ui32 *hk32 = (rt_ui32 *)(((rt_full)(hs64 + HSH_N + 1) + MASK) & ~MASK);
+    rt_ui32 *hc32 = (rt_ui32 *)(((rt_full)(hk32 + HSH_N + 1) + MASK) & ~MASK);
+    rt_ui32 *hs32 = (rt_ui32 *)(((rt_full)(hc32 + HSH_N + 1) + MASK) & ~MASK);
+
+    for (k = 0; k < HSH_N; k++)
+    {
+        rt_ui32 h = (rt_ui32)k * 2654435761U;
+        h = h ^ (h >> 15);
+        hk32[k] = (rt_ui32)k * 7 + 3;
+        hk64[k] = (rt_ui64)h << 32 | (rt_ui32)k;
+    }
+
+    rt_size rasz = (6*RAY_N + 9*RAY_M + 6*RAY_B + 6*S*RAY_W)*sizeof(rt_real)
+                 + RAY_N/S*sizeof(rt_SIMD_RPKT) + RAY_M*sizeof(rt_SIMD_RTRI)
+                 + (RAY_B + RAY_W)*sizeof(rt_SIMD_RBOX)
+                 + RAY_W*sizeof(rt_SIMD_RHIT) + 2*MASK;
+
+    rt_pntr mray = sys_alloc(rasz);
+    rt_SIMD_RPKT *rpkt = (rt_SIMD_RPKT *)(((rt_full)mray + MASK) & ~MASK);
+    rt_SIMD_RTRI *rtri = (rt_SIMD_RTRI *)(rpkt + RAY_N/S);
+    rt_SIMD_RBOX *rbox = (rt_SIMD_RBOX *)(rtri + RAY_M);
+    rt_SIMD_RBOX *rnod = rbox + RAY_B;
+    rt_SIMD_RHIT *rhit = (rt_SIMD_RHIT *)(rnod + RAY_W);
+    rt_real *ro00 = (rt_real *)(rhit + RAY_W);
+    rt_real *rd00 = ro00 + 3*RAY_N;
+    rt_real *rt00 = rd00 + 3*RAY_N;
+    rt_real *rb00 = rt00 + 9*RAY_M;
+    rt_real *rn00 = rb00 + 6*RAY_B;
+
+    rt_ui32 x = 0x2545F491;
+
+    for (k = 0; k < 6*RAY_N + 9*RAY_M + 6*(RAY_B + S*RAY_W); k++)
+    {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        ro00[k] = (rt_real)((rt_si32)(x >> 8) - 8388608) / 8388608.0f;
+    }
+    for (k = 0; k < RAY_N; k++)
+    {
+        /* origins on a plane behind the scene, some axis-parallel rays */
+        ro00[3*k+0] *= 1.5f;
+        ro00[3*k+1] *= 1.5f;
+        ro00[3*k+2] = -3.0f;
+        rd00[3*k+0] = k % 16 == 0 ? 0.0f : rd00[3*k+0] - ro00[3*k+0];
+        rd00[3*k+1] = k % 16 == 8 ? 0.0f : rd00[3*k+1] - ro00[3*k+1];
+        rd00[3*k+2] = rd00[3*k+2] - ro00[3*k+2];
+    }
+    for (k = 0; k < 3*RAY_M; k++)
+    {
+        rt00[3*k+0] = rt00[3*k+0] * (k % 3 == 0 ? 1.0f : 0.5f)
+                    + (k % 3 == 0 ? 0.0f : rt00[3*(k - k % 3)+0]);
+        rt00[3*k+1] = rt00[3*k+1] * (k % 3 == 0 ? 1.0f : 0.5f)
+                    + (k % 3 == 0 ? 0.0f : rt00[3*(k - k % 3)+1]);
+        rt00[3*k+2] = rt00[3*k+2] * (k % 3 == 0 ? 1.0f : 0.5f)
+                    + (k % 3 == 0 ? 0.0f : rt00[3*(k - k % 3)+2]);
+    }
+    for (k = 0; k < 3*(RAY_B + S*RAY_W); k += 3)
+    {
+        /* center and half-size in [0.05, 0.3] into min and max corners */
+        rt_real c0 = rb00[2*k+0], c1 = rb00[2*k+1], c2 = rb00[2*k+2];
+        rt_real h0 = 0.05f + 0.125f * (rb00[2*k+3] + 1.0f);
+        rt_real h1 = 0.05f + 0.125f * (rb00[2*k+4] + 1.0f);
+        rt_real h2 = 0.05f + 0.125f * (rb00[2*k+5] + 1.0f);
+        rb00[2*k+0] = c0 - h0;
+        rb00[2*k+1] = c1 - h1;
+        rb00[2*k+2] = c2 - h2;
+        rb00[2*k+3] = c0 + h0;
+        rb00[2*k+4] = c1 + h1;
+        rb00[2*k+5] = c2 + h2;
+    }
+
+    rt_pntr mbvh = sys_alloc(6*BVH_N*sizeof(rt_real) + MASK);
+    rt_real *bv00 = (rt_real *)(((rt_full)mbvh + MASK) & ~MASK);
+
+    for (k = 0; k < 6*BVH_N; k++)
+    {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        bv00[k] = (rt_real)((rt_si32)(x >> 8) - 8388608) / 8388608.0f;
+    }
+    for (k = 0; k < 6*BVH_N; k += 1 + (k % 6 == 2) * 3)
+    {
+        /* center in [-1, 1] and half-size in [0.005, 0.02] */
+        rt_real c = bv00[k], h = 0.0125f + 0.0075f * bv00[k+3];
+        bv00[k+0] = c - h;
+        bv00[k+3] = c + h;
+    }
+
+    /* vecm arrays (AoS and SIMD), rounded up to max S = 16 */
+    rt_si32 vmsz = VCM_END * ((VCM_N + 15) / 16 * 16);
+    rt_size vcsz = 2 * vmsz * sizeof(rt_real) + MASK;
+    rt_pntr mvcm = sys_alloc(vcsz);
+    rt_real *vm00 = (rt_real *)(((rt_full)mvcm + MASK) & ~MASK);
+    rt_real *vp00 = vm00 + vmsz;
+
+    for (k = 0; k < VCM_V3 * VCM_N; k++)
+    {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        vm00[k] = (rt_real)((rt_si32)(x >> 8) - 8388608) / 8388608.0f;
+    }
+    for (k = 0; k < VCM_N; k++)
+    {
+        /* diagonally dominant 4x4, its 3x3 part, unit quaternions, 3D */
+        rt_real *m = vm00 + VCM_M4 * VCM_N + 16 * k, h;
+        m[0] += 4.0f; m[5] += 4.0f; m[10] += 4.0f; m[15] += 4.0f;
+        for (l = 0; l < 9; l++)
+        {
+            vm00[VCM_M3 * VCM_N + 9 * k + l] = m[(l / 3) * 4 + l % 3];
+        }
+        for (t = VCM_Q0; t <= VCM_Q1; t += 4)
+        {
+            m = vm00 + t * VCM_N + 4 * k;
+            h = 1.0f / RT_SQRT(m[0] * m[0] + m[1] * m[1]
+                             + m[2] * m[2] + m[3] * m[3] + 1.0e-30f);
+            m[0] *= h; m[1] *= h; m[2] *= h; m[3] *= h;
+        }
+        for (l = 0; l < 3; l++)
+        {
+            vm00[VCM_V3 * VCM_N + 3 * k + l] = vm00[VCM_V4 * VCM_N + 4 * k + l];
+            vm00[VCM_W3 * VCM_N + 3 * k + l] = vm00[VCM_Q0 * VCM_N + 4 * k + l];
+        }
+    }
+
+    /* ksum arrays: pairs of cancelling terms and residuals, shuffled */
+    rt_size kssz = (KSM_R + 4) * sizeof(rt_real) + MASK;
+    rt_pntr mksm = sys_alloc(kssz);
+    rt_real *ks00 = (rt_real *)(((rt_full)mksm + MASK) & ~MASK);
+    rt_real *kx = ks00 + 1, *ky = ks00 + KSM_M + 1, h;
+    long double ksr[4] = {0.0, 0.0, 0.0, 0.0};
+
+    for (k = 0; k < KSM_N; k++)
+    {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        h = (rt_real)((rt_si32)(x >> 8) - 8388608) / 8388608.0f;
+        if (k % 3 == 0)
+        {
+            kx[k] = (rt_real)ldexp(1.5 + 0.5 * h, x % (KSM_E + 1));
+            ky[k] = 1.5f + 0.5f * h;
+        }
+        else
+        if (k % 3 == 1)
+        {
+            kx[k] = -kx[k - 1];
+            ky[k] = ky[k - 1];
+        }
+        else
+        {
+            kx[k] = h;
+            ky[k] = 1.0f + (rt_real)(x % 1024) / 1024.0f;
+            ksr[0] += (long double)kx[k];
+            ksr[1] += (long double)kx[k] * ky[k];
+        }
+        ksr[2] += RT_FABS(kx[k]);
+        ksr[3] += RT_FABS(kx[k] * ky[k]);
+    }
+    for (k = KSM_N - 1; k > 0; k--)
+    {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        l = x % (k + 1);
+        h = kx[k]; kx[k] = kx[l]; kx[l] = h;
+        h = ky[k]; ky[k] = ky[l]; ky[l] = h;
+    }
+    for (k = 0; k < KSM_N; k++)
+    {
+        ks00[2 * KSM_M + 2 + k] = ky[k];
+    }
+    for (k = 0; k < 4; k++)
+    {
+        ks00[KSM_R + k] = (rt_real)ksr[k];
+    }
+
+    /* quad arrays: positive a (for sqrt), signed b, c, lo within ulp/2 */
+    rt_size qdsz = 15 * QUD_Z * sizeof(rt_fp64) + MASK;
+    rt_pntr mqud = sys_alloc(qdsz);
+    rt_fp64 *qd00 = (rt_fp64 *)(((rt_full)mqud + MASK) & ~MASK);
+
+    for (k = 0; k < 3 * QUD_N; k++)
+    {
+        rt_fp64 *q = qd00 + QUD_Z * (k / QUD_N) + QUD_IX(k % QUD_N), u, v;
+
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        u = ldexp(1.0 + (x >> 8) / 16777216.0, (rt_si32)(x % 17) - 8);
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        v = ((rt_si32)(x >> 8) - 8388608) / 8388608.0;
+        q[0] = k < QUD_N || (x & 1) ? u : -u;
+        q[T] = q[0] * v * 5.551115123125783e-17; /* 2^-54 */
+    }
+
+    /* half arrays: finite random fp16 bit patterns, zero padding */
+    rt_size hfsz = 19 * HLF_Z * sizeof(rt_half) + MASK;
+    rt_pntr mhlf = sys_alloc(hfsz);
+    rt_half *hf00 = (rt_half *)(((rt_full)mhlf + MASK) & ~MASK);
+
+    memset(hf00, 0, 3 * HLF_Z * sizeof(rt_half));
+    for (k = 0; k < 3 * HLF_N; k++)
+    {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        hf00[HLF_Z * (k / HLF_N) + k % HLF_N] =
+                            (rt_half)((x >> 8) % 0x7C00 + (x & 1) * 0x8000);
+    }
+
+    rt_real frc0[RES_SIZE], frs0[RES_SIZE];
+    rt_elem irc0[RES_SIZE], irs0[RES_SIZE];
+
+    rt_pntr info = sys_alloc(sizeof(rt_SIMD_INFOX) + MASK);
+    rt_SIMD_INFOX *inf0 = (rt_SIMD_INFOX *)(((rt_full)info + MASK) & ~MASK);
+
+    rt_pntr blas = sys_alloc(sizeof(rt_SIMD_BLAS) + MASK);
+    rt_SIMD_BLAS *bls0 = (rt_SIMD_BLAS *)(((rt_full)blas + MASK) & ~MASK);
+
+    rt_pntr gemm = sys_alloc(sizeof(rt_SIMD_GEMM) + MASK);
+    rt_SIMD_GEMM *gmm0 = (rt_SIMD_GEMM *)(((rt_full)gemm + MASK) & ~MASK);
+
+    rt_size wsz = gemm_work(GMM_M, GMM_N);
+    rt_pntr wgmm = sys_alloc(wsz + MASK);
+
+    rt_pntr trns = sys_alloc(sizeof(rt_SIMD_TRNS) + MASK);
+    rt_SIMD_TRNS *trn0 = (rt_SIMD_TRNS *)(((rt_full)trns + MASK) & ~MASK);
+
+    rt_pntr firf = sys_alloc(sizeof(rt_SIMD_FIRF) + MASK);
+    rt_SIMD_FIRF *fir0 = (rt_SIMD_FIRF *)(((rt_full)firf + MASK) & ~MASK);
+
+    rt_size wfsz = fir_work(FIR_T2);
+    rt_pntr wfir = sys_alloc(wfsz + MASK);
+
+    rt_pntr biqd = sys_alloc(sizeof(rt_SIMD_BIQD) + MASK);
+    rt_SIMD_BIQD *bqd0 = (rt_SIMD_BIQD *)(((rt_full)biqd + MASK) & ~MASK);
+
+    rt_size wbsz = bqd_work(BQD_C, BQD_S);
+    rt_pntr wbqd = sys_alloc(wbsz + MASK);
+
+    rt_pntr imgf = sys_alloc(sizeof(rt_SIMD_IMGF) + MASK);
+    rt_SIMD_IMGF *img0 = (rt_SIMD_IMGF *)(((rt_full)imgf + MASK) & ~MASK);
+
+    rt_size wisz = img_work(RT_MAX(BOX_R1, BOX_R2));
+    rt_pntr wimg = sys_alloc(wisz + MASK);
+
+    rt_pntr fftl = sys_alloc(sizeof(rt_SIMD_FFTS) + MASK);
+    rt_SIMD_FFTS *ffl0 = (rt_SIMD_FFTS *)(((rt_full)fftl + MASK) & ~MASK);
+
+    rt_size wlsz = fft_work(FFT_N);
+    rt_pntr wffl = sys_alloc(wlsz + MASK);
+
+    rt_pntr ffts = sys_alloc(sizeof(rt_SIMD_FFTS) + MASK);
+    rt_SIMD_FFTS *ffs0 = (rt_SIMD_FFTS *)(((rt_full)ffts + MASK) & ~MASK);
+
+    rt_size wssz = fft_work(FFT_S);
+    rt_pntr wffs = sys_alloc(wssz + MASK);
+
+    rt_pntr sort = sys_alloc(sizeof(rt_SIMD_SORT) + MASK);
+    rt_SIMD_SORT *srt0 = (rt_SIMD_SORT *)(((rt_full)sort + MASK) & ~MASK);
+
+    rt_size wrsz = srt_work(RT_MAX(SRT_N, SRL_N));
+    rt_pntr wsrt = sys_alloc(wrsz + MASK);
+
+    rt_pntr scan = sys_alloc(sizeof(rt_SIMD_SCAN) + MASK);
+    rt_SIMD_SCAN *scn0 = (rt_SIMD_SCAN *)(((rt_full)scan + MASK) & ~MASK);
+
+    rt_pntr hist = sys_alloc(sizeof(rt_SIMD_HIST) + MASK);
+    rt_SIMD_HIST *hst0 = (rt_SIMD_HIST *)(((rt_full)hist + MASK) & ~MASK);
+
+    rt_size whsz = hst_work(65536);
+    rt_pntr whst = sys_alloc(whsz + MASK);
+
+    rt_pntr hash = sys_alloc(sizeof(rt_SIMD_HASH) + MASK);
+    rt_SIMD_HASH *hsh0 = (rt_SIMD_HASH *)(((rt_full)hash + MASK) & ~MASK);
+
+    rt_size wksz = hsh_work();
+    rt_pntr whsh = sys_alloc(wksz + MASK);
+
+    rt_pntr rays = sys_alloc(sizeof(rt_SIMD_RAYS) + MASK);
+    rt_SIMD_RAYS *ray0 = (rt_SIMD_RAYS *)(((rt_full)rays + MASK) & ~MASK);
+
+    rt_pntr bvhs = sys_alloc(sizeof(rt_SIMD_BVHS) + MASK);
+    rt_SIMD_BVHS *bvh0 = (rt_SIMD_BVHS *)(((rt_full)bvhs + MASK) & ~MASK);
+
+    rt_size wvsz = bvh_work(BVH_N);
+    rt_pntr wbvh = sys_alloc(wvsz + MASK);
+
+    rt_pntr vecm = sys_alloc(sizeof(rt_SIMD_VECM) + MASK);
+    rt_SIMD_VECM *vcm0 = (rt_SIMD_VECM *)(((rt_full)vecm + MASK) & ~MASK);
+
+    rt_pntr poly = sys_alloc(sizeof(rt_SIMD_POLY) + MASK);
+    rt_SIMD_POLY *ply0 = (rt_SIMD_POLY *)(((rt_full)poly + MASK) & ~MASK);
+
+    rt_pntr quad = sys_alloc(sizeof(rt_SIMD_QUAD) + MASK);
+    rt_SIMD_QUAD *qud0 = (rt_SIMD_QUAD *)(((rt_full)quad + MASK) & ~MASK);
+
+    rt_pntr half = sys_alloc(sizeof(rt_SIMD_HALF) + MASK);
+    rt_SIMD_HALF *hlf0 = (rt_SIMD_HALF *)(((rt_full)half + MASK) & ~MASK);
+
+    rt_pntr regs = sys_alloc(sizeof(rt_SIMD_REGS) + MASK);
+    rt_SIMD_REGS *reg0 = (rt_SIMD_REGS *)(((rt_full)regs + MASK) & ~MASK);
+
+    ASM_INIT(inf0, reg0)
+    ASM_INIT(bls0, reg0)
+    blas_init(bls0);
+    ASM_INIT(gmm0, reg0)
+    gmm0->work = (rt_real *)(((rt_full)wgmm + MASK) & ~MASK);
+    ASM_INIT(trn0, reg0)
+    ASM_INIT(fir0, reg0)
+    fir0->work = (rt_fp32 *)(((rt_full)wfir + MASK) & ~MASK);
+    ASM_INIT(bqd0, reg0)
+    bqd0->work = (rt_fp32 *)(((rt_full)wbqd + MASK) & ~MASK);
+    ASM_INIT(img0, reg0)
+    img0->work = (rt_ui08 *)(((rt_full)wimg + MASK) & ~MASK);
+    ASM_INIT(ffl0, reg0)
+    ffl0->work = (rt_real *)(((rt_full)wffl + MASK) & ~MASK);
+    fft_init(ffl0, FFT_N);
+    ASM_INIT(ffs0, reg0)
+    ffs0->work = (rt_real *)(((rt_full)wffs + MASK) & ~MASK);
+    fft_init(ffs0, FFT_S);
+    ASM_INIT(srt0, reg0)
+    srt0->work = (rt_elem *)(((rt_full)wsrt + MASK) & ~MASK);
+    srt_init(srt0, RT_MAX(SRT_N, SRL_N));
+    ASM_INIT(scn0, reg0)
+    ASM_INIT(hst0, reg0)
+    hst0->work = (rt_elem *)(((rt_full)whst + MASK) & ~MASK);
+    hst_init(hst0, 65536);
+    ASM_INIT(hsh0, reg0)
+    hsh0->work = (rt_ui08 *)(((rt_full)whsh + MASK) & ~MASK);
+    hsh_init(hsh0);
+    ASM_INIT(ray0, reg0)
+    ray_init(ray0);
+    ray_tset(rtri, rt00, RAY_M, 0);
+    ray_bset(rbox, rb00, RAY_B);
+    for (k = 0; k < RAY_W; k++)
+    {
+        ray_nset(rnod + k, rn00 + 6*S*k, 1 + k % S);
+    }
+    ASM_INIT(bvh0, reg0)
+    bvh0->work = (rt_ui08 *)(((rt_full)wbvh + MASK) & ~MASK);
+    bvh_init(bvh0, BVH_N);
+    ASM_INIT(vcm0, reg0)
+    vcm_init(vcm0);
+    for (k = 0, l = (VCM_N + S - 1) / S * S; k < VCM_DOT; k += t)
+    {
+        t = k == VCM_M4 ? 16 : k == VCM_M3 ? 9 : k < VCM_V3 ? 4 : 3;
+        vcm_pack(vp00 + k * l, vm00 + k * VCM_N, t, VCM_N);
+    }
+    ASM_INIT(ply0, reg0)
+    ASM_INIT(qud0, reg0)
+    qud_init(qud0);
+    ASM_INIT(hlf0, reg0)
+
+    inf0->far0 = far0;
+    inf0->far1 = far1;
+    inf0->fco1 = fco1;
+    inf0->fco2 = fco2;
+    inf0->fso1 = fso1;
+    inf0->fso2 = fso2;
+
+    inf0->frc0 = frc0;
+    inf0->frs0 = frs0;
+    inf0->irc0 = irc0;
+    inf0->irs0 = irs0;
+
+    inf0->mat0 = mat0;
+    inf0->mat1 = mat1;
+    inf0->mco0 = mco0;
+    inf0->mso0 = mso0;
+    inf0->mho0 = mho0;
+
+    inf0->tsrc = tsrc;
+    inf0->tco0 = tco0;
+    inf0->tso0 = tso0;
+
+    inf0->sar0 = sar0;
+    inf0->sco1 = sco1;
+    inf0->sco2 = sco2;
+    inf0->sso1 = sso1;
+    inf0->sso2 = sso2;
+
+    inf0->blas = bls0;
+    inf0->gemm = gmm0;
+    inf0->trns = trn0;
+    inf0->firf = fir0;
+    inf0->biqd = bqd0;
+    inf0->imgf = img0;
+
+    inf0->isrc = isrc;
+    inf0->ico1 = ico1;
+    inf0->ico2 = ico2;
+    inf0->iso1 = iso1;
+    inf0->iso2 = iso2;
+
+    inf0->fftl = ffl0;
+    inf0->ffts = ffs0;
+
+    inf0->kar0 = kar0;
+    inf0->kco0 = kco0;
+    inf0->kso0 = kso0;
+    inf0->kho0 = kho0;
+    inf0->jar0 = jar0;
+    inf0->jco0 = jco0;
+    inf0->jso0 = jso0;
+    inf0->jho0 = jho0;
+    inf0->vco0 = vco0;
+    inf0->vso0 = vso0;
+    inf0->vho0 = vho0;
+    inf0->sort = srt0;
+
+    inf0->text = text;
+    inf0->scan = scn0;
+
+    inf0->hb00 = hb00;
+    inf0->hb01 = hb01;
+    inf0->hw00 = hw00;
+    inf0->hw01 = hw01;
+    inf0->hr00 = hr00;
+    inf0->hr01 = hr01;
+    inf0->hco0 = hco0;
+    inf0->hso0 = hso0;
+    inf0->hist = hst0;
+
+    inf0->hk32 = hk32;
+    inf0->hk64 = hk64;
+    inf0->hc32 = hc32;
+    inf0->hc64 = hc64;
+    inf0->hs32 = hs32;
+    inf0->hs64 = hs64;
+    inf0->hash = hsh0;
+
+    inf0->ro00 = ro00;
+    inf0->rd00 = rd00;
+    inf0->rt00 = rt00;
+    inf0->rb00 = rb00;
+    inf0->rn00 = rn00;
+    inf0->rpkt = rpkt;
+    inf0->rtri = rtri;
+    inf0->rbox = rbox;
+    inf0->rnod = rnod;
+    inf0->rhit = rhit;
+    inf0->rays = ray0;
+
+    inf0->bv00 = bv00;
+    inf0->bvhs = bvh0;
+
+    inf0->vm00 = vm00;
+    inf0->vp00 = vp00;
+    inf0->vecm = vcm0;
+
+    inf0->poly = ply0;
+    inf0->ks00 = ks00;
+    inf0->qd00 = qd00;
+    inf0->quad = qud0;
+    inf0->hf00 = hf00;
+    inf0->half = hlf0;
+
+    inf0->kl00 = kl00;
+
+    inf0->cyc  = r_test;
+    inf0->size = ARR_SIZE;
+
+    rt_si32 simd = 0;
+
+    v_simd(inf0);
+
+    if (RT_FALSE
+#if   (RT_2K8_R8) && (RT_SIMD == 2048)
+    ||  (inf0->ver & (RT_2K8_R8 << 0x1C)) == 0
+#elif (RT_1K4)    && (RT_SIMD == 1024)
+    ||  (inf0->ver & (RT_1K4 << 0x18)) == 0
+#elif (RT_1K4_R8) && (RT_SIMD == 1024)
+    ||  (inf0->ver & (RT_1K4_R8 << 0x14)) == 0
+#elif (RT_512)    && (RT_SIMD == 512)
+    ||  (inf0->ver & (RT_512 << 0x10)) == 0
+#elif (RT_512_R8) && (RT_SIMD == 512)
+    ||  (inf0->ver & (RT_512_R8 << 0x0C)) == 0
+#elif (RT_256)    && (RT_SIMD == 256)
+    ||  (inf0->ver & (RT_256 << 0x08)) == 0
+#elif (RT_256_R8) && (RT_SIMD == 256)
+    ||  (inf0->ver & (RT_256_R8 << 0x04)) == 0
+#elif (RT_128)    && (RT_SIMD == 128)
+    ||  (inf0->ver & (RT_128 << 0x00)) == 0
+#endif /* RT_128 */
+       )
+    {
+        RT_LOGI("Chosen SIMD target is not supported, check build flags\n");
+        n_done = -1;
+    }
+
+#if   (RT_2K8X1)  && (RT_SIMD == 2048)
+    simd = (1 << 16) | (RT_2K8X1 << 8) | 16;
+#elif (RT_1K4X2)  && (RT_SIMD == 2048)
+    simd = (2 << 16) | (RT_1K4X2 << 8) | 8;
+#elif (RT_512X4)  && (RT_SIMD == 2048)
+    simd = (4 << 16) | (RT_512X4 << 8) | 4;
+#elif (RT_1K4X1)  && (RT_SIMD == 1024)
+    simd = (1 << 16) | (RT_1K4X1 << 8) | 8;
+#elif (RT_512X2)  && (RT_SIMD == 1024)
+    simd = (2 << 16) | (RT_512X2 << 8) | 4;
+#elif (RT_512X1)  && (RT_SIMD == 512)
+    simd = (1 << 16) | (RT_512X1 << 8) | 4;
+#elif (RT_256X2)  && (RT_SIMD == 512)
+    simd = (2 << 16) | (RT_256X2 << 8) | 2;
+#elif (RT_128X4)  && (RT_SIMD == 512)
+    simd = (4 << 16) | (RT_128X4 << 8) | 1;
+#elif (RT_256X1)  && (RT_SIMD == 256)
+    simd = (1 << 16) | (RT_256X1 << 8) | 2;
+#elif (RT_128X2)  && (RT_SIMD == 256)
+    simd = (2 << 16) | (RT_128X2 << 8) | 1;
+#elif (RT_128X1)  && (RT_SIMD == 128)
+    simd = (1 << 16) | (RT_128X1 << 8) | 1;
+#endif /* RT_128 */
+
+    rt_time time1 = 0;
+    rt_time time2 = 0;
+    rt_time tC = 0;
+    rt_time tS = 0;
+    rt_time tH = 0;
+
+    rt_si32 i, j, c;
+
+    for (i = n_init; i <= n_done; i++)
+    {
+        RT_LOGI("--------------------  SUB TEST = %2d  - ptr/fp = %d%s%d --\n",
+                    i+1, RT_POINTER, RT_ADDRESS == 32 ? "_" : "f", RT_ELEMENT);
+
+        /* reset outputs, as some kernels accumulate in place */
+        memcpy(fco1, far1, ARR_SIZE*sizeof(rt_real));
+        memcpy(fco2, far1, ARR_SIZE*sizeof(rt_real));
+        memcpy(fso1, far1, ARR_SIZE*sizeof(rt_real));
+        memcpy(fso2, far1, ARR_SIZE*sizeof(rt_real));
+
+        memset(frc0, 0, sizeof(frc0));
+        memset(frs0, 0, sizeof(frs0));
+        memset(irc0, 0, sizeof(irc0));
+        memset(irs0, 0, sizeof(irs0));
+
+        memcpy(mco0, mci0, GMM_M*GMM_N*sizeof(rt_real));
+        memcpy(mso0, mci0, GMM_M*GMM_N*sizeof(rt_real));
+        memcpy(mho0, mci0, GMM_M*GMM_N*sizeof(rt_real));
+
+        memset(tco0, 0, TRN_B*TRN_R*TRN_C*sizeof(rt_ui32));
+        memset(tso0, 0, TRN_B*TRN_R*TRN_C*sizeof(rt_ui32));
+
+        memset(sco1, 0, ARR_SIZE*sizeof(rt_fp32));
+        memset(sco2, 0, ARR_SIZE*sizeof(rt_fp32));
+        memset(sso1, 0, ARR_SIZE*sizeof(rt_fp32));
+        memset(sso2, 0, ARR_SIZE*sizeof(rt_fp32));
+
+        memset(ico1, 0, 4*IMG_W*IMG_H*sizeof(rt_ui08));
+
+        memset(kco0, 0, 9*SRT_N*sizeof(rt_elem));
+
+        c = RT_MAX(inf0->cyc / d_test[i], 1);
+
+        time1 = get_time();
+
+        j = c;
+        while (j-->0) c_test[i](inf0);
+
+        time2 = get_time();
+        tC = time2 - time1;
+#ifdef RT_PRINT_NUM
+        RT_LOGI("Time C = %d\n", (rt_si32)tC);
+#endif /* RT_PRINT_NUM */
+
+        /* --------------------------------- */
+
+        time1 = get_time();
+
+        j = c;
+        while (j-->0) s_test[i](inf0);
+
+        time2 = get_time();
+        tS = time2 - time1;
+#ifdef RT_PRINT_NUM
+        RT_LOGI("Time S = %d\n", (rt_si32)tS);
+#endif /* RT_PRINT_NUM */
+
+        /* --------------------------------- */
+
+        if (h_test[i] != RT_NULL)
+        {
+            time1 = get_time();
+
+            j = c;
+            while (j-->0) h_test[i](inf0);
+
+            time2 = get_time();
+            tH = time2 - time1;
+#ifdef RT_PRINT_NUM
+            RT_LOGI("Time H = %d\n", (rt_si32)tH);
+#endif /* RT_PRINT_NUM */
+        }
+
+#ifdef RT_PRINT_NUM
+        if (f_test[i] != 0.0)
+        {
+            RT_LOGI("GFLOP/s C = %.2f, S = %.2f",
+                f_test[i] * c / (RT_MAX(tC, 1) * 1000000.0),
+                f_test[i] * c / (RT_MAX(tS, 1) * 1000000.0));
+            if (h_test[i] != RT_NULL)
+            {
+                RT_LOGI(", H = %.2f",
+                f_test[i] * c / (RT_MAX(tH, 1) * 1000000.0));
+            }
+            RT_LOGI("\n");
+        }
+#endif /* RT_PRINT_NUM */
+
+#ifdef RT_PRINT_NUM
+        if (m_test[i] != 0.0)
+        {
+            RT_LOGI("Mrays/s C = %.2f, S = %.2f",
+                m_test[i] * c / (RT_MAX(tC, 1) * 1000.0),
+                m_test[i] * c / (RT_MAX(tS, 1) * 1000.0));
+            if (h_test[i] != RT_NULL)
+            {
+                RT_LOGI(", H = %.2f",
+                m_test[i] * c / (RT_MAX(tH, 1) * 1000.0));
+            }
+            RT_LOGI("\n");
+        }
+#endif /* RT_PRINT_NUM */
+
+        /* --------------------------------- */
+
+        p_test[i](inf0);
+
+#ifdef RT_PRINT_NUM
+        RT_LOGI("-------------------------------------- simd = %4dx%dv%d -\n",
+                (simd & 0xFF) * 128, (simd >> 16) & 0xFF, (simd >> 8) & 0xFF);
+#endif /* RT_PRINT_NUM */
+    }
+
+    ASM_DONE(hlf0)
+    ASM_DONE(qud0)
+    ASM_DONE(ply0)
+    ASM_DONE(vcm0)
+    ASM_DONE(bvh0)
+    ASM_DONE(ray0)
+    ASM_DONE(hsh0)
+    ASM_DONE(hst0)
+    ASM_DONE(scn0)
+    ASM_DONE(srt0)
+    ASM_DONE(ffs0)
+    ASM_DONE(ffl0)
+    ASM_DONE(img0)
+    ASM_DONE(bqd0)
+    ASM_DONE(fir0)
+    ASM_DONE(trn0)
+    ASM_DONE(gmm0)
+    ASM_DONE(bls0)
+    ASM_DONE(inf0)
+
+    sys_free(regs, sizeof(rt_SIMD_REGS) + MASK);
+    sys_free(half, sizeof(rt_SIMD_HALF) + MASK);
+    sys_free(quad, sizeof(rt_SIMD_QUAD) + MASK);
+    sys_free(poly, sizeof(rt_SIMD_POLY) + MASK);
+    sys_free(vecm, sizeof(rt_SIMD_VECM) + MASK);
+    sys_free(wbvh, wvsz + MASK);
+    sys_free(bvhs, sizeof(rt_SIMD_BVHS) + MASK);
+    sys_free(rays, sizeof(rt_SIMD_RAYS) + MASK);
+    sys_free(whsh, wksz + MASK);
+    sys_free(hash, sizeof(rt_SIMD_HASH) + MASK);
+    sys_free(whst, whsz + MASK);
+    sys_free(hist, sizeof(rt_SIMD_HIST) + MASK);
+    sys_free(scan, sizeof(rt_SIMD_SCAN) + MASK);
+    sys_free(wsrt, wrsz + MASK);
+    sys_free(sort, sizeof(rt_SIMD_SORT) + MASK);
+    sys_free(wffs, wssz + MASK);
+    sys_free(ffts, sizeof(rt_SIMD_FFTS) + MASK);
+    sys_free(wffl, wlsz + MASK);
+    sys_free(fftl, sizeof(rt_SIMD_FFTS) + MASK);
+    sys_free(wimg, wisz + MASK);
+    sys_free(imgf, sizeof(rt_SIMD_IMGF) + MASK);
+    sys_free(wbqd, wbsz + MASK);
+    sys_free(biqd, sizeof(rt_SIMD_BIQD) + MASK);
+    sys_free(wfir, wfsz + MASK);
+    sys_free(firf, sizeof(rt_SIMD_FIRF) + MASK);
+    sys_free(trns, sizeof(rt_SIMD_TRNS) + MASK);
+    sys_free(wgmm, wsz + MASK);
+    sys_free(gemm, sizeof(rt_SIMD_GEMM) + MASK);
+    sys_free(blas, sizeof(rt_SIMD_BLAS) + MASK);
+    sys_free(info, sizeof(rt_SIMD_INFOX) + MASK);
+    sys_free(mhlf, hfsz);
+    sys_free(mqud, qdsz);
+    sys_free(mksm, kssz);
+    sys_free(mvcm, vcsz);
+    sys_free(mbvh, 6*BVH_N*sizeof(rt_real) + MASK);
+    sys_free(mray, rasz);
+    sys_free(mhsh, hksz);
+    sys_free(mhst, hssz);
+    sys_free(mscn, SCN_N*sizeof(rt_ui08) + MASK);
+    sys_free(msrl, slsz*sizeof(rt_real) + MASK);
+    sys_free(msrt, srsz*sizeof(rt_elem) + MASK);
+    sys_free(mimg, imsz*sizeof(rt_ui08) + MASK);
+    sys_free(msgl, 5*ARR_SIZE*sizeof(rt_fp32) + MASK);
+    sys_free(mtrn, tnsz*sizeof(rt_ui32) + MASK);
+    sys_free(mmat, gmsz*sizeof(rt_real) + MASK);
+    sys_free(marr, 6*ARR_SIZE*sizeof(rt_real) + MASK);
+
+#if (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC -- Win64, GCC --- */
+
+    RT_LOGI("Type any letter and press ENTER to exit:");
+    rt_char str[80];
+    scanf("%79s", str);
+
+#endif /* ------------- OS specific ----------------------------------------- */
+
+    return 0;
+}
+
+/******************************************************************************/
+/**********************************   UTILS   *********************************/
+/******************************************************************************/
+
+#include "rtzero.h"
+
+#if RT_POINTER == 64
+#if RT_ADDRESS == 32
+
+#define RT_ADDRESS_MIN      ((rt_byte *)0x0000000040000000)
+#define RT_ADDRESS_MAX      ((rt_byte *)0x0000000080000000)
+
+#else /* RT_ADDRESS == 64 */
+
+#define RT_ADDRESS_MIN      ((rt_byte *)0x0000000140000000)
+#define RT_ADDRESS_MAX      ((rt_byte *)0x0000080000000000)
+
+#endif /* RT_ADDRESS */
+
+rt_byte *s_ptr = RT_ADDRESS_MIN;
+
+#endif /* RT_POINTER */
+
+
+#if (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC -- Win64, GCC --- */
+
+#include <windows.h>
+
+/*
+ * Get system time in milliseconds.
+ */
+rt_time get_time()
+{
+    LARGE_INTEGER fr;
+    QueryPerformanceFrequency(&fr);
+    LARGE_INTEGER tm;
+    QueryPerformanceCounter(&tm);
+    return (rt_time)(tm.QuadPart * 1000 / fr.QuadPart);
+}
+
+DWORD s_step = 0;
+
+SYSTEM_INFO s_sys = {0};
+
+/*
+ * Allocate memory from system heap.
+ * Not thread-safe due to common static ptr.
+ */
+rt_pntr sys_alloc(rt_size size)
+{
+#if (RT_POINTER - RT_ADDRESS) != 0
+
+    /* loop around RT_ADDRESS_MAX boundary */
+    if (s_ptr >= RT_ADDRESS_MAX - size)
+    {
+        s_ptr  = RT_ADDRESS_MIN;
+    }
+
+    if (s_step == 0)
+    {
+        GetSystemInfo(&s_sys);
+        s_step = s_sys.dwAllocationGranularity;
+    }
+
+    rt_pntr ptr = VirtualAlloc(s_ptr, size, MEM_COMMIT | MEM_RESERVE,
+                  PAGE_READWRITE);
+
+    /* advance with allocation granularity */
+    s_ptr = (rt_byte *)ptr + ((size + s_step - 1) / s_step) * s_step;
+
+#else /* (RT_POINTER - RT_ADDRESS) */
+
+    rt_pntr ptr = malloc(size);
+
+#endif /* (RT_POINTER - RT_ADDRESS) */
+
+#if RT_DEBUG >= 2
+
+    RT_LOGI("ALLOC PTR = %016" PR_Z "X, size = %ld\n", (rt_full)ptr, size);
+
+#endif /* RT_DEBUG */
+
+#if (RT_POINTER - RT_ADDRESS) != 0
+
+    if ((rt_byte *)ptr >= RT_ADDRESS_MAX - size)
+    {
+        RT_LOGE("address exceeded allowed range, exiting...\n");
+        exit(EXIT_FAILURE);
+    }
+
+#endif /* (RT_POINTER - RT_ADDRESS) */
+
+    if (ptr == RT_NULL)
+    {
+        RT_LOGE("alloc failed with NULL address, exiting...\n");
+        exit(EXIT_FAILURE);
+    }
+
+    return ptr;
+}
+
+/*
+ * Free memory from system heap.
+ */
+rt_void sys_free(rt_pntr ptr, rt_size size)
+{
+#if (RT_POINTER - RT_ADDRESS) != 0
+
+    VirtualFree(ptr, 0, MEM_RELEASE);
+
+#else /* (RT_POINTER - RT_ADDRESS) */
+
+    free(ptr);
+
+#endif /* (RT_POINTER - RT_ADDRESS) */
+
+#if RT_DEBUG >= 2
+
+    RT_LOGI("FREED PTR = %016" PR_Z "X, size = %ld\n", (rt_full)ptr, size);
+
+#endif /* RT_DEBUG */
+}
+
+#elif (defined RT_LINUX) /* Linux, GCC -------------------------------------- */
+
+#include <sys/time.h>
+
+/*
+ * Get system time in milliseconds.
+ */
+rt_time get_time()
+{
+    timeval tm;
+    gettimeofday(&tm, NULL);
+    return (rt_time)(tm.tv_sec * 1000 + tm.tv_usec / 1000);
+}
+
+#if (RT_POINTER - RT_ADDRESS) != 0
+
+#include <sys/mman.h>
+
+#ifndef MAP_ANONYMOUS
+#define MAP_ANONYMOUS MAP_ANON  /* workaround for macOS compilation */
+#endif /* macOS still cannot allocate with mmap within 32-bit range */
+
+#endif /* (RT_POINTER - RT_ADDRESS) */
+
+/*
+ * Allocate memory from system heap.
+ * Not thread-safe due to common static ptr.
+ */
+rt_pntr sys_alloc(rt_size size)
+{
+#if (RT_POINTER - RT_ADDRESS) != 0
+
+    /* loop around RT_ADDRESS_MAX boundary */
+    /* in 64/32-bit hybrid mode addresses can't have sign bit
+     * as MIPS64 sign-extends all 32-bit mem-loads by default */
+    if (s_ptr >= RT_ADDRESS_MAX - size)
+    {
+        s_ptr  = RT_ADDRESS_MIN;
+    }
+
+    rt_pntr ptr = mmap(s_ptr, size, PROT_READ | PROT_WRITE,
+                  MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    /* advance with allocation granularity */
+    /* in case when page-size differs from default 4096 bytes
+     * mmap should round toward closest correct page boundary */
+    s_ptr = (rt_byte *)ptr + ((size + 4095) / 4096) * 4096;
+
+#else /* (RT_POINTER - RT_ADDRESS) */
+
+    rt_pntr ptr = malloc(size);
+
+#endif /* (RT_POINTER - RT_ADDRESS) */
+
+#if RT_DEBUG >= 2
+
+    RT_LOGI("ALLOC PTR = %016" PR_Z "X, size = %ld\n", (rt_full)ptr, size);
+
+#endif /* RT_DEBUG */
+
+#if (RT_POINTER - RT_ADDRESS) != 0
+
+    if ((rt_byte *)ptr >= RT_ADDRESS_MAX - size)
+    {
+        RT_LOGE("address exceeded allowed range, exiting...\n");
+        exit(EXIT_FAILURE);
+    }
+
+#endif /* (RT_POINTER - RT_ADDRESS) */
+
+    if (ptr == RT_NULL)
+    {
+        RT_LOGE("alloc failed with NULL address, exiting...\n");
+        exit(EXIT_FAILURE);
+    }
+
+    return ptr;
+}
+
+/*
+ * Free memory from system heap.
+ */
+rt_void sys_free(rt_pntr ptr, rt_size size)
+{
+#if (RT_POINTER - RT_ADDRESS) != 0
+
+    munmap(ptr, size);
+
+#else /* (RT_POINTER - RT_ADDRESS) */
+
+    free(ptr);
+
+#endif /* (RT_POINTER - RT_ADDRESS) */
+
+#if RT_DEBUG >= 2
+
+    RT_LOGI("FREED PTR = %016" PR_Z "X, size = %ld\n", (rt_full)ptr, size);
+
+#endif /* RT_DEBUG */
+}
+
+#endif /* ------------- OS specific ----------------------------------------- */
+
+/******************************************************************************/
+/******************************************************************************/
+/******************************************************************************/
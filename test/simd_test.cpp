@@ -96,7 +96,7 @@
 /*******************************   DEFINITIONS   ******************************/
 /******************************************************************************/
 
-#define SUB_TEST            51
+#define SUB_TEST            56
 #define CYC_SIZE            1000000
 
 #define ARR_SIZE            S*3 /* hardcoded in ASM sections, S = SIMD elems */
@@ -7661,6 +7661,665 @@ rt_void p_test51(rt_SIMD_INFOX *info)
 
 #endif /* SUB_TEST 51 */
 
+/******************************************************************************/
+/*******************************   SUB TEST 52   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 52
+
+rt_void c_test52(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_elem *iar0 = info->iar0 + S*RT_OFFS_SIMD;
+    rt_elem *ico1 = info->ico1 + S*RT_OFFS_SIMD;
+    rt_elem *ico2 = info->ico2 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        ico1[j] = iar0[j] + 117;
+        ico2[j] = iar0[j];
+    }
+}
+
+/*
+ * As ASM_ENTER/ASM_LEAVE save/load a sizeable portion of registers onto/from
+ * the stack, they are considered heavy and therefore best suited for compute
+ * intensive parts of the program, in which case the ASM overhead is minimized.
+ * The test code below was designed mainly for assembler validation purposes
+ * and therefore may not fully represent its unlocked performance potential.
+ * For optimal results keep ASM sections in separate functions away from
+ * complex C/C++ logic, while making sure those functions are not inlined.
+ * This is needed for better compatibility with modern optimizing compilers.
+ */
+rt_void s_test52(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, inf_IAR0)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movxx_ld(Rebx, Mebp, inf_ISO2)
+
+        movwx_mi(Mebp, inf_SIMD, IB(S))
+
+    LBL(100500) /* atm_ini */
+
+        movyx_ld(Reax, Mesi, AJ0)
+        movyx_st(Reax, Medx, AJ0)
+        fenxx_rl()
+        movyx_ri(Recx, IB(117))
+        xadyx_st(Recx, Medx, AJ0)
+        movyx_st(Recx, Mebx, AJ0)
+
+        movyx_ld(Reax, Mesi, AJ1)
+        movyx_st(Reax, Medx, AJ1)
+        movyx_rr(Recx, Reax)
+        addyx_ri(Recx, IB(117))
+        xchyx_st(Recx, Medx, AJ1)
+        fenxx_aq()
+        movyx_st(Recx, Mebx, AJ1)
+
+        movyx_ld(Reax, Mesi, AJ2)
+        movyx_st(Reax, Medx, AJ2)
+        movyx_rr(Recx, Reax)
+        addyx_ri(Reax, IB(1))
+        casyx_st(Recx, Medx, AJ2)
+        addyx_ri(Recx, IB(117))
+        casyx_st(Recx, Medx, AJ2)
+        fenxx_sc()
+        movyx_st(Reax, Mebx, AJ2)
+
+        addxx_ri(Resi, IB(L*4))
+        addxx_ri(Redx, IB(L*4))
+        addxx_ri(Rebx, IB(L*4))
+
+        arjwx_mi(Mebp, inf_SIMD, IB(1),
+        sub_x,   NZ_x, 100500b) /* atm_ini */
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test52(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_elem *iar0 = info->iar0 + S*RT_OFFS_SIMD;
+    rt_elem *ico1 = info->ico1 + S*RT_OFFS_SIMD;
+    rt_elem *ico2 = info->ico2 + S*RT_OFFS_SIMD;
+    rt_elem *iso1 = info->iso1 + S*RT_OFFS_SIMD;
+    rt_elem *iso2 = info->iso2 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        if (IEQ(ico1[j], iso1[j]) && IEQ(ico2[j], iso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("iarr[%d] = %" PR_L "d\n",
+                j, iar0[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C iarr[%d]+117 = %" PR_L "d, "
+                 "old iarr[%d] = %" PR_L "d\n",
+                j, ico1[j], j, ico2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S iarr[%d]+117 = %" PR_L "d, "
+                 "old iarr[%d] = %" PR_L "d\n",
+                j, iso1[j], j, iso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 52 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 53   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 53
+
+rt_void c_test53(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k, n = info->size;
+
+    rt_elem *iar0 = info->iar0 + S*RT_OFFS_SIMD;
+    rt_elem *ico1 = info->ico1 + S*RT_OFFS_SIMD;
+    rt_elem *ico2 = info->ico2 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        rt_uelm v = (rt_uelm)iar0[j], cnt = 0, clz = 0, ctz = 0, bsw = 0;
+
+        for (k = 0; k < L*32; k++)
+        {
+            cnt += (v >> k) & 1;
+        }
+        for (k = L*32-1; k >= 0 && ((v >> k) & 1) == 0; k--)
+        {
+            clz++;
+        }
+        for (k = 0; k < L*32 && ((v >> k) & 1) == 0; k++)
+        {
+            ctz++;
+        }
+        for (k = 0; k < L*4; k++)
+        {
+            bsw = bsw << 8 | ((v >> k*8) & 0xFF);
+        }
+
+        ico1[j] = (rt_elem)(cnt | clz << 8 | ctz << 16);
+        ico2[j] = (rt_elem)(bsw + ((v >> 5) & 0x1FF));
+    }
+}
+
+/*
+ * As ASM_ENTER/ASM_LEAVE save/load a sizeable portion of registers onto/from
+ * the stack, they are considered heavy and therefore best suited for compute
+ * intensive parts of the program, in which case the ASM overhead is minimized.
+ * The test code below was designed mainly for assembler validation purposes
+ * and therefore may not fully represent its unlocked performance potential.
+ * For optimal results keep ASM sections in separate functions away from
+ * complex C/C++ logic, while making sure those functions are not inlined.
+ * This is needed for better compatibility with modern optimizing compilers.
+ */
+rt_void s_test53(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Resi, Mebp, inf_IAR0)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movxx_ld(Rebx, Mebp, inf_ISO2)
+
+        movwx_mi(Mebp, inf_SIMD, IB(S))
+
+    LBL(100500) /* bit_ini */
+
+        movyx_ld(Reax, Mesi, AJ0)
+        cntyx_rr(Recx, Reax)
+        clzyx_rr(Redi, Reax)
+        shlyx_ri(Redi, IB(8))
+        orryx_rr(Recx, Redi)
+        ctzyx_rr(Redi, Reax)
+        shlyx_ri(Redi, IB(16))
+        orryx_rr(Recx, Redi)
+        movyx_st(Recx, Medx, AJ0)
+        bswyx_rr(Recx, Reax)
+        bfxyx_ri(Reax, IB(5), IB(9))
+        addyx_rr(Recx, Reax)
+        movyx_st(Recx, Mebx, AJ0)
+
+        movyx_ld(Reax, Mesi, AJ1)
+        cntyx_rr(Recx, Reax)
+        clzyx_rr(Redi, Reax)
+        shlyx_ri(Redi, IB(8))
+        orryx_rr(Recx, Redi)
+        ctzyx_rr(Redi, Reax)
+        shlyx_ri(Redi, IB(16))
+        orryx_rr(Recx, Redi)
+        movyx_st(Recx, Medx, AJ1)
+        bswyx_rr(Recx, Reax)
+        bfxyx_ri(Reax, IB(5), IB(9))
+        addyx_rr(Recx, Reax)
+        movyx_st(Recx, Mebx, AJ1)
+
+        movyx_ld(Reax, Mesi, AJ2)
+        movyx_rr(Recx, Reax)
+        cntyx_rr(Recx, Recx)
+        movyx_rr(Redi, Reax)
+        clzyx_rr(Redi, Redi)
+        shlyx_ri(Redi, IB(8))
+        orryx_rr(Recx, Redi)
+        movyx_rr(Redi, Reax)
+        ctzyx_rr(Redi, Redi)
+        shlyx_ri(Redi, IB(16))
+        orryx_rr(Recx, Redi)
+        movyx_st(Recx, Medx, AJ2)
+        movyx_rr(Recx, Reax)
+        bswyx_rr(Recx, Recx)
+        bfxyx_ri(Reax, IB(5), IB(9))
+        addyx_rr(Recx, Reax)
+        movyx_st(Recx, Mebx, AJ2)
+
+        addxx_ri(Resi, IB(L*4))
+        addxx_ri(Redx, IB(L*4))
+        addxx_ri(Rebx, IB(L*4))
+
+        arjwx_mi(Mebp, inf_SIMD, IB(1),
+        sub_x,   NZ_x, 100500b) /* bit_ini */
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test53(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_elem *iar0 = info->iar0 + S*RT_OFFS_SIMD;
+    rt_elem *ico1 = info->ico1 + S*RT_OFFS_SIMD;
+    rt_elem *ico2 = info->ico2 + S*RT_OFFS_SIMD;
+    rt_elem *iso1 = info->iso1 + S*RT_OFFS_SIMD;
+    rt_elem *iso2 = info->iso2 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        if (IEQ(ico1[j], iso1[j]) && IEQ(ico2[j], iso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("iarr[%d] = %" PR_L "d\n",
+                j, iar0[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C cnt|clz|ctz[%d] = %" PR_L "X, "
+                 "bsw+bfx[%d] = %" PR_L "X\n",
+                j, ico1[j], j, ico2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S cnt|clz|ctz[%d] = %" PR_L "X, "
+                 "bsw+bfx[%d] = %" PR_L "X\n",
+                j, iso1[j], j, iso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 53 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 54   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 54
+
+rt_void c_test54(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k, n = info->size;
+
+    rt_elem *iar0 = info->iar0 + S*RT_OFFS_SIMD;
+    rt_elem *ico1 = info->ico1 + S*RT_OFFS_SIMD;
+    rt_elem *ico2 = info->ico2 + S*RT_OFFS_SIMD;
+
+    rt_uelm m = ((rt_uelm)1 << L*16) - 1;
+
+    j = n;
+    while (j-->0)
+    {
+        rt_uelm a = (rt_uelm)iar0[j], u = (rt_uelm)iar0[(j + S) % n];
+
+        for (k = 0; k < 2; k++)
+        {
+            rt_uelm b = k == 0 ? u : 0 - u;
+            rt_uelm al = a & m, ah = a >> L*16;
+            rt_uelm bl = b & m, bh = b >> L*16;
+            rt_uelm lh = al * bh, hl = ah * bl;
+            rt_uelm md = (al * bl >> L*16) + (lh & m) + (hl & m);
+            rt_uelm hi = ah * bh + (lh >> L*16) + (hl >> L*16) + (md >> L*16);
+
+            if (k == 0)
+            {
+                ico1[j] = (rt_elem)hi;
+            }
+            else
+            {
+                ico2[j] = (rt_elem)(hi - ((rt_elem)a < 0 ? b : 0)
+                                       - ((rt_elem)b < 0 ? a : 0));
+            }
+        }
+    }
+}
+
+/*
+ * As ASM_ENTER/ASM_LEAVE save/load a sizeable portion of registers onto/from
+ * the stack, they are considered heavy and therefore best suited for compute
+ * intensive parts of the program, in which case the ASM overhead is minimized.
+ * The test code below was designed mainly for assembler validation purposes
+ * and therefore may not fully represent its unlocked performance potential.
+ * For optimal results keep ASM sections in separate functions away from
+ * complex C/C++ logic, while making sure those functions are not inlined.
+ * This is needed for better compatibility with modern optimizing compilers.
+ */
+rt_void s_test54(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movwx_mi(Mebp, inf_LOC, IB(2))
+
+    LBL(100500) /* cyc_beg */
+
+        movxx_ld(Recx, Mebp, inf_IAR0)
+        movxx_ld(Rebx, Mebp, inf_ISO1)
+        movxx_ld(Resi, Mebp, inf_ISO2)
+        movwx_ld(Redi, Mebp, inf_SIZE)
+
+    LBL(100501) /* loc_beg */
+
+        movyx_ld(Reax, Mecx, AJ0)
+        mhiyx_ld(Reax, Mecx, AJ1)
+        movyx_st(Reax, Mebx, AJ0)
+        movyx_ld(Redx, Mecx, AJ1)
+        negyx_rx(Redx)
+        movyx_ld(Reax, Mecx, AJ0)
+        mhiyn_rr(Redx, Reax)
+        movyx_st(Redx, Mesi, AJ0)
+
+        addxx_ri(Recx, IB(4*L))
+        addxx_ri(Rebx, IB(4*L))
+        addxx_ri(Resi, IB(4*L))
+        subwx_ri(Redi, IB(1))
+        cmjwx_ri(Redi, IB(S),
+        /* if */ GT_x, 100501b) /* loc_beg */
+
+        movxx_ld(Redi, Mebp, inf_IAR0)
+        movwx_mi(Mebp, inf_SIMD, IB(S))
+
+    LBL(100502) /* smd_beg */
+
+        movyx_ld(Reax, Mecx, AJ0)
+        mhiyx_ld(Reax, Medi, AJ0)
+        movyx_st(Reax, Mebx, AJ0)
+        movyx_ld(Redx, Medi, AJ0)
+        negyx_rx(Redx)
+        movyx_ld(Reax, Mecx, AJ0)
+        mhiyn_rr(Redx, Reax)
+        movyx_st(Redx, Mesi, AJ0)
+
+        addxx_ri(Recx, IB(4*L))
+        addxx_ri(Rebx, IB(4*L))
+        addxx_ri(Resi, IB(4*L))
+        addxx_ri(Redi, IB(4*L))
+        subwx_mi(Mebp, inf_SIMD, IB(1))
+        cmjwx_mz(Mebp, inf_SIMD,
+        /* if */ GT_x, 100502b) /* smd_beg */
+
+        subwx_mi(Mebp, inf_LOC, IB(1))
+        cmjwx_mz(Mebp, inf_LOC,
+        /* if */ EQ_x, 100503f) /* cyc_end */
+
+        jmpxx_lb(100500b) /* cyc_beg */
+
+    LBL(100503) /* cyc_end */
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test54(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_elem *iar0 = info->iar0 + S*RT_OFFS_SIMD;
+    rt_elem *ico1 = info->ico1 + S*RT_OFFS_SIMD;
+    rt_elem *ico2 = info->ico2 + S*RT_OFFS_SIMD;
+    rt_elem *iso1 = info->iso1 + S*RT_OFFS_SIMD;
+    rt_elem *iso2 = info->iso2 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        if (IEQ(ico1[j], iso1[j]) && IEQ(ico2[j], iso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("iarr[%d] = %" PR_L "d, iarr[%d] = %" PR_L "d\n",
+                j, iar0[j], (j + S) % n, iar0[(j + S) % n]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C (iarr[%d]*+iarr[%d])hi = %" PR_L "X, "
+                 "(iarr[%d]*-iarr[%d])hi = %" PR_L "X\n",
+                j, (j + S) % n, ico1[j], j, (j + S) % n, ico2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S (iarr[%d]*+iarr[%d])hi = %" PR_L "X, "
+                 "(iarr[%d]*-iarr[%d])hi = %" PR_L "X\n",
+                j, (j + S) % n, iso1[j], j, (j + S) % n, iso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 54 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 55   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 55
+
+rt_void c_test55(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_elem *iar0 = info->iar0 + S*RT_OFFS_SIMD;
+    rt_elem *ico1 = info->ico1 + S*RT_OFFS_SIMD;
+    rt_elem *ico2 = info->ico2 + S*RT_OFFS_SIMD;
+
+    rt_ui08 *bar0 = (rt_ui08 *)iar0;
+    rt_ui08 *bco1 = (rt_ui08 *)ico1;
+
+    j = n;
+    while (j-->0)
+    {
+        ico1[j] = 0;
+        ico2[j] = 0;
+    }
+
+    j = 2*S*sizeof(rt_elem);
+    while (j-->0)
+    {
+        bco1[j + 2] = bar0[j + 2];
+    }
+
+    j = S;
+    while (j-->0)
+    {
+        ico2[j + 1 + S] = iar0[j + 1];
+        ico2[j + 1] = iar0[j + 1 + S];
+    }
+}
+
+/*
+ * As ASM_ENTER/ASM_LEAVE save/load a sizeable portion of registers onto/from
+ * the stack, they are considered heavy and therefore best suited for compute
+ * intensive parts of the program, in which case the ASM overhead is minimized.
+ * The test code below was designed mainly for assembler validation purposes
+ * and therefore may not fully represent its unlocked performance potential.
+ * For optimal results keep ASM sections in separate functions away from
+ * complex C/C++ logic, while making sure those functions are not inlined.
+ * This is needed for better compatibility with modern optimizing compilers.
+ */
+rt_void s_test55(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_IAR0)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movxx_ld(Rebx, Mebp, inf_ISO2)
+
+        xorpx_rr(Xmm4, Xmm4)
+        movpx_st(Xmm4, Medx, AJ0)
+        movpx_st(Xmm4, Medx, AJ1)
+        movpx_st(Xmm4, Medx, AJ2)
+        movpx_st(Xmm4, Mebx, AJ0)
+        movpx_st(Xmm4, Mebx, AJ1)
+        movpx_st(Xmm4, Mebx, AJ2)
+
+        /* halfword-aligned (not element-aligned) load/store */
+        addxx_ri(Recx, IB(2))
+        addxx_ri(Redx, IB(2))
+        muvpx_ld(Xmm0, Mecx, AJ0)
+        muvpx_ld(Xmm1, Mecx, AJ1)
+        muvpx_st(Xmm0, Medx, AJ0)
+        muvpx_st(Xmm1, Medx, AJ1)
+
+        /* element-aligned (not SIMD-aligned) load/store */
+        addxx_ri(Recx, IB(L*4-2))
+        addxx_ri(Rebx, IB(L*4))
+        muvpx_ld(Xmm2, Mecx, AJ0)
+        muvpx_ld(Xmm3, Mecx, AJ1)
+        muvpx_st(Xmm2, Mebx, AJ1)
+        muvpx_st(Xmm3, Mebx, AJ0)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test55(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_elem *iar0 = info->iar0 + S*RT_OFFS_SIMD;
+    rt_elem *ico1 = info->ico1 + S*RT_OFFS_SIMD;
+    rt_elem *ico2 = info->ico2 + S*RT_OFFS_SIMD;
+    rt_elem *iso1 = info->iso1 + S*RT_OFFS_SIMD;
+    rt_elem *iso2 = info->iso2 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        if (IEQ(ico1[j], iso1[j]) && IEQ(ico2[j], iso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("iarr[%d] = %" PR_L "X\n",
+                j, iar0[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C muv+2b[%d] = %" PR_L "X, "
+                 "muv+1e[%d] = %" PR_L "X\n",
+                j, ico1[j], j, ico2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S muv+2b[%d] = %" PR_L "X, "
+                 "muv+1e[%d] = %" PR_L "X\n",
+                j, iso1[j], j, iso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 55 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 56   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 56
+
+rt_void c_test56(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_elem *iar0 = info->iar0 + S*RT_OFFS_SIMD;
+    rt_elem *ico1 = info->ico1 + S*RT_OFFS_SIMD;
+    rt_elem *ico2 = info->ico2 + S*RT_OFFS_SIMD;
+
+    rt_ui08 *bar0 = (rt_ui08 *)iar0;
+    rt_ui08 *bco1 = (rt_ui08 *)ico1;
+    rt_ui08 *bco2 = (rt_ui08 *)ico2;
+
+    j = n;
+    while (j-->0)
+    {
+        ico1[j] = 0;
+        ico2[j] = 0;
+    }
+
+    j = S*sizeof(rt_elem);
+    while (j-->0)
+    {
+        bco1[j + 3] = bar0[j + 1];
+        bco1[j + 5 + S*sizeof(rt_elem)] = bar0[j + 6 + S*sizeof(rt_elem)];
+        bco2[j + 4] = bar0[j + 2];
+        bco2[j + 8 + S*sizeof(rt_elem)] = bar0[j + 12];
+    }
+}
+
+/*
+ * As ASM_ENTER/ASM_LEAVE save/load a sizeable portion of registers onto/from
+ * the stack, they are considered heavy and therefore best suited for compute
+ * intensive parts of the program, in which case the ASM overhead is minimized.
+ * The test code below was designed mainly for assembler validation purposes
+ * and therefore may not fully represent its unlocked performance potential.
+ * For optimal results keep ASM sections in separate functions away from
+ * complex C/C++ logic, while making sure those functions are not inlined.
+ * This is needed for better compatibility with modern optimizing compilers.
+ */
+rt_void s_test56(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_IAR0)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movxx_ld(Rebx, Mebp, inf_ISO2)
+
+        xorpx_rr(Xmm4, Xmm4)
+        movpx_st(Xmm4, Medx, AJ0)
+        movpx_st(Xmm4, Medx, AJ1)
+        movpx_st(Xmm4, Medx, AJ2)
+        movpx_st(Xmm4, Mebx, AJ0)
+        movpx_st(Xmm4, Mebx, AJ1)
+        movpx_st(Xmm4, Mebx, AJ2)
+
+        /* byte-aligned load/store (16-bit subset) */
+        addxx_ri(Recx, IB(1))
+        addxx_ri(Redx, IB(3))
+        muvmx_ld(Xmm0, Mecx, AJ0)
+        muvmx_st(Xmm0, Medx, AJ0)
+
+        /* byte-aligned load/store (64-bit subset) */
+        addxx_ri(Recx, IB(5))
+        addxx_ri(Redx, IB(2))
+        muvqx_ld(Xmm1, Mecx, AJ1)
+        muvqx_st(Xmm1, Medx, AJ1)
+
+        /* halfword/word-aligned load/store (32-bit subset) */
+        subxx_ri(Recx, IB(4))
+        addxx_ri(Rebx, IB(4))
+        muvox_ld(Xmm2, Mecx, AJ0)
+        muvox_st(Xmm2, Mebx, AJ0)
+        addxx_ri(Recx, IB(10))
+        addxx_ri(Rebx, IB(4))
+        muvox_ld(Xmm3, Mecx, AJ0)
+        muvox_st(Xmm3, Mebx, AJ1)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test56(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_elem *iar0 = info->iar0 + S*RT_OFFS_SIMD;
+    rt_elem *ico1 = info->ico1 + S*RT_OFFS_SIMD;
+    rt_elem *ico2 = info->ico2 + S*RT_OFFS_SIMD;
+    rt_elem *iso1 = info->iso1 + S*RT_OFFS_SIMD;
+    rt_elem *iso2 = info->iso2 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        if (IEQ(ico1[j], iso1[j]) && IEQ(ico2[j], iso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("iarr[%d] = %" PR_L "X\n",
+                j, iar0[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C muvm/q+1b[%d] = %" PR_L "X, "
+                 "muvo+2b[%d] = %" PR_L "X\n",
+                j, ico1[j], j, ico2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S muvm/q+1b[%d] = %" PR_L "X, "
+                 "muvo+2b[%d] = %" PR_L "X\n",
+                j, iso1[j], j, iso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 56 */
+
 /******************************************************************************/
 /*********************************   TABLES   *********************************/
 /******************************************************************************/
@@ -7873,6 +8532,21 @@ testXX c_test[SUB_TEST] =
 #if SUB_TEST >= 51
     c_test51,
 #endif /* SUB_TEST 51 */
+#if SUB_TEST >= 52
+    c_test52,
+#endif /* SUB_TEST 52 */
+#if SUB_TEST >= 53
+    c_test53,
+#endif /* SUB_TEST 53 */
+#if SUB_TEST >= 54
+    c_test54,
+#endif /* SUB_TEST 54 */
+#if SUB_TEST >= 55
+    c_test55,
+#endif /* SUB_TEST 55 */
+#if SUB_TEST >= 56
+    c_test56,
+#endif /* SUB_TEST 56 */
 };
 
 volatile
@@ -8081,6 +8755,21 @@ testXX s_test[SUB_TEST] =
 #if SUB_TEST >= 51
     s_test51,
 #endif /* SUB_TEST 51 */
+#if SUB_TEST >= 52
+    s_test52,
+#endif /* SUB_TEST 52 */
+#if SUB_TEST >= 53
+    s_test53,
+#endif /* SUB_TEST 53 */
+#if SUB_TEST >= 54
+    s_test54,
+#endif /* SUB_TEST 54 */
+#if SUB_TEST >= 55
+    s_test55,
+#endif /* SUB_TEST 55 */
+#if SUB_TEST >= 56
+    s_test56,
+#endif /* SUB_TEST 56 */
 };
 
 volatile
@@ -8289,6 +8978,21 @@ testXX p_test[SUB_TEST] =
 #if SUB_TEST >= 51
     p_test51,
 #endif /* SUB_TEST 51 */
+#if SUB_TEST >= 52
+    p_test52,
+#endif /* SUB_TEST 52 */
+#if SUB_TEST >= 53
+    p_test53,
+#endif /* SUB_TEST 53 */
+#if SUB_TEST >= 54
+    p_test54,
+#endif /* SUB_TEST 54 */
+#if SUB_TEST >= 55
+    p_test55,
+#endif /* SUB_TEST 55 */
+#if SUB_TEST >= 56
+    p_test56,
+#endif /* SUB_TEST 56 */
 };
 
 /******************************************************************************/